@@ -82,6 +82,13 @@ export class DeviceAgent {
       },
     });
   }
+
+  sendWrappedEvents(pageId: string, events: $ReadOnlyArray<JSONSerializable>) {
+    this.send({
+      event: 'wrappedEvents',
+      payload: events.map(event => ({pageId, wrappedEvent: event})),
+    });
+  }
 }
 
 export class DeviceMock extends DeviceAgent {
@@ -148,5 +148,61 @@ describe.each(['HTTP', 'HTTPS'])(
         device1.close();
       }
     });
+
+    test('batched messages from device to debugger', async () => {
+      const device1 = await createDeviceMock(
+        `${serverRef.serverBaseWsUrl}/inspector/device?device=device1&name=foo&app=bar`,
+        autoCleanup.signal,
+      );
+      try {
+        device1.getPages.mockImplementation(() => [
+          {
+            app: 'bar-app',
+            id: 'page1',
+            title: 'bar-title',
+            vm: 'bar-vm',
+          },
+        ]);
+
+        let pageList: Array<PageDescription> = [];
+        await until(async () => {
+          pageList = (await fetchJson(
+            `${serverRef.serverBaseUrl}/json`,
+            // $FlowIgnore[unclear-type]
+          ): any);
+          expect(pageList).toHaveLength(1);
+        });
+        expect(device1.getPages).toBeCalledWith({
+          event: 'getPages',
+          payload: {supportsBatchedEvents: true},
+        });
+        const [{webSocketDebuggerUrl}] = pageList;
+
+        const debugger_ = await createDebuggerMock(
+          webSocketDebuggerUrl,
+          autoCleanup.signal,
+        );
+        try {
+          await until(() => expect(device1.connect).toBeCalled());
+
+          device1.sendWrappedEvents('page1', [
+            {id: 0},
+            {method: 'Runtime.consoleAPICalled', params: {args: []}},
+          ]);
+
+          await until(() =>
+            expect(debugger_.handle).toBeCalledWith({
+              method: 'Runtime.consoleAPICalled',
+              params: {args: []},
+            }),
+          );
+          expect(debugger_.handle).toHaveBeenNthCalledWith(1, {id: 0});
+        } finally {
+          debugger_.close();
+        }
+      } finally {
+        device1.close();
+      }
+    });
   },
 );
@@ -138,7 +138,11 @@ export default class Device {
     });
     // Sends 'getPages' request to device every PAGES_POLLING_INTERVAL milliseconds.
     this.#pagesPollingIntervalId = setInterval(
-      () => this.#sendMessageToDevice({event: 'getPages'}),
+      () =>
+        this.#sendMessageToDevice({
+          event: 'getPages',
+          payload: {supportsBatchedEvents: true},
+        }),
       PAGES_POLLING_INTERVAL,
     );
     this.#deviceSocket.on('close', () => {
@@ -388,44 +392,49 @@ export default class Device {
         }
       }
     } else if (message.event === 'wrappedEvent') {
-      if (this.#debuggerConnection == null) {
-        return;
+      this.#forwardMessageFromDevice(JSON.parse(message.payload.wrappedEvent));
+    } else if (message.event === 'wrappedEvents') {
+      for (const {wrappedEvent} of message.payload) {
+        // $FlowFixMe[incompatible-call] Devices only wrap CDP messages.
+        this.#forwardMessageFromDevice(wrappedEvent);
       }
+    }
+  }
 
-      // FIXME: Is it possible that we received message for pageID that does not
-      // correspond to current debugger connection?
-      // TODO(moti): yes, fix multi-debugger case
+  // Forwards a CDP message received from device to the debugger.
+  #forwardMessageFromDevice(parsedPayload: CDPServerMessage) {
+    if (this.#debuggerConnection == null) {
+      return;
+    }
 
-      const debuggerSocket = this.#debuggerConnection.socket;
-      if (debuggerSocket == null || debuggerSocket.readyState !== WS.OPEN) {
-        // TODO(hypuk): Send error back to device?
-        return;
-      }
+    // FIXME: Is it possible that we received message for pageID that does not
+    // correspond to current debugger connection?
+    // TODO(moti): yes, fix multi-debugger case
 
-      const parsedPayload = JSON.parse(message.payload.wrappedEvent);
-      const pageId = this.#debuggerConnection?.pageId ?? null;
-      if ('id' in parsedPayload) {
-        this.#deviceEventReporter?.logResponse(parsedPayload, 'device', {
-          pageId,
-          frontendUserAgent: this.#debuggerConnection?.userAgent ?? null,
-        });
-      }
+    const debuggerSocket = this.#debuggerConnection.socket;
+    if (debuggerSocket == null || debuggerSocket.readyState !== WS.OPEN) {
+      // TODO(hypuk): Send error back to device?
+      return;
+    }
 
-      if (this.#debuggerConnection != null) {
-        // Wrapping just to make flow happy :)
-        // $FlowFixMe[unused-promise]
-        this.#processMessageFromDeviceLegacy(
-          parsedPayload,
-          this.#debuggerConnection,
-          pageId,
-        ).then(() => {
-          const messageToSend = JSON.stringify(parsedPayload);
-          debuggerSocket.send(messageToSend);
-        });
-      } else {
-        debuggerSocket.send(message.payload.wrappedEvent);
-      }
+    const pageId = this.#debuggerConnection?.pageId ?? null;
+    if ('id' in parsedPayload) {
+      this.#deviceEventReporter?.logResponse(parsedPayload, 'device', {
+        pageId,
+        frontendUserAgent: this.#debuggerConnection?.userAgent ?? null,
+      });
     }
+
+    // Wrapping just to make flow happy :)
+    // $FlowFixMe[unused-promise]
+    this.#processMessageFromDeviceLegacy(
+      parsedPayload,
+      this.#debuggerConnection,
+      pageId,
+    ).then(() => {
+      const messageToSend = JSON.stringify(parsedPayload);
+      debuggerSocket.send(messageToSend);
+    });
   }
 
   // Sends single message to device.
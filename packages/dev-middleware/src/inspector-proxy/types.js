@@ -55,6 +55,18 @@ export type WrappedEvent = $ReadOnly<{
   }>,
 }>;
 
+// Chrome Debugger Protocol messages/events batched into a single frame by the
+// device. The messages are not wrapped in JSON strings.
+export type WrappedEvents = $ReadOnly<{
+  event: 'wrappedEvents',
+  payload: $ReadOnlyArray<
+    $ReadOnly<{
+      pageId: string,
+      wrappedEvent: JSONSerializable,
+    }>,
+  >,
+}>;
+
 // Request sent from Inspector Proxy to Device when new debugger is connected
 // to particular page.
 export type ConnectRequest = $ReadOnly<{
@@ -69,8 +81,15 @@ export type DisconnectRequest = $ReadOnly<{
   payload: $ReadOnly<{pageId: string}>,
 }>;
 
-// Request sent from Inspector Proxy to Device to get a list of pages.
-export type GetPagesRequest = {event: 'getPages'};
+// Request sent from Inspector Proxy to Device to get a list of pages. Also
+// advertises the optional protocol features supported by the Inspector Proxy.
+export type GetPagesRequest = {
+  event: 'getPages',
+  payload?: $ReadOnly<{
+    // The device may send WrappedEvents instead of WrappedEvent messages.
+    supportsBatchedEvents?: boolean,
+  }>,
+};
 
 // Response to GetPagesRequest containing a list of page infos.
 export type GetPagesResponse = {
@@ -82,6 +101,7 @@ export type GetPagesResponse = {
 export type MessageFromDevice =
   | GetPagesResponse
   | WrappedEvent
+  | WrappedEvents
   | DisconnectRequest;
 
 // Union type for all possible messages sent from Inspector Proxy to device.
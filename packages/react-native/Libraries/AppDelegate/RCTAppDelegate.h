@@ -9,6 +9,7 @@
 #import <UIKit/UIKit.h>
 
 @class RCTBridge;
+@class RCTHost;
 @protocol RCTBridgeDelegate;
 @protocol RCTComponentViewProtocol;
 @class RCTRootView;
@@ -58,6 +59,8 @@ NS_ASSUME_NONNULL_BEGIN
 /// The window object, used to render the UViewControllers
 @property (nonatomic, strong, nonnull) UIWindow *window;
 @property (nonatomic, strong, nullable) RCTBridge *bridge;
+/// The host of React Native when the new initialization layer is enabled, `nil` otherwise.
+@property (nonatomic, strong, readonly, nullable) RCTHost *reactHost;
 @property (nonatomic, strong, nullable) NSString *moduleName;
 @property (nonatomic, strong, nullable) NSDictionary *initialProps;
 
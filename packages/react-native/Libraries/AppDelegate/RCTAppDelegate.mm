@@ -290,6 +290,11 @@ static NSDictionary *updateInitialProps(NSDictionary *initialProps, BOOL isFabri
 
 #pragma mark - New Arch Utilities
 
+- (RCTHost *)reactHost
+{
+  return _reactHost;
+}
+
 - (void)createReactHost
 {
   __weak __typeof(self) weakSelf = self;
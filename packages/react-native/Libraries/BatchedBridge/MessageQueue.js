@@ -75,6 +75,10 @@ class MessageQueue {
       // $FlowFixMe[method-unbinding] added when improving typing for this parameters
       this.callFunctionReturnFlushedQueue.bind(this);
     // $FlowFixMe[cannot-write]
+    this.callFunctionsReturnFlushedQueue =
+      // $FlowFixMe[method-unbinding] added when improving typing for this parameters
+      this.callFunctionsReturnFlushedQueue.bind(this);
+    // $FlowFixMe[cannot-write]
     // $FlowFixMe[method-unbinding] added when improving typing for this parameters
     this.flushedQueue = this.flushedQueue.bind(this);
 
@@ -116,6 +120,20 @@ class MessageQueue {
     return this.flushedQueue();
   }
 
+  // Like `callFunctionReturnFlushedQueue`, for the calls made by native within
+  // a short period of time. The native calls they make are flushed once.
+  callFunctionsReturnFlushedQueue(
+    calls: $ReadOnlyArray<[string, string, mixed[]]>,
+  ): null | [Array<number>, Array<number>, Array<mixed>, number] {
+    for (const [module, method, args] of calls) {
+      this.__guard(() => {
+        this.__callFunction(module, method, args);
+      });
+    }
+
+    return this.flushedQueue();
+  }
+
   invokeCallbackAndReturnFlushedQueue(
     cbID: number,
     args: mixed[],
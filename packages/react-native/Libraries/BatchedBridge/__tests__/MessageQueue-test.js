@@ -65,6 +65,32 @@ describe('MessageQueue', function () {
     assertQueue(flushedQueue, 0, 0, 1, ['foo']);
   });
 
+  it('should call a batch of local functions and flush native calls once', () => {
+    MessageQueueTestModule.testHook1 = jest.fn(() => {
+      queue.enqueueNativeCall(0, 1, ['foo']);
+    });
+    MessageQueueTestModule.testHook2 = jest.fn(() => {
+      throw new Error('testHook2');
+    });
+    queue.__shouldPauseOnThrow = jest.fn(() => false);
+    const ErrorUtils = require('../../vendor/core/ErrorUtils');
+    const reportFatalError = jest
+      .spyOn(ErrorUtils, 'reportFatalError')
+      .mockImplementation(() => {});
+
+    const flushedQueue = queue.callFunctionsReturnFlushedQueue([
+      ['MessageQueueTestModule', 'testHook1', []],
+      ['MessageQueueTestModule', 'testHook2', []],
+      ['MessageQueueTestModule', 'testHook1', []],
+    ]);
+
+    // A call that throws doesn't prevent the next calls of the batch.
+    expect(MessageQueueTestModule.testHook1).toHaveBeenCalledTimes(2);
+    expect(reportFatalError).toHaveBeenCalledTimes(1);
+    assertQueue(flushedQueue, 0, 0, 1, ['foo']);
+    assertQueue(flushedQueue, 1, 0, 1, ['foo']);
+  });
+
   it('should call the stored callback', () => {
     let done = false;
     queue.enqueueNativeCall(
@@ -123,6 +123,49 @@ class BlobManager {
     });
   }
 
+  /**
+   * If blob data can be transferred to and from `ArrayBuffer`s without
+   * converting it to base64. Native installs the functions doing it lazily.
+   */
+  static canTransferArrayBuffers(): boolean {
+    return (
+      global.__blobArrayBufferProvider != null &&
+      global.__blobArrayBufferStore != null
+    );
+  }
+
+  /**
+   * Returns the data of a blob received from native (e.g. an XHR response)
+   * as an `ArrayBuffer` sharing its native storage, and releases the blob,
+   * so that the buffer becomes the only owner of the data.
+   */
+  static takeArrayBuffer(data: BlobData): ArrayBuffer {
+    invariant(NativeBlobModule, 'NativeBlobModule is available.');
+
+    const arrayBuffer = global.__blobArrayBufferProvider(
+      data.blobId,
+      data.offset,
+      data.size,
+    );
+    NativeBlobModule.release(data.blobId);
+    return arrayBuffer;
+  }
+
+  /**
+   * Stores the bytes of an `ArrayBuffer` as a blob for a single upload, which
+   * native releases once the request body is sent.
+   */
+  static storeArrayBuffer(buffer: ArrayBuffer | $ArrayBufferView): BlobData {
+    const view: $ArrayBufferView =
+      buffer instanceof ArrayBuffer ? new Uint8Array(buffer) : buffer;
+    const blobId = global.__blobArrayBufferStore(
+      view.buffer,
+      view.byteOffset,
+      view.byteLength,
+    );
+    return {blobId, offset: 0, size: view.byteLength, isTransient: true};
+  }
+
   /**
    * Deallocate resources for a blob.
    */
@@ -19,6 +19,8 @@ export type BlobData = {
   name?: string,
   type?: string,
   lastModified?: number,
+  // Blobs stored for a single upload, which native releases once it is sent.
+  isTransient?: boolean,
   __collector?: ?BlobCollector,
   ...
 };
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#import <Foundation/Foundation.h>
+#import <jsi/jsi.h>
+
+@class RCTBlobManager;
+
+namespace facebook::react {
+
+/*
+ * A `jsi::MutableBuffer` backed by the `NSData` of a blob, which lets JS read
+ * blob data as an `ArrayBuffer` without copying it.
+ */
+class JSI_EXPORT RCTBlobArrayBuffer : public jsi::MutableBuffer {
+ public:
+  RCTBlobArrayBuffer(NSData *data);
+
+  size_t size() const override;
+  uint8_t *data() override;
+
+  /*
+   * Installs `__blobArrayBufferProvider(blobId, offset, size)`, which returns
+   * an `ArrayBuffer` sharing the storage of a blob, and
+   * `__blobArrayBufferStore(arrayBuffer, byteOffset, byteLength)`, which
+   * stores a copy of the bytes of an `ArrayBuffer` as a blob and returns its
+   * id, for uploads which would otherwise be sent as base64 strings.
+   */
+  static void install(RCTBlobManager *blobManager);
+
+ private:
+  NSData *data_;
+};
+
+} // namespace facebook::react
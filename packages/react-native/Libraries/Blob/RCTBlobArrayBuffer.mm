@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#import "RCTBlobArrayBuffer.h"
+
+#import <React/RCTBlobManager.h>
+#import <React/RCTBridge+Private.h>
+
+namespace facebook::react {
+
+RCTBlobArrayBuffer::RCTBlobArrayBuffer(NSData *data) : data_(data) {}
+
+size_t RCTBlobArrayBuffer::size() const
+{
+  return data_.length;
+}
+
+uint8_t *RCTBlobArrayBuffer::data()
+{
+  return static_cast<uint8_t *>(const_cast<void *>(data_.bytes));
+}
+
+void RCTBlobArrayBuffer::install(RCTBlobManager *blobManager)
+{
+  __weak RCTCxxBridge *cxxBridge = (RCTCxxBridge *)blobManager.bridge;
+  [cxxBridge
+      dispatchBlock:^{
+        if (!cxxBridge || cxxBridge.runtime == nullptr) {
+          return;
+        }
+        jsi::Runtime &runtime = *(jsi::Runtime *)cxxBridge.runtime;
+        runtime.global().setProperty(
+            runtime,
+            "__blobArrayBufferProvider",
+            jsi::Function::createFromHostFunction(
+                runtime,
+                jsi::PropNameID::forAscii(runtime, "__blobArrayBufferProvider"),
+                3,
+                [blobManager](jsi::Runtime &rt, const jsi::Value &thisVal, const jsi::Value *args, size_t count) {
+                  auto blobId = args[0].asString(rt).utf8(rt);
+                  // `resolve:` only copies when a part of the blob is requested.
+                  NSData *data = [blobManager resolve:[NSString stringWithUTF8String:blobId.c_str()]
+                                               offset:(NSInteger)args[1].asNumber()
+                                                 size:(NSInteger)args[2].asNumber()];
+                  if (!data) {
+                    throw jsi::JSError(rt, "Unknown blob: " + blobId);
+                  }
+                  return jsi::ArrayBuffer(rt, std::make_shared<RCTBlobArrayBuffer>(data));
+                }));
+        runtime.global().setProperty(
+            runtime,
+            "__blobArrayBufferStore",
+            jsi::Function::createFromHostFunction(
+                runtime,
+                jsi::PropNameID::forAscii(runtime, "__blobArrayBufferStore"),
+                3,
+                [blobManager](jsi::Runtime &rt, const jsi::Value &thisVal, const jsi::Value *args, size_t count) {
+                  auto arrayBuffer = args[0].asObject(rt).getArrayBuffer(rt);
+                  auto byteOffset = static_cast<size_t>(args[1].asNumber());
+                  auto byteLength = static_cast<size_t>(args[2].asNumber());
+                  if (byteOffset + byteLength > arrayBuffer.size(rt)) {
+                    throw jsi::JSError(rt, "Range is out of the bounds of the ArrayBuffer");
+                  }
+                  NSData *data = [NSData dataWithBytes:arrayBuffer.data(rt) + byteOffset length:byteLength];
+                  return jsi::String::createFromUtf8(rt, [blobManager store:data].UTF8String);
+                }));
+      }
+              queue:RCTJSThread];
+}
+
+} // namespace facebook::react
@@ -12,6 +12,13 @@
 
 RCT_EXTERN void RCTEnableBlobManagerProcessingQueue(BOOL enabled);
 
+/**
+ * Lets JS read blobs as `ArrayBuffer`s sharing their native storage, and store
+ * `ArrayBuffer`s as blobs, so that XHR `arraybuffer` responses and uploads
+ * aren't converted to and from base64.
+ */
+RCT_EXTERN void RCTEnableBlobArrayBuffers(BOOL enabled);
+
 @interface RCTBlobManager : NSObject <RCTBridgeModule, RCTURLRequestHandler, RCTInitializing>
 
 - (NSString *)store:(NSData *)data;
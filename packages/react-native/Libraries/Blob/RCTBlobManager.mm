@@ -16,6 +16,7 @@
 #import <React/RCTUtils.h>
 #import <React/RCTWebSocketModule.h>
 
+#import "RCTBlobArrayBuffer.h"
 #import "RCTBlobCollector.h"
 #import "RCTBlobPlugins.h"
 
@@ -29,6 +30,13 @@ RCT_EXTERN void RCTEnableBlobManagerProcessingQueue(BOOL enabled)
   gBlobManagerProcessingQueueEnabled = enabled;
 }
 
+static BOOL gBlobArrayBuffersEnabled = NO;
+
+RCT_EXTERN void RCTEnableBlobArrayBuffers(BOOL enabled)
+{
+  gBlobArrayBuffersEnabled = enabled;
+}
+
 static NSString *const kBlobURIScheme = @"blob";
 
 @interface RCTBlobManager () <
@@ -65,6 +73,9 @@ RCT_EXPORT_MODULE(BlobModule)
   }
 
   facebook::react::RCTBlobCollector::install(self);
+  if (gBlobArrayBuffersEnabled) {
+    facebook::react::RCTBlobArrayBuffer::install(self);
+  }
 }
 
 + (BOOL)requiresMainQueueSetup
@@ -297,7 +308,13 @@ RCT_EXPORT_METHOD(release : (NSString *)blobId)
     contentType = blob[@"type"];
   }
 
-  return @{@"body" : [self resolve:blob], @"contentType" : contentType};
+  NSData *body = [self resolve:blob];
+  // Blobs stored from `ArrayBuffer`s for a single upload are owned by it.
+  if ([RCTConvert BOOL:blob[@"isTransient"]]) {
+    [self remove:[RCTConvert NSString:blob[@"blobId"]]];
+  }
+
+  return @{@"body" : body, @"contentType" : contentType};
 }
 
 - (BOOL)canHandleNetworkingResponse:(NSString *)responseType
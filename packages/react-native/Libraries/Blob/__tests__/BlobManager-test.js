@@ -23,4 +23,41 @@ describe('BlobManager', function () {
     expect(blob).toBeInstanceOf(Blob);
     expect(blob.type).toBe('text/html');
   });
+
+  describe('ArrayBuffer transfer', () => {
+    afterEach(() => {
+      delete global.__blobArrayBufferProvider;
+      delete global.__blobArrayBufferStore;
+    });
+
+    it('should be available once native installs it', () => {
+      expect(BlobManager.canTransferArrayBuffers()).toBe(false);
+      global.__blobArrayBufferProvider = jest.fn();
+      global.__blobArrayBufferStore = jest.fn();
+      expect(BlobManager.canTransferArrayBuffers()).toBe(true);
+    });
+
+    it('should take blob data as an ArrayBuffer and release the blob', () => {
+      const NativeModules = require('../../BatchedBridge/NativeModules');
+      const release = jest.spyOn(NativeModules.BlobModule, 'release');
+      const buffer = new ArrayBuffer(4);
+      global.__blobArrayBufferProvider = jest.fn(() => buffer);
+
+      expect(
+        BlobManager.takeArrayBuffer({blobId: 'id', offset: 0, size: 4}),
+      ).toBe(buffer);
+      expect(global.__blobArrayBufferProvider).toBeCalledWith('id', 0, 4);
+      expect(release).toBeCalledWith('id');
+    });
+
+    it('should store views of ArrayBuffers as transient blobs', () => {
+      const buffer = new ArrayBuffer(8);
+      global.__blobArrayBufferStore = jest.fn(() => 'id');
+
+      expect(
+        BlobManager.storeArrayBuffer(new Uint8Array(buffer, 2, 4)),
+      ).toEqual({blobId: 'id', offset: 0, size: 4, isTransient: true});
+      expect(global.__blobArrayBufferStore).toBeCalledWith(buffer, 2, 4);
+    });
+  });
 });
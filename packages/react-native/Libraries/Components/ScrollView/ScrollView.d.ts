@@ -716,6 +716,21 @@ export interface ScrollViewProps
    */
   removeClippedSubviews?: boolean | undefined;
 
+  /**
+   * Experimental: When true, the native views of the children of the content
+   * container are only mounted while they are within
+   * `experimental_nativeWindowingOverscan` viewport lengths of the visible
+   * area. The default value is false.
+   */
+  experimental_nativeWindowing?: boolean | undefined;
+
+  /**
+   * How far (in viewport lengths) beyond each edge of the visible area the
+   * children are mounted when `experimental_nativeWindowing` is true.
+   * The default value is 1.
+   */
+  experimental_nativeWindowingOverscan?: number | undefined;
+
   /**
    * When true, shows a horizontal scroll indicator.
    */
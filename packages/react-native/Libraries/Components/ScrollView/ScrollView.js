@@ -636,6 +636,21 @@ export type Props = $ReadOnly<{|
    * true.
    */
   removeClippedSubviews?: ?boolean,
+  /**
+   * Experimental: When true, the native views of the children of the content
+   * container are only mounted while they are within
+   * `experimental_nativeWindowingOverscan` viewport lengths of the visible
+   * area. Unlike `VirtualizedList`, the children stay rendered and laid out,
+   * and their views are mounted and unmounted on the UI thread as the
+   * ScrollView scrolls. The default value is false.
+   */
+  experimental_nativeWindowing?: ?boolean,
+  /**
+   * How far (in viewport lengths) beyond each edge of the visible area the
+   * children are mounted when `experimental_nativeWindowing` is true.
+   * The default value is 1.
+   */
+  experimental_nativeWindowingOverscan?: ?number,
   /**
    * A RefreshControl component, used to provide pull-to-refresh
    * functionality for the ScrollView. Only works for vertical ScrollViews
@@ -87,6 +87,8 @@ export const __INTERNAL_VIEW_CONFIG: PartialViewConfig =
           },
           pointerEvents: true,
           isInvertedVirtualizedList: true,
+          experimental_nativeWindowing: true,
+          experimental_nativeWindowingOverscan: true,
         },
       }
     : {
@@ -132,6 +134,8 @@ export const __INTERNAL_VIEW_CONFIG: PartialViewConfig =
           decelerationRate: true,
           directionalLockEnabled: true,
           disableIntervalMomentum: true,
+          experimental_nativeWindowing: true,
+          experimental_nativeWindowingOverscan: true,
           indicatorStyle: true,
           inverted: true,
           keyboardDismissMode: true,
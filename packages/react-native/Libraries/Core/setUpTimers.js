@@ -54,6 +54,16 @@ if (global.RN$Bridgeless !== true) {
   defineLazyTimer('cancelAnimationFrame');
   defineLazyTimer('requestIdleCallback');
   defineLazyTimer('cancelIdleCallback');
+} else if (global.nativeRuntimeScheduler != null) {
+  // In bridgeless mode, idle callbacks are scheduled by the RuntimeScheduler.
+  polyfillGlobal(
+    'requestIdleCallback',
+    () => global.nativeRuntimeScheduler.requestIdleCallback,
+  );
+  polyfillGlobal(
+    'cancelIdleCallback',
+    () => global.nativeRuntimeScheduler.cancelIdleCallback,
+  );
 }
 
 /**
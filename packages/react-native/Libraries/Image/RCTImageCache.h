@@ -36,6 +36,12 @@
 
 @end
 
+/**
+ * Caches decoded images by URL, target size, scale and resize mode, within a
+ * global memory budget. When the budget is exceeded, the least recently used
+ * images are evicted first. Evicted images that are still displayed are
+ * returned again without counting against the budget until they are requested.
+ */
 @interface RCTImageCache : NSObject <RCTImageCache>
 
 RCT_EXTERN void RCTSetImageCacheLimits(
@@ -33,17 +33,45 @@ static NSString *RCTCacheKeyForImage(NSString *imageTag, CGSize size, CGFloat sc
       [NSString stringWithFormat:@"%@|%g|%g|%g|%lld", imageTag, size.width, size.height, scale, (long long)resizeMode];
 }
 
+@interface RCTImageCacheEntry : NSObject
+
+@property (nonatomic, strong, readonly) UIImage *image;
+@property (nonatomic, assign, readonly) NSUInteger cost;
+
+@end
+
+@implementation RCTImageCacheEntry
+
+- (instancetype)initWithImage:(UIImage *)image cost:(NSUInteger)cost
+{
+  if (self = [super init]) {
+    _image = image;
+    _cost = cost;
+  }
+  return self;
+}
+
+@end
+
 @implementation RCTImageCache {
-  NSOperationQueue *_imageDecodeQueue;
-  NSCache *_decodedImageCache;
+  // Decoded images within the memory budget, evicted least recently used first.
+  NSMutableDictionary<NSString *, RCTImageCacheEntry *> *_decodedImageCache;
+  NSMutableOrderedSet<NSString *> *_recentlyUsedKeys;
+  NSUInteger _totalCost;
+  // Every decoded image that is still alive, e.g. because a view displays it.
+  // Images evicted from the budget stay reachable while they are displayed, so
+  // showing them again doesn't decode them again, and doesn't take memory from
+  // images that are not displayed anymore.
+  NSMapTable<NSString *, UIImage *> *_liveImages;
   NSMutableDictionary *_cacheStaleTimes;
 }
 
 - (instancetype)init
 {
   if (self = [super init]) {
-    _decodedImageCache = [NSCache new];
-    _decodedImageCache.totalCostLimit = RCTImageCacheTotalCostLimit;
+    _decodedImageCache = [NSMutableDictionary new];
+    _recentlyUsedKeys = [NSMutableOrderedSet new];
+    _liveImages = [NSMapTable strongToWeakObjectsMapTable];
     _cacheStaleTimes = [NSMutableDictionary new];
 
     [[NSNotificationCenter defaultCenter] addObserver:self
@@ -61,20 +89,51 @@ static NSString *RCTCacheKeyForImage(NSString *imageTag, CGSize size, CGFloat sc
 
 - (void)clearCache
 {
-  [_decodedImageCache removeAllObjects];
+  @synchronized(_decodedImageCache) {
+    [_decodedImageCache removeAllObjects];
+    [_recentlyUsedKeys removeAllObjects];
+    _totalCost = 0;
+  }
   @synchronized(_cacheStaleTimes) {
     [_cacheStaleTimes removeAllObjects];
   }
 }
 
+// Must be called while synchronized on _decodedImageCache.
+- (void)removeImageForKey:(NSString *)cacheKey
+{
+  RCTImageCacheEntry *entry = _decodedImageCache[cacheKey];
+  if (entry) {
+    _totalCost -= entry.cost;
+    [_decodedImageCache removeObjectForKey:cacheKey];
+    [_recentlyUsedKeys removeObject:cacheKey];
+  }
+}
+
+// Must be called while synchronized on _decodedImageCache.
+- (void)setImage:(UIImage *)image forKey:(NSString *)cacheKey cost:(NSUInteger)cost
+{
+  [self removeImageForKey:cacheKey];
+  _decodedImageCache[cacheKey] = [[RCTImageCacheEntry alloc] initWithImage:image cost:cost];
+  [_recentlyUsedKeys addObject:cacheKey];
+  _totalCost += cost;
+
+  while (_totalCost > RCTImageCacheTotalCostLimit && _recentlyUsedKeys.count > 1) {
+    [self removeImageForKey:_recentlyUsedKeys.firstObject];
+  }
+}
+
 - (void)addImageToCache:(UIImage *)image forKey:(NSString *)cacheKey
 {
   if (!image) {
     return;
   }
   NSInteger bytes = image.reactDecodedImageBytes;
-  if (bytes <= RCTMaxCacheableDecodedImageSizeInBytes) {
-    [self->_decodedImageCache setObject:image forKey:cacheKey cost:bytes];
+  @synchronized(_decodedImageCache) {
+    [_liveImages setObject:image forKey:cacheKey];
+    if (bytes <= RCTMaxCacheableDecodedImageSizeInBytes) {
+      [self setImage:image forKey:cacheKey cost:(NSUInteger)bytes];
+    }
   }
 }
 
@@ -87,12 +146,30 @@ static NSString *RCTCacheKeyForImage(NSString *imageTag, CGSize size, CGFloat sc
       if ([[NSDate new] compare:(NSDate *)staleTime] == NSOrderedDescending) {
         // cached image has expired, clear it out to make room for others
         [_cacheStaleTimes removeObjectForKey:cacheKey];
-        [_decodedImageCache removeObjectForKey:cacheKey];
+        @synchronized(_decodedImageCache) {
+          [self removeImageForKey:cacheKey];
+          [_liveImages removeObjectForKey:cacheKey];
+        }
         return nil;
       }
     }
   }
-  return [_decodedImageCache objectForKey:cacheKey];
+  @synchronized(_decodedImageCache) {
+    RCTImageCacheEntry *entry = _decodedImageCache[cacheKey];
+    if (entry) {
+      // Mark as most recently used.
+      [_recentlyUsedKeys removeObject:cacheKey];
+      [_recentlyUsedKeys addObject:cacheKey];
+      return entry.image;
+    }
+
+    UIImage *image = [_liveImages objectForKey:cacheKey];
+    if (image && image.reactDecodedImageBytes <= RCTMaxCacheableDecodedImageSizeInBytes) {
+      // The image is in use again, so it's kept alive by the cache again.
+      [self setImage:image forKey:cacheKey cost:(NSUInteger)image.reactDecodedImageBytes];
+    }
+    return image;
+  }
 }
 
 - (void)addImageToCache:(UIImage *)image
@@ -65,6 +65,52 @@ static NSError *addResponseHeadersToError(NSError *originalError, NSHTTPURLRespo
 
 @end
 
+/**
+ * The priority of a request, shared by its pending download and decode so that
+ * it can be changed while they are queued.
+ */
+@interface RCTImageLoadPriority : NSObject
+
+@property (atomic, assign) RCTImageLoaderPriority priority;
+
+- (instancetype)initWithPriority:(RCTImageLoaderPriority)priority;
+
+@end
+
+@implementation RCTImageLoadPriority
+
+- (instancetype)initWithPriority:(RCTImageLoaderPriority)priority
+{
+  if (self = [super init]) {
+    _priority = priority;
+  }
+  return self;
+}
+
+@end
+
+@interface RCTPendingImageDecode : NSObject
+
+@property (nonatomic, copy, readonly) dispatch_block_t decodeBlock;
+@property (nonatomic, strong, readonly) RCTImageLoadPriority *loadPriority;
+
+- (instancetype)initWithDecodeBlock:(dispatch_block_t)decodeBlock loadPriority:(RCTImageLoadPriority *)loadPriority;
+
+@end
+
+@implementation RCTPendingImageDecode
+
+- (instancetype)initWithDecodeBlock:(dispatch_block_t)decodeBlock loadPriority:(RCTImageLoadPriority *)loadPriority
+{
+  if (self = [super init]) {
+    _decodeBlock = [decodeBlock copy];
+    _loadPriority = loadPriority;
+  }
+  return self;
+}
+
+@end
+
 @implementation UIImage (React)
 
 - (NSInteger)reactDecodedImageBytes
@@ -92,8 +138,10 @@ static NSError *addResponseHeadersToError(NSError *originalError, NSHTTPURLRespo
   dispatch_queue_t _URLRequestQueue;
   id<RCTImageCache> _imageCache;
   NSMutableArray *_pendingTasks;
+  NSMapTable<RCTNetworkTask *, RCTImageLoadPriority *> *_pendingTaskPriorities;
   NSInteger _activeTasks;
-  NSMutableArray *_pendingDecodes;
+  NSMutableArray<RCTPendingImageDecode *> *_pendingDecodes;
+  NSMapTable<NSString *, RCTImageLoadPriority *> *_requestPriorities;
   NSInteger _scheduledDecodes;
   NSUInteger _activeBytes;
   std::mutex _loadersMutex;
@@ -122,6 +170,7 @@ RCT_EXPORT_MODULE()
 {
   if (self = [super init]) {
     _redirectDelegate = redirectDelegate;
+    _requestPriorities = [NSMapTable strongToWeakObjectsMapTable];
   }
   return self;
 }
@@ -433,33 +482,51 @@ static UIImage *RCTResizeImageIfNeeded(UIImage *image, CGSize size, CGFloat scal
       [self->_pendingTasks removeObjectsInArray:tasksToRemove];
     }
 
-    // Start queued decode
-    NSInteger activeDecodes = self->_scheduledDecodes - self->_pendingDecodes.count;
-    while (activeDecodes == 0 ||
-           (self->_activeBytes <= self->_maxConcurrentDecodingBytes &&
-            activeDecodes <= self->_maxConcurrentDecodingTasks)) {
-      dispatch_block_t decodeBlock = self->_pendingDecodes.firstObject;
-      if (decodeBlock) {
-        [self->_pendingDecodes removeObjectAtIndex:0];
-        decodeBlock();
+    // Start queued decodes, those of visible images first
+    while (true) {
+      NSInteger activeDecodes = self->_scheduledDecodes - self->_pendingDecodes.count;
+      if (activeDecodes != 0 &&
+          (self->_activeBytes > self->_maxConcurrentDecodingBytes ||
+           activeDecodes > self->_maxConcurrentDecodingTasks)) {
+        break;
+      }
+      RCTPendingImageDecode *pendingDecode = [self nextPendingDecode];
+      if (pendingDecode) {
+        [self->_pendingDecodes removeObjectIdenticalTo:pendingDecode];
+        pendingDecode.decodeBlock();
       } else {
         break;
       }
     }
 
-    // Start queued tasks
-    for (RCTNetworkTask *task in self->_pendingTasks) {
-      if (MAX(self->_activeTasks, self->_scheduledDecodes) >= self->_maxConcurrentLoadingTasks) {
-        break;
-      }
-      if (task.status == RCTNetworkTaskPending) {
-        [task start];
-        self->_activeTasks++;
+    // Start queued tasks, those of visible images first
+    for (RCTImageLoaderPriority priority : {RCTImageLoaderPriorityImmediate, RCTImageLoaderPriorityPrefetch}) {
+      for (RCTNetworkTask *task in self->_pendingTasks) {
+        if (MAX(self->_activeTasks, self->_scheduledDecodes) >= self->_maxConcurrentLoadingTasks) {
+          break;
+        }
+        RCTImageLoadPriority *loadPriority = [self->_pendingTaskPriorities objectForKey:task];
+        if (task.status == RCTNetworkTaskPending &&
+            (loadPriority ? loadPriority.priority : RCTImageLoaderPriorityImmediate) == priority) {
+          [task start];
+          self->_activeTasks++;
+        }
       }
     }
   });
 }
 
+// Must be called on _URLRequestQueue.
+- (RCTPendingImageDecode *)nextPendingDecode
+{
+  for (RCTPendingImageDecode *pendingDecode in _pendingDecodes) {
+    if (!pendingDecode.loadPriority || pendingDecode.loadPriority.priority == RCTImageLoaderPriorityImmediate) {
+      return pendingDecode;
+    }
+  }
+  return _pendingDecodes.firstObject;
+}
+
 /**
  * This returns either an image, or raw image data, depending on the loading
  * path taken. This is useful if you want to skip decoding, e.g. when preloading
@@ -469,7 +536,7 @@ static UIImage *RCTResizeImageIfNeeded(UIImage *image, CGSize size, CGFloat scal
                                                         size:(CGSize)size
                                                        scale:(CGFloat)scale
                                                   resizeMode:(RCTResizeMode)resizeMode
-                                                    priority:(RCTImageLoaderPriority)priority
+                                                loadPriority:(RCTImageLoadPriority *)loadPriority
                                                  attribution:(const ImageURLLoaderAttribution &)attribution
                                                progressBlock:(RCTImageLoaderProgressBlock)progressHandler
                                             partialLoadBlock:(RCTImageLoaderPartialLoadBlock)partialLoadHandler
@@ -523,6 +590,10 @@ static UIImage *RCTResizeImageIfNeeded(UIImage *image, CGSize size, CGFloat scal
   __block dispatch_block_t cancelLoad = nil;
   __block NSLock *cancelLoadLock = [NSLock new];
   NSString *requestId = [NSString stringWithFormat:@"%@-%llu", [[NSUUID UUID] UUIDString], getNextImageRequestCount()];
+  RCTImageLoaderPriority priority = loadPriority.priority;
+  @synchronized(_requestPriorities) {
+    [_requestPriorities setObject:loadPriority forKey:requestId];
+  }
 
   void (^completionHandler)(NSError *, id, id, NSURLResponse *) =
       ^(NSError *error, id imageOrData, id imageMetadata, NSURLResponse *response) {
@@ -637,6 +708,7 @@ static UIImage *RCTResizeImageIfNeeded(UIImage *image, CGSize size, CGFloat scal
         // Use networking module to load image
         dispatch_block_t cancelLoadLocal =
             [strongSelf _loadURLRequest:request
+                           loadPriority:loadPriority
                           progressBlock:progressHandler
                         completionBlock:^(NSError *error, id imageOrData, NSURLResponse *response) {
                           completionHandler(error, imageOrData, nil, response);
@@ -666,6 +738,7 @@ static UIImage *RCTResizeImageIfNeeded(UIImage *image, CGSize size, CGFloat scal
 }
 
 - (RCTImageLoaderCancellationBlock)_loadURLRequest:(NSURLRequest *)request
+                                      loadPriority:(RCTImageLoadPriority *)loadPriority
                                      progressBlock:(RCTImageLoaderProgressBlock)progressHandler
                                    completionBlock:(void (^)(NSError *error, id imageOrData, NSURLResponse *response))
                                                        completionHandler
@@ -757,8 +830,10 @@ static UIImage *RCTResizeImageIfNeeded(UIImage *image, CGSize size, CGFloat scal
   if (task) {
     if (!_pendingTasks) {
       _pendingTasks = [NSMutableArray new];
+      _pendingTaskPriorities = [NSMapTable weakToStrongObjectsMapTable];
     }
     [_pendingTasks addObject:task];
+    [_pendingTaskPriorities setObject:loadPriority forKey:task];
     [self dequeueTasks];
   }
 
@@ -791,6 +866,7 @@ static UIImage *RCTResizeImageIfNeeded(UIImage *image, CGSize size, CGFloat scal
   auto cancelled = std::make_shared<std::atomic<int>>(0);
   __block dispatch_block_t cancelLoad = nil;
   __block NSLock *cancelLoadLock = [NSLock new];
+  RCTImageLoadPriority *loadPriority = [[RCTImageLoadPriority alloc] initWithPriority:priority];
   dispatch_block_t cancellationBlock = ^{
     BOOL alreadyCancelled = atomic_fetch_or(cancelled.get(), 1) ? YES : NO;
     if (alreadyCancelled) {
@@ -836,12 +912,13 @@ static UIImage *RCTResizeImageIfNeeded(UIImage *image, CGSize size, CGFloat scal
           [cancelLoadLock unlock];
           completionBlock(error_, image, nil);
         };
-        dispatch_block_t cancelLoadLocal = [strongSelf decodeImageData:imageOrData
-                                                                  size:size
-                                                                 scale:scale
-                                                               clipped:clipped
-                                                            resizeMode:resizeMode
-                                                       completionBlock:decodeCompletionHandler];
+        dispatch_block_t cancelLoadLocal = [strongSelf _decodeImageData:imageOrData
+                                                                   size:size
+                                                                  scale:scale
+                                                                clipped:clipped
+                                                             resizeMode:resizeMode
+                                                           loadPriority:loadPriority
+                                                        completionBlock:decodeCompletionHandler];
         [cancelLoadLock lock];
         cancelLoad = cancelLoadLocal;
         [cancelLoadLock unlock];
@@ -851,7 +928,7 @@ static UIImage *RCTResizeImageIfNeeded(UIImage *image, CGSize size, CGFloat scal
                                                                             size:size
                                                                            scale:scale
                                                                       resizeMode:resizeMode
-                                                                        priority:priority
+                                                                    loadPriority:loadPriority
                                                                      attribution:attribution
                                                                    progressBlock:progressBlock
                                                                 partialLoadBlock:partialLoadBlock
@@ -871,6 +948,27 @@ static UIImage *RCTResizeImageIfNeeded(UIImage *image, CGSize size, CGFloat scal
   return NO;
 }
 
+- (void)setPriority:(RCTImageLoaderPriority)priority forRequest:(RCTImageURLLoaderRequest *)loaderRequest
+{
+  if (!loaderRequest.requestId) {
+    return;
+  }
+
+  RCTImageLoadPriority *loadPriority;
+  @synchronized(_requestPriorities) {
+    loadPriority = [_requestPriorities objectForKey:loaderRequest.requestId];
+  }
+  if (!loadPriority || loadPriority.priority == priority) {
+    return;
+  }
+
+  loadPriority.priority = priority;
+  if (priority == RCTImageLoaderPriorityImmediate && _URLRequestQueue) {
+    // Lets queued work of the request start ahead of offscreen images.
+    [self dequeueTasks];
+  }
+}
+
 - (void)trackURLImageVisibilityForRequest:(RCTImageURLLoaderRequest *)loaderRequest imageView:(UIView *)imageView
 {
   if (!loaderRequest || !imageView) {
@@ -916,6 +1014,23 @@ static UIImage *RCTResizeImageIfNeeded(UIImage *image, CGSize size, CGFloat scal
                                            clipped:(BOOL)clipped
                                         resizeMode:(RCTResizeMode)resizeMode
                                    completionBlock:(RCTImageLoaderCompletionBlock)completionBlock
+{
+  return [self _decodeImageData:data
+                           size:size
+                          scale:scale
+                        clipped:clipped
+                     resizeMode:resizeMode
+                   loadPriority:nil
+                completionBlock:completionBlock];
+}
+
+- (RCTImageLoaderCancellationBlock)_decodeImageData:(NSData *)data
+                                               size:(CGSize)size
+                                              scale:(CGFloat)scale
+                                            clipped:(BOOL)clipped
+                                         resizeMode:(RCTResizeMode)resizeMode
+                                       loadPriority:(RCTImageLoadPriority *)loadPriority
+                                    completionBlock:(RCTImageLoaderCompletionBlock)completionBlock
 {
   if (data.length == 0) {
     completionBlock(RCTErrorWithMessage(@"No image data"), nil);
@@ -949,6 +1064,12 @@ static UIImage *RCTResizeImageIfNeeded(UIImage *image, CGSize size, CGFloat scal
           };
   } else {
     dispatch_block_t decodeBlock = ^{
+      if (std::atomic_load(cancelled.get())) {
+        // Don't take a decode slot from the requests that are still needed.
+        self->_scheduledDecodes--;
+        return;
+      }
+
       // Calculate the size, in bytes, that the decompressed image will require
       NSInteger decodedImageBytes = (NSInteger)((size.width * scale) * (size.height * scale) * 4);
 
@@ -1011,7 +1132,8 @@ static UIImage *RCTResizeImageIfNeeded(UIImage *image, CGSize size, CGFloat scal
            activeDecodes <= self->_maxConcurrentDecodingTasks)) {
         decodeBlock();
       } else {
-        [self->_pendingDecodes addObject:decodeBlock];
+        [self->_pendingDecodes addObject:[[RCTPendingImageDecode alloc] initWithDecodeBlock:decodeBlock
+                                                                              loadPriority:loadPriority]];
       }
     });
 
@@ -1063,11 +1185,12 @@ static UIImage *RCTResizeImageIfNeeded(UIImage *image, CGSize size, CGFloat scal
         callback(error, size);
       };
 
+  RCTImageLoadPriority *loadPriority = [[RCTImageLoadPriority alloc] initWithPriority:RCTImageLoaderPriorityImmediate];
   RCTImageURLLoaderRequest *loaderRequest = [self _loadImageOrDataWithURLRequest:imageURLRequest
                                                                             size:CGSizeZero
                                                                            scale:1
                                                                       resizeMode:RCTResizeModeStretch
-                                                                        priority:RCTImageLoaderPriorityImmediate
+                                                                    loadPriority:loadPriority
                                                                      attribution:{}
                                                                    progressBlock:NULL
                                                                 partialLoadBlock:NULL
@@ -48,4 +48,13 @@ RCT_EXTERN void RCTEnableImageLoadingPerfInstrumentation(BOOL enabled);
  */
 - (void)trackURLImageDidDestroy:(RCTImageURLLoaderRequest *)loaderRequest;
 
+@optional
+
+/**
+ * Changes the priority of a request that hasn't completed yet, e.g. when the native image view enters or leaves the
+ * viewport. Pending downloads and decodes of requests with `RCTImageLoaderPriorityImmediate` start before those of
+ * requests with `RCTImageLoaderPriorityPrefetch`.
+ */
+- (void)setPriority:(RCTImageLoaderPriority)priority forRequest:(RCTImageURLLoaderRequest *)loaderRequest;
+
 @end
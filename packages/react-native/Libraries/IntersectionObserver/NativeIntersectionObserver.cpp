@@ -9,6 +9,7 @@
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/uimanager/UIManagerBinding.h>
 #include <react/renderer/uimanager/primitives.h>
+#include <react/utils/CoreFeatures.h>
 
 #include "Plugins.h"
 
@@ -21,6 +22,9 @@ NativeIntersectionObserverModuleProvider(
 
 namespace facebook::react {
 
+// Observing at 10Hz is enough for impression tracking.
+static constexpr double kBackgroundObservationIntervalMs = 100;
+
 NativeIntersectionObserver::NativeIntersectionObserver(
     std::shared_ptr<CallInvoker> jsInvoker)
     : NativeIntersectionObserverCxxSpec(std::move(jsInvoker)) {}
@@ -50,6 +54,10 @@ void NativeIntersectionObserver::connect(
     jsi::Runtime& runtime,
     AsyncCallback<> notifyIntersectionObserversCallback) {
   auto& uiManager = getUIManagerFromRuntime(runtime);
+  if (CoreFeatures::enableBackgroundIntersectionObservation) {
+    intersectionObserverManager_.setBackgroundObservationInterval(
+        kBackgroundObservationIntervalMs);
+  }
   intersectionObserverManager_.connect(
       uiManager, notifyIntersectionObserversCallback);
 }
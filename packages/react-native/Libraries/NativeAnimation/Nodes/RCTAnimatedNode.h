@@ -22,10 +22,18 @@
 
 @property (nonatomic, readonly) BOOL needsUpdate;
 
+/**
+ * Position of the node in the topological order of the graph, in which nodes
+ * come after all of their parents. Maintained by the nodes manager.
+ */
+@property (nonatomic, assign) NSUInteger updateOrder;
+
 - (BOOL)isManagedByFabric;
 
 /**
- * Marks a node and its children as needing update.
+ * Marks a node and its children as needing update, and reports the node to
+ * the manager. Children of a node needing update always need update as well,
+ * so marking stops at nodes which already need update.
  */
 - (void)setNeedsUpdate NS_REQUIRES_SUPER;
 
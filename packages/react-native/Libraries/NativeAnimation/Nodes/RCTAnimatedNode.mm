@@ -8,6 +8,7 @@
 #import <React/RCTAnimatedNode.h>
 
 #import <React/RCTDefines.h>
+#import <React/RCTNativeAnimatedNodesManager.h>
 
 @implementation RCTAnimatedNode {
   NSMapTable<NSNumber *, RCTAnimatedNode *> *_childNodes;
@@ -89,7 +90,11 @@ RCT_NOT_IMPLEMENTED(-(instancetype)init)
 
 - (void)setNeedsUpdate
 {
+  if (_needsUpdate) {
+    return;
+  }
   _needsUpdate = YES;
+  [_manager animatedNodeNeedsUpdate:self];
   for (RCTAnimatedNode *child in _childNodes.objectEnumerator) {
     [child setNeedsUpdate];
   }
@@ -11,6 +11,7 @@
 #import <React/RCTSurfacePresenterStub.h>
 #import <React/RCTUIManager.h>
 
+@class RCTAnimatedNode;
 @protocol RCTValueAnimatedNodeObserver;
 
 NS_ASSUME_NONNULL_BEGIN
@@ -22,6 +23,12 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)updateAnimations;
 
+/**
+ * Called by nodes when they become marked as needing update, so that
+ * `updateAnimations` only visits those.
+ */
+- (void)animatedNodeNeedsUpdate:(RCTAnimatedNode *)node;
+
 - (void)stepAnimations:(CADisplayLink *)displaylink;
 
 - (BOOL)isNodeManagedByFabric:(NSNumber *)tag;
@@ -54,6 +54,10 @@ static NSString *RCTNormalizeAnimatedEventName(NSString *eventName)
   NSMutableDictionary<NSString *, NSMutableArray<RCTEventAnimation *> *> *_eventDrivers;
   NSMutableSet<id<RCTAnimationDriver>> *_activeAnimations;
   CADisplayLink *_displayLink;
+  // Nodes marked as needing update since the last update.
+  NSMutableArray<RCTAnimatedNode *> *_nodesNeedingUpdate;
+  // Whether `updateOrder` of nodes is stale, after the graph changed.
+  BOOL _updateOrderNeedsUpdate;
 }
 
 - (instancetype)initWithBridge:(nullable RCTBridge *)bridge
@@ -65,6 +69,7 @@ static NSString *RCTNormalizeAnimatedEventName(NSString *eventName)
     _animationNodes = [NSMutableDictionary new];
     _eventDrivers = [NSMutableDictionary new];
     _activeAnimations = [NSMutableSet new];
+    _nodesNeedingUpdate = [NSMutableArray new];
   }
   return self;
 }
@@ -114,6 +119,7 @@ static NSString *RCTNormalizeAnimatedEventName(NSString *eventName)
   RCTAnimatedNode *node = [[nodeClass alloc] initWithTag:tag config:config];
   node.manager = self;
   _animationNodes[tag] = node;
+  _updateOrderNeedsUpdate = YES;
   [node setNeedsUpdate];
 }
 
@@ -129,6 +135,7 @@ static NSString *RCTNormalizeAnimatedEventName(NSString *eventName)
   RCTAssertParam(childNode);
 
   [parentNode addChild:childNode];
+  _updateOrderNeedsUpdate = YES;
   [childNode setNeedsUpdate];
 }
 
@@ -144,6 +151,7 @@ static NSString *RCTNormalizeAnimatedEventName(NSString *eventName)
   RCTAssertParam(childNode);
 
   [parentNode removeChild:childNode];
+  _updateOrderNeedsUpdate = YES;
   [childNode setNeedsUpdate];
 }
 
@@ -190,6 +198,7 @@ static NSString *RCTNormalizeAnimatedEventName(NSString *eventName)
   if (node) {
     [node detachNode];
     [_animationNodes removeObjectForKey:tag];
+    _updateOrderNeedsUpdate = YES;
   }
 }
 
@@ -472,13 +481,72 @@ static NSString *RCTNormalizeAnimatedEventName(NSString *eventName)
 
 #pragma mark-- Updates
 
+- (void)animatedNodeNeedsUpdate:(RCTAnimatedNode *)node
+{
+  [_nodesNeedingUpdate addObject:node];
+}
+
 - (void)updateAnimations
 {
-  [_animationNodes enumerateKeysAndObjectsUsingBlock:^(NSNumber *key, RCTAnimatedNode *node, BOOL *stop) {
-    if (node.needsUpdate) {
-      [node updateNodeIfNecessary];
+  if (_nodesNeedingUpdate.count == 0) {
+    return;
+  }
+
+  [self updateNodesOrderIfNeeded];
+
+  // Nodes marked during this update are updated by the next one.
+  NSMutableArray<RCTAnimatedNode *> *nodes = _nodesNeedingUpdate;
+  _nodesNeedingUpdate = [NSMutableArray new];
+  [nodes sortUsingComparator:^NSComparisonResult(RCTAnimatedNode *node1, RCTAnimatedNode *node2) {
+    if (node1.updateOrder == node2.updateOrder) {
+      return NSOrderedSame;
     }
+    return node1.updateOrder < node2.updateOrder ? NSOrderedAscending : NSOrderedDescending;
   }];
+
+  // Parents come first, so each node is updated after its inputs, once.
+  for (RCTAnimatedNode *node in nodes) {
+    if (node.needsUpdate && _animationNodes[node.nodeTag] == node) {
+      [node updateNodeIfNecessary];
+    }
+  }
+}
+
+- (void)updateNodesOrderIfNeeded
+{
+  if (!_updateOrderNeedsUpdate) {
+    return;
+  }
+  _updateOrderNeedsUpdate = NO;
+
+  // Kahn's algorithm: a node is ordered once all of its parents are.
+  NSMapTable<RCTAnimatedNode *, NSNumber *> *pendingParents = [NSMapTable strongToStrongObjectsMapTable];
+  NSMutableArray<RCTAnimatedNode *> *queue = [NSMutableArray new];
+  for (RCTAnimatedNode *node in _animationNodes.objectEnumerator) {
+    // Map tables may count parents which were already deallocated.
+    NSUInteger parentCount = node.parentNodes.objectEnumerator.allObjects.count;
+    node.updateOrder = NSUIntegerMax;
+    if (parentCount == 0) {
+      [queue addObject:node];
+    } else {
+      [pendingParents setObject:@(parentCount) forKey:node];
+    }
+  }
+
+  NSUInteger order = 0;
+  for (NSUInteger index = 0; index < queue.count; index++) {
+    RCTAnimatedNode *node = queue[index];
+    node.updateOrder = order++;
+    for (RCTAnimatedNode *child in node.childNodes.objectEnumerator) {
+      NSUInteger parentCount = [pendingParents objectForKey:child].unsignedIntegerValue;
+      if (parentCount == 1) {
+        [pendingParents removeObjectForKey:child];
+        [queue addObject:child];
+      } else if (parentCount > 1) {
+        [pendingParents setObject:@(parentCount - 1) forKey:child];
+      }
+    }
+  }
 }
 
 @end
@@ -239,7 +239,12 @@ class XMLHttpRequest extends (EventTarget(...XHR_EVENTS): any) {
         break;
 
       case 'arraybuffer':
-        this._cachedResponse = base64.toByteArray(this._response).buffer;
+        if (typeof this._response === 'object' && this._response) {
+          // Received as a blob, whose native storage the buffer takes over.
+          this._cachedResponse = BlobManager.takeArrayBuffer(this._response);
+        } else {
+          this._cachedResponse = base64.toByteArray(this._response).buffer;
+        }
         break;
 
       case 'blob':
@@ -556,7 +561,9 @@ class XMLHttpRequest extends (EventTarget(...XHR_EVENTS): any) {
 
     let nativeResponseType: NativeResponseType = 'text';
     if (this._responseType === 'arraybuffer') {
-      nativeResponseType = 'base64';
+      nativeResponseType = BlobManager.canTransferArrayBuffers()
+        ? 'blob'
+        : 'base64';
     }
     if (this._responseType === 'blob') {
       nativeResponseType = 'blob';
@@ -11,6 +11,7 @@
 'use strict';
 
 const Blob = require('../Blob/Blob');
+const BlobManager = require('../Blob/BlobManager');
 const binaryToBase64 = require('../Utilities/binaryToBase64');
 const FormData = require('./FormData');
 
@@ -33,6 +34,9 @@ function convertRequestBody(body: RequestBody): Object {
     return {formData: body.getParts()};
   }
   if (body instanceof ArrayBuffer || ArrayBuffer.isView(body)) {
+    if (BlobManager.canTransferArrayBuffers()) {
+      return {blob: BlobManager.storeArrayBuffer(body)};
+    }
     /* $FlowFixMe[incompatible-call] : no way to assert that 'body' is indeed
      * an ArrayBufferView */
     return {base64: binaryToBase64(body)};
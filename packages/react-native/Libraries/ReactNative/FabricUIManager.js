@@ -24,6 +24,77 @@ import defineLazyObjectProperty from '../Utilities/defineLazyObjectProperty';
 
 export type NodeSet = Array<Node>;
 export type NodeProps = {...};
+
+/**
+ * Distribution of a per-transaction metric over recent transactions of a
+ * surface.
+ */
+export type TelemetryHistogram = $ReadOnly<{
+  numberOfSamples: number,
+  p50: number,
+  p90: number,
+  p99: number,
+}>;
+
+/**
+ * Lookups of a cache over the mounted transactions of a surface.
+ */
+export type TelemetryCacheCounters = $ReadOnly<{
+  hits: number,
+  misses: number,
+  hitRate: number,
+}>;
+
+/**
+ * Telemetry aggregated over the mounted transactions of a surface. Durations
+ * are in microseconds.
+ */
+export type SurfaceTelemetry = $ReadOnly<{
+  numberOfTransactions: number,
+  numberOfMutations: number,
+  numberOfTextMeasurements: number,
+  lastRevisionNumber: number,
+  numberOfCommits: number,
+  numberOfCancelledCommits: number,
+  numberOfRetriedCommits: number,
+  mutations: $ReadOnly<{
+    create: number,
+    delete: number,
+    insert: number,
+    remove: number,
+    update: number,
+    removeDeleteTree: number,
+  }>,
+  textMeasureCache: TelemetryCacheCounters,
+  layoutCache: TelemetryCacheCounters,
+  // Only reported by platforms which recycle views.
+  numberOfCreatedViews: number,
+  numberOfRecycledViews: number,
+  numberOfShadowNodes: number,
+  // Approximate; props (other than the ones of views) and state aren't
+  // accounted for.
+  shadowNodesRetainedBytes: number,
+  layoutTimeUs: TelemetryHistogram,
+  textMeasureTimeUs: TelemetryHistogram,
+  commitTimeUs: TelemetryHistogram,
+  diffTimeUs: TelemetryHistogram,
+  mountTimeUs: TelemetryHistogram,
+  affectedLayoutNodesCount: TelemetryHistogram,
+  numberOfTextMeasurementsPerTransaction: TelemetryHistogram,
+}>;
+
+/**
+ * Opcodes of the instruction stream of `unstable_createNodes`, which is a flat
+ * array of opcodes, each followed by its operands:
+ * - `CreateNode`: reactTag, viewName, props, instanceHandle.
+ * - `AppendChild`: index of the parent among the created nodes, and the child
+ *   (an index among the created nodes or an existing node).
+ */
+export const CreateNodesInstruction = {
+  CreateNode: 0,
+  AppendChild: 1,
+};
+
 export interface Spec {
   +createNode: (
     reactTag: number,
@@ -32,6 +103,10 @@ export interface Spec {
     props: NodeProps,
     instanceHandle: InternalInstanceHandle,
   ) => Node;
+  +unstable_createNodes: (
+    rootTag: RootTag,
+    instructions: $ReadOnlyArray<mixed>,
+  ) => $ReadOnlyArray<Node>;
   +cloneNode: (node: Node) => Node;
   +cloneNodeWithNewChildren: (node: Node) => Node;
   +cloneNodeWithNewProps: (node: Node, newProps: NodeProps) => Node;
@@ -58,6 +133,7 @@ export interface Spec {
   ) => void;
   +sendAccessibilityEvent: (node: Node, eventType: string) => void;
   +findShadowNodeByTag_DEPRECATED: (reactTag: number) => ?Node;
+  +unstable_getSurfaceTelemetry: (rootTag: RootTag) => ?SurfaceTelemetry;
   +setNativeProps: (node: Node, newProps: NodeProps) => void;
   +dispatchCommand: (
     node: Node,
@@ -127,6 +203,7 @@ let nativeFabricUIManagerProxy: ?Spec;
 // creates a new host function every time methods are accessed.
 const CACHED_PROPERTIES = [
   'createNode',
+  'unstable_createNodes',
   'cloneNode',
   'cloneNodeWithNewChildren',
   'cloneNodeWithNewProps',
@@ -141,6 +218,7 @@ const CACHED_PROPERTIES = [
   'configureNextLayoutAnimation',
   'sendAccessibilityEvent',
   'findShadowNodeByTag_DEPRECATED',
+  'unstable_getSurfaceTelemetry',
   'setNativeProps',
   'dispatchCommand',
   'getParentNode',
@@ -22,8 +22,10 @@ import type {
   NodeProps,
   NodeSet,
   Spec as FabricUIManager,
+  SurfaceTelemetry,
 } from '../FabricUIManager';
 
+import {CreateNodesInstruction} from '../FabricUIManager';
 import {createRootTag} from '../RootTag.js';
 
 export type NodeMock = {
@@ -203,6 +205,47 @@ const FabricUIManagerMock: IFabricUIManagerMock = {
     },
   ),
 
+  unstable_createNodes: jest.fn(
+    (
+      rootTag: RootTag,
+      instructions: $ReadOnlyArray<mixed>,
+    ): $ReadOnlyArray<Node> => {
+      // $FlowFixMe[unclear-type] Operands of different instructions differ.
+      const operands: $ReadOnlyArray<any> = instructions;
+      const nodes: Array<Node> = [];
+      let position = 0;
+      while (position < operands.length) {
+        const opcode = operands[position++];
+        if (opcode === CreateNodesInstruction.CreateNode) {
+          const [reactTag, viewName, props, instanceHandle] = operands.slice(
+            position,
+            position + 4,
+          );
+          position += 4;
+          nodes.push(
+            FabricUIManagerMock.createNode(
+              reactTag,
+              viewName,
+              rootTag,
+              props,
+              instanceHandle,
+            ),
+          );
+        } else if (opcode === CreateNodesInstruction.AppendChild) {
+          const [parentIndex, child] = operands.slice(position, position + 2);
+          position += 2;
+          FabricUIManagerMock.appendChild(
+            nodes[parentIndex],
+            typeof child === 'number' ? nodes[child] : child,
+          );
+        } else {
+          throw new Error(`Unknown opcode ${String(opcode)}`);
+        }
+      }
+      return nodes;
+    },
+  ),
+
   cloneNode: jest.fn((node: Node): Node => {
     return toNode({...fromNode(node)});
   }),
@@ -295,6 +338,10 @@ const FabricUIManagerMock: IFabricUIManagerMock = {
 
   findShadowNodeByTag_DEPRECATED: jest.fn((reactTag: number): ?Node => {}),
 
+  unstable_getSurfaceTelemetry: jest.fn(
+    (rootTag: RootTag): ?SurfaceTelemetry => null,
+  ),
+
   findNodeAtPoint: jest.fn(
     (
       node: Node,
@@ -60,3 +60,24 @@ RCT_EXTERN void RCTSetMemoryPressureUnloadLevel(int value);
  */
 RCT_EXTERN BOOL RCTGetUseNativeViewConfigsInBridgelessMode(void);
 RCT_EXTERN void RCTSetUseNativeViewConfigsInBridgelessMode(BOOL value);
+
+/*
+ * Register native modules of the bridge by name only, and create them on first
+ * use from JS
+ */
+RCT_EXTERN BOOL RCTGetLazyNativeModuleRegistration(void);
+RCT_EXTERN void RCTSetLazyNativeModuleRegistration(BOOL value);
+
+/*
+ * Create the native modules of the bridge which don't require main queue setup
+ * and compute their constants on background threads while the bundle loads
+ */
+RCT_EXTERN BOOL RCTGetPrepareNativeModuleConfigsInBackground(void);
+RCT_EXTERN void RCTSetPrepareNativeModuleConfigsInBackground(BOOL value);
+
+/*
+ * Deliver the calls of the bridge into JS made while the JS thread is busy as
+ * a single batch
+ */
+RCT_EXTERN BOOL RCTGetBatchedBridgeFunctionCalls(void);
+RCT_EXTERN void RCTSetBatchedBridgeFunctionCalls(BOOL value);
@@ -66,3 +66,48 @@ void RCTSetUseNativeViewConfigsInBridgelessMode(BOOL value)
 {
   RCTUseNativeViewConfigsInBridgelessMode = value;
 }
+
+/*
+ * Register native modules of the bridge by name only
+ */
+static BOOL RCTLazyNativeModuleRegistration = NO;
+
+BOOL RCTGetLazyNativeModuleRegistration(void)
+{
+  return RCTLazyNativeModuleRegistration;
+}
+
+void RCTSetLazyNativeModuleRegistration(BOOL value)
+{
+  RCTLazyNativeModuleRegistration = value;
+}
+
+/*
+ * Prepare configs of native modules of the bridge on background threads
+ */
+static BOOL RCTPrepareNativeModuleConfigsInBackground = NO;
+
+BOOL RCTGetPrepareNativeModuleConfigsInBackground(void)
+{
+  return RCTPrepareNativeModuleConfigsInBackground;
+}
+
+void RCTSetPrepareNativeModuleConfigsInBackground(BOOL value)
+{
+  RCTPrepareNativeModuleConfigsInBackground = value;
+}
+
+/*
+ * Batch the calls of the bridge into JS
+ */
+static BOOL RCTBatchedBridgeFunctionCalls = NO;
+
+BOOL RCTGetBatchedBridgeFunctionCalls(void)
+{
+  return RCTBatchedBridgeFunctionCalls;
+}
+
+void RCTSetBatchedBridgeFunctionCalls(BOOL value)
+{
+  RCTBatchedBridgeFunctionCalls = value;
+}
@@ -169,7 +169,8 @@ RCT_NOT_IMPLEMENTED(-(instancetype)init)
 
     case facebook::react::ScriptTag::String: {
 #if RCT_ENABLE_INSPECTOR
-      NSData *source = [NSData dataWithContentsOfFile:scriptURL.path options:NSDataReadingMappedIfSafe error:error];
+      // Mapped, so the bundle is never copied to the heap (see NSDataBigString).
+      NSData *source = [NSData dataWithContentsOfFile:scriptURL.path options:NSDataReadingMappedAlways error:error];
       if (sourceLength && source != nil) {
         *sourceLength = source.length;
       }
@@ -220,7 +221,8 @@ static void attemptAsynchronousLoadOfBundleAtURL(
     // Reading in a large bundle can be slow. Dispatch to the background queue to do it.
     dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
       NSError *error = nil;
-      NSData *source = [NSData dataWithContentsOfFile:scriptURL.path options:NSDataReadingMappedIfSafe error:&error];
+      // Mapped, so the bundle is never copied to the heap (see NSDataBigString).
+      NSData *source = [NSData dataWithContentsOfFile:scriptURL.path options:NSDataReadingMappedAlways error:&error];
       onComplete(error, RCTSourceCreate(scriptURL, source, source.length));
     });
     return;
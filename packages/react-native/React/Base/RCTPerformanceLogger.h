@@ -72,4 +72,10 @@
  */
 - (int64_t)valueForTag:(RCTPLTag)tag;
 
+/**
+ * Returns every ReactMarker recorded so far, across all bridges and
+ * bridgeless hosts, as a Chrome trace (JSON) that can be opened in Perfetto.
+ */
++ (NSString *)startupTrace;
+
 @end
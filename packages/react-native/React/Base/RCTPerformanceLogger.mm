@@ -132,4 +132,10 @@ static const std::unordered_map<RCTPLTag, ReactMarker::ReactMarkerId> &getStopTa
   return _data[tag][1];
 }
 
++ (NSString *)startupTrace
+{
+  auto trace = ReactMarker::MarkerTimeline::getInstance().getTrace();
+  return [NSString stringWithUTF8String:trace.c_str()];
+}
+
 @end
@@ -11,30 +11,14 @@
 
 namespace facebook::react {
 
-class NSDataBigString : public JSBigString {
+// Borrows the bytes of the NSData (e.g. a memory-mapped bundle) without
+// copying them. The bytes don't need to be null-terminated.
+class NSDataBigString : public JSBigExternalString {
  public:
-  // The NSData passed in must be be null-terminated.
   NSDataBigString(NSData *data);
 
-  // The ASCII optimization is not enabled on iOS
-  bool isAscii() const override
-  {
-    return false;
-  }
-
-  const char *c_str() const override
-  {
-    return (const char *)[m_data bytes];
-  }
-
-  size_t size() const override
-  {
-    return m_length;
-  }
-
  private:
   NSData *m_data;
-  size_t m_length;
 };
 
 } // namespace facebook::react
@@ -36,6 +36,7 @@
 #import <cxxreact/JSBundleType.h>
 #import <cxxreact/JSIndexedRAMBundle.h>
 #import <cxxreact/ModuleRegistry.h>
+#import <cxxreact/NativeToJsBridge.h>
 #import <cxxreact/RAMBundleRegistry.h>
 #import <cxxreact/ReactMarker.h>
 #import <jsinspector-modern/ReactCdp.h>
@@ -648,8 +649,26 @@ struct RCTInstanceCallback : public InstanceCallback {
         [strongSelf.delegate bridge:strongSelf didNotFindModule:@(name.c_str())];
   };
 
-  auto registry = std::make_shared<ModuleRegistry>(
-      createNativeModules(_moduleDataByID, self, _reactInstance), moduleNotFoundCallback);
+  std::shared_ptr<ModuleRegistry> registry;
+  if (RCTGetLazyNativeModuleRegistration()) {
+    registry = std::make_shared<ModuleRegistry>(std::vector<std::unique_ptr<NativeModule>>{}, moduleNotFoundCallback);
+    registry->registerLazyModules(createLazyNativeModules(_moduleDataByID, self, _reactInstance));
+  } else {
+    registry = std::make_shared<ModuleRegistry>(
+        createNativeModules(_moduleDataByID, self, _reactInstance), moduleNotFoundCallback);
+  }
+
+  if (RCTGetPrepareNativeModuleConfigsInBackground()) {
+    // Modules which don't require main queue setup can be created and export
+    // their constants on any thread.
+    std::vector<std::string> moduleNames;
+    for (RCTModuleData *moduleData in _moduleDataByID) {
+      if (moduleData.hasConstantsToExport && !moduleData.requiresMainQueueSetup) {
+        moduleNames.push_back(moduleData.name.UTF8String);
+      }
+    }
+    registry->prepareConfigs(std::move(moduleNames));
+  }
 
   [_performanceLogger markStopForTag:RCTPLNativeModulePrepareConfig];
   RCT_PROFILE_END_EVENT(RCTProfileTagAlways, @"");
@@ -695,6 +714,8 @@ struct RCTInstanceCallback : public InstanceCallback {
 {
   std::lock_guard<std::mutex> guard(_moduleRegistryLock);
 
+  NativeToJsBridge::setShouldBatchFunctionCalls(RCTGetBatchedBridgeFunctionCalls());
+
   // This is async, but any calls into JS are blocked by the m_syncReady CV in Instance
   _reactInstance->initializeBridge(
       std::make_unique<RCTInstanceCallback>(self),
@@ -972,7 +993,12 @@ struct RCTInstanceCallback : public InstanceCallback {
                                                    lazilyDiscovered:YES];
     assert(_reactInstance); // at this point you must have reactInstance as you already called
                             // reactInstance->initializeBridge
-    _reactInstance->getModuleRegistry().registerModules(createNativeModules(newModules, self, _reactInstance));
+    if (RCTGetLazyNativeModuleRegistration()) {
+      _reactInstance->getModuleRegistry().registerLazyModules(
+          createLazyNativeModules(newModules, self, _reactInstance));
+    } else {
+      _reactInstance->getModuleRegistry().registerModules(createNativeModules(newModules, self, _reactInstance));
+    }
   } else {
     [self registerModulesForClasses:modules];
   }
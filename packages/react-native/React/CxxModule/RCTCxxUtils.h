@@ -7,6 +7,9 @@
 
 #include <functional>
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #import <Foundation/Foundation.h>
 
@@ -21,6 +24,13 @@ class NativeModule;
 std::vector<std::unique_ptr<NativeModule>>
 createNativeModules(NSArray<RCTModuleData *> *modules, RCTBridge *bridge, const std::shared_ptr<Instance> &instance);
 
+/**
+ * Like createNativeModules, but returns the module names with factories that create the NativeModules, for
+ * ModuleRegistry::registerLazyModules.
+ */
+std::vector<std::pair<std::string, std::function<std::unique_ptr<NativeModule>()>>>
+createLazyNativeModules(NSArray<RCTModuleData *> *modules, RCTBridge *bridge, const std::shared_ptr<Instance> &instance);
+
 NSError *tryAndReturnError(const std::function<void()> &func);
 NSString *deriveSourceURL(NSURL *url);
 
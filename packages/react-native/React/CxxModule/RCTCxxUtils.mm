@@ -21,24 +21,44 @@ namespace facebook::react {
 
 using facebook::jsi::JSError;
 
+static std::unique_ptr<NativeModule>
+createNativeModule(RCTModuleData *moduleData, RCTBridge *bridge, const std::weak_ptr<Instance> &instance)
+{
+  if ([moduleData.moduleClass isSubclassOfClass:[RCTCxxModule class]]) {
+    return std::make_unique<CxxNativeModule>(
+        instance,
+        [moduleData.name UTF8String],
+        [moduleData] { return [(RCTCxxModule *)(moduleData.instance) createModule]; },
+        std::make_shared<DispatchMessageQueueThread>(moduleData));
+  }
+  return std::make_unique<RCTNativeModule>(bridge, moduleData);
+}
+
 std::vector<std::unique_ptr<NativeModule>>
 createNativeModules(NSArray<RCTModuleData *> *modules, RCTBridge *bridge, const std::shared_ptr<Instance> &instance)
 {
   std::vector<std::unique_ptr<NativeModule>> nativeModules;
   for (RCTModuleData *moduleData in modules) {
-    if ([moduleData.moduleClass isSubclassOfClass:[RCTCxxModule class]]) {
-      nativeModules.emplace_back(std::make_unique<CxxNativeModule>(
-          instance,
-          [moduleData.name UTF8String],
-          [moduleData] { return [(RCTCxxModule *)(moduleData.instance) createModule]; },
-          std::make_shared<DispatchMessageQueueThread>(moduleData)));
-    } else {
-      nativeModules.emplace_back(std::make_unique<RCTNativeModule>(bridge, moduleData));
-    }
+    nativeModules.emplace_back(createNativeModule(moduleData, bridge, instance));
   }
   return nativeModules;
 }
 
+std::vector<std::pair<std::string, std::function<std::unique_ptr<NativeModule>()>>>
+createLazyNativeModules(NSArray<RCTModuleData *> *modules, RCTBridge *bridge, const std::shared_ptr<Instance> &instance)
+{
+  std::vector<std::pair<std::string, std::function<std::unique_ptr<NativeModule>()>>> lazyModules;
+  // The registry which owns the factories is owned by the bridge and instance.
+  __weak RCTBridge *weakBridge = bridge;
+  std::weak_ptr<Instance> weakInstance = instance;
+  for (RCTModuleData *moduleData in modules) {
+    lazyModules.emplace_back([moduleData.name UTF8String], [moduleData, weakBridge, weakInstance] {
+      return createNativeModule(moduleData, weakBridge, weakInstance);
+    });
+  }
+  return lazyModules;
+}
+
 static NSError *errorWithException(const std::exception &e)
 {
   NSString *msg = @(e.what());
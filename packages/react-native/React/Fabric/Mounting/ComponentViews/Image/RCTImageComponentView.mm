@@ -97,6 +97,12 @@ using namespace facebook::react;
 
 - (void)_setStateAndResubscribeImageResponseObserver:(const ImageShadowNode::ConcreteState::Shared &)state
 {
+  if (_state && state && &_state->getData().getImageRequest() == &state->getData().getImageRequest()) {
+    // The new state shares the request (e.g. only the blur radius changed), which is still observed.
+    _state = state;
+    return;
+  }
+
   if (_state) {
     const auto &imageRequest = _state->getData().getImageRequest();
     auto &observerCoordinator = imageRequest.getObserverCoordinator();
@@ -118,6 +124,17 @@ using namespace facebook::react;
   }
 }
 
+- (void)didMoveToWindow
+{
+  [super didMoveToWindow];
+
+  if (_state) {
+    // Lets the images that are on screen load and decode ahead of those that moved off screen.
+    _state->getData().getImageRequest().setPriority(
+        self.window ? ImageRequestPriority::Visible : ImageRequestPriority::Offscreen);
+  }
+}
+
 - (void)prepareForRecycle
 {
   [super prepareForRecycle];
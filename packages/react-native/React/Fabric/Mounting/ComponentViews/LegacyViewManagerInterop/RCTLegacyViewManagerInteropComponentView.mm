@@ -26,6 +26,7 @@ static NSString *const kRCTLegacyInteropChildIndexKey = @"index";
   NSMutableArray<UIView *> *_viewsToBeUnmounted;
   RCTLegacyViewManagerInteropCoordinatorAdapter *_adapter;
   LegacyViewManagerInteropShadowNode::ConcreteState::Shared _state;
+  std::shared_ptr<const LegacyViewManagerInteropViewProps> _appliedProps;
   BOOL _hasInvokedForwardingWarning;
 }
 
@@ -161,6 +162,7 @@ static NSString *const kRCTLegacyInteropChildIndexKey = @"index";
 - (void)prepareForRecycle
 {
   _adapter = nil;
+  _appliedProps.reset();
   [_viewsToBeMounted removeAllObjects];
   [_viewsToBeUnmounted removeAllObjects];
   _state.reset();
@@ -258,8 +260,14 @@ static NSString *const kRCTLegacyInteropChildIndexKey = @"index";
 - (void)_setPropsWithUpdateMask:(RNComponentViewUpdateMask)updateMask
 {
   if (updateMask & RNComponentViewUpdateMaskProps) {
-    const auto &newProps = static_cast<const LegacyViewManagerInteropViewProps &>(*_props);
-    [_adapter setProps:newProps.otherProps];
+    auto newProps = std::static_pointer_cast<const LegacyViewManagerInteropViewProps>(_props);
+    if (_appliedProps) {
+      // Only the props which changed since they were last set are converted and forwarded.
+      [_adapter updateProps:newProps->getChangedOtherProps(*_appliedProps)];
+    } else {
+      [_adapter setProps:newProps->getOtherProps()];
+    }
+    _appliedProps = newProps;
   }
 }
 
@@ -20,6 +20,12 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)setProps:(const folly::dynamic &)props;
 
+/**
+ * Forwards props known to differ from the ones previously set to the view manager, without
+ * diffing them. Must not be mixed with `setProps:`, which diffs props against the ones it set.
+ */
+- (void)updateProps:(const folly::dynamic &)changedProps;
+
 - (void)handleCommand:(NSString *)commandName args:(NSArray *)args;
 
 @end
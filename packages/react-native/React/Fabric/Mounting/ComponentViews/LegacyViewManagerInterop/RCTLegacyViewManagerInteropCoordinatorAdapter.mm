@@ -59,6 +59,15 @@
   }
 }
 
+- (void)updateProps:(const folly::dynamic &)changedProps
+{
+  if (changedProps.isObject() && !changedProps.empty()) {
+    NSDictionary<NSString *, id> *convertedProps = facebook::react::convertFollyDynamicToId(changedProps);
+
+    [_coordinator setProps:convertedProps forView:self.paperView];
+  }
+}
+
 - (void)handleCommand:(NSString *)commandName args:(NSArray *)args
 {
   [_coordinator handleCommand:commandName args:args reactTag:_tag paperView:self.paperView];
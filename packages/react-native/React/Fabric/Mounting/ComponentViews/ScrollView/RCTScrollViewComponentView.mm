@@ -92,6 +92,7 @@ static void RCTSendScrollEventForNativeAnimations_DEPRECATED(UIScrollView *scrol
   CGSize _contentSize;
   NSTimeInterval _lastScrollEventDispatchTime;
   NSTimeInterval _scrollEventThrottle;
+  NSTimeInterval _lastStateUpdateTime;
   // Flag indicating whether the scrolling that is currently happening
   // is triggered by user or not.
   // This helps to only update state from `scrollViewDidScroll` in case
@@ -410,6 +411,7 @@ static void RCTSendScrollEventForNativeAnimations_DEPRECATED(UIScrollView *scrol
   if (!_state) {
     return;
   }
+  _lastStateUpdateTime = CACurrentMediaTime();
   auto contentOffset = RCTPointFromCGPoint(_scrollView.contentOffset);
   _state->updateState([contentOffset](const ScrollViewShadowNode::ConcreteState::Data &data) {
     auto newData = data;
@@ -463,11 +465,21 @@ static void RCTSendScrollEventForNativeAnimations_DEPRECATED(UIScrollView *scrol
 
 - (void)scrollViewDidScroll:(UIScrollView *)scrollView
 {
-  if (!_isUserTriggeredScrolling || CoreFeatures::enableGranularScrollViewStateUpdatesIOS) {
+  // Natively windowed content is mounted based on the content offset in the state, so it must be
+  // kept up to date while the user scrolls too.
+  const auto &props = static_cast<const ScrollViewProps &>(*_props);
+  NSTimeInterval now = CACurrentMediaTime();
+  if (!_isUserTriggeredScrolling || CoreFeatures::enableGranularScrollViewStateUpdatesIOS ||
+      props.experimental_nativeWindowing) {
     [self _updateStateWithContentOffset];
+  } else if (CoreFeatures::enableThrottledScrollViewStateUpdates && _state) {
+    // Otherwise, the content offset is only sent once scrolling ends, unless something reads it in between.
+    auto interval = ScrollViewShadowNode::getStateUpdateIntervalWhileScrolling(_state->getData());
+    if (interval.has_value() && (now - _lastStateUpdateTime) * 1000 >= interval.value()) {
+      [self _updateStateWithContentOffset];
+    }
   }
 
-  NSTimeInterval now = CACurrentMediaTime();
   if ((_lastScrollEventDispatchTime == 0) || (now - _lastScrollEventDispatchTime > _scrollEventThrottle)) {
     _lastScrollEventDispatchTime = now;
     if (_eventEmitter) {
@@ -121,15 +121,16 @@ using namespace facebook::react;
     return;
   }
 
-  auto textLayoutManager = _state->getData().paragraphLayoutManager.getTextLayoutManager();
-  auto nsTextStorage = _state->getData().paragraphLayoutManager.getHostTextStorage();
+  const auto &data = _state->getData();
+  auto textLayoutManager = data.paragraphLayoutManager.getTextLayoutManager();
+  auto nsTextStorage = data.paragraphLayoutManager.getHostTextStorage(data.attributedString, _paragraphAttributes);
 
   RCTTextLayoutManager *nativeTextLayoutManager =
       (RCTTextLayoutManager *)unwrapManagedObject(textLayoutManager->getNativeTextLayoutManager());
 
   CGRect frame = RCTCGRectFromRect(_layoutMetrics.getContentFrame());
 
-  [nativeTextLayoutManager drawAttributedString:_state->getData().attributedString
+  [nativeTextLayoutManager drawAttributedString:data.attributedString
                             paragraphAttributes:_paragraphAttributes
                                           frame:frame
                                     textStorage:unwrapManagedObject(nsTextStorage)];
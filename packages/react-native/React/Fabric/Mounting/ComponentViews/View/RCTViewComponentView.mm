@@ -312,19 +312,19 @@ using namespace facebook::react;
   }
 
   // `accessibilityLabel`
-  if (oldViewProps.accessibilityLabel != newViewProps.accessibilityLabel) {
-    self.accessibilityElement.accessibilityLabel = RCTNSStringFromStringNilIfEmpty(newViewProps.accessibilityLabel);
+  if (oldViewProps.getAccessibilityLabel() != newViewProps.getAccessibilityLabel()) {
+    self.accessibilityElement.accessibilityLabel = RCTNSStringFromStringNilIfEmpty(newViewProps.getAccessibilityLabel());
   }
 
   // `accessibilityLanguage`
-  if (oldViewProps.accessibilityLanguage != newViewProps.accessibilityLanguage) {
+  if (oldViewProps.getAccessibilityLanguage() != newViewProps.getAccessibilityLanguage()) {
     self.accessibilityElement.accessibilityLanguage =
-        RCTNSStringFromStringNilIfEmpty(newViewProps.accessibilityLanguage);
+        RCTNSStringFromStringNilIfEmpty(newViewProps.getAccessibilityLanguage());
   }
 
   // `accessibilityHint`
-  if (oldViewProps.accessibilityHint != newViewProps.accessibilityHint) {
-    self.accessibilityElement.accessibilityHint = RCTNSStringFromStringNilIfEmpty(newViewProps.accessibilityHint);
+  if (oldViewProps.getAccessibilityHint() != newViewProps.getAccessibilityHint()) {
+    self.accessibilityElement.accessibilityHint = RCTNSStringFromStringNilIfEmpty(newViewProps.getAccessibilityHint());
   }
 
   // `accessibilityViewIsModal`
@@ -344,9 +344,9 @@ using namespace facebook::react;
   }
 
   // `accessibilityState`
-  if (oldViewProps.accessibilityState != newViewProps.accessibilityState) {
+  if (oldViewProps.getAccessibilityState() != newViewProps.getAccessibilityState()) {
     self.accessibilityTraits &= ~(UIAccessibilityTraitNotEnabled | UIAccessibilityTraitSelected);
-    const auto accessibilityState = newViewProps.accessibilityState.value_or(AccessibilityState{});
+    const auto accessibilityState = newViewProps.getAccessibilityState().value_or(AccessibilityState{});
     if (accessibilityState.selected) {
       self.accessibilityTraits |= UIAccessibilityTraitSelected;
     }
@@ -361,15 +361,15 @@ using namespace facebook::react;
   }
 
   // `accessibilityValue`
-  if (oldViewProps.accessibilityValue != newViewProps.accessibilityValue) {
-    if (newViewProps.accessibilityValue.text.has_value()) {
-      self.accessibilityElement.accessibilityValue =
-          RCTNSStringFromStringNilIfEmpty(newViewProps.accessibilityValue.text.value());
+  if (oldViewProps.getAccessibilityValue() != newViewProps.getAccessibilityValue()) {
+    const auto &accessibilityValue = newViewProps.getAccessibilityValue();
+    if (accessibilityValue.text.has_value()) {
+      self.accessibilityElement.accessibilityValue = RCTNSStringFromStringNilIfEmpty(accessibilityValue.text.value());
     } else if (
-        newViewProps.accessibilityValue.now.has_value() && newViewProps.accessibilityValue.min.has_value() &&
-        newViewProps.accessibilityValue.max.has_value()) {
-      CGFloat val = (CGFloat)(newViewProps.accessibilityValue.now.value()) /
-          (newViewProps.accessibilityValue.max.value() - newViewProps.accessibilityValue.min.value());
+        accessibilityValue.now.has_value() && accessibilityValue.min.has_value() &&
+        accessibilityValue.max.has_value()) {
+      CGFloat val = (CGFloat)(accessibilityValue.now.value()) /
+          (accessibilityValue.max.value() - accessibilityValue.min.value());
       self.accessibilityElement.accessibilityValue =
           [NSNumberFormatter localizedStringFromNumber:@(val) numberStyle:NSNumberFormatterPercentStyle];
       ;
@@ -734,7 +734,7 @@ static NSString *RCTRecursiveAccessibilityLabel(UIView *view)
 - (NSString *)accessibilityValue
 {
   const auto &props = static_cast<const ViewProps &>(*_props);
-  const auto accessibilityState = props.accessibilityState.value_or(AccessibilityState{});
+  const auto accessibilityState = props.getAccessibilityState().value_or(AccessibilityState{});
 
   // Handle Switch.
   if ((self.accessibilityTraits & AccessibilityTraitSwitch) == AccessibilityTraitSwitch) {
@@ -811,7 +811,7 @@ static NSString *RCTRecursiveAccessibilityLabel(UIView *view)
 
 - (NSArray<UIAccessibilityCustomAction *> *)accessibilityCustomActions
 {
-  const auto &accessibilityActions = _props->accessibilityActions;
+  const auto &accessibilityActions = _props->getAccessibilityActions();
 
   if (accessibilityActions.empty()) {
     return nil;
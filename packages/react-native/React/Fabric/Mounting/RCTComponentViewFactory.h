@@ -54,6 +54,12 @@ void RCTInstallNativeComponentRegistryBinding(facebook::jsi::Runtime &runtime);
  */
 - (BOOL)registerComponentIfPossible:(const std::string &)componentName;
 
+/**
+ * Returns the handle of the component view class registered (see `registerComponentIfPossible:`) for given component
+ * name, or `0` if there is no matching class.
+ */
+- (facebook::react::ComponentHandle)componentHandleWithComponentName:(const std::string &)componentName;
+
 /**
  * Creates a component view with given component handle.
  */
@@ -62,6 +62,7 @@ static Class<RCTComponentViewProtocol> RCTComponentViewClassWithName(const char
 @implementation RCTComponentViewFactory {
   std::unordered_map<ComponentHandle, RCTComponentViewClassDescriptor> _componentViewClasses;
   std::unordered_set<std::string> _registeredComponentsNames;
+  std::unordered_map<std::string, ComponentHandle> _componentHandlesByName;
   ComponentDescriptorProviderRegistry _providerRegistry;
   std::shared_mutex _mutex;
 }
@@ -193,9 +194,25 @@ static Class<RCTComponentViewProtocol> RCTComponentViewClassWithName(const char
 - (void)_addDescriptorToProviderRegistry:(const ComponentDescriptorProvider &)provider
 {
   _registeredComponentsNames.insert(provider.name);
+  _componentHandlesByName[provider.name] = provider.handle;
   _providerRegistry.add(provider);
 }
 
+- (ComponentHandle)componentHandleWithComponentName:(const std::string &)componentName
+{
+  if (![self registerComponentIfPossible:componentName]) {
+    return 0;
+  }
+
+  std::shared_lock lock(_mutex);
+  auto iterator = _componentHandlesByName.find(componentName);
+  if (iterator == _componentHandlesByName.end() ||
+      _componentViewClasses.find(iterator->second) == _componentViewClasses.end()) {
+    return 0;
+  }
+  return iterator->second;
+}
+
 - (RCTComponentViewDescriptor)createComponentViewWithComponentHandle:(facebook::react::ComponentHandle)componentHandle
 {
   RCTAssertMainQueue();
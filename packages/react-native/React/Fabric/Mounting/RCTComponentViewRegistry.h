@@ -39,6 +39,28 @@ NS_ASSUME_NONNULL_BEGIN
                                             tag:(facebook::react::Tag)tag
                         componentViewDescriptor:(RCTComponentViewDescriptor)componentViewDescriptor;
 
+/**
+ * Schedules the creation of native view instances for given `componentHandle` while the main run loop is idle, until
+ * the recycle pool holds `count` of them. The recycle pool keeps (at least) that many instances from then on.
+ * Views are created in small batches right before the main run loop goes to sleep, so this doesn't delay mounting.
+ */
+- (void)prewarmComponentViewsWithComponentHandle:(facebook::react::ComponentHandle)componentHandle
+                                           count:(NSUInteger)count;
+
+/**
+ * Returns the statistics of the recycle pools, keyed by component name, for telemetry.
+ * Every entry holds the number of dequeued views taken from the pool (`hits`) or created on demand (`misses`), the
+ * number of views in the pool (`size`), and the number of views the pool keeps at most (`limit`).
+ */
+- (NSDictionary<NSString *, NSDictionary<NSString *, NSNumber *> *> *)recyclePoolStatistics;
+
+/**
+ * Total numbers of dequeued views, of all components, which were taken from the recycle pools or created on demand.
+ * Cheap to read, so these can be compared before and after mounting a transaction.
+ */
+@property (nonatomic, assign, readonly) NSUInteger numberOfRecycledComponentViews;
+@property (nonatomic, assign, readonly) NSUInteger numberOfCreatedComponentViews;
+
 /**
  * Returns a component view descriptor by given `tag`.
  */
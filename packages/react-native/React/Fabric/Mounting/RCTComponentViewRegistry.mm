@@ -14,16 +14,47 @@
 #import <React/RCTImageComponentView.h>
 #import <React/RCTParagraphComponentView.h>
 #import <React/RCTViewComponentView.h>
+#import <algorithm>
 #import <unordered_map>
 
 using namespace facebook;
 using namespace facebook::react;
 
 const NSInteger RCTComponentViewRegistryRecyclePoolMaxSize = 1024;
+const NSInteger RCTComponentViewRegistryRecyclePoolMinSize = 16;
+const NSInteger RCTComponentViewRegistryPrewarmBatchSize = 8;
+
+namespace {
+
+struct RCTComponentViewRecyclePool {
+  std::vector<RCTComponentViewDescriptor> views;
+
+  // Number of views of the component which are mounted, and its maximum so far.
+  // A pool never needs to hold more views than can be mounted at once again.
+  size_t mountedCount{0};
+  size_t peakMountedCount{0};
+
+  // Number of views requested by `prewarmComponentViewsWithComponentHandle:count:`.
+  size_t prewarmCount{0};
+
+  size_t hitCount{0};
+  size_t missCount{0};
+
+  size_t limit() const
+  {
+    auto demand = std::max(peakMountedCount, prewarmCount);
+    return std::min(
+        (size_t)RCTComponentViewRegistryRecyclePoolMaxSize,
+        std::max((size_t)RCTComponentViewRegistryRecyclePoolMinSize, demand));
+  }
+};
+
+} // namespace
 
 @implementation RCTComponentViewRegistry {
   std::unordered_map<Tag, RCTComponentViewDescriptor> _registry;
-  std::unordered_map<ComponentHandle, std::vector<RCTComponentViewDescriptor>> _recyclePool;
+  std::unordered_map<ComponentHandle, RCTComponentViewRecyclePool> _recyclePools;
+  CFRunLoopObserverRef _prewarmingObserver;
 }
 
 - (instancetype)init
@@ -40,6 +71,11 @@ const NSInteger RCTComponentViewRegistryRecyclePoolMaxSize = 1024;
   return self;
 }
 
+- (void)dealloc
+{
+  [self _stopPrewarming];
+}
+
 - (const RCTComponentViewDescriptor &)dequeueComponentViewWithComponentHandle:(ComponentHandle)componentHandle
                                                                           tag:(Tag)tag
 {
@@ -69,6 +105,35 @@ const NSInteger RCTComponentViewRegistryRecyclePoolMaxSize = 1024;
   [self _enqueueComponentViewWithComponentHandle:componentHandle componentViewDescriptor:componentViewDescriptor];
 }
 
+- (void)prewarmComponentViewsWithComponentHandle:(ComponentHandle)componentHandle count:(NSUInteger)count
+{
+  RCTAssertMainQueue();
+  auto &recyclePool = _recyclePools[componentHandle];
+  recyclePool.prewarmCount = std::max(recyclePool.prewarmCount, (size_t)count);
+
+  if (recyclePool.views.size() < recyclePool.limit() && recyclePool.views.size() < recyclePool.prewarmCount) {
+    [self _startPrewarming];
+  }
+}
+
+- (NSDictionary<NSString *, NSDictionary<NSString *, NSNumber *> *> *)recyclePoolStatistics
+{
+  RCTAssertMainQueue();
+  NSMutableDictionary<NSString *, NSDictionary<NSString *, NSNumber *> *> *statistics =
+      [NSMutableDictionary dictionaryWithCapacity:_recyclePools.size()];
+  for (const auto &[componentHandle, recyclePool] : _recyclePools) {
+    // The handle of a component is the address of its name.
+    NSString *componentName = [NSString stringWithUTF8String:(const char *)componentHandle];
+    statistics[componentName] = @{
+      @"hits" : @(recyclePool.hitCount),
+      @"misses" : @(recyclePool.missCount),
+      @"size" : @(recyclePool.views.size()),
+      @"limit" : @(recyclePool.limit()),
+    };
+  }
+  return statistics;
+}
+
 - (const RCTComponentViewDescriptor &)componentViewDescriptorWithTag:(Tag)tag
 {
   RCTAssertMainQueue();
@@ -90,14 +155,20 @@ const NSInteger RCTComponentViewRegistryRecyclePoolMaxSize = 1024;
 - (RCTComponentViewDescriptor)_dequeueComponentViewWithComponentHandle:(ComponentHandle)componentHandle
 {
   RCTAssertMainQueue();
-  auto &recycledViews = _recyclePool[componentHandle];
+  auto &recyclePool = _recyclePools[componentHandle];
+  recyclePool.mountedCount++;
+  recyclePool.peakMountedCount = std::max(recyclePool.peakMountedCount, recyclePool.mountedCount);
 
-  if (recycledViews.empty()) {
+  if (recyclePool.views.empty()) {
+    recyclePool.missCount++;
+    _numberOfCreatedComponentViews++;
     return [self.componentViewFactory createComponentViewWithComponentHandle:componentHandle];
   }
 
-  auto componentViewDescriptor = recycledViews.back();
-  recycledViews.pop_back();
+  recyclePool.hitCount++;
+  _numberOfRecycledComponentViews++;
+  auto componentViewDescriptor = recyclePool.views.back();
+  recyclePool.views.pop_back();
   return componentViewDescriptor;
 }
 
@@ -105,9 +176,12 @@ const NSInteger RCTComponentViewRegistryRecyclePoolMaxSize = 1024;
                          componentViewDescriptor:(RCTComponentViewDescriptor)componentViewDescriptor
 {
   RCTAssertMainQueue();
-  auto &recycledViews = _recyclePool[componentHandle];
+  auto &recyclePool = _recyclePools[componentHandle];
+  if (recyclePool.mountedCount > 0) {
+    recyclePool.mountedCount--;
+  }
 
-  if (recycledViews.size() > RCTComponentViewRegistryRecyclePoolMaxSize || !componentViewDescriptor.shouldBeRecycled) {
+  if (recyclePool.views.size() >= recyclePool.limit() || !componentViewDescriptor.shouldBeRecycled) {
     return;
   }
 
@@ -115,12 +189,83 @@ const NSInteger RCTComponentViewRegistryRecyclePoolMaxSize = 1024;
       componentViewDescriptor.view.superview == nil, @"RCTComponentViewRegistry: Attempt to recycle a mounted view.");
   [componentViewDescriptor.view prepareForRecycle];
 
-  recycledViews.push_back(componentViewDescriptor);
+  recyclePool.views.push_back(componentViewDescriptor);
+}
+
+#pragma mark - Prewarming
+
+- (void)_startPrewarming
+{
+  if (_prewarmingObserver) {
+    return;
+  }
+
+  __weak RCTComponentViewRegistry *weakSelf = self;
+  _prewarmingObserver = CFRunLoopObserverCreateWithHandler(
+      NULL /* allocator */,
+      kCFRunLoopBeforeWaiting /* activities */,
+      true /* repeats */,
+      0 /* order */,
+      ^(CFRunLoopObserverRef observer, CFRunLoopActivity activity) {
+        [weakSelf _prewarmComponentViews];
+      });
+
+  // Only the default mode, so views aren't created while e.g. a scroll view is tracking.
+  CFRunLoopAddObserver(CFRunLoopGetMain(), _prewarmingObserver, kCFRunLoopDefaultMode);
+  CFRunLoopWakeUp(CFRunLoopGetMain());
+}
+
+- (void)_stopPrewarming
+{
+  if (!_prewarmingObserver) {
+    return;
+  }
+
+  CFRunLoopRemoveObserver(CFRunLoopGetMain(), _prewarmingObserver, kCFRunLoopDefaultMode);
+  CFRelease(_prewarmingObserver);
+  _prewarmingObserver = nil;
+}
+
+/*
+ * Called right before the main run loop goes to sleep. Creates a batch of views for pools which were requested to
+ * hold more views than they do, and wakes the run loop up again to continue with the next batch if needed.
+ */
+- (void)_prewarmComponentViews
+{
+  RCTAssertMainQueue();
+  NSInteger remainingCount = RCTComponentViewRegistryPrewarmBatchSize;
+
+  for (auto &[componentHandle, recyclePool] : _recyclePools) {
+    auto targetSize = std::min(recyclePool.prewarmCount, recyclePool.limit());
+    while (remainingCount > 0 && recyclePool.views.size() < targetSize) {
+      auto componentViewDescriptor = [self.componentViewFactory createComponentViewWithComponentHandle:componentHandle];
+      remainingCount--;
+
+      if (!componentViewDescriptor.shouldBeRecycled) {
+        recyclePool.prewarmCount = 0;
+        break;
+      }
+      recyclePool.views.push_back(componentViewDescriptor);
+    }
+  }
+
+  if (remainingCount > 0) {
+    // All the pools are filled.
+    [self _stopPrewarming];
+  } else {
+    CFRunLoopWakeUp(CFRunLoopGetMain());
+  }
 }
 
 - (void)handleApplicationDidReceiveMemoryWarningNotification
 {
-  _recyclePool.clear();
+  [self _stopPrewarming];
+
+  for (auto &[componentHandle, recyclePool] : _recyclePools) {
+    recyclePool.views.clear();
+    recyclePool.peakMountedCount = recyclePool.mountedCount;
+    recyclePool.prewarmCount = 0;
+  }
 }
 
 @end
@@ -66,6 +66,12 @@ NS_ASSUME_NONNULL_BEGIN
     blockNativeResponder:(BOOL)blockNativeResponder
            forShadowView:(const facebook::react::ShadowView &)shadowView;
 
+/**
+ * Creates `count` views of given component for recycling while the main thread is idle.
+ * Can be called from any thread.
+ */
+- (void)prewarmComponentViewsWithComponentName:(const std::string &)componentName count:(size_t)count;
+
 - (void)synchronouslyUpdateViewOnUIThread:(ReactTag)reactTag
                              changedProps:(NSDictionary *)props
                       componentDescriptor:(const facebook::react::ComponentDescriptor &)componentDescriptor;
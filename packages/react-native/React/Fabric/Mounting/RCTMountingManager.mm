@@ -27,8 +27,14 @@
 #import <React/RCTConversions.h>
 #import <React/RCTMountingTransactionObserverCoordinator.h>
 
+#import <unordered_map>
+#import <vector>
+
 using namespace facebook::react;
 
+// Time a frame may spend mounting chunks of a progressively mounted transaction.
+static const CFTimeInterval RCTProgressiveMountingFrameBudget = 0.008;
+
 static SurfaceId RCTSurfaceIdForView(UIView *view)
 {
   do {
@@ -148,6 +154,172 @@ static void RCTPerformMountInstructions(
   }
 }
 
+/*
+ * Same as `RCTPerformMountInstructions`, but with fewer calls into the component views:
+ * - Structural mutations are performed in order (as indices depend on it), and the updates of a view are applied once
+ *   after them, coalescing all `Update` mutations of the view in the transaction.
+ * - `finalizeUpdates:` is called once per view, after all views were updated.
+ * - Everything happens in a single `CATransaction` with implicit animations disabled.
+ */
+static void RCTPerformBatchedMountInstructions(
+    const ShadowViewMutationList &mutations,
+    RCTComponentViewRegistry *registry,
+    RCTMountingTransactionObserverCoordinator &observerCoordinator,
+    SurfaceId surfaceId)
+{
+  SystraceSection s("RCTPerformBatchedMountInstructions");
+
+  struct PendingUpdate {
+    const ShadowView *oldShadowView;
+    const ShadowView *newShadowView;
+  };
+
+  // Keyed by tag, and kept in the order the views were first touched.
+  auto pendingUpdates = std::unordered_map<Tag, PendingUpdate>{};
+  auto pendingUpdateTags = std::vector<Tag>{};
+  auto pendingMasks = std::unordered_map<Tag, RNComponentViewUpdateMask>{};
+  auto pendingMaskTags = std::vector<Tag>{};
+
+  auto addPendingMask = [&](Tag tag, RNComponentViewUpdateMask mask) {
+    auto [iterator, inserted] = pendingMasks.emplace(tag, mask);
+    if (inserted) {
+      pendingMaskTags.push_back(tag);
+    } else {
+      iterator->second |= mask;
+    }
+  };
+
+  [CATransaction begin];
+  [CATransaction setDisableActions:YES];
+
+  for (const auto &mutation : mutations) {
+    switch (mutation.type) {
+      case ShadowViewMutation::Create: {
+        auto &newChildShadowView = mutation.newChildShadowView;
+        auto &newChildViewDescriptor =
+            [registry dequeueComponentViewWithComponentHandle:newChildShadowView.componentHandle
+                                                          tag:newChildShadowView.tag];
+        observerCoordinator.registerViewComponentDescriptor(newChildViewDescriptor, surfaceId);
+        break;
+      }
+
+      case ShadowViewMutation::Delete: {
+        auto &oldChildShadowView = mutation.oldChildShadowView;
+        auto &oldChildViewDescriptor = [registry componentViewDescriptorWithTag:oldChildShadowView.tag];
+
+        // The view gets recycled, so pending updates are moot.
+        pendingUpdates.erase(oldChildShadowView.tag);
+        pendingMasks.erase(oldChildShadowView.tag);
+
+        observerCoordinator.unregisterViewComponentDescriptor(oldChildViewDescriptor, surfaceId);
+
+        [registry enqueueComponentViewWithComponentHandle:oldChildShadowView.componentHandle
+                                                      tag:oldChildShadowView.tag
+                                  componentViewDescriptor:oldChildViewDescriptor];
+        break;
+      }
+
+      case ShadowViewMutation::Insert: {
+        auto &newChildShadowView = mutation.newChildShadowView;
+        auto &parentShadowView = mutation.parentShadowView;
+        auto &newChildViewDescriptor = [registry componentViewDescriptorWithTag:newChildShadowView.tag];
+        auto &parentViewDescriptor = [registry componentViewDescriptorWithTag:parentShadowView.tag];
+
+        UIView<RCTComponentViewProtocol> *newChildComponentView = newChildViewDescriptor.view;
+
+        RCTAssert(newChildShadowView.props, @"`newChildShadowView.props` must not be null.");
+
+        [newChildComponentView updateProps:newChildShadowView.props oldProps:nullptr];
+        [newChildComponentView updateEventEmitter:newChildShadowView.eventEmitter];
+        [newChildComponentView updateState:newChildShadowView.state oldState:nullptr];
+        [newChildComponentView updateLayoutMetrics:newChildShadowView.layoutMetrics
+                                  oldLayoutMetrics:EmptyLayoutMetrics];
+        addPendingMask(newChildShadowView.tag, RNComponentViewUpdateMaskAll);
+
+        [parentViewDescriptor.view mountChildComponentView:newChildComponentView index:mutation.index];
+        break;
+      }
+
+      case ShadowViewMutation::Remove: {
+        auto &oldChildShadowView = mutation.oldChildShadowView;
+        auto &parentShadowView = mutation.parentShadowView;
+        auto &oldChildViewDescriptor = [registry componentViewDescriptorWithTag:oldChildShadowView.tag];
+        auto &parentViewDescriptor = [registry componentViewDescriptorWithTag:parentShadowView.tag];
+        [parentViewDescriptor.view unmountChildComponentView:oldChildViewDescriptor.view index:mutation.index];
+        break;
+      }
+
+      case ShadowViewMutation::RemoveDeleteTree: {
+        // TODO - not supported yet
+        break;
+      }
+
+      case ShadowViewMutation::Update: {
+        auto tag = mutation.newChildShadowView.tag;
+        auto [iterator, inserted] =
+            pendingUpdates.emplace(tag, PendingUpdate{&mutation.oldChildShadowView, &mutation.newChildShadowView});
+        if (inserted) {
+          pendingUpdateTags.push_back(tag);
+        } else {
+          iterator->second.newShadowView = &mutation.newChildShadowView;
+        }
+        break;
+      }
+    }
+  }
+
+  for (auto tag : pendingUpdateTags) {
+    auto iterator = pendingUpdates.find(tag);
+    if (iterator == pendingUpdates.end()) {
+      continue;
+    }
+
+    auto &oldChildShadowView = *iterator->second.oldShadowView;
+    auto &newChildShadowView = *iterator->second.newShadowView;
+    UIView<RCTComponentViewProtocol> *newChildComponentView = [registry componentViewDescriptorWithTag:tag].view;
+
+    auto mask = RNComponentViewUpdateMask{};
+
+    RCTAssert(newChildShadowView.props, @"`newChildShadowView.props` must not be null.");
+
+    if (oldChildShadowView.props != newChildShadowView.props) {
+      [newChildComponentView updateProps:newChildShadowView.props oldProps:oldChildShadowView.props];
+      mask |= RNComponentViewUpdateMaskProps;
+    }
+
+    if (oldChildShadowView.eventEmitter != newChildShadowView.eventEmitter) {
+      [newChildComponentView updateEventEmitter:newChildShadowView.eventEmitter];
+      mask |= RNComponentViewUpdateMaskEventEmitter;
+    }
+
+    if (oldChildShadowView.state != newChildShadowView.state) {
+      [newChildComponentView updateState:newChildShadowView.state oldState:oldChildShadowView.state];
+      mask |= RNComponentViewUpdateMaskState;
+    }
+
+    // Compared across all the coalesced updates, so frames which changed back and forth aren't written.
+    if (oldChildShadowView.layoutMetrics != newChildShadowView.layoutMetrics) {
+      [newChildComponentView updateLayoutMetrics:newChildShadowView.layoutMetrics
+                                oldLayoutMetrics:oldChildShadowView.layoutMetrics];
+      mask |= RNComponentViewUpdateMaskLayoutMetrics;
+    }
+
+    if (mask != RNComponentViewUpdateMaskNone) {
+      addPendingMask(tag, mask);
+    }
+  }
+
+  for (auto tag : pendingMaskTags) {
+    auto iterator = pendingMasks.find(tag);
+    if (iterator == pendingMasks.end()) {
+      continue;
+    }
+    [[registry componentViewDescriptorWithTag:tag].view finalizeUpdates:iterator->second];
+  }
+
+  [CATransaction commit];
+}
+
 @implementation RCTMountingManager {
   RCTMountingTransactionObserverCoordinator _observerCoordinator;
   BOOL _transactionInFlight;
@@ -200,12 +372,33 @@ static void RCTPerformMountInstructions(
     // * No need to do expensive copy of all mutations;
     // * No need to allocate a block.
     [self initiateTransaction:*mountingCoordinator];
+    [self scheduleProgressiveMountingIfNeeded:mountingCoordinator];
     return;
   }
 
   RCTExecuteOnMainQueue(^{
     RCTAssertMainQueue();
     [self initiateTransaction:*mountingCoordinator];
+    [self scheduleProgressiveMountingIfNeeded:mountingCoordinator];
+  });
+}
+
+- (void)scheduleProgressiveMountingIfNeeded:(MountingCoordinator::Shared)mountingCoordinator
+{
+  if (!CoreFeatures::enableProgressiveMounting || !mountingCoordinator->hasPendingTransactions()) {
+    return;
+  }
+
+  // Dispatching with a delay lets the run loop go to sleep, which commits the current Core Animation transaction
+  // (so the visible part of the surface gets rendered) before the remaining chunks get mounted.
+  dispatch_after(dispatch_time(DISPATCH_TIME_NOW, NSEC_PER_MSEC), dispatch_get_main_queue(), ^{
+    RCTAssertMainQueue();
+    CFTimeInterval frameStartTime = CACurrentMediaTime();
+    do {
+      [self initiateTransaction:*mountingCoordinator];
+    } while (mountingCoordinator->hasPendingTransactions() &&
+             CACurrentMediaTime() - frameStartTime < RCTProgressiveMountingFrameBudget);
+    [self scheduleProgressiveMountingIfNeeded:mountingCoordinator];
   });
 }
 
@@ -270,8 +463,18 @@ static void RCTPerformMountInstructions(
         _observerCoordinator.notifyObserversMountingTransactionWillMount(transaction, surfaceTelemetry);
       },
       [&](const MountingTransaction &transaction, const SurfaceTelemetry &surfaceTelemetry) {
-        RCTPerformMountInstructions(
-            transaction.getMutations(), _componentViewRegistry, _observerCoordinator, surfaceId);
+        auto numberOfCreatedViews = _componentViewRegistry.numberOfCreatedComponentViews;
+        auto numberOfRecycledViews = _componentViewRegistry.numberOfRecycledComponentViews;
+        if (CoreFeatures::enableBatchedMounting) {
+          RCTPerformBatchedMountInstructions(
+              transaction.getMutations(), _componentViewRegistry, _observerCoordinator, surfaceId);
+        } else {
+          RCTPerformMountInstructions(
+              transaction.getMutations(), _componentViewRegistry, _observerCoordinator, surfaceId);
+        }
+        mountingCoordinator.getTelemetryController().didMountViews(
+            (int)(_componentViewRegistry.numberOfCreatedComponentViews - numberOfCreatedViews),
+            (int)(_componentViewRegistry.numberOfRecycledComponentViews - numberOfRecycledViews));
       },
       [&](const MountingTransaction &transaction, const SurfaceTelemetry &surfaceTelemetry) {
         _observerCoordinator.notifyObserversMountingTransactionDidMount(transaction, surfaceTelemetry);
@@ -290,6 +493,19 @@ static void RCTPerformMountInstructions(
   });
 }
 
+- (void)prewarmComponentViewsWithComponentName:(const std::string &)componentName count:(size_t)count
+{
+  // A value (not a reference) to be captured by the block.
+  std::string name = componentName;
+  RCTExecuteOnMainQueue(^{
+    RCTComponentViewRegistry *componentViewRegistry = self->_componentViewRegistry;
+    ComponentHandle componentHandle = [componentViewRegistry.componentViewFactory componentHandleWithComponentName:name];
+    if (componentHandle != 0) {
+      [componentViewRegistry prewarmComponentViewsWithComponentHandle:componentHandle count:count];
+    }
+  });
+}
+
 - (void)synchronouslyUpdateViewOnUIThread:(ReactTag)reactTag
                              changedProps:(NSDictionary *)props
                       componentDescriptor:(const ComponentDescriptor &)componentDescriptor
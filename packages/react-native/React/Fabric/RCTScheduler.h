@@ -41,6 +41,8 @@ NS_ASSUME_NONNULL_BEGIN
                 blockNativeResponder:(BOOL)blockNativeResponder
                        forShadowView:(const facebook::react::ShadowView &)shadowView;
 
+- (void)schedulerDidRequestViewPrewarmingForComponentName:(const std::string &)componentName count:(size_t)count;
+
 @end
 
 /**
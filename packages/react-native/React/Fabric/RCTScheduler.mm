@@ -60,6 +60,12 @@ class SchedulerDelegateProxy : public SchedulerDelegate {
     [scheduler.delegate schedulerDidSendAccessibilityEvent:shadowView eventType:eventType];
   }
 
+  void schedulerDidRequestViewPrewarming(SurfaceId surfaceId, const std::string &componentName, size_t count) override
+  {
+    RCTScheduler *scheduler = (__bridge RCTScheduler *)scheduler_;
+    [scheduler.delegate schedulerDidRequestViewPrewarmingForComponentName:componentName count:count];
+  }
+
  private:
   void *scheduler_;
 };
@@ -163,7 +169,7 @@ class LayoutAnimationDelegateProxy : public LayoutAnimationStatusDelegate, publi
 
 - (void)setupAnimationDriver:(const facebook::react::SurfaceHandler &)surfaceHandler
 {
-  surfaceHandler.getMountingCoordinator()->setMountingOverrideDelegate(_animationDriver);
+  surfaceHandler.getMountingCoordinator()->addMountingOverrideDelegate(_animationDriver);
 }
 
 - (void)onAnimationStarted
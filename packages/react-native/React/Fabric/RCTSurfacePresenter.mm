@@ -29,14 +29,17 @@
 #import <react/config/ReactNativeConfig.h>
 #import <react/featureflags/ReactNativeFeatureFlags.h>
 #import <react/renderer/componentregistry/ComponentDescriptorFactory.h>
+#import <react/renderer/components/image/ImagePrefetchCommitHook.h>
 #import <react/renderer/components/text/BaseTextProps.h>
 #import <react/renderer/runtimescheduler/RuntimeScheduler.h>
 #import <react/renderer/scheduler/AsynchronousEventBeat.h>
 #import <react/renderer/scheduler/SchedulerToolbox.h>
 #import <react/renderer/scheduler/SynchronousEventBeat.h>
+#import <react/renderer/textlayoutmanager/PersistentTextMeasureCache.h>
 #import <react/utils/ContextContainer.h>
 #import <react/utils/CoreFeatures.h>
 #import <react/utils/ManagedObjectWrapper.h>
+#import <react/utils/MemoryPressureCoordinator.h>
 
 #import "PlatformRunLoopObserver.h"
 #import "RCTConversions.h"
@@ -56,21 +59,85 @@ static dispatch_queue_t RCTGetBackgroundQueue()
   return queue;
 }
 
+static dispatch_queue_t RCTGetConcurrentBackgroundQueue()
+{
+  static dispatch_queue_t queue;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    dispatch_queue_attr_t attr =
+        dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_CONCURRENT, QOS_CLASS_USER_INTERACTIVE, 0);
+    queue = dispatch_queue_create("com.facebook.react.background.concurrent", attr);
+  });
+  return queue;
+}
+
 static BackgroundExecutor RCTGetBackgroundExecutor()
 {
-  return [](std::function<void()> &&callback) {
+  // Completions of the same surface are serialized by `UIManager`, so a concurrent queue only lets different surfaces
+  // complete in parallel.
+  auto queue =
+      CoreFeatures::enableConcurrentSurfaceCompletion ? RCTGetConcurrentBackgroundQueue() : RCTGetBackgroundQueue();
+  return [queue](std::function<void()> &&callback) {
     if (RCTIsMainQueue()) {
       callback();
       return;
     }
 
     auto copyableCallback = callback;
-    dispatch_async(RCTGetBackgroundQueue(), ^{
+    dispatch_async(queue, ^{
       copyableCallback();
     });
   };
 }
 
+/*
+ * Reports the deadline of every frame to the RuntimeScheduler, so React yields in time for the rendering updates of
+ * the frame to be mounted.
+ */
+@interface RCTFrameDeadlineReporter : NSObject
+
+- (instancetype)initWithRuntimeScheduler:(std::weak_ptr<RuntimeScheduler>)runtimeScheduler;
+- (void)invalidate;
+
+@end
+
+@implementation RCTFrameDeadlineReporter {
+  std::weak_ptr<RuntimeScheduler> _runtimeScheduler;
+  CADisplayLink *_displayLink;
+}
+
+- (instancetype)initWithRuntimeScheduler:(std::weak_ptr<RuntimeScheduler>)runtimeScheduler
+{
+  if (self = [super init]) {
+    _runtimeScheduler = std::move(runtimeScheduler);
+    // The display link retains its target until it is invalidated.
+    _displayLink = [CADisplayLink displayLinkWithTarget:self selector:@selector(_onDisplayLink:)];
+    [_displayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+  }
+
+  return self;
+}
+
+- (void)invalidate
+{
+  [_displayLink invalidate];
+}
+
+- (void)_onDisplayLink:(CADisplayLink *)displayLink
+{
+  auto runtimeScheduler = _runtimeScheduler.lock();
+  if (!runtimeScheduler) {
+    [self invalidate];
+    return;
+  }
+
+  auto frameTimeRemaining = std::chrono::duration<CFTimeInterval>(displayLink.targetTimestamp - CACurrentMediaTime());
+  runtimeScheduler->setFrameDeadline(
+      runtimeScheduler->now() + std::chrono::duration_cast<RuntimeSchedulerDuration>(frameTimeRemaining));
+}
+
+@end
+
 @interface RCTSurfacePresenter () <RCTSchedulerDelegate, RCTMountingManagerDelegate>
 @end
 
@@ -83,6 +150,7 @@ static BackgroundExecutor RCTGetBackgroundExecutor()
   RCTScheduler *_Nullable _scheduler; // Thread-safe. Pointer is protected by `_schedulerAccessMutex`.
   ContextContainer::Shared _contextContainer; // Protected by `_schedulerLifeCycleMutex`.
   RuntimeExecutor _runtimeExecutor; // Protected by `_schedulerLifeCycleMutex`.
+  RCTFrameDeadlineReporter *_Nullable _frameDeadlineReporter; // Protected by `_schedulerLifeCycleMutex`.
   std::optional<RuntimeExecutor> _bridgelessBindingsExecutor; // Only used for installing bindings.
 
   std::shared_mutex _observerListMutex;
@@ -110,6 +178,16 @@ static BackgroundExecutor RCTGetBackgroundExecutor()
                                              selector:@selector(_applicationWillTerminate)
                                                  name:UIApplicationWillTerminateNotification
                                                object:nil];
+
+    [[NSNotificationCenter defaultCenter] addObserver:self
+                                             selector:@selector(_applicationDidReceiveMemoryWarning)
+                                                 name:UIApplicationDidReceiveMemoryWarningNotification
+                                               object:nil];
+
+    [[NSNotificationCenter defaultCenter] addObserver:self
+                                             selector:@selector(_applicationDidEnterBackground)
+                                                 name:UIApplicationDidEnterBackgroundNotification
+                                               object:nil];
   }
 
   return self;
@@ -222,6 +300,9 @@ static BackgroundExecutor RCTGetBackgroundExecutor()
     _scheduler = nil;
   }
 
+  [_frameDeadlineReporter invalidate];
+  _frameDeadlineReporter = nil;
+
   [self _stopAllSurfacesWithScheduler:scheduler];
 
   return YES;
@@ -253,6 +334,26 @@ static BackgroundExecutor RCTGetBackgroundExecutor()
 
 #pragma mark - Private
 
+- (void)_registerPersistentTextMeasureCache
+{
+  NSString *cachesDirectory =
+      NSSearchPathForDirectoriesInDomains(NSCachesDirectory, NSUserDomainMask, YES).firstObject;
+  if (!cachesDirectory) {
+    return;
+  }
+
+  NSString *path = [cachesDirectory stringByAppendingPathComponent:@"RCTTextMeasurements.bin"];
+  // The font scale is a part of the measured text attributes, but the locale and the fonts shipped with the app and
+  // the OS are not.
+  NSString *configuration = [NSString stringWithFormat:@"%@|%@|%@",
+                                                       [NSLocale currentLocale].localeIdentifier,
+                                                       [NSBundle mainBundle].infoDictionary[@"CFBundleVersion"],
+                                                       [NSProcessInfo processInfo].operatingSystemVersionString];
+  _contextContainer->insert(
+      PersistentTextMeasureCache::kContextContainerKey,
+      std::make_shared<PersistentTextMeasureCache>(path.UTF8String, configuration.UTF8String));
+}
+
 - (RCTScheduler *)_createScheduler
 {
   auto reactNativeConfig = _contextContainer->at<std::shared_ptr<const ReactNativeConfig>>("ReactNativeConfig");
@@ -265,6 +366,26 @@ static BackgroundExecutor RCTGetBackgroundExecutor()
     CoreFeatures::enableGranularScrollViewStateUpdatesIOS = true;
   }
 
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_throttled_scroll_view_state_updates")) {
+    CoreFeatures::enableThrottledScrollViewStateUpdates = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_commit_load_shedding")) {
+    CoreFeatures::enableCommitLoadShedding = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_lazy_raw_props_parser_preparation")) {
+    CoreFeatures::enableLazyRawPropsParserPreparation = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_process_wide_text_measure_cache")) {
+    CoreFeatures::enableProcessWideTextMeasureCache = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_coallocated_shadow_node_families")) {
+    CoreFeatures::enableCoallocatedShadowNodeFamilies = true;
+  }
+
   if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_mount_hooks_ios")) {
     CoreFeatures::enableMountHooks = true;
   }
@@ -273,6 +394,126 @@ static BackgroundExecutor RCTGetBackgroundExecutor()
     CoreFeatures::enableClonelessStateProgression = true;
   }
 
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_parallel_differentiator")) {
+    CoreFeatures::enableParallelDifferentiator = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_differentiator_minimal_moves")) {
+    CoreFeatures::enableDifferentiatorMinimalMoves = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_mounting_transaction_compaction")) {
+    CoreFeatures::enableMountingTransactionCompaction = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_optimistic_shadow_tree_commit")) {
+    CoreFeatures::enableOptimisticShadowTreeCommit = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_progressive_mounting")) {
+    CoreFeatures::enableProgressiveMounting = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_yoga_layout_reuse")) {
+    CoreFeatures::enableYogaLayoutReuse = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_text_measure_range_cache")) {
+    CoreFeatures::enableTextMeasureRangeCache = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_skipping_unchanged_raw_props")) {
+    CoreFeatures::enableSkippingUnchangedRawProps = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_props_interning")) {
+    CoreFeatures::enablePropsInterning = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_pooled_shadow_node_allocation")) {
+    CoreFeatures::enablePooledShadowNodeAllocation = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_runtime_scheduler_telemetry")) {
+    CoreFeatures::enableRuntimeSchedulerTelemetry = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_batched_timers")) {
+    CoreFeatures::enableBatchedTimers = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_image_request_deduplication")) {
+    CoreFeatures::enableImageRequestDeduplication = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_background_intersection_observation")) {
+    CoreFeatures::enableBackgroundIntersectionObservation = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_concurrent_surface_completion")) {
+    CoreFeatures::enableConcurrentSurfaceCompletion = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_sticky_view_unflattening")) {
+    CoreFeatures::enableStickyViewUnflattening = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_js_heap_sampling")) {
+    CoreFeatures::enableJSHeapSampling = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_skipping_unchanged_yoga_styles")) {
+    CoreFeatures::enableSkippingUnchangedYogaStyles = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_incremental_yoga_children_updates")) {
+    CoreFeatures::enableIncrementalYogaChildrenUpdates = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_yoga_layout_templates")) {
+    CoreFeatures::enableYogaLayoutTemplates = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_armed_event_beats")) {
+    CoreFeatures::enableArmedEventBeats = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_immediate_discrete_events")) {
+    CoreFeatures::enableImmediateDiscreteEvents = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_animated_props_overlay")) {
+    CoreFeatures::enableAnimatedPropsOverlay = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_batched_mounting_ios")) {
+    CoreFeatures::enableBatchedMounting = true;
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_paragraph_pre_measurement")) {
+    CoreFeatures::enableParagraphPreMeasurement = true;
+    if (!_contextContainer->find<std::function<void(std::function<void()> &&)>>("TextPreMeasurementExecutor")) {
+      _contextContainer->insert(
+          "TextPreMeasurementExecutor", std::function<void(std::function<void()> &&)>([](std::function<void()> &&task) {
+            auto measure = std::move(task);
+            dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+              measure();
+            });
+          }));
+    }
+  }
+
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_persistent_text_measure_cache") &&
+      !_contextContainer->find<std::shared_ptr<PersistentTextMeasureCache>>(
+                            PersistentTextMeasureCache::kContextContainerKey)) {
+    [self _registerPersistentTextMeasureCache];
+  }
+
+  if (!MemoryPressureCoordinator::fromContextContainer(_contextContainer)) {
+    _contextContainer->insert(
+        MemoryPressureCoordinator::kContextContainerKey, std::make_shared<MemoryPressureCoordinator>());
+  }
+
   auto componentRegistryFactory =
       [factory = wrapManagedObject(_mountingManager.componentViewRegistry.componentViewFactory)](
           const EventDispatcher::Weak &eventDispatcher, const ContextContainer::Shared &contextContainer) {
@@ -294,9 +535,19 @@ static BackgroundExecutor RCTGetBackgroundExecutor()
     };
   }
 
+  if (runtimeScheduler && reactNativeConfig &&
+      reactNativeConfig->getBool("react_fabric:enable_frame_deadline_aware_scheduling")) {
+    [_frameDeadlineReporter invalidate];
+    _frameDeadlineReporter = [[RCTFrameDeadlineReporter alloc] initWithRuntimeScheduler:runtimeScheduler];
+  }
+
   toolbox.runtimeExecutor = runtimeExecutor;
   toolbox.bridgelessBindingsExecutor = _bridgelessBindingsExecutor;
 
+  if (reactNativeConfig && reactNativeConfig->getBool("react_fabric:enable_image_prefetching")) {
+    toolbox.commitHooks.push_back(std::make_shared<ImagePrefetchCommitHook>());
+  }
+
   toolbox.mainRunLoopObserverFactory = [](RunLoopObserver::Activity activities,
                                           const RunLoopObserver::WeakOwner &owner) {
     return std::make_unique<MainRunLoopObserver>(activities, owner);
@@ -351,6 +602,23 @@ static BackgroundExecutor RCTGetBackgroundExecutor()
   [self suspend];
 }
 
+- (void)_applicationDidReceiveMemoryWarning
+{
+  [self _trimMemory:MemoryPressureLevel::Critical];
+}
+
+- (void)_applicationDidEnterBackground
+{
+  [self _trimMemory:MemoryPressureLevel::Background];
+}
+
+- (void)_trimMemory:(MemoryPressureLevel)level
+{
+  if (auto memoryPressureCoordinator = MemoryPressureCoordinator::fromContextContainer(_contextContainer)) {
+    memoryPressureCoordinator->trim(level);
+  }
+}
+
 #pragma mark - RCTSchedulerDelegate
 
 - (void)schedulerDidFinishTransaction:(MountingCoordinator::Shared)mountingCoordinator
@@ -385,6 +653,11 @@ static BackgroundExecutor RCTGetBackgroundExecutor()
   [_mountingManager setIsJSResponder:isJSResponder blockNativeResponder:blockNativeResponder forShadowView:shadowView];
 }
 
+- (void)schedulerDidRequestViewPrewarmingForComponentName:(const std::string &)componentName count:(size_t)count
+{
+  [_mountingManager prewarmComponentViewsWithComponentName:componentName count:count];
+}
+
 - (void)addObserver:(id<RCTSurfacePresenterObserver>)observer
 {
   std::unique_lock lock(_observerListMutex);
@@ -32,6 +32,7 @@ class PlatformRunLoopObserver : public RunLoopObserver {
  private:
   void startObserving() const noexcept override;
   void stopObserving() const noexcept override;
+  void wakeUp() const noexcept override;
 
   CFRunLoopRef runLoop_;
   CFRunLoopObserverRef mainRunLoopObserver_;
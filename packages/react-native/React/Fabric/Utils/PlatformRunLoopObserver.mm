@@ -87,6 +87,11 @@ void PlatformRunLoopObserver::stopObserving() const noexcept
   CFRunLoopRemoveObserver(runLoop_, mainRunLoopObserver_, kCFRunLoopCommonModes);
 }
 
+void PlatformRunLoopObserver::wakeUp() const noexcept
+{
+  CFRunLoopWakeUp(runLoop_);
+}
+
 bool PlatformRunLoopObserver::isOnRunLoopThread() const noexcept
 {
   return CFRunLoopGetCurrent() == runLoop_;
@@ -34,8 +34,8 @@ public class BackgroundExecutor {
   private final ExecutorService mExecutorService;
 
   @DoNotStrip
-  private BackgroundExecutor(String name) {
-    mExecutorService = Executors.newFixedThreadPool(1, new NamedThreadFactory(name));
+  private BackgroundExecutor(String name, int numberOfThreads) {
+    mExecutorService = Executors.newFixedThreadPool(numberOfThreads, new NamedThreadFactory(name));
   }
 
   @DoNotStrip
@@ -224,6 +224,21 @@ public class ReactMarker {
     }
   }
 
+  /**
+   * Returns every marker recorded by native code and reported to it so far, as a Chrome trace
+   * (JSON) that can be opened in Perfetto. Returns null if the native library is not loaded yet.
+   */
+  @AnyThread
+  public static @Nullable String getStartupTrace() {
+    if (!ReactBridge.isInitialized()) {
+      return null;
+    }
+    return nativeGetStartupTrace();
+  }
+
   @DoNotStrip
   private static native void nativeLogMarker(String markerName, long markerTime);
+
+  @DoNotStrip
+  private static native String nativeGetStartupTrace();
 }
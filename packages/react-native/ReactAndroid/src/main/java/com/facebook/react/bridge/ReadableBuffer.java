@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+package com.facebook.react.bridge;
+
+import androidx.annotation.Nullable;
+import com.facebook.infer.annotation.Assertions;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.charset.StandardCharsets;
+
+/**
+ * Base class of maps and arrays that native code serialized into a single {@link ByteBuffer} (see
+ * ReadableNativeBuffer.h for its layout). Values are decoded from the buffer each time they are
+ * read, so reading a few values of a large map doesn't box all of them.
+ */
+abstract class ReadableBuffer {
+  private static final int HEADER_SIZE = 4;
+  private static final int BUCKET_SIZE = 16;
+  private static final int KEY_OFFSET = 4;
+  private static final int VALUE_OFFSET = 8;
+  private static final int STRING_LENGTH_SIZE = 4;
+
+  private static final ReadableType[] TYPES = ReadableType.values();
+
+  // Owns the native memory the buffer is backed by, which must outlive the buffer.
+  private final Object mOwner;
+  private final ByteBuffer mBuffer;
+  private final int mOffset;
+  private final int mCount;
+
+  ReadableBuffer(Object owner, ByteBuffer buffer, int offset) {
+    mOwner = owner;
+    mBuffer = buffer.order(ByteOrder.nativeOrder());
+    mOffset = offset;
+    mCount = mBuffer.getInt(offset);
+  }
+
+  protected int count() {
+    return mCount;
+  }
+
+  private int bucketOffset(int index) {
+    if (index < 0 || index >= mCount) {
+      throw new ArrayIndexOutOfBoundsException(index);
+    }
+    return mOffset + HEADER_SIZE + index * BUCKET_SIZE;
+  }
+
+  private void assertType(int index, ReadableType type) {
+    ReadableType actualType = typeAt(index);
+    if (actualType != type) {
+      throw new UnexpectedNativeTypeException("expected " + type + ", got a " + actualType);
+    }
+  }
+
+  private long valueAt(int index) {
+    return mBuffer.getLong(bucketOffset(index) + VALUE_OFFSET);
+  }
+
+  private String readString(int offset) {
+    byte[] bytes = new byte[mBuffer.getInt(offset)];
+    // Reads from a duplicate, as relative reads would race with other readers.
+    ByteBuffer buffer = mBuffer.duplicate();
+    buffer.position(offset + STRING_LENGTH_SIZE);
+    buffer.get(bytes);
+    return new String(bytes, StandardCharsets.UTF_8);
+  }
+
+  protected ReadableType typeAt(int index) {
+    return TYPES[mBuffer.getInt(bucketOffset(index))];
+  }
+
+  protected String keyAt(int index) {
+    return readString(mBuffer.getInt(bucketOffset(index) + KEY_OFFSET));
+  }
+
+  protected boolean booleanAt(int index) {
+    assertType(index, ReadableType.Boolean);
+    return valueAt(index) != 0;
+  }
+
+  protected double doubleAt(int index) {
+    assertType(index, ReadableType.Number);
+    return Double.longBitsToDouble(valueAt(index));
+  }
+
+  protected @Nullable String stringAt(int index) {
+    if (typeAt(index) == ReadableType.Null) {
+      return null;
+    }
+    assertType(index, ReadableType.String);
+    return readString((int) valueAt(index));
+  }
+
+  protected @Nullable ReadableBufferMap mapAt(int index) {
+    if (typeAt(index) == ReadableType.Null) {
+      return null;
+    }
+    assertType(index, ReadableType.Map);
+    return new ReadableBufferMap(mOwner, mBuffer, (int) valueAt(index));
+  }
+
+  protected @Nullable ReadableBufferArray arrayAt(int index) {
+    if (typeAt(index) == ReadableType.Null) {
+      return null;
+    }
+    assertType(index, ReadableType.Array);
+    return new ReadableBufferArray(mOwner, mBuffer, (int) valueAt(index));
+  }
+
+  /** Returns the value at the given index as the Java type ReadableNative containers box it to. */
+  protected @Nullable Object objectAt(int index) {
+    switch (typeAt(index)) {
+      case Boolean:
+        return booleanAt(index);
+      case Number:
+        return doubleAt(index);
+      case String:
+        return stringAt(index);
+      case Map:
+        return mapAt(index);
+      case Array:
+        return arrayAt(index);
+      default:
+        return null;
+    }
+  }
+
+  /** Like {@link #objectAt}, but converts maps and arrays to hash maps and array lists. */
+  protected @Nullable Object javaObjectAt(int index) {
+    switch (typeAt(index)) {
+      case Map:
+        return Assertions.assertNotNull(mapAt(index)).toHashMap();
+      case Array:
+        return Assertions.assertNotNull(arrayAt(index)).toArrayList();
+      default:
+        return objectAt(index);
+    }
+  }
+}
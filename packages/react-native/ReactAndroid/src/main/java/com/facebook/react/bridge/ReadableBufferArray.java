@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+package com.facebook.react.bridge;
+
+import androidx.annotation.NonNull;
+import java.nio.ByteBuffer;
+import java.util.ArrayList;
+
+/**
+ * Read-only array backed by a buffer serialized in native code. See {@link
+ * ReadableNativeArray#toBufferedArray()}.
+ */
+class ReadableBufferArray extends ReadableBuffer implements ReadableArray {
+  ReadableBufferArray(Object owner, ByteBuffer buffer, int offset) {
+    super(owner, buffer, offset);
+  }
+
+  @Override
+  public int size() {
+    return count();
+  }
+
+  @Override
+  public boolean isNull(int index) {
+    return typeAt(index) == ReadableType.Null;
+  }
+
+  @Override
+  public boolean getBoolean(int index) {
+    return booleanAt(index);
+  }
+
+  @Override
+  public double getDouble(int index) {
+    return doubleAt(index);
+  }
+
+  @Override
+  public int getInt(int index) {
+    return (int) doubleAt(index);
+  }
+
+  @Override
+  public @NonNull String getString(int index) {
+    return stringAt(index);
+  }
+
+  @Override
+  public @NonNull ReadableArray getArray(int index) {
+    return arrayAt(index);
+  }
+
+  @Override
+  public @NonNull ReadableMap getMap(int index) {
+    return mapAt(index);
+  }
+
+  @Override
+  public @NonNull ReadableType getType(int index) {
+    return typeAt(index);
+  }
+
+  @Override
+  public @NonNull Dynamic getDynamic(int index) {
+    return DynamicFromArray.create(this, index);
+  }
+
+  @Override
+  public int hashCode() {
+    return toArrayList().hashCode();
+  }
+
+  @Override
+  public boolean equals(Object obj) {
+    if (!(obj instanceof ReadableBufferArray)) {
+      return false;
+    }
+    return toArrayList().equals(((ReadableBufferArray) obj).toArrayList());
+  }
+
+  @Override
+  public @NonNull ArrayList<Object> toArrayList() {
+    int size = size();
+    ArrayList<Object> arrayList = new ArrayList<>(size);
+    for (int i = 0; i < size; i++) {
+      arrayList.add(javaObjectAt(i));
+    }
+    return arrayList;
+  }
+}
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+package com.facebook.react.bridge;
+
+import androidx.annotation.NonNull;
+import androidx.annotation.Nullable;
+import java.nio.ByteBuffer;
+import java.util.HashMap;
+import java.util.Iterator;
+import java.util.Map;
+
+/**
+ * Read-only map backed by a buffer serialized in native code. See {@link
+ * ReadableNativeMap#toBufferedMap()}.
+ */
+class ReadableBufferMap extends ReadableBuffer implements ReadableMap {
+  private @Nullable HashMap<String, Integer> mKeyIndices;
+
+  ReadableBufferMap(Object owner, ByteBuffer buffer, int offset) {
+    super(owner, buffer, offset);
+  }
+
+  private HashMap<String, Integer> getKeyIndices() {
+    if (mKeyIndices != null) {
+      return mKeyIndices;
+    }
+    synchronized (this) {
+      if (mKeyIndices == null) {
+        int count = count();
+        HashMap<String, Integer> keyIndices = new HashMap<>(count);
+        for (int i = 0; i < count; i++) {
+          keyIndices.put(keyAt(i), i);
+        }
+        mKeyIndices = keyIndices;
+      }
+    }
+    return mKeyIndices;
+  }
+
+  private int getIndex(@NonNull String name) {
+    Integer index = getKeyIndices().get(name);
+    if (index == null) {
+      throw new NoSuchKeyException(name);
+    }
+    return index;
+  }
+
+  private int getNonNullIndex(@NonNull String name) {
+    int index = getIndex(name);
+    if (typeAt(index) == ReadableType.Null) {
+      throw new NoSuchKeyException(name);
+    }
+    return index;
+  }
+
+  @Override
+  public boolean hasKey(@NonNull String name) {
+    return getKeyIndices().containsKey(name);
+  }
+
+  @Override
+  public boolean isNull(@NonNull String name) {
+    return typeAt(getIndex(name)) == ReadableType.Null;
+  }
+
+  @Override
+  public boolean getBoolean(@NonNull String name) {
+    return booleanAt(getNonNullIndex(name));
+  }
+
+  @Override
+  public double getDouble(@NonNull String name) {
+    return doubleAt(getNonNullIndex(name));
+  }
+
+  @Override
+  public int getInt(@NonNull String name) {
+    // All numbers coming out of native are doubles, so cast here then truncate
+    return (int) doubleAt(getNonNullIndex(name));
+  }
+
+  @Override
+  public @Nullable String getString(@NonNull String name) {
+    return hasKey(name) ? stringAt(getIndex(name)) : null;
+  }
+
+  @Override
+  public @Nullable ReadableArray getArray(@NonNull String name) {
+    return hasKey(name) ? arrayAt(getIndex(name)) : null;
+  }
+
+  @Override
+  public @Nullable ReadableMap getMap(@NonNull String name) {
+    return hasKey(name) ? mapAt(getIndex(name)) : null;
+  }
+
+  @Override
+  public @NonNull ReadableType getType(@NonNull String name) {
+    return typeAt(getIndex(name));
+  }
+
+  @Override
+  public @NonNull Dynamic getDynamic(@NonNull String name) {
+    return DynamicFromMap.create(this, name);
+  }
+
+  @Override
+  public @NonNull Iterator<Map.Entry<String, Object>> getEntryIterator() {
+    return new Iterator<Map.Entry<String, Object>>() {
+      int currentIndex = 0;
+
+      @Override
+      public boolean hasNext() {
+        return currentIndex < count();
+      }
+
+      @Override
+      public Map.Entry<String, Object> next() {
+        final int index = currentIndex++;
+        final String key = keyAt(index);
+        final Object value = objectAt(index);
+        return new Map.Entry<String, Object>() {
+          @Override
+          public String getKey() {
+            return key;
+          }
+
+          @Override
+          public Object getValue() {
+            return value;
+          }
+
+          @Override
+          public Object setValue(Object value) {
+            throw new UnsupportedOperationException(
+                "Can't set a value while iterating over a ReadableBufferMap");
+          }
+        };
+      }
+    };
+  }
+
+  @Override
+  public @NonNull ReadableMapKeySetIterator keySetIterator() {
+    return new ReadableMapKeySetIterator() {
+      int currentIndex = 0;
+
+      @Override
+      public boolean hasNextKey() {
+        return currentIndex < count();
+      }
+
+      @Override
+      public String nextKey() {
+        return keyAt(currentIndex++);
+      }
+    };
+  }
+
+  @Override
+  public int hashCode() {
+    return toHashMap().hashCode();
+  }
+
+  @Override
+  public boolean equals(Object obj) {
+    if (!(obj instanceof ReadableBufferMap)) {
+      return false;
+    }
+    return toHashMap().equals(((ReadableBufferMap) obj).toHashMap());
+  }
+
+  @Override
+  public @NonNull HashMap<String, Object> toHashMap() {
+    int count = count();
+    HashMap<String, Object> hashMap = new HashMap<>(count);
+    for (int i = 0; i < count; i++) {
+      hashMap.put(keyAt(i), javaObjectAt(i));
+    }
+    return hashMap;
+  }
+}
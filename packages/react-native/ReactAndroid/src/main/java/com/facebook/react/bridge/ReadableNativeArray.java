@@ -12,6 +12,7 @@ import androidx.annotation.Nullable;
 import com.facebook.infer.annotation.Assertions;
 import com.facebook.jni.HybridData;
 import com.facebook.proguard.annotations.DoNotStrip;
+import java.nio.ByteBuffer;
 import java.util.ArrayList;
 import java.util.Arrays;
 
@@ -72,6 +73,17 @@ public class ReadableNativeArray extends NativeArray implements ReadableArray {
 
   private native Object[] importTypeArray();
 
+  private native ByteBuffer importByteBuffer();
+
+  /**
+   * Returns a read-only copy of this array that is transferred from native code in a single
+   * buffer. See {@link ReadableNativeMap#toBufferedMap()}.
+   */
+  public @NonNull ReadableArray toBufferedArray() {
+    jniPassCounter++;
+    return new ReadableBufferArray(this, Assertions.assertNotNull(importByteBuffer()), 0);
+  }
+
   @Override
   public int size() {
     return getLocalArray().length;
@@ -12,6 +12,7 @@ import androidx.annotation.Nullable;
 import com.facebook.infer.annotation.Assertions;
 import com.facebook.jni.HybridData;
 import com.facebook.proguard.annotations.DoNotStrip;
+import java.nio.ByteBuffer;
 import java.util.HashMap;
 import java.util.Iterator;
 import java.util.Map;
@@ -93,6 +94,20 @@ public class ReadableNativeMap extends NativeMap implements ReadableMap {
 
   private native Object[] importTypes();
 
+  private native ByteBuffer importByteBuffer();
+
+  /**
+   * Returns a read-only copy of this map that is transferred from native code in a single buffer.
+   * Its values are decoded from the buffer when they are read, instead of importing and boxing all
+   * of them at once, which is cheaper for large maps of which only a few values are read. The copy is taken the
+   * first time this is called.
+   */
+  public @NonNull ReadableMap toBufferedMap() {
+    ByteBuffer buffer = Assertions.assertNotNull(importByteBuffer());
+    mJniCallCounter++;
+    return new ReadableBufferMap(this, buffer, 0);
+  }
+
   @Override
   public boolean hasKey(@NonNull String name) {
     return getLocalMap().containsKey(name);
@@ -67,17 +67,29 @@ public class ReadableMapBuffer : MapBuffer {
 
   /**
    * @param key Key to search for
-   * @return the "bucket index" for a key or -1 if not found. It uses a binary search algorithm
-   *   (log(n))
+   * @return the "bucket index" for a key or -1 if not found. Keys are sorted and unique, so the
+   *   bucket of a key is at most `key - firstKey` buckets after the first one, and exactly there
+   *   when keys are dense (O(1)). Otherwise, it uses a binary search algorithm (log(n)).
    */
   private fun getBucketIndexForKey(intKey: Int): Int {
-    if (intKey !in KEY_RANGE) {
+    if (intKey !in KEY_RANGE || count == 0) {
       return -1
     }
     val key = intKey.toUShort()
+    val firstKey = readUnsignedShort(getKeyOffsetForBucketIndex(0))
+    if (key < firstKey) {
+      return -1
+    }
+
+    var hi = minOf(count - 1, intKey - firstKey.toInt())
+    val hiVal = readUnsignedShort(getKeyOffsetForBucketIndex(hi))
+    when {
+      hiVal == key -> return hi
+      hiVal < key -> return -1
+    }
 
-    var lo = 0
-    var hi = count - 1
+    var lo = 1
+    hi -= 1
     while (lo <= hi) {
       val mid = lo + hi ushr 1
       val midVal = readUnsignedShort(getKeyOffsetForBucketIndex(mid))
@@ -115,12 +115,159 @@ public class ReactFeatureFlags {
   /** Use native view configs in bridgeless mode. */
   public static boolean useNativeViewConfigsInBridgelessMode = false;
 
+  /**
+   * Generate the native view config of a view manager when it is first used in bridgeless mode,
+   * instead of the ones of all view managers in UIManager.getConstants.
+   */
+  public static boolean enableLazyNativeViewConfigsInBridgelessMode = false;
+
+  /** Keep the native view configs generated in bridgeless mode across launches of the app. */
+  public static boolean enablePersistentNativeViewConfigsInBridgelessMode = false;
+
   /** When enabled, Fabric will avoid cloning notes to perform state progression. */
   public static boolean enableClonelessStateProgression = false;
 
   /** When enabled, rawProps in Props will not include Yoga specific props. */
   public static boolean excludeYogaFromRawProps = false;
 
+  /** When enabled, Fabric will diff independent subtrees concurrently on worker threads. */
+  public static boolean enableParallelDifferentiator = false;
+
+  /** When enabled, Fabric will reorder children with the minimal number of moves. */
+  public static boolean enableDifferentiatorMinimalMoves = false;
+
+  /** When enabled, Fabric will drop mutations that cancel each other out before mounting. */
+  public static boolean enableMountingTransactionCompaction = false;
+
+  /** When enabled, Fabric will commit shadow trees optimistically, retrying stale commits. */
+  public static boolean enableOptimisticShadowTreeCommit = false;
+
+  /** When enabled, Fabric will reuse pooled direct buffers to send mount instructions to Java. */
+  public static boolean enablePooledMountBuffers = false;
+
+  /** When enabled, Fabric will mount views within the viewport before off-screen views. */
+  public static boolean enableProgressiveMounting = false;
+
+  /**
+   * When enabled, Fabric will not measure text again when a paragraph is cloned without changes to
+   * its props, children or state.
+   */
+  public static boolean enableYogaLayoutReuse = false;
+
+  /**
+   * When enabled, Fabric will measure the text of changed paragraphs on a background thread ahead of
+   * their layout.
+   */
+  public static boolean enableParagraphPreMeasurement = false;
+
+  /**
+   * When enabled, Fabric will measure the text of sibling paragraphs with a single call from C++
+   * into Java.
+   */
+  public static boolean enableBatchedTextMeasurement = false;
+
+  /**
+   * When enabled, Fabric will reuse text measurements at other widths which lay out the text the
+   * same way, e.g. after a resize.
+   */
+  public static boolean enableTextMeasureRangeCache = false;
+
+  /**
+   * When enabled, Fabric will skip converting props of clones which are unchanged since the props
+   * the clones are cloned from.
+   */
+  public static boolean enableSkippingUnchangedRawProps = false;
+
+  /**
+   * When enabled, Fabric will only send props whose values changed since the mounted props to view
+   * managers when updating views.
+   */
+  public static boolean enableMinimalPropsUpdates = false;
+
+  /**
+   * When enabled, Fabric will share one props object between views and paragraphs created with
+   * equal props, e.g. in lists.
+   */
+  public static boolean enablePropsInterning = false;
+
+  /**
+   * When enabled, Fabric will reuse memory of freed shadow nodes, props and lists of children for
+   * new ones, instead of allocating each of them separately.
+   */
+  public static boolean enablePooledShadowNodeAllocation = false;
+
+  /**
+   * When enabled, Fabric reports the deadline of every frame to the RuntimeScheduler, so React
+   * yields in time for the rendering updates of the frame to be mounted.
+   */
+  public static boolean enableFrameDeadlineAwareScheduling = false;
+
+  /**
+   * When enabled, the RuntimeScheduler aggregates how long tasks wait before they run and how long
+   * they take to run, for each priority.
+   */
+  public static boolean enableRuntimeSchedulerTelemetry = false;
+
+  /**
+   * Fires the timers of the bridgeless runtime from a single platform timer armed for the earliest
+   * of them, all expired timers at once.
+   */
+  public static boolean enableBatchedTimers = false;
+
+  /**
+   * Computes the intersections of IntersectionObserver targets on a background thread at most 10
+   * times per second, instead of on the main thread on every mount.
+   */
+  public static boolean enableBackgroundIntersectionObservation = false;
+
+  /**
+   * Completes surfaces (layout, diffing and preparing the mount) on a pool of background threads,
+   * so that surfaces updated together are processed in parallel.
+   */
+  public static boolean enableConcurrentSurfaceCompletion = false;
+
+  /**
+   * Keeps views which switched between being flattened and forming a view a few times unflattened,
+   * so that their children are not reparented again each time.
+   */
+  public static boolean enableStickyViewUnflattening = false;
+
+  /**
+   * Samples the JS heap and records the garbage collections of the JS VM of the React instance,
+   * for traces and telemetry.
+   */
+  public static boolean enableJSHeapSampling = false;
+
+  /**
+   * Makes clones of Yoga nodes keep the style of their source when their new props don't change
+   * any Yoga style prop.
+   */
+  public static boolean enableSkippingUnchangedYogaStyles = false;
+
+  /**
+   * Makes clones of Yoga nodes with new children update only the Yoga children that changed, e.g.
+   * the ones appended to a long list.
+   */
+  public static boolean enableIncrementalYogaChildrenUpdates = false;
+
+  /**
+   * Lets new Yoga subtrees without text (e.g. in list cells) reuse the layout of an identical
+   * subtree laid out before.
+   */
+  public static boolean enableYogaLayoutTemplates = false;
+
+  /**
+   * Flushes discrete events (e.g. the start and the end of a touch) right away through the
+   * RuntimeScheduler, instead of waiting for the next event beat with continuous events.
+   */
+  public static boolean enableImmediateDiscreteEvents = false;
+
+  /**
+   * Mounts setNativeProps updates of props which only change how views are drawn (e.g. opacity,
+   * transform or colors) without committing a new shadow tree.
+   */
+  public static boolean enableAnimatedPropsOverlay = false;
+
   /**
    * Enables storing js caller stack when creating promise in native module. This is useful in case
    * of Promise rejection and tracing the cause.
@@ -146,4 +293,68 @@ public class ReactFeatureFlags {
    *  when there is work to do.
    */
   public static boolean enableOnDemandReactChoreographer = false;
+
+  /*
+   * When enabled, props of mounted views are read from a single buffer serialized in native code
+   * instead of importing and boxing all of their values over JNI.
+   */
+  public static boolean enableBufferedPropsImport = false;
+
+  /*
+   * When enabled, props of mount items are imported into buffers (as with
+   * enableBufferedPropsImport) on the thread committing the shadow tree, rather than on the UI
+   * thread when the mount items are executed.
+   */
+  public static boolean enableBackgroundPropsImport = false;
+
+  /*
+   * When enabled, ScrollView and TextInput send their state updates to C++ as MapBuffers instead of
+   * maps.
+   */
+  public static boolean enableMapBufferStateUpdates = false;
+
+  /*
+   * When enabled, state updates of TextInput only replace the range of the text which was edited,
+   * so that the rest of the text (e.g. the other paragraphs of multiline inputs) keeps its layout.
+   */
+  public static boolean enableIncrementalTextInputUpdates = false;
+
+  /*
+   * When enabled, ScrollViews only send their scroll position to Fabric while scrolling when C++
+   * reads it (e.g. to measure views or compute intersections), at most as often as C++ asks for,
+   * and otherwise only once scrolling ends.
+   */
+  public static boolean enableThrottledScrollViewStateUpdates = false;
+
+  /*
+   * When enabled, commits from React made while mount items of previous commits are still waiting
+   * to be mounted are held back in C++, and mounted together once the UI thread reports it caught
+   * up. Mounts are reported whenever this is enabled, even without enableMountHooks.
+   */
+  public static boolean enableCommitLoadShedding = false;
+
+  /*
+   * When enabled, mount items of commits made on the Fabric background executor are prepared
+   * (diffed and serialized) on another thread of the executor, so the layout of the next commit to
+   * the surface runs meanwhile. Requires the background executor.
+   */
+  public static boolean enablePipelinedMountPreparation = false;
+
+  /*
+   * When enabled, the props parser of each component is prepared when the component is first
+   * rendered, rather than when Fabric starts.
+   */
+  public static boolean enableLazyRawPropsParserPreparation = false;
+
+  /*
+   * When enabled, the text layout managers of all React instances of the process share one cache
+   * of text measurements.
+   */
+  public static boolean enableProcessWideTextMeasureCache = false;
+
+  /*
+   * When enabled, each new shadow node family is allocated together with its event emitter and
+   * initial state in one block of memory.
+   */
+  public static boolean enableCoallocatedShadowNodeFamilies = false;
 }
@@ -36,6 +36,8 @@ public interface Binding {
 
   void setPixelDensity(float pointScaleFactor);
 
+  void trimMemory(int level);
+
   void setConstraints(
       int surfaceId,
       float minWidth,
@@ -51,8 +53,12 @@ public interface Binding {
 
   void reportMount(int surfaceId);
 
+  void reportFrameDeadline(long frameTimeRemainingNanos);
+
   ReadableNativeMap getInspectorDataForInstance(EventEmitterWrapper eventEmitterWrapper);
 
+  ReadableNativeMap getSurfaceTelemetry(int surfaceId);
+
   void register(
       @NonNull RuntimeExecutor runtimeExecutor,
       @NonNull RuntimeScheduler runtimeScheduler,
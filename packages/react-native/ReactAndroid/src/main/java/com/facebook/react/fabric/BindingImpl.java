@@ -71,6 +71,9 @@ public class BindingImpl implements Binding {
   @Override
   public native void setPixelDensity(float pointScaleFactor);
 
+  @Override
+  public native void trimMemory(int level);
+
   @Override
   public native void setConstraints(
       int surfaceId,
@@ -87,9 +90,13 @@ public class BindingImpl implements Binding {
 
   public native void reportMount(int surfaceId);
 
+  public native void reportFrameDeadline(long frameTimeRemainingNanos);
+
   public native ReadableNativeMap getInspectorDataForInstance(
       EventEmitterWrapper eventEmitterWrapper);
 
+  public native ReadableNativeMap getSurfaceTelemetry(int surfaceId);
+
   public void register(
       @NonNull RuntimeExecutor runtimeExecutor,
       @NonNull RuntimeScheduler runtimeScheduler,
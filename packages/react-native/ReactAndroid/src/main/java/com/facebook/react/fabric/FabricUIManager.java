@@ -20,7 +20,9 @@ import static com.facebook.react.uimanager.UIManagerHelper.PADDING_TOP_INDEX;
 import static com.facebook.react.uimanager.common.UIManagerType.FABRIC;
 
 import android.annotation.SuppressLint;
+import android.content.ComponentCallbacks2;
 import android.content.Context;
+import android.content.res.Configuration;
 import android.graphics.Point;
 import android.os.SystemClock;
 import android.view.View;
@@ -52,6 +54,7 @@ import com.facebook.react.bridge.UiThreadUtil;
 import com.facebook.react.bridge.WritableMap;
 import com.facebook.react.common.LifecycleState;
 import com.facebook.react.common.build.ReactBuildConfig;
+import com.facebook.react.common.mapbuffer.MapBuffer;
 import com.facebook.react.common.mapbuffer.ReadableMapBuffer;
 import com.facebook.react.config.ReactFeatureFlags;
 import com.facebook.react.fabric.events.EventEmitterWrapper;
@@ -86,6 +89,8 @@ import com.facebook.react.uimanager.events.FabricEventDispatcher;
 import com.facebook.react.uimanager.events.RCTEventEmitter;
 import com.facebook.react.views.text.TextLayoutManager;
 import com.facebook.react.views.text.TextLayoutManagerMapBuffer;
+import com.facebook.yoga.YogaMeasureOutput;
+import java.nio.ByteBuffer;
 import java.util.ArrayList;
 import java.util.HashMap;
 import java.util.List;
@@ -113,6 +118,9 @@ public class FabricUIManager implements UIManager, LifecycleEventListener {
   public static final boolean ENABLE_FABRIC_PERF_LOGS = ENABLE_FABRIC_LOGS || false;
   public DevToolsReactPerfLogger mDevToolsReactPerfLogger;
 
+  // Budget of a frame for React to render in, matching the one of MountItemDispatcher.
+  private static final long FRAME_TIME_NANOS = 16_000_000;
+
   private static final DevToolsReactPerfLogger.DevToolsReactPerfLoggerListener FABRIC_PERF_LOGGER =
       commitPoint -> {
         long commitDuration = commitPoint.getCommitDuration();
@@ -163,6 +171,7 @@ public class FabricUIManager implements UIManager, LifecycleEventListener {
   }
 
   @Nullable private Binding mBinding;
+  @NonNull private final MemoryTrimCallback mMemoryTrimCallback = new MemoryTrimCallback();
   @NonNull private final ReactApplicationContext mReactApplicationContext;
   @NonNull private final MountingManager mMountingManager;
   @NonNull private final EventDispatcher mEventDispatcher;
@@ -230,6 +239,7 @@ public class FabricUIManager implements UIManager, LifecycleEventListener {
 
     mViewManagerRegistry = viewManagerRegistry;
     mReactApplicationContext.registerComponentCallbacks(viewManagerRegistry);
+    mReactApplicationContext.registerComponentCallbacks(mMemoryTrimCallback);
   }
 
   @Override
@@ -280,6 +290,21 @@ public class FabricUIManager implements UIManager, LifecycleEventListener {
     return mBinding.getInspectorDataForInstance(eventEmitter);
   }
 
+  /**
+   * Returns telemetry aggregated over the mounted transactions of a surface: totals and
+   * p50/p90/p99 of per-transaction durations (in microseconds), affected layout nodes and text
+   * measurements. For the keys stored in the {@link ReadableMap} refer to the "toDynamic" function
+   * in ReactCommon/react/renderer/telemetry/SurfaceTelemetry.cpp.
+   *
+   * @param surfaceId {@link int} surface to return telemetry for.
+   * @return a {@link ReadableMap} with the telemetry, or an empty map if the surface isn't running.
+   */
+  @AnyThread
+  @ThreadConfined(ANY)
+  public ReadableMap getSurfaceTelemetry(final int surfaceId) {
+    return mBinding.getSurfaceTelemetry(surfaceId);
+  }
+
   @Override
   @AnyThread
   @ThreadConfined(ANY)
@@ -430,6 +455,7 @@ public class FabricUIManager implements UIManager, LifecycleEventListener {
     mEventDispatcher.unregisterEventEmitter(FABRIC);
 
     mReactApplicationContext.unregisterComponentCallbacks(mViewManagerRegistry);
+    mReactApplicationContext.unregisterComponentCallbacks(mMemoryTrimCallback);
     mViewManagerRegistry.invalidate();
 
     // Remove lifecycle listeners (onHostResume, onHostPause) since the FabricUIManager is going
@@ -627,6 +653,65 @@ public class FabricUIManager implements UIManager, LifecycleEventListener {
         attachmentsPositions);
   }
 
+  // Keys of the MapBuffer describing a batch of measurements, mirrored by the Android
+  // TextLayoutManager in C++.
+  private static final int MEASURE_KEY_REQUESTS = 0;
+  private static final int MEASURE_KEY_LOCAL_DATA = 0;
+  private static final int MEASURE_KEY_PROPS = 1;
+  private static final int MEASURE_KEY_MIN_WIDTH = 2;
+  private static final int MEASURE_KEY_MAX_WIDTH = 3;
+  private static final int MEASURE_KEY_MIN_HEIGHT = 4;
+  private static final int MEASURE_KEY_MAX_HEIGHT = 5;
+  private static final int MEASURE_KEY_ATTACHMENTS_COUNT = 6;
+
+  /**
+   * Measures several components of the same type with a single call from C++. For every request,
+   * writes its width and height to {@code results}, followed by the positions of its attachments.
+   */
+  @SuppressWarnings("unused")
+  private void measureMapBufferBatch(
+      int surfaceId, String componentName, ReadableMapBuffer requests, float[] results) {
+
+    ReactContext context;
+    if (surfaceId > 0) {
+      SurfaceMountingManager surfaceMountingManager =
+          mMountingManager.getSurfaceManagerEnforced(surfaceId, "measure");
+      if (surfaceMountingManager.isStopped()) {
+        return;
+      }
+      context = surfaceMountingManager.getContext();
+    } else {
+      context = mReactApplicationContext;
+    }
+
+    int offset = 0;
+    for (MapBuffer request : requests.getMapBufferList(MEASURE_KEY_REQUESTS)) {
+      float minWidth = (float) request.getDouble(MEASURE_KEY_MIN_WIDTH);
+      float maxWidth = (float) request.getDouble(MEASURE_KEY_MAX_WIDTH);
+      float minHeight = (float) request.getDouble(MEASURE_KEY_MIN_HEIGHT);
+      float maxHeight = (float) request.getDouble(MEASURE_KEY_MAX_HEIGHT);
+      float[] attachmentsPositions = new float[request.getInt(MEASURE_KEY_ATTACHMENTS_COUNT) * 2];
+
+      long size =
+          mMountingManager.measureMapBuffer(
+              context,
+              componentName,
+              request.getMapBuffer(MEASURE_KEY_LOCAL_DATA),
+              request.getMapBuffer(MEASURE_KEY_PROPS),
+              null,
+              getYogaSize(minWidth, maxWidth),
+              getYogaMeasureMode(minWidth, maxWidth),
+              getYogaSize(minHeight, maxHeight),
+              getYogaMeasureMode(minHeight, maxHeight),
+              attachmentsPositions);
+
+      results[offset++] = YogaMeasureOutput.getWidth(size);
+      results[offset++] = YogaMeasureOutput.getHeight(size);
+      System.arraycopy(attachmentsPositions, 0, results, offset, attachmentsPositions.length);
+      offset += attachmentsPositions.length;
+    }
+  }
+
   /**
    * @param surfaceId {@link int} surface ID
    * @param defaultTextInputPadding {@link float[]} output parameter will contain the default theme
@@ -768,6 +853,14 @@ public class FabricUIManager implements UIManager, LifecycleEventListener {
             isLayoutable));
   }
 
+  @SuppressWarnings("unused")
+  @AnyThread
+  @ThreadConfined(ANY)
+  private void prewarmViews(int rootTag, final String componentName, int count) {
+    addPreAllocateMountItem(
+        MountItemFactory.createPrewarmViewsMountItem(rootTag, componentName, count));
+  }
+
   @SuppressWarnings("unused")
   @AnyThread
   @ThreadConfined(ANY)
@@ -777,6 +870,34 @@ public class FabricUIManager implements UIManager, LifecycleEventListener {
         rootTag, intBuffer, objBuffer, commitNumber);
   }
 
+  @SuppressWarnings("unused")
+  @AnyThread
+  @ThreadConfined(ANY)
+  private MountItem createPooledIntBufferBatchMountItem(
+      int rootTag,
+      ByteBuffer intBuffer,
+      int intBufferLen,
+      Object[] objBuffer,
+      int objBufferLen,
+      int commitNumber) {
+    return MountItemFactory.createPooledIntBufferBatchMountItem(
+        rootTag, intBuffer, intBufferLen, objBuffer, objBufferLen, commitNumber);
+  }
+
+  @SuppressWarnings("unused")
+  @AnyThread
+  @ThreadConfined(ANY)
+  private ByteBuffer obtainMountIntBuffer(int size) {
+    return MountItemFactory.obtainMountIntBuffer(size);
+  }
+
+  @SuppressWarnings("unused")
+  @AnyThread
+  @ThreadConfined(ANY)
+  private Object[] obtainMountObjectBuffer(int size) {
+    return MountItemFactory.obtainMountObjectBuffer(size);
+  }
+
   /**
    * This method enqueues UI operations directly to the UI thread. This might change in the future
    * to enforce execution order using {@link ReactChoreographer.CallbackType}. This method should
@@ -1261,7 +1382,7 @@ public class FabricUIManager implements UIManager, LifecycleEventListener {
         listener.didMountItems(FabricUIManager.this);
       }
 
-      if (!ReactFeatureFlags.enableMountHooks) {
+      if (!ReactFeatureFlags.enableMountHooks && !ReactFeatureFlags.enableCommitLoadShedding) {
         return;
       }
 
@@ -1356,6 +1477,10 @@ public class FabricUIManager implements UIManager, LifecycleEventListener {
         mBinding.driveCxxAnimations();
       }
 
+      if (ReactFeatureFlags.enableFrameDeadlineAwareScheduling && mBinding != null) {
+        mBinding.reportFrameDeadline(frameTimeNanos + FRAME_TIME_NANOS - System.nanoTime());
+      }
+
       try {
         // First, execute as many pre mount items as we can within frameTimeNanos time.
         // If not all pre mount items were executed, following may happen:
@@ -1379,4 +1504,22 @@ public class FabricUIManager implements UIManager, LifecycleEventListener {
       }
     }
   }
+
+  /** Releases the caches of the renderer when the system asks the app for memory. */
+  private class MemoryTrimCallback implements ComponentCallbacks2 {
+
+    @Override
+    public void onTrimMemory(int level) {
+      Binding binding = mBinding;
+      if (binding != null) {
+        binding.trimMemory(level);
+      }
+    }
+
+    @Override
+    public void onConfigurationChanged(Configuration newConfig) {}
+
+    @Override
+    public void onLowMemory() {}
+  }
 }
@@ -18,6 +18,7 @@ import com.facebook.react.bridge.NativeMap;
 import com.facebook.react.bridge.ReadableNativeMap;
 import com.facebook.react.bridge.WritableMap;
 import com.facebook.react.common.mapbuffer.ReadableMapBuffer;
+import com.facebook.react.common.mapbuffer.WritableMapBuffer;
 import com.facebook.react.uimanager.StateWrapper;
 
 /**
@@ -49,6 +50,8 @@ public class StateWrapperImpl implements StateWrapper {
 
   public native void updateStateImpl(@NonNull NativeMap map);
 
+  public native void updateStateWithMapBufferImpl(@NonNull WritableMapBuffer mapBuffer);
+
   @Override
   @Nullable
   public ReadableMapBuffer getStateDataMapBuffer() {
@@ -78,6 +81,15 @@ public class StateWrapperImpl implements StateWrapper {
     updateStateImpl((NativeMap) map);
   }
 
+  @Override
+  public void updateState(@NonNull WritableMapBuffer mapBuffer) {
+    if (mDestroyed) {
+      FLog.e(TAG, "Race between StateWrapperImpl destruction and updateState");
+      return;
+    }
+    updateStateWithMapBufferImpl(mapBuffer);
+  }
+
   @Override
   public void destroyState() {
     if (!mDestroyed) {
@@ -14,6 +14,7 @@ import com.facebook.jni.HybridData;
 import com.facebook.proguard.annotations.DoNotStrip;
 import com.facebook.react.bridge.NativeMap;
 import com.facebook.react.bridge.WritableMap;
+import com.facebook.react.common.mapbuffer.WritableMapBuffer;
 import com.facebook.react.fabric.FabricSoLoader;
 import com.facebook.react.uimanager.events.EventCategoryDef;
 
@@ -39,6 +40,11 @@ public class EventEmitterWrapper {
   private native void dispatchEvent(
       @NonNull String eventName, @NonNull NativeMap params, @EventCategoryDef int category);
 
+  private native void dispatchEvent(
+      @NonNull String eventName,
+      @NonNull WritableMapBuffer params,
+      @EventCategoryDef int category);
+
   private native void dispatchUniqueEvent(@NonNull String eventName, @NonNull NativeMap params);
 
   /**
@@ -57,6 +63,24 @@ public class EventEmitterWrapper {
     dispatchEvent(eventName, (NativeMap) params, eventCategory);
   }
 
+  /**
+   * Invokes the execution of the C++ EventEmitter with a payload serialized as a {@link
+   * WritableMapBuffer}, which is converted to JS values without going through {@code
+   * folly::dynamic}. See MapBufferEventPayload.h for how the payload is laid out.
+   *
+   * @param eventName {@link String} name of the event to execute.
+   * @param params {@link WritableMapBuffer} payload of the event
+   */
+  public synchronized void dispatchMapBuffer(
+      @NonNull String eventName,
+      @NonNull WritableMapBuffer params,
+      @EventCategoryDef int eventCategory) {
+    if (!isValid()) {
+      return;
+    }
+    dispatchEvent(eventName, params, eventCategory);
+  }
+
   /**
    * Invokes the execution of the C++ EventEmitter. C++ will coalesce events sent to the same
    * target.
@@ -1213,6 +1213,22 @@ public class SurfaceMountingManager {
         componentName, reactTag, props, stateWrapper, eventEmitterWrapper, isLayoutable);
   }
 
+  /**
+   * Creates views of the component until the {@link ViewManager} keeps {@code count} views for
+   * recycling on this surface. This is a no-op if the {@link ViewManager} doesn't recycle views.
+   */
+  @UiThread
+  public void prewarmViews(@NonNull String componentName, int count) {
+    UiThreadUtil.assertOnUiThread();
+
+    ThemedReactContext themedReactContext = mThemedReactContext;
+    if (isStopped() || themedReactContext == null) {
+      return;
+    }
+
+    mViewManagerRegistry.get(componentName).prewarmViews(themedReactContext, count);
+  }
+
   @AnyThread
   @ThreadConfined(ANY)
   public @Nullable EventEmitterWrapper getEventEmitter(int reactTag) {
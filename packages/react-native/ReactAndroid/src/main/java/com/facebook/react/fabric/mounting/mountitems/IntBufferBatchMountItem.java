@@ -12,16 +12,21 @@ import static com.facebook.react.fabric.FabricUIManager.IS_DEVELOPMENT_ENVIRONME
 import static com.facebook.react.fabric.mounting.mountitems.FabricNameComponentMapping.getFabricComponentName;
 
 import androidx.annotation.NonNull;
+import androidx.annotation.Nullable;
 import com.facebook.common.logging.FLog;
 import com.facebook.proguard.annotations.DoNotStrip;
 import com.facebook.react.bridge.ReactMarker;
 import com.facebook.react.bridge.ReactMarkerConstants;
 import com.facebook.react.bridge.ReadableMap;
+import com.facebook.react.bridge.ReadableNativeMap;
+import com.facebook.react.config.ReactFeatureFlags;
 import com.facebook.react.fabric.events.EventEmitterWrapper;
 import com.facebook.react.fabric.mounting.MountingManager;
 import com.facebook.react.fabric.mounting.SurfaceMountingManager;
 import com.facebook.react.uimanager.StateWrapper;
 import com.facebook.systrace.Systrace;
+import java.nio.ByteBuffer;
+import java.nio.IntBuffer;
 
 /**
  * This class represents a batch of {@link MountItem}s, represented directly as int buffers to
@@ -33,6 +38,9 @@ import com.facebook.systrace.Systrace;
  *
  * <p>The purpose of encapsulating the array of MountItems this way, is to reduce the amount of
  * allocations in C++ and JNI round-trips.
+ *
+ * <p>With pooled mount buffers, the ints are read in place from a direct {@link ByteBuffer} of the
+ * {@link MountBufferPool}, and both buffers are returned to the pool once the batch is executed.
  */
 @DoNotStrip
 final class IntBufferBatchMountItem implements BatchMountItem {
@@ -55,21 +63,81 @@ final class IntBufferBatchMountItem implements BatchMountItem {
   private final int mSurfaceId;
   private final int mCommitNumber;
 
-  private final @NonNull int[] mIntBuffer;
+  private final @NonNull IntBuffer mIntBuffer;
   private final @NonNull Object[] mObjBuffer;
 
   private final int mIntBufferLen;
   private final int mObjBufferLen;
 
+  private final @Nullable ByteBuffer mPooledIntBuffer;
+  private boolean mIsReleased = false;
+
   IntBufferBatchMountItem(int surfaceId, int[] intBuf, Object[] objBuf, int commitNumber) {
     mSurfaceId = surfaceId;
     mCommitNumber = commitNumber;
 
-    mIntBuffer = intBuf;
+    mIntBuffer = IntBuffer.wrap(intBuf != null ? intBuf : new int[0]);
     mObjBuffer = objBuf;
 
-    mIntBufferLen = mIntBuffer != null ? mIntBuffer.length : 0;
+    mIntBufferLen = intBuf != null ? intBuf.length : 0;
     mObjBufferLen = mObjBuffer != null ? mObjBuffer.length : 0;
+
+    mPooledIntBuffer = null;
+
+    if (ReactFeatureFlags.enableBackgroundPropsImport) {
+      importProps();
+    }
+  }
+
+  IntBufferBatchMountItem(
+      int surfaceId,
+      ByteBuffer intBuf,
+      int intBufLen,
+      Object[] objBuf,
+      int objBufLen,
+      int commitNumber) {
+    mSurfaceId = surfaceId;
+    mCommitNumber = commitNumber;
+
+    mIntBuffer = intBuf.asIntBuffer();
+    mObjBuffer = objBuf;
+
+    mIntBufferLen = intBufLen;
+    mObjBufferLen = objBufLen;
+
+    mPooledIntBuffer = intBuf;
+
+    if (ReactFeatureFlags.enableBackgroundPropsImport) {
+      importProps();
+    }
+  }
+
+  /**
+   * Imports the props of the batch from native memory in a single buffer each. Batches are created
+   * on the thread committing the shadow tree, so executing them on the UI thread then only decodes
+   * props from the buffers, without JNI calls.
+   */
+  private void importProps() {
+    for (int i = 0; i < mObjBufferLen; i++) {
+      if (mObjBuffer[i] instanceof ReadableNativeMap) {
+        mObjBuffer[i] = ((ReadableNativeMap) mObjBuffer[i]).toBufferedMap();
+      }
+    }
+  }
+
+  private void releasePooledBuffers() {
+    if (mPooledIntBuffer == null || mIsReleased) {
+      return;
+    }
+    mIsReleased = true;
+    MountBufferPool.release(mPooledIntBuffer, mObjBuffer, mObjBufferLen);
+  }
+
+  private static @Nullable ReadableMap castToProps(@Nullable Object props) {
+    if (ReactFeatureFlags.enableBufferedPropsImport && props instanceof ReadableNativeMap) {
+      return ((ReadableNativeMap) props).toBufferedMap();
+    }
+    return (ReadableMap) props;
   }
 
   private void beginMarkers(String reason) {
@@ -98,10 +166,12 @@ final class IntBufferBatchMountItem implements BatchMountItem {
           TAG,
           "Skipping batch of MountItems; no SurfaceMountingManager found for [%d].",
           mSurfaceId);
+      releasePooledBuffers();
       return;
     }
     if (surfaceMountingManager.isStopped()) {
       FLog.e(TAG, "Skipping batch of MountItems; was stopped [%d].", mSurfaceId);
+      releasePooledBuffers();
       return;
     }
     if (ENABLE_FABRIC_LOGS) {
@@ -112,55 +182,60 @@ final class IntBufferBatchMountItem implements BatchMountItem {
 
     int i = 0, j = 0;
     while (i < mIntBufferLen) {
-      int rawType = mIntBuffer[i++];
+      int rawType = mIntBuffer.get(i++);
       int type = rawType & ~INSTRUCTION_FLAG_MULTIPLE;
-      int numInstructions = ((rawType & INSTRUCTION_FLAG_MULTIPLE) != 0 ? mIntBuffer[i++] : 1);
+      int numInstructions = ((rawType & INSTRUCTION_FLAG_MULTIPLE) != 0 ? mIntBuffer.get(i++) : 1);
       for (int k = 0; k < numInstructions; k++) {
         if (type == INSTRUCTION_CREATE) {
           String componentName = getFabricComponentName((String) mObjBuffer[j++]);
           surfaceMountingManager.createView(
               componentName,
-              mIntBuffer[i++],
-              (ReadableMap) mObjBuffer[j++],
+              mIntBuffer.get(i++),
+              castToProps(mObjBuffer[j++]),
               (StateWrapper) mObjBuffer[j++],
               (EventEmitterWrapper) mObjBuffer[j++],
-              mIntBuffer[i++] == 1);
+              mIntBuffer.get(i++) == 1);
         } else if (type == INSTRUCTION_DELETE) {
-          surfaceMountingManager.deleteView(mIntBuffer[i++]);
+          surfaceMountingManager.deleteView(mIntBuffer.get(i++));
         } else if (type == INSTRUCTION_INSERT) {
-          int tag = mIntBuffer[i++];
-          int parentTag = mIntBuffer[i++];
-          surfaceMountingManager.addViewAt(parentTag, tag, mIntBuffer[i++]);
+          int tag = mIntBuffer.get(i++);
+          int parentTag = mIntBuffer.get(i++);
+          surfaceMountingManager.addViewAt(parentTag, tag, mIntBuffer.get(i++));
         } else if (type == INSTRUCTION_REMOVE) {
-          surfaceMountingManager.removeViewAt(mIntBuffer[i++], mIntBuffer[i++], mIntBuffer[i++]);
+          surfaceMountingManager.removeViewAt(
+              mIntBuffer.get(i++), mIntBuffer.get(i++), mIntBuffer.get(i++));
         } else if (type == INSTRUCTION_REMOVE_DELETE_TREE) {
           surfaceMountingManager.removeDeleteTreeAt(
-              mIntBuffer[i++], mIntBuffer[i++], mIntBuffer[i++]);
+              mIntBuffer.get(i++), mIntBuffer.get(i++), mIntBuffer.get(i++));
         } else if (type == INSTRUCTION_UPDATE_PROPS) {
-          surfaceMountingManager.updateProps(mIntBuffer[i++], (ReadableMap) mObjBuffer[j++]);
+          surfaceMountingManager.updateProps(mIntBuffer.get(i++), castToProps(mObjBuffer[j++]));
         } else if (type == INSTRUCTION_UPDATE_STATE) {
-          surfaceMountingManager.updateState(mIntBuffer[i++], (StateWrapper) mObjBuffer[j++]);
+          surfaceMountingManager.updateState(mIntBuffer.get(i++), (StateWrapper) mObjBuffer[j++]);
         } else if (type == INSTRUCTION_UPDATE_LAYOUT) {
-          int reactTag = mIntBuffer[i++];
-          int parentTag = mIntBuffer[i++];
-          int x = mIntBuffer[i++];
-          int y = mIntBuffer[i++];
-          int width = mIntBuffer[i++];
-          int height = mIntBuffer[i++];
-          int displayType = mIntBuffer[i++];
+          int reactTag = mIntBuffer.get(i++);
+          int parentTag = mIntBuffer.get(i++);
+          int x = mIntBuffer.get(i++);
+          int y = mIntBuffer.get(i++);
+          int width = mIntBuffer.get(i++);
+          int height = mIntBuffer.get(i++);
+          int displayType = mIntBuffer.get(i++);
 
           surfaceMountingManager.updateLayout(
               reactTag, parentTag, x, y, width, height, displayType);
 
         } else if (type == INSTRUCTION_UPDATE_PADDING) {
           surfaceMountingManager.updatePadding(
-              mIntBuffer[i++], mIntBuffer[i++], mIntBuffer[i++], mIntBuffer[i++], mIntBuffer[i++]);
+              mIntBuffer.get(i++),
+              mIntBuffer.get(i++),
+              mIntBuffer.get(i++),
+              mIntBuffer.get(i++),
+              mIntBuffer.get(i++));
         } else if (type == INSTRUCTION_UPDATE_OVERFLOW_INSET) {
-          int reactTag = mIntBuffer[i++];
-          int overflowInsetLeft = mIntBuffer[i++];
-          int overflowInsetTop = mIntBuffer[i++];
-          int overflowInsetRight = mIntBuffer[i++];
-          int overflowInsetBottom = mIntBuffer[i++];
+          int reactTag = mIntBuffer.get(i++);
+          int overflowInsetLeft = mIntBuffer.get(i++);
+          int overflowInsetTop = mIntBuffer.get(i++);
+          int overflowInsetRight = mIntBuffer.get(i++);
+          int overflowInsetBottom = mIntBuffer.get(i++);
 
           surfaceMountingManager.updateOverflowInset(
               reactTag,
@@ -170,7 +245,7 @@ final class IntBufferBatchMountItem implements BatchMountItem {
               overflowInsetBottom);
         } else if (type == INSTRUCTION_UPDATE_EVENT_EMITTER) {
           surfaceMountingManager.updateEventEmitter(
-              mIntBuffer[i++], (EventEmitterWrapper) mObjBuffer[j++]);
+              mIntBuffer.get(i++), (EventEmitterWrapper) mObjBuffer[j++]);
         } else {
           throw new IllegalArgumentException(
               "Invalid type argument to IntBufferBatchMountItem: " + type + " at index: " + i);
@@ -179,6 +254,9 @@ final class IntBufferBatchMountItem implements BatchMountItem {
     }
 
     endMarkers();
+
+    // Buffers are not released if execution throws, so the batch can still be printed.
+    releasePooledBuffers();
   }
 
   @Override
@@ -193,14 +271,18 @@ final class IntBufferBatchMountItem implements BatchMountItem {
 
   @Override
   public String toString() {
+    if (mIsReleased) {
+      return String.format("IntBufferBatchMountItem [surface:%d]: <executed>", mSurfaceId);
+    }
     try {
       StringBuilder s = new StringBuilder();
       s.append(String.format("IntBufferBatchMountItem [surface:%d]:\n", mSurfaceId));
       int i = 0, j = 0;
       while (i < mIntBufferLen) {
-        int rawType = mIntBuffer[i++];
+        int rawType = mIntBuffer.get(i++);
         int type = rawType & ~INSTRUCTION_FLAG_MULTIPLE;
-        int numInstructions = ((rawType & INSTRUCTION_FLAG_MULTIPLE) != 0 ? mIntBuffer[i++] : 1);
+        int numInstructions =
+            ((rawType & INSTRUCTION_FLAG_MULTIPLE) != 0 ? mIntBuffer.get(i++) : 1);
         for (int k = 0; k < numInstructions; k++) {
           if (type == INSTRUCTION_CREATE) {
             String componentName = getFabricComponentName((String) mObjBuffer[j++]);
@@ -208,70 +290,76 @@ final class IntBufferBatchMountItem implements BatchMountItem {
             s.append(
                 String.format(
                     "CREATE [%d] - layoutable:%d - %s\n",
-                    mIntBuffer[i++], mIntBuffer[i++], componentName));
+                    mIntBuffer.get(i++), mIntBuffer.get(i++), componentName));
           } else if (type == INSTRUCTION_DELETE) {
-            s.append(String.format("DELETE [%d]\n", mIntBuffer[i++]));
+            s.append(String.format("DELETE [%d]\n", mIntBuffer.get(i++)));
           } else if (type == INSTRUCTION_INSERT) {
             s.append(
                 String.format(
-                    "INSERT [%d]->[%d] @%d\n", mIntBuffer[i++], mIntBuffer[i++], mIntBuffer[i++]));
+                    "INSERT [%d]->[%d] @%d\n",
+                    mIntBuffer.get(i++),
+                    mIntBuffer.get(i++),
+                    mIntBuffer.get(i++)));
           } else if (type == INSTRUCTION_REMOVE) {
             s.append(
                 String.format(
-                    "REMOVE [%d]->[%d] @%d\n", mIntBuffer[i++], mIntBuffer[i++], mIntBuffer[i++]));
+                    "REMOVE [%d]->[%d] @%d\n",
+                    mIntBuffer.get(i++),
+                    mIntBuffer.get(i++),
+                    mIntBuffer.get(i++)));
           } else if (type == INSTRUCTION_REMOVE_DELETE_TREE) {
             s.append(
                 String.format(
                     "REMOVE+DELETE TREE [%d]->[%d] @%d\n",
-                    mIntBuffer[i++], mIntBuffer[i++], mIntBuffer[i++]));
+                    mIntBuffer.get(i++), mIntBuffer.get(i++), mIntBuffer.get(i++)));
           } else if (type == INSTRUCTION_UPDATE_PROPS) {
             Object props = mObjBuffer[j++];
             String propsString =
                 IS_DEVELOPMENT_ENVIRONMENT
                     ? (props != null ? props.toString() : "<null>")
                     : "<hidden>";
-            s.append(String.format("UPDATE PROPS [%d]: %s\n", mIntBuffer[i++], propsString));
+            s.append(String.format("UPDATE PROPS [%d]: %s\n", mIntBuffer.get(i++), propsString));
           } else if (type == INSTRUCTION_UPDATE_STATE) {
             StateWrapper state = (StateWrapper) mObjBuffer[j++];
             String stateString =
                 IS_DEVELOPMENT_ENVIRONMENT
                     ? (state != null ? state.toString() : "<null>")
                     : "<hidden>";
-            s.append(String.format("UPDATE STATE [%d]: %s\n", mIntBuffer[i++], stateString));
+            s.append(String.format("UPDATE STATE [%d]: %s\n", mIntBuffer.get(i++), stateString));
           } else if (type == INSTRUCTION_UPDATE_LAYOUT) {
-            int reactTag = mIntBuffer[i++];
-            int parentTag = mIntBuffer[i++];
+            int reactTag = mIntBuffer.get(i++);
+            int parentTag = mIntBuffer.get(i++);
             s.append(
                 String.format(
                     "UPDATE LAYOUT [%d]->[%d]: x:%d y:%d w:%d h:%d displayType:%d\n",
                     parentTag,
                     reactTag,
-                    mIntBuffer[i++],
-                    mIntBuffer[i++],
-                    mIntBuffer[i++],
-                    mIntBuffer[i++],
-                    mIntBuffer[i++]));
+                    mIntBuffer.get(i++),
+                    mIntBuffer.get(i++),
+                    mIntBuffer.get(i++),
+                    mIntBuffer.get(i++),
+                    mIntBuffer.get(i++)));
           } else if (type == INSTRUCTION_UPDATE_PADDING) {
             s.append(
                 String.format(
                     "UPDATE PADDING [%d]: top:%d right:%d bottom:%d left:%d\n",
-                    mIntBuffer[i++],
-                    mIntBuffer[i++],
-                    mIntBuffer[i++],
-                    mIntBuffer[i++],
-                    mIntBuffer[i++]));
+                    mIntBuffer.get(i++),
+                    mIntBuffer.get(i++),
+                    mIntBuffer.get(i++),
+                    mIntBuffer.get(i++),
+                    mIntBuffer.get(i++)));
           } else if (type == INSTRUCTION_UPDATE_OVERFLOW_INSET) {
             s.append(
                 String.format(
                     "UPDATE OVERFLOWINSET [%d]: left:%d top:%d right:%d bottom:%d\n",
-                    mIntBuffer[i++],
-                    mIntBuffer[i++],
-                    mIntBuffer[i++],
-                    mIntBuffer[i++],
-                    mIntBuffer[i++]));
+                    mIntBuffer.get(i++),
+                    mIntBuffer.get(i++),
+                    mIntBuffer.get(i++),
+                    mIntBuffer.get(i++),
+                    mIntBuffer.get(i++)));
           } else if (type == INSTRUCTION_UPDATE_EVENT_EMITTER) {
             j += 1;
-            s.append(String.format("UPDATE EVENTEMITTER [%d]\n", mIntBuffer[i++]));
+            s.append(String.format("UPDATE EVENTEMITTER [%d]\n", mIntBuffer.get(i++)));
           } else {
             FLog.e(TAG, "String so far: " + s.toString());
             throw new IllegalArgumentException(
@@ -288,7 +376,7 @@ final class IntBufferBatchMountItem implements BatchMountItem {
 
       StringBuilder ss = new StringBuilder();
       for (int ii = 0; ii < mIntBufferLen; ii++) {
-        ss.append(mIntBuffer[ii]);
+        ss.append(mIntBuffer.get(ii));
         ss.append(", ");
       }
       FLog.e(TAG, ss.toString());
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+package com.facebook.react.fabric.mounting.mountitems;
+
+import androidx.annotation.Nullable;
+import com.facebook.infer.annotation.Nullsafe;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.ArrayDeque;
+import java.util.Arrays;
+import java.util.Iterator;
+
+/**
+ * Pool of the buffers that the C++ mounting layer serializes {@link IntBufferBatchMountItem}s
+ * into when pooled mount buffers are enabled.
+ *
+ * <p>Int buffers are direct {@link ByteBuffer}s, so C++ writes into their memory without any JNI
+ * copies and {@link IntBufferBatchMountItem} reads from them in place. Buffers are handed back to
+ * the pool once their batch is executed and grow geometrically, so in steady state mounting does
+ * not allocate.
+ */
+@Nullsafe(Nullsafe.Mode.LOCAL)
+final class MountBufferPool {
+
+  private static final int BYTES_PER_INT = 4;
+  private static final int MINIMUM_CAPACITY = 256;
+  private static final int MAXIMUM_POOLED_BUFFER_COUNT = 4;
+
+  private static final ArrayDeque<ByteBuffer> sIntBuffers = new ArrayDeque<>();
+  private static final ArrayDeque<Object[]> sObjectBuffers = new ArrayDeque<>();
+
+  private MountBufferPool() {}
+
+  /** @return a direct, native-ordered buffer that fits at least {@code size} ints. */
+  static ByteBuffer obtainIntBuffer(int size) {
+    synchronized (sIntBuffers) {
+      Iterator<ByteBuffer> iterator = sIntBuffers.iterator();
+      while (iterator.hasNext()) {
+        ByteBuffer buffer = iterator.next();
+        if (buffer.capacity() >= size * BYTES_PER_INT) {
+          iterator.remove();
+          return buffer;
+        }
+      }
+    }
+    return ByteBuffer.allocateDirect(getCapacity(size) * BYTES_PER_INT)
+        .order(ByteOrder.nativeOrder());
+  }
+
+  /** @return an array that fits at least {@code size} objects; all its elements are null. */
+  static Object[] obtainObjectBuffer(int size) {
+    synchronized (sObjectBuffers) {
+      Iterator<Object[]> iterator = sObjectBuffers.iterator();
+      while (iterator.hasNext()) {
+        Object[] buffer = iterator.next();
+        if (buffer.length >= size) {
+          iterator.remove();
+          return buffer;
+        }
+      }
+    }
+    return new Object[getCapacity(size)];
+  }
+
+  /**
+   * Returns buffers obtained from the pool. The first {@code objectBufferLength} elements of the
+   * object buffer are cleared so the pool does not retain props, state or event emitters.
+   */
+  static void release(
+      ByteBuffer intBuffer, @Nullable Object[] objectBuffer, int objectBufferLength) {
+    synchronized (sIntBuffers) {
+      offer(sIntBuffers, intBuffer);
+    }
+    if (objectBuffer != null) {
+      Arrays.fill(objectBuffer, 0, objectBufferLength, null);
+      synchronized (sObjectBuffers) {
+        offer(sObjectBuffers, objectBuffer);
+      }
+    }
+  }
+
+  private static <T> void offer(ArrayDeque<T> buffers, T buffer) {
+    if (buffers.size() >= MAXIMUM_POOLED_BUFFER_COUNT) {
+      // Dropping the oldest buffer; recently used sizes are the most likely to be requested again.
+      buffers.pollFirst();
+    }
+    buffers.addLast(buffer);
+  }
+
+  private static int getCapacity(int size) {
+    int capacity = MINIMUM_CAPACITY;
+    while (capacity < size) {
+      capacity *= 2;
+    }
+    return capacity;
+  }
+}
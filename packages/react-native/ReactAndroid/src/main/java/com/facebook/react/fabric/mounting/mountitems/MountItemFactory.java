@@ -14,6 +14,7 @@ import com.facebook.react.bridge.ReadableArray;
 import com.facebook.react.bridge.ReadableMap;
 import com.facebook.react.fabric.events.EventEmitterWrapper;
 import com.facebook.react.uimanager.StateWrapper;
+import java.nio.ByteBuffer;
 
 /** Factory class that expose creation of {@link MountItem} */
 @Nullsafe(Nullsafe.Mode.LOCAL)
@@ -49,6 +50,13 @@ public class MountItemFactory {
     return new PreAllocateViewMountItem(
         surfaceId, reactTag, component, props, stateWrapper, eventEmitterWrapper, isLayoutable);
   }
+
+  /** @return a {@link MountItem} that will be used to create views ahead of time for recycling */
+  public static MountItem createPrewarmViewsMountItem(
+      int surfaceId, @NonNull String component, int count) {
+    return new PrewarmViewsMountItem(surfaceId, component, count);
+  }
+
   /**
    * @return a {@link MountItem} that will be read and execute a collection of MountItems serialized
    *     in the int[] and Object[] received by parameter
@@ -57,4 +65,30 @@ public class MountItemFactory {
       int surfaceId, int[] intBuf, Object[] objBuf, int commitNumber) {
     return new IntBufferBatchMountItem(surfaceId, intBuf, objBuf, commitNumber);
   }
+
+  /**
+   * @return a {@link MountItem} that will be read and execute a collection of MountItems serialized
+   *     in the buffers obtained from {@link #obtainMountIntBuffer} and {@link
+   *     #obtainMountObjectBuffer}. The buffers are returned to the pool once the item is executed.
+   */
+  public static MountItem createPooledIntBufferBatchMountItem(
+      int surfaceId,
+      ByteBuffer intBuf,
+      int intBufLen,
+      Object[] objBuf,
+      int objBufLen,
+      int commitNumber) {
+    return new IntBufferBatchMountItem(
+        surfaceId, intBuf, intBufLen, objBuf, objBufLen, commitNumber);
+  }
+
+  /** @return a direct, native-ordered buffer that fits at least {@code size} ints */
+  public static ByteBuffer obtainMountIntBuffer(int size) {
+    return MountBufferPool.obtainIntBuffer(size);
+  }
+
+  /** @return an array of nulls that fits at least {@code size} objects */
+  public static Object[] obtainMountObjectBuffer(int size) {
+    return MountBufferPool.obtainObjectBuffer(size);
+  }
 }
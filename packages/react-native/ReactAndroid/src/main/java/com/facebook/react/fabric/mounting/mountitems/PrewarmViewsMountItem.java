@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+package com.facebook.react.fabric.mounting.mountitems;
+
+import static com.facebook.react.fabric.FabricUIManager.TAG;
+import static com.facebook.react.fabric.mounting.mountitems.FabricNameComponentMapping.getFabricComponentName;
+
+import androidx.annotation.NonNull;
+import com.facebook.common.logging.FLog;
+import com.facebook.infer.annotation.Nullsafe;
+import com.facebook.react.fabric.mounting.MountingManager;
+import com.facebook.react.fabric.mounting.SurfaceMountingManager;
+
+/** {@link MountItem} that is used to create views ahead of time for recycling. */
+@Nullsafe(Nullsafe.Mode.LOCAL)
+final class PrewarmViewsMountItem implements MountItem {
+
+  private final @NonNull String mComponent;
+  private final int mSurfaceId;
+  private final int mCount;
+
+  PrewarmViewsMountItem(int surfaceId, @NonNull String component, int count) {
+    mComponent = getFabricComponentName(component);
+    mSurfaceId = surfaceId;
+    mCount = count;
+  }
+
+  @Override
+  public int getSurfaceId() {
+    return mSurfaceId;
+  }
+
+  @Override
+  public void execute(@NonNull MountingManager mountingManager) {
+    SurfaceMountingManager surfaceMountingManager = mountingManager.getSurfaceManager(mSurfaceId);
+    if (surfaceMountingManager == null) {
+      FLog.e(
+          TAG,
+          "Skipping View Prewarming; no SurfaceMountingManager found for [" + mSurfaceId + "]");
+      return;
+    }
+    surfaceMountingManager.prewarmViews(mComponent, mCount);
+  }
+
+  @Override
+  @NonNull
+  public String toString() {
+    return "PrewarmViewsMountItem - component: "
+        + mComponent
+        + " surfaceId: "
+        + mSurfaceId
+        + " count: "
+        + mCount;
+  }
+}
@@ -7,6 +7,8 @@
 
 package com.facebook.react.runtime;
 
+import android.content.pm.PackageInfo;
+import android.content.pm.PackageManager;
 import android.content.res.AssetManager;
 import android.view.View;
 import com.facebook.common.logging.FLog;
@@ -65,6 +67,7 @@ import com.facebook.react.uimanager.ViewManagerResolver;
 import com.facebook.react.uimanager.events.EventDispatcher;
 import com.facebook.soloader.SoLoader;
 import com.facebook.systrace.Systrace;
+import java.io.File;
 import java.util.ArrayList;
 import java.util.Collection;
 import java.util.HashMap;
@@ -248,6 +251,7 @@ final class ReactInstance {
     // This happens inside getTurboModuleManagerDelegate getter.
     if (ReactFeatureFlags.useNativeViewConfigsInBridgelessMode) {
       Map<String, Object> customDirectEvents = new HashMap<>();
+      String viewConfigCacheConfiguration = getNativeViewConfigCacheConfiguration();
 
       mUIConstantsProviderManager =
           new UIConstantsProviderManager(
@@ -273,6 +277,13 @@ final class ReactInstance {
                     UIManagerModule.getConstantsForViewManager(viewManager, customDirectEvents);
               },
               () -> {
+                if (ReactFeatureFlags.enableLazyNativeViewConfigsInBridgelessMode) {
+                  // View configs are generated on first use, through
+                  // UIManager.getConstantsForViewManager.
+                  return Arguments.makeNativeMap(
+                      UIManagerModuleConstantsHelper.createConstants(mViewManagerResolver));
+                }
+
                 List<ViewManager> viewManagers =
                     new ArrayList<ViewManager>(
                         mViewManagerResolver.getEagerViewManagerMap().values());
@@ -288,7 +299,12 @@ final class ReactInstance {
                 }
 
                 return Arguments.makeNativeMap(constants);
-              });
+              },
+              viewConfigCacheConfiguration != null
+                  ? new File(mBridgelessReactContext.getCacheDir(), "react-native-view-configs")
+                      .getAbsolutePath()
+                  : null,
+              viewConfigCacheConfiguration);
     }
 
     EventBeatManager eventBeatManager = new EventBeatManager();
@@ -452,6 +468,23 @@ final class ReactInstance {
     mJavaScriptContextHolder.clear();
   }
 
+  private @Nullable String getNativeViewConfigCacheConfiguration() {
+    if (!ReactFeatureFlags.enablePersistentNativeViewConfigsInBridgelessMode) {
+      return null;
+    }
+    // View configs only change with the native code of the app, which changes whenever the app is
+    // updated.
+    try {
+      PackageInfo packageInfo =
+          mBridgelessReactContext
+              .getPackageManager()
+              .getPackageInfo(mBridgelessReactContext.getPackageName(), 0);
+      return packageInfo.versionName + "/" + packageInfo.lastUpdateTime;
+    } catch (PackageManager.NameNotFoundException e) {
+      return null;
+    }
+  }
+
   /* --- Native methods --- */
 
   @DoNotStrip
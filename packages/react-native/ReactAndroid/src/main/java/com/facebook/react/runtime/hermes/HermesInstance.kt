@@ -13,13 +13,25 @@ import com.facebook.react.fabric.ReactNativeConfig
 import com.facebook.react.runtime.JSRuntimeFactory
 import com.facebook.soloader.SoLoader
 
-public class HermesInstance(reactNativeConfig: ReactNativeConfig?) :
-    JSRuntimeFactory(initHybrid(reactNativeConfig as Any?)) {
+/**
+ * @param bytecodeCacheDirectory when set, Hermes bytecode compiled from bundles loaded as source is
+ *   cached in this directory (which should be dedicated to it, e.g. in the cache directory of the
+ *   app), so the bundles are compiled once instead of on every launch.
+ */
+public class HermesInstance
+@JvmOverloads
+constructor(reactNativeConfig: ReactNativeConfig?, bytecodeCacheDirectory: String? = null) :
+    JSRuntimeFactory(initHybrid(reactNativeConfig as Any?, bytecodeCacheDirectory)) {
 
   public constructor() : this(null)
 
   public companion object {
-    @JvmStatic @DoNotStrip protected external fun initHybrid(reactNativeConfig: Any?): HybridData
+    @JvmStatic
+    @DoNotStrip
+    protected external fun initHybrid(
+        reactNativeConfig: Any?,
+        bytecodeCacheDirectory: String?
+    ): HybridData
 
     init {
       SoLoader.loadLibrary("hermesinstancejni")
@@ -10,6 +10,7 @@ package com.facebook.react.uimanager;
 import com.facebook.react.bridge.ReadableNativeMap;
 import com.facebook.react.bridge.WritableMap;
 import com.facebook.react.common.mapbuffer.ReadableMapBuffer;
+import com.facebook.react.common.mapbuffer.WritableMapBuffer;
 import javax.annotation.Nullable;
 
 /**
@@ -39,6 +40,14 @@ public interface StateWrapper {
    */
   void updateState(WritableMap map);
 
+  /**
+   * Pass a MapBuffer of values back to the C++ layer, which is cheaper to transfer than a map. The
+   * state in C++ must support being constructed from a MapBuffer.
+   *
+   * <p>Unstable API - DO NOT USE.
+   */
+  void updateState(WritableMapBuffer mapBuffer);
+
   /**
    * Mark state as unused and clean up in Java and in native. This should be called as early as
    * possible when you know a StateWrapper will no longer be used. If there's ANY chance of it being
@@ -31,12 +31,38 @@ public class UIConstantsProviderManager {
       DefaultEventTypesProvider defaultEventTypesProvider,
       ConstantsForViewManagerProvider viewManagerConstantsProvider,
       ConstantsProvider constantsProvider) {
+    this(
+        runtimeExecutor,
+        defaultEventTypesProvider,
+        viewManagerConstantsProvider,
+        constantsProvider,
+        null,
+        null);
+  }
+
+  /**
+   * @param viewConfigCachePath when set, view configs returned by {@code
+   *     viewManagerConstantsProvider} are kept in this file across launches, and the provider is
+   *     only called for view managers which were not used before.
+   * @param viewConfigCacheConfiguration identifies the native code of the app (e.g. its version
+   *     and the time it was installed); view configs kept for a different configuration are
+   *     discarded.
+   */
+  public UIConstantsProviderManager(
+      RuntimeExecutor runtimeExecutor,
+      DefaultEventTypesProvider defaultEventTypesProvider,
+      ConstantsForViewManagerProvider viewManagerConstantsProvider,
+      ConstantsProvider constantsProvider,
+      @Nullable String viewConfigCachePath,
+      @Nullable String viewConfigCacheConfiguration) {
     mHybridData =
         initHybrid(
             runtimeExecutor,
             defaultEventTypesProvider,
             viewManagerConstantsProvider,
-            constantsProvider);
+            constantsProvider,
+            viewConfigCachePath,
+            viewConfigCacheConfiguration);
     installJSIBindings();
   }
 
@@ -44,7 +70,9 @@ public class UIConstantsProviderManager {
       RuntimeExecutor runtimeExecutor,
       DefaultEventTypesProvider defaultEventTypesProvider,
       ConstantsForViewManagerProvider viewManagerConstantsProvider,
-      ConstantsProvider constantsProvider);
+      ConstantsProvider constantsProvider,
+      @Nullable String viewConfigCachePath,
+      @Nullable String viewConfigCacheConfiguration);
 
   private native void installJSIBindings();
 
@@ -36,7 +36,7 @@ public class UIManagerModuleConstantsHelper {
    * UIManager.getViewManagerConfig('SpecificViewManager')} call happens. The View Manager is then
    * registered on the JS side with the help of {@code UIManagerModule.getConstantsForViewManager}.
    */
-  /* package */ static Map<String, Object> createConstants(ViewManagerResolver resolver) {
+  public static Map<String, Object> createConstants(ViewManagerResolver resolver) {
     Map<String, Object> constants = UIManagerModuleConstants.getConstants();
     constants.put("ViewManagerNames", new ArrayList<>(resolver.getViewManagerNames()));
     constants.put("LazyViewManagersEnabled", true);
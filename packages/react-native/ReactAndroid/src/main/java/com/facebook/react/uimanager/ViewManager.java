@@ -222,6 +222,21 @@ public abstract class ViewManager<T extends View, C extends ReactShadowNode>
     }
   }
 
+  /**
+   * Creates views until {@code count} views are kept for recycling on the surface of the context,
+   * so that views created later during mounting (e.g. while scrolling through a list) don't need to
+   * be constructed. This is a no-op if View Recycling is disabled for this ViewManager.
+   */
+  public void prewarmViews(@NonNull ThemedReactContext reactContext, int count) {
+    @Nullable Stack<T> recyclableViews = getRecyclableViewStack(reactContext.getSurfaceId());
+    if (recyclableViews == null) {
+      return;
+    }
+    while (recyclableViews.size() < count) {
+      recyclableViews.push(prepareToRecycleView(reactContext, createViewInstance(reactContext)));
+    }
+  }
+
   /**
    * Called when a View is removed from the hierarchy. This should be used to reset any properties.
    */
@@ -11,6 +11,7 @@ import android.animation.Animator;
 import android.animation.ValueAnimator;
 import android.content.Context;
 import android.graphics.Point;
+import android.os.SystemClock;
 import android.view.View;
 import android.view.ViewGroup;
 import android.widget.OverScroller;
@@ -23,6 +24,9 @@ import com.facebook.react.bridge.WritableMap;
 import com.facebook.react.bridge.WritableNativeMap;
 import com.facebook.react.common.ReactConstants;
 import com.facebook.react.common.build.ReactBuildConfig;
+import com.facebook.react.common.mapbuffer.ReadableMapBuffer;
+import com.facebook.react.common.mapbuffer.WritableMapBuffer;
+import com.facebook.react.config.ReactFeatureFlags;
 import com.facebook.react.uimanager.PixelUtil;
 import com.facebook.react.uimanager.StateWrapper;
 import com.facebook.react.uimanager.UIManagerHelper;
@@ -42,6 +46,12 @@ public class ReactScrollViewHelper {
   private static final String CONTENT_OFFSET_TOP = "contentOffsetTop";
   private static final String SCROLL_AWAY_PADDING_TOP = "scrollAwayPaddingTop";
 
+  // Keys of the state when it is serialized as a MapBuffer, see ScrollViewState.h
+  private static final int SCROLL_STATE_KEY_CONTENT_OFFSET_LEFT = 0;
+  private static final int SCROLL_STATE_KEY_CONTENT_OFFSET_TOP = 1;
+  private static final int SCROLL_STATE_KEY_SCROLL_AWAY_PADDING_TOP = 2;
+  private static final int SCROLL_STATE_KEY_UPDATE_INTERVAL_WHILE_SCROLLING = 3;
+
   public static final long MOMENTUM_DELAY = 20;
   public static final String OVER_SCROLL_ALWAYS = "always";
   public static final String AUTO = "auto";
@@ -254,6 +264,7 @@ public class ReactScrollViewHelper {
     private final Point mFinalAnimatedPositionScroll = new Point();
     private int mScrollAwayPaddingTop = 0;
     private final Point mLastStateUpdateScroll = new Point(-1, -1);
+    private long mLastStateUpdateTime = 0;
     private boolean mIsCanceled = false;
     private boolean mIsFinished = true;
     private float mDecelerationRate = 0.985f;
@@ -294,6 +305,17 @@ public class ReactScrollViewHelper {
       return this;
     }
 
+    /** Get the time (in {@link SystemClock#uptimeMillis()}) of the last Fabric state update */
+    public long getLastStateUpdateTime() {
+      return mLastStateUpdateTime;
+    }
+
+    /** Set the time (in {@link SystemClock#uptimeMillis()}) of the last Fabric state update */
+    public ReactScrollViewScrollState setLastStateUpdateTime(long lastStateUpdateTime) {
+      mLastStateUpdateTime = lastStateUpdateTime;
+      return this;
+    }
+
     /** Get the padding on the top for nav bar */
     public int getScrollAwayPaddingTop() {
       return mScrollAwayPaddingTop;
@@ -459,8 +481,17 @@ public class ReactScrollViewHelper {
           fabricScrollX);
     }
 
+    scrollState.setLastStateUpdateTime(SystemClock.uptimeMillis());
     StateWrapper stateWrapper = scrollView.getStateWrapper();
-    if (stateWrapper != null) {
+    if (stateWrapper != null && ReactFeatureFlags.enableMapBufferStateUpdates) {
+      stateWrapper.updateState(
+          new WritableMapBuffer()
+              .put(SCROLL_STATE_KEY_CONTENT_OFFSET_LEFT, PixelUtil.toDIPFromPixel(scrollX))
+              .put(SCROLL_STATE_KEY_CONTENT_OFFSET_TOP, PixelUtil.toDIPFromPixel(scrollY))
+              .put(
+                  SCROLL_STATE_KEY_SCROLL_AWAY_PADDING_TOP,
+                  PixelUtil.toDIPFromPixel(scrollAwayPaddingTop)));
+    } else if (stateWrapper != null) {
       WritableMap newStateData = new WritableNativeMap();
       newStateData.putDouble(CONTENT_OFFSET_LEFT, PixelUtil.toDIPFromPixel(scrollX));
       newStateData.putDouble(CONTENT_OFFSET_TOP, PixelUtil.toDIPFromPixel(scrollY));
@@ -480,10 +511,38 @@ public class ReactScrollViewHelper {
     // when JS processes the scroll event, the C++ ShadowNode representation will have a
     // "more correct" scroll position. It will frequently be /incorrect/ but this decreases
     // the error as much as possible.
-    updateFabricScrollState(scrollView);
+    if (!ReactFeatureFlags.enableThrottledScrollViewStateUpdates
+        || shouldUpdateStateWhileScrolling(scrollView)) {
+      updateFabricScrollState(scrollView);
+    }
     emitScrollEvent(scrollView, xVelocity, yVelocity);
   }
 
+  /**
+   * Whether the scroll position should be sent to Fabric while the ScrollView is scrolling, rather
+   * than only once scrolling ends. C++ only needs it in between when it reads the content offset
+   * of the ScrollView (e.g. to measure views or compute intersections), and at most as often as it
+   * reports in the state (see ScrollViewShadowNode::getStateUpdateIntervalWhileScrolling).
+   */
+  private static <T extends ViewGroup & HasStateWrapper & HasScrollState>
+      boolean shouldUpdateStateWhileScrolling(final T scrollView) {
+    StateWrapper stateWrapper = scrollView.getStateWrapper();
+    if (stateWrapper == null) {
+      return false;
+    }
+
+    ReadableMapBuffer stateData = stateWrapper.getStateDataMapBuffer();
+    if (stateData == null || !stateData.contains(SCROLL_STATE_KEY_UPDATE_INTERVAL_WHILE_SCROLLING)) {
+      return true;
+    }
+
+    double interval = stateData.getDouble(SCROLL_STATE_KEY_UPDATE_INTERVAL_WHILE_SCROLLING);
+    long timeSinceLastUpdate =
+        SystemClock.uptimeMillis()
+            - scrollView.getReactScrollViewScrollState().getLastStateUpdateTime();
+    return interval >= 0 && timeSinceLastUpdate >= interval;
+  }
+
   public static <T extends ViewGroup & HasStateWrapper & HasScrollState & HasFlingAnimator>
       void registerFlingAnimator(final T scrollView) {
     scrollView
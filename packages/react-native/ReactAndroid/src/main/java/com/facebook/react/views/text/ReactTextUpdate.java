@@ -27,6 +27,8 @@ public class ReactTextUpdate {
   private final int mTextAlign;
   private final int mTextBreakStrategy;
   private final int mJustificationMode;
+  private int mEditStart = -1;
+  private int mEditEnd = -1;
 
   /**
    * @deprecated Use a non-deprecated constructor for ReactTextUpdate instead. This one remains
@@ -111,6 +113,26 @@ public class ReactTextUpdate {
     return reactTextUpdate;
   }
 
+  /**
+   * Builds an update from state which describes the range of the previous text replaced by the new
+   * text (see {@link #getEditStart()}).
+   */
+  public static ReactTextUpdate buildReactTextUpdateFromState(
+      Spannable text,
+      int jsEventCounter,
+      int textAlign,
+      int textBreakStrategy,
+      int justificationMode,
+      int editStart,
+      int editEnd) {
+    ReactTextUpdate reactTextUpdate =
+        buildReactTextUpdateFromState(
+            text, jsEventCounter, textAlign, textBreakStrategy, justificationMode);
+    reactTextUpdate.mEditStart = editStart;
+    reactTextUpdate.mEditEnd = editEnd;
+    return reactTextUpdate;
+  }
+
   public Spannable getText() {
     return mText;
   }
@@ -150,4 +172,17 @@ public class ReactTextUpdate {
   public int getJustificationMode() {
     return mJustificationMode;
   }
+
+  /**
+   * Start of the range of the previous text which was replaced to get the text of this update, or
+   * -1 if the update replaces the whole text. The text after the range is the same in both.
+   */
+  public int getEditStart() {
+    return mEditStart;
+  }
+
+  /** End of the range of the previous text replaced by this update, or -1. */
+  public int getEditEnd() {
+    return mEditEnd;
+  }
 }
@@ -48,6 +48,7 @@ import com.facebook.react.bridge.ReactContext;
 import com.facebook.react.bridge.ReactSoftExceptionLogger;
 import com.facebook.react.common.ReactConstants;
 import com.facebook.react.common.build.ReactBuildConfig;
+import com.facebook.react.config.ReactFeatureFlags;
 import com.facebook.react.uimanager.ReactAccessibilityDelegate;
 import com.facebook.react.uimanager.StateWrapper;
 import com.facebook.react.uimanager.UIManagerModule;
@@ -677,7 +678,7 @@ public class ReactEditText extends AppCompatEditText {
     // text so, we have to set text to null, which will clear the currently composing text.
     if (reactTextUpdate.getText().length() == 0) {
       setText(null);
-    } else {
+    } else if (!maybeReplaceEditedRange(reactTextUpdate, spannableStringBuilder)) {
       // When we update text, we trigger onChangeText code that will
       // try to update state if the wrapper is available. Temporarily disable
       // to prevent an infinite loop.
@@ -693,6 +694,49 @@ public class ReactEditText extends AppCompatEditText {
     updateCachedSpannable();
   }
 
+  /**
+   * Replaces only the range of the current text edited by the update (if it describes one), so
+   * that the layout of the rest of the text (e.g. the other paragraphs of a multiline input) is
+   * kept. Returns false if the text around that range doesn't match the update, e.g. because the
+   * text was changed since the update was computed.
+   */
+  private boolean maybeReplaceEditedRange(
+      ReactTextUpdate reactTextUpdate, SpannableStringBuilder spannableStringBuilder) {
+    Editable text = getText();
+    int editStart = reactTextUpdate.getEditStart();
+    int editEnd = reactTextUpdate.getEditEnd();
+    if (!ReactFeatureFlags.enableIncrementalTextInputUpdates
+        || editStart < 0
+        || editEnd < editStart
+        || editEnd > text.length()) {
+      return false;
+    }
+
+    int suffixLength = text.length() - editEnd;
+    int newEditEnd = spannableStringBuilder.length() - suffixLength;
+    if (newEditEnd < editStart
+        || !TextUtils.regionMatches(text, 0, spannableStringBuilder, 0, editStart)
+        || !TextUtils.regionMatches(
+            text, editEnd, spannableStringBuilder, newEditEnd, suffixLength)) {
+      return false;
+    }
+
+    text.replace(editStart, editEnd, spannableStringBuilder, editStart, newEditEnd);
+
+    // `replace` only copies the spans within the edited range, and the styling spans of the
+    // current text were removed by `manageSpans`.
+    Object[] spans =
+        spannableStringBuilder.getSpans(0, spannableStringBuilder.length(), Object.class);
+    for (Object span : spans) {
+      text.setSpan(
+          span,
+          spannableStringBuilder.getSpanStart(span),
+          spannableStringBuilder.getSpanEnd(span),
+          spannableStringBuilder.getSpanFlags(span));
+    }
+    return true;
+  }
+
   /**
    * Remove and/or add {@link Spanned.SPAN_EXCLUSIVE_EXCLUSIVE} spans, since they should only exist
    * as long as the text they cover is the same. All other spans will remain the same, since they
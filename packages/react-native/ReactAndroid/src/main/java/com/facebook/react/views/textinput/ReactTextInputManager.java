@@ -46,6 +46,8 @@ import com.facebook.react.bridge.WritableNativeMap;
 import com.facebook.react.common.MapBuilder;
 import com.facebook.react.common.ReactConstants;
 import com.facebook.react.common.mapbuffer.MapBuffer;
+import com.facebook.react.common.mapbuffer.WritableMapBuffer;
+import com.facebook.react.config.ReactFeatureFlags;
 import com.facebook.react.module.annotations.ReactModule;
 import com.facebook.react.uimanager.BaseViewManager;
 import com.facebook.react.uimanager.LayoutShadowNode;
@@ -91,6 +93,9 @@ public class ReactTextInputManager extends BaseViewManager<ReactEditText, Layout
   private static final short TX_STATE_KEY_PARAGRAPH_ATTRIBUTES = 1;
   private static final short TX_STATE_KEY_HASH = 2;
   private static final short TX_STATE_KEY_MOST_RECENT_EVENT_COUNT = 3;
+  private static final short TX_STATE_KEY_OPAQUE_CACHE_ID = 4;
+  private static final short TX_STATE_KEY_EDIT_START = 5;
+  private static final short TX_STATE_KEY_EDIT_END = 6;
 
   private static final int[] SPACING_TYPES = {
     Spacing.ALL, Spacing.LEFT, Spacing.RIGHT, Spacing.TOP, Spacing.BOTTOM,
@@ -1114,7 +1119,12 @@ public class ReactTextInputManager extends BaseViewManager<ReactEditText, Layout
 
       StateWrapper stateWrapper = mEditText.getStateWrapper();
 
-      if (stateWrapper != null) {
+      if (stateWrapper != null && ReactFeatureFlags.enableMapBufferStateUpdates) {
+        stateWrapper.updateState(
+            new WritableMapBuffer()
+                .put(TX_STATE_KEY_MOST_RECENT_EVENT_COUNT, mEditText.incrementAndGetEventCounter())
+                .put(TX_STATE_KEY_OPAQUE_CACHE_ID, mEditText.getId()));
+      } else if (stateWrapper != null) {
         WritableMap newStateData = new WritableNativeMap();
         newStateData.putInt("mostRecentEventCount", mEditText.incrementAndGetEventCounter());
         newStateData.putInt("opaqueCacheId", mEditText.getId());
@@ -1403,7 +1413,9 @@ public class ReactTextInputManager extends BaseViewManager<ReactEditText, Layout
         TextAttributeProps.getTextAlignment(
             props, TextLayoutManager.isRTL(attributedString), view.getGravityHorizontal()),
         textBreakStrategy,
-        TextAttributeProps.getJustificationMode(props, currentJustificationMode));
+        TextAttributeProps.getJustificationMode(props, currentJustificationMode),
+        state.hasKey("editStart") ? state.getInt("editStart") : -1,
+        state.hasKey("editEnd") ? state.getInt("editEnd") : -1);
   }
 
   public @Nullable Object getReactTextUpdate(
@@ -1433,6 +1445,8 @@ public class ReactTextInputManager extends BaseViewManager<ReactEditText, Layout
         TextAttributeProps.getTextAlignment(
             props, TextLayoutManagerMapBuffer.isRTL(attributedString), view.getGravityHorizontal()),
         textBreakStrategy,
-        TextAttributeProps.getJustificationMode(props, currentJustificationMode));
+        TextAttributeProps.getJustificationMode(props, currentJustificationMode),
+        state.contains(TX_STATE_KEY_EDIT_START) ? state.getInt(TX_STATE_KEY_EDIT_START) : -1,
+        state.contains(TX_STATE_KEY_EDIT_END) ? state.getInt(TX_STATE_KEY_EDIT_END) : -1);
   }
 }
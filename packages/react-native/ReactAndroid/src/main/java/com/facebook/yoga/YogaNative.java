@@ -9,6 +9,7 @@ package com.facebook.yoga;
 
 import com.facebook.yoga.annotations.DoNotStrip;
 import com.facebook.soloader.SoLoader;
+import java.nio.ByteBuffer;
 
 @DoNotStrip
 public class YogaNative {
@@ -111,6 +112,9 @@ public class YogaNative {
   static native void jni_YGNodeSetHasMeasureFuncJNI(long nativePointer, boolean hasMeasureFunc);
   static native void jni_YGNodeSetHasBaselineFuncJNI(long nativePointer, boolean hasMeasureFunc);
   static native void jni_YGNodeSetStyleInputsJNI(long nativePointer, float[] styleInputsArray, int size);
+  static native void jni_YGNodeSetStyleInputsBufferJNI(long nativePointer, ByteBuffer styleInputsBuffer, int size);
+  static native void jni_YGNodeSetChildrenTreeJNI(long[] nativePointers, int[] childCounts);
+  static native float[] jni_YGNodeGetLayoutOutputsJNI(long nativePointer);
   static native long jni_YGNodeCloneJNI(long nativePointer);
   static native void jni_YGNodeSetAlwaysFormsContainingBlockJNI(long nativePointer, boolean alwaysFormContainingBlock);
 }
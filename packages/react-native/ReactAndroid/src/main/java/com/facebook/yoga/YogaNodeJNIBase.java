@@ -8,6 +8,7 @@
 package com.facebook.yoga;
 
 import com.facebook.yoga.annotations.DoNotStrip;
+import java.nio.ByteBuffer;
 import java.util.ArrayList;
 import java.util.List;
 import javax.annotation.Nullable;
@@ -31,6 +32,9 @@ public abstract class YogaNodeJNIBase extends YogaNode implements Cloneable {
   private static final byte LAYOUT_PADDING_START_INDEX = 10;
   private static final byte LAYOUT_BORDER_START_INDEX = 14;
 
+  /* Needs to be in sync with LAYOUT_OUTPUTS_STRIDE in YGJNI.h */
+  public static final int LAYOUT_OUTPUTS_STRIDE = 5;
+
   @Nullable private YogaNodeJNIBase mOwner;
   @Nullable private List<YogaNodeJNIBase> mChildren;
   @Nullable private YogaMeasureFunction mMeasureFunction;
@@ -192,6 +196,73 @@ public abstract class YogaNodeJNIBase extends YogaNode implements Cloneable {
     return mChildren == null ? -1 : mChildren.indexOf(child);
   }
 
+  /**
+   * Applies style inputs packed as the ids in {@link YogaStyleInputs} followed by their arguments,
+   * in one call instead of one call per style property. Edge inputs take the edge and then the
+   * value, the *_AUTO inputs take no value and IS_REFERENCE_BASELINE takes 1 or 0.
+   */
+  public void setStyleInputs(float[] styleInputs, int size) {
+    YogaNative.jni_YGNodeSetStyleInputsJNI(mNativePointer, styleInputs, size);
+  }
+
+  /**
+   * Same as {@link #setStyleInputs(float[], int)}, but reads the floats in place from a direct
+   * buffer in native byte order, so that the inputs of many nodes can be written to one buffer.
+   */
+  public void setStyleInputs(ByteBuffer styleInputs, int size) {
+    if (!styleInputs.isDirect()) {
+      throw new IllegalArgumentException("Style inputs must be in a direct buffer");
+    }
+    YogaNative.jni_YGNodeSetStyleInputsBufferJNI(mNativePointer, styleInputs, size);
+  }
+
+  /**
+   * Builds a tree from a flat description in one call. Nodes are given in breadth-first order,
+   * starting with the root, and childCounts[i] is the number of children of nodes[i]. The children
+   * of each node directly follow the children of the node before it. Nodes other than the root
+   * must not have an owner, and the existing children of all nodes are replaced.
+   */
+  public static void setChildrenTree(YogaNodeJNIBase[] nodes, int[] childCounts) {
+    if (nodes.length != childCounts.length) {
+      throw new IllegalArgumentException("Each node needs a child count");
+    }
+    long[] nativePointers = new long[nodes.length];
+    int firstChild = 1;
+    for (int i = 0; i < nodes.length; ++i) {
+      final YogaNodeJNIBase parent = nodes[i];
+      final int childCount = childCounts[i];
+      if (childCount < 0 || firstChild + childCount > nodes.length) {
+        throw new IllegalArgumentException("Child counts do not match the number of nodes");
+      }
+      nativePointers[i] = parent.mNativePointer;
+      if (parent.mChildren != null) {
+        for (YogaNodeJNIBase child : parent.mChildren) {
+          child.mOwner = null;
+        }
+      }
+      parent.mChildren = childCount == 0 ? null : new ArrayList<YogaNodeJNIBase>(childCount);
+      for (int j = firstChild; j < firstChild + childCount; ++j) {
+        final YogaNodeJNIBase child = nodes[j];
+        if (child.mOwner != null) {
+          throw new IllegalStateException("Child already has a parent, it must be removed first.");
+        }
+        parent.mChildren.add(child);
+        child.mOwner = parent;
+      }
+      firstChild += childCount;
+    }
+    YogaNative.jni_YGNodeSetChildrenTreeJNI(nativePointers, childCounts);
+  }
+
+  /**
+   * Returns the layout of this node and all of its descendants in one array, with {@link
+   * #LAYOUT_OUTPUTS_STRIDE} floats per node in breadth-first order: left, top, width, height and
+   * direction. This avoids reading the layout of a large subtree node by node.
+   */
+  public float[] getLayoutOutputs() {
+    return YogaNative.jni_YGNodeGetLayoutOutputsJNI(mNativePointer);
+  }
+
   public void calculateLayout(float width, float height) {
     long[] nativePointers = null;
     YogaNodeJNIBase[] nodes = null;
@@ -17,6 +17,53 @@ const short int LAYOUT_MARGIN_START_INDEX = 6;
 const short int LAYOUT_PADDING_START_INDEX = 10;
 const short int LAYOUT_BORDER_START_INDEX = 14;
 
+// Number of floats per node returned by jni_YGNodeGetLayoutOutputsJNI
+const short int LAYOUT_OUTPUTS_STRIDE = 5;
+
+// Those values need to be in sync with YogaStyleInputs.java
+enum class YGStyleInput {
+  LayoutDirection,
+  FlexDirection,
+  Flex,
+  FlexGrow,
+  FlexShrink,
+  FlexBasis,
+  FlexBasisPercent,
+  FlexBasisAuto,
+  FlexWrap,
+  Width,
+  WidthPercent,
+  WidthAuto,
+  MinWidth,
+  MinWidthPercent,
+  MaxWidth,
+  MaxWidthPercent,
+  Height,
+  HeightPercent,
+  HeightAuto,
+  MinHeight,
+  MinHeightPercent,
+  MaxHeight,
+  MaxHeightPercent,
+  JustifyContent,
+  AlignItems,
+  AlignSelf,
+  AlignContent,
+  PositionType,
+  AspectRatio,
+  Overflow,
+  Display,
+  Margin,
+  MarginPercent,
+  MarginAuto,
+  Padding,
+  PaddingPercent,
+  Border,
+  Position,
+  PositionPercent,
+  IsReferenceBaseline,
+};
+
 namespace {
 
 const int HAS_NEW_LAYOUT = 16;
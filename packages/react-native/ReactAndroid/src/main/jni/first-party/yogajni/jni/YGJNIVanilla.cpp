@@ -6,6 +6,7 @@
  */
 
 #include "YGJNIVanilla.h"
+#include <algorithm>
 #include <bit>
 #include <cstring>
 #include <iostream>
@@ -714,6 +715,277 @@ static void jni_YGNodeStyleSetGapJNI(
 // Yoga specific properties, not compatible with flexbox specification
 YG_NODE_JNI_STYLE_PROP(jfloat, float, AspectRatio);
 
+// Applies a packed list of style inputs, as written by Java from the ids in
+// YogaStyleInputs.java. Each input is its id followed by its arguments: edge
+// inputs take the edge and then the value, *Auto inputs take no value.
+static void YGNodeSetStyleInputs(
+    const YGNodeRef node,
+    const float* styleInputs,
+    size_t size) {
+  const auto end = styleInputs + size;
+  auto next = [&]() { return styleInputs < end ? *styleInputs++ : 0.0f; };
+  auto nextEdge = [&]() {
+    return static_cast<YGEdge>(static_cast<int>(next()));
+  };
+  auto edgesSet = YGNodeEdges{node};
+  while (styleInputs < end) {
+    auto styleInputKey = static_cast<YGStyleInput>(static_cast<int>(next()));
+    switch (styleInputKey) {
+      case YGStyleInput::LayoutDirection:
+        YGNodeStyleSetDirection(
+            node, static_cast<YGDirection>(static_cast<int>(next())));
+        break;
+      case YGStyleInput::FlexDirection:
+        YGNodeStyleSetFlexDirection(
+            node, static_cast<YGFlexDirection>(static_cast<int>(next())));
+        break;
+      case YGStyleInput::Flex:
+        YGNodeStyleSetFlex(node, next());
+        break;
+      case YGStyleInput::FlexGrow:
+        YGNodeStyleSetFlexGrow(node, next());
+        break;
+      case YGStyleInput::FlexShrink:
+        YGNodeStyleSetFlexShrink(node, next());
+        break;
+      case YGStyleInput::FlexBasis:
+        YGNodeStyleSetFlexBasis(node, next());
+        break;
+      case YGStyleInput::FlexBasisPercent:
+        YGNodeStyleSetFlexBasisPercent(node, next());
+        break;
+      case YGStyleInput::FlexBasisAuto:
+        YGNodeStyleSetFlexBasisAuto(node);
+        break;
+      case YGStyleInput::FlexWrap:
+        YGNodeStyleSetFlexWrap(
+            node, static_cast<YGWrap>(static_cast<int>(next())));
+        break;
+      case YGStyleInput::Width:
+        YGNodeStyleSetWidth(node, next());
+        break;
+      case YGStyleInput::WidthPercent:
+        YGNodeStyleSetWidthPercent(node, next());
+        break;
+      case YGStyleInput::WidthAuto:
+        YGNodeStyleSetWidthAuto(node);
+        break;
+      case YGStyleInput::MinWidth:
+        YGNodeStyleSetMinWidth(node, next());
+        break;
+      case YGStyleInput::MinWidthPercent:
+        YGNodeStyleSetMinWidthPercent(node, next());
+        break;
+      case YGStyleInput::MaxWidth:
+        YGNodeStyleSetMaxWidth(node, next());
+        break;
+      case YGStyleInput::MaxWidthPercent:
+        YGNodeStyleSetMaxWidthPercent(node, next());
+        break;
+      case YGStyleInput::Height:
+        YGNodeStyleSetHeight(node, next());
+        break;
+      case YGStyleInput::HeightPercent:
+        YGNodeStyleSetHeightPercent(node, next());
+        break;
+      case YGStyleInput::HeightAuto:
+        YGNodeStyleSetHeightAuto(node);
+        break;
+      case YGStyleInput::MinHeight:
+        YGNodeStyleSetMinHeight(node, next());
+        break;
+      case YGStyleInput::MinHeightPercent:
+        YGNodeStyleSetMinHeightPercent(node, next());
+        break;
+      case YGStyleInput::MaxHeight:
+        YGNodeStyleSetMaxHeight(node, next());
+        break;
+      case YGStyleInput::MaxHeightPercent:
+        YGNodeStyleSetMaxHeightPercent(node, next());
+        break;
+      case YGStyleInput::JustifyContent:
+        YGNodeStyleSetJustifyContent(
+            node, static_cast<YGJustify>(static_cast<int>(next())));
+        break;
+      case YGStyleInput::AlignItems:
+        YGNodeStyleSetAlignItems(
+            node, static_cast<YGAlign>(static_cast<int>(next())));
+        break;
+      case YGStyleInput::AlignSelf:
+        YGNodeStyleSetAlignSelf(
+            node, static_cast<YGAlign>(static_cast<int>(next())));
+        break;
+      case YGStyleInput::AlignContent:
+        YGNodeStyleSetAlignContent(
+            node, static_cast<YGAlign>(static_cast<int>(next())));
+        break;
+      case YGStyleInput::PositionType:
+        YGNodeStyleSetPositionType(
+            node, static_cast<YGPositionType>(static_cast<int>(next())));
+        break;
+      case YGStyleInput::AspectRatio:
+        YGNodeStyleSetAspectRatio(node, next());
+        break;
+      case YGStyleInput::Overflow:
+        YGNodeStyleSetOverflow(
+            node, static_cast<YGOverflow>(static_cast<int>(next())));
+        break;
+      case YGStyleInput::Display:
+        YGNodeStyleSetDisplay(
+            node, static_cast<YGDisplay>(static_cast<int>(next())));
+        break;
+      case YGStyleInput::Margin: {
+        auto edge = nextEdge();
+        edgesSet.add(YGNodeEdges::MARGIN);
+        YGNodeStyleSetMargin(node, edge, next());
+        break;
+      }
+      case YGStyleInput::MarginPercent: {
+        auto edge = nextEdge();
+        edgesSet.add(YGNodeEdges::MARGIN);
+        YGNodeStyleSetMarginPercent(node, edge, next());
+        break;
+      }
+      case YGStyleInput::MarginAuto:
+        edgesSet.add(YGNodeEdges::MARGIN);
+        YGNodeStyleSetMarginAuto(node, nextEdge());
+        break;
+      case YGStyleInput::Padding: {
+        auto edge = nextEdge();
+        edgesSet.add(YGNodeEdges::PADDING);
+        YGNodeStyleSetPadding(node, edge, next());
+        break;
+      }
+      case YGStyleInput::PaddingPercent: {
+        auto edge = nextEdge();
+        edgesSet.add(YGNodeEdges::PADDING);
+        YGNodeStyleSetPaddingPercent(node, edge, next());
+        break;
+      }
+      case YGStyleInput::Border: {
+        auto edge = nextEdge();
+        edgesSet.add(YGNodeEdges::BORDER);
+        YGNodeStyleSetBorder(node, edge, next());
+        break;
+      }
+      case YGStyleInput::Position: {
+        auto edge = nextEdge();
+        YGNodeStyleSetPosition(node, edge, next());
+        break;
+      }
+      case YGStyleInput::PositionPercent: {
+        auto edge = nextEdge();
+        YGNodeStyleSetPositionPercent(node, edge, next());
+        break;
+      }
+      case YGStyleInput::IsReferenceBaseline:
+        YGNodeSetIsReferenceBaseline(node, next() == 1.0f);
+        break;
+      default:
+        // The arguments of an unknown input can't be skipped.
+        styleInputs = end;
+        break;
+    }
+  }
+  edgesSet.setOn(node);
+}
+
+static void jni_YGNodeSetStyleInputsJNI(
+    JNIEnv* env,
+    jobject /*obj*/,
+    jlong nativePointer,
+    jfloatArray styleInputsArray,
+    jint size) {
+  auto styleInputs = std::vector<float>(static_cast<size_t>(size));
+  env->GetFloatArrayRegion(styleInputsArray, 0, size, styleInputs.data());
+  if (env->ExceptionCheck()) {
+    return;
+  }
+  YGNodeSetStyleInputs(
+      _jlong2YGNodeRef(nativePointer), styleInputs.data(), styleInputs.size());
+}
+
+static void jni_YGNodeSetStyleInputsBufferJNI(
+    JNIEnv* env,
+    jobject /*obj*/,
+    jlong nativePointer,
+    jobject styleInputsBuffer,
+    jint size) {
+  // Reads the floats in place, the buffer must be direct and in native order.
+  auto styleInputs =
+      static_cast<const float*>(env->GetDirectBufferAddress(styleInputsBuffer));
+  auto capacity = env->GetDirectBufferCapacity(styleInputsBuffer);
+  if (styleInputs == nullptr || capacity < 0) {
+    return;
+  }
+  auto length = std::min(
+      static_cast<size_t>(size), static_cast<size_t>(capacity) / sizeof(float));
+  YGNodeSetStyleInputs(_jlong2YGNodeRef(nativePointer), styleInputs, length);
+}
+
+// Links nodes given in breadth-first order, where the children of each node
+// directly follow the children of the node before it.
+static void jni_YGNodeSetChildrenTreeJNI(
+    JNIEnv* env,
+    jobject /*obj*/,
+    jlongArray nativePointersArray,
+    jintArray childCountsArray) {
+  auto count = static_cast<size_t>(env->GetArrayLength(nativePointersArray));
+  auto nativePointers = std::vector<jlong>(count);
+  auto childCounts = std::vector<jint>(count);
+  env->GetLongArrayRegion(
+      nativePointersArray, 0, count, nativePointers.data());
+  env->GetIntArrayRegion(childCountsArray, 0, count, childCounts.data());
+  if (env->ExceptionCheck()) {
+    return;
+  }
+
+  auto nodes = std::vector<YGNodeRef>(count);
+  for (size_t i = 0; i < count; i++) {
+    nodes[i] = _jlong2YGNodeRef(nativePointers[i]);
+  }
+  size_t firstChild = 1;
+  for (size_t i = 0; i < count && firstChild <= count; i++) {
+    auto childCount =
+        std::min(static_cast<size_t>(childCounts[i]), count - firstChild);
+    YGNodeSetChildren(nodes[i], nodes.data() + firstChild, childCount);
+    firstChild += childCount;
+  }
+}
+
+// Returns the layout of a node and its descendants in breadth-first order,
+// as LAYOUT_OUTPUTS_STRIDE floats per node, so that the layout of a whole
+// subtree is read from Java at once instead of a field transfer per node.
+static jfloatArray jni_YGNodeGetLayoutOutputsJNI(
+    JNIEnv* env,
+    jobject /*obj*/,
+    jlong nativePointer) {
+  auto nodes = std::vector<YGNodeRef>{_jlong2YGNodeRef(nativePointer)};
+  for (size_t i = 0; i < nodes.size(); i++) {
+    auto childCount = YGNodeGetChildCount(nodes[i]);
+    for (size_t j = 0; j < childCount; j++) {
+      nodes.push_back(YGNodeGetChild(nodes[i], j));
+    }
+  }
+
+  auto outputs = std::vector<float>(nodes.size() * LAYOUT_OUTPUTS_STRIDE);
+  auto output = outputs.data();
+  for (auto node : nodes) {
+    *output++ = YGNodeLayoutGetLeft(node);
+    *output++ = YGNodeLayoutGetTop(node);
+    *output++ = YGNodeLayoutGetWidth(node);
+    *output++ = YGNodeLayoutGetHeight(node);
+    *output++ = static_cast<float>(YGNodeLayoutGetDirection(node));
+  }
+
+  auto size = static_cast<jsize>(outputs.size());
+  auto outputsArray = env->NewFloatArray(size);
+  if (outputsArray != nullptr) {
+    env->SetFloatArrayRegion(outputsArray, 0, size, outputs.data());
+  }
+  return outputsArray;
+}
+
 static JNINativeMethod methods[] = {
     {"jni_YGConfigNewJNI", "()J", (void*)jni_YGConfigNewJNI},
     {"jni_YGConfigFreeJNI", "(J)V", (void*)jni_YGConfigFreeJNI},
@@ -947,6 +1219,18 @@ static JNINativeMethod methods[] = {
      "(JZ)V",
      (void*)jni_YGNodeSetAlwaysFormsContainingBlockJNI},
     {"jni_YGNodeCloneJNI", "(J)J", (void*)jni_YGNodeCloneJNI},
+    {"jni_YGNodeSetStyleInputsJNI",
+     "(J[FI)V",
+     (void*)jni_YGNodeSetStyleInputsJNI},
+    {"jni_YGNodeSetStyleInputsBufferJNI",
+     "(JLjava/nio/ByteBuffer;I)V",
+     (void*)jni_YGNodeSetStyleInputsBufferJNI},
+    {"jni_YGNodeSetChildrenTreeJNI",
+     "([J[I)V",
+     (void*)jni_YGNodeSetChildrenTreeJNI},
+    {"jni_YGNodeGetLayoutOutputsJNI",
+     "(J)[F",
+     (void*)jni_YGNodeGetLayoutOutputsJNI},
 };
 
 void YGJNIVanilla::registerNatives(JNIEnv* env) {
@@ -30,23 +30,17 @@ AsyncEventBeat::~AsyncEventBeat() {
 }
 
 void AsyncEventBeat::tick() const {
-  if (!isRequested_ || isBeatCallbackScheduled_) {
+  if (!scheduleBeat()) {
     return;
   }
 
-  isRequested_ = false;
-  isBeatCallbackScheduled_ = true;
-
   runtimeExecutor_([this, ownerBox = ownerBox_](jsi::Runtime& runtime) {
-    isBeatCallbackScheduled_ = false;
     auto owner = ownerBox->owner.lock();
     if (!owner) {
       return;
     }
 
-    if (beatCallback_) {
-      beatCallback_(runtime);
-    }
+    beatScheduled(runtime);
   });
 }
 
@@ -55,7 +49,7 @@ void AsyncEventBeat::induce() const {
 }
 
 void AsyncEventBeat::request() const {
-  bool alreadyRequested = isRequested_;
+  bool alreadyRequested = isRequested();
   EventBeat::request();
   if (!alreadyRequested) {
     // Notifies java side that an event will be dispatched (e.g. LayoutEvent)
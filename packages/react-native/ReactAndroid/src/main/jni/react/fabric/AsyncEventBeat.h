@@ -33,7 +33,6 @@ class AsyncEventBeat final : public EventBeat, public EventBeatManagerObserver {
   EventBeatManager* eventBeatManager_;
   RuntimeExecutor runtimeExecutor_;
   jni::global_ref<jobject> javaUIManager_;
-  mutable std::atomic<bool> isBeatCallbackScheduled_{false};
 };
 
 } // namespace facebook::react
@@ -34,9 +34,11 @@
 #include <react/renderer/scheduler/Scheduler.h>
 #include <react/renderer/scheduler/SchedulerDelegate.h>
 #include <react/renderer/scheduler/SchedulerToolbox.h>
+#include <react/renderer/textlayoutmanager/PersistentTextMeasureCache.h>
 #include <react/renderer/uimanager/primitives.h>
 #include <react/utils/ContextContainer.h>
 #include <react/utils/CoreFeatures.h>
+#include <react/utils/MemoryPressureCoordinator.h>
 
 namespace facebook::react {
 
@@ -80,6 +82,22 @@ Binding::getInspectorDataForInstance(
   return ReadableNativeMap::newObjectCxxArgs(result);
 }
 
+jni::local_ref<ReadableNativeMap::jhybridobject> Binding::getSurfaceTelemetry(
+    jint surfaceId) {
+  auto scheduler = getScheduler();
+  if (!scheduler) {
+    LOG(ERROR) << "Binding::getSurfaceTelemetry: scheduler disappeared";
+    return ReadableNativeMap::newObjectCxxArgs(folly::dynamic::object());
+  }
+
+  auto surfaceTelemetry =
+      scheduler->getUIManager()->getSurfaceTelemetry(surfaceId);
+  if (!surfaceTelemetry) {
+    return ReadableNativeMap::newObjectCxxArgs(folly::dynamic::object());
+  }
+  return ReadableNativeMap::newObjectCxxArgs(toDynamic(*surfaceTelemetry));
+}
+
 constexpr static auto kReactFeatureFlagsJavaDescriptor =
     "com/facebook/react/config/ReactFeatureFlags";
 
@@ -90,10 +108,46 @@ static bool getFeatureFlagValue(const char* name) {
   return reactFeatureFlagsClass->getStaticFieldValue(field);
 }
 
+// Number of threads completing surfaces in parallel when
+// `enableConcurrentSurfaceCompletion` is on.
+constexpr static int kConcurrentSurfaceCompletionThreads = 3;
+
 void Binding::setPixelDensity(float pointScaleFactor) {
   pointScaleFactor_ = pointScaleFactor;
 }
 
+void Binding::trimMemory(jint level) {
+  // Levels of `ComponentCallbacks2.onTrimMemory`.
+  constexpr jint TRIM_MEMORY_RUNNING_MODERATE = 5;
+  constexpr jint TRIM_MEMORY_RUNNING_CRITICAL = 15;
+  constexpr jint TRIM_MEMORY_UI_HIDDEN = 20;
+  constexpr jint TRIM_MEMORY_MODERATE = 60;
+  constexpr jint TRIM_MEMORY_COMPLETE = 80;
+
+  std::shared_ptr<MemoryPressureCoordinator> memoryPressureCoordinator;
+  {
+    std::shared_lock lock(installMutex_);
+    memoryPressureCoordinator = memoryPressureCoordinator_;
+  }
+  if (!memoryPressureCoordinator) {
+    return;
+  }
+
+  // Levels from `TRIM_MEMORY_UI_HIDDEN` on are reported in the background,
+  // the ones below it while the app is running.
+  if (level >= TRIM_MEMORY_COMPLETE) {
+    memoryPressureCoordinator->trim(MemoryPressureLevel::Critical);
+  } else if (level >= TRIM_MEMORY_MODERATE) {
+    memoryPressureCoordinator->trim(MemoryPressureLevel::Moderate);
+  } else if (level >= TRIM_MEMORY_UI_HIDDEN) {
+    memoryPressureCoordinator->trim(MemoryPressureLevel::Background);
+  } else if (level >= TRIM_MEMORY_RUNNING_CRITICAL) {
+    memoryPressureCoordinator->trim(MemoryPressureLevel::Critical);
+  } else if (level >= TRIM_MEMORY_RUNNING_MODERATE) {
+    memoryPressureCoordinator->trim(MemoryPressureLevel::Moderate);
+  }
+}
+
 void Binding::driveCxxAnimations() {
   scheduler_->animationTick();
 }
@@ -107,6 +161,17 @@ void Binding::reportMount(SurfaceId surfaceId) {
   scheduler->reportMount(surfaceId);
 }
 
+void Binding::reportFrameDeadline(jlong frameTimeRemainingNanos) {
+  std::shared_lock lock(installMutex_);
+  auto runtimeScheduler = runtimeScheduler_.lock();
+  if (!runtimeScheduler) {
+    return;
+  }
+  runtimeScheduler->setFrameDeadline(
+      runtimeScheduler->now() +
+      std::chrono::nanoseconds(frameTimeRemainingNanos));
+}
+
 #pragma mark - Surface management
 
 void Binding::startSurface(
@@ -133,7 +198,7 @@ void Binding::startSurface(
 
   surfaceHandler.start();
 
-  surfaceHandler.getMountingCoordinator()->setMountingOverrideDelegate(
+  surfaceHandler.getMountingCoordinator()->addMountingOverrideDelegate(
       animationDriver_);
 
   {
@@ -201,7 +266,7 @@ void Binding::startSurfaceWithConstraints(
 
   surfaceHandler.start();
 
-  surfaceHandler.getMountingCoordinator()->setMountingOverrideDelegate(
+  surfaceHandler.getMountingCoordinator()->addMountingOverrideDelegate(
       animationDriver_);
 
   {
@@ -383,6 +448,7 @@ void Binding::installFabricUIManager(
       contextContainer->insert(
           "RuntimeScheduler",
           std::weak_ptr<RuntimeScheduler>(runtimeScheduler));
+      runtimeScheduler_ = runtimeScheduler;
     }
   }
 
@@ -419,6 +485,95 @@ void Binding::installFabricUIManager(
       getFeatureFlagValue("enableClonelessStateProgression");
   CoreFeatures::excludeYogaFromRawProps =
       getFeatureFlagValue("excludeYogaFromRawProps");
+  CoreFeatures::enableParallelDifferentiator =
+      getFeatureFlagValue("enableParallelDifferentiator");
+  CoreFeatures::enableDifferentiatorMinimalMoves =
+      getFeatureFlagValue("enableDifferentiatorMinimalMoves");
+  CoreFeatures::enableMountingTransactionCompaction =
+      getFeatureFlagValue("enableMountingTransactionCompaction");
+  CoreFeatures::enableOptimisticShadowTreeCommit =
+      getFeatureFlagValue("enableOptimisticShadowTreeCommit");
+  CoreFeatures::enablePooledMountBuffers =
+      getFeatureFlagValue("enablePooledMountBuffers");
+  CoreFeatures::enableProgressiveMounting =
+      getFeatureFlagValue("enableProgressiveMounting");
+  CoreFeatures::enableYogaLayoutReuse =
+      getFeatureFlagValue("enableYogaLayoutReuse");
+  CoreFeatures::enableParagraphPreMeasurement =
+      getFeatureFlagValue("enableParagraphPreMeasurement");
+  CoreFeatures::enableBatchedTextMeasurement =
+      getFeatureFlagValue("enableBatchedTextMeasurement");
+  CoreFeatures::enableTextMeasureRangeCache =
+      getFeatureFlagValue("enableTextMeasureRangeCache");
+  CoreFeatures::enableSkippingUnchangedRawProps =
+      getFeatureFlagValue("enableSkippingUnchangedRawProps");
+  CoreFeatures::enableMinimalPropsUpdates =
+      getFeatureFlagValue("enableMinimalPropsUpdates");
+  CoreFeatures::enablePropsInterning =
+      getFeatureFlagValue("enablePropsInterning");
+  CoreFeatures::enablePooledShadowNodeAllocation =
+      getFeatureFlagValue("enablePooledShadowNodeAllocation");
+  CoreFeatures::enableRuntimeSchedulerTelemetry =
+      getFeatureFlagValue("enableRuntimeSchedulerTelemetry");
+  CoreFeatures::enableBatchedTimers =
+      getFeatureFlagValue("enableBatchedTimers");
+  CoreFeatures::enableBackgroundIntersectionObservation =
+      getFeatureFlagValue("enableBackgroundIntersectionObservation");
+  CoreFeatures::enableConcurrentSurfaceCompletion =
+      getFeatureFlagValue("enableConcurrentSurfaceCompletion");
+  CoreFeatures::enableStickyViewUnflattening =
+      getFeatureFlagValue("enableStickyViewUnflattening");
+  CoreFeatures::enableJSHeapSampling =
+      getFeatureFlagValue("enableJSHeapSampling");
+  CoreFeatures::enableSkippingUnchangedYogaStyles =
+      getFeatureFlagValue("enableSkippingUnchangedYogaStyles");
+  CoreFeatures::enableIncrementalYogaChildrenUpdates =
+      getFeatureFlagValue("enableIncrementalYogaChildrenUpdates");
+  CoreFeatures::enableYogaLayoutTemplates =
+      getFeatureFlagValue("enableYogaLayoutTemplates");
+  CoreFeatures::enableImmediateDiscreteEvents =
+      getFeatureFlagValue("enableImmediateDiscreteEvents");
+  CoreFeatures::enableAnimatedPropsOverlay =
+      getFeatureFlagValue("enableAnimatedPropsOverlay");
+  CoreFeatures::enableIncrementalTextInputUpdates =
+      getFeatureFlagValue("enableIncrementalTextInputUpdates");
+  CoreFeatures::enableThrottledScrollViewStateUpdates =
+      getFeatureFlagValue("enableThrottledScrollViewStateUpdates");
+  CoreFeatures::enableCommitLoadShedding =
+      getFeatureFlagValue("enableCommitLoadShedding");
+  CoreFeatures::enablePipelinedMountPreparation =
+      getFeatureFlagValue("enablePipelinedMountPreparation");
+  CoreFeatures::enableLazyRawPropsParserPreparation =
+      getFeatureFlagValue("enableLazyRawPropsParserPreparation");
+  CoreFeatures::enableProcessWideTextMeasureCache =
+      getFeatureFlagValue("enableProcessWideTextMeasureCache");
+  CoreFeatures::enableCoallocatedShadowNodeFamilies =
+      getFeatureFlagValue("enableCoallocatedShadowNodeFamilies");
+
+  memoryPressureCoordinator_ = std::make_shared<MemoryPressureCoordinator>();
+  contextContainer->insert(
+      MemoryPressureCoordinator::kContextContainerKey,
+      memoryPressureCoordinator_);
+
+  if (CoreFeatures::enableParagraphPreMeasurement) {
+    // Measuring text requires a thread attached to the JVM.
+    textPreMeasurementExecutor_ = JBackgroundExecutor::create("fabric_text");
+    contextContainer->insert(
+        "TextPreMeasurementExecutor", textPreMeasurementExecutor_);
+  }
+
+  // The path is empty unless the app opts into persisting text measurements.
+  // The configuration must describe the locale and font scale of the app.
+  auto persistentTextMeasureCachePath =
+      config->getString("react_fabric:persistent_text_measure_cache_path");
+  if (!persistentTextMeasureCachePath.empty()) {
+    contextContainer->insert(
+        PersistentTextMeasureCache::kContextContainerKey,
+        std::make_shared<PersistentTextMeasureCache>(
+            persistentTextMeasureCachePath,
+            config->getString(
+                "react_fabric:persistent_text_measure_cache_configuration")));
+  }
 
   // RemoveDelete mega-op
   ShadowViewMutation::PlatformSupportsRemoveDeleteTreeInstruction =
@@ -437,8 +592,18 @@ void Binding::installFabricUIManager(
   toolbox.asynchronousEventBeatFactory = asynchronousBeatFactory;
 
   if (ReactNativeFeatureFlags::enableBackgroundExecutor()) {
-    backgroundExecutor_ = JBackgroundExecutor::create("fabric_bg");
+    // Completions of the same surface are serialized by `UIManager`, so a
+    // pool only lets different surfaces complete in parallel.
+    backgroundExecutor_ = JBackgroundExecutor::create(
+        "fabric_bg",
+        CoreFeatures::enableConcurrentSurfaceCompletion
+            ? kConcurrentSurfaceCompletionThreads
+            : 1);
     toolbox.backgroundExecutor = backgroundExecutor_;
+    if (CoreFeatures::enablePipelinedMountPreparation) {
+      mountPreparationQueue_ =
+          std::make_shared<SurfaceCompletionQueue>(backgroundExecutor_);
+    }
   }
 
   animationDriver_ = std::make_shared<LayoutAnimationDriver>(
@@ -456,7 +621,10 @@ void Binding::uninstallFabricUIManager() {
   std::unique_lock lock(installMutex_);
   animationDriver_ = nullptr;
   scheduler_ = nullptr;
+  runtimeScheduler_.reset();
+  memoryPressureCoordinator_ = nullptr;
   mountingManager_ = nullptr;
+  mountPreparationQueue_ = nullptr;
   reactNativeConfig_ = nullptr;
 }
 
@@ -479,11 +647,50 @@ void Binding::schedulerDidFinishTransaction(
     return;
   }
 
-  auto mountingTransaction = mountingCoordinator->pullTransaction();
-  if (!mountingTransaction.has_value()) {
+  // Commits made by completions on the background executor leave diffing and
+  // serializing the transaction to another thread of the executor, so the
+  // completion of the next revision of the surface (e.g. its layout) runs
+  // meanwhile. Preparations of a surface run in order, and one which didn't
+  // start yet is dropped for a newer one: pulling the transaction includes
+  // all revisions committed until then.
+  auto mountPreparationQueue = std::shared_ptr<SurfaceCompletionQueue>{};
+  {
+    std::shared_lock lock(installMutex_);
+    mountPreparationQueue = mountPreparationQueue_;
+  }
+  if (mountPreparationQueue && SurfaceCompletionQueue::isRunningCompletion()) {
+    mountPreparationQueue->schedule(
+        mountingCoordinator->getSurfaceId(),
+        [mountingCoordinator, mountingManager](
+            const SurfaceCompletionQueue::ShouldYield& /*shouldYield*/) {
+          prepareMount(mountingCoordinator, mountingManager);
+        });
     return;
   }
-  mountingManager->executeMount(*mountingTransaction);
+
+  prepareMount(mountingCoordinator, mountingManager);
+}
+
+void Binding::prepareMount(
+    const MountingCoordinator::Shared& mountingCoordinator,
+    const std::shared_ptr<FabricMountingManager>& mountingManager) {
+  // Pulling through `TelemetryController` aggregates per-surface telemetry.
+  // The mount phase measured here is the serialization of the transaction;
+  // mount items run on the UI thread later.
+  // Chunks of a progressively mounted transaction are scheduled right away,
+  // so the chunk with visible views is executed first.
+  do {
+    mountingCoordinator->getTelemetryController().pullTransaction(
+        [](const MountingTransaction& /*transaction*/,
+           const SurfaceTelemetry& /*surfaceTelemetry*/) {},
+        [&](const MountingTransaction& transaction,
+            const SurfaceTelemetry& /*surfaceTelemetry*/) {
+          mountingManager->executeMount(transaction);
+        },
+        [](const MountingTransaction& /*transaction*/,
+           const SurfaceTelemetry& /*surfaceTelemetry*/) {});
+  } while (CoreFeatures::enableProgressiveMounting &&
+           mountingCoordinator->hasPendingTransactions());
 }
 
 void Binding::schedulerDidRequestPreliminaryViewAllocation(
@@ -534,6 +741,18 @@ void Binding::schedulerDidSetIsJSResponder(
       shadowView, isJSResponder, blockNativeResponder);
 }
 
+void Binding::schedulerDidRequestViewPrewarming(
+    SurfaceId surfaceId,
+    const std::string& componentName,
+    size_t count) {
+  auto mountingManager =
+      getMountingManager("schedulerDidRequestViewPrewarming");
+  if (!mountingManager) {
+    return;
+  }
+  mountingManager->prewarmViews(surfaceId, componentName, count);
+}
+
 void Binding::onAnimationStarted() {
   auto mountingManager = getMountingManager("onAnimationStarted");
   if (!mountingManager) {
@@ -558,13 +777,16 @@ void Binding::registerNatives() {
       makeNativeMethod("startSurface", Binding::startSurface),
       makeNativeMethod(
           "getInspectorDataForInstance", Binding::getInspectorDataForInstance),
+      makeNativeMethod("getSurfaceTelemetry", Binding::getSurfaceTelemetry),
       makeNativeMethod(
           "startSurfaceWithConstraints", Binding::startSurfaceWithConstraints),
       makeNativeMethod("stopSurface", Binding::stopSurface),
       makeNativeMethod("setConstraints", Binding::setConstraints),
       makeNativeMethod("setPixelDensity", Binding::setPixelDensity),
+      makeNativeMethod("trimMemory", Binding::trimMemory),
       makeNativeMethod("driveCxxAnimations", Binding::driveCxxAnimations),
       makeNativeMethod("reportMount", Binding::reportMount),
+      makeNativeMethod("reportFrameDeadline", Binding::reportFrameDeadline),
       makeNativeMethod(
           "uninstallFabricUIManager", Binding::uninstallFabricUIManager),
       makeNativeMethod("registerSurface", Binding::registerSurface),
@@ -18,7 +18,9 @@
 #include <react/renderer/scheduler/SchedulerDelegate.h>
 #include <react/renderer/scheduler/SurfaceHandler.h>
 #include <react/renderer/uimanager/LayoutAnimationStatusDelegate.h>
+#include <react/renderer/uimanager/SurfaceCompletionQueue.h>
 #include <react/renderer/uimanager/primitives.h>
+#include <react/utils/MemoryPressureCoordinator.h>
 
 #include "EventEmitterWrapper.h"
 #include "JFabricUIManager.h"
@@ -64,6 +66,9 @@ class Binding : public jni::HybridClass<Binding, JBinding>,
   jni::local_ref<ReadableNativeMap::jhybridobject> getInspectorDataForInstance(
       jni::alias_ref<EventEmitterWrapper::javaobject> eventEmitterWrapper);
 
+  jni::local_ref<ReadableNativeMap::jhybridobject> getSurfaceTelemetry(
+      jint surfaceId);
+
   static jni::local_ref<jhybriddata> initHybrid(jni::alias_ref<jclass>);
 
   void installFabricUIManager(
@@ -119,10 +124,18 @@ class Binding : public jni::HybridClass<Binding, JBinding>,
       bool isJSResponder,
       bool blockNativeResponder) override;
 
+  void schedulerDidRequestViewPrewarming(
+      SurfaceId surfaceId,
+      const std::string& componentName,
+      size_t count) override;
+
   void setPixelDensity(float pointScaleFactor);
 
+  void trimMemory(jint level);
+
   void driveCxxAnimations();
   void reportMount(SurfaceId surfaceId);
+  void reportFrameDeadline(jlong frameTimeRemainingNanos);
 
   void uninstallFabricUIManager();
 
@@ -130,10 +143,16 @@ class Binding : public jni::HybridClass<Binding, JBinding>,
   std::shared_mutex installMutex_;
   std::shared_ptr<FabricMountingManager> mountingManager_;
   std::shared_ptr<Scheduler> scheduler_;
+  std::weak_ptr<RuntimeScheduler> runtimeScheduler_;
+  std::shared_ptr<MemoryPressureCoordinator> memoryPressureCoordinator_;
 
   std::shared_ptr<FabricMountingManager> getMountingManager(
       const char* locationHint);
 
+  static void prepareMount(
+      const MountingCoordinator::Shared& mountingCoordinator,
+      const std::shared_ptr<FabricMountingManager>& mountingManager);
+
   // LayoutAnimations
   void onAnimationStarted() override;
   void onAllAnimationsComplete() override;
@@ -141,6 +160,10 @@ class Binding : public jni::HybridClass<Binding, JBinding>,
   std::shared_ptr<LayoutAnimationDriver> animationDriver_;
 
   BackgroundExecutor backgroundExecutor_;
+  BackgroundExecutor textPreMeasurementExecutor_;
+  // Prepares the mount of commits made on `backgroundExecutor_`, see
+  // `schedulerDidFinishTransaction`.
+  std::shared_ptr<SurfaceCompletionQueue> mountPreparationQueue_;
 
   std::unordered_map<SurfaceId, SurfaceHandler> surfaceHandlerRegistry_{};
   std::shared_mutex
@@ -7,6 +7,8 @@
 
 #include "EventEmitterWrapper.h"
 #include <fbjni/fbjni.h>
+#include <react/renderer/core/MapBufferEventPayload.h>
+#include <react/renderer/mapbuffer/MapBufferBuilder.h>
 
 using namespace facebook::jni;
 
@@ -28,6 +30,23 @@ void EventEmitterWrapper::dispatchEvent(
   }
 }
 
+void EventEmitterWrapper::dispatchEventWithMapBuffer(
+    std::string eventName,
+    jni::alias_ref<JWritableMapBuffer::javaobject> payload,
+    int category) {
+  // It is marginal, but possible for this to be constructed without a valid
+  // EventEmitter. In those cases, make sure we noop/blackhole events instead of
+  // crashing.
+  if (eventEmitter != nullptr) {
+    eventEmitter->dispatchEvent(
+        std::move(eventName),
+        std::make_shared<MapBufferEventPayload>(
+            payload ? payload->getMapBuffer() : MapBufferBuilder::EMPTY()),
+        EventPriority::AsynchronousBatched,
+        static_cast<RawEvent::Category>(category));
+  }
+}
+
 void EventEmitterWrapper::dispatchUniqueEvent(
     std::string eventName,
     NativeMap* payload) {
@@ -43,6 +62,8 @@ void EventEmitterWrapper::dispatchUniqueEvent(
 void EventEmitterWrapper::registerNatives() {
   registerHybrid({
       makeNativeMethod("dispatchEvent", EventEmitterWrapper::dispatchEvent),
+      makeNativeMethod(
+          "dispatchEvent", EventEmitterWrapper::dispatchEventWithMapBuffer),
       makeNativeMethod(
           "dispatchUniqueEvent", EventEmitterWrapper::dispatchUniqueEvent),
   });
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <fbjni/fbjni.h>
+#include <react/common/mapbuffer/JWritableMapBuffer.h>
 #include <react/jni/ReadableNativeMap.h>
 #include <react/renderer/core/EventEmitter.h>
 
@@ -28,6 +29,10 @@ class EventEmitterWrapper : public jni::HybridClass<EventEmitterWrapper> {
   SharedEventEmitter eventEmitter;
 
   void dispatchEvent(std::string eventName, NativeMap* params, int category);
+  void dispatchEventWithMapBuffer(
+      std::string eventName,
+      jni::alias_ref<JWritableMapBuffer::javaobject> params,
+      int category);
   void dispatchUniqueEvent(std::string eventName, NativeMap* params);
 };
 
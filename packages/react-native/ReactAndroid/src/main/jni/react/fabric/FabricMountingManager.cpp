@@ -11,8 +11,10 @@
 #include "MountItem.h"
 #include "StateWrapperImpl.h"
 
+#include <react/debug/react_native_assert.h>
 #include <react/jni/ReadableNativeMap.h>
 #include <react/renderer/components/scrollview/ScrollViewProps.h>
+#include <react/renderer/core/DynamicPropsUtilities.h>
 #include <react/renderer/core/conversions.h>
 #include <react/renderer/debug/SystraceSection.h>
 #include <react/renderer/mounting/MountingTransaction.h>
@@ -20,11 +22,13 @@
 #include <react/renderer/mounting/ShadowViewMutation.h>
 #include <react/utils/CoreFeatures.h>
 
+#include <fbjni/ByteBuffer.h>
 #include <fbjni/fbjni.h>
 #include <glog/logging.h>
 
 #include <cfenv>
 #include <cmath>
+#include <cstring>
 #include <unordered_set>
 #include <vector>
 
@@ -168,22 +172,49 @@ static inline void computeBufferSizes(
       batchMountItemObjectsSize);
 }
 
+namespace {
+
+/*
+ * Writes the int part of a batch either into a `jintArray` allocated for the
+ * batch or, with pooled mount buffers, directly into the memory of a direct
+ * `ByteBuffer` (which does not require any JNI calls).
+ */
+class IntBufferWriter final {
+ public:
+  IntBufferWriter(_JNIEnv* env, jintArray array) : env_(env), array_(array) {}
+
+  explicit IntBufferWriter(jint* data) : data_(data) {}
+
+  void write(const jint* values, int count) {
+    if (data_ != nullptr) {
+      std::memcpy(data_ + position_, values, count * sizeof(jint));
+    } else {
+      env_->SetIntArrayRegion(array_, position_, count, values);
+    }
+    position_ += count;
+  }
+
+ private:
+  _JNIEnv* env_{nullptr};
+  jintArray array_{nullptr};
+  jint* data_{nullptr};
+  int position_{0};
+};
+
+} // namespace
+
 static inline void writeIntBufferTypePreamble(
     int mountItemType,
     size_t numItems,
-    _JNIEnv* env,
-    jintArray& intBufferArray,
-    int& intBufferPosition) {
+    IntBufferWriter& intBufferWriter) {
   jint temp[2];
   if (numItems == 1) {
     temp[0] = mountItemType;
-    env->SetIntArrayRegion(intBufferArray, intBufferPosition, 1, temp);
-    intBufferPosition += 1;
+    intBufferWriter.write(temp, 1);
   } else {
     temp[0] = mountItemType | CppMountItem::Type::Multiple;
     temp[1] = static_cast<jint>(numItems);
-    env->SetIntArrayRegion(intBufferArray, intBufferPosition, 2, temp);
-    intBufferPosition += 2;
+    intBufferWriter.write(temp, 2);
   }
 }
 
@@ -219,6 +250,12 @@ static inline float scale(Float value, Float pointScaleFactor) {
 jni::local_ref<jobject> FabricMountingManager::getProps(
     const ShadowView& oldShadowView,
     const ShadowView& newShadowView) {
+  if (CoreFeatures::enableMinimalPropsUpdates && oldShadowView.props) {
+    // The view holds all values of the raw props of the old props, as they
+    // were either sent when those were mounted, or were already equal.
+    return ReadableNativeMap::newObjectCxxArgs(diffDynamicProps(
+        oldShadowView.props->rawProps, newShadowView.props->rawProps));
+  }
   return ReadableNativeMap::newObjectCxxArgs(newShadowView.props->rawProps);
 }
 
@@ -486,13 +523,41 @@ void FabricMountingManager::executeMount(
   }
 
   // Allocate the intBuffer and object array, now that we know exact sizes
-  // necessary
-  jintArray intBufferArray = env->NewIntArray(batchMountItemIntsSize);
-  auto objBufferArray =
-      jni::JArrayClass<jobject>::newArray(batchMountItemObjectsSize);
+  // necessary. With pooled mount buffers, reuse buffers of previous batches
+  // instead.
+  jintArray intBufferArray = nullptr;
+  auto pooledIntBuffer = jni::local_ref<jni::JByteBuffer>{};
+  auto objBufferArray = jni::local_ref<jni::JArrayClass<jobject>>{};
+  if (CoreFeatures::enablePooledMountBuffers) {
+    static auto obtainMountIntBuffer =
+        JFabricUIManager::javaClassStatic()
+            ->getMethod<jni::alias_ref<jni::JByteBuffer>(jint)>(
+                "obtainMountIntBuffer");
+    static auto obtainMountObjectBuffer =
+        JFabricUIManager::javaClassStatic()
+            ->getMethod<jni::jtypeArray<jobject>(jint)>(
+                "obtainMountObjectBuffer");
+
+    pooledIntBuffer = obtainMountIntBuffer(
+        javaUIManager_, static_cast<jint>(batchMountItemIntsSize));
+    react_native_assert(
+        pooledIntBuffer->getDirectSize() >=
+        batchMountItemIntsSize * sizeof(jint));
+    if (batchMountItemObjectsSize > 0) {
+      objBufferArray = obtainMountObjectBuffer(
+          javaUIManager_, static_cast<jint>(batchMountItemObjectsSize));
+    }
+  } else {
+    intBufferArray = env->NewIntArray(batchMountItemIntsSize);
+    objBufferArray =
+        jni::JArrayClass<jobject>::newArray(batchMountItemObjectsSize);
+  }
+  auto intBufferWriter = pooledIntBuffer
+      ? IntBufferWriter{reinterpret_cast<jint*>(
+            pooledIntBuffer->getDirectBytes())}
+      : IntBufferWriter{env, intBufferArray};
 
   // Fill in arrays
-  int intBufferPosition = 0;
   int objBufferPosition = 0;
   int prevMountItemType = -1;
   jint temp[7];
@@ -513,9 +578,7 @@ void FabricMountingManager::executeMount(
       writeIntBufferTypePreamble(
           mountItemType,
           numSameItemTypes,
-          env,
-          intBufferArray,
-          intBufferPosition);
+          intBufferWriter);
     }
     prevMountItemType = mountItemType;
 
@@ -545,8 +608,7 @@ void FabricMountingManager::executeMount(
           mountItem.newChildShadowView.eventEmitter);
       temp[0] = mountItem.newChildShadowView.tag;
       temp[1] = isLayoutable;
-      env->SetIntArrayRegion(intBufferArray, intBufferPosition, 2, temp);
-      intBufferPosition += 2;
+      intBufferWriter.write(temp, 2);
 
       (*objBufferArray)[objBufferPosition++] = componentName.get();
       (*objBufferArray)[objBufferPosition++] = props.get();
@@ -557,20 +619,17 @@ void FabricMountingManager::executeMount(
       temp[0] = mountItem.newChildShadowView.tag;
       temp[1] = mountItem.parentShadowView.tag;
       temp[2] = mountItem.index;
-      env->SetIntArrayRegion(intBufferArray, intBufferPosition, 3, temp);
-      intBufferPosition += 3;
+      intBufferWriter.write(temp, 3);
     } else if (mountItemType == CppMountItem::Remove) {
       temp[0] = mountItem.oldChildShadowView.tag;
       temp[1] = mountItem.parentShadowView.tag;
       temp[2] = mountItem.index;
-      env->SetIntArrayRegion(intBufferArray, intBufferPosition, 3, temp);
-      intBufferPosition += 3;
+      intBufferWriter.write(temp, 3);
     } else if (mountItemType == CppMountItem::RemoveDeleteTree) {
       temp[0] = mountItem.oldChildShadowView.tag;
       temp[1] = mountItem.parentShadowView.tag;
       temp[2] = mountItem.index;
-      env->SetIntArrayRegion(intBufferArray, intBufferPosition, 3, temp);
-      intBufferPosition += 3;
+      intBufferWriter.write(temp, 3);
     } else {
       LOG(ERROR) << "Unexpected CppMountItem type";
     }
@@ -579,14 +638,11 @@ void FabricMountingManager::executeMount(
     writeIntBufferTypePreamble(
         CppMountItem::Type::UpdateProps,
         cppUpdatePropsMountItems.size(),
-        env,
-        intBufferArray,
-        intBufferPosition);
+        intBufferWriter);
 
     for (const auto& mountItem : cppUpdatePropsMountItems) {
       temp[0] = mountItem.newChildShadowView.tag;
-      env->SetIntArrayRegion(intBufferArray, intBufferPosition, 1, temp);
-      intBufferPosition += 1;
+      intBufferWriter.write(temp, 1);
       (*objBufferArray)[objBufferPosition++] =
           getProps(mountItem.oldChildShadowView, mountItem.newChildShadowView);
     }
@@ -595,14 +651,11 @@ void FabricMountingManager::executeMount(
     writeIntBufferTypePreamble(
         CppMountItem::Type::UpdateState,
         cppUpdateStateMountItems.size(),
-        env,
-        intBufferArray,
-        intBufferPosition);
+        intBufferWriter);
 
     for (const auto& mountItem : cppUpdateStateMountItems) {
       temp[0] = mountItem.newChildShadowView.tag;
-      env->SetIntArrayRegion(intBufferArray, intBufferPosition, 1, temp);
-      intBufferPosition += 1;
+      intBufferWriter.write(temp, 1);
 
       auto state = mountItem.newChildShadowView.state;
       // Do not hold onto Java object from C
@@ -623,9 +676,7 @@ void FabricMountingManager::executeMount(
     writeIntBufferTypePreamble(
         CppMountItem::Type::UpdatePadding,
         cppUpdatePaddingMountItems.size(),
-        env,
-        intBufferArray,
-        intBufferPosition);
+        intBufferWriter);
 
     for (const auto& mountItem : cppUpdatePaddingMountItems) {
       auto layoutMetrics = mountItem.newChildShadowView.layoutMetrics;
@@ -642,17 +693,14 @@ void FabricMountingManager::executeMount(
       temp[2] = top;
       temp[3] = right;
       temp[4] = bottom;
-      env->SetIntArrayRegion(intBufferArray, intBufferPosition, 5, temp);
-      intBufferPosition += 5;
+      intBufferWriter.write(temp, 5);
     }
   }
   if (!cppUpdateLayoutMountItems.empty()) {
     writeIntBufferTypePreamble(
         CppMountItem::Type::UpdateLayout,
         cppUpdateLayoutMountItems.size(),
-        env,
-        intBufferArray,
-        intBufferPosition);
+        intBufferWriter);
 
     for (const auto& mountItem : cppUpdateLayoutMountItems) {
       auto layoutMetrics = mountItem.newChildShadowView.layoutMetrics;
@@ -673,17 +721,14 @@ void FabricMountingManager::executeMount(
       temp[4] = w;
       temp[5] = h;
       temp[6] = displayType;
-      env->SetIntArrayRegion(intBufferArray, intBufferPosition, 7, temp);
-      intBufferPosition += 7;
+      intBufferWriter.write(temp, 7);
     }
   }
   if (!cppUpdateOverflowInsetMountItems.empty()) {
     writeIntBufferTypePreamble(
         CppMountItem::Type::UpdateOverflowInset,
         cppUpdateOverflowInsetMountItems.size(),
-        env,
-        intBufferArray,
-        intBufferPosition);
+        intBufferWriter);
 
     for (const auto& mountItem : cppUpdateOverflowInsetMountItems) {
       auto layoutMetrics = mountItem.newChildShadowView.layoutMetrics;
@@ -703,22 +748,18 @@ void FabricMountingManager::executeMount(
       temp[2] = overflowInsetTop;
       temp[3] = overflowInsetRight;
       temp[4] = overflowInsetBottom;
-      env->SetIntArrayRegion(intBufferArray, intBufferPosition, 5, temp);
-      intBufferPosition += 5;
+      intBufferWriter.write(temp, 5);
     }
   }
   if (!cppUpdateEventEmitterMountItems.empty()) {
     writeIntBufferTypePreamble(
         CppMountItem::Type::UpdateEventEmitter,
         cppUpdateEventEmitterMountItems.size(),
-        env,
-        intBufferArray,
-        intBufferPosition);
+        intBufferWriter);
 
     for (const auto& mountItem : cppUpdateEventEmitterMountItems) {
       temp[0] = mountItem.newChildShadowView.tag;
-      env->SetIntArrayRegion(intBufferArray, intBufferPosition, 1, temp);
-      intBufferPosition += 1;
+      intBufferWriter.write(temp, 1);
 
       // Do not hold a reference to javaEventEmitter from the C++ side.
       auto javaEventEmitter = EventEmitterWrapper::newObjectCxxArgs(
@@ -736,25 +777,44 @@ void FabricMountingManager::executeMount(
     writeIntBufferTypePreamble(
         CppMountItem::Type::Delete,
         cppDeleteMountItems.size(),
-        env,
-        intBufferArray,
-        intBufferPosition);
+        intBufferWriter);
 
     for (const auto& mountItem : cppDeleteMountItems) {
       temp[0] = mountItem.oldChildShadowView.tag;
-      env->SetIntArrayRegion(intBufferArray, intBufferPosition, 1, temp);
-      intBufferPosition += 1;
+      intBufferWriter.write(temp, 1);
     }
   }
 
-  // If there are no items, we pass a nullptr instead of passing the object
-  // through the JNI
-  auto batch = createMountItemsIntBufferBatchContainer(
-      javaUIManager_,
-      surfaceId,
-      batchMountItemIntsSize == 0 ? nullptr : intBufferArray,
-      batchMountItemObjectsSize == 0 ? nullptr : objBufferArray.get(),
-      revisionNumber);
+  auto batch = jni::local_ref<JMountItem::javaobject>{};
+  if (CoreFeatures::enablePooledMountBuffers) {
+    static auto createPooledMountItemsIntBufferBatchContainer =
+        JFabricUIManager::javaClassStatic()
+            ->getMethod<jni::alias_ref<JMountItem>(
+                jint,
+                jni::alias_ref<jni::JByteBuffer>,
+                jint,
+                jni::jtypeArray<jobject>,
+                jint,
+                jint)>("createPooledIntBufferBatchMountItem");
+
+    batch = createPooledMountItemsIntBufferBatchContainer(
+        javaUIManager_,
+        surfaceId,
+        pooledIntBuffer,
+        batchMountItemIntsSize,
+        batchMountItemObjectsSize == 0 ? nullptr : objBufferArray.get(),
+        batchMountItemObjectsSize,
+        revisionNumber);
+  } else {
+    // If there are no items, we pass a nullptr instead of passing the object
+    // through the JNI
+    batch = createMountItemsIntBufferBatchContainer(
+        javaUIManager_,
+        surfaceId,
+        batchMountItemIntsSize == 0 ? nullptr : intBufferArray,
+        batchMountItemObjectsSize == 0 ? nullptr : objBufferArray.get(),
+        revisionNumber);
+  }
 
   auto finishTransactionEndTime = telemetryTimePointNow();
 
@@ -771,7 +831,9 @@ void FabricMountingManager::executeMount(
       telemetryTimePointToMilliseconds(finishTransactionEndTime),
       telemetry.getAffectedLayoutNodesCount());
 
-  env->DeleteLocalRef(intBufferArray);
+  if (intBufferArray != nullptr) {
+    env->DeleteLocalRef(intBufferArray);
+  }
 }
 
 void FabricMountingManager::preallocateShadowView(
@@ -826,6 +888,19 @@ void FabricMountingManager::preallocateShadowView(
       isLayoutableShadowNode);
 }
 
+void FabricMountingManager::prewarmViews(
+    SurfaceId surfaceId,
+    const std::string& componentName,
+    size_t count) {
+  static auto prewarmViews =
+      JFabricUIManager::javaClassStatic()->getMethod<void(jint, jstring, jint)>(
+          "prewarmViews");
+
+  auto component = jni::make_jstring(componentName);
+  prewarmViews(
+      javaUIManager_, surfaceId, component.get(), static_cast<jint>(count));
+}
+
 void FabricMountingManager::dispatchCommand(
     const ShadowView& shadowView,
     const std::string& commandName,
@@ -34,6 +34,11 @@ class FabricMountingManager final {
 
   void preallocateShadowView(SurfaceId surfaceId, const ShadowView& shadowView);
 
+  void prewarmViews(
+      SurfaceId surfaceId,
+      const std::string& componentName,
+      size_t count);
+
   void executeMount(const MountingTransaction& transaction);
 
   void dispatchCommand(
@@ -14,8 +14,10 @@ namespace facebook::react {
 
 using namespace facebook::jni;
 
-BackgroundExecutor JBackgroundExecutor::create(const std::string& name) {
-  auto instance = make_global(newInstance(name));
+BackgroundExecutor JBackgroundExecutor::create(
+    const std::string& name,
+    int numberOfThreads) {
+  auto instance = make_global(newInstance(name, numberOfThreads));
   return [instance = std::move(instance)](std::function<void()>&& runnable) {
     static auto method =
         javaClassStatic()->getMethod<void(JRunnable::javaobject)>(
@@ -17,7 +17,12 @@ class JBackgroundExecutor : public jni::JavaClass<JBackgroundExecutor> {
   static auto constexpr kJavaDescriptor =
       "Lcom/facebook/react/bridge/BackgroundExecutor;";
 
-  static BackgroundExecutor create(const std::string& name);
+  /*
+   * Creates an executor running tasks on `numberOfThreads` Java threads.
+   */
+  static BackgroundExecutor create(
+      const std::string& name,
+      int numberOfThreads = 1);
 };
 
 } // namespace facebook::react
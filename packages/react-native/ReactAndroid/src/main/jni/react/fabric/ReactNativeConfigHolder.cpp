@@ -11,31 +11,75 @@
 
 using namespace facebook::react;
 
+namespace {
+
+/*
+ * Returns the cached value of `param`, reading it with `read` (which runs
+ * without the lock held, as it calls into Java) on first use.
+ */
+template <typename T, typename Read>
+T getCached(
+    std::mutex& mutex,
+    std::unordered_map<std::string, T>& cache,
+    const std::string& param,
+    Read read) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto iterator = cache.find(param);
+    if (iterator != cache.end()) {
+      return iterator->second;
+    }
+  }
+
+  auto value = read();
+  std::lock_guard<std::mutex> lock(mutex);
+  cache.emplace(param, value);
+  return value;
+}
+
+} // namespace
+
 bool ReactNativeConfigHolder::getBool(const std::string& param) const {
   static const auto method = facebook::jni::findClassStatic(
                                  "com/facebook/react/fabric/ReactNativeConfig")
                                  ->getMethod<jboolean(jstring)>("getBool");
-  return method(reactNativeConfig_, facebook::jni::make_jstring(param).get());
+  return getCached(mutex_, bools_, param, [&]() -> bool {
+    return method(reactNativeConfig_, facebook::jni::make_jstring(param).get());
+  });
 }
 
 std::string ReactNativeConfigHolder::getString(const std::string& param) const {
   static const auto method = facebook::jni::findClassStatic(
                                  "com/facebook/react/fabric/ReactNativeConfig")
                                  ->getMethod<jstring(jstring)>("getString");
-  return method(reactNativeConfig_, facebook::jni::make_jstring(param).get())
-      ->toString();
+  return getCached(mutex_, strings_, param, [&]() {
+    return method(reactNativeConfig_, facebook::jni::make_jstring(param).get())
+        ->toString();
+  });
 }
 
 int64_t ReactNativeConfigHolder::getInt64(const std::string& param) const {
   static const auto method = facebook::jni::findClassStatic(
                                  "com/facebook/react/fabric/ReactNativeConfig")
                                  ->getMethod<jlong(jstring)>("getInt64");
-  return method(reactNativeConfig_, facebook::jni::make_jstring(param).get());
+  return getCached(mutex_, int64s_, param, [&]() -> int64_t {
+    return method(reactNativeConfig_, facebook::jni::make_jstring(param).get());
+  });
 }
 
 double ReactNativeConfigHolder::getDouble(const std::string& param) const {
   static const auto method = facebook::jni::findClassStatic(
                                  "com/facebook/react/fabric/ReactNativeConfig")
                                  ->getMethod<jdouble(jstring)>("getDouble");
-  return method(reactNativeConfig_, facebook::jni::make_jstring(param).get());
+  return getCached(mutex_, doubles_, param, [&]() -> double {
+    return method(reactNativeConfig_, facebook::jni::make_jstring(param).get());
+  });
+}
+
+void ReactNativeConfigHolder::invalidate() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  bools_.clear();
+  strings_.clear();
+  int64s_.clear();
+  doubles_.clear();
 }
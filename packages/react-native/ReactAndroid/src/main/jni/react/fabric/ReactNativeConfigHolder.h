@@ -11,12 +11,20 @@
 #include <react/config/ReactNativeConfig.h>
 #include <react/jni/ReadableNativeMap.h>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 namespace facebook::react {
 
 /**
  * Implementation of ReactNativeConfig that wraps a ReactNativeConfig Java
  * object.
+ *
+ * Values are read from the Java object the first time they are requested and
+ * cached, so that later lookups (e.g. per surface or per commit) don't go
+ * through JNI. `invalidate` drops the cached values, for when the values of
+ * the Java object change.
  */
 class ReactNativeConfigHolder : public ReactNativeConfig {
  public:
@@ -28,8 +36,19 @@ class ReactNativeConfigHolder : public ReactNativeConfig {
   int64_t getInt64(const std::string& param) const override;
   double getDouble(const std::string& param) const override;
 
+  /*
+   * Drops cached values, so that they are read from the Java object again.
+   */
+  void invalidate();
+
  private:
   jni::global_ref<jobject> reactNativeConfig_;
+
+  mutable std::mutex mutex_;
+  mutable std::unordered_map<std::string, bool> bools_;
+  mutable std::unordered_map<std::string, std::string> strings_;
+  mutable std::unordered_map<std::string, int64_t> int64s_;
+  mutable std::unordered_map<std::string, double> doubles_;
 };
 
 } // namespace facebook::react
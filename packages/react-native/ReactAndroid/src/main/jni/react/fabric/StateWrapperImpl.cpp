@@ -52,11 +52,21 @@ void StateWrapperImpl::updateStateImpl(NativeMap* map) {
   }
 }
 
+void StateWrapperImpl::updateStateWithMapBufferImpl(
+    jni::alias_ref<JWritableMapBuffer::javaobject> mapBuffer) {
+  if (auto state = state_.lock()) {
+    state->updateState(mapBuffer->getMapBuffer());
+  }
+}
+
 void StateWrapperImpl::registerNatives() {
   registerHybrid({
       makeNativeMethod("initHybrid", StateWrapperImpl::initHybrid),
       makeNativeMethod("getStateDataImpl", StateWrapperImpl::getStateDataImpl),
       makeNativeMethod("updateStateImpl", StateWrapperImpl::updateStateImpl),
+      makeNativeMethod(
+          "updateStateWithMapBufferImpl",
+          StateWrapperImpl::updateStateWithMapBufferImpl),
       makeNativeMethod(
           "getStateMapBufferDataImpl",
           StateWrapperImpl::getStateMapBufferDataImpl),
@@ -9,6 +9,7 @@
 
 #include <fbjni/fbjni.h>
 #include <react/common/mapbuffer/JReadableMapBuffer.h>
+#include <react/common/mapbuffer/JWritableMapBuffer.h>
 #include <react/jni/ReadableNativeMap.h>
 #include <react/renderer/core/State.h>
 
@@ -28,6 +29,8 @@ class StateWrapperImpl : public jni::HybridClass<StateWrapperImpl> {
   jni::local_ref<JReadableMapBuffer::jhybridobject> getStateMapBufferDataImpl();
   jni::local_ref<ReadableNativeMap::jhybridobject> getStateDataImpl();
   void updateStateImpl(NativeMap* map);
+  void updateStateWithMapBufferImpl(
+      jni::alias_ref<JWritableMapBuffer::javaobject> mapBuffer);
 
   std::weak_ptr<const State> state_;
 
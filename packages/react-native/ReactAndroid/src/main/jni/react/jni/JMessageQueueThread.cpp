@@ -49,9 +49,26 @@ std::function<void()> wrapRunnable(std::function<void()>&& runnable) {
 
 JMessageQueueThread::JMessageQueueThread(
     alias_ref<JavaMessageQueueThread::javaobject> jobj)
-    : m_jobj(make_global(jobj)) {}
+    : m_jobj(make_global(jobj)),
+      m_pending(std::make_shared<PendingRunnables>()) {
+  m_pending->jobj = m_jobj;
+}
 
 void JMessageQueueThread::runOnQueue(std::function<void()>&& runnable) {
+  {
+    std::scoped_lock lock(m_pending->mutex);
+    m_pending->runnables.push_back(std::move(runnable));
+    if (m_pending->drainScheduled) {
+      // The posted drain runs this in order with the earlier ones.
+      return;
+    }
+    m_pending->drainScheduled = true;
+  }
+  postDrain(m_pending);
+}
+
+void JMessageQueueThread::postDrain(
+    const std::shared_ptr<PendingRunnables>& pending) {
   // For C++ modules, this can be called from an arbitrary thread
   // managed by the module, via callJSCallback or callJSFunction.  So,
   // we ensure that it is registered with the JVM.
@@ -60,8 +77,43 @@ void JMessageQueueThread::runOnQueue(std::function<void()>&& runnable) {
       JavaMessageQueueThread::javaClassStatic()
           ->getMethod<jboolean(JRunnable::javaobject)>("runOnQueue");
   auto jrunnable =
-      JNativeRunnable::newObjectCxxArgs(wrapRunnable(std::move(runnable)));
-  method(m_jobj, jrunnable.get());
+      JNativeRunnable::newObjectCxxArgs([pending]() { drain(pending); });
+  method(pending->jobj, jrunnable.get());
+}
+
+void JMessageQueueThread::drain(
+    const std::shared_ptr<PendingRunnables>& pending) {
+  std::vector<std::function<void()>> runnables;
+  {
+    std::scoped_lock lock(pending->mutex);
+    runnables.swap(pending->runnables);
+    // Runnables enqueued from now on, including by the ones below, are run
+    // by the next drain instead of growing this batch.
+    pending->drainScheduled = false;
+  }
+
+  for (auto it = runnables.begin(); it != runnables.end(); ++it) {
+    try {
+      wrapRunnable(std::move(*it))();
+    } catch (...) {
+      // Keeps the runnables after the failed one ahead of those enqueued
+      // since, and lets the exception reach Java as before.
+      bool shouldPost = false;
+      {
+        std::scoped_lock lock(pending->mutex);
+        pending->runnables.insert(
+            pending->runnables.begin(),
+            std::make_move_iterator(it + 1),
+            std::make_move_iterator(runnables.end()));
+        shouldPost = !pending->runnables.empty() && !pending->drainScheduled;
+        pending->drainScheduled |= shouldPost;
+      }
+      if (shouldPost) {
+        postDrain(pending);
+      }
+      throw;
+    }
+  }
 }
 
 void JMessageQueueThread::runOnQueueSync(std::function<void()>&& runnable) {
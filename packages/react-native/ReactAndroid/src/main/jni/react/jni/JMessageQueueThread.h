@@ -8,6 +8,9 @@
 #pragma once
 
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include <cxxreact/MessageQueueThread.h>
 #include <fbjni/fbjni.h>
@@ -26,6 +29,8 @@ class JMessageQueueThread : public MessageQueueThread {
 
   /**
    * Enqueues the given function to run on this MessageQueueThread.
+   * Functions enqueued while earlier ones are still pending are batched, so
+   * that one Java runnable is posted to run all of them in order.
    */
   void runOnQueue(std::function<void()>&& runnable) override;
 
@@ -47,7 +52,19 @@ class JMessageQueueThread : public MessageQueueThread {
   }
 
  private:
+  struct PendingRunnables {
+    jni::global_ref<JavaMessageQueueThread::javaobject> jobj;
+    std::mutex mutex;
+    std::vector<std::function<void()>> runnables;
+    bool drainScheduled{false};
+  };
+
+  static void postDrain(const std::shared_ptr<PendingRunnables>& pending);
+  static void drain(const std::shared_ptr<PendingRunnables>& pending);
+
   jni::global_ref<JavaMessageQueueThread::javaobject> m_jobj;
+  // Shared with the posted Java runnable, which may outlive this object.
+  std::shared_ptr<PendingRunnables> m_pending;
 };
 
 } // namespace facebook::react
@@ -162,9 +162,16 @@ void JReactMarker::nativeLogMarker(
   }
 }
 
+std::string JReactMarker::nativeGetStartupTrace(
+    jni::alias_ref<jclass> /* unused */) {
+  return ReactMarker::MarkerTimeline::getInstance().getTrace();
+}
+
 void JReactMarker::registerNatives() {
   javaClassLocal()->registerNatives({
       makeNativeMethod("nativeLogMarker", JReactMarker::nativeLogMarker),
+      makeNativeMethod(
+          "nativeGetStartupTrace", JReactMarker::nativeGetStartupTrace),
   });
 }
 
@@ -42,6 +42,8 @@ class JReactMarker : public facebook::jni::JavaClass<JReactMarker> {
       jni::alias_ref<jclass> /* unused */,
       std::string markerNameStr,
       jlong markerTime);
+  static std::string nativeGetStartupTrace(
+      jni::alias_ref<jclass> /* unused */);
 };
 
 } // namespace facebook::react
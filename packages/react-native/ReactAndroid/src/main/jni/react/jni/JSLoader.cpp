@@ -12,6 +12,8 @@
 #include <cxxreact/JSBundleType.h>
 #include <fbjni/fbjni.h>
 #include <folly/Conv.h>
+#include <glog/logging.h>
+#include <unistd.h>
 
 #ifdef WITH_FBSYSTRACE
 #include <fbsystrace.h>
@@ -47,6 +49,31 @@ class AssetManagerString : public JSBigString {
   AAsset* asset_;
 };
 
+/**
+ * Maps the asset from the APK if it is stored uncompressed, so the kernel can
+ * share its pages instead of the bundle being copied to the heap. Returns
+ * nullptr for compressed assets.
+ */
+static std::unique_ptr<const JSBigString> mapScriptFromAsset(
+    AAsset* asset,
+    const std::string& assetName) {
+  off64_t offset = 0;
+  off64_t length = 0;
+  auto fd = AAsset_openFileDescriptor64(asset, &offset, &length);
+  if (fd < 0) {
+    LOG(WARNING) << "The bundle '" << assetName
+                 << "' is compressed in the APK, so it has to be copied to "
+                    "memory. Store it uncompressed to map it instead.";
+    return nullptr;
+  }
+
+  // JSBigFileString holds a duplicate of the descriptor.
+  auto script = std::make_unique<JSBigFileString>(
+      fd, static_cast<size_t>(length), static_cast<off_t>(offset));
+  close(fd);
+  return script;
+}
+
 __attribute__((visibility("default"))) AAssetManager* extractAssetManager(
     alias_ref<JAssetManager::javaobject> assetManager) {
   auto env = Environment::current();
@@ -69,6 +96,11 @@ loadScriptFromAssets(AAssetManager* manager, const std::string& assetName) {
         AASSET_MODE_STREAMING); // Optimized for sequential read: see
                                 // AssetManager.java for docs
     if (asset) {
+      if (auto mappedScript = mapScriptFromAsset(asset, assetName)) {
+        AAsset_close(asset);
+        return mappedScript;
+      }
+
       auto script = std::make_unique<AssetManagerString>(asset);
       if (script->size() >= sizeof(BundleHeader)) {
         // When using bytecode, it's safe for the underlying buffer to not be \0
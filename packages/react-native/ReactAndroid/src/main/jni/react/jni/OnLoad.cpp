@@ -30,6 +30,10 @@
 #include <fb/xplat_init.h>
 #endif
 
+#ifdef WITH_PERFETTO
+#include <reactperflogger/ReactPerfetto.h>
+#endif
+
 namespace facebook::react {
 
 namespace {
@@ -77,6 +81,9 @@ extern "C" JNIEXPORT jint JNI_OnLoad(JavaVM* vm, void* reserved) {
     gloginit::initialize();
     FLAGS_minloglevel = 0;
 #endif
+#ifdef WITH_PERFETTO
+    initializePerfetto();
+#endif
 
     ProxyJavaScriptExecutorHolder::registerNatives();
     CatalystInstanceImpl::registerNatives();
@@ -7,6 +7,7 @@
 
 #include "ReadableNativeArray.h"
 
+#include "ReadableNativeBuffer.h"
 #include "ReadableNativeMap.h"
 
 using namespace facebook::jni;
@@ -40,10 +41,20 @@ local_ref<JArrayClass<jobject>> ReadableNativeArray::importTypeArray() {
   return jarray;
 }
 
+local_ref<JByteBuffer> ReadableNativeArray::importByteBuffer() {
+  // Buffers returned earlier point to `buffer_`, so it's only written once.
+  if (buffer_.empty()) {
+    buffer_ = serializeDynamicToBuffer(array_);
+  }
+  return JByteBuffer::wrapBytes(buffer_.data(), buffer_.size());
+}
+
 void ReadableNativeArray::registerNatives() {
   registerHybrid({
       makeNativeMethod("importArray", ReadableNativeArray::importArray),
       makeNativeMethod("importTypeArray", ReadableNativeArray::importTypeArray),
+      makeNativeMethod(
+          "importByteBuffer", ReadableNativeArray::importByteBuffer),
   });
 }
 
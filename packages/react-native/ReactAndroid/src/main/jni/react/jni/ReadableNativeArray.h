@@ -7,6 +7,10 @@
 
 #pragma once
 
+#include <fbjni/ByteBuffer.h>
+
+#include <vector>
+
 #include "NativeArray.h"
 
 #include "NativeCommon.h"
@@ -37,6 +41,11 @@ class ReadableNativeArray
 
   jni::local_ref<jni::JArrayClass<jobject>> importArray();
   jni::local_ref<jni::JArrayClass<jobject>> importTypeArray();
+  jni::local_ref<jni::JByteBuffer> importByteBuffer();
+
+ private:
+  // Backs the buffer returned by `importByteBuffer`.
+  std::vector<uint8_t> buffer_;
 };
 
 } // namespace facebook::react
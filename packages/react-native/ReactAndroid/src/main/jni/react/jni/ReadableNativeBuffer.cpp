@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ReadableNativeBuffer.h"
+
+#include <cstring>
+#include <string>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr size_t kHeaderSize = 4;
+constexpr size_t kBucketSize = 16;
+constexpr size_t kKeyOffset = 4;
+constexpr size_t kValueOffset = 8;
+
+// Matches the order of com.facebook.react.bridge.ReadableType.
+enum class BufferValueType : int32_t {
+  Null = 0,
+  Boolean = 1,
+  Number = 2,
+  String = 3,
+  Map = 4,
+  Array = 5,
+};
+
+class BufferWriter {
+ public:
+  std::vector<uint8_t> bytes;
+
+  int32_t writeContainer(const folly::dynamic& container) {
+    auto count = container.size();
+    auto offset = allocate(kHeaderSize + count * kBucketSize);
+    writeAt(offset, static_cast<int32_t>(count));
+
+    auto bucket = offset + kHeaderSize;
+    if (container.isObject()) {
+      for (const auto& pair : container.items()) {
+        auto keyOffset = writeString(pair.first.asString());
+        writeBucket(bucket, keyOffset, pair.second);
+        bucket += kBucketSize;
+      }
+    } else {
+      for (const auto& value : container) {
+        writeBucket(bucket, -1, value);
+        bucket += kBucketSize;
+      }
+    }
+    return static_cast<int32_t>(offset);
+  }
+
+ private:
+  size_t allocate(size_t size) {
+    auto offset = bytes.size();
+    bytes.resize(offset + size);
+    return offset;
+  }
+
+  template <typename T>
+  void writeAt(size_t offset, T value) {
+    std::memcpy(bytes.data() + offset, &value, sizeof(T));
+  }
+
+  int32_t writeString(const std::string& string) {
+    auto offset = allocate(sizeof(int32_t) + string.size());
+    writeAt(offset, static_cast<int32_t>(string.size()));
+    std::memcpy(
+        bytes.data() + offset + sizeof(int32_t), string.data(), string.size());
+    return static_cast<int32_t>(offset);
+  }
+
+  // Nested strings and containers are written before the bucket, as writing
+  // them may reallocate the buffer.
+  void
+  writeBucket(size_t bucket, int32_t keyOffset, const folly::dynamic& dyn) {
+    auto type = BufferValueType::Null;
+    int64_t value = 0;
+    switch (dyn.type()) {
+      case folly::dynamic::Type::BOOL:
+        type = BufferValueType::Boolean;
+        value = dyn.getBool() ? 1 : 0;
+        break;
+      case folly::dynamic::Type::INT64: {
+        // All numbers going to Java are doubles, as in `addDynamicToJArray`.
+        type = BufferValueType::Number;
+        auto number = static_cast<double>(dyn.getInt());
+        std::memcpy(&value, &number, sizeof(value));
+        break;
+      }
+      case folly::dynamic::Type::DOUBLE: {
+        type = BufferValueType::Number;
+        auto number = dyn.getDouble();
+        std::memcpy(&value, &number, sizeof(value));
+        break;
+      }
+      case folly::dynamic::Type::STRING:
+        type = BufferValueType::String;
+        value = writeString(dyn.getString());
+        break;
+      case folly::dynamic::Type::OBJECT:
+        type = BufferValueType::Map;
+        value = writeContainer(dyn);
+        break;
+      case folly::dynamic::Type::ARRAY:
+        type = BufferValueType::Array;
+        value = writeContainer(dyn);
+        break;
+      default:
+        break;
+    }
+    writeAt(bucket, static_cast<int32_t>(type));
+    writeAt(bucket + kKeyOffset, keyOffset);
+    writeAt(bucket + kValueOffset, value);
+  }
+};
+
+} // namespace
+
+std::vector<uint8_t> serializeDynamicToBuffer(const folly::dynamic& container) {
+  auto writer = BufferWriter{};
+  writer.writeContainer(container);
+  return std::move(writer.bytes);
+}
+
+} // namespace facebook::react
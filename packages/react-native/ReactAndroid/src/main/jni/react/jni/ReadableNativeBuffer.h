@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <folly/dynamic.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Serializes a map or an array into a single buffer that Java reads lazily
+ * through `ReadableBufferMap` and `ReadableBufferArray`, so that the whole
+ * value crosses JNI at once and no value is boxed until it is read.
+ *
+ * All values are in native byte order. A container is an int32 number of
+ * entries followed by one 16-byte bucket per entry:
+ *  - int32 type, as the ordinal of `ReadableType`;
+ *  - int32 offset of the key (-1 for array elements);
+ *  - int64 value: 0 or 1 for booleans, the bits of a double for numbers, or
+ *    the offset of a string or of a nested container.
+ * A string is an int32 byte length followed by its UTF-8 bytes. Offsets are
+ * from the start of the buffer, and the top-level container is at offset 0.
+ */
+std::vector<uint8_t> serializeDynamicToBuffer(const folly::dynamic& container);
+
+} // namespace facebook::react
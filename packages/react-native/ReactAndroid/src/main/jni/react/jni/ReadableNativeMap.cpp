@@ -7,6 +7,8 @@
 
 #include "ReadableNativeMap.h"
 
+#include "ReadableNativeBuffer.h"
+
 using namespace facebook::jni;
 
 namespace facebook::react {
@@ -101,6 +103,18 @@ local_ref<JArrayClass<jobject>> ReadableNativeMap::importTypes() {
   return jarray;
 }
 
+local_ref<JByteBuffer> ReadableNativeMap::importByteBuffer() {
+  throwIfConsumed();
+
+  // Buffers returned earlier point to `buffer_`, so it's only written once.
+  if (buffer_.empty()) {
+    buffer_ = map_ == nullptr
+        ? serializeDynamicToBuffer(folly::dynamic::object())
+        : serializeDynamicToBuffer(map_);
+  }
+  return JByteBuffer::wrapBytes(buffer_.data(), buffer_.size());
+}
+
 local_ref<ReadableNativeMap::jhybridobject>
 ReadableNativeMap::createWithContents(folly::dynamic&& map) {
   if (map.isNull()) {
@@ -122,6 +136,8 @@ void ReadableNativeMap::registerNatives() {
       makeNativeMethod("importKeys", ReadableNativeMap::importKeys),
       makeNativeMethod("importValues", ReadableNativeMap::importValues),
       makeNativeMethod("importTypes", ReadableNativeMap::importTypes),
+      makeNativeMethod(
+          "importByteBuffer", ReadableNativeMap::importByteBuffer),
   });
 }
 
@@ -7,10 +7,12 @@
 
 #pragma once
 
+#include <fbjni/ByteBuffer.h>
 #include <fbjni/fbjni.h>
 #include <folly/dynamic.h>
 #include <folly/json.h>
 #include <optional>
+#include <vector>
 
 #include "NativeCommon.h"
 #include "NativeMap.h"
@@ -37,7 +39,10 @@ struct ReadableNativeMap : jni::HybridClass<ReadableNativeMap, NativeMap> {
   jni::local_ref<jni::JArrayClass<jstring>> importKeys();
   jni::local_ref<jni::JArrayClass<jobject>> importValues();
   jni::local_ref<jni::JArrayClass<jobject>> importTypes();
+  jni::local_ref<jni::JByteBuffer> importByteBuffer();
   std::optional<folly::dynamic> keys_;
+  // Backs the buffer returned by `importByteBuffer`.
+  std::vector<uint8_t> buffer_;
   static jni::local_ref<jhybridobject> createWithContents(folly::dynamic&& map);
 
   static void mapException(std::exception_ptr ex);
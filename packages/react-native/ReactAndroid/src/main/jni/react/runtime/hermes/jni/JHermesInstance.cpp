@@ -7,6 +7,7 @@
 
 #include "JHermesInstance.h"
 
+#include <HermesBytecodeCache.h>
 #include <fbjni/fbjni.h>
 #include <react/fabric/ReactNativeConfigHolder.h>
 
@@ -14,12 +15,17 @@ namespace facebook::react {
 
 jni::local_ref<JHermesInstance::jhybriddata> JHermesInstance::initHybrid(
     jni::alias_ref<jclass> /* unused */,
-    jni::alias_ref<jobject> reactNativeConfig) {
+    jni::alias_ref<jobject> reactNativeConfig,
+    jni::alias_ref<jni::JString> bytecodeCacheDirectory) {
   std::shared_ptr<const ReactNativeConfig> config = reactNativeConfig != nullptr
       ? std::make_shared<const ReactNativeConfigHolder>(reactNativeConfig)
       : nullptr;
+  auto bytecodeCache = bytecodeCacheDirectory != nullptr
+      ? std::make_shared<HermesBytecodeCache>(
+            bytecodeCacheDirectory->toStdString())
+      : nullptr;
 
-  return makeCxxInstance(config);
+  return makeCxxInstance(config, bytecodeCache);
 }
 
 void JHermesInstance::registerNatives() {
@@ -31,7 +37,7 @@ void JHermesInstance::registerNatives() {
 std::unique_ptr<JSRuntime> JHermesInstance::createJSRuntime(
     std::shared_ptr<MessageQueueThread> msgQueueThread) noexcept {
   return HermesInstance::createJSRuntime(
-      reactNativeConfig_, nullptr, msgQueueThread);
+      reactNativeConfig_, nullptr, msgQueueThread, bytecodeCache_);
 }
 
 } // namespace facebook::react
@@ -28,12 +28,16 @@ class JHermesInstance
 
   static jni::local_ref<jhybriddata> initHybrid(
       jni::alias_ref<jclass> /* unused */,
-      jni::alias_ref<jobject> reactNativeConfig);
+      jni::alias_ref<jobject> reactNativeConfig,
+      jni::alias_ref<jni::JString> bytecodeCacheDirectory);
 
   static void registerNatives();
 
-  JHermesInstance(std::shared_ptr<const ReactNativeConfig> reactNativeConfig)
-      : reactNativeConfig_(reactNativeConfig){};
+  JHermesInstance(
+      std::shared_ptr<const ReactNativeConfig> reactNativeConfig,
+      std::shared_ptr<HermesBytecodeCache> bytecodeCache)
+      : reactNativeConfig_(reactNativeConfig),
+        bytecodeCache_(std::move(bytecodeCache)){};
 
   std::unique_ptr<JSRuntime> createJSRuntime(
       std::shared_ptr<MessageQueueThread> msgQueueThread) noexcept;
@@ -44,6 +48,7 @@ class JHermesInstance
   friend HybridBase;
 
   std::shared_ptr<const ReactNativeConfig> reactNativeConfig_;
+  std::shared_ptr<HermesBytecodeCache> bytecodeCache_;
 };
 
 } // namespace facebook::react
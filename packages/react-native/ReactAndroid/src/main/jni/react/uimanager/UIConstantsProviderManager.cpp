@@ -26,14 +26,16 @@ UIConstantsProviderManager::UIConstantsProviderManager(
         defaultExportableEventTypesProvider,
     jni::alias_ref<ConstantsForViewManagerProvider::javaobject>
         constantsForViewManagerProvider,
-    jni::alias_ref<ConstantsProvider::javaobject> constantsProvider)
+    jni::alias_ref<ConstantsProvider::javaobject> constantsProvider,
+    std::shared_ptr<NativeViewConfigCache> viewConfigCache)
     : javaPart_(jni::make_global(jThis)),
       runtimeExecutor_(runtimeExecutor),
       defaultExportableEventTypesProvider_(
           jni::make_global(defaultExportableEventTypesProvider)),
       constantsForViewManagerProvider_(
           jni::make_global(constantsForViewManagerProvider)),
-      constantsProvider_(jni::make_global(constantsProvider)) {}
+      constantsProvider_(jni::make_global(constantsProvider)),
+      viewConfigCache_(std::move(viewConfigCache)) {}
 
 jni::local_ref<UIConstantsProviderManager::jhybriddata>
 UIConstantsProviderManager::initHybrid(
@@ -43,13 +45,23 @@ UIConstantsProviderManager::initHybrid(
         defaultExportableEventTypesProvider,
     jni::alias_ref<ConstantsForViewManagerProvider::javaobject>
         constantsForViewManagerProvider,
-    jni::alias_ref<ConstantsProvider::javaobject> constantsProvider) {
+    jni::alias_ref<ConstantsProvider::javaobject> constantsProvider,
+    jni::alias_ref<jni::JString> viewConfigCachePath,
+    jni::alias_ref<jni::JString> viewConfigCacheConfiguration) {
+  auto viewConfigCache = viewConfigCachePath != nullptr
+      ? std::make_shared<NativeViewConfigCache>(
+            viewConfigCachePath->toStdString(),
+            viewConfigCacheConfiguration != nullptr
+                ? viewConfigCacheConfiguration->toStdString()
+                : "")
+      : nullptr;
   return makeCxxInstance(
       jThis,
       runtimeExecutor->cthis()->get(),
       defaultExportableEventTypesProvider,
       constantsForViewManagerProvider,
-      constantsProvider);
+      constantsProvider,
+      std::move(viewConfigCache));
 }
 
 void UIConstantsProviderManager::registerNatives() {
@@ -85,7 +97,8 @@ void UIConstantsProviderManager::installJSIBindings() {
     LegacyUIManagerConstantsProviderBinding::install(
         runtime,
         "getConstantsForViewManager",
-        std::move(jsiConstantsForViewManagerProvider));
+        std::move(jsiConstantsForViewManagerProvider),
+        thizz->viewConfigCache_);
 
     LegacyUIManagerConstantsProviderBinding::install(
         runtime, "getConstants", std::move(jsiConstantsProvider));
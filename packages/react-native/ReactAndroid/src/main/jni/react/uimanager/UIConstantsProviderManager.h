@@ -13,6 +13,7 @@
 #include <jsi/jsi.h>
 #include <react/jni/JRuntimeExecutor.h>
 #include <react/jni/NativeMap.h>
+#include <react/runtime/nativeviewconfig/NativeViewConfigCache.h>
 
 namespace facebook::react {
 
@@ -81,8 +82,10 @@ class UIConstantsProviderManager
           defaultExportableEventTypesProvider,
       facebook::jni::alias_ref<ConstantsForViewManagerProvider::javaobject>
           constantsForViewManagerProvider,
-      facebook::jni::alias_ref<ConstantsProvider::javaobject>
-          constantsProvider);
+      facebook::jni::alias_ref<ConstantsProvider::javaobject> constantsProvider,
+      facebook::jni::alias_ref<facebook::jni::JString> viewConfigCachePath,
+      facebook::jni::alias_ref<facebook::jni::JString>
+          viewConfigCacheConfiguration);
 
   static void registerNatives();
 
@@ -96,6 +99,7 @@ class UIConstantsProviderManager
   facebook::jni::global_ref<ConstantsForViewManagerProvider::javaobject>
       constantsForViewManagerProvider_;
   facebook::jni::global_ref<ConstantsProvider::javaobject> constantsProvider_;
+  std::shared_ptr<NativeViewConfigCache> viewConfigCache_;
 
   void installJSIBindings();
 
@@ -106,8 +110,8 @@ class UIConstantsProviderManager
           defaultExportableEventTypesProvider,
       facebook::jni::alias_ref<ConstantsForViewManagerProvider::javaobject>
           constantsForViewManagerProvider,
-      facebook::jni::alias_ref<ConstantsProvider::javaobject>
-          constantsProvider);
+      facebook::jni::alias_ref<ConstantsProvider::javaobject> constantsProvider,
+      std::shared_ptr<NativeViewConfigCache> viewConfigCache);
 };
 
 } // namespace facebook::react
@@ -15,6 +15,7 @@
 #include "MethodCall.h"
 #include "NativeToJsBridge.h"
 #include "RAMBundleRegistry.h"
+#include "ReactMarker.h"
 #include "RecoverableError.h"
 #include "SystraceSection.h"
 
@@ -49,6 +50,10 @@ void Instance::unregisterFromInspector() {
   }
 }
 
+jsinspector_modern::CollectedTraceEvents Instance::collectTraceEvents() {
+  return {ReactMarker::MarkerTimeline::getInstance().getTraceEvents()};
+}
+
 void Instance::initializeBridge(
     std::unique_ptr<InstanceCallback> callback,
     std::shared_ptr<JSExecutorFactory> jsef,
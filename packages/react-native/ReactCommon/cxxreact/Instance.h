@@ -141,6 +141,9 @@ class RN_EXPORT Instance : private jsinspector_modern::InstanceTargetDelegate {
   void unregisterFromInspector();
 
  private:
+  // jsinspector_modern::InstanceTargetDelegate methods
+  jsinspector_modern::CollectedTraceEvents collectTraceEvents() override;
+
   void callNativeModules(folly::dynamic&& calls, bool isEndOfBatch);
   void loadBundle(
       std::unique_ptr<RAMBundleRegistry> bundleRegistry,
@@ -15,10 +15,74 @@
 #include <folly/portability/SysStat.h>
 #include <folly/portability/Unistd.h>
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 
 namespace facebook::react {
 
+namespace {
+
+// A JSBigString which owns the buffer of a JSBigStringBuilder, of which only
+// the first `size` bytes are used.
+class JSBigBuiltString : public JSBigString {
+ public:
+  JSBigBuiltString(std::unique_ptr<char[]> data, size_t size)
+      : m_data(std::move(data)), m_size(size) {}
+
+  bool isAscii() const override {
+    return false;
+  }
+
+  const char* c_str() const override {
+    return m_data.get();
+  }
+
+  size_t size() const override {
+    return m_size;
+  }
+
+ private:
+  std::unique_ptr<char[]> m_data;
+  size_t m_size;
+};
+
+} // namespace
+
+JSBigStringBuilder::JSBigStringBuilder(size_t expectedSize)
+    : m_size(0), m_capacity(0) {
+  reserve(expectedSize);
+}
+
+void JSBigStringBuilder::append(const char* data, size_t size) {
+  if (m_size + size > m_capacity) {
+    reserve(std::max(m_size + size, m_capacity * 2));
+  }
+  std::memcpy(m_data.get() + m_size, data, size);
+  m_size += size;
+}
+
+std::unique_ptr<const JSBigString> JSBigStringBuilder::build() {
+  if (!m_data) {
+    reserve(0);
+  }
+  m_data[m_size] = '\0';
+  auto string = std::make_unique<JSBigBuiltString>(std::move(m_data), m_size);
+  m_size = 0;
+  m_capacity = 0;
+  return string;
+}
+
+void JSBigStringBuilder::reserve(size_t capacity) {
+  // One more byte for the nul-termination.
+  auto data = std::make_unique<char[]>(capacity + 1);
+  if (m_size > 0) {
+    std::memcpy(data.get(), m_data.get(), m_size);
+  }
+  m_data = std::move(data);
+  m_capacity = capacity;
+}
+
 JSBigFileString::JSBigFileString(int fd, size_t size, off_t offset /*= 0*/)
     : m_fd{-1}, m_data{nullptr} {
   m_fd = dup(fd);
@@ -38,7 +102,7 @@ JSBigFileString::JSBigFileString(int fd, size_t size, off_t offset /*= 0*/)
     const static auto ps = sysconf(_SC_PAGESIZE);
     auto d = lldiv(offset, ps);
 
-    m_mapOff = static_cast<off_t>(d.quot);
+    m_mapOff = static_cast<off_t>(d.quot * ps);
     m_pageOff = static_cast<off_t>(d.rem);
     m_size = size + m_pageOff;
   } else {
@@ -86,8 +150,77 @@ int JSBigFileString::fd() const {
   return m_fd;
 }
 
+void JSBigFileString::prefetchPages(
+    const std::vector<size_t>& pageIndices) const {
+  const static auto ps = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  auto pageCount = (m_size + ps - 1) / ps;
+
+  // Coalesces runs of consecutive pages, so that they are advised at once.
+  size_t i = 0;
+  while (i < pageIndices.size()) {
+    auto firstPage = pageIndices[i++];
+    auto lastPage = firstPage;
+    while (i < pageIndices.size() && pageIndices[i] == lastPage + 1) {
+      lastPage = pageIndices[i++];
+    }
+    if (firstPage >= pageCount) {
+      continue;
+    }
+    lastPage = std::min(lastPage, pageCount - 1);
+    adviseWillNeed(firstPage * ps, (lastPage - firstPage + 1) * ps);
+  }
+}
+
+void JSBigFileString::prefetch() const {
+  adviseWillNeed(0, m_size);
+}
+
+std::vector<size_t> JSBigFileString::residentPages() const {
+  std::vector<size_t> pageIndices;
+#ifndef _WIN32
+  if (m_size == 0) {
+    return pageIndices;
+  }
+  c_str();
+
+  const static auto ps = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  auto pageCount = (m_size + ps - 1) / ps;
+#ifdef __APPLE__
+  std::vector<char> residency(pageCount);
+#else
+  std::vector<unsigned char> residency(pageCount);
+#endif
+  if (mincore((void*)m_data, m_size, residency.data()) != 0) {
+    LOG(WARNING) << "JSBigFileString::residentPages - mincore failed: "
+                 << std::strerror(errno);
+    return pageIndices;
+  }
+
+  for (size_t i = 0; i < pageCount; i++) {
+    if (residency[i] & 1) {
+      pageIndices.push_back(i);
+    }
+  }
+#endif
+  return pageIndices;
+}
+
+void JSBigFileString::adviseWillNeed(size_t offset, size_t length) const {
+  if (m_size == 0) {
+    return;
+  }
+  c_str();
+
+  length = std::min(length, m_size - offset);
+  if (madvise((void*)(m_data + offset), length, MADV_WILLNEED) != 0) {
+    LOG(WARNING) << "JSBigFileString - madvise failed: "
+                 << std::strerror(errno);
+  }
+}
+
 std::unique_ptr<const JSBigFileString> JSBigFileString::fromPath(
-    const std::string& sourceURL) {
+    const std::string& sourceURL,
+    PrefetchPolicy prefetchPolicy) {
   int fd = ::open(sourceURL.c_str(), O_RDONLY);
 
   if (fd == -1) {
@@ -111,6 +244,10 @@ std::unique_ptr<const JSBigFileString> JSBigFileString::fromPath(
 
   auto ptr = std::make_unique<const JSBigFileString>(fd, fileInfo.st_size);
   CHECK(::close(fd) == 0);
+
+  if (prefetchPolicy == PrefetchPolicy::WholeFile) {
+    ptr->prefetch();
+  }
   return ptr;
 }
 
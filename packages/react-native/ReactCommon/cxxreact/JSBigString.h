@@ -9,6 +9,11 @@
 
 #include <folly/Exception.h>
 
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
 #ifndef RN_EXPORT
 #ifdef _MSC_VER
 #define RN_EXPORT
@@ -106,9 +111,90 @@ class RN_EXPORT JSBigBufferString : public JSBigString {
   size_t m_size;
 };
 
+// Concrete JSBigString implementation which borrows memory owned by someone
+// else, such as a buffer mapped or downloaded by the platform, instead of
+// copying it. `release` is called once the string is destroyed, and should
+// give up the ownership of the memory. The memory doesn't need to be
+// nul-terminated.
+class RN_EXPORT JSBigExternalString : public JSBigString {
+ public:
+  JSBigExternalString(
+      const char* data,
+      size_t size,
+      std::function<void()> release,
+      bool isAscii = false)
+      : m_data(data),
+        m_size(size),
+        m_release(std::move(release)),
+        m_isAscii(isAscii) {}
+
+  ~JSBigExternalString() override {
+    if (m_release) {
+      m_release();
+    }
+  }
+
+  bool isAscii() const override {
+    return m_isAscii;
+  }
+
+  const char* c_str() const override {
+    return m_data;
+  }
+
+  size_t size() const override {
+    return m_size;
+  }
+
+ private:
+  const char* m_data;
+  size_t m_size;
+  std::function<void()> m_release;
+  bool m_isAscii;
+};
+
+// Builds a JSBigString from chunks which arrive over time, such as a bundle
+// which is being downloaded, in a single buffer. When the expected size is
+// known up front (e.g. from a Content-Length header), the chunks are written
+// in place and the complete string is handed over without being copied.
+class RN_EXPORT JSBigStringBuilder {
+ public:
+  explicit JSBigStringBuilder(size_t expectedSize = 0);
+
+  // Not copyable
+  JSBigStringBuilder(const JSBigStringBuilder&) = delete;
+  JSBigStringBuilder& operator=(const JSBigStringBuilder&) = delete;
+
+  void append(const char* data, size_t size);
+
+  // The number of bytes appended so far.
+  size_t size() const {
+    return m_size;
+  }
+
+  // Returns the appended bytes, and resets the builder.
+  std::unique_ptr<const JSBigString> build();
+
+ private:
+  void reserve(size_t capacity);
+
+  std::unique_ptr<char[]> m_data;
+  size_t m_size;
+  size_t m_capacity;
+};
+
 // JSBigString interface implemented by a file-backed mmap region.
 class RN_EXPORT JSBigFileString : public JSBigString {
  public:
+  // How the pages of the file are read ahead of their first access.
+  enum class PrefetchPolicy {
+    // Pages are read from the file as they are accessed.
+    None,
+    // The whole file is read ahead in the background as soon as it is
+    // mapped (MADV_WILLNEED).
+    WholeFile,
+  };
+
   JSBigFileString(int fd, size_t size, off_t offset = 0);
   ~JSBigFileString() override;
 
@@ -121,8 +207,21 @@ class RN_EXPORT JSBigFileString : public JSBigString {
   size_t size() const override;
   int fd() const;
 
+  // Asks the kernel to read the pages of the mapped region with the given
+  // indices ahead of their first access, without blocking. This is meant to
+  // replay the pages returned by `residentPages` during a previous launch.
+  void prefetchPages(const std::vector<size_t>& pageIndices) const;
+
+  // Prefetches all the pages of the mapped region.
+  void prefetch() const;
+
+  // Returns the indices of the pages of the mapped region which are in memory,
+  // e.g. the pages that evaluating the bundle accessed so far.
+  std::vector<size_t> residentPages() const;
+
   static std::unique_ptr<const JSBigFileString> fromPath(
-      const std::string& sourceURL);
+      const std::string& sourceURL,
+      PrefetchPolicy prefetchPolicy = PrefetchPolicy::None);
 
  private:
   int m_fd; // The file descriptor being mmapped
@@ -130,6 +229,8 @@ class RN_EXPORT JSBigFileString : public JSBigString {
   mutable off_t m_pageOff; // The offset in the mmapped region to the data.
   off_t m_mapOff; // The offset in the file to the mmapped region.
   mutable const char* m_data; // Pointer to the mmapped region.
+
+  void adviseWillNeed(size_t offset, size_t length) const;
 };
 
 } // namespace facebook::react
@@ -16,6 +16,27 @@
 
 namespace facebook::react {
 
+void ExecutorDelegate::callNativeModules(
+    JSExecutor& executor,
+    std::vector<MethodCall>&& calls,
+    bool isEndOfBatch) {
+  // Builds the queue in the format of MessageQueue.flushedQueue().
+  auto moduleIds = folly::dynamic::array();
+  auto methodIds = folly::dynamic::array();
+  auto params = folly::dynamic::array();
+  for (auto& call : calls) {
+    moduleIds.push_back(call.moduleId);
+    methodIds.push_back(call.methodId);
+    params.push_back(std::move(call.arguments));
+  }
+  auto queue = folly::dynamic::array(
+      std::move(moduleIds), std::move(methodIds), std::move(params));
+  if (!calls.empty() && calls.front().callId != -1) {
+    queue.push_back(calls.front().callId);
+  }
+  callNativeModules(executor, std::move(queue), isEndOfBatch);
+}
+
 std::string JSExecutor::getSyntheticBundlePath(
     uint32_t bundleId,
     const std::string& bundlePath) {
@@ -25,6 +46,12 @@ std::string JSExecutor::getSyntheticBundlePath(
   return folly::to<std::string>("seg-", bundleId, ".js");
 }
 
+void JSExecutor::callFunctions(const std::vector<JSFunctionCall>& calls) {
+  for (const auto& call : calls) {
+    callFunction(call.moduleId, call.methodId, call.arguments);
+  }
+}
+
 double JSExecutor::performanceNow() {
   auto time = std::chrono::steady_clock::now();
   auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
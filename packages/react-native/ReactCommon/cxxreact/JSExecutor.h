@@ -9,7 +9,9 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
+#include <cxxreact/MethodCall.h>
 #include <cxxreact/NativeModule.h>
 #include <folly/dynamic.h>
 #include <jsinspector-modern/InspectorInterfaces.h>
@@ -28,6 +30,12 @@ class MessageQueueThread;
 class ModuleRegistry;
 class RAMBundleRegistry;
 
+struct JSFunctionCall {
+  std::string moduleId;
+  std::string methodId;
+  folly::dynamic arguments;
+};
+
 // This interface describes the delegate interface required by
 // Executor implementations to call from JS into native code.
 class ExecutorDelegate {
@@ -40,6 +48,12 @@ class ExecutorDelegate {
       JSExecutor& executor,
       folly::dynamic&& calls,
       bool isEndOfBatch) = 0;
+  // Like the above, for executors which parse the queue of calls themselves
+  // (e.g. straight from JSI values) instead of converting it to dynamic.
+  virtual void callNativeModules(
+      JSExecutor& executor,
+      std::vector<MethodCall>&& calls,
+      bool isEndOfBatch);
   virtual MethodCallResult callSerializableNativeHook(
       JSExecutor& executor,
       unsigned int moduleId,
@@ -93,6 +107,13 @@ class RN_EXPORT JSExecutor : public jsinspector_modern::RuntimeTargetDelegate {
       const std::string& methodId,
       const folly::dynamic& arguments) = 0;
 
+  /**
+   * Executes the calls in order like callFunction. Executors may make them
+   * within a single call into JS, and call Bridge->callNativeModules once
+   * with the native calls made by all of them.
+   */
+  virtual void callFunctions(const std::vector<JSFunctionCall>& calls);
+
   /**
    * Executes BatchedBridge.invokeCallbackAndReturnFlushedQueue with the cbID,
    * and optional additional arguments in JS and returns the next queue. The
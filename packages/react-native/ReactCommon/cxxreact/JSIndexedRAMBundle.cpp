@@ -21,7 +21,8 @@ JSIndexedRAMBundle::buildFactory() {
   };
 }
 
-JSIndexedRAMBundle::JSIndexedRAMBundle(const char* sourcePath) {
+JSIndexedRAMBundle::JSIndexedRAMBundle(const char* sourcePath)
+    : m_sourcePath(sourcePath) {
   m_bundle = std::make_unique<std::ifstream>(sourcePath, std::ifstream::binary);
   if (!m_bundle) {
     throw std::ios_base::failure(folly::to<std::string>(
@@ -45,6 +46,13 @@ JSIndexedRAMBundle::JSIndexedRAMBundle(
   init();
 }
 
+JSIndexedRAMBundle::~JSIndexedRAMBundle() {
+  m_isPrefetchCancelled = true;
+  for (auto& thread : m_prefetchThreads) {
+    thread.join();
+  }
+}
+
 void JSIndexedRAMBundle::init() {
   // read in magic header, number of entries, and length of the startup section
   uint32_t header[3];
@@ -52,7 +60,7 @@ void JSIndexedRAMBundle::init() {
       sizeof(header) == 12,
       "header size must exactly match the input file format");
 
-  readBundle(reinterpret_cast<char*>(header), sizeof(header));
+  readBundle(*m_bundle, reinterpret_cast<char*>(header), sizeof(header));
   const size_t numTableEntries = folly::Endian::little(header[1]);
   const size_t startupCodeSize = folly::Endian::little(header[2]);
 
@@ -61,23 +69,89 @@ void JSIndexedRAMBundle::init() {
   m_baseOffset = sizeof(header) + m_table.byteLength();
 
   // read the lookup table from the file
-  readBundle(reinterpret_cast<char*>(m_table.data.get()), m_table.byteLength());
+  readBundle(
+      *m_bundle,
+      reinterpret_cast<char*>(m_table.data.get()),
+      m_table.byteLength());
 
   // read the startup code
   m_startupCode = std::unique_ptr<JSBigBufferString>(
       new JSBigBufferString{startupCodeSize - 1});
 
-  readBundle(m_startupCode->data(), startupCodeSize - 1);
+  readBundle(*m_bundle, m_startupCode->data(), startupCodeSize - 1);
 }
 
 JSIndexedRAMBundle::Module JSIndexedRAMBundle::getModule(
     uint32_t moduleId) const {
   Module ret;
   ret.name = folly::to<std::string>(moduleId, ".js");
+  {
+    std::scoped_lock lock(m_prefetchMutex);
+    auto it = m_prefetchedModules.find(moduleId);
+    if (it != m_prefetchedModules.end()) {
+      ret.code = std::move(it->second);
+      m_prefetchedModules.erase(it);
+      return ret;
+    }
+    if (!m_prefetchThreads.empty()) {
+      m_requiredModules.insert(moduleId);
+    }
+  }
   ret.code = getModuleCode(moduleId);
   return ret;
 }
 
+void JSIndexedRAMBundle::prefetchModules(
+    std::vector<uint32_t> moduleIds,
+    size_t threadCount) {
+  if (m_sourcePath.empty() || !m_prefetchThreads.empty()) {
+    return;
+  }
+
+  // Every thread reads from its own stream, taking the next module of the
+  // list until all of them are read. The list is shared by the threads.
+  auto sharedModuleIds =
+      std::make_shared<const std::vector<uint32_t>>(std::move(moduleIds));
+  for (size_t i = 0; i < threadCount; i++) {
+    m_prefetchThreads.emplace_back([this, sharedModuleIds]() {
+      prefetchModulesFromFile(*sharedModuleIds);
+    });
+  }
+}
+
+void JSIndexedRAMBundle::prefetchModulesFromFile(
+    const std::vector<uint32_t>& moduleIds) {
+  std::ifstream bundle(m_sourcePath, std::ifstream::binary);
+  if (!bundle) {
+    LOG(WARNING) << "Bundle " << m_sourcePath
+                 << " cannot be opened to prefetch modules";
+    return;
+  }
+
+  while (!m_isPrefetchCancelled) {
+    auto index = m_nextPrefetchIndex++;
+    if (index >= moduleIds.size()) {
+      return;
+    }
+
+    auto moduleId = moduleIds[index];
+    std::string code;
+    try {
+      code = getModuleCode(moduleId, bundle);
+    } catch (const std::exception& e) {
+      LOG(WARNING) << "Error prefetching module " << moduleId << ": "
+                   << e.what();
+      // The stream can't be read from anymore after a failure.
+      return;
+    }
+
+    std::scoped_lock lock(m_prefetchMutex);
+    if (m_requiredModules.count(moduleId) == 0) {
+      m_prefetchedModules.emplace(moduleId, std::move(code));
+    }
+  }
+}
+
 std::unique_ptr<const JSBigString> JSIndexedRAMBundle::getStartupCode() {
   CHECK(m_startupCode)
       << "startup code for a RAM Bundle can only be retrieved once";
@@ -85,6 +159,12 @@ std::unique_ptr<const JSBigString> JSIndexedRAMBundle::getStartupCode() {
 }
 
 std::string JSIndexedRAMBundle::getModuleCode(const uint32_t id) const {
+  return getModuleCode(id, *m_bundle);
+}
+
+std::string JSIndexedRAMBundle::getModuleCode(
+    const uint32_t id,
+    std::istream& bundle) const {
   const auto moduleData = id < m_table.numEntries ? &m_table.data[id] : nullptr;
 
   // entries without associated code have offset = 0 and length = 0
@@ -97,32 +177,36 @@ std::string JSIndexedRAMBundle::getModuleCode(const uint32_t id) const {
 
   std::string ret(length - 1, '\0');
   readBundle(
+      bundle,
       &ret.front(),
       length - 1,
       m_baseOffset + folly::Endian::little(moduleData->offset));
   return ret;
 }
 
-void JSIndexedRAMBundle::readBundle(char* buffer, const std::streamsize bytes)
-    const {
-  if (!m_bundle->read(buffer, bytes)) {
-    if (m_bundle->rdstate() & std::ios::eofbit) {
+void JSIndexedRAMBundle::readBundle(
+    std::istream& bundle,
+    char* buffer,
+    const std::streamsize bytes) {
+  if (!bundle.read(buffer, bytes)) {
+    if (bundle.rdstate() & std::ios::eofbit) {
       throw std::ios_base::failure("Unexpected end of RAM Bundle file");
     }
     throw std::ios_base::failure(folly::to<std::string>(
-        "Error reading RAM Bundle: ", m_bundle->rdstate()));
+        "Error reading RAM Bundle: ", bundle.rdstate()));
   }
 }
 
 void JSIndexedRAMBundle::readBundle(
+    std::istream& bundle,
     char* buffer,
     const std::streamsize bytes,
-    const std::ifstream::pos_type position) const {
-  if (!m_bundle->seekg(position)) {
+    const std::ifstream::pos_type position) {
+  if (!bundle.seekg(position)) {
     throw std::ios_base::failure(folly::to<std::string>(
-        "Error reading RAM Bundle: ", m_bundle->rdstate()));
+        "Error reading RAM Bundle: ", bundle.rdstate()));
   }
-  readBundle(buffer, bytes);
+  readBundle(bundle, buffer, bytes);
 }
 
 } // namespace facebook::react
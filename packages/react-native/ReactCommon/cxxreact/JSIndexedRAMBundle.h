@@ -7,8 +7,16 @@
 
 #pragma once
 
+#include <atomic>
+#include <functional>
 #include <istream>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <cxxreact/JSBigString.h>
 #include <cxxreact/JSModulesUnbundle.h>
@@ -27,12 +35,20 @@ class RN_EXPORT JSIndexedRAMBundle : public JSModulesUnbundle {
   // Throws std::runtime_error on failure.
   JSIndexedRAMBundle(const char* sourceURL);
   JSIndexedRAMBundle(std::unique_ptr<const JSBigString> script);
+  ~JSIndexedRAMBundle() override;
 
   // Throws std::runtime_error on failure.
   std::unique_ptr<const JSBigString> getStartupCode();
   // Throws std::runtime_error on failure.
   Module getModule(uint32_t moduleId) const override;
 
+  // Reads the code of the given modules (e.g. the modules that a previous
+  // launch required during startup) on `threadCount` background threads, so
+  // that `getModule` can return them without reading the bundle. This is a
+  // no-op for bundles which were not loaded from a file, since they are in
+  // memory already.
+  void prefetchModules(std::vector<uint32_t> moduleIds, size_t threadCount = 4);
+
  private:
   struct ModuleData {
     uint32_t offset;
@@ -56,16 +72,37 @@ class RN_EXPORT JSIndexedRAMBundle : public JSModulesUnbundle {
 
   void init();
   std::string getModuleCode(const uint32_t id) const;
-  void readBundle(char* buffer, const std::streamsize bytes) const;
-  void readBundle(
+  std::string getModuleCode(const uint32_t id, std::istream& bundle) const;
+  static void readBundle(
+      std::istream& bundle,
+      char* buffer,
+      const std::streamsize bytes);
+  static void readBundle(
+      std::istream& bundle,
       char* buffer,
       const std::streamsize bytes,
-      const std::istream::pos_type position) const;
+      const std::istream::pos_type position);
+  void prefetchModulesFromFile(const std::vector<uint32_t>& moduleIds);
 
   mutable std::unique_ptr<std::istream> m_bundle;
   ModuleTable m_table;
   size_t m_baseOffset;
   std::unique_ptr<JSBigBufferString> m_startupCode;
+
+  // The path of the bundle, if it was loaded from a file.
+  std::string m_sourcePath;
+
+  // State of the prefetching of modules.
+  std::vector<std::thread> m_prefetchThreads;
+  std::atomic<size_t> m_nextPrefetchIndex{0};
+  std::atomic<bool> m_isPrefetchCancelled{false};
+  mutable std::mutex m_prefetchMutex;
+  // Modules read by the prefetch threads, until they are required.
+  // Protected by `m_prefetchMutex`.
+  mutable std::unordered_map<uint32_t, std::string> m_prefetchedModules;
+  // Modules which were already required, and don't need to be kept anymore
+  // once they are prefetched. Protected by `m_prefetchMutex`.
+  mutable std::unordered_set<uint32_t> m_requiredModules;
 };
 
 } // namespace facebook::react
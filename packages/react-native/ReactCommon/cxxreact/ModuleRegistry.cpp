@@ -37,13 +37,62 @@ ModuleRegistry::ModuleRegistry(
     ModuleNotFoundCallback callback)
     : modules_{std::move(modules)}, moduleNotFoundCallback_{callback} {}
 
+ModuleRegistry::~ModuleRegistry() {
+  isPrepareCancelled_ = true;
+  for (auto& thread : prepareThreads_) {
+    thread.join();
+  }
+}
+
 void ModuleRegistry::updateModuleNamesFromIndex(size_t index) {
   for (; index < modules_.size(); index++) {
-    std::string name = normalizeName(modules_[index]->getName());
+    std::string name = normalizeName(getModuleNameAt(index));
     modulesByName_[name] = index;
   }
 }
 
+void ModuleRegistry::registerModuleNamesFromIndex(
+    size_t modulesSize,
+    bool addToNames) {
+  if (!unknownModules_.empty()) {
+    for (size_t index = modulesSize; index < modules_.size(); index++) {
+      std::string name = normalizeName(getModuleNameAt(index));
+      auto it = unknownModules_.find(name);
+      if (it != unknownModules_.end()) {
+        throw std::runtime_error(folly::to<std::string>(
+            "module ",
+            name,
+            " was required without being registered and is now being registered."));
+      } else if (addToNames) {
+        modulesByName_[name] = index;
+      }
+    }
+  } else if (addToNames) {
+    updateModuleNamesFromIndex(modulesSize);
+  }
+}
+
+std::string ModuleRegistry::getModuleNameAt(size_t index) const {
+  if (auto& module = modules_[index]) {
+    return module->getName();
+  }
+  return lazyModules_.at(index).first;
+}
+
+NativeModule& ModuleRegistry::getModuleAt(size_t index) {
+  auto& module = modules_[index];
+  if (!module) {
+    auto it = lazyModules_.find(index);
+    SystraceSection s_(
+        "ModuleRegistry::createLazyModule", "module", it->second.first);
+    module = it->second.second();
+    CHECK(module) << "Factory of module " << it->second.first
+                  << " returned null";
+    lazyModules_.erase(it);
+  }
+  return *module;
+}
+
 void ModuleRegistry::registerModules(
     std::vector<std::unique_ptr<NativeModule>> modules) {
   SystraceSection s_("ModuleRegistry::registerModules");
@@ -60,31 +109,31 @@ void ModuleRegistry::registerModules(
     bool addToNames = !modulesByName_.empty();
     modules_.reserve(modulesSize + addModulesSize);
     std::move(modules.begin(), modules.end(), std::back_inserter(modules_));
-    if (!unknownModules_.empty()) {
-      for (size_t index = modulesSize; index < modulesSize + addModulesSize;
-           index++) {
-        std::string name = normalizeName(modules_[index]->getName());
-        auto it = unknownModules_.find(name);
-        if (it != unknownModules_.end()) {
-          throw std::runtime_error(folly::to<std::string>(
-              "module ",
-              name,
-              " was required without being registered and is now being registered."));
-        } else if (addToNames) {
-          modulesByName_[name] = index;
-        }
-      }
-    } else if (addToNames) {
-      updateModuleNamesFromIndex(modulesSize);
-    }
+    registerModuleNamesFromIndex(modulesSize, addToNames);
   }
 }
 
+void ModuleRegistry::registerLazyModules(
+    std::vector<std::pair<std::string, ModuleFactory>> modules) {
+  SystraceSection s_("ModuleRegistry::registerLazyModules");
+  if (modules.empty()) {
+    return;
+  }
+
+  size_t modulesSize = modules_.size();
+  bool addToNames = !modulesByName_.empty();
+  modules_.resize(modulesSize + modules.size());
+  for (size_t i = 0; i < modules.size(); i++) {
+    lazyModules_.emplace(modulesSize + i, std::move(modules[i]));
+  }
+  registerModuleNamesFromIndex(modulesSize, addToNames);
+}
+
 std::vector<std::string> ModuleRegistry::moduleNames() {
   SystraceSection s_("ModuleRegistry::moduleNames");
   std::vector<std::string> names;
   for (size_t i = 0; i < modules_.size(); i++) {
-    std::string name = normalizeName(modules_[i]->getName());
+    std::string name = normalizeName(getModuleNameAt(i));
     modulesByName_[name] = i;
     names.push_back(std::move(name));
   }
@@ -137,8 +186,121 @@ std::optional<ModuleConfig> ModuleRegistry::getConfig(const std::string& name) {
   size_t index = it->second;
 
   CHECK(index < modules_.size());
-  NativeModule* module = modules_[index].get();
+  std::optional<folly::dynamic> config;
+  if (!takePreparedConfig(index, config)) {
+    config = computeConfig(name, getModuleAt(index));
+  }
+
+  if (!config) {
+    // no constants or methods
+    return std::nullopt;
+  } else {
+    return ModuleConfig{index, std::move(*config)};
+  }
+}
+
+void ModuleRegistry::prepareConfigs(
+    std::vector<std::string> names,
+    size_t threadCount) {
+  SystraceSection s_("ModuleRegistry::prepareConfigs");
+  if (!prepareThreads_.empty()) {
+    return;
+  }
 
+  if (modulesByName_.empty() && !modules_.empty()) {
+    moduleNames();
+  }
+
+  // Modules are created here, so that the threads neither create them nor
+  // access modules_, which may be resized concurrently.
+  auto pending = std::make_shared<std::vector<PendingConfig>>();
+  for (auto& name : names) {
+    auto it = modulesByName_.find(name);
+    if (it == modulesByName_.end()) {
+      continue;
+    }
+    auto index = it->second;
+    pending->push_back({index, std::move(name), &getModuleAt(index)});
+  }
+  if (pending->empty()) {
+    return;
+  }
+
+  {
+    std::scoped_lock lock(prepareMutex_);
+    for (const auto& config : *pending) {
+      queuedConfigs_.insert(config.index);
+    }
+  }
+  for (size_t i = 0; i < threadCount; i++) {
+    prepareThreads_.emplace_back(
+        [this, pending]() { prepareConfigsOnThread(*pending); });
+  }
+}
+
+void ModuleRegistry::prepareConfigsOnThread(
+    const std::vector<PendingConfig>& pending) {
+  while (!isPrepareCancelled_) {
+    auto i = nextPrepareIndex_++;
+    if (i >= pending.size()) {
+      return;
+    }
+
+    const auto& pendingConfig = pending[i];
+    {
+      std::scoped_lock lock(prepareMutex_);
+      if (queuedConfigs_.erase(pendingConfig.index) == 0) {
+        // It was required before it could be prepared.
+        continue;
+      }
+      preparingConfigs_.insert(pendingConfig.index);
+    }
+
+    std::optional<folly::dynamic> config;
+    bool isPrepared = false;
+    try {
+      config = computeConfig(pendingConfig.name, *pendingConfig.module);
+      isPrepared = true;
+    } catch (const std::exception& e) {
+      LOG(WARNING) << "Error preparing config of module "
+                   << pendingConfig.name << ": " << e.what();
+    }
+
+    {
+      std::scoped_lock lock(prepareMutex_);
+      preparingConfigs_.erase(pendingConfig.index);
+      if (isPrepared) {
+        preparedConfigs_.emplace(pendingConfig.index, std::move(config));
+      }
+    }
+    prepareCondition_.notify_all();
+  }
+}
+
+bool ModuleRegistry::takePreparedConfig(
+    size_t index,
+    std::optional<folly::dynamic>& config) {
+  std::unique_lock lock(prepareMutex_);
+  if (queuedConfigs_.erase(index) != 0) {
+    return false;
+  }
+  if (preparingConfigs_.count(index) != 0) {
+    SystraceSection s_("ModuleRegistry::waitForPreparedConfig");
+    prepareCondition_.wait(
+        lock, [&] { return preparingConfigs_.count(index) == 0; });
+  }
+  auto it = preparedConfigs_.find(index);
+  if (it == preparedConfigs_.end()) {
+    return false;
+  }
+  config = std::move(it->second);
+  preparedConfigs_.erase(it);
+  return true;
+}
+
+std::optional<folly::dynamic> ModuleRegistry::computeConfig(
+    const std::string& name,
+    NativeModule& module) {
   // string name, object constants, array methodNames (methodId is index),
   // [array promiseMethodIds], [array syncMethodIds]
   folly::dynamic config = folly::dynamic::array(name);
@@ -151,12 +313,12 @@ std::optional<ModuleConfig> ModuleRegistry::getConfig(const std::string& name) {
      * event. The Module will be initialized when we invoke one of its
      * NativeModule methods.
      */
-    config.push_back(module->getConstants());
+    config.push_back(module.getConstants());
   }
 
   {
     SystraceSection s_("ModuleRegistry::getMethods", "module", name);
-    std::vector<MethodDescriptor> methods = module->getMethods();
+    std::vector<MethodDescriptor> methods = module.getMethods();
 
     folly::dynamic methodNames = folly::dynamic::array;
     folly::dynamic promiseMethodIds = folly::dynamic::array;
@@ -184,11 +346,9 @@ std::optional<ModuleConfig> ModuleRegistry::getConfig(const std::string& name) {
   }
 
   if (config.size() == 2 && config[1].empty()) {
-    // no constants or methods
     return std::nullopt;
-  } else {
-    return ModuleConfig{index, std::move(config)};
   }
+  return config;
 }
 
 std::string ModuleRegistry::getModuleName(unsigned int moduleId) {
@@ -197,7 +357,7 @@ std::string ModuleRegistry::getModuleName(unsigned int moduleId) {
         "moduleId ", moduleId, " out of range [0..", modules_.size(), ")"));
   }
 
-  return modules_[moduleId]->getName();
+  return getModuleNameAt(moduleId);
 }
 
 std::string ModuleRegistry::getModuleSyncMethodName(
@@ -208,7 +368,7 @@ std::string ModuleRegistry::getModuleSyncMethodName(
         "moduleId ", moduleId, " out of range [0..", modules_.size(), ")"));
   }
 
-  return modules_[moduleId]->getSyncMethodName(methodId);
+  return getModuleAt(moduleId).getSyncMethodName(methodId);
 }
 
 void ModuleRegistry::callNativeMethod(
@@ -220,7 +380,7 @@ void ModuleRegistry::callNativeMethod(
     throw std::runtime_error(folly::to<std::string>(
         "moduleId ", moduleId, " out of range [0..", modules_.size(), ")"));
   }
-  modules_[moduleId]->invoke(methodId, std::move(params), callId);
+  getModuleAt(moduleId).invoke(methodId, std::move(params), callId);
 }
 
 MethodCallResult ModuleRegistry::callSerializableNativeHook(
@@ -231,7 +391,7 @@ MethodCallResult ModuleRegistry::callSerializableNativeHook(
     throw std::runtime_error(folly::to<std::string>(
         "moduleId ", moduleId, "out of range [0..", modules_.size(), ")"));
   }
-  return modules_[moduleId]->callSerializableNativeHook(
+  return getModuleAt(moduleId).callSerializableNativeHook(
       methodId, std::move(params));
 }
 
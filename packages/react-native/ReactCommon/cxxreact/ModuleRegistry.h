@@ -7,8 +7,15 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <cxxreact/JSExecutor.h>
@@ -38,14 +45,31 @@ class RN_EXPORT ModuleRegistry {
   // code notifyCatalystInstanceDestroy: use RAII instead
 
   using ModuleNotFoundCallback = std::function<bool(const std::string& name)>;
+  using ModuleFactory = std::function<std::unique_ptr<NativeModule>()>;
 
   ModuleRegistry(
       std::vector<std::unique_ptr<NativeModule>> modules,
       ModuleNotFoundCallback callback = nullptr);
+  ~ModuleRegistry();
   void registerModules(std::vector<std::unique_ptr<NativeModule>> modules);
 
+  // Registers modules by name only. The NativeModule of a module is created
+  // by its factory the first time the module is required from JS or one of
+  // its methods is called, so that a module which is never used is only an
+  // entry in the name table.
+  void registerLazyModules(
+      std::vector<std::pair<std::string, ModuleFactory>> modules);
+
   std::vector<std::string> moduleNames();
 
+  // Creates the given modules (e.g. the modules which may be initialized on
+  // any thread and are required during startup) and computes their configs,
+  // including their constants, on `threadCount` background threads while the
+  // bundle loads. `getConfig` then returns the prepared config, or waits for
+  // it if it is being computed. Unknown names are ignored. This can only be
+  // called once.
+  void prepareConfigs(std::vector<std::string> names, size_t threadCount = 2);
+
   std::optional<ModuleConfig> getConfig(const std::string& name);
 
   void callNativeMethod(
@@ -64,13 +88,40 @@ class RN_EXPORT ModuleRegistry {
       unsigned int methodName);
 
  private:
-  // This is always populated
+  // This is always populated. Entries of lazy modules are null until they are
+  // created.
   std::vector<std::unique_ptr<NativeModule>> modules_;
 
+  // Names and factories of lazy modules which weren't created yet, by index
+  // into modules_.
+  std::unordered_map<size_t, std::pair<std::string, ModuleFactory>>
+      lazyModules_;
+
   // This is used to extend the population of modulesByName_ if registerModules
   // is called after moduleNames
   void updateModuleNamesFromIndex(size_t size);
 
+  // Adds the names of modules from modulesSize on, which were just appended to
+  // modules_, to modulesByName_ if it is populated.
+  void registerModuleNamesFromIndex(size_t modulesSize, bool addToNames);
+
+  std::string getModuleNameAt(size_t index) const;
+  NativeModule& getModuleAt(size_t index);
+
+  struct PendingConfig {
+    size_t index;
+    std::string name;
+    NativeModule* module;
+  };
+
+  static std::optional<folly::dynamic> computeConfig(
+      const std::string& name,
+      NativeModule& module);
+  void prepareConfigsOnThread(const std::vector<PendingConfig>& pending);
+  // Returns whether the config of the module was prepared, waiting for it if
+  // it is being computed. Otherwise the caller has to compute it.
+  bool takePreparedConfig(size_t index, std::optional<folly::dynamic>& config);
+
   // This is only populated if moduleNames() is called.  Values are indices into
   // modules_.
   std::unordered_map<std::string, size_t> modulesByName_;
@@ -85,6 +136,22 @@ class RN_EXPORT ModuleRegistry {
   // again (assuming it's registered) If the function returns false,
   // ModuleRegistry will not try to find the module and return nullptr instead.
   ModuleNotFoundCallback moduleNotFoundCallback_;
+
+  // State of the preparation of configs. A module's config is computed on a
+  // background thread at most once, and before JS can call any method of the
+  // module, since it needs the config to do so.
+  std::vector<std::thread> prepareThreads_;
+  std::atomic<size_t> nextPrepareIndex_{0};
+  std::atomic<bool> isPrepareCancelled_{false};
+  std::mutex prepareMutex_;
+  std::condition_variable prepareCondition_;
+  // Indices of modules whose config wasn't computed yet, and of those whose
+  // config is being computed. Protected by `prepareMutex_`.
+  std::unordered_set<size_t> queuedConfigs_;
+  std::unordered_set<size_t> preparingConfigs_;
+  // Configs computed by the threads, until they are required. Protected by
+  // `prepareMutex_`.
+  std::unordered_map<size_t, std::optional<folly::dynamic>> preparedConfigs_;
 };
 
 } // namespace facebook::react
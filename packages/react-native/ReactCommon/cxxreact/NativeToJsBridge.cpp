@@ -50,15 +50,22 @@ class JsToNativeBridge : public react::ExecutorDelegate {
   }
 
   void callNativeModules(
-      [[maybe_unused]] JSExecutor& executor,
+      JSExecutor& executor,
       folly::dynamic&& calls,
       bool isEndOfBatch) override {
-    CHECK(m_registry || calls.empty())
+    callNativeModules(
+        executor, parseMethodCalls(std::move(calls)), isEndOfBatch);
+  }
+
+  void callNativeModules(
+      [[maybe_unused]] JSExecutor& executor,
+      std::vector<MethodCall>&& methodCalls,
+      bool isEndOfBatch) override {
+    CHECK(m_registry || methodCalls.empty())
         << "native module calls cannot be completed with no native modules";
     m_batchHadNativeModuleOrTurboModuleCalls =
-        m_batchHadNativeModuleOrTurboModuleCalls || !calls.empty();
+        m_batchHadNativeModuleOrTurboModuleCalls || !methodCalls.empty();
 
-    std::vector<MethodCall> methodCalls = parseMethodCalls(std::move(calls));
     BridgeNativeModulePerfLogger::asyncMethodCallBatchPreprocessEnd(
         (int)methodCalls.size());
 
@@ -166,10 +173,51 @@ void NativeToJsBridge::loadBundleSync(
   }
 }
 
+std::atomic<bool> NativeToJsBridge::shouldBatchFunctionCalls_{false};
+
+void NativeToJsBridge::setShouldBatchFunctionCalls(bool value) {
+  shouldBatchFunctionCalls_ = value;
+}
+
 void NativeToJsBridge::callFunction(
     std::string&& module,
     std::string&& method,
     folly::dynamic&& arguments) {
+  if (shouldBatchFunctionCalls_.load(std::memory_order_relaxed)) {
+    std::lock_guard<std::mutex> lock(m_pendingFunctionCallsMutex);
+    if (m_pendingFunctionCalls) {
+      m_pendingFunctionCalls->push_back(
+          {std::move(module), std::move(method), std::move(arguments)});
+      return;
+    }
+
+    auto calls = std::make_shared<std::vector<JSFunctionCall>>();
+    calls->push_back(
+        {std::move(module), std::move(method), std::move(arguments)});
+    m_pendingFunctionCalls = calls;
+    scheduleOnExecutorQueue([this, calls](JSExecutor* executor) {
+      {
+        // No calls are added to the batch from now on.
+        std::lock_guard<std::mutex> lock(m_pendingFunctionCallsMutex);
+        if (m_pendingFunctionCalls == calls) {
+          m_pendingFunctionCalls = nullptr;
+        }
+      }
+
+      if (m_applicationScriptHasFailure) {
+        LOG(ERROR)
+            << "Attempting to call JS functions on a bad application bundle";
+        throw std::runtime_error(
+            "Attempting to call JS functions on a bad application bundle.");
+      }
+
+      SystraceSection s(
+          "NativeToJsBridge::callFunctions", "count", calls->size());
+      executor->callFunctions(*calls);
+    });
+    return;
+  }
+
   int systraceCookie = -1;
 #ifdef WITH_FBSYSTRACE
   systraceCookie = m_systraceCookie++;
@@ -293,6 +341,19 @@ void NativeToJsBridge::runOnExecutorQueue(
     return;
   }
 
+  // Calls of callFunction made after this must run after the task, so they
+  // start a new batch.
+  std::lock_guard<std::mutex> lock(m_pendingFunctionCallsMutex);
+  m_pendingFunctionCalls = nullptr;
+  scheduleOnExecutorQueue(std::move(task));
+}
+
+void NativeToJsBridge::scheduleOnExecutorQueue(
+    std::function<void(JSExecutor*)>&& task) {
+  if (*m_destroyed) {
+    return;
+  }
+
   std::shared_ptr<bool> isDestroyed = m_destroyed;
   m_executorMessageQueueThread->runOnQueue(
       [this, isDestroyed, task = std::move(task)] {
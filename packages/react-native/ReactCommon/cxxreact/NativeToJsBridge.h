@@ -10,6 +10,8 @@
 #include <atomic>
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include <ReactCommon/CallInvoker.h>
@@ -100,6 +102,14 @@ class NativeToJsBridge {
 
   void runOnExecutorQueue(std::function<void(JSExecutor*)>&& task) noexcept;
 
+  /**
+   * When enabled, the calls of callFunction made before the executor queue
+   * gets to the first of them are delivered to JS together (see
+   * JSExecutor::callFunctions). Calls are still executed in order with the
+   * other work of the queue.
+   */
+  static void setShouldBatchFunctionCalls(bool value);
+
   /**
    * NativeMethodCallInvoker is used by TurboModules to schedule work on the
    * NativeModule thread(s).
@@ -129,6 +139,15 @@ class NativeToJsBridge {
   // likely fail as well, so this flag can help prevent them.
   bool m_applicationScriptHasFailure = false;
 
+  // The calls of callFunction that the last task scheduled on the executor
+  // queue delivers, as long as it hasn't started.
+  std::mutex m_pendingFunctionCallsMutex;
+  std::shared_ptr<std::vector<JSFunctionCall>> m_pendingFunctionCalls;
+
+  static std::atomic<bool> shouldBatchFunctionCalls_;
+
+  void scheduleOnExecutorQueue(std::function<void(JSExecutor*)>&& task);
+
 #ifdef WITH_FBSYSTRACE
   std::atomic<uint_least32_t> m_systraceCookie{0};
 #endif
@@ -7,6 +7,13 @@
 
 #include "ReactMarker.h"
 #include <cxxreact/JSExecutor.h>
+#include <folly/json.h>
+
+#include <algorithm>
+#include <chrono>
+#include <optional>
+#include <string_view>
+#include <thread>
 
 namespace facebook::react {
 namespace ReactMarker {
@@ -23,12 +30,28 @@ LogTaggedMarker logTaggedMarkerBridgelessImpl = nullptr;
 #pragma clang diagnostic pop
 #endif
 
+// Set while a marker logged from C++ is passed to the platform, which may
+// report it back through `logMarkerDone` on the same thread. The marker is
+// already in the timeline by then, so it must not be recorded twice.
+static thread_local bool isForwardingMarkerToPlatform = false;
+
+template <typename LogTaggedMarkerImpl>
+static void recordAndForwardMarker(
+    const LogTaggedMarkerImpl& impl,
+    const ReactMarkerId markerId,
+    const char* tag) {
+  MarkerTimeline::getInstance().record(markerId, tag, MarkerTimeline::now());
+  isForwardingMarkerToPlatform = true;
+  impl(markerId, tag);
+  isForwardingMarkerToPlatform = false;
+}
+
 void logMarker(const ReactMarkerId markerId) {
   logTaggedMarker(markerId, nullptr);
 }
 
 void logTaggedMarker(const ReactMarkerId markerId, const char* tag) {
-  logTaggedMarkerImpl(markerId, tag);
+  recordAndForwardMarker(logTaggedMarkerImpl, markerId, tag);
 }
 
 void logMarkerBridgeless(const ReactMarkerId markerId) {
@@ -36,11 +59,197 @@ void logMarkerBridgeless(const ReactMarkerId markerId) {
 }
 
 void logTaggedMarkerBridgeless(const ReactMarkerId markerId, const char* tag) {
-  logTaggedMarkerBridgelessImpl(markerId, tag);
+  recordAndForwardMarker(logTaggedMarkerBridgelessImpl, markerId, tag);
 }
 
 void logMarkerDone(const ReactMarkerId markerId, double markerTime) {
   StartupLogger::getInstance().logStartupEvent(markerId, markerTime);
+  if (!isForwardingMarkerToPlatform) {
+    MarkerTimeline::getInstance().record(markerId, nullptr, markerTime);
+  }
+}
+
+const char* getMarkerName(const ReactMarkerId markerId) {
+  switch (markerId) {
+    case APP_STARTUP_START:
+      return "APP_STARTUP_START";
+    case APP_STARTUP_STOP:
+      return "APP_STARTUP_STOP";
+    case INIT_REACT_RUNTIME_START:
+      return "INIT_REACT_RUNTIME_START";
+    case INIT_REACT_RUNTIME_STOP:
+      return "INIT_REACT_RUNTIME_STOP";
+    case NATIVE_REQUIRE_START:
+      return "NATIVE_REQUIRE_START";
+    case NATIVE_REQUIRE_STOP:
+      return "NATIVE_REQUIRE_STOP";
+    case RUN_JS_BUNDLE_START:
+      return "RUN_JS_BUNDLE_START";
+    case RUN_JS_BUNDLE_STOP:
+      return "RUN_JS_BUNDLE_STOP";
+    case CREATE_REACT_CONTEXT_STOP:
+      return "CREATE_REACT_CONTEXT_STOP";
+    case JS_BUNDLE_STRING_CONVERT_START:
+      return "JS_BUNDLE_STRING_CONVERT_START";
+    case JS_BUNDLE_STRING_CONVERT_STOP:
+      return "JS_BUNDLE_STRING_CONVERT_STOP";
+    case NATIVE_MODULE_SETUP_START:
+      return "NATIVE_MODULE_SETUP_START";
+    case NATIVE_MODULE_SETUP_STOP:
+      return "NATIVE_MODULE_SETUP_STOP";
+    case REGISTER_JS_SEGMENT_START:
+      return "REGISTER_JS_SEGMENT_START";
+    case REGISTER_JS_SEGMENT_STOP:
+      return "REGISTER_JS_SEGMENT_STOP";
+    case REACT_INSTANCE_INIT_START:
+      return "REACT_INSTANCE_INIT_START";
+    case REACT_INSTANCE_INIT_STOP:
+      return "REACT_INSTANCE_INIT_STOP";
+  }
+  return "UNKNOWN";
+}
+
+static std::optional<ReactMarkerId> getStartMarkerId(
+    const ReactMarkerId markerId) {
+  switch (markerId) {
+    case APP_STARTUP_STOP:
+      return APP_STARTUP_START;
+    case INIT_REACT_RUNTIME_STOP:
+      return INIT_REACT_RUNTIME_START;
+    case NATIVE_REQUIRE_STOP:
+      return NATIVE_REQUIRE_START;
+    case RUN_JS_BUNDLE_STOP:
+      return RUN_JS_BUNDLE_START;
+    case JS_BUNDLE_STRING_CONVERT_STOP:
+      return JS_BUNDLE_STRING_CONVERT_START;
+    case NATIVE_MODULE_SETUP_STOP:
+      return NATIVE_MODULE_SETUP_START;
+    case REGISTER_JS_SEGMENT_STOP:
+      return REGISTER_JS_SEGMENT_START;
+    case REACT_INSTANCE_INIT_STOP:
+      return REACT_INSTANCE_INIT_START;
+    default:
+      return std::nullopt;
+  }
+}
+
+MarkerTimeline& MarkerTimeline::getInstance() {
+  static MarkerTimeline instance;
+  return instance;
+}
+
+double MarkerTimeline::now() {
+  // Both `SystemClock.uptimeMillis()` on Android and `CACurrentMediaTime()`
+  // on iOS are based on the clock `steady_clock` uses on these platforms.
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void MarkerTimeline::record(
+    const ReactMarkerId markerId,
+    const char* tag,
+    double time) {
+  auto event = ReactMarkerEvent{
+      markerId,
+      tag != nullptr ? tag : "",
+      time,
+      static_cast<uint64_t>(
+          std::hash<std::thread::id>{}(std::this_thread::get_id()))};
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (events_.size() < kCapacity) {
+    events_.push_back(std::move(event));
+  } else {
+    events_[nextIndex_] = std::move(event);
+  }
+  nextIndex_ = (nextIndex_ + 1) % kCapacity;
+}
+
+std::vector<ReactMarkerEvent> MarkerTimeline::getEvents() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (events_.size() < kCapacity) {
+    return events_;
+  }
+  auto events = std::vector<ReactMarkerEvent>{};
+  events.reserve(kCapacity);
+  events.insert(events.end(), events_.begin() + nextIndex_, events_.end());
+  events.insert(events.end(), events_.begin(), events_.begin() + nextIndex_);
+  return events;
+}
+
+static folly::dynamic toTraceEvent(
+    std::string_view name,
+    const ReactMarkerEvent& event) {
+  folly::dynamic args = folly::dynamic::object();
+  if (!event.tag.empty()) {
+    args["tag"] = event.tag;
+  }
+  return folly::dynamic::object("name", name)("cat", "react_marker")(
+      "ts", event.time * 1000)("pid", 0)(
+      "tid", static_cast<int64_t>(event.threadId))("args", std::move(args));
+}
+
+static folly::dynamic toInstantTraceEvent(const ReactMarkerEvent& event) {
+  auto traceEvent = toTraceEvent(getMarkerName(event.markerId), event);
+  traceEvent["ph"] = "i";
+  traceEvent["s"] = "t";
+  return traceEvent;
+}
+
+folly::dynamic MarkerTimeline::getTraceEvents() const {
+  auto events = getEvents();
+  folly::dynamic traceEvents = folly::dynamic::array();
+
+  // Start markers which are not matched by a stop marker yet, oldest first.
+  auto openEvents = std::vector<const ReactMarkerEvent*>{};
+  for (const auto& event : events) {
+    auto startMarkerId = getStartMarkerId(event.markerId);
+    if (!startMarkerId) {
+      if (event.markerId == CREATE_REACT_CONTEXT_STOP) {
+        traceEvents.push_back(toInstantTraceEvent(event));
+      } else {
+        openEvents.push_back(&event);
+      }
+      continue;
+    }
+
+    auto start = std::find_if(
+        openEvents.rbegin(), openEvents.rend(), [&](const auto* openEvent) {
+          return openEvent->markerId == *startMarkerId &&
+              openEvent->tag == event.tag;
+        });
+    if (start == openEvents.rend()) {
+      traceEvents.push_back(toInstantTraceEvent(event));
+      continue;
+    }
+
+    // "RUN_JS_BUNDLE_START" and "RUN_JS_BUNDLE_STOP" become "RUN_JS_BUNDLE".
+    auto name = std::string_view{getMarkerName(*startMarkerId)};
+    name.remove_suffix(std::string_view{"_START"}.size());
+    auto traceEvent = toTraceEvent(name, **start);
+    traceEvent["ph"] = "X";
+    traceEvent["dur"] = (event.time - (*start)->time) * 1000;
+    traceEvents.push_back(std::move(traceEvent));
+    openEvents.erase(std::next(start).base());
+  }
+
+  for (const auto* openEvent : openEvents) {
+    traceEvents.push_back(toInstantTraceEvent(*openEvent));
+  }
+
+  return traceEvents;
+}
+
+std::string MarkerTimeline::getTrace() const {
+  return folly::toJson(folly::dynamic::object("traceEvents", getTraceEvents())(
+      "displayTimeUnit", "ms"));
+}
+
+void MarkerTimeline::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  events_.clear();
+  nextIndex_ = 0;
 }
 
 StartupLogger& StartupLogger::getInstance() {
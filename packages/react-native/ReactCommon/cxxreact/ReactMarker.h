@@ -8,6 +8,12 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <folly/dynamic.h>
 
 #ifdef __APPLE__
 #include <functional>
@@ -64,9 +70,64 @@ extern RN_EXPORT void logTaggedMarkerBridgeless(
     const char* tag);
 
 struct ReactMarkerEvent {
-  const ReactMarkerId markerId;
-  const char* tag;
+  ReactMarkerId markerId;
+  std::string tag;
+  // Milliseconds on the monotonic clock the platforms log markers with.
   double time;
+  uint64_t threadId;
+};
+
+/*
+ * The name of a marker in exported traces, e.g. "RUN_JS_BUNDLE_START".
+ */
+extern RN_EXPORT const char* getMarkerName(const ReactMarkerId markerId);
+
+/*
+ * A bounded in-memory record of every marker logged from C++ or from the
+ * platform, on either the bridge or bridgeless path. Once full, the oldest
+ * events are overwritten.
+ */
+class RN_EXPORT MarkerTimeline {
+ public:
+  static constexpr size_t kCapacity = 512;
+
+  static MarkerTimeline& getInstance();
+
+  /*
+   * The current time in the unit and clock of `ReactMarkerEvent::time`.
+   */
+  static double now();
+
+  void record(const ReactMarkerId markerId, const char* tag, double time);
+
+  /*
+   * All recorded events, oldest first.
+   */
+  std::vector<ReactMarkerEvent> getEvents() const;
+
+  /*
+   * The recorded events as an array of Chrome trace events (the format also
+   * read by Perfetto). Matching start and stop markers become complete
+   * events; the rest become instant events.
+   */
+  folly::dynamic getTraceEvents() const;
+
+  /*
+   * The recorded events as a JSON trace file that can be opened in
+   * chrome://tracing or Perfetto.
+   */
+  std::string getTrace() const;
+
+  void clear();
+
+ private:
+  MarkerTimeline() = default;
+  MarkerTimeline(const MarkerTimeline&) = delete;
+  MarkerTimeline& operator=(const MarkerTimeline&) = delete;
+
+  mutable std::mutex mutex_;
+  std::vector<ReactMarkerEvent> events_;
+  size_t nextIndex_{0};
 };
 
 class RN_EXPORT StartupLogger {
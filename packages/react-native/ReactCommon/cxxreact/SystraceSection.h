@@ -9,6 +9,8 @@
 
 #ifdef WITH_FBSYSTRACE
 #include <fbsystrace.h>
+#elif defined(WITH_PERFETTO)
+#include <reactperflogger/ReactPerfetto.h>
 #endif
 
 namespace facebook::react {
@@ -45,6 +47,26 @@ struct ConcreteSystraceSection {
   fbsystrace::FbSystraceSection m_section;
 };
 using SystraceSection = ConcreteSystraceSection;
+#elif defined(WITH_PERFETTO)
+/**
+ * Records sections as Perfetto track events of the "react-native" category,
+ * with `args` (pairs of static keys and values) as typed arguments. Costs a
+ * single load while the category is disabled.
+ */
+struct PerfettoSystraceSection {
+ public:
+  template <typename... ConvertsToStringPiece>
+  explicit PerfettoSystraceSection(
+      const char* name,
+      ConvertsToStringPiece&&... args) {
+    TRACE_EVENT_BEGIN("react-native", perfetto::StaticString{name}, args...);
+  }
+
+  ~PerfettoSystraceSection() {
+    TRACE_EVENT_END("react-native");
+  }
+};
+using SystraceSection = PerfettoSystraceSection;
 #else
 struct DummySystraceSection {
  public:
@@ -60,3 +60,68 @@ TEST(JSBigFileString, MapPartTest) {
     EXPECT_EQ(needle[i], bigStr.c_str()[i]);
   }
 }
+
+TEST(JSBigFileString, MapPartBeyondFirstPageTest) {
+  // E.g. a bundle stored uncompressed within an APK.
+  std::string needle{"var a = 1;"};
+  std::string data = std::string(2 * sysconf(_SC_PAGESIZE) + 5, ' ') + needle;
+  off_t offset = data.find(needle);
+
+  // Initialise Big String
+  int fd = tempFileFromString(data);
+  JSBigFileString bigStr{fd, needle.size(), offset};
+
+  // Test
+  ASSERT_EQ(needle, std::string(bigStr.c_str(), bigStr.size()));
+}
+
+TEST(JSBigFileString, PrefetchTest) {
+  std::string data(3 * sysconf(_SC_PAGESIZE), 'a');
+
+  // Initialise Big String
+  int fd = tempFileFromString(data);
+  JSBigFileString bigStr{fd, data.size()};
+
+  // Test
+  bigStr.prefetch();
+  bigStr.prefetchPages({0, 1, 2, 7});
+  ASSERT_EQ(data, std::string(bigStr.c_str(), bigStr.size()));
+
+  auto residentPages = bigStr.residentPages();
+  EXPECT_EQ((std::vector<size_t>{0, 1, 2}), residentPages);
+}
+
+TEST(JSBigExternalString, ReleasesBorrowedMemoryTest) {
+  auto data = std::make_unique<std::string>("var a = 1;");
+  auto released = false;
+
+  {
+    JSBigExternalString bigStr{
+        data->data(), data->size(), [&]() { released = true; }};
+    EXPECT_EQ(data->data(), bigStr.c_str());
+    EXPECT_EQ(data->size(), bigStr.size());
+    EXPECT_FALSE(released);
+  }
+
+  EXPECT_TRUE(released);
+}
+
+TEST(JSBigStringBuilder, BuildsFromChunksTest) {
+  JSBigStringBuilder builder{8};
+  builder.append("var a", 5);
+  builder.append(" = 1;", 5);
+  builder.append("", 0);
+  EXPECT_EQ(builder.size(), 10);
+
+  auto script = builder.build();
+  EXPECT_EQ(script->size(), 10);
+  EXPECT_STREQ(script->c_str(), "var a = 1;");
+  EXPECT_EQ(builder.size(), 0);
+}
+
+TEST(JSBigStringBuilder, BuildsEmptyStringTest) {
+  JSBigStringBuilder builder;
+  auto script = builder.build();
+  EXPECT_EQ(script->size(), 0);
+  EXPECT_STREQ(script->c_str(), "");
+}
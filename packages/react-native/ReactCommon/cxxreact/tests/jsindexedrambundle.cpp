@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <cxxreact/JSIndexedRAMBundle.h>
+#include <gtest/gtest.h>
+
+using namespace facebook::react;
+
+namespace {
+// Writes an indexed RAM bundle with the given startup code and modules, and
+// returns its path.
+std::string writeBundle(
+    const std::string& startupCode,
+    const std::vector<std::string>& modules) {
+  const char* tmpDir = getenv("TMPDIR");
+  if (tmpDir == nullptr)
+    tmpDir = "/tmp";
+  std::string path{tmpDir};
+  path += "/bundle.XXXXXX";
+  std::vector<char> pathBuf{path.begin(), path.end()};
+  pathBuf.push_back('\0');
+  close(mkstemp(pathBuf.data()));
+  path = pathBuf.data();
+
+  std::ofstream file(path, std::ofstream::binary);
+  auto writeUInt32 = [&](uint32_t value) {
+    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+  };
+
+  // Magic number, number of modules and size of the startup code.
+  writeUInt32(0xFB0BD1E5);
+  writeUInt32(static_cast<uint32_t>(modules.size()));
+  writeUInt32(static_cast<uint32_t>(startupCode.size() + 1));
+
+  // Offsets of the modules are relative to the end of the table.
+  uint32_t offset = static_cast<uint32_t>(startupCode.size() + 1);
+  for (const auto& module : modules) {
+    writeUInt32(offset);
+    writeUInt32(static_cast<uint32_t>(module.size() + 1));
+    offset += static_cast<uint32_t>(module.size() + 1);
+  }
+
+  file.write(startupCode.c_str(), startupCode.size() + 1);
+  for (const auto& module : modules) {
+    file.write(module.c_str(), module.size() + 1);
+  }
+  return path;
+}
+} // namespace
+
+TEST(JSIndexedRAMBundle, GetModuleTest) {
+  auto path = writeBundle("startup();", {"first();", "second();"});
+  JSIndexedRAMBundle bundle{path.c_str()};
+
+  EXPECT_STREQ("startup();", bundle.getStartupCode()->c_str());
+  EXPECT_EQ("second();", bundle.getModule(1).code);
+  EXPECT_EQ("1.js", bundle.getModule(1).name);
+  EXPECT_EQ("first();", bundle.getModule(0).code);
+}
+
+TEST(JSIndexedRAMBundle, PrefetchModulesTest) {
+  auto modules = std::vector<std::string>{};
+  auto moduleIds = std::vector<uint32_t>{};
+  for (uint32_t i = 0; i < 64; i++) {
+    modules.push_back("module" + std::to_string(i) + "();");
+    moduleIds.push_back(i);
+  }
+  auto path = writeBundle("startup();", modules);
+
+  JSIndexedRAMBundle bundle{path.c_str()};
+  bundle.prefetchModules(moduleIds, 3);
+
+  // Modules are returned whether their prefetch completed or not, and can be
+  // required again once they were prefetched.
+  for (uint32_t i = 0; i < 64; i++) {
+    EXPECT_EQ(modules[i], bundle.getModule(i).code);
+  }
+  for (uint32_t i = 0; i < 64; i++) {
+    EXPECT_EQ(modules[i], bundle.getModule(i).code);
+  }
+}
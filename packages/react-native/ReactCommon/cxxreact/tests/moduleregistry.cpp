@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cxxreact/ModuleRegistry.h>
+#include <cxxreact/NativeModule.h>
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace facebook::react;
+
+namespace {
+
+class TestNativeModule : public NativeModule {
+ public:
+  TestNativeModule(std::string name, std::vector<std::string>& invocations)
+      : name_(std::move(name)), invocations_(invocations) {}
+
+  std::string getName() override {
+    return name_;
+  }
+
+  std::string getSyncMethodName(unsigned int /*methodId*/) override {
+    return "sync";
+  }
+
+  std::vector<MethodDescriptor> getMethods() override {
+    return {MethodDescriptor("doWork", "async")};
+  }
+
+  folly::dynamic getConstants() override {
+    if (onGetConstants) {
+      onGetConstants();
+    }
+    constantsCount++;
+    return folly::dynamic::object("answer", 42);
+  }
+
+  void invoke(
+      unsigned int /*reactMethodId*/,
+      folly::dynamic&& /*params*/,
+      int /*callId*/) override {
+    invocations_.push_back(name_);
+  }
+
+  MethodCallResult callSerializableNativeHook(
+      unsigned int /*reactMethodId*/,
+      folly::dynamic&& /*args*/) override {
+    return std::nullopt;
+  }
+
+ private:
+  std::string name_;
+  std::vector<std::string>& invocations_;
+
+ public:
+  std::function<void()> onGetConstants;
+  std::atomic<int> constantsCount{0};
+};
+
+} // namespace
+
+class ModuleRegistryTest : public ::testing::Test {
+ protected:
+  ModuleRegistry::ModuleFactory factory(const std::string& name) {
+    return [this, name] {
+      createdModules_.push_back(name);
+      return std::make_unique<TestNativeModule>(name, invocations_);
+    };
+  }
+
+  std::vector<std::string> createdModules_;
+  std::vector<std::string> invocations_;
+};
+
+TEST_F(ModuleRegistryTest, CreatesLazyModulesOnFirstUse) {
+  auto registry = ModuleRegistry({});
+  registry.registerLazyModules(
+      {{"RCTFirst", factory("RCTFirst")}, {"Second", factory("Second")}});
+
+  EXPECT_EQ(
+      registry.moduleNames(), (std::vector<std::string>{"First", "Second"}));
+  EXPECT_EQ(registry.getModuleName(0), "RCTFirst");
+  EXPECT_TRUE(createdModules_.empty());
+
+  auto config = registry.getConfig("Second");
+  ASSERT_TRUE(config.has_value());
+  EXPECT_EQ(config->index, 1);
+  EXPECT_EQ(createdModules_, (std::vector<std::string>{"Second"}));
+
+  registry.callNativeMethod(1, 0, folly::dynamic::array(), 0);
+  registry.callNativeMethod(0, 0, folly::dynamic::array(), 1);
+  EXPECT_EQ(createdModules_, (std::vector<std::string>{"Second", "RCTFirst"}));
+  EXPECT_EQ(invocations_, (std::vector<std::string>{"Second", "RCTFirst"}));
+}
+
+TEST_F(ModuleRegistryTest, RegistersLazyModulesAfterModules) {
+  auto modules = std::vector<std::unique_ptr<NativeModule>>{};
+  modules.push_back(std::make_unique<TestNativeModule>("Eager", invocations_));
+  auto registry = ModuleRegistry(std::move(modules));
+  EXPECT_TRUE(registry.getConfig("Eager").has_value());
+
+  registry.registerLazyModules({{"Lazy", factory("Lazy")}});
+  auto config = registry.getConfig("Lazy");
+  ASSERT_TRUE(config.has_value());
+  EXPECT_EQ(config->index, 1);
+}
+
+TEST_F(ModuleRegistryTest, ThrowsWhenRegisteringModuleThatWasUnknown) {
+  auto registry = ModuleRegistry({});
+  EXPECT_FALSE(registry.getConfig("Late").has_value());
+
+  EXPECT_THROW(
+      registry.registerLazyModules({{"Late", factory("Late")}}),
+      std::runtime_error);
+}
+
+TEST_F(ModuleRegistryTest, PreparesConfigsOnBackgroundThreads) {
+  auto modules = std::vector<std::unique_ptr<NativeModule>>{};
+  modules.push_back(std::make_unique<TestNativeModule>("A", invocations_));
+  modules.push_back(std::make_unique<TestNativeModule>("B", invocations_));
+  auto* moduleA = static_cast<TestNativeModule*>(modules[0].get());
+  auto* moduleB = static_cast<TestNativeModule*>(modules[1].get());
+  auto constantsThread = std::promise<std::thread::id>{};
+  moduleA->onGetConstants = [&] {
+    constantsThread.set_value(std::this_thread::get_id());
+    moduleA->onGetConstants = nullptr;
+  };
+  auto registry = ModuleRegistry(std::move(modules));
+  registry.prepareConfigs({"A", "Unknown"});
+  EXPECT_NE(constantsThread.get_future().get(), std::this_thread::get_id());
+
+  auto config = registry.getConfig("A");
+  ASSERT_TRUE(config.has_value());
+  EXPECT_EQ(config->index, 0);
+  EXPECT_EQ(config->config[0], "A");
+  EXPECT_EQ(config->config[1]["answer"], 42);
+  EXPECT_EQ(moduleA->constantsCount, 1);
+
+  // Configs are prepared once, and modules not to prepare are unaffected.
+  EXPECT_TRUE(registry.getConfig("A").has_value());
+  EXPECT_EQ(moduleA->constantsCount, 2);
+  EXPECT_EQ(moduleB->constantsCount, 0);
+}
+
+TEST_F(ModuleRegistryTest, CreatesLazyModulesToPrepareOnCallingThread) {
+  auto registry = ModuleRegistry({});
+  registry.registerLazyModules({{"Lazy", factory("Lazy")}});
+  registry.prepareConfigs({"Lazy"});
+  EXPECT_EQ(createdModules_, (std::vector<std::string>{"Lazy"}));
+
+  auto config = registry.getConfig("Lazy");
+  ASSERT_TRUE(config.has_value());
+  EXPECT_EQ(config->index, 0);
+}
+
+TEST_F(ModuleRegistryTest, WaitsForConfigBeingPrepared) {
+  auto modules = std::vector<std::unique_ptr<NativeModule>>{};
+  modules.push_back(std::make_unique<TestNativeModule>("Slow", invocations_));
+  auto* module = static_cast<TestNativeModule*>(modules[0].get());
+  auto started = std::promise<void>{};
+  auto release = std::promise<void>{};
+  auto released = release.get_future().share();
+  module->onGetConstants = [&] {
+    started.set_value();
+    released.wait();
+  };
+  auto registry = ModuleRegistry(std::move(modules));
+  registry.prepareConfigs({"Slow"}, 1);
+  started.get_future().wait();
+
+  auto config = std::async(std::launch::async, [&] {
+    return registry.getConfig("Slow");
+  });
+  EXPECT_EQ(
+      config.wait_for(std::chrono::milliseconds(50)),
+      std::future_status::timeout);
+  release.set_value();
+  ASSERT_TRUE(config.get().has_value());
+  EXPECT_EQ(module->constantsCount, 1);
+}
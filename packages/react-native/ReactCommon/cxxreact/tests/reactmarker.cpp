@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cxxreact/ReactMarker.h>
+
+#include <thread>
+
+using namespace facebook::react;
+using namespace facebook::react::ReactMarker;
+
+namespace {
+
+class ReactMarkerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    MarkerTimeline::getInstance().clear();
+    logTaggedMarkerImpl = [](const ReactMarkerId, const char*) {};
+  }
+
+  void TearDown() override {
+    logTaggedMarkerImpl = nullptr;
+    MarkerTimeline::getInstance().clear();
+  }
+};
+
+} // namespace
+
+TEST_F(ReactMarkerTest, RecordsMarkersWithTagsAndThreads) {
+  logTaggedMarker(RUN_JS_BUNDLE_START, "index.bundle");
+  std::thread([] { logMarker(CREATE_REACT_CONTEXT_STOP); }).join();
+
+  auto events = MarkerTimeline::getInstance().getEvents();
+  ASSERT_EQ(events.size(), 2);
+  EXPECT_EQ(events[0].markerId, RUN_JS_BUNDLE_START);
+  EXPECT_EQ(events[0].tag, "index.bundle");
+  EXPECT_EQ(events[1].markerId, CREATE_REACT_CONTEXT_STOP);
+  EXPECT_EQ(events[1].tag, "");
+  EXPECT_NE(events[0].threadId, events[1].threadId);
+}
+
+TEST_F(ReactMarkerTest, RecordsPlatformMarkersOnce) {
+  logMarkerDone(APP_STARTUP_START, 10);
+
+  // The platform may report markers logged from C++ back to C++.
+  logTaggedMarkerImpl = [](const ReactMarkerId markerId, const char*) {
+    logMarkerDone(markerId, 20);
+  };
+  logMarker(RUN_JS_BUNDLE_START);
+
+  auto events = MarkerTimeline::getInstance().getEvents();
+  ASSERT_EQ(events.size(), 2);
+  EXPECT_EQ(events[0].markerId, APP_STARTUP_START);
+  EXPECT_EQ(events[0].time, 10);
+  EXPECT_EQ(events[1].markerId, RUN_JS_BUNDLE_START);
+}
+
+TEST_F(ReactMarkerTest, OverwritesOldestEventsWhenFull) {
+  for (size_t i = 0; i < MarkerTimeline::kCapacity + 2; i++) {
+    logMarkerDone(NATIVE_REQUIRE_START, static_cast<double>(i));
+  }
+
+  auto events = MarkerTimeline::getInstance().getEvents();
+  ASSERT_EQ(events.size(), MarkerTimeline::kCapacity);
+  EXPECT_EQ(events.front().time, 2);
+  EXPECT_EQ(events.back().time, MarkerTimeline::kCapacity + 1);
+}
+
+TEST_F(ReactMarkerTest, ExportsMatchingMarkersAsCompleteEvents) {
+  logMarkerDone(APP_STARTUP_START, 1);
+  MarkerTimeline::getInstance().record(NATIVE_MODULE_SETUP_START, "A", 2);
+  MarkerTimeline::getInstance().record(NATIVE_MODULE_SETUP_START, "B", 3);
+  MarkerTimeline::getInstance().record(NATIVE_MODULE_SETUP_STOP, "A", 5);
+  logMarkerDone(CREATE_REACT_CONTEXT_STOP, 6);
+
+  auto traceEvents = MarkerTimeline::getInstance().getTraceEvents();
+  ASSERT_EQ(traceEvents.size(), 4);
+
+  EXPECT_EQ(traceEvents[0]["name"], "NATIVE_MODULE_SETUP");
+  EXPECT_EQ(traceEvents[0]["ph"], "X");
+  EXPECT_EQ(traceEvents[0]["ts"], 2000.0);
+  EXPECT_EQ(traceEvents[0]["dur"], 3000.0);
+  EXPECT_EQ(traceEvents[0]["args"]["tag"], "A");
+
+  EXPECT_EQ(traceEvents[1]["name"], "CREATE_REACT_CONTEXT_STOP");
+  EXPECT_EQ(traceEvents[1]["ph"], "i");
+
+  // Start markers without a stop marker yet.
+  EXPECT_EQ(traceEvents[2]["name"], "APP_STARTUP_START");
+  EXPECT_EQ(traceEvents[2]["ph"], "i");
+  EXPECT_EQ(traceEvents[3]["name"], "NATIVE_MODULE_SETUP_START");
+  EXPECT_EQ(traceEvents[3]["args"]["tag"], "B");
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "HermesBytecodeCache.h"
+
+#include <cxxreact/JSBigString.h>
+#include <cxxreact/SystraceSection.h>
+#include <glog/logging.h>
+#include <hermes/CompileJS.h>
+#include <hermes/hermes.h>
+#include <jsireact/JSIExecutor.h>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+using namespace facebook::hermes;
+
+namespace facebook::react {
+
+namespace {
+
+constexpr auto kFileExtension = ".hbc";
+
+/*
+ * 64-bit FNV-1a over 8-byte words, which is stable across launches and fast
+ * enough to hash bundles of several megabytes on every launch.
+ */
+uint64_t hashBytes(const uint8_t* data, size_t size) {
+  auto hash = uint64_t{14695981039346656037ull};
+  auto mix = [&](uint64_t word) {
+    hash ^= word;
+    hash *= 1099511628211ull;
+  };
+
+  size_t offset = 0;
+  for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t)) {
+    auto word = uint64_t{};
+    std::memcpy(&word, data + offset, sizeof(word));
+    mix(word);
+  }
+  auto tail = uint64_t{};
+  std::memcpy(&tail, data + offset, size - offset);
+  mix(tail);
+  mix(size);
+  return hash;
+}
+
+std::string toHex(uint64_t value) {
+  auto stream = std::ostringstream{};
+  stream << std::hex << std::setw(16) << std::setfill('0') << value;
+  return stream.str();
+}
+
+} // namespace
+
+HermesBytecodeCache::HermesBytecodeCache(std::string directory)
+    : directory_(std::move(directory)) {}
+
+void HermesBytecodeCache::evaluateJavaScript(
+    jsi::Runtime& runtime,
+    const std::shared_ptr<const jsi::Buffer>& buffer,
+    const std::string& sourceURL) {
+  if (HermesRuntime::isHermesBytecode(buffer->data(), buffer->size())) {
+    runtime.evaluateJavaScript(buffer, sourceURL);
+    return;
+  }
+
+  auto pathPrefix = directory_ + "/" +
+      toHex(hashBytes(
+          reinterpret_cast<const uint8_t*>(sourceURL.data()),
+          sourceURL.size())) +
+      "-";
+  auto path = pathPrefix + toHex(hashBytes(buffer->data(), buffer->size())) +
+      kFileExtension;
+
+  if (auto bytecode = loadBytecode(path)) {
+    SystraceSection s("HermesBytecodeCache::evaluateJavaScript::bytecode");
+    runtime.evaluateJavaScript(bytecode, sourceURL);
+    return;
+  }
+
+  runtime.evaluateJavaScript(buffer, sourceURL);
+
+  // Only scripts which evaluated successfully are cached.
+  writeBytecode(buffer, std::move(pathPrefix), std::move(path));
+}
+
+std::shared_ptr<const jsi::Buffer> HermesBytecodeCache::loadBytecode(
+    const std::string& path) const {
+  SystraceSection s("HermesBytecodeCache::loadBytecode");
+
+  auto fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+
+  struct stat fileStat {};
+  if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0) {
+    close(fd);
+    return nullptr;
+  }
+
+  auto bytecode = std::make_shared<BigStringBuffer>(
+      std::make_unique<JSBigFileString>(
+          fd, static_cast<size_t>(fileStat.st_size)));
+  close(fd);
+
+  auto errorMessage = std::string{};
+  if (!HermesRuntime::hermesBytecodeSanityCheck(
+          bytecode->data(), bytecode->size(), &errorMessage)) {
+    LOG(WARNING) << "Removing invalid Hermes bytecode cache " << path << ": "
+                 << errorMessage;
+    std::remove(path.c_str());
+    return nullptr;
+  }
+
+  return bytecode;
+}
+
+void HermesBytecodeCache::writeBytecode(
+    std::shared_ptr<const jsi::Buffer> buffer,
+    std::string pathPrefix,
+    std::string path) {
+  {
+    std::lock_guard lock(mutex_);
+    if (!pathsBeingWritten_.insert(path).second) {
+      return;
+    }
+  }
+
+  // Writing to a temporary file which replaces the cache once complete, so
+  // the cache is never seen partially written. Caches of other instances of
+  // React Native may write to the same file concurrently.
+  static auto writeCount = std::atomic<uint64_t>{0};
+  auto temporaryPath = path + ".tmp-" + std::to_string(getpid()) + "-" +
+      std::to_string(writeCount++);
+  std::thread([self = shared_from_this(),
+               buffer = std::move(buffer),
+               directory = directory_,
+               pathPrefix = std::move(pathPrefix),
+               path = std::move(path),
+               temporaryPath = std::move(temporaryPath)]() {
+    SystraceSection s("HermesBytecodeCache::writeBytecode");
+
+    auto bytecode = std::string{};
+    auto succeeded = ::hermes::compileJS(
+        std::string(
+            reinterpret_cast<const char*>(buffer->data()), buffer->size()),
+        bytecode,
+        /* optimize = */ true);
+
+    if (succeeded) {
+      auto file = std::fopen(temporaryPath.c_str(), "wb");
+      succeeded = file != nullptr &&
+          std::fwrite(bytecode.data(), 1, bytecode.size(), file) ==
+              bytecode.size();
+      if (file != nullptr) {
+        succeeded = std::fclose(file) == 0 && succeeded;
+      }
+      if (succeeded) {
+        succeeded = std::rename(temporaryPath.c_str(), path.c_str()) == 0;
+      }
+      if (!succeeded) {
+        std::remove(temporaryPath.c_str());
+      }
+    }
+
+    if (succeeded) {
+      // Bytecode of previous versions of the script is never used again.
+      if (auto dir = opendir(directory.c_str())) {
+        while (auto entry = readdir(dir)) {
+          auto entryPath = directory + "/" + entry->d_name;
+          if (entryPath != path && entryPath.rfind(pathPrefix, 0) == 0 &&
+              entryPath.find(".tmp-") == std::string::npos) {
+            std::remove(entryPath.c_str());
+          }
+        }
+        closedir(dir);
+      }
+    } else {
+      LOG(WARNING) << "Failed to write Hermes bytecode cache " << path;
+    }
+
+    std::lock_guard lock(self->mutex_);
+    self->pathsBeingWritten_.erase(path);
+  }).detach();
+}
+
+} // namespace facebook::react
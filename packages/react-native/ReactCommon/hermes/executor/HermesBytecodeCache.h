@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+namespace facebook::react {
+
+/*
+ * Caches Hermes bytecode compiled on the device for bundles which are loaded
+ * as source (e.g. bundles downloaded over the air), so they are compiled once
+ * instead of on every launch.
+ *
+ * The first time a script is evaluated, it is evaluated as source and, if it
+ * didn't throw, compiled to bytecode on a background thread. The bytecode is
+ * written to a file in `directory` named after a hash of the source URL and of
+ * the content of the script. Later evaluations of the same script memory-map
+ * the file and evaluate the bytecode instead, once Hermes validated it;
+ * invalid files (e.g. written by a different version of Hermes) are removed.
+ * When bytecode is written, files written for previous content of the script
+ * with the same source URL are removed.
+ *
+ * Scripts which already are bytecode are evaluated as they are.
+ *
+ * Can be called from any thread.
+ */
+class HermesBytecodeCache final
+    : public std::enable_shared_from_this<HermesBytecodeCache> {
+ public:
+  explicit HermesBytecodeCache(std::string directory);
+
+  /*
+   * Evaluates `buffer` in `runtime` (which must be a Hermes runtime, possibly
+   * decorated), using the cached bytecode of the script if there is any.
+   */
+  void evaluateJavaScript(
+      jsi::Runtime& runtime,
+      const std::shared_ptr<const jsi::Buffer>& buffer,
+      const std::string& sourceURL);
+
+ private:
+  std::shared_ptr<const jsi::Buffer> loadBytecode(
+      const std::string& path) const;
+
+  void writeBytecode(
+      std::shared_ptr<const jsi::Buffer> buffer,
+      std::string pathPrefix,
+      std::string path);
+
+  const std::string directory_;
+
+  std::mutex mutex_;
+  std::unordered_set<std::string> pathsBeingWritten_; // Protected by `mutex_`.
+};
+
+} // namespace facebook::react
@@ -192,6 +192,11 @@ void HermesExecutorFactory::setDebuggerName(const std::string& debuggerName) {
   debuggerName_ = debuggerName;
 }
 
+void HermesExecutorFactory::setBytecodeCache(
+    std::shared_ptr<HermesBytecodeCache> bytecodeCache) {
+  bytecodeCache_ = std::move(bytecodeCache);
+}
+
 std::unique_ptr<JSExecutor> HermesExecutorFactory::createJSExecutor(
     std::shared_ptr<ExecutorDelegate> delegate,
     std::shared_ptr<MessageQueueThread> jsQueue) {
@@ -236,7 +241,8 @@ std::unique_ptr<JSExecutor> HermesExecutorFactory::createJSExecutor(
       jsQueue,
       timeoutInvoker_,
       runtimeInstaller_,
-      hermesRuntimeRef);
+      hermesRuntimeRef,
+      bytecodeCache_);
 }
 
 ::hermes::vm::RuntimeConfig HermesExecutorFactory::defaultRuntimeConfig() {
@@ -251,11 +257,23 @@ HermesExecutor::HermesExecutor(
     std::shared_ptr<MessageQueueThread> jsQueue,
     const JSIScopedTimeoutInvoker& timeoutInvoker,
     RuntimeInstaller runtimeInstaller,
-    HermesRuntime& hermesRuntime)
+    HermesRuntime& hermesRuntime,
+    std::shared_ptr<HermesBytecodeCache> bytecodeCache)
     : JSIExecutor(runtime, delegate, timeoutInvoker, runtimeInstaller),
       jsQueue_(jsQueue),
       runtime_(runtime),
-      hermesRuntime_(hermesRuntime) {}
+      hermesRuntime_(hermesRuntime),
+      bytecodeCache_(std::move(bytecodeCache)) {}
+
+void HermesExecutor::evaluateBundle(
+    const std::shared_ptr<const jsi::Buffer>& buffer,
+    const std::string& sourceURL) {
+  if (bytecodeCache_) {
+    bytecodeCache_->evaluateJavaScript(*runtime_, buffer, sourceURL);
+  } else {
+    JSIExecutor::evaluateBundle(buffer, sourceURL);
+  }
+}
 
 std::unique_ptr<jsinspector_modern::RuntimeAgentDelegate>
 HermesExecutor::createAgentDelegate(
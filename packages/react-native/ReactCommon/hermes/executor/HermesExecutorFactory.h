@@ -10,6 +10,7 @@
 #include <hermes/hermes.h>
 #include <jsireact/JSIExecutor.h>
 #include <utility>
+#include "HermesBytecodeCache.h"
 
 namespace facebook::react {
 
@@ -30,6 +31,12 @@ class HermesExecutorFactory : public JSExecutorFactory {
 
   void setDebuggerName(const std::string& debuggerName);
 
+  /*
+   * Makes executors evaluate bundles loaded as source through `bytecodeCache`
+   * (disabled by default).
+   */
+  void setBytecodeCache(std::shared_ptr<HermesBytecodeCache> bytecodeCache);
+
   std::unique_ptr<JSExecutor> createJSExecutor(
       std::shared_ptr<ExecutorDelegate> delegate,
       std::shared_ptr<MessageQueueThread> jsQueue) override;
@@ -42,6 +49,7 @@ class HermesExecutorFactory : public JSExecutorFactory {
   ::hermes::vm::RuntimeConfig runtimeConfig_;
   bool enableDebugger_ = true;
   std::string debuggerName_ = "Hermes React Native";
+  std::shared_ptr<HermesBytecodeCache> bytecodeCache_;
 };
 
 class HermesExecutor : public JSIExecutor {
@@ -52,18 +60,25 @@ class HermesExecutor : public JSIExecutor {
       std::shared_ptr<MessageQueueThread> jsQueue,
       const JSIScopedTimeoutInvoker& timeoutInvoker,
       RuntimeInstaller runtimeInstaller,
-      hermes::HermesRuntime& hermesRuntime);
+      hermes::HermesRuntime& hermesRuntime,
+      std::shared_ptr<HermesBytecodeCache> bytecodeCache = nullptr);
 
   virtual std::unique_ptr<jsinspector_modern::RuntimeAgentDelegate>
   createAgentDelegate(
       jsinspector_modern::FrontendChannel frontendChannel,
       jsinspector_modern::SessionState& sessionState) override;
 
+ protected:
+  void evaluateBundle(
+      const std::shared_ptr<const jsi::Buffer>& buffer,
+      const std::string& sourceURL) override;
+
  private:
   JSIScopedTimeoutInvoker timeoutInvoker_;
   std::shared_ptr<MessageQueueThread> jsQueue_;
   std::shared_ptr<jsi::Runtime> runtime_;
   hermes::HermesRuntime& hermesRuntime_;
+  std::shared_ptr<HermesBytecodeCache> bytecodeCache_;
 };
 
 } // namespace facebook::react
@@ -16,7 +16,9 @@
 #include <mutex>
 #include <queue>
 #include <sstream>
+#include <string>
 #include <thread>
+#include <unordered_map>
 
 namespace facebook {
 namespace jsc {
@@ -193,6 +195,20 @@ class JSCRuntime : public jsi::Runtime {
       const jsi::Object&,
       const jsi::PropNameID& name,
       const jsi::Value& value) override;
+  jsi::Object createObjectWithProperties(
+      const jsi::PropNameID* names,
+      const jsi::Value* values,
+      size_t count) override;
+  void setPropertyValues(
+      const jsi::Object&,
+      const jsi::PropNameID* names,
+      const jsi::Value* values,
+      size_t count) override;
+  void getPropertyValues(
+      const jsi::Object&,
+      const jsi::PropNameID* names,
+      jsi::Value* values,
+      size_t count) override;
   bool isArray(const jsi::Object&) const override;
   bool isArrayBuffer(const jsi::Object&) const override;
   bool isFunction(const jsi::Object&) const override;
@@ -261,10 +277,17 @@ class JSCRuntime : public jsi::Runtime {
   void checkException(JSValueRef exc, const char* msg);
   void checkException(JSValueRef res, JSValueRef exc, const char* msg);
 
+  // Returns a new reference to the string of an ASCII property name. Short
+  // names share a single string for all their uses.
+  JSStringRef getPropNameString(const char* str, size_t length);
+
   JSGlobalContextRef ctx_;
   std::atomic<bool> ctxInvalid_;
   std::string desc_;
   JSValueRef nativeStateSymbol_ = nullptr;
+  // The strings of the ASCII property names created so far (e.g. the method
+  // names of native modules), so that they aren't converted on each access.
+  std::unordered_map<std::string, JSStringRef> propNameStrings_;
 #ifndef NDEBUG
   mutable std::atomic<intptr_t> objectCounter_;
   mutable std::atomic<intptr_t> symbolCounter_;
@@ -299,7 +322,59 @@ class JSCRuntime : public jsi::Runtime {
 
 // JSStringRef utilities
 namespace {
+// ASCII strings up to this length are widened to UTF-16 on the stack.
+constexpr size_t kMaxStackStringLength = 64;
+
+bool isAscii(const uint8_t* str, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    if (str[i] >= 0x80) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Creates the string by widening the characters to UTF-16 directly, instead
+// of copying them to a null terminated buffer to be decoded as UTF-8.
+JSStringRef JSStringCreateWithAscii(const char* str, size_t length) {
+  std::array<JSChar, kMaxStackStringLength> stackBuffer;
+  std::unique_ptr<JSChar[]> heapBuffer;
+  JSChar* buffer = stackBuffer.data();
+  if (length > stackBuffer.size()) {
+    heapBuffer = std::make_unique<JSChar[]>(length);
+    buffer = heapBuffer.get();
+  }
+  for (size_t i = 0; i < length; i++) {
+    buffer[i] = static_cast<unsigned char>(str[i]);
+  }
+  return JSStringCreateWithCharacters(buffer, length);
+}
+
+JSStringRef JSStringCreateWithUtf8(const uint8_t* str, size_t length) {
+  if (isAscii(str, length)) {
+    return JSStringCreateWithAscii(reinterpret_cast<const char*>(str), length);
+  }
+  std::string tmp(reinterpret_cast<const char*>(str), length);
+  return JSStringCreateWithUTF8CString(tmp.c_str());
+}
+
 std::string JSStringToSTLString(JSStringRef str) {
+  // ASCII strings are narrowed from the UTF-16 characters of the string
+  // directly, without encoding them to UTF-8 in a temporary buffer.
+  const JSChar* characters = JSStringGetCharactersPtr(str);
+  size_t length = JSStringGetLength(str);
+  bool isAsciiString = true;
+  for (size_t i = 0; i < length && isAsciiString; i++) {
+    isAsciiString = characters[i] < 0x80;
+  }
+  if (isAsciiString) {
+    std::string result(length, '\0');
+    for (size_t i = 0; i < length; i++) {
+      result[i] = static_cast<char>(characters[i]);
+    }
+    return result;
+  }
+
   // Small string optimization: Avoid one heap allocation for strings that fit
   // in stackBuffer.size() bytes of UTF-8 (including the null terminator).
   std::array<char, 20> stackBuffer;
@@ -387,6 +462,9 @@ JSCRuntime::~JSCRuntime() {
   ctxInvalid_ = true;
   // No need to unprotect nativeStateSymbol_ since the heap is getting torn down
   // anyway
+  for (const auto& [name, str] : propNameStrings_) {
+    JSStringRelease(str);
+  }
   JSGlobalContextRelease(ctx_);
 #ifndef NDEBUG
   assert(
@@ -613,12 +691,30 @@ jsi::Runtime::PointerValue* JSCRuntime::clonePropNameID(
   return makeStringValue(string->str_);
 }
 
+JSStringRef JSCRuntime::getPropNameString(const char* str, size_t length) {
+  // Bounds the memory retained by property names built at runtime.
+  constexpr size_t kMaxCachedLength = 32;
+  constexpr size_t kMaxCachedCount = 1024;
+
+  if (length > kMaxCachedLength) {
+    return JSStringCreateWithAscii(str, length);
+  }
+  auto it = propNameStrings_.find(std::string(str, length));
+  if (it != propNameStrings_.end()) {
+    return JSStringRetain(it->second);
+  }
+  JSStringRef strRef = JSStringCreateWithAscii(str, length);
+  if (propNameStrings_.size() < kMaxCachedCount) {
+    propNameStrings_.emplace(std::string(str, length), JSStringRetain(strRef));
+  }
+  return strRef;
+}
+
 jsi::PropNameID JSCRuntime::createPropNameIDFromAscii(
     const char* str,
     size_t length) {
   // For system JSC this must is identical to a string
-  std::string tmp(str, length);
-  JSStringRef strRef = JSStringCreateWithUTF8CString(tmp.c_str());
+  JSStringRef strRef = getPropNameString(str, length);
   auto res = createPropNameID(strRef);
   JSStringRelease(strRef);
   return res;
@@ -627,8 +723,9 @@ jsi::PropNameID JSCRuntime::createPropNameIDFromAscii(
 jsi::PropNameID JSCRuntime::createPropNameIDFromUtf8(
     const uint8_t* utf8,
     size_t length) {
-  std::string tmp(reinterpret_cast<const char*>(utf8), length);
-  JSStringRef strRef = JSStringCreateWithUTF8CString(tmp.c_str());
+  JSStringRef strRef = isAscii(utf8, length)
+      ? getPropNameString(reinterpret_cast<const char*>(utf8), length)
+      : JSStringCreateWithUtf8(utf8, length);
   auto res = createPropNameID(strRef);
   JSStringRelease(strRef);
   return res;
@@ -682,17 +779,16 @@ jsi::String JSCRuntime::bigintToString(const jsi::BigInt&, int) {
 }
 
 jsi::String JSCRuntime::createStringFromAscii(const char* str, size_t length) {
-  // Yes we end up double casting for semantic reasons (UTF8 contains ASCII,
-  // not the other way around)
-  return this->createStringFromUtf8(
-      reinterpret_cast<const uint8_t*>(str), length);
+  JSStringRef stringRef = JSStringCreateWithAscii(str, length);
+  auto result = createString(stringRef);
+  JSStringRelease(stringRef);
+  return result;
 }
 
 jsi::String JSCRuntime::createStringFromUtf8(
     const uint8_t* str,
     size_t length) {
-  std::string tmp(reinterpret_cast<const char*>(str), length);
-  JSStringRef stringRef = JSStringCreateWithUTF8CString(tmp.c_str());
+  JSStringRef stringRef = JSStringCreateWithUtf8(str, length);
   auto result = createString(stringRef);
   JSStringRelease(stringRef);
   return result;
@@ -1020,6 +1116,49 @@ void JSCRuntime::setPropertyValue(
   checkException(exc);
 }
 
+jsi::Object JSCRuntime::createObjectWithProperties(
+    const jsi::PropNameID* names,
+    const jsi::Value* values,
+    size_t count) {
+  jsi::Object object = createObject();
+  setPropertyValues(object, names, values, count);
+  return object;
+}
+
+void JSCRuntime::setPropertyValues(
+    const jsi::Object& object,
+    const jsi::PropNameID* names,
+    const jsi::Value* values,
+    size_t count) {
+  JSObjectRef objRef = objectRef(object);
+  for (size_t i = 0; i < count; i++) {
+    JSValueRef exc = nullptr;
+    JSObjectSetProperty(
+        ctx_,
+        objRef,
+        stringRef(names[i]),
+        valueRef(values[i]),
+        kJSPropertyAttributeNone,
+        &exc);
+    checkException(exc);
+  }
+}
+
+void JSCRuntime::getPropertyValues(
+    const jsi::Object& object,
+    const jsi::PropNameID* names,
+    jsi::Value* values,
+    size_t count) {
+  JSObjectRef objRef = objectRef(object);
+  for (size_t i = 0; i < count; i++) {
+    JSValueRef exc = nullptr;
+    JSValueRef res =
+        JSObjectGetProperty(ctx_, objRef, stringRef(names[i]), &exc);
+    checkException(exc);
+    values[i] = createValue(res);
+  }
+}
+
 bool JSCRuntime::isArray(const jsi::Object& obj) const {
   return JSValueIsArray(ctx_, objectRef(obj));
 }
@@ -1091,7 +1230,24 @@ jsi::Array JSCRuntime::createArray(size_t length) {
 
 jsi::ArrayBuffer JSCRuntime::createArrayBuffer(
     std::shared_ptr<jsi::MutableBuffer> buffer) {
-  throw std::logic_error("Not implemented");
+  auto data = buffer->data();
+  auto size = buffer->size();
+  // The ArrayBuffer uses the storage of the buffer without copying it, and
+  // keeps the buffer alive until the ArrayBuffer is garbage collected.
+  auto context = new std::shared_ptr<jsi::MutableBuffer>(std::move(buffer));
+  JSValueRef exc = nullptr;
+  JSObjectRef obj = JSObjectMakeArrayBufferWithBytesNoCopy(
+      ctx_,
+      data,
+      size,
+      [](void* /*bytes*/, void* deallocatorContext) {
+        delete static_cast<std::shared_ptr<jsi::MutableBuffer>*>(
+            deallocatorContext);
+      },
+      context,
+      &exc);
+  checkException(obj, exc);
+  return createObject(obj).getArrayBuffer(*this);
 }
 
 size_t JSCRuntime::size(const jsi::Array& arr) {
@@ -10,6 +10,7 @@
 #include <glog/logging.h>
 
 #include <folly/dynamic.h>
+#include <jsi/PropNameIDCache.h>
 #include <jsi/jsi.h>
 
 using namespace facebook::jsi;
@@ -64,6 +65,7 @@ Value valueFromDynamicShallow(
 
 Value valueFromDynamic(Runtime& runtime, const folly::dynamic& dynInput) {
   std::vector<FromDynamic> stack;
+  std::shared_ptr<PropNameIDCache> propNameIDCache;
 
   Value ret = valueFromDynamicShallow(runtime, stack, dynInput);
 
@@ -84,14 +86,22 @@ Value valueFromDynamic(Runtime& runtime, const folly::dynamic& dynInput) {
       }
       case folly::dynamic::OBJECT: {
         Object obj = std::move(top.obj);
+        if (!propNameIDCache) {
+          propNameIDCache = PropNameIDCache::get(runtime);
+        }
+        std::vector<PropNameID> names;
+        std::vector<Value> values;
+        names.reserve(top.dyn->size());
+        values.reserve(top.dyn->size());
         for (const auto& element : top.dyn->items()) {
           if (element.first.isNumber() || element.first.isString()) {
-            obj.setProperty(
-                runtime,
-                PropNameID::forUtf8(runtime, element.first.asString()),
+            names.push_back(
+                propNameIDCache->forUtf8(runtime, element.first.asString()));
+            values.push_back(
                 valueFromDynamicShallow(runtime, stack, element.second));
           }
         }
+        obj.setProperties(runtime, names.data(), values.data(), names.size());
         break;
       }
       default:
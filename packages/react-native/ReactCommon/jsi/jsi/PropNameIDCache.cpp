@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "PropNameIDCache.h"
+
+namespace facebook {
+namespace jsi {
+
+namespace {
+
+constexpr auto kPropNameIDCacheName = "__jsiPropNameIDCache";
+
+} // namespace
+
+std::shared_ptr<PropNameIDCache> PropNameIDCache::get(Runtime& runtime) {
+  auto global = runtime.global();
+  auto value = global.getProperty(runtime, kPropNameIDCacheName);
+  if (value.isObject()) {
+    auto object = value.getObject(runtime);
+    if (object.isHostObject<PropNameIDCache>(runtime)) {
+      return object.getHostObject<PropNameIDCache>(runtime);
+    }
+  }
+
+  auto cache = std::make_shared<PropNameIDCache>();
+  global.setProperty(
+      runtime,
+      kPropNameIDCacheName,
+      Object::createFromHostObject(runtime, cache));
+  return cache;
+}
+
+PropNameID PropNameIDCache::forUtf8(Runtime& runtime, const std::string& name) {
+  auto it = names_.find(name);
+  if (it != names_.end()) {
+    return PropNameID(runtime, it->second);
+  }
+
+  auto propNameID = PropNameID::forUtf8(runtime, name);
+  if (names_.size() < kMaxSize) {
+    names_.emplace(name, PropNameID(runtime, propNameID));
+  }
+  return propNameID;
+}
+
+size_t PropNameIDCache::size() const {
+  return names_.size();
+}
+
+} // namespace jsi
+} // namespace facebook
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace facebook {
+namespace jsi {
+
+/// A per-runtime cache of PropNameIDs for property names which conversions
+/// to JS use over and over (e.g. "x", "width" or "nativeEvent"), so that they
+/// are not re-created from their UTF-8 representation every time.
+/// The cache is installed as a host object on the global object of the
+/// runtime, so the runtime owns it and cached PropNameIDs never outlive it.
+/// It must only be used on the JS thread.
+class PropNameIDCache : public HostObject {
+ public:
+  /// The maximum number of cached names. Names beyond it are created
+  /// uncached, so that converting objects with arbitrary keys can't grow the
+  /// cache without bounds.
+  static constexpr size_t kMaxSize = 1024;
+
+  /// \return the cache of the given runtime, installing it if needed.
+  /// Callers converting many properties should get the cache once and use
+  /// it for all of them.
+  static std::shared_ptr<PropNameIDCache> get(Runtime& runtime);
+
+  /// \return a PropNameID for the given UTF-8 name, which is cached for
+  /// subsequent calls.
+  PropNameID forUtf8(Runtime& runtime, const std::string& name);
+
+  /// \return the number of cached names.
+  size_t size() const;
+
+ private:
+  std::unordered_map<std::string, PropNameID> names_;
+};
+
+} // namespace jsi
+} // namespace facebook
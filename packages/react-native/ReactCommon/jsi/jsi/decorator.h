@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <memory>
 #include <tuple>
 
 #include <jsi/instrumentation.h>
@@ -278,6 +279,26 @@ class RuntimeDecorator : public Base, private jsi::Instrumentation {
       override {
     plain_.setPropertyValue(o, name, value);
   };
+  Object createObjectWithProperties(
+      const PropNameID* names,
+      const Value* values,
+      size_t count) override {
+    return plain_.createObjectWithProperties(names, values, count);
+  };
+  void setPropertyValues(
+      const Object& o,
+      const PropNameID* names,
+      const Value* values,
+      size_t count) override {
+    plain_.setPropertyValues(o, names, values, count);
+  };
+  void getPropertyValues(
+      const Object& o,
+      const PropNameID* names,
+      Value* values,
+      size_t count) override {
+    plain_.getPropertyValues(o, names, values, count);
+  };
 
   bool isArray(const Object& o) const override {
     return plain_.isArray(o);
@@ -675,6 +696,29 @@ class WithRuntimeDecorator : public RuntimeDecorator<Plain, Base> {
     Around around{with_};
     RD::setPropertyValue(o, name, value);
   };
+  Object createObjectWithProperties(
+      const PropNameID* names,
+      const Value* values,
+      size_t count) override {
+    Around around{with_};
+    return RD::createObjectWithProperties(names, values, count);
+  };
+  void setPropertyValues(
+      const Object& o,
+      const PropNameID* names,
+      const Value* values,
+      size_t count) override {
+    Around around{with_};
+    RD::setPropertyValues(o, names, values, count);
+  };
+  void getPropertyValues(
+      const Object& o,
+      const PropNameID* names,
+      Value* values,
+      size_t count) override {
+    Around around{with_};
+    RD::getPropertyValues(o, names, values, count);
+  };
 
   bool isArray(const Object& o) const override {
     Around around{with_};
@@ -806,5 +850,46 @@ class WithRuntimeDecorator : public RuntimeDecorator<Plain, Base> {
   With& with_;
 };
 
+// Combines the before and after hooks of several With types (see
+// WithRuntimeDecorator) into a single decorator which owns the plain
+// runtime and the With instances. Compared to stacking a
+// WithRuntimeDecorator per With type, where every layer adds a virtual call
+// to every operation, the hooks of all of the With types are inlined into
+// the methods of this decorator, so an operation costs one virtual call into
+// the decorator, plus one into the plain runtime. When Plain is a final
+// runtime type, the latter is devirtualized as well.
+//
+// Every With type must be constructible from Plain&. Before hooks are called
+// in the order of the With types, and after hooks in the reverse order, so
+// ComposedRuntimeDecorator<Plain, Tracing, Lock> behaves like a tracing
+// decorator wrapping a locking decorator wrapping the plain runtime.
+template <typename Plain, typename... With>
+class ComposedRuntimeDecorator final
+    : public WithRuntimeDecorator<std::tuple<With...>, Plain> {
+ public:
+  using WRD = WithRuntimeDecorator<std::tuple<With...>, Plain>;
+
+  explicit ComposedRuntimeDecorator(std::unique_ptr<Plain> plain)
+      : WRD(*plain, with_),
+        plainOwner_(std::move(plain)),
+        with_(plainFor<With>()...) {}
+
+  // Returns the instance of the given With type.
+  template <typename W>
+  W& with() {
+    return std::get<W>(with_);
+  }
+
+ private:
+  // Expands to the plain runtime once per With type.
+  template <typename W>
+  Plain& plainFor() {
+    return *plainOwner_;
+  }
+
+  std::unique_ptr<Plain> plainOwner_;
+  std::tuple<With...> with_;
+};
+
 } // namespace jsi
 } // namespace facebook
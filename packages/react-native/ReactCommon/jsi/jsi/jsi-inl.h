@@ -232,6 +232,22 @@ inline void Object::setExternalMemoryPressure(Runtime& runtime, size_t amt)
   runtime.setExternalMemoryPressure(*this, amt);
 }
 
+inline void Object::setProperties(
+    Runtime& runtime,
+    const PropNameID* names,
+    const Value* values,
+    size_t count) const {
+  runtime.setPropertyValues(*this, names, values, count);
+}
+
+inline void Object::getProperties(
+    Runtime& runtime,
+    const PropNameID* names,
+    Value* values,
+    size_t count) const {
+  runtime.getPropertyValues(*this, names, values, count);
+}
+
 inline Array Object::getPropertyNames(Runtime& runtime) const {
   return runtime.getPropertyNames(*this);
 }
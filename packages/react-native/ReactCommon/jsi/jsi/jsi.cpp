@@ -143,6 +143,35 @@ Value Runtime::createValueFromJsonUtf8(const uint8_t* json, size_t length) {
   return parseJson.call(*this, String::createFromUtf8(*this, json, length));
 }
 
+Object Runtime::createObjectWithProperties(
+    const PropNameID* names,
+    const Value* values,
+    size_t count) {
+  Object object = createObject();
+  setPropertyValues(object, names, values, count);
+  return object;
+}
+
+void Runtime::setPropertyValues(
+    const Object& object,
+    const PropNameID* names,
+    const Value* values,
+    size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    setPropertyValue(object, names[i], values[i]);
+  }
+}
+
+void Runtime::getPropertyValues(
+    const Object& object,
+    const PropNameID* names,
+    Value* values,
+    size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    values[i] = getProperty(object, names[i]);
+  }
+}
+
 Pointer& Pointer::operator=(Pointer&& other) {
   if (ptr_) {
     ptr_->invalidate();
@@ -343,6 +343,29 @@ class JSI_EXPORT Runtime {
   virtual void
   setPropertyValue(const Object&, const String& name, const Value& value) = 0;
 
+  // \return a new \c Object with the \c count properties given by \c names
+  // and \c values, in order. The default implementation creates an empty
+  // object and sets each property in turn; runtimes can override this to
+  // build the object in a single step.
+  virtual Object createObjectWithProperties(
+      const PropNameID* names,
+      const Value* values,
+      size_t count);
+  // Sets the \c count properties given by \c names and \c values, in order.
+  // The default implementation invokes \c setPropertyValue for each of them.
+  virtual void setPropertyValues(
+      const Object&,
+      const PropNameID* names,
+      const Value* values,
+      size_t count);
+  // Reads the \c count properties given by \c names into \c values. The
+  // default implementation invokes \c getProperty for each of them.
+  virtual void getPropertyValues(
+      const Object&,
+      const PropNameID* names,
+      Value* values,
+      size_t count);
+
   virtual bool isArray(const Object&) const = 0;
   virtual bool isArrayBuffer(const Object&) const = 0;
   virtual bool isFunction(const Object&) const = 0;
@@ -849,6 +872,34 @@ class JSI_EXPORT Object : public Pointer {
   /// no longer factor into GC decisions.
   void setExternalMemoryPressure(Runtime& runtime, size_t amt) const;
 
+  /// Creates a new Object with the \c count properties given by \c names
+  /// and \c values, like an object literal in JS. This is more efficient
+  /// than setting each property in turn on runtimes which support it.
+  static Object createWithProperties(
+      Runtime& runtime,
+      const PropNameID* names,
+      const Value* values,
+      size_t count) {
+    return runtime.createObjectWithProperties(names, values, count);
+  }
+
+  /// Sets the \c count properties given by \c names and \c values, in
+  /// order, as if \c setProperty was invoked for each of them.
+  void setProperties(
+      Runtime& runtime,
+      const PropNameID* names,
+      const Value* values,
+      size_t count) const;
+
+  /// Reads the \c count properties given by \c names into \c values, which
+  /// must have room for \c count elements. Missing properties are read as
+  /// the undefined value.
+  void getProperties(
+      Runtime& runtime,
+      const PropNameID* names,
+      Value* values,
+      size_t count) const;
+
  protected:
   void setPropertyValue(
       Runtime& runtime,
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <jsi/decorator.h>
+#include <jsi/test/testlib.h>
+
+#include <memory>
+
+// Compares the overhead per call of stacking decorators, one runtime per
+// decorator, with composing them into a single ComposedRuntimeDecorator. Like
+// the tests in testlib.cpp, this runs against the runtime of the engine
+// linking it.
+
+namespace facebook {
+namespace jsi {
+
+namespace {
+
+struct Counter {
+  explicit Counter(Runtime&) {}
+  void before() {
+    ++count;
+  }
+  int count = 0;
+};
+
+struct Depth {
+  explicit Depth(Runtime&) {}
+  void before() {
+    ++depth;
+  }
+  void after() {
+    --depth;
+  }
+  int depth = 0;
+};
+
+// Reads and writes a property of an object `count` times, as e.g. a worklet
+// updating the state of an animation does.
+void readAndWriteProperty(Runtime& rt, const Object& object, int count) {
+  auto name = PropNameID::forAscii(rt, "value");
+  for (int i = 0; i < count; i++) {
+    auto value = object.getProperty(rt, name).getNumber();
+    object.setProperty(rt, name, value + 1);
+  }
+}
+
+void run(benchmark::State& state, Runtime& rt) {
+  auto object = Object(rt);
+  object.setProperty(rt, "value", 0);
+  for (auto _ : state) {
+    readAndWriteProperty(rt, object, static_cast<int>(state.range(0)));
+  }
+}
+
+void undecorated(benchmark::State& state) {
+  auto rt = runtimeGenerators().front()();
+  run(state, *rt);
+}
+BENCHMARK(undecorated)->Arg(1)->Arg(100)->Arg(10000);
+
+void stackedDecorators(benchmark::State& state) {
+  ComposedRuntimeDecorator<Runtime, Counter> rt(
+      std::make_unique<ComposedRuntimeDecorator<Runtime, Depth>>(
+          runtimeGenerators().front()()));
+  run(state, rt);
+}
+BENCHMARK(stackedDecorators)->Arg(1)->Arg(100)->Arg(10000);
+
+void composedDecorators(benchmark::State& state) {
+  ComposedRuntimeDecorator<Runtime, Counter, Depth> rt(
+      runtimeGenerators().front()());
+  run(state, rt);
+}
+BENCHMARK(composedDecorators)->Arg(1)->Arg(100)->Arg(10000);
+
+} // namespace
+
+} // namespace jsi
+} // namespace facebook
+
+BENCHMARK_MAIN();
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <jsi/decorator.h>
+#include <jsi/test/testlib.h>
+#include <jsi/threadsafe.h>
+
+#include <memory>
+#include <mutex>
+
+// Compares locking a ThreadSafeRuntime for every call with locking it once
+// for a batch of calls through ThreadSafeRuntimeScope. Like the tests in
+// testlib.cpp, this runs against the runtime of the engine linking it.
+
+namespace facebook {
+namespace jsi {
+
+namespace {
+
+struct RecursiveMutexLock {
+  RecursiveMutexLock(Runtime&) {}
+  void lock() {
+    mutex.lock();
+  }
+  void unlock() {
+    mutex.unlock();
+  }
+  std::recursive_mutex mutex;
+};
+
+using WithLock = detail::WithLock<Runtime, RecursiveMutexLock>;
+
+// Same as detail::ThreadSafeRuntimeImpl, but wrapping the runtime of the
+// engine, whose type isn't known here.
+class BenchmarkRuntime final
+    : public WithRuntimeDecorator<WithLock, Runtime, ThreadSafeRuntime> {
+ public:
+  BenchmarkRuntime() : BenchmarkRuntime(runtimeGenerators().front()()) {}
+
+  Runtime& getUnsafeRuntime() override {
+    return plain();
+  }
+
+  void lock() const override {
+    lock_.before();
+  }
+
+  void unlock() const override {
+    lock_.after();
+  }
+
+ private:
+  explicit BenchmarkRuntime(std::unique_ptr<Runtime> unsafe)
+      : WithRuntimeDecorator<WithLock, Runtime, ThreadSafeRuntime>(
+            *unsafe,
+            lock_),
+        unsafe_(std::move(unsafe)),
+        lock_(*unsafe_) {}
+
+  std::unique_ptr<Runtime> unsafe_;
+  mutable WithLock lock_;
+};
+
+// Reads and writes a property of an object `count` times, as e.g. a worklet
+// updating the state of an animation does.
+void readAndWriteProperty(Runtime& rt, const Object& object, int count) {
+  auto name = PropNameID::forAscii(rt, "value");
+  for (int i = 0; i < count; i++) {
+    auto value = object.getProperty(rt, name).getNumber();
+    object.setProperty(rt, name, value + 1);
+  }
+}
+
+void perCallLocking(benchmark::State& state) {
+  BenchmarkRuntime rt;
+  auto object = Object(rt);
+  object.setProperty(rt, "value", 0);
+  for (auto _ : state) {
+    readAndWriteProperty(rt, object, static_cast<int>(state.range(0)));
+  }
+}
+BENCHMARK(perCallLocking)->Arg(1)->Arg(100)->Arg(10000);
+
+void scopedLocking(benchmark::State& state) {
+  BenchmarkRuntime rt;
+  auto object = Object(rt);
+  object.setProperty(rt, "value", 0);
+  for (auto _ : state) {
+    ThreadSafeRuntimeScope scope(rt);
+    readAndWriteProperty(
+        scope.runtime(), object, static_cast<int>(state.range(0)));
+  }
+}
+BENCHMARK(scopedLocking)->Arg(1)->Arg(100)->Arg(10000);
+
+} // namespace
+
+} // namespace jsi
+} // namespace facebook
+
+BENCHMARK_MAIN();
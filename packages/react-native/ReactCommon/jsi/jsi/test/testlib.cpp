@@ -8,15 +8,18 @@
 #include <jsi/test/testlib.h>
 
 #include <gtest/gtest.h>
+#include <jsi/PropNameIDCache.h>
 #include <jsi/decorator.h>
 #include <jsi/jsi.h>
 
 #include <stdlib.h>
 #include <chrono>
 #include <functional>
+#include <string>
 #include <thread>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 using namespace facebook::jsi;
 
@@ -178,6 +181,48 @@ TEST_P(JSITest, ObjectTest) {
   EXPECT_EQ(names.getValueAtIndex(rt, 0).getString(rt).utf8(rt), "a");
 }
 
+TEST_P(JSITest, BulkPropertiesTest) {
+  PropNameID names[] = {
+      PropNameID::forAscii(rt, "a"),
+      PropNameID::forAscii(rt, "b"),
+      PropNameID::forAscii(rt, "a")};
+  Value values[] = {Value(1), String::createFromAscii(rt, "two"), Value(3)};
+
+  Object obj = Object::createWithProperties(rt, names, values, 3);
+  rt.global().setProperty(rt, "obj", obj);
+  EXPECT_TRUE(eval("Object.keys(obj).join() == 'a,b'").getBool());
+  EXPECT_TRUE(eval("obj.a == 3 && obj.b == 'two'").getBool());
+
+  Value updated[] = {Value(true), Value::null()};
+  obj.setProperties(rt, names, updated, 2);
+  EXPECT_TRUE(eval("obj.a === true && obj.b === null").getBool());
+
+  PropNameID read[] = {
+      PropNameID::forAscii(rt, "a"), PropNameID::forAscii(rt, "missing")};
+  Value results[2];
+  obj.getProperties(rt, read, results, 2);
+  EXPECT_TRUE(results[0].getBool());
+  EXPECT_TRUE(results[1].isUndefined());
+}
+
+TEST_P(JSITest, PropNameIDCacheTest) {
+  auto cache = PropNameIDCache::get(rt);
+  EXPECT_EQ(PropNameIDCache::get(rt), cache);
+
+  PropNameID first = cache->forUtf8(rt, "width");
+  PropNameID second = cache->forUtf8(rt, "width");
+  EXPECT_TRUE(PropNameID::compare(rt, first, second));
+  EXPECT_EQ(second.utf8(rt), "width");
+  EXPECT_EQ(cache->size(), 1);
+
+  for (size_t i = 0; i <= PropNameIDCache::kMaxSize; i++) {
+    cache->forUtf8(rt, "key" + std::to_string(i));
+  }
+  EXPECT_EQ(cache->size(), PropNameIDCache::kMaxSize);
+  PropNameID uncached = cache->forUtf8(rt, "uncached");
+  EXPECT_EQ(uncached.utf8(rt), "uncached");
+}
+
 TEST_P(JSITest, HostObjectTest) {
   class ConstantHostObject : public HostObject {
     Value get(Runtime&, const PropNameID& sym) override {
@@ -1258,6 +1303,47 @@ TEST_P(JSITest, MultiDecoratorTest) {
   EXPECT_EQ(mrt.nest(), 0);
 }
 
+TEST_P(JSITest, ComposedDecoratorTest) {
+  // With types are constructed by the decorator, so they record the order
+  // of their hooks here.
+  static std::vector<std::string> calls;
+  calls.clear();
+
+  struct Outer {
+    explicit Outer(Runtime&) {}
+    void before() {
+      calls.push_back("outer before");
+    }
+    void after() {
+      calls.push_back("outer after");
+    }
+  };
+
+  struct Inner {
+    explicit Inner(Runtime&) {}
+    void before() {
+      calls.push_back("inner before");
+      ++count;
+    }
+    void after() {
+      calls.push_back("inner after");
+    }
+    int count = 0;
+  };
+
+  ComposedRuntimeDecorator<Runtime, Outer, Inner> crt(factory());
+
+  crt.description();
+  EXPECT_EQ(crt.with<Inner>().count, 1);
+  EXPECT_EQ(
+      calls,
+      (std::vector<std::string>{
+          "outer before", "inner before", "inner after", "outer after"}));
+
+  crt.global().setProperty(crt, "o", Object(crt));
+  EXPECT_EQ(crt.with<Inner>().count, 6);
+}
+
 TEST_P(JSITest, SymbolTest) {
   if (!rt.global().hasProperty(rt, "Symbol")) {
     // Symbol is an es6 feature which doesn't exist in older VMs.  So
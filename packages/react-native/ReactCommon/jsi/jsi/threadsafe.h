@@ -8,6 +8,7 @@
 #pragma once
 
 #include <mutex>
+#include <utility>
 
 #include <jsi/decorator.h>
 #include <jsi/jsi.h>
@@ -22,6 +23,50 @@ class ThreadSafeRuntime : public Runtime {
   virtual Runtime& getUnsafeRuntime() = 0;
 };
 
+// Owns a ThreadSafeRuntime for the lifetime of the scope: the runtime is
+// locked once when the scope is created and unlocked when it is destroyed,
+// and calls made through runtime() go straight to the unsafe runtime, without
+// taking the lock and going through the decorator on each of them. This is
+// meant for batches of operations on a thread which would otherwise lock the
+// runtime for every single call.
+//
+// Values are shared by the runtime and its unsafe runtime, so they can be
+// used with either of them. However, host functions and host objects created
+// through runtime() are passed the unsafe runtime when they are called.
+//
+// While the scope is alive, the ThreadSafeRuntime itself must not be used on
+// the same thread unless its lock is recursive.
+class ThreadSafeRuntimeScope {
+ public:
+  explicit ThreadSafeRuntimeScope(ThreadSafeRuntime& runtime)
+      : runtime_(runtime) {
+    runtime_.lock();
+  }
+
+  ~ThreadSafeRuntimeScope() {
+    runtime_.unlock();
+  }
+
+  ThreadSafeRuntimeScope(const ThreadSafeRuntimeScope&) = delete;
+  ThreadSafeRuntimeScope& operator=(const ThreadSafeRuntimeScope&) = delete;
+
+  Runtime& runtime() {
+    return runtime_.getUnsafeRuntime();
+  }
+
+ private:
+  ThreadSafeRuntime& runtime_;
+};
+
+// Calls f with the unsafe runtime of the given ThreadSafeRuntime, which is
+// locked for the duration of the call, and returns what f returns. See
+// ThreadSafeRuntimeScope.
+template <typename F>
+decltype(auto) withUnsafeRuntime(ThreadSafeRuntime& runtime, F&& f) {
+  ThreadSafeRuntimeScope scope(runtime);
+  return std::forward<F>(f)(scope.runtime());
+}
+
 namespace detail {
 
 template <typename R, typename L>
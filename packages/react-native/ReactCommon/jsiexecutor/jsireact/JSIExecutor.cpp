@@ -61,6 +61,85 @@ std::string simpleBasename(const std::string& path) {
   return (pos != std::string::npos) ? path.substr(pos) : path;
 }
 
+// Like parseMethodCalls in cxxreact/MethodCall.h, but reads the queue of
+// MessageQueue.flushedQueue() straight from JS: only the arguments of each
+// call are converted to dynamic, and the queue itself never is.
+std::vector<MethodCall> parseMethodCalls(Runtime& runtime, const Value& calls) {
+  constexpr const char* errorPrefix = "Malformed calls from JS: ";
+  constexpr size_t kModuleIds = 0;
+  constexpr size_t kMethodIds = 1;
+  constexpr size_t kParams = 2;
+  constexpr size_t kCallId = 3;
+
+  if (calls.isNull() || calls.isUndefined()) {
+    return {};
+  }
+
+  auto isArray = [&](const Value& value) {
+    return value.isObject() && value.getObject(runtime).isArray(runtime);
+  };
+  if (!isArray(calls)) {
+    throw std::invalid_argument(
+        folly::to<std::string>(errorPrefix, "input isn't array"));
+  }
+
+  auto queue = calls.getObject(runtime).getArray(runtime);
+  auto queueSize = queue.size(runtime);
+  if (queueSize < kParams + 1) {
+    throw std::invalid_argument(
+        folly::to<std::string>(errorPrefix, "size == ", queueSize));
+  }
+
+  auto getField = [&](size_t index) {
+    auto field = queue.getValueAtIndex(runtime, index);
+    if (!isArray(field)) {
+      throw std::invalid_argument(
+          folly::to<std::string>(errorPrefix, "not all fields are arrays"));
+    }
+    return field.getObject(runtime).getArray(runtime);
+  };
+  auto moduleIds = getField(kModuleIds);
+  auto methodIds = getField(kMethodIds);
+  auto params = getField(kParams);
+
+  auto size = moduleIds.size(runtime);
+  if (methodIds.size(runtime) != size || params.size(runtime) != size) {
+    throw std::invalid_argument(
+        folly::to<std::string>(errorPrefix, "field sizes are different"));
+  }
+
+  int callId = -1;
+  if (queueSize > kCallId) {
+    auto callIdValue = queue.getValueAtIndex(runtime, kCallId);
+    if (!callIdValue.isNumber()) {
+      throw std::invalid_argument(
+          folly::to<std::string>(errorPrefix, "invalid callId"));
+    }
+    callId = static_cast<int>(callIdValue.getNumber());
+  }
+
+  std::vector<MethodCall> methodCalls;
+  methodCalls.reserve(size);
+  for (size_t i = 0; i < size; i++) {
+    auto arguments = params.getValueAtIndex(runtime, i);
+    if (!isArray(arguments)) {
+      throw std::invalid_argument(folly::to<std::string>(
+          errorPrefix, "method arguments isn't array"));
+    }
+
+    methodCalls.emplace_back(
+        static_cast<int>(moduleIds.getValueAtIndex(runtime, i).asNumber()),
+        static_cast<int>(methodIds.getValueAtIndex(runtime, i).asNumber()),
+        dynamicFromValue(runtime, arguments),
+        callId);
+
+    // only increment callid if contains valid callid as callid is optional
+    callId += (callId != -1) ? 1 : 0;
+  }
+
+  return methodCalls;
+}
+
 } // namespace
 
 JSIExecutor::JSIExecutor(
@@ -157,8 +236,8 @@ void JSIExecutor::loadBundle(
     ReactMarker::logTaggedMarker(
         ReactMarker::RUN_JS_BUNDLE_START, scriptName.c_str());
   }
-  runtime_->evaluateJavaScript(
-      std::make_unique<BigStringBuffer>(std::move(script)), sourceURL);
+  evaluateBundle(
+      std::make_shared<BigStringBuffer>(std::move(script)), sourceURL);
   flush();
   if (hasLogger) {
     ReactMarker::logTaggedMarker(
@@ -168,6 +247,12 @@ void JSIExecutor::loadBundle(
   }
 }
 
+void JSIExecutor::evaluateBundle(
+    const std::shared_ptr<const jsi::Buffer>& buffer,
+    const std::string& sourceURL) {
+  runtime_->evaluateJavaScript(buffer, sourceURL);
+}
+
 void JSIExecutor::setBundleRegistry(std::unique_ptr<RAMBundleRegistry> r) {
   if (!bundleRegistry_) {
     runtime_->global().setProperty(
@@ -246,6 +331,49 @@ void JSIExecutor::callFunction(
   callNativeModules(ret, true);
 }
 
+void JSIExecutor::callFunctions(const std::vector<JSFunctionCall>& calls) {
+  SystraceSection s("JSIExecutor::callFunctions", "count", calls.size());
+  if (!callFunctionReturnFlushedQueue_) {
+    bindBridge();
+  }
+  if (!callFunctionsReturnFlushedQueue_ || calls.size() == 1) {
+    JSExecutor::callFunctions(calls);
+    return;
+  }
+
+  auto errorProducer = [count = calls.size()] {
+    std::stringstream ss;
+    ss << "batch of " << count << " function calls";
+    return ss.str();
+  };
+
+  Value ret = Value::undefined();
+  try {
+    scopedTimeoutInvoker_(
+        [&] {
+          auto jsCalls = Array(*runtime_, calls.size());
+          for (size_t i = 0; i < calls.size(); i++) {
+            jsCalls.setValueAtIndex(
+                *runtime_,
+                i,
+                Array::createWithElements(
+                    *runtime_,
+                    String::createFromUtf8(*runtime_, calls[i].moduleId),
+                    String::createFromUtf8(*runtime_, calls[i].methodId),
+                    valueFromDynamic(*runtime_, calls[i].arguments)));
+          }
+          ret = callFunctionsReturnFlushedQueue_->call(*runtime_, jsCalls);
+        },
+        std::move(errorProducer));
+  } catch (...) {
+    std::throw_with_nested(std::runtime_error(
+        "Error calling a batch of " + std::to_string(calls.size()) +
+        " functions"));
+  }
+
+  callNativeModules(ret, true);
+}
+
 void JSIExecutor::invokeCallback(
     const double callbackId,
     const folly::dynamic& arguments) {
@@ -371,6 +499,13 @@ void JSIExecutor::bindBridge() {
     Object batchedBridge = batchedBridgeValue.asObject(*runtime_);
     callFunctionReturnFlushedQueue_ = batchedBridge.getPropertyAsFunction(
         *runtime_, "callFunctionReturnFlushedQueue");
+    auto callFunctions =
+        batchedBridge.getProperty(*runtime_, "callFunctionsReturnFlushedQueue");
+    if (callFunctions.isObject() &&
+        callFunctions.getObject(*runtime_).isFunction(*runtime_)) {
+      callFunctionsReturnFlushedQueue_ =
+          callFunctions.getObject(*runtime_).getFunction(*runtime_);
+    }
     invokeCallbackAndReturnFlushedQueue_ = batchedBridge.getPropertyAsFunction(
         *runtime_, "invokeCallbackAndReturnFlushedQueue");
     flushedQueue_ =
@@ -391,7 +526,7 @@ void JSIExecutor::callNativeModules(const Value& queue, bool isEndOfBatch) {
   BridgeNativeModulePerfLogger::asyncMethodCallBatchPreprocessStart();
 
   delegate_->callNativeModules(
-      *this, dynamicFromValue(*runtime_, queue), isEndOfBatch);
+      *this, parseMethodCalls(*runtime_, queue), isEndOfBatch);
 }
 
 void JSIExecutor::flush() {
@@ -88,6 +88,7 @@ class JSIExecutor : public JSExecutor {
       const std::string& moduleId,
       const std::string& methodId,
       const folly::dynamic& arguments) override;
+  void callFunctions(const std::vector<JSFunctionCall>& calls) override;
   void invokeCallback(const double callbackId, const folly::dynamic& arguments)
       override;
   void setGlobalVariable(
@@ -109,6 +110,15 @@ class JSIExecutor : public JSExecutor {
 
   void flush() override;
 
+ protected:
+  /*
+   * Evaluates the script of a bundle loaded with `loadBundle`. Subclasses can
+   * override it, e.g. to evaluate a cached compilation of the script instead.
+   */
+  virtual void evaluateBundle(
+      const std::shared_ptr<const jsi::Buffer>& buffer,
+      const std::string& sourceURL);
+
  private:
   class NativeModuleProxy;
 
@@ -128,6 +138,8 @@ class JSIExecutor : public JSExecutor {
   RuntimeInstaller runtimeInstaller_;
 
   std::optional<jsi::Function> callFunctionReturnFlushedQueue_;
+  // Not defined by bundles built before it was added to MessageQueue.
+  std::optional<jsi::Function> callFunctionsReturnFlushedQueue_;
   std::optional<jsi::Function> invokeCallbackAndReturnFlushedQueue_;
   std::optional<jsi::Function> flushedQueue_;
 };
@@ -23,6 +23,13 @@ static constexpr const std::chrono::duration RECONNECT_DELAY =
     std::chrono::milliseconds{2000};
 static constexpr const char* INVALID = "<invalid>";
 
+// CDP messages are batched for up to FLUSH_INTERVAL, or until the batch
+// reaches MAX_BATCH_SIZE bytes, to send e.g. the thousands of chunks of a heap
+// snapshot in a few frames.
+static constexpr const std::chrono::duration FLUSH_INTERVAL =
+    std::chrono::milliseconds{10};
+static constexpr size_t MAX_BATCH_SIZE = 1024 * 1024;
+
 // InspectorPackagerConnection::Impl method definitions
 
 std::shared_ptr<InspectorPackagerConnection::Impl>
@@ -49,6 +56,8 @@ void InspectorPackagerConnection::Impl::handleProxyMessage(
     folly::const_dynamic_view message) {
   std::string event = message.descend("event").string_or(INVALID);
   if (event == "getPages") {
+    supportsBatchedEvents_ =
+        message.descend("payload", "supportsBatchedEvents").bool_or(false);
     sendToPackager(
         folly::dynamic::object("event", "getPages")("payload", pages()));
   } else if (event == "wrappedEvent") {
@@ -195,7 +204,7 @@ void InspectorPackagerConnection::Impl::didReceiveMessage(
 }
 
 void InspectorPackagerConnection::Impl::didClose() {
-  webSocket_.reset();
+  disposeWebSocket();
   closeAllConnections();
   if (!closed_) {
     reconnect();
@@ -219,6 +228,7 @@ void InspectorPackagerConnection::Impl::connect() {
         << "Illegal state: Can't connect after having previously been closed.";
     return;
   }
+  supportsBatchedEvents_ = false;
   webSocket_ = delegate_->connectWebSocket(url_, weak_from_this());
 }
 
@@ -260,9 +270,74 @@ void InspectorPackagerConnection::Impl::sendToPackager(folly::dynamic message) {
     return;
   }
 
+  // Keep the messages of sessions ordered with e.g. their disconnect events.
+  flushWrappedEvents();
   webSocket_->send(folly::toJson(message));
 }
 
+bool InspectorPackagerConnection::Impl::isSessionValid(
+    SessionId sessionId,
+    const std::string& pageId) const {
+  auto sessionIt = inspectorSessions_.find(pageId);
+  return sessionIt != inspectorSessions_.end() &&
+      sessionIt->second.sessionId == sessionId;
+}
+
+void InspectorPackagerConnection::Impl::sendWrappedEventToPackager(
+    const std::string& pageId,
+    const std::string& wrappedEvent) {
+  if (!webSocket_) {
+    return;
+  }
+
+  if (!supportsBatchedEvents_) {
+    sendToPackager(folly::dynamic::object("event", "wrappedEvent")(
+        "payload",
+        folly::dynamic::object("pageId", pageId)(
+            "wrappedEvent", wrappedEvent)));
+    return;
+  }
+
+  // CDP messages are JSON, so they are embedded in the batch as is instead of
+  // being escaped into JSON strings.
+  if (!pendingWrappedEvents_.empty()) {
+    pendingWrappedEvents_ += ',';
+  }
+  pendingWrappedEvents_ += R"({"pageId":)";
+  pendingWrappedEvents_ += folly::toJson(pageId);
+  pendingWrappedEvents_ += R"(,"wrappedEvent":)";
+  pendingWrappedEvents_ += wrappedEvent;
+  pendingWrappedEvents_ += '}';
+
+  if (pendingWrappedEvents_.size() >= MAX_BATCH_SIZE) {
+    flushWrappedEvents();
+  } else if (!flushPending_) {
+    flushPending_ = true;
+    delegate_->scheduleCallback(
+        [weakSelf = weak_from_this()] {
+          auto strongSelf = weakSelf.lock();
+          if (strongSelf) {
+            strongSelf->flushPending_ = false;
+            strongSelf->flushWrappedEvents();
+          }
+        },
+        FLUSH_INTERVAL);
+  }
+}
+
+void InspectorPackagerConnection::Impl::flushWrappedEvents() {
+  if (pendingWrappedEvents_.empty()) {
+    return;
+  }
+  auto batch = std::string{R"({"event":"wrappedEvents","payload":[)"};
+  batch += pendingWrappedEvents_;
+  batch += "]}";
+  pendingWrappedEvents_.clear();
+  if (webSocket_) {
+    webSocket_->send(batch);
+  }
+}
+
 void InspectorPackagerConnection::Impl::scheduleSendToPackager(
     folly::dynamic message,
     SessionId sourceSessionId,
@@ -276,15 +351,33 @@ void InspectorPackagerConnection::Impl::scheduleSendToPackager(
         if (!strongSelf) {
           return;
         }
-        auto sessionIt = strongSelf->inspectorSessions_.find(sourcePageId);
-        if (sessionIt != strongSelf->inspectorSessions_.end() &&
-            sessionIt->second.sessionId == sourceSessionId) {
+        if (strongSelf->isSessionValid(sourceSessionId, sourcePageId)) {
           strongSelf->sendToPackager(std::move(message));
         }
       },
       0ms);
 }
 
+void InspectorPackagerConnection::Impl::scheduleSendWrappedEventToPackager(
+    std::string wrappedEvent,
+    SessionId sourceSessionId,
+    std::string sourcePageId) {
+  delegate_->scheduleCallback(
+      [weakSelf = weak_from_this(),
+       wrappedEvent = std::move(wrappedEvent),
+       sourceSessionId,
+       sourcePageId]() {
+        auto strongSelf = weakSelf.lock();
+        if (!strongSelf) {
+          return;
+        }
+        if (strongSelf->isSessionValid(sourceSessionId, sourcePageId)) {
+          strongSelf->sendWrappedEventToPackager(sourcePageId, wrappedEvent);
+        }
+      },
+      0ms);
+}
+
 void InspectorPackagerConnection::Impl::abort(
     std::optional<int> posixCode,
     const std::string& message,
@@ -300,6 +393,7 @@ void InspectorPackagerConnection::Impl::abort(
 }
 
 void InspectorPackagerConnection::Impl::disposeWebSocket() {
+  pendingWrappedEvents_.clear();
   webSocket_.reset();
 }
 
@@ -319,12 +413,8 @@ void InspectorPackagerConnection::Impl::RemoteConnection::onMessage(
   if (!owningPackagerConnectionStrong) {
     return;
   }
-  owningPackagerConnectionStrong->scheduleSendToPackager(
-      folly::dynamic::object("event", "wrappedEvent")(
-          "payload",
-          folly::dynamic::object("pageId", pageId_)("wrappedEvent", message)),
-      sessionId_,
-      pageId_);
+  owningPackagerConnectionStrong->scheduleSendWrappedEventToPackager(
+      std::move(message), sessionId_, pageId_);
 }
 
 void InspectorPackagerConnection::Impl::RemoteConnection::onDisconnect() {
@@ -52,6 +52,16 @@ class InspectorPackagerConnection::Impl
       SessionId sourceSessionId,
       std::string sourcePageId);
 
+  /**
+   * Send a CDP message of a session to the packager. Like
+   * scheduleSendToPackager, but the message is batched with the other
+   * messages sent during the flush interval if the packager supports it.
+   */
+  void scheduleSendWrappedEventToPackager(
+      std::string wrappedEvent,
+      SessionId sourceSessionId,
+      std::string sourcePageId);
+
  private:
   struct Session {
     std::unique_ptr<ILocalConnection> localConnection;
@@ -75,6 +85,11 @@ class InspectorPackagerConnection::Impl
   void closeAllConnections();
   void disposeWebSocket();
   void sendToPackager(folly::dynamic message);
+  bool isSessionValid(SessionId sessionId, const std::string& pageId) const;
+  void sendWrappedEventToPackager(
+      const std::string& pageId,
+      const std::string& wrappedEvent);
+  void flushWrappedEvents();
 
   void abort(
       std::optional<int> posixCode,
@@ -102,6 +117,15 @@ class InspectorPackagerConnection::Impl
   // Whether a reconnection is currently pending.
   bool reconnectPending_{false};
 
+  // Whether the packager accepts batches of unwrapped CDP messages, as
+  // advertised in its getPages requests.
+  bool supportsBatchedEvents_{false};
+
+  // The comma-separated elements of the next "wrappedEvents" batch, and
+  // whether a flush of the batch is scheduled.
+  std::string pendingWrappedEvents_;
+  bool flushPending_{false};
+
   SessionId nextSessionId_{1};
 };
 
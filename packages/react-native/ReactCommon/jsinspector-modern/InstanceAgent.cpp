@@ -5,7 +5,10 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <folly/dynamic.h>
+#include <folly/json.h>
 #include <jsinspector-modern/InstanceAgent.h>
+#include <jsinspector-modern/InstanceTarget.h>
 #include "RuntimeTarget.h"
 
 namespace facebook::react::jsinspector_modern {
@@ -16,17 +19,62 @@ InstanceAgent::InstanceAgent(
     SessionState& sessionState)
     : frontendChannel_(frontendChannel),
       target_(target),
-      sessionState_(sessionState) {
-  (void)target_;
-}
+      sessionState_(sessionState) {}
 
 bool InstanceAgent::handleRequest(const cdp::PreparsedRequest& req) {
+  if (req.method == "Tracing.start") {
+    target_.startTracing();
+    sendResult(req.id, folly::dynamic::object());
+    return true;
+  }
+  if (req.method == "Tracing.end") {
+    sendResult(req.id, folly::dynamic::object());
+    auto traceEvents = target_.collectTraceEvents();
+    sendTraceEvents(std::move(traceEvents.events));
+    frontendChannel_(folly::toJson(
+        folly::dynamic::object("method", "Tracing.tracingComplete")(
+            "params",
+            folly::dynamic::object(
+                "dataLossOccurred", traceEvents.dataLossOccurred))));
+    return true;
+  }
+
   if (runtimeAgent_ && runtimeAgent_->handleRequest(req)) {
     return true;
   }
   return false;
 }
 
+void InstanceAgent::sendResult(cdp::RequestId id, folly::dynamic result) {
+  frontendChannel_(
+      folly::toJson(folly::dynamic::object("id", id)("result", result)));
+}
+
+void InstanceAgent::sendTraceEvents(folly::dynamic events) {
+  // Native traces can contain tens of thousands of events, which are sent in
+  // chunks to keep every message (and the JSON string it is serialized to)
+  // reasonably small.
+  static constexpr size_t kTraceEventsChunkSize = 1000;
+
+  auto chunk = folly::dynamic::array();
+  for (auto& event : events) {
+    chunk.push_back(std::move(event));
+    if (chunk.size() == kTraceEventsChunkSize) {
+      sendTraceEventsChunk(std::move(chunk));
+      chunk = folly::dynamic::array();
+    }
+  }
+  if (!chunk.empty() || events.empty()) {
+    sendTraceEventsChunk(std::move(chunk));
+  }
+}
+
+void InstanceAgent::sendTraceEventsChunk(folly::dynamic chunk) {
+  frontendChannel_(folly::toJson(
+      folly::dynamic::object("method", "Tracing.dataCollected")(
+          "params", folly::dynamic::object("value", std::move(chunk)))));
+}
+
 void InstanceAgent::setCurrentRuntime(RuntimeTarget* runtimeTarget) {
   if (runtimeTarget) {
     runtimeAgent_ = runtimeTarget->createAgent(frontendChannel_, sessionState_);
@@ -10,6 +10,7 @@
 #include "RuntimeTarget.h"
 #include "SessionState.h"
 
+#include <folly/dynamic.h>
 #include <jsinspector-modern/InspectorInterfaces.h>
 #include <jsinspector-modern/Parsing.h>
 #include <jsinspector-modern/RuntimeAgent.h>
@@ -55,6 +56,15 @@ class InstanceAgent final {
   void setCurrentRuntime(RuntimeTarget* runtime);
 
  private:
+  void sendResult(cdp::RequestId id, folly::dynamic result);
+
+  /**
+   * Sends \c events (an array of Chrome trace events) to the frontend, in as
+   * many @cdp Tracing.dataCollected events as needed.
+   */
+  void sendTraceEvents(folly::dynamic events);
+  void sendTraceEventsChunk(folly::dynamic chunk);
+
   FrontendChannel frontendChannel_;
   InstanceTarget& target_;
   std::shared_ptr<RuntimeAgent> runtimeAgent_;
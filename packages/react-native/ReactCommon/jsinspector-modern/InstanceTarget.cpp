@@ -21,12 +21,16 @@ std::shared_ptr<InstanceTarget> InstanceTarget::create(
 }
 
 InstanceTarget::InstanceTarget(InstanceTargetDelegate& delegate)
-    : delegate_(delegate) {
-  (void)delegate_;
-}
+    : delegate_(delegate) {}
 
 InstanceTargetDelegate::~InstanceTargetDelegate() {}
 
+void InstanceTargetDelegate::startTracing() {}
+
+CollectedTraceEvents InstanceTargetDelegate::collectTraceEvents() {
+  return {};
+}
+
 std::shared_ptr<InstanceAgent> InstanceTarget::createAgent(
     FrontendChannel channel,
     SessionState& sessionState) {
@@ -67,4 +71,12 @@ void InstanceTarget::unregisterRuntime(RuntimeTarget& Runtime) {
   currentRuntime_.reset();
 }
 
+void InstanceTarget::startTracing() {
+  delegate_.startTracing();
+}
+
+CollectedTraceEvents InstanceTarget::collectTraceEvents() {
+  return delegate_.collectTraceEvents();
+}
+
 } // namespace facebook::react::jsinspector_modern
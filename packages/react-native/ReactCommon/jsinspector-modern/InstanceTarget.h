@@ -12,6 +12,7 @@
 #include "SessionState.h"
 #include "WeakList.h"
 
+#include <folly/dynamic.h>
 #include <jsinspector-modern/InspectorInterfaces.h>
 #include <jsinspector-modern/RuntimeAgent.h>
 
@@ -23,6 +24,21 @@ namespace facebook::react::jsinspector_modern {
 
 class InstanceAgent;
 
+/**
+ * The trace events recorded by an instance during a @cdp Tracing session.
+ */
+struct CollectedTraceEvents {
+  /**
+   * An array of Chrome trace events.
+   */
+  folly::dynamic events = folly::dynamic::array();
+
+  /**
+   * Whether some events were dropped because too many were recorded.
+   */
+  bool dataLossOccurred{false};
+};
+
 /**
  * Receives events from an InstanceTarget. This is a shared interface that
  * each React Native platform needs to implement in order to integrate with
@@ -37,6 +53,20 @@ class InstanceTargetDelegate {
   InstanceTargetDelegate& operator=(InstanceTargetDelegate&&) = default;
 
   virtual ~InstanceTargetDelegate();
+
+  /**
+   * Called when the frontend starts a @cdp Tracing session, to start
+   * recording the events that are too expensive to record all the time. This
+   * is called on the thread on which messages are dispatched to the session.
+   */
+  virtual void startTracing();
+
+  /**
+   * Called when the frontend ends a @cdp Tracing session, to stop recording
+   * and collect the events the instance recorded. This is called on the
+   * thread on which messages are dispatched to the session.
+   */
+  virtual CollectedTraceEvents collectTraceEvents();
 };
 
 /**
@@ -72,6 +102,18 @@ class InstanceTarget : public EnableExecutorFromThis<InstanceTarget> {
       RuntimeExecutor executor);
   void unregisterRuntime(RuntimeTarget& runtime);
 
+  /**
+   * Starts recording trace events. See
+   * \c InstanceTargetDelegate::startTracing.
+   */
+  void startTracing();
+
+  /**
+   * Collects the trace events recorded by the instance. See
+   * \c InstanceTargetDelegate::collectTraceEvents.
+   */
+  CollectedTraceEvents collectTraceEvents();
+
  private:
   /**
    * Constructs a new InstanceTarget. The caller must call setExecutor
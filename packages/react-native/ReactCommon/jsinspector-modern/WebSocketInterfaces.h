@@ -15,7 +15,9 @@ namespace facebook::react::jsinspector_modern {
 
 /**
  * Simplified interface to a WebSocket connection.
- * The socket MUST be initially open when constructed.
+ * The socket MUST be initially open when constructed. Implementations SHOULD
+ * negotiate the permessage-deflate extension (RFC 7692) if the server offers
+ * it: messages such as batches of CDP messages compress well.
  */
 class IWebSocket {
  public:
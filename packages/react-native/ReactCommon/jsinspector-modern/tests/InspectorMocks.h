@@ -121,7 +121,12 @@ class MockPageTargetDelegate : public PageTargetDelegate {
   MOCK_METHOD(void, onReload, (const PageReloadRequest& request), (override));
 };
 
-class MockInstanceTargetDelegate : public InstanceTargetDelegate {};
+class MockInstanceTargetDelegate : public InstanceTargetDelegate {
+ public:
+  // InstanceTargetDelegate methods
+  MOCK_METHOD(void, startTracing, (), (override));
+  MOCK_METHOD(CollectedTraceEvents, collectTraceEvents, (), (override));
+};
 
 class MockRuntimeTargetDelegate : public RuntimeTargetDelegate {
  public:
@@ -1201,6 +1201,75 @@ TEST_F(
   getInspectorInstance().removePage(pageId);
 }
 
+TEST_F(InspectorPackagerConnectionTestAsync, TestSendBatchedEvents) {
+  // Configure gmock to expect calls in a specific order.
+  InSequence mockCallsMustBeInSequence;
+
+  packagerConnection_->connect();
+  auto pageId = getInspectorInstance().addPage(
+      "mock-title",
+      "mock-vm",
+      localConnections_
+          .lazily_make_unique<std::unique_ptr<IRemoteConnection>>());
+
+  // The packager advertises support for batched events.
+  EXPECT_CALL(
+      *webSockets_[0], send(JsonParsed(AtJsonPtr("/event", Eq("getPages")))))
+      .RetiresOnSaturation();
+  webSockets_[0]->getDelegate().didReceiveMessage(R"({
+        "event": "getPages",
+        "payload": {
+          "supportsBatchedEvents": true
+        }
+      })");
+
+  // Connect to the page.
+  webSockets_[0]->getDelegate().didReceiveMessage(sformat(
+      R"({{
+          "event": "connect",
+          "payload": {{
+            "pageId": {0}
+          }}
+        }})",
+      toJson(std::to_string(pageId))));
+  ASSERT_TRUE(localConnections_[0]);
+
+  // Events sent during the flush interval are sent as a single batch, without
+  // being wrapped in JSON strings.
+  localConnections_[0]->getRemoteConnection().onMessage(R"({
+                                                            "method": "FakeDomain.firstEvent"
+                                                          })");
+  localConnections_[0]->getRemoteConnection().onMessage(R"({
+                                                            "method": "FakeDomain.secondEvent"
+                                                          })");
+  EXPECT_EQ(asyncExecutor_.run(), 2);
+
+  EXPECT_CALL(
+      *webSockets_[0],
+      send(JsonParsed(AllOf(
+          AtJsonPtr("/event", Eq("wrappedEvents")),
+          AtJsonPtr(
+              "/payload",
+              JsonEq(sformat(
+                  R"([
+                    {{
+                      "pageId": {0},
+                      "wrappedEvent": {{"method": "FakeDomain.firstEvent"}}
+                    }},
+                    {{
+                      "pageId": {0},
+                      "wrappedEvent": {{"method": "FakeDomain.secondEvent"}}
+                    }}
+                  ])",
+                  toJson(std::to_string(pageId))))))))
+      .RetiresOnSaturation();
+  asyncExecutor_.advance(1s);
+
+  // Clean up.
+  EXPECT_CALL(*localConnections_[0], disconnect()).RetiresOnSaturation();
+  getInspectorInstance().removePage(pageId);
+}
+
 TEST_F(InspectorPackagerConnectionTest, TestRejectedPageConnection) {
   // Configure gmock to expect calls in a specific order.
   InSequence mockCallsMustBeInSequence;
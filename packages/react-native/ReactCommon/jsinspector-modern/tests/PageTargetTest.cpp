@@ -218,6 +218,89 @@ TEST_F(PageTargetTest, ConnectToAlreadyRegisteredInstanceWithoutEvents) {
   page_->unregisterInstance(instanceTarget);
 }
 
+TEST_F(PageTargetProtocolTest, TracingCollectsInstanceTraceEvents) {
+  auto& instanceTarget = page_->registerInstance(instanceTargetDelegate_);
+
+  InSequence s;
+
+  EXPECT_CALL(instanceTargetDelegate_, startTracing());
+  EXPECT_CALL(fromPage(), onMessage(JsonEq(R"({
+                                               "id": 1,
+                                               "result": {}
+                                             })")));
+  toPage_->sendMessage(R"({
+                           "id": 1,
+                           "method": "Tracing.start"
+                         })");
+
+  EXPECT_CALL(instanceTargetDelegate_, collectTraceEvents())
+      .WillOnce(Return(CollectedTraceEvents{folly::dynamic::array(
+          folly::dynamic::object("name", "RUN_JS_BUNDLE")("ph", "X"))}));
+  EXPECT_CALL(fromPage(), onMessage(JsonEq(R"({
+                                               "id": 2,
+                                               "result": {}
+                                             })")));
+  EXPECT_CALL(fromPage(), onMessage(JsonEq(R"({
+                                               "method": "Tracing.dataCollected",
+                                               "params": {
+                                                 "value": [
+                                                   {"name": "RUN_JS_BUNDLE", "ph": "X"}
+                                                 ]
+                                               }
+                                             })")));
+  EXPECT_CALL(fromPage(), onMessage(JsonEq(R"({
+                                               "method": "Tracing.tracingComplete",
+                                               "params": {"dataLossOccurred": false}
+                                             })")));
+  toPage_->sendMessage(R"({
+                           "id": 2,
+                           "method": "Tracing.end"
+                         })");
+
+  page_->unregisterInstance(instanceTarget);
+}
+
+TEST_F(PageTargetProtocolTest, TracingSendsTraceEventsInChunks) {
+  auto& instanceTarget = page_->registerInstance(instanceTargetDelegate_);
+
+  EXPECT_CALL(instanceTargetDelegate_, startTracing());
+  EXPECT_CALL(fromPage(), onMessage(JsonParsed(AtJsonPtr("/id", Eq(1)))));
+  toPage_->sendMessage(R"({
+                           "id": 1,
+                           "method": "Tracing.start"
+                         })");
+
+  auto events = folly::dynamic::array();
+  for (int i = 0; i < 2500; i++) {
+    events.push_back(folly::dynamic::object("name", "event")("ph", "X"));
+  }
+  EXPECT_CALL(instanceTargetDelegate_, collectTraceEvents())
+      .WillOnce(Return(CollectedTraceEvents{std::move(events), true}));
+
+  InSequence s;
+  EXPECT_CALL(fromPage(), onMessage(JsonParsed(AtJsonPtr("/id", Eq(2)))));
+  for (size_t chunkSize : {1000, 1000, 500}) {
+    EXPECT_CALL(
+        fromPage(),
+        onMessage(JsonParsed(AllOf(
+            AtJsonPtr("/method", Eq("Tracing.dataCollected")),
+            AtJsonPtr(
+                "/params/value", Truly([=](const folly::dynamic& value) {
+                  return value.size() == chunkSize;
+                }))))));
+  }
+  EXPECT_CALL(fromPage(), onMessage(JsonEq(R"({
+                                               "method": "Tracing.tracingComplete",
+                                               "params": {"dataLossOccurred": true}
+                                             })")));
+  toPage_->sendMessage(R"({
+                           "id": 2,
+                           "method": "Tracing.end"
+                         })");
+
+  page_->unregisterInstance(instanceTarget);
+}
+
 TEST_F(PageTargetProtocolTest, RegisterUnregisterInstanceWithEvents) {
   InSequence s;
 
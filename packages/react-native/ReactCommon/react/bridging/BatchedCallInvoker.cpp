@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "BatchedCallInvoker.h"
+
+#include <unordered_map>
+
+namespace facebook::react {
+
+std::shared_ptr<CallInvoker> BatchedCallInvoker::get(
+    const std::shared_ptr<CallInvoker>& jsInvoker) {
+  static std::mutex mutex;
+  static std::unordered_map<CallInvoker*, std::weak_ptr<BatchedCallInvoker>>
+      batchedInvokers;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  if (auto batchedInvoker = batchedInvokers[jsInvoker.get()].lock()) {
+    return batchedInvoker;
+  }
+
+  // The address of an expired invoker may be reused by a new one, so entries
+  // are only trusted while their batched invoker (which retains the wrapped
+  // invoker) is alive.
+  for (auto it = batchedInvokers.begin(); it != batchedInvokers.end();) {
+    if (it->second.expired()) {
+      it = batchedInvokers.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  auto batchedInvoker = std::make_shared<BatchedCallInvoker>(jsInvoker);
+  batchedInvokers[jsInvoker.get()] = batchedInvoker;
+  return batchedInvoker;
+}
+
+BatchedCallInvoker::BatchedCallInvoker(std::shared_ptr<CallInvoker> jsInvoker)
+    : jsInvoker_(std::move(jsInvoker)) {}
+
+void BatchedCallInvoker::invokeAsync(CallFunc&& func) noexcept {
+  std::lock_guard<std::mutex> lock(mutex_);
+  pendingFuncs_.push_back(std::move(func));
+  scheduleFlush();
+}
+
+void BatchedCallInvoker::invokeAsync(
+    SchedulerPriority priority,
+    CallFunc&& func) noexcept {
+  jsInvoker_->invokeAsync(priority, std::move(func));
+}
+
+void BatchedCallInvoker::invokeSync(CallFunc&& func) {
+  jsInvoker_->invokeSync(std::move(func));
+}
+
+void BatchedCallInvoker::scheduleFlush() {
+  if (isFlushScheduled_) {
+    return;
+  }
+  isFlushScheduled_ = true;
+
+  // Retaining the invoker, so functions pending when the last user lets go
+  // of it still run.
+  jsInvoker_->invokeAsync([self = shared_from_this()]() { self->flush(); });
+}
+
+void BatchedCallInvoker::flush() {
+  auto funcs = std::deque<CallFunc>{};
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    funcs.swap(pendingFuncs_);
+    isFlushScheduled_ = false;
+  }
+
+  while (!funcs.empty()) {
+    auto func = std::move(funcs.front());
+    funcs.pop_front();
+    try {
+      func();
+    } catch (...) {
+      // The remaining functions run in the next batch, ahead of the functions
+      // invoked meanwhile.
+      if (!funcs.empty()) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pendingFuncs_.insert(
+            pendingFuncs_.begin(),
+            std::make_move_iterator(funcs.begin()),
+            std::make_move_iterator(funcs.end()));
+        scheduleFlush();
+      }
+      throw;
+    }
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include <ReactCommon/CallInvoker.h>
+
+namespace facebook::react {
+
+/**
+ * A `CallInvoker` which runs the functions passed to `invokeAsync` in batches:
+ * the first function schedules a single task on the wrapped invoker, and all
+ * functions invoked until that task runs are called by it, in order. Functions
+ * invoked with a priority aren't batched.
+ *
+ * Functions of a batch may run before functions invoked on the wrapped invoker
+ * directly in the meantime, so this is only meant for functions whose order
+ * only matters among themselves, e.g. settling promises (see `AsyncPromise`).
+ */
+class BatchedCallInvoker
+    : public CallInvoker,
+      public std::enable_shared_from_this<BatchedCallInvoker> {
+ public:
+  /**
+   * Returns the batched invoker of `jsInvoker`, which is shared by all callers
+   * for as long as any of them retains it.
+   */
+  static std::shared_ptr<CallInvoker> get(
+      const std::shared_ptr<CallInvoker>& jsInvoker);
+
+  explicit BatchedCallInvoker(std::shared_ptr<CallInvoker> jsInvoker);
+
+  void invokeAsync(CallFunc&& func) noexcept override;
+  void invokeAsync(SchedulerPriority priority, CallFunc&& func) noexcept
+      override;
+  void invokeSync(CallFunc&& func) override;
+
+ private:
+  void scheduleFlush();
+  void flush();
+
+  std::shared_ptr<CallInvoker> jsInvoker_;
+
+  std::mutex mutex_;
+  std::deque<CallFunc> pendingFuncs_;
+  bool isFlushScheduled_{false};
+};
+
+} // namespace facebook::react
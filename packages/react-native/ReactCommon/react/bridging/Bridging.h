@@ -16,5 +16,7 @@
 #include <react/bridging/Function.h>
 #include <react/bridging/Number.h>
 #include <react/bridging/Object.h>
+#include <react/bridging/ObjectView.h>
 #include <react/bridging/Promise.h>
+#include <react/bridging/TypedArray.h>
 #include <react/bridging/Value.h>
@@ -17,22 +17,39 @@ LongLivedObjectCollection& LongLivedObjectCollection::get() {
 
 void LongLivedObjectCollection::add(std::shared_ptr<LongLivedObject> so) {
   std::scoped_lock lock(collectionMutex_);
-  collection_.insert(std::move(so));
+  if (contains(so.get())) {
+    return;
+  }
+  so->collectionIndex_ = collection_.size();
+  collection_.push_back(std::move(so));
 }
 
 void LongLivedObjectCollection::remove(const LongLivedObject* o) {
-  std::scoped_lock lock(collectionMutex_);
-  for (auto p = collection_.begin(); p != collection_.end(); p++) {
-    if (p->get() == o) {
-      collection_.erase(p);
-      break;
+  std::shared_ptr<LongLivedObject> removed;
+  {
+    std::scoped_lock lock(collectionMutex_);
+    if (!contains(o)) {
+      return;
     }
+    // Moves the last object into the slot of the removed one.
+    auto index = o->collectionIndex_;
+    removed = std::move(collection_[index]);
+    if (index != collection_.size() - 1) {
+      collection_[index] = std::move(collection_.back());
+      collection_[index]->collectionIndex_ = index;
+    }
+    collection_.pop_back();
   }
+  // The object may be destroyed here, outside of the lock, in case its
+  // destructor releases other objects.
 }
 
 void LongLivedObjectCollection::clear() {
-  std::scoped_lock lock(collectionMutex_);
-  collection_.clear();
+  std::vector<std::shared_ptr<LongLivedObject>> cleared;
+  {
+    std::scoped_lock lock(collectionMutex_);
+    std::swap(cleared, collection_);
+  }
 }
 
 size_t LongLivedObjectCollection::size() const {
@@ -40,6 +57,11 @@ size_t LongLivedObjectCollection::size() const {
   return collection_.size();
 }
 
+bool LongLivedObjectCollection::contains(const LongLivedObject* o) const {
+  return o->collectionIndex_ < collection_.size() &&
+      collection_[o->collectionIndex_].get() == o;
+}
+
 // LongLivedObject
 
 void LongLivedObject::allowRelease() {
@@ -9,7 +9,7 @@
 
 #include <memory>
 #include <mutex>
-#include <unordered_set>
+#include <vector>
 
 namespace facebook::react {
 
@@ -33,10 +33,20 @@ class LongLivedObject {
  protected:
   LongLivedObject() = default;
   virtual ~LongLivedObject() = default;
+
+ private:
+  friend class LongLivedObjectCollection;
+
+  // The index of this object in the collection it was added to, so that it
+  // can be removed without searching for it. Protected by the mutex of the
+  // collection.
+  size_t collectionIndex_{0};
 };
 
 /**
  * A singleton, thread-safe, write-only collection for the `LongLivedObject`s.
+ * Adding and removing objects takes constant time. An object can be in one
+ * collection at a time.
  */
 class LongLivedObjectCollection {
  public:
@@ -52,7 +62,9 @@ class LongLivedObjectCollection {
   size_t size() const;
 
  private:
-  std::unordered_set<std::shared_ptr<LongLivedObject>> collection_;
+  bool contains(const LongLivedObject* o) const;
+
+  std::vector<std::shared_ptr<LongLivedObject>> collection_;
   mutable std::mutex collectionMutex_;
 };
 
@@ -7,11 +7,13 @@
 
 #pragma once
 
+#include <jsi/PropNameIDCache.h>
 #include <react/bridging/AString.h>
 #include <react/bridging/Base.h>
 
 #include <map>
 #include <unordered_map>
+#include <vector>
 
 namespace facebook::react {
 
@@ -67,16 +69,19 @@ struct Bridging {
       jsi::Runtime& rt,
       const T& map,
       const std::shared_ptr<CallInvoker>& jsInvoker) {
-    auto resultObject = jsi::Object(rt);
+    auto propNameIDCache = jsi::PropNameIDCache::get(rt);
+    std::vector<jsi::PropNameID> names;
+    std::vector<jsi::Value> values;
+    names.reserve(map.size());
+    values.reserve(map.size());
 
     for (const auto& [key, value] : map) {
-      resultObject.setProperty(
-          rt,
-          jsi::PropNameID::forUtf8(rt, key),
-          bridging::toJs(rt, value, jsInvoker));
+      names.push_back(propNameIDCache->forUtf8(rt, key));
+      values.emplace_back(bridging::toJs(rt, value, jsInvoker));
     }
 
-    return resultObject;
+    return jsi::Object::createWithProperties(
+        rt, names.data(), values.data(), names.size());
   }
 };
 
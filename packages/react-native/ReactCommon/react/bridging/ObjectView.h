@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <jsi/PropNameIDCache.h>
+#include <react/bridging/Base.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+/**
+ * A read-only view of a JS object, for module methods taking generic objects
+ * which only read some of their properties. Unlike `folly::dynamic`, which
+ * copies the whole object on every call, properties are read and converted
+ * (with `bridging::fromJs`) when they are accessed.
+ *
+ * The view refers to the JS object, so it can only be used on the JS thread
+ * while the runtime is alive, typically for the duration of the method call.
+ */
+class ObjectView {
+ public:
+  ObjectView(
+      jsi::Runtime& rt,
+      jsi::Object object,
+      std::shared_ptr<CallInvoker> jsInvoker)
+      : rt_(rt), object_(std::move(object)), jsInvoker_(std::move(jsInvoker)) {}
+
+  bool hasProperty(const std::string& name) const {
+    return object_.hasProperty(rt_, propNameID(name));
+  }
+
+  /**
+   * Converts the value of the property to `T`, e.g. `std::string`,
+   * `std::optional<double>` for properties which may be missing, or
+   * `ObjectView` for nested objects.
+   */
+  template <typename T>
+  T getProperty(const std::string& name) const {
+    return bridging::fromJs<T>(
+        rt_, object_.getProperty(rt_, propNameID(name)), jsInvoker_);
+  }
+
+  std::vector<std::string> getPropertyNames() const {
+    auto propertyNames = object_.getPropertyNames(rt_);
+    auto length = propertyNames.length(rt_);
+
+    std::vector<std::string> result;
+    result.reserve(length);
+    for (size_t i = 0; i < length; i++) {
+      result.push_back(
+          propertyNames.getValueAtIndex(rt_, i).asString(rt_).utf8(rt_));
+    }
+    return result;
+  }
+
+  const jsi::Object& getObject() const {
+    return object_;
+  }
+
+ private:
+  jsi::PropNameID propNameID(const std::string& name) const {
+    return jsi::PropNameIDCache::get(rt_)->forUtf8(rt_, name);
+  }
+
+  jsi::Runtime& rt_;
+  jsi::Object object_;
+  std::shared_ptr<CallInvoker> jsInvoker_;
+};
+
+template <>
+struct Bridging<ObjectView> {
+  static ObjectView fromJs(
+      jsi::Runtime& rt,
+      const jsi::Object& value,
+      const std::shared_ptr<CallInvoker>& jsInvoker) {
+    return ObjectView(rt, jsi::Value(rt, value).asObject(rt), jsInvoker);
+  }
+
+  static jsi::Object toJs(jsi::Runtime& rt, const ObjectView& value) {
+    return jsi::Value(rt, value.getObject()).asObject(rt);
+  }
+};
+
+} // namespace facebook::react
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <react/bridging/BatchedCallInvoker.h>
 #include <react/bridging/Error.h>
 #include <react/bridging/Function.h>
 #include <react/bridging/LongLivedObject.h>
@@ -32,7 +33,10 @@ class AsyncPromise {
               state_->resolve = std::move(resolve);
               state_->reject = std::move(reject);
             },
-            jsInvoker));
+            // Promises settled before the JS thread gets to them are settled
+            // by a single task, rather than a task (and microtask checkpoint)
+            // each.
+            BatchedCallInvoker::get(jsInvoker)));
 
     auto promiseHolder = std::make_shared<PromiseHolder>(promise.asObject(rt));
     LongLivedObjectCollection::get().add(promiseHolder);
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/bridging/Base.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * A numeric array that is bridged to and from a JS typed array (e.g.
+ * `Float64Array` for `double`) instead of an array of numbers.
+ * Converting it to JS moves its storage into the `ArrayBuffer` of the typed
+ * array, so large arrays are transferred without copying or converting each
+ * element. Converting from JS copies the contents of a typed array at once,
+ * and still accepts arrays of numbers.
+ */
+template <typename T>
+struct TypedArray {
+  std::vector<T> values;
+};
+
+namespace typed_array_detail {
+
+template <typename T>
+struct TypedArrayTraits;
+
+#define REACT_TYPED_ARRAY_TRAITS(type, constructorName) \
+  template <>                                            \
+  struct TypedArrayTraits<type> {                        \
+    static constexpr auto name = constructorName;        \
+  };
+
+REACT_TYPED_ARRAY_TRAITS(int8_t, "Int8Array")
+REACT_TYPED_ARRAY_TRAITS(uint8_t, "Uint8Array")
+REACT_TYPED_ARRAY_TRAITS(int16_t, "Int16Array")
+REACT_TYPED_ARRAY_TRAITS(uint16_t, "Uint16Array")
+REACT_TYPED_ARRAY_TRAITS(int32_t, "Int32Array")
+REACT_TYPED_ARRAY_TRAITS(uint32_t, "Uint32Array")
+REACT_TYPED_ARRAY_TRAITS(float, "Float32Array")
+REACT_TYPED_ARRAY_TRAITS(double, "Float64Array")
+
+#undef REACT_TYPED_ARRAY_TRAITS
+
+// A jsi::MutableBuffer which owns the storage of a vector.
+template <typename T>
+class VectorBuffer : public jsi::MutableBuffer {
+ public:
+  explicit VectorBuffer(std::vector<T> values) : values_(std::move(values)) {}
+
+  size_t size() const override {
+    return values_.size() * sizeof(T);
+  }
+
+  uint8_t* data() override {
+    return reinterpret_cast<uint8_t*>(values_.data());
+  }
+
+ private:
+  std::vector<T> values_;
+};
+
+} // namespace typed_array_detail
+
+template <typename T>
+struct Bridging<TypedArray<T>> {
+  static TypedArray<T> fromJs(jsi::Runtime& rt, const jsi::Object& value) {
+    if (value.isArray(rt)) {
+      auto array = value.getArray(rt);
+      auto length = array.length(rt);
+      auto result = TypedArray<T>{std::vector<T>(length)};
+      for (size_t i = 0; i < length; i++) {
+        result.values[i] =
+            static_cast<T>(array.getValueAtIndex(rt, i).asNumber());
+      }
+      return result;
+    }
+
+    auto buffer = value.getPropertyAsObject(rt, "buffer").getArrayBuffer(rt);
+    auto byteOffset =
+        static_cast<size_t>(value.getProperty(rt, "byteOffset").asNumber());
+    auto length =
+        static_cast<size_t>(value.getProperty(rt, "length").asNumber());
+    if (byteOffset + length * sizeof(T) > buffer.size(rt)) {
+      throw jsi::JSError(rt, "Typed array is out of the bounds of its buffer");
+    }
+
+    auto result = TypedArray<T>{std::vector<T>(length)};
+    std::memcpy(
+        result.values.data(), buffer.data(rt) + byteOffset, length * sizeof(T));
+    return result;
+  }
+
+  static jsi::Object toJs(jsi::Runtime& rt, TypedArray<T>&& array) {
+    auto buffer = jsi::ArrayBuffer(
+        rt,
+        std::make_shared<typed_array_detail::VectorBuffer<T>>(
+            std::move(array.values)));
+    auto constructorName = typed_array_detail::TypedArrayTraits<T>::name;
+    return rt.global()
+        .getPropertyAsFunction(rt, constructorName)
+        .callAsConstructor(rt, std::move(buffer))
+        .asObject(rt);
+  }
+
+  static jsi::Object toJs(jsi::Runtime& rt, const TypedArray<T>& array) {
+    return toJs(rt, TypedArray<T>{array.values});
+  }
+};
+
+} // namespace facebook::react
@@ -195,6 +195,27 @@ TEST_F(BridgingTest, arrayTest) {
   EXPECT_EQ(headers.size(), jsiHeaders.size(rt));
 }
 
+TEST_F(BridgingTest, typedArrayTest) {
+  auto values = std::vector<double>{1.5, -2, 3.25};
+  auto object = bridging::toJs(rt, TypedArray<double>{values}, invoker);
+  rt.global().setProperty(rt, "typedArray", object);
+  EXPECT_TRUE(eval("typedArray instanceof Float64Array").getBool());
+  EXPECT_TRUE(eval("typedArray.join() == '1.5,-2,3.25'").getBool());
+  EXPECT_EQ(
+      values,
+      bridging::fromJs<TypedArray<double>>(rt, object, invoker).values);
+
+  auto subarray = eval("new Int32Array([1, 2, 3, 4]).subarray(1, 3)");
+  EXPECT_EQ(
+      (std::vector<int32_t>{2, 3}),
+      bridging::fromJs<TypedArray<int32_t>>(rt, subarray, invoker).values);
+
+  auto array = jsi::Array::createWithElements(rt, 1, 2);
+  EXPECT_EQ(
+      (std::vector<float>{1, 2}),
+      bridging::fromJs<TypedArray<float>>(rt, array, invoker).values);
+}
+
 TEST_F(BridgingTest, functionTest) {
   auto object = jsi::Object(rt);
   object.setProperty(rt, "foo", "bar");
@@ -426,6 +447,52 @@ TEST_F(BridgingTest, promiseTest) {
   EXPECT_NO_THROW(promise.reject("ignored"));
 }
 
+TEST_F(BridgingTest, promiseBatchingTest) {
+  auto func = function(
+      "(promise, obj, key) => {"
+      "  promise.then((res) => { obj[key] = obj.count++; })"
+      "}");
+
+  auto first = AsyncPromise<std::string>(rt, invoker);
+  auto second = AsyncPromise<std::string>(rt, invoker);
+  auto output = jsi::Object(rt);
+  output.setProperty(rt, "count", 0);
+
+  func.call(rt, bridging::toJs(rt, first, invoker), output, "first");
+  func.call(rt, bridging::toJs(rt, second, invoker), output, "second");
+  first.resolve("foo");
+  second.resolve("bar");
+
+  // Both promises are settled by a single task, in order.
+  EXPECT_EQ(1, invoker->queue_.size());
+  flushQueue();
+
+  EXPECT_EQ(0, output.getProperty(rt, "first").asNumber());
+  EXPECT_EQ(1, output.getProperty(rt, "second").asNumber());
+}
+
+TEST_F(BridgingTest, objectViewTest) {
+  auto object = eval("({ name: 'foo', size: 2, nested: { enabled: true } })");
+  auto view = bridging::fromJs<ObjectView>(rt, object, invoker);
+
+  EXPECT_TRUE(view.hasProperty("name"));
+  EXPECT_FALSE(view.hasProperty("missing"));
+  EXPECT_EQ("foo"s, view.getProperty<std::string>("name"));
+  EXPECT_EQ(2, view.getProperty<int>("size"));
+  EXPECT_FALSE(view.getProperty<std::optional<int>>("missing"));
+  EXPECT_TRUE(
+      view.getProperty<ObjectView>("nested").getProperty<bool>("enabled"));
+  EXPECT_EQ(
+      (std::vector<std::string>{"name", "size", "nested"}),
+      view.getPropertyNames());
+
+  // The view refers to the object rather than copying it.
+  object.asObject(rt).setProperty(rt, "size", 3);
+  EXPECT_EQ(3, view.getProperty<int>("size"));
+  EXPECT_TRUE(jsi::Object::strictEquals(
+      rt, object.asObject(rt), bridging::toJs(rt, view, invoker)));
+}
+
 TEST_F(BridgingTest, optionalTest) {
   EXPECT_EQ(
       1, bridging::fromJs<std::optional<int>>(rt, jsi::Value(1), invoker));
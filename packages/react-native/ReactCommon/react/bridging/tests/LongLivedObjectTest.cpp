@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/bridging/LongLivedObject.h>
+
+#include <memory>
+#include <vector>
+
+namespace facebook::react {
+
+struct TestLongLivedObject : public LongLivedObject {
+  TestLongLivedObject() = default;
+};
+
+TEST(LongLivedObjectTest, addAndRemove) {
+  auto collection = LongLivedObjectCollection{};
+  auto objects = std::vector<std::shared_ptr<TestLongLivedObject>>{};
+  for (auto i = 0; i < 4; i++) {
+    objects.push_back(std::make_shared<TestLongLivedObject>());
+    collection.add(objects.back());
+  }
+
+  // Adding an object again is a no-op.
+  collection.add(objects[1]);
+  EXPECT_EQ(collection.size(), 4);
+
+  collection.remove(objects[1].get());
+  EXPECT_EQ(collection.size(), 3);
+  EXPECT_EQ(objects[1].use_count(), 1);
+
+  // Removing an object which isn't in the collection is a no-op.
+  collection.remove(objects[1].get());
+  EXPECT_EQ(collection.size(), 3);
+
+  // The object moved into the slot of the removed one can still be removed.
+  collection.remove(objects[3].get());
+  collection.remove(objects[0].get());
+  EXPECT_EQ(collection.size(), 1);
+  EXPECT_EQ(objects[2].use_count(), 2);
+
+  collection.clear();
+  EXPECT_EQ(collection.size(), 0);
+  EXPECT_EQ(objects[2].use_count(), 1);
+}
+
+TEST(LongLivedObjectTest, removeReleasesObject) {
+  auto collection = LongLivedObjectCollection{};
+  auto object = std::make_shared<TestLongLivedObject>();
+  auto weakObject = std::weak_ptr<TestLongLivedObject>(object);
+  collection.add(std::move(object));
+
+  collection.remove(weakObject.lock().get());
+  EXPECT_TRUE(weakObject.expired());
+}
+
+} // namespace facebook::react
@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<82f226df2b3824d03b755a042b20bec5>>
+ * @generated SignedSource<<43cc209bfa5b7d7c802a8326b9e525df>>
  */
 
 /**
@@ -61,6 +61,10 @@ bool ReactNativeFeatureFlags::inspectorEnableModernCDPRegistry() {
   return getAccessor().inspectorEnableModernCDPRegistry();
 }
 
+const ReactNativeFeatureFlagsSnapshot& ReactNativeFeatureFlags::getSnapshot() {
+  return getAccessor().getSnapshot();
+}
+
 void ReactNativeFeatureFlags::override(
     std::unique_ptr<ReactNativeFeatureFlagsProvider> provider) {
   getAccessor().override(std::move(provider));
@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<3bfae310dfd28040f4b80d1a1df8b7b3>>
+ * @generated SignedSource<<720182dbf0e6ed5584a6a953edfb6e20>>
  */
 
 /**
@@ -21,6 +21,7 @@
 
 #include <react/featureflags/ReactNativeFeatureFlagsAccessor.h>
 #include <react/featureflags/ReactNativeFeatureFlagsProvider.h>
+#include <react/featureflags/ReactNativeFeatureFlagsSnapshot.h>
 #include <memory>
 
 namespace facebook::react {
@@ -83,6 +84,16 @@ class ReactNativeFeatureFlags {
    */
   static bool inspectorEnableModernCDPRegistry();
 
+  /**
+   * Returns the values of all the feature flags. They are read from the
+   * provider the first time this is called (which prevents overriding them
+   * afterwards), so reading a flag from the snapshot is a plain load.
+   *
+   * Hot paths should keep the returned reference instead of calling the
+   * methods above. It stays valid until `dangerouslyReset` is called.
+   */
+  static const ReactNativeFeatureFlagsSnapshot& getSnapshot();
+
   /**
    * Overrides the feature flags with the ones provided by the given provider
    * (generally one that extends `ReactNativeFeatureFlagsDefaults`).
@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<2154292f89306f25289583537833a065>>
+ * @generated SignedSource<<c0a690d72c3947f76eeffcea17181eb2>>
  */
 
 /**
@@ -209,6 +209,25 @@ bool ReactNativeFeatureFlagsAccessor::inspectorEnableModernCDPRegistry() {
   return flagValue.value();
 }
 
+const ReactNativeFeatureFlagsSnapshot&
+ReactNativeFeatureFlagsAccessor::getSnapshot() {
+  std::call_once(snapshotOnceFlag_, [this]() {
+    snapshot_ = ReactNativeFeatureFlagsSnapshot{
+        .commonTestFlag = commonTestFlag(),
+        .enableBackgroundExecutor = enableBackgroundExecutor(),
+        .useModernRuntimeScheduler = useModernRuntimeScheduler(),
+        .enableMicrotasks = enableMicrotasks(),
+        .batchRenderingUpdatesInEventLoop = batchRenderingUpdatesInEventLoop(),
+        .enableSpannableBuildingUnification = enableSpannableBuildingUnification(),
+        .enableCustomDrawOrderFabric = enableCustomDrawOrderFabric(),
+        .enableFixForClippedSubviewsCrash = enableFixForClippedSubviewsCrash(),
+        .inspectorEnableCxxInspectorPackagerConnection = inspectorEnableCxxInspectorPackagerConnection(),
+        .inspectorEnableModernCDPRegistry = inspectorEnableModernCDPRegistry(),
+    };
+  });
+  return snapshot_.value();
+}
+
 void ReactNativeFeatureFlagsAccessor::override(
     std::unique_ptr<ReactNativeFeatureFlagsProvider> provider) {
   if (wasOverridden_) {
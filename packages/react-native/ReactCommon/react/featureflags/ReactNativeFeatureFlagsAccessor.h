@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<95487968b66d40e1ec53936b06084931>>
+ * @generated SignedSource<<47f43fee61eb0705ec67f6b7f85d25d4>>
  */
 
 /**
@@ -20,9 +20,11 @@
 #pragma once
 
 #include <react/featureflags/ReactNativeFeatureFlagsProvider.h>
+#include <react/featureflags/ReactNativeFeatureFlagsSnapshot.h>
 #include <array>
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <optional>
 
 namespace facebook::react {
@@ -42,6 +44,8 @@ class ReactNativeFeatureFlagsAccessor {
   bool inspectorEnableCxxInspectorPackagerConnection();
   bool inspectorEnableModernCDPRegistry();
 
+  const ReactNativeFeatureFlagsSnapshot& getSnapshot();
+
   void override(std::unique_ptr<ReactNativeFeatureFlagsProvider> provider);
 
  private:
@@ -63,6 +67,9 @@ class ReactNativeFeatureFlagsAccessor {
   std::atomic<std::optional<bool>> enableFixForClippedSubviewsCrash_;
   std::atomic<std::optional<bool>> inspectorEnableCxxInspectorPackagerConnection_;
   std::atomic<std::optional<bool>> inspectorEnableModernCDPRegistry_;
+
+  std::once_flag snapshotOnceFlag_;
+  std::optional<ReactNativeFeatureFlagsSnapshot> snapshot_;
 };
 
 } // namespace facebook::react
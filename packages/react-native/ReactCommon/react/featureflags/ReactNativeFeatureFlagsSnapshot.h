@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * @generated SignedSource<<3809e24f23535729fa682bff90c173ee>>
+ */
+
+/**
+ * IMPORTANT: Do NOT modify this file directly.
+ *
+ * To change the definition of the flags, edit
+ *   packages/react-native/scripts/featureflags/ReactNativeFeatureFlags.config.js.
+ *
+ * To regenerate this code, run the following script from the repo root:
+ *   yarn featureflags-update
+ */
+
+#pragma once
+
+namespace facebook::react {
+
+/**
+ * The values of all the feature flags, as returned by
+ * `ReactNativeFeatureFlags::getSnapshot`.
+ */
+struct ReactNativeFeatureFlagsSnapshot {
+  bool commonTestFlag;
+  bool enableBackgroundExecutor;
+  bool useModernRuntimeScheduler;
+  bool enableMicrotasks;
+  bool batchRenderingUpdatesInEventLoop;
+  bool enableSpannableBuildingUnification;
+  bool enableCustomDrawOrderFabric;
+  bool enableFixForClippedSubviewsCrash;
+  bool inspectorEnableCxxInspectorPackagerConnection;
+  bool inspectorEnableModernCDPRegistry;
+};
+
+} // namespace facebook::react
@@ -94,6 +94,29 @@ TEST_F(ReactNativeFeatureFlagsTest, cachesValuesFromOverride) {
   EXPECT_EQ(overrideAccessCount, 1);
 }
 
+TEST_F(ReactNativeFeatureFlagsTest, providesSnapshotOfOverriddenValues) {
+  ReactNativeFeatureFlags::override(
+      std::make_unique<ReactNativeFeatureFlagsTestOverrides>());
+
+  const auto& snapshot = ReactNativeFeatureFlags::getSnapshot();
+  EXPECT_EQ(snapshot.commonTestFlag, true);
+  EXPECT_EQ(overrideAccessCount, 1);
+
+  EXPECT_EQ(&ReactNativeFeatureFlags::getSnapshot(), &snapshot);
+  EXPECT_EQ(ReactNativeFeatureFlags::commonTestFlag(), true);
+  EXPECT_EQ(overrideAccessCount, 1);
+}
+
+TEST_F(ReactNativeFeatureFlagsTest, preventsOverridingAfterSnapshot) {
+  EXPECT_EQ(ReactNativeFeatureFlags::getSnapshot().commonTestFlag, false);
+
+  EXPECT_THROW(
+      ReactNativeFeatureFlags::override(
+          std::make_unique<ReactNativeFeatureFlagsTestOverrides>()),
+      std::runtime_error);
+  EXPECT_EQ(ReactNativeFeatureFlags::getSnapshot().commonTestFlag, false);
+}
+
 TEST_F(
     ReactNativeFeatureFlagsTest,
     providesDefaulValuesAgainWhenResettingAfterAnOverride) {
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "BatchedCallInvoker.h"
+
+#include <unordered_map>
+
+namespace facebook::react {
+
+std::shared_ptr<BatchedCallInvoker> BatchedCallInvoker::forCallInvoker(
+    const std::shared_ptr<CallInvoker>& callInvoker) {
+  static std::mutex mutex;
+  static std::unordered_map<
+      const CallInvoker*,
+      std::weak_ptr<BatchedCallInvoker>>
+      batchedCallInvokers;
+
+  std::scoped_lock lock(mutex);
+  auto it = batchedCallInvokers.find(callInvoker.get());
+  if (it != batchedCallInvokers.end()) {
+    if (auto batchedCallInvoker = it->second.lock()) {
+      return batchedCallInvoker;
+    }
+  }
+
+  // Drops the entries of CallInvokers which aren't used anymore.
+  std::erase_if(batchedCallInvokers, [](const auto& entry) {
+    return entry.second.expired();
+  });
+
+  auto batchedCallInvoker = std::make_shared<BatchedCallInvoker>(callInvoker);
+  batchedCallInvokers[callInvoker.get()] = batchedCallInvoker;
+  return batchedCallInvoker;
+}
+
+BatchedCallInvoker::BatchedCallInvoker(std::shared_ptr<CallInvoker> callInvoker)
+    : callInvoker_(std::move(callInvoker)) {}
+
+void BatchedCallInvoker::invokeAsync(CallFunc&& func) noexcept {
+  {
+    std::scoped_lock lock(mutex_);
+    pendingCalls_.push_back(std::move(func));
+    if (isFlushScheduled_) {
+      return;
+    }
+    isFlushScheduled_ = true;
+  }
+
+  callInvoker_->invokeAsync([self = shared_from_this()]() { self->flush(); });
+}
+
+void BatchedCallInvoker::invokeSync(CallFunc&& func) {
+  callInvoker_->invokeSync(std::move(func));
+}
+
+void BatchedCallInvoker::flush() {
+  std::vector<CallFunc> pendingCalls;
+  {
+    std::scoped_lock lock(mutex_);
+    std::swap(pendingCalls, pendingCalls_);
+    isFlushScheduled_ = false;
+  }
+
+  for (auto& call : pendingCalls) {
+    call();
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <ReactCommon/CallInvoker.h>
+
+namespace facebook::react {
+
+/**
+ * A CallInvoker which coalesces the calls it gets until JS runs them into a
+ * single call of the CallInvoker it wraps. This is meant for native work
+ * completing on many threads at once (e.g. promise resolutions), which would
+ * otherwise schedule one task on the JS thread per completion.
+ */
+class BatchedCallInvoker
+    : public CallInvoker,
+      public std::enable_shared_from_this<BatchedCallInvoker> {
+ public:
+  /**
+   * Returns the BatchedCallInvoker wrapping the given CallInvoker, so that
+   * calls from all the users of a JS thread are coalesced together.
+   */
+  static std::shared_ptr<BatchedCallInvoker> forCallInvoker(
+      const std::shared_ptr<CallInvoker>& callInvoker);
+
+  explicit BatchedCallInvoker(std::shared_ptr<CallInvoker> callInvoker);
+
+  void invokeAsync(CallFunc&& func) noexcept override;
+  void invokeSync(CallFunc&& func) override;
+
+ private:
+  void flush();
+
+  std::shared_ptr<CallInvoker> callInvoker_;
+  std::mutex mutex_;
+  std::vector<CallFunc> pendingCalls_; // Protected by `mutex_`.
+  bool isFlushScheduled_{false}; // Protected by `mutex_`.
+};
+
+} // namespace facebook::react
@@ -55,12 +55,16 @@ class JSI_EXPORT TurboModule : public facebook::jsi::HostObject {
       const facebook::jsi::PropNameID& propName) override {
     {
       auto prop = create(runtime, propName);
-      // If we have a JS wrapper, cache the result of this lookup
+      // If we have a JS wrapper, cache the result of this lookup, so that
+      // later lookups of the property don't reach the HostObject anymore.
       // We don't cache misses, to allow for methodMap_ to dynamically be
       // extended
       if (jsRepresentation_ && !prop.isUndefined()) {
-        jsRepresentation_->lock(runtime).asObject(runtime).setProperty(
-            runtime, propName, prop);
+        auto jsRepresentation = jsRepresentation_->lock(runtime);
+        if (!jsRepresentation.isUndefined()) {
+          jsRepresentation.asObject(runtime).setProperty(
+              runtime, propName, prop);
+        }
       }
       return prop;
     }
@@ -154,10 +154,17 @@ jsi::Value TurboModuleBinding::getModule(
     jsi::Runtime& runtime,
     const std::string& moduleName) const {
   std::shared_ptr<TurboModule> module;
-  {
+  if (auto cachedModule = moduleCache_.find(moduleName);
+      cachedModule != moduleCache_.end()) {
+    module = cachedModule->second.lock();
+  }
+  if (!module) {
     SystraceSection s(
         "TurboModuleBinding::moduleProvider", "module", moduleName);
     module = moduleProvider_(moduleName);
+    if (module) {
+      moduleCache_[moduleName] = module;
+    }
   }
   if (module) {
     // What is jsRepresentation? A cache for the TurboModule's properties
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
 
 #include <ReactCommon/LongLivedObject.h>
 #include <ReactCommon/TurboModule.h>
@@ -51,6 +52,14 @@ class TurboModuleBinding {
 
   TurboModuleProviderFunctionType moduleProvider_;
   std::shared_ptr<LongLivedObjectCollection> longLivedObjectCollection_;
+
+  /*
+   * Modules returned by `moduleProvider_`, so that looking the same module up
+   * again doesn't go through the provider. Weak, because modules are owned
+   * (and cached) by the TurboModuleManager.
+   */
+  mutable std::unordered_map<std::string, std::weak_ptr<TurboModule>>
+      moduleCache_;
 };
 
 } // namespace facebook::react
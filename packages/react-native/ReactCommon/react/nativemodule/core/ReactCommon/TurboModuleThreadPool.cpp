@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TurboModuleThreadPool.h"
+
+#include <algorithm>
+
+namespace facebook::react {
+
+namespace {
+
+// The pool and index of the worker running on the current thread, if any.
+thread_local const TurboModuleThreadPool* currentPool = nullptr;
+thread_local size_t currentWorkerIndex = 0;
+
+} // namespace
+
+TurboModuleThreadPool& TurboModuleThreadPool::shared() {
+  // Intentionally leaked, so that its threads are never joined while the
+  // process is exiting.
+  static auto pool = new TurboModuleThreadPool(
+      std::max(2u, std::thread::hardware_concurrency()));
+  return *pool;
+}
+
+TurboModuleThreadPool::TurboModuleThreadPool(size_t threadCount) {
+  for (size_t i = 0; i < threadCount; i++) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  for (size_t i = 0; i < threadCount; i++) {
+    threads_.emplace_back([this, i]() { loop(i); });
+  }
+}
+
+TurboModuleThreadPool::~TurboModuleThreadPool() {
+  {
+    std::scoped_lock lock(mutex_);
+    isStopped_ = true;
+  }
+  condition_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+void TurboModuleThreadPool::run(Task&& task) {
+  auto workerIndex = currentPool == this
+      ? currentWorkerIndex
+      : nextWorkerIndex_++ % workers_.size();
+  {
+    auto& worker = *workers_[workerIndex];
+    std::scoped_lock lock(worker.mutex);
+    worker.tasks.push_back(std::move(task));
+  }
+  {
+    std::scoped_lock lock(mutex_);
+    pendingTaskCount_++;
+  }
+  condition_.notify_one();
+}
+
+void TurboModuleThreadPool::loop(size_t workerIndex) {
+  currentPool = this;
+  currentWorkerIndex = workerIndex;
+
+  while (true) {
+    {
+      std::unique_lock lock(mutex_);
+      condition_.wait(
+          lock, [this]() { return isStopped_ || pendingTaskCount_ > 0; });
+      if (pendingTaskCount_ == 0) {
+        // The pool is stopped and all of its tasks ran.
+        return;
+      }
+      // Claims one of the pending tasks, which is then guaranteed to be in
+      // one of the queues until this thread takes it.
+      pendingTaskCount_--;
+    }
+
+    auto task = takeTask(workerIndex);
+    while (!task) {
+      // The claimed task was pushed while the queues were being searched.
+      std::this_thread::yield();
+      task = takeTask(workerIndex);
+    }
+    (*task)();
+  }
+}
+
+std::optional<TurboModuleThreadPool::Task> TurboModuleThreadPool::takeTask(
+    size_t workerIndex) {
+  // Takes the most recent task of its own queue, which is the most likely to
+  // be cache-hot, or the oldest task of the queue of another worker.
+  for (size_t i = 0; i < workers_.size(); i++) {
+    auto& worker = *workers_[(workerIndex + i) % workers_.size()];
+    std::scoped_lock lock(worker.mutex);
+    if (worker.tasks.empty()) {
+      continue;
+    }
+    auto task = std::optional<Task>{};
+    if (i == 0) {
+      task = std::move(worker.tasks.back());
+      worker.tasks.pop_back();
+    } else {
+      task = std::move(worker.tasks.front());
+      worker.tasks.pop_front();
+    }
+    return task;
+  }
+  return std::nullopt;
+}
+
+} // namespace facebook::react
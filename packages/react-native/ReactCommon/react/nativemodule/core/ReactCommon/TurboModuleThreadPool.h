@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include <ReactCommon/BatchedCallInvoker.h>
+#include <ReactCommon/CallInvoker.h>
+#include <jsi/jsi.h>
+#include <react/bridging/Bridging.h>
+
+namespace facebook::react {
+
+/**
+ * A pool of threads shared by C++ TurboModules to run their async methods,
+ * so that each module doesn't need to create its own executor.
+ * Every thread has its own queue of tasks, and threads which run out of tasks
+ * steal them from the queues of the others. Tasks run by the pool schedule
+ * further tasks on their own thread's queue.
+ */
+class TurboModuleThreadPool {
+ public:
+  using Task = std::function<void()>;
+
+  /**
+   * Returns the pool shared by all TurboModules, with one thread per core.
+   */
+  static TurboModuleThreadPool& shared();
+
+  explicit TurboModuleThreadPool(size_t threadCount);
+  ~TurboModuleThreadPool();
+
+  TurboModuleThreadPool(const TurboModuleThreadPool&) = delete;
+  TurboModuleThreadPool& operator=(const TurboModuleThreadPool&) = delete;
+
+  /**
+   * Schedules the task to run on one of the threads of the pool.
+   */
+  void run(Task&& task);
+
+ private:
+  struct Worker {
+    std::mutex mutex;
+    std::deque<Task> tasks; // Protected by `mutex`.
+  };
+
+  void loop(size_t workerIndex);
+  std::optional<Task> takeTask(size_t workerIndex);
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::vector<std::thread> threads_;
+  std::atomic<size_t> nextWorkerIndex_{0};
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  size_t pendingTaskCount_{0}; // Protected by `mutex_`.
+  bool isStopped_{false}; // Protected by `mutex_`.
+};
+
+/**
+ * Runs `work` on the shared TurboModuleThreadPool and returns a promise which
+ * resolves with its result, or rejects if it throws. Results of work
+ * completing while JS is busy are delivered to JS in a single CallInvoker
+ * call. `T` can be any type which can be bridged to JS.
+ */
+template <typename T>
+jsi::Object runAsyncOnTurboModuleThreadPool(
+    jsi::Runtime& rt,
+    const std::shared_ptr<CallInvoker>& jsInvoker,
+    std::function<T()>&& work) {
+  auto promise = AsyncPromise<T>(
+      rt,
+      std::static_pointer_cast<CallInvoker>(
+          BatchedCallInvoker::forCallInvoker(jsInvoker)));
+  auto result = promise.get(rt);
+
+  TurboModuleThreadPool::shared().run(
+      [promise = std::move(promise), work = std::move(work)]() mutable {
+        try {
+          promise.resolve(work());
+        } catch (const std::exception& e) {
+          promise.reject(Error(e.what()));
+        } catch (...) {
+          promise.reject(Error("Unknown error in TurboModule async method"));
+        }
+      });
+
+  return result;
+}
+
+} // namespace facebook::react
@@ -7,6 +7,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <cxxreact/SystraceSection.h>
 #include <fbjni/fbjni.h>
@@ -29,6 +30,58 @@ namespace facebook::react {
 
 namespace TMPL = TurboModulePerfLogger;
 
+namespace {
+
+/**
+ * The Java types which JS values can be converted to as method arguments.
+ */
+enum class JavaArgKind {
+  Double,
+  Float,
+  Int,
+  Boolean,
+  BoxedDouble,
+  BoxedFloat,
+  BoxedInteger,
+  BoxedBoolean,
+  String,
+  Callback,
+  ReadableArray,
+  ReadableMap,
+  Unsupported,
+};
+
+JavaArgKind getJavaArgKind(const std::string& type) {
+  static const std::unordered_map<std::string, JavaArgKind> kinds = {
+      {"D", JavaArgKind::Double},
+      {"F", JavaArgKind::Float},
+      {"I", JavaArgKind::Int},
+      {"Z", JavaArgKind::Boolean},
+      {"Ljava/lang/Double;", JavaArgKind::BoxedDouble},
+      {"Ljava/lang/Float;", JavaArgKind::BoxedFloat},
+      {"Ljava/lang/Integer;", JavaArgKind::BoxedInteger},
+      {"Ljava/lang/Boolean;", JavaArgKind::BoxedBoolean},
+      {"Ljava/lang/String;", JavaArgKind::String},
+      {"Lcom/facebook/react/bridge/Callback;", JavaArgKind::Callback},
+      {"Lcom/facebook/react/bridge/ReadableArray;", JavaArgKind::ReadableArray},
+      {"Lcom/facebook/react/bridge/ReadableMap;", JavaArgKind::ReadableMap},
+  };
+  auto it = kinds.find(type);
+  return it != kinds.end() ? it->second : JavaArgKind::Unsupported;
+}
+
+} // namespace
+
+/**
+ * Everything invokeJavaMethod needs to know about a method which can be
+ * derived from its signature.
+ */
+struct JavaMethodDispatchRecord {
+  std::vector<std::string> argTypes;
+  std::vector<JavaArgKind> argKinds;
+  std::string returnType;
+};
+
 JavaTurboModule::JavaTurboModule(const InitParams& params)
     : TurboModule(params.moduleName, params.jsInvoker),
       instance_(jni::make_global(params.instance)),
@@ -245,11 +298,12 @@ JNIArgs convertJSIArgsToJNIArgs(
     JNIEnv* env,
     jsi::Runtime& rt,
     const std::string& methodName,
-    const std::vector<std::string>& methodArgTypes,
+    const JavaMethodDispatchRecord& record,
     const jsi::Value* args,
     size_t count,
     const std::shared_ptr<CallInvoker>& jsInvoker,
     TurboModuleMethodValueKind valueKind) {
+  const auto& methodArgTypes = record.argTypes;
   size_t expectedArgumentCount = valueKind == PromiseKind
       ? methodArgTypes.size() - 1
       : methodArgTypes.size();
@@ -279,11 +333,12 @@ JNIArgs convertJSIArgsToJNIArgs(
 
   for (unsigned int argIndex = 0; argIndex < count; argIndex += 1) {
     const std::string& type = methodArgTypes.at(argIndex);
+    JavaArgKind kind = record.argKinds.at(argIndex);
 
     const jsi::Value* arg = &args[argIndex];
     jvalue* jarg = &jargs[argIndex];
 
-    if (type == "D") {
+    if (kind == JavaArgKind::Double) {
       if (!arg->isNumber()) {
         throw JavaTurboModuleArgumentConversionException(
             "number", argIndex, methodName, arg, &rt);
@@ -292,7 +347,7 @@ JNIArgs convertJSIArgsToJNIArgs(
       continue;
     }
 
-    if (type == "F") {
+    if (kind == JavaArgKind::Float) {
       if (!arg->isNumber()) {
         throw JavaTurboModuleArgumentConversionException(
             "number", argIndex, methodName, arg, &rt);
@@ -301,7 +356,7 @@ JNIArgs convertJSIArgsToJNIArgs(
       continue;
     }
 
-    if (type == "I") {
+    if (kind == JavaArgKind::Int) {
       if (!arg->isNumber()) {
         throw JavaTurboModuleArgumentConversionException(
             "number", argIndex, methodName, arg, &rt);
@@ -310,7 +365,7 @@ JNIArgs convertJSIArgsToJNIArgs(
       continue;
     }
 
-    if (type == "Z") {
+    if (kind == JavaArgKind::Boolean) {
       if (!arg->isBool()) {
         throw JavaTurboModuleArgumentConversionException(
             "boolean", argIndex, methodName, arg, &rt);
@@ -321,42 +376,42 @@ JNIArgs convertJSIArgsToJNIArgs(
 
     if (arg->isNull() || arg->isUndefined()) {
       jarg->l = nullptr;
-    } else if (type == "Ljava/lang/Double;") {
+    } else if (kind == JavaArgKind::BoxedDouble) {
       if (!arg->isNumber()) {
         throw JavaTurboModuleArgumentConversionException(
             "number", argIndex, methodName, arg, &rt);
       }
       jarg->l = makeGlobalIfNecessary(
           jni::JDouble::valueOf(arg->getNumber()).release());
-    } else if (type == "Ljava/lang/Float;") {
+    } else if (kind == JavaArgKind::BoxedFloat) {
       if (!arg->isNumber()) {
         throw JavaTurboModuleArgumentConversionException(
             "number", argIndex, methodName, arg, &rt);
       }
       jarg->l = makeGlobalIfNecessary(
           jni::JFloat::valueOf(arg->getNumber()).release());
-    } else if (type == "Ljava/lang/Integer;") {
+    } else if (kind == JavaArgKind::BoxedInteger) {
       if (!arg->isNumber()) {
         throw JavaTurboModuleArgumentConversionException(
             "number", argIndex, methodName, arg, &rt);
       }
       jarg->l = makeGlobalIfNecessary(
           jni::JInteger::valueOf(arg->getNumber()).release());
-    } else if (type == "Ljava/lang/Boolean;") {
+    } else if (kind == JavaArgKind::BoxedBoolean) {
       if (!arg->isBool()) {
         throw JavaTurboModuleArgumentConversionException(
             "boolean", argIndex, methodName, arg, &rt);
       }
       jarg->l = makeGlobalIfNecessary(
           jni::JBoolean::valueOf(arg->getBool()).release());
-    } else if (type == "Ljava/lang/String;") {
+    } else if (kind == JavaArgKind::String) {
       if (!arg->isString()) {
         throw JavaTurboModuleArgumentConversionException(
             "string", argIndex, methodName, arg, &rt);
       }
       jarg->l = makeGlobalIfNecessary(
           env->NewStringUTF(arg->getString(rt).utf8(rt).c_str()));
-    } else if (type == "Lcom/facebook/react/bridge/Callback;") {
+    } else if (kind == JavaArgKind::Callback) {
       if (!(arg->isObject() && arg->getObject(rt).isFunction(rt))) {
         throw JavaTurboModuleArgumentConversionException(
             "Function", argIndex, methodName, arg, &rt);
@@ -364,7 +419,7 @@ JNIArgs convertJSIArgsToJNIArgs(
       jsi::Function fn = arg->getObject(rt).getFunction(rt);
       jarg->l = makeGlobalIfNecessary(
           createJavaCallback(rt, std::move(fn), jsInvoker).release());
-    } else if (type == "Lcom/facebook/react/bridge/ReadableArray;") {
+    } else if (kind == JavaArgKind::ReadableArray) {
       if (!(arg->isObject() && arg->getObject(rt).isArray(rt))) {
         throw JavaTurboModuleArgumentConversionException(
             "Array", argIndex, methodName, arg, &rt);
@@ -373,7 +428,7 @@ JNIArgs convertJSIArgsToJNIArgs(
       auto jParams =
           ReadableNativeArray::newObjectCxxArgs(std::move(dynamicFromValue));
       jarg->l = makeGlobalIfNecessary(jParams.release());
-    } else if (type == "Lcom/facebook/react/bridge/ReadableMap;") {
+    } else if (kind == JavaArgKind::ReadableMap) {
       if (!(arg->isObject())) {
         throw JavaTurboModuleArgumentConversionException(
             "Object", argIndex, methodName, arg, &rt);
@@ -569,14 +624,22 @@ jsi::Value JavaTurboModule::invokeJavaMethod(
     return returnValue;
   }
 
-  std::vector<std::string> methodArgTypes =
-      getMethodArgTypesFromSignature(methodSignature);
+  auto& record = methodDispatchRecords_[methodID];
+  if (!record) {
+    record = std::make_unique<JavaMethodDispatchRecord>();
+    record->argTypes = getMethodArgTypesFromSignature(methodSignature);
+    for (const auto& type : record->argTypes) {
+      record->argKinds.push_back(getJavaArgKind(type));
+    }
+    record->returnType =
+        methodSignature.substr(methodSignature.find_last_of(')') + 1);
+  }
 
   JNIArgs jniArgs = convertJSIArgsToJNIArgs(
       env,
       runtime,
       methodNameStr,
-      methodArgTypes,
+      *record,
       args,
       argCount,
       jsInvoker_,
@@ -592,8 +655,7 @@ jsi::Value JavaTurboModule::invokeJavaMethod(
 
   switch (valueKind) {
     case BooleanKind: {
-      std::string returnType =
-          methodSignature.substr(methodSignature.find_last_of(')') + 1);
+      const std::string& returnType = record->returnType;
       if (returnType == "Ljava/lang/Boolean;") {
         auto returnObject =
             env->CallObjectMethodA(instance, methodID, jargs.data());
@@ -629,8 +691,7 @@ jsi::Value JavaTurboModule::invokeJavaMethod(
       }
     }
     case NumberKind: {
-      std::string returnType =
-          methodSignature.substr(methodSignature.find_last_of(')') + 1);
+      const std::string& returnType = record->returnType;
       if (returnType == "Ljava/lang/Double;" ||
           returnType == "Ljava/lang/Float;" ||
           returnType == "Ljava/lang/Integer;") {
@@ -7,7 +7,9 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
+#include <unordered_map>
 
 #include <ReactCommon/CallInvoker.h>
 #include <ReactCommon/TurboModule.h>
@@ -17,6 +19,8 @@
 
 namespace facebook::react {
 
+struct JavaMethodDispatchRecord;
+
 struct JTurboModule : jni::JavaClass<JTurboModule> {
   static auto constexpr kJavaDescriptor =
       "Lcom/facebook/react/internal/turbomodule/core/interfaces/TurboModule;";
@@ -50,6 +54,14 @@ class JSI_EXPORT JavaTurboModule : public TurboModule {
   jni::global_ref<jobject> instance_;
   std::shared_ptr<NativeMethodCallInvoker> nativeMethodCallInvoker_;
   bool shouldVoidMethodsExecuteSync_;
+
+  /**
+   * Dispatch records of the methods of this module, keyed by method ID. The
+   * record of a method is built on its first invocation, so that subsequent
+   * invocations don't parse its signature again.
+   */
+  std::unordered_map<jmethodID, std::unique_ptr<JavaMethodDispatchRecord>>
+      methodDispatchRecords_;
 };
 
 } // namespace facebook::react
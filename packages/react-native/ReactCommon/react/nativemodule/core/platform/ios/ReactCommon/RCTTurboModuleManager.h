@@ -74,6 +74,13 @@
 
 - (void)installJSBindings:(facebook::jsi::Runtime &)runtime;
 
+/**
+ * Create the given modules (e.g. the modules required during startup) on background threads, so that they are
+ * ready when JS first requires them. Modules which require main queue setup are skipped, and are created when
+ * they are first required.
+ */
+- (void)prepareModulesWithNames:(NSArray<NSString *> *)moduleNames;
+
 - (void)invalidate;
 
 @property (nonatomic, weak, readwrite) id<RCTTurboModuleManagerRuntimeHandler> runtimeHandler;
@@ -985,6 +985,30 @@ static Class getFallbackClassFromName(const char *name)
   return _moduleHolders.find(moduleName) != _moduleHolders.end();
 }
 
+- (void)prepareModulesWithNames:(NSArray<NSString *> *)moduleNames
+{
+  // Module creation is thread-safe: a module which is being created on a background thread when it is required
+  // is waited for, see _provideObjCModule.
+  dispatch_queue_t queue = dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0);
+  __weak __typeof(self) weakSelf = self;
+  for (NSString *moduleName in [moduleNames copy]) {
+    dispatch_async(queue, ^{
+      __strong __typeof(self) strongSelf = weakSelf;
+      if (!strongSelf || strongSelf->_invalidating) {
+        return;
+      }
+
+      const char *name = moduleName.UTF8String;
+      Class moduleClass = [strongSelf _getModuleClassFromName:name];
+      if (!moduleClass || [strongSelf _requiresMainQueueSetup:moduleClass]) {
+        return;
+      }
+
+      [strongSelf moduleForName:name warnOnLookupFailure:NO];
+    });
+  }
+}
+
 #pragma mark Invalidation logic
 
 - (void)bridgeWillInvalidateModules:(NSNotification *)notification
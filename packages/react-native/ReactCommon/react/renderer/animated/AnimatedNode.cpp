@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "AnimatedNode.h"
+
+#include <react/renderer/animated/NativeAnimatedNodesManager.h>
+
+namespace facebook::react {
+
+AnimatedNode::AnimatedNode(Tag tag, NativeAnimatedNodesManager& manager)
+    : tag_(tag), manager_(manager) {}
+
+Tag AnimatedNode::getTag() const {
+  return tag_;
+}
+
+const std::vector<Tag>& AnimatedNode::getChildren() const {
+  return children_;
+}
+
+const std::vector<Tag>& AnimatedNode::getParents() const {
+  return parents_;
+}
+
+void AnimatedNode::setNeedsUpdate() {
+  manager_.setNodeNeedsUpdate(tag_);
+}
+
+ValueAnimatedNode::ValueAnimatedNode(
+    Tag tag,
+    const folly::dynamic& config,
+    NativeAnimatedNodesManager& manager)
+    : AnimatedNode(tag, manager),
+      value_(config.getDefault("value", 0.0).asDouble()),
+      offset_(config.getDefault("offset", 0.0).asDouble()) {}
+
+double ValueAnimatedNode::getValue() const {
+  return value_ + offset_;
+}
+
+void ValueAnimatedNode::setValue(double value) {
+  value_ = value;
+}
+
+void ValueAnimatedNode::setOffset(double offset) {
+  offset_ = offset;
+}
+
+void ValueAnimatedNode::flattenOffset() {
+  value_ += offset_;
+  offset_ = 0;
+}
+
+void ValueAnimatedNode::extractOffset() {
+  offset_ += value_;
+  value_ = 0;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <folly/dynamic.h>
+#include <react/renderer/core/ReactPrimitives.h>
+
+#include <vector>
+
+namespace facebook::react {
+
+class NativeAnimatedNodesManager;
+
+/*
+ * A node of the native animated graph, created from the config that
+ * `Animated` serializes in JS.
+ * Nodes are owned by a `NativeAnimatedNodesManager` and refer to each other by
+ * tag, so a node never keeps a dropped node alive. All methods must be called
+ * on the thread the manager is used on.
+ */
+class AnimatedNode {
+ public:
+  AnimatedNode(Tag tag, NativeAnimatedNodesManager& manager);
+  virtual ~AnimatedNode() = default;
+
+  AnimatedNode(const AnimatedNode&) = delete;
+  AnimatedNode& operator=(const AnimatedNode&) = delete;
+
+  Tag getTag() const;
+
+  const std::vector<Tag>& getChildren() const;
+  const std::vector<Tag>& getParents() const;
+
+  /*
+   * Recomputes the output of the node. Parents of the node are always updated
+   * before it.
+   */
+  virtual void update() {}
+
+  /*
+   * Marks the node and (transitively) its children to be updated on the next
+   * pass of the manager.
+   */
+  void setNeedsUpdate();
+
+ protected:
+  const Tag tag_;
+  NativeAnimatedNodesManager& manager_;
+
+ private:
+  friend class NativeAnimatedNodesManager;
+
+  std::vector<Tag> children_;
+  std::vector<Tag> parents_;
+
+  // Maintained by the manager.
+  size_t updateOrder_{0};
+  bool needsUpdate_{false};
+};
+
+/*
+ * A node which outputs a number, e.g. `Animated.Value` or a node computed from
+ * other numeric nodes.
+ */
+class ValueAnimatedNode : public AnimatedNode {
+ public:
+  ValueAnimatedNode(
+      Tag tag,
+      const folly::dynamic& config,
+      NativeAnimatedNodesManager& manager);
+
+  /*
+   * Returns the value with the offset applied, which is what the node outputs.
+   */
+  double getValue() const;
+
+  void setValue(double value);
+  void setOffset(double offset);
+
+  /*
+   * Merges the offset into the value and resets the offset to zero.
+   */
+  void flattenOffset();
+
+  /*
+   * Moves the value into the offset and resets the value to zero.
+   */
+  void extractOffset();
+
+ private:
+  double value_{0};
+  double offset_{0};
+};
+
+} // namespace facebook::react
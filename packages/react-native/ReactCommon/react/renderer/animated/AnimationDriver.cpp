@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "AnimationDriver.h"
+
+#include <react/renderer/animated/NativeAnimatedNodesManager.h>
+#include <react/renderer/animated/ValueAnimatedNodes.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace facebook::react {
+
+// Frames of `Animated.timing` are sampled in JS at 60 frames per second.
+static constexpr double kSingleFrameInterval = 1.0 / 60.0;
+
+// Springs advance by at most this much per frame, so that a long frame drop
+// doesn't make the simulation jump.
+static constexpr double kMaxSpringDeltaTime = 0.064;
+
+AnimationDriver::AnimationDriver(
+    int animationId,
+    Tag animatedValueTag,
+    AnimationEndCallback endCallback,
+    NativeAnimatedNodesManager& manager)
+    : id_(animationId),
+      animatedValueTag_(animatedValueTag),
+      endCallback_(std::move(endCallback)),
+      manager_(manager) {}
+
+int AnimationDriver::getId() const {
+  return id_;
+}
+
+Tag AnimationDriver::getAnimatedValueTag() const {
+  return animatedValueTag_;
+}
+
+bool AnimationDriver::hasFinished() const {
+  return hasFinished_;
+}
+
+void AnimationDriver::runAnimationStep(double time) {
+  if (hasFinished_) {
+    return;
+  }
+  if (!getAnimatedValue()) {
+    // The animated node was dropped, so there is nothing left to animate.
+    hasFinished_ = true;
+    return;
+  }
+  step(time);
+}
+
+void AnimationDriver::stop() {
+  if (endCallback_) {
+    auto endCallback = std::move(endCallback_);
+    endCallback_ = nullptr;
+    endCallback(hasFinished_, getAnimatedValue().value_or(0));
+  }
+}
+
+std::optional<double> AnimationDriver::getAnimatedValue() const {
+  auto node = manager_.getNodeAs<ValueAnimatedNode>(animatedValueTag_);
+  if (node == nullptr) {
+    return std::nullopt;
+  }
+  return node->getValue();
+}
+
+void AnimationDriver::setAnimatedValue(double value) {
+  auto node = manager_.getNodeAs<ValueAnimatedNode>(animatedValueTag_);
+  if (node != nullptr) {
+    node->setValue(value);
+    node->setNeedsUpdate();
+  }
+}
+
+int AnimationDriver::iterationsFromConfig(const folly::dynamic& config) {
+  return static_cast<int>(config.getDefault("iterations", 1).asInt());
+}
+
+#pragma mark - FrameAnimationDriver
+
+FrameAnimationDriver::FrameAnimationDriver(
+    int animationId,
+    Tag animatedValueTag,
+    const folly::dynamic& config,
+    AnimationEndCallback endCallback,
+    NativeAnimatedNodesManager& manager)
+    : AnimationDriver(
+          animationId,
+          animatedValueTag,
+          std::move(endCallback),
+          manager) {
+  resetConfig(config);
+}
+
+void FrameAnimationDriver::resetConfig(const folly::dynamic& config) {
+  frames_.clear();
+  const auto& frames = config.getDefault("frames", folly::dynamic::array());
+  for (const auto& frame : frames) {
+    frames_.push_back(frame.asDouble());
+  }
+  fromValue_ = getAnimatedValue().value_or(0);
+  toValue_ = config.getDefault("toValue", 0.0).asDouble();
+  iterations_ = iterationsFromConfig(config);
+  currentLoop_ = 1;
+  startTime_ = -1;
+  hasFinished_ = iterations_ == 0;
+}
+
+void FrameAnimationDriver::step(double time) {
+  if (frames_.empty()) {
+    hasFinished_ = true;
+    return;
+  }
+
+  if (startTime_ < 0) {
+    startTime_ = time;
+  }
+
+  auto duration = time - startTime_;
+  auto startIndex = static_cast<size_t>(
+      std::max(0.0, std::floor(duration / kSingleFrameInterval)));
+  auto nextIndex = startIndex + 1;
+
+  if (nextIndex >= frames_.size()) {
+    if (iterations_ == -1 || currentLoop_ < iterations_) {
+      // Starts the next iteration from the first frame.
+      startTime_ = time;
+      currentLoop_++;
+      setFrameOutput(frames_.front());
+    } else {
+      hasFinished_ = true;
+      setFrameOutput(frames_.back());
+    }
+    return;
+  }
+
+  // Interpolates between the frames surrounding the current time, so that the
+  // animation is smooth and of the right duration at any frame rate.
+  setFrameOutput(interpolateValue(
+      duration,
+      startIndex * kSingleFrameInterval,
+      nextIndex * kSingleFrameInterval,
+      frames_[startIndex],
+      frames_[nextIndex],
+      ExtrapolateType::Extend,
+      ExtrapolateType::Extend));
+}
+
+void FrameAnimationDriver::setFrameOutput(double frameOutput) {
+  setAnimatedValue(fromValue_ + frameOutput * (toValue_ - fromValue_));
+}
+
+#pragma mark - SpringAnimationDriver
+
+SpringAnimationDriver::SpringAnimationDriver(
+    int animationId,
+    Tag animatedValueTag,
+    const folly::dynamic& config,
+    AnimationEndCallback endCallback,
+    NativeAnimatedNodesManager& manager)
+    : AnimationDriver(
+          animationId,
+          animatedValueTag,
+          std::move(endCallback),
+          manager),
+      lastPosition_(getAnimatedValue().value_or(0)),
+      lastVelocity_(config.getDefault("initialVelocity", 0.0).asDouble()) {
+  resetConfig(config);
+}
+
+void SpringAnimationDriver::resetConfig(const folly::dynamic& config) {
+  toValue_ = config.getDefault("toValue", 0.0).asDouble();
+  overshootClamping_ = config.getDefault("overshootClamping", false).asBool();
+  restDisplacementThreshold_ =
+      config.getDefault("restDisplacementThreshold", 0.001).asDouble();
+  restSpeedThreshold_ =
+      config.getDefault("restSpeedThreshold", 0.001).asDouble();
+  stiffness_ = config.getDefault("stiffness", 100.0).asDouble();
+  damping_ = config.getDefault("damping", 10.0).asDouble();
+  mass_ = config.getDefault("mass", 1.0).asDouble();
+  // A running spring is restarted from its current position and velocity.
+  initialVelocity_ = lastVelocity_;
+  fromValue_ = lastPosition_;
+  iterations_ = iterationsFromConfig(config);
+  currentLoop_ = 1;
+  lastTime_ = -1;
+  elapsedTime_ = 0;
+  hasFinished_ = iterations_ == 0;
+}
+
+void SpringAnimationDriver::step(double time) {
+  if (lastTime_ < 0) {
+    elapsedTime_ = 0;
+  } else {
+    elapsedTime_ += std::min(kMaxSpringDeltaTime, time - lastTime_);
+  }
+  lastTime_ = time;
+
+  auto c = damping_;
+  auto m = mass_;
+  auto k = stiffness_;
+  auto v0 = -initialVelocity_;
+  auto t = elapsedTime_;
+
+  auto zeta = c / (2 * std::sqrt(k * m));
+  auto omega0 = std::sqrt(k / m);
+  auto x0 = toValue_ - fromValue_;
+
+  auto position = 0.0;
+  auto velocity = 0.0;
+  if (zeta < 1) {
+    // Under damped.
+    auto omega1 = omega0 * std::sqrt(1.0 - zeta * zeta);
+    auto envelope = std::exp(-zeta * omega0 * t);
+    auto a = (v0 + zeta * omega0 * x0) / omega1;
+    position = toValue_ -
+        envelope * (a * std::sin(omega1 * t) + x0 * std::cos(omega1 * t));
+    // The derivative of the position.
+    velocity = zeta * omega0 * envelope *
+            (a * std::sin(omega1 * t) + x0 * std::cos(omega1 * t)) -
+        envelope *
+            (std::cos(omega1 * t) * (v0 + zeta * omega0 * x0) -
+             omega1 * x0 * std::sin(omega1 * t));
+  } else {
+    // Critically or over damped.
+    auto envelope = std::exp(-omega0 * t);
+    position = toValue_ - envelope * (x0 + (v0 + omega0 * x0) * t);
+    velocity = envelope * (v0 * (t * omega0 - 1) + t * x0 * omega0 * omega0);
+  }
+
+  lastPosition_ = position;
+  lastVelocity_ = velocity;
+  setAnimatedValue(position);
+
+  auto isOvershooting = false;
+  if (overshootClamping_ && stiffness_ != 0) {
+    isOvershooting =
+        fromValue_ < toValue_ ? position > toValue_ : position < toValue_;
+  }
+  auto isResting = std::abs(velocity) <= restSpeedThreshold_ &&
+      (stiffness_ == 0 ||
+       std::abs(toValue_ - position) <= restDisplacementThreshold_);
+
+  if (!isOvershooting && !isResting) {
+    return;
+  }
+
+  if (stiffness_ != 0) {
+    // Ensures that the spring comes to rest exactly at its target.
+    setAnimatedValue(toValue_);
+  }
+
+  if (iterations_ == -1 || currentLoop_ < iterations_) {
+    lastPosition_ = fromValue_;
+    lastVelocity_ = initialVelocity_;
+    lastTime_ = -1;
+    currentLoop_++;
+    setAnimatedValue(fromValue_);
+  } else {
+    lastPosition_ = stiffness_ != 0 ? toValue_ : position;
+    hasFinished_ = true;
+  }
+}
+
+#pragma mark - DecayAnimationDriver
+
+DecayAnimationDriver::DecayAnimationDriver(
+    int animationId,
+    Tag animatedValueTag,
+    const folly::dynamic& config,
+    AnimationEndCallback endCallback,
+    NativeAnimatedNodesManager& manager)
+    : AnimationDriver(
+          animationId,
+          animatedValueTag,
+          std::move(endCallback),
+          manager),
+      velocity_(config.getDefault("velocity", 0.0).asDouble()) {
+  resetConfig(config);
+}
+
+void DecayAnimationDriver::resetConfig(const folly::dynamic& config) {
+  deceleration_ = config.getDefault("deceleration", 0.998).asDouble();
+  iterations_ = iterationsFromConfig(config);
+  currentLoop_ = 1;
+  // The next step starts decelerating from the current value of the node.
+  fromValue_.reset();
+  startTime_ = -1;
+  hasFinished_ = iterations_ == 0;
+}
+
+void DecayAnimationDriver::step(double time) {
+  if (startTime_ < 0) {
+    // The first step is considered to be one frame after the start.
+    startTime_ = time - kSingleFrameInterval;
+    if (fromValue_) {
+      // Starts the next iteration from where the first one started.
+      setAnimatedValue(*fromValue_);
+    } else {
+      fromValue_ = getAnimatedValue().value_or(0);
+    }
+    lastValue_ = *fromValue_;
+  }
+
+  auto elapsedMilliseconds = (time - startTime_) * 1000.0;
+  auto value = *fromValue_ +
+      (velocity_ / (1 - deceleration_)) *
+          (1 - std::exp(-(1 - deceleration_) * elapsedMilliseconds));
+  setAnimatedValue(value);
+
+  if (std::abs(lastValue_ - value) < 0.1) {
+    if (iterations_ == -1 || currentLoop_ < iterations_) {
+      startTime_ = -1;
+      currentLoop_++;
+    } else {
+      hasFinished_ = true;
+      return;
+    }
+  }
+
+  lastValue_ = value;
+}
+
+} // namespace facebook::react
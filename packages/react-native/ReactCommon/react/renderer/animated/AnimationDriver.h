@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <folly/dynamic.h>
+#include <react/renderer/core/ReactPrimitives.h>
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+namespace facebook::react {
+
+class NativeAnimatedNodesManager;
+
+/*
+ * Called once an animation stops, either because it finished or because it
+ * was stopped or replaced, with the last value of the animated node.
+ */
+using AnimationEndCallback = std::function<void(bool finished, double value)>;
+
+/*
+ * Drives the value of a `ValueAnimatedNode` over time. Animations are stepped
+ * by the manager with the timestamp of every frame, in seconds.
+ */
+class AnimationDriver {
+ public:
+  AnimationDriver(
+      int animationId,
+      Tag animatedValueTag,
+      AnimationEndCallback endCallback,
+      NativeAnimatedNodesManager& manager);
+  virtual ~AnimationDriver() = default;
+
+  AnimationDriver(const AnimationDriver&) = delete;
+  AnimationDriver& operator=(const AnimationDriver&) = delete;
+
+  int getId() const;
+  Tag getAnimatedValueTag() const;
+  bool hasFinished() const;
+
+  /*
+   * Restarts the animation from the current value of the node with the
+   * given config, which JS does to update a running animation.
+   */
+  virtual void resetConfig(const folly::dynamic& config) = 0;
+
+  void runAnimationStep(double time);
+
+  /*
+   * Calls the end callback. Must be called exactly once, when the manager
+   * removes the animation.
+   */
+  void stop();
+
+ protected:
+  /*
+   * Computes the value of the animation at `time` and sets `hasFinished_`
+   * once the last iteration completes.
+   */
+  virtual void step(double time) = 0;
+
+  /*
+   * Returns the value of the animated node, or `std::nullopt` if it was
+   * dropped.
+   */
+  std::optional<double> getAnimatedValue() const;
+  void setAnimatedValue(double value);
+
+  /*
+   * Number of iterations, where `-1` means that the animation repeats until
+   * it is stopped.
+   */
+  static int iterationsFromConfig(const folly::dynamic& config);
+
+  bool hasFinished_{false};
+
+ private:
+  const int id_;
+  const Tag animatedValueTag_;
+  AnimationEndCallback endCallback_;
+  NativeAnimatedNodesManager& manager_;
+};
+
+/*
+ * Plays back the easing curve sampled in JS at 60 frames per second, as
+ * `Animated.timing` does.
+ */
+class FrameAnimationDriver final : public AnimationDriver {
+ public:
+  FrameAnimationDriver(
+      int animationId,
+      Tag animatedValueTag,
+      const folly::dynamic& config,
+      AnimationEndCallback endCallback,
+      NativeAnimatedNodesManager& manager);
+
+  void resetConfig(const folly::dynamic& config) override;
+
+ protected:
+  void step(double time) override;
+
+ private:
+  void setFrameOutput(double frameOutput);
+
+  std::vector<double> frames_;
+  double fromValue_{0};
+  double toValue_{0};
+  double startTime_{-1};
+  int iterations_{1};
+  int currentLoop_{1};
+};
+
+/*
+ * Simulates a damped harmonic oscillator, as `Animated.spring` does.
+ */
+class SpringAnimationDriver final : public AnimationDriver {
+ public:
+  SpringAnimationDriver(
+      int animationId,
+      Tag animatedValueTag,
+      const folly::dynamic& config,
+      AnimationEndCallback endCallback,
+      NativeAnimatedNodesManager& manager);
+
+  void resetConfig(const folly::dynamic& config) override;
+
+ protected:
+  void step(double time) override;
+
+ private:
+  double toValue_{0};
+  double fromValue_{0};
+  bool overshootClamping_{false};
+  double restDisplacementThreshold_{0};
+  double restSpeedThreshold_{0};
+  double stiffness_{0};
+  double damping_{0};
+  double mass_{0};
+  double initialVelocity_{0};
+  double lastPosition_{0};
+  double lastVelocity_{0};
+  double lastTime_{-1};
+  // Time elapsed in the current iteration, excluding frame drops.
+  double elapsedTime_{0};
+  int iterations_{1};
+  int currentLoop_{1};
+};
+
+/*
+ * Decelerates from an initial velocity until the value comes to rest, as
+ * `Animated.decay` does.
+ */
+class DecayAnimationDriver final : public AnimationDriver {
+ public:
+  DecayAnimationDriver(
+      int animationId,
+      Tag animatedValueTag,
+      const folly::dynamic& config,
+      AnimationEndCallback endCallback,
+      NativeAnimatedNodesManager& manager);
+
+  void resetConfig(const folly::dynamic& config) override;
+
+ protected:
+  void step(double time) override;
+
+ private:
+  double velocity_{0};
+  double deceleration_{0};
+  std::optional<double> fromValue_;
+  double lastValue_{0};
+  double startTime_{-1};
+  int iterations_{1};
+  int currentLoop_{1};
+};
+
+} // namespace facebook::react
@@ -0,0 +1,572 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "NativeAnimatedNodesManager.h"
+
+#include <glog/logging.h>
+#include <react/renderer/animated/PropsAnimatedNode.h>
+#include <react/renderer/animated/ValueAnimatedNodes.h>
+
+#include <algorithm>
+
+namespace facebook::react {
+
+static void removeTag(std::vector<Tag>& tags, Tag tag) {
+  tags.erase(std::remove(tags.begin(), tags.end(), tag), tags.end());
+}
+
+NativeAnimatedNodesManager::NativeAnimatedNodesManager(
+    DirectManipulationCallback directManipulationCallback,
+    FabricCommitCallback fabricCommitCallback,
+    StartOnRenderCallback startOnRenderCallback,
+    StopOnRenderCallback stopOnRenderCallback)
+    : directManipulationCallback_(std::move(directManipulationCallback)),
+      fabricCommitCallback_(std::move(fabricCommitCallback)),
+      startOnRenderCallback_(std::move(startOnRenderCallback)),
+      stopOnRenderCallback_(std::move(stopOnRenderCallback)) {}
+
+NativeAnimatedNodesManager::~NativeAnimatedNodesManager() = default;
+
+#pragma mark - Graph
+
+std::unique_ptr<AnimatedNode> NativeAnimatedNodesManager::makeNode(
+    Tag tag,
+    const folly::dynamic& config) {
+  auto type = config.getDefault("type", "").asString();
+  if (type == "value") {
+    return std::make_unique<ValueAnimatedNode>(tag, config, *this);
+  }
+  if (type == "interpolation") {
+    return std::make_unique<InterpolationAnimatedNode>(tag, config, *this);
+  }
+  if (type == "addition") {
+    return std::make_unique<OperatorAnimatedNode>(
+        tag, OperatorAnimatedNode::Operator::Addition, config, *this);
+  }
+  if (type == "subtraction") {
+    return std::make_unique<OperatorAnimatedNode>(
+        tag, OperatorAnimatedNode::Operator::Subtraction, config, *this);
+  }
+  if (type == "multiplication") {
+    return std::make_unique<OperatorAnimatedNode>(
+        tag, OperatorAnimatedNode::Operator::Multiplication, config, *this);
+  }
+  if (type == "division") {
+    return std::make_unique<OperatorAnimatedNode>(
+        tag, OperatorAnimatedNode::Operator::Division, config, *this);
+  }
+  if (type == "modulus") {
+    return std::make_unique<ModulusAnimatedNode>(tag, config, *this);
+  }
+  if (type == "diffclamp") {
+    return std::make_unique<DiffClampAnimatedNode>(tag, config, *this);
+  }
+  if (type == "transform") {
+    return std::make_unique<TransformAnimatedNode>(tag, config, *this);
+  }
+  if (type == "style") {
+    return std::make_unique<StyleAnimatedNode>(tag, config, *this);
+  }
+  if (type == "props") {
+    return std::make_unique<PropsAnimatedNode>(tag, config, *this);
+  }
+  return nullptr;
+}
+
+void NativeAnimatedNodesManager::createAnimatedNode(
+    Tag tag,
+    const folly::dynamic& config) {
+  auto node = makeNode(tag, config);
+  if (!node) {
+    LOG(ERROR) << "Animated node type "
+               << config.getDefault("type", "").asString()
+               << " is not supported natively";
+    return;
+  }
+
+  nodes_[tag] = std::move(node);
+  updateOrderNeedsUpdate_ = true;
+  setNodeNeedsUpdate(tag);
+  startRenderingIfNeeded();
+}
+
+void NativeAnimatedNodesManager::connectAnimatedNodes(
+    Tag parentTag,
+    Tag childTag) {
+  auto parent = getNode(parentTag);
+  auto child = getNode(childTag);
+  if (parent == nullptr || child == nullptr) {
+    LOG(ERROR) << "Cannot connect animated nodes " << parentTag << " and "
+               << childTag << " which don't exist";
+    return;
+  }
+
+  parent->children_.push_back(childTag);
+  child->parents_.push_back(parentTag);
+  updateOrderNeedsUpdate_ = true;
+  setNodeNeedsUpdate(childTag);
+  startRenderingIfNeeded();
+}
+
+void NativeAnimatedNodesManager::disconnectAnimatedNodes(
+    Tag parentTag,
+    Tag childTag) {
+  auto parent = getNode(parentTag);
+  auto child = getNode(childTag);
+  if (parent == nullptr || child == nullptr) {
+    return;
+  }
+
+  removeTag(parent->children_, childTag);
+  removeTag(child->parents_, parentTag);
+  updateOrderNeedsUpdate_ = true;
+  setNodeNeedsUpdate(childTag);
+  startRenderingIfNeeded();
+}
+
+void NativeAnimatedNodesManager::connectAnimatedNodeToView(
+    Tag propsNodeTag,
+    Tag viewTag) {
+  auto node = getNodeAs<PropsAnimatedNode>(propsNodeTag);
+  if (node == nullptr) {
+    LOG(ERROR) << "Animated node " << propsNodeTag << " is not a props node";
+    return;
+  }
+
+  node->connectToView(viewTag);
+  setNodeNeedsUpdate(propsNodeTag);
+  startRenderingIfNeeded();
+}
+
+void NativeAnimatedNodesManager::disconnectAnimatedNodeFromView(
+    Tag propsNodeTag,
+    Tag viewTag) {
+  if (auto node = getNodeAs<PropsAnimatedNode>(propsNodeTag)) {
+    node->disconnectFromView(viewTag);
+  }
+}
+
+void NativeAnimatedNodesManager::dropAnimatedNode(Tag tag) {
+  auto it = nodes_.find(tag);
+  if (it == nodes_.end()) {
+    return;
+  }
+
+  auto& node = *it->second;
+  for (auto parentTag : node.parents_) {
+    if (auto parent = getNode(parentTag)) {
+      removeTag(parent->children_, tag);
+    }
+  }
+  for (auto childTag : node.children_) {
+    if (auto child = getNode(childTag)) {
+      removeTag(child->parents_, tag);
+      setNodeNeedsUpdate(childTag);
+    }
+  }
+
+  nodes_.erase(it);
+  updateOrderNeedsUpdate_ = true;
+  startRenderingIfNeeded();
+}
+
+AnimatedNode* NativeAnimatedNodesManager::getNode(Tag tag) const {
+  auto it = nodes_.find(tag);
+  return it != nodes_.end() ? it->second.get() : nullptr;
+}
+
+#pragma mark - Values
+
+void NativeAnimatedNodesManager::setAnimatedNodeValue(Tag tag, double value) {
+  auto node = getNodeAs<ValueAnimatedNode>(tag);
+  if (node == nullptr) {
+    LOG(ERROR) << "Animated node " << tag << " is not a value node";
+    return;
+  }
+
+  stopAnimationsForNode(tag);
+  node->setValue(value);
+  node->setNeedsUpdate();
+  startRenderingIfNeeded();
+}
+
+void NativeAnimatedNodesManager::setAnimatedNodeOffset(Tag tag, double offset) {
+  auto node = getNodeAs<ValueAnimatedNode>(tag);
+  if (node == nullptr) {
+    LOG(ERROR) << "Animated node " << tag << " is not a value node";
+    return;
+  }
+
+  node->setOffset(offset);
+  node->setNeedsUpdate();
+  startRenderingIfNeeded();
+}
+
+void NativeAnimatedNodesManager::flattenAnimatedNodeOffset(Tag tag) {
+  // The output of the node doesn't change, so it doesn't need to be updated.
+  if (auto node = getNodeAs<ValueAnimatedNode>(tag)) {
+    node->flattenOffset();
+  }
+}
+
+void NativeAnimatedNodesManager::extractAnimatedNodeOffset(Tag tag) {
+  if (auto node = getNodeAs<ValueAnimatedNode>(tag)) {
+    node->extractOffset();
+  }
+}
+
+std::optional<double> NativeAnimatedNodesManager::getValue(Tag tag) const {
+  auto node = getNodeAs<ValueAnimatedNode>(tag);
+  if (node == nullptr) {
+    return std::nullopt;
+  }
+  return node->getValue();
+}
+
+#pragma mark - Animations
+
+void NativeAnimatedNodesManager::startAnimatingNode(
+    int animationId,
+    Tag animatedNodeTag,
+    const folly::dynamic& config,
+    AnimationEndCallback endCallback) {
+  for (const auto& animation : activeAnimations_) {
+    if (animation->getId() == animationId) {
+      animation->resetConfig(config);
+      return;
+    }
+  }
+
+  if (getNodeAs<ValueAnimatedNode>(animatedNodeTag) == nullptr) {
+    LOG(ERROR) << "Animated node " << animatedNodeTag
+               << " is not a value node";
+    return;
+  }
+
+  auto type = config.getDefault("type", "").asString();
+  auto animation = std::unique_ptr<AnimationDriver>{};
+  if (type == "frames") {
+    animation = std::make_unique<FrameAnimationDriver>(
+        animationId, animatedNodeTag, config, std::move(endCallback), *this);
+  } else if (type == "spring") {
+    animation = std::make_unique<SpringAnimationDriver>(
+        animationId, animatedNodeTag, config, std::move(endCallback), *this);
+  } else if (type == "decay") {
+    animation = std::make_unique<DecayAnimationDriver>(
+        animationId, animatedNodeTag, config, std::move(endCallback), *this);
+  } else {
+    LOG(ERROR) << "Unsupported animation type: " << type;
+    return;
+  }
+
+  activeAnimations_.push_back(std::move(animation));
+  startRenderingIfNeeded();
+}
+
+void NativeAnimatedNodesManager::stopAnimation(int animationId) {
+  auto it = std::find_if(
+      activeAnimations_.begin(),
+      activeAnimations_.end(),
+      [&](const auto& animation) { return animation->getId() == animationId; });
+  if (it == activeAnimations_.end()) {
+    return;
+  }
+
+  auto animation = std::move(*it);
+  activeAnimations_.erase(it);
+  animation->stop();
+}
+
+void NativeAnimatedNodesManager::stopAnimationsForNode(Tag tag) {
+  auto stoppedAnimations = std::vector<std::unique_ptr<AnimationDriver>>{};
+  for (auto it = activeAnimations_.begin(); it != activeAnimations_.end();) {
+    if ((*it)->getAnimatedValueTag() == tag) {
+      stoppedAnimations.push_back(std::move(*it));
+      it = activeAnimations_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  // End callbacks may start new animations, so they are called last.
+  for (const auto& animation : stoppedAnimations) {
+    animation->stop();
+  }
+}
+
+bool NativeAnimatedNodesManager::isAnimating() const {
+  return !activeAnimations_.empty();
+}
+
+void NativeAnimatedNodesManager::onAnimationFrame(double timestamp) {
+  for (const auto& animation : activeAnimations_) {
+    animation->runAnimationStep(timestamp);
+  }
+
+  updateNodes();
+
+  auto finishedAnimations = std::vector<std::unique_ptr<AnimationDriver>>{};
+  for (auto it = activeAnimations_.begin(); it != activeAnimations_.end();) {
+    if ((*it)->hasFinished()) {
+      finishedAnimations.push_back(std::move(*it));
+      it = activeAnimations_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  for (const auto& animation : finishedAnimations) {
+    animation->stop();
+  }
+
+  if (activeAnimations_.empty() && nodesNeedingUpdate_.empty()) {
+    stopRendering();
+    commitPropsIfIdle();
+  }
+}
+
+void NativeAnimatedNodesManager::startRenderingIfNeeded() {
+  if (isRendering_ ||
+      (activeAnimations_.empty() && nodesNeedingUpdate_.empty())) {
+    return;
+  }
+  isRendering_ = true;
+  if (startOnRenderCallback_) {
+    startOnRenderCallback_();
+  }
+}
+
+void NativeAnimatedNodesManager::stopRendering() {
+  if (!isRendering_) {
+    return;
+  }
+  isRendering_ = false;
+  if (stopOnRenderCallback_) {
+    stopOnRenderCallback_();
+  }
+}
+
+#pragma mark - Events
+
+// Event names are normalized differently by the platforms, so mappings are
+// keyed by the name without the `on` or `top` prefix.
+std::string NativeAnimatedNodesManager::eventDriversKey(
+    Tag viewTag,
+    const std::string& eventName) {
+  auto name = std::string_view{eventName};
+  if (name.starts_with("on")) {
+    name.remove_prefix(2);
+  } else if (name.starts_with("top")) {
+    name.remove_prefix(3);
+  }
+  return std::to_string(viewTag) + std::string{name};
+}
+
+void NativeAnimatedNodesManager::addAnimatedEventToView(
+    Tag viewTag,
+    const std::string& eventName,
+    const folly::dynamic& eventMapping) {
+  auto driver = EventAnimationDriver{
+      {},
+      static_cast<Tag>(eventMapping.getDefault("animatedValueTag", 0).asInt())};
+  const auto& eventPath =
+      eventMapping.getDefault("nativeEventPath", folly::dynamic::array());
+  for (const auto& key : eventPath) {
+    driver.eventPath.push_back(key.asString());
+  }
+
+  eventDrivers_[eventDriversKey(viewTag, eventName)].push_back(
+      std::move(driver));
+}
+
+void NativeAnimatedNodesManager::removeAnimatedEventFromView(
+    Tag viewTag,
+    const std::string& eventName,
+    Tag animatedValueTag) {
+  auto it = eventDrivers_.find(eventDriversKey(viewTag, eventName));
+  if (it == eventDrivers_.end()) {
+    return;
+  }
+
+  auto& drivers = it->second;
+  drivers.erase(
+      std::remove_if(
+          drivers.begin(),
+          drivers.end(),
+          [&](const EventAnimationDriver& driver) {
+            return driver.animatedValueTag == animatedValueTag;
+          }),
+      drivers.end());
+  if (drivers.empty()) {
+    eventDrivers_.erase(it);
+  }
+}
+
+bool NativeAnimatedNodesManager::handleAnimatedEvent(
+    Tag viewTag,
+    const std::string& eventName,
+    const folly::dynamic& payload) {
+  if (eventDrivers_.empty()) {
+    return false;
+  }
+  auto it = eventDrivers_.find(eventDriversKey(viewTag, eventName));
+  if (it == eventDrivers_.end()) {
+    return false;
+  }
+
+  for (const auto& driver : it->second) {
+    const auto* value = &payload;
+    for (const auto& key : driver.eventPath) {
+      value = value->isObject() ? value->get_ptr(key) : nullptr;
+      if (value == nullptr) {
+        break;
+      }
+    }
+    if (value == nullptr || !value->isNumber()) {
+      continue;
+    }
+
+    if (auto node = getNodeAs<ValueAnimatedNode>(driver.animatedValueTag)) {
+      stopAnimationsForNode(driver.animatedValueTag);
+      node->setValue(value->asDouble());
+      node->setNeedsUpdate();
+    }
+  }
+
+  // Events are applied synchronously, so that for example a header tracking
+  // the scroll position never lags behind the content.
+  updateNodes();
+  commitPropsIfIdle();
+  return true;
+}
+
+#pragma mark - Nodes
+
+void NativeAnimatedNodesManager::setNodeNeedsUpdate(Tag tag) {
+  auto node = getNode(tag);
+  if (node == nullptr || node->needsUpdate_) {
+    return;
+  }
+  node->needsUpdate_ = true;
+  nodesNeedingUpdate_.push_back(tag);
+}
+
+void NativeAnimatedNodesManager::schedulePropsUpdate(
+    Tag viewTag,
+    folly::dynamic props) {
+  auto it = updatedProps_.find(viewTag);
+  if (it == updatedProps_.end()) {
+    updatedProps_.emplace(viewTag, std::move(props));
+  } else {
+    it->second.update(props);
+  }
+}
+
+void NativeAnimatedNodesManager::updateNodes() {
+  if (nodesNeedingUpdate_.empty()) {
+    return;
+  }
+
+  updateNodesOrderIfNeeded();
+
+  // Nodes marked as needing an update from now on are updated in the next
+  // pass.
+  auto tags = std::move(nodesNeedingUpdate_);
+  nodesNeedingUpdate_ = {};
+
+  // Collects the nodes which depend on the ones needing an update.
+  auto nodes = std::vector<AnimatedNode*>{};
+  for (auto tag : tags) {
+    if (auto node = getNode(tag)) {
+      nodes.push_back(node);
+    }
+  }
+  for (size_t i = 0; i < nodes.size(); i++) {
+    for (auto childTag : nodes[i]->children_) {
+      auto child = getNode(childTag);
+      if (child != nullptr && !child->needsUpdate_) {
+        child->needsUpdate_ = true;
+        nodes.push_back(child);
+      }
+    }
+  }
+
+  std::sort(nodes.begin(), nodes.end(), [](auto lhs, auto rhs) {
+    return lhs->updateOrder_ < rhs->updateOrder_;
+  });
+
+  for (auto node : nodes) {
+    node->needsUpdate_ = false;
+    node->update();
+  }
+
+  for (auto& [viewTag, props] : updatedProps_) {
+    if (directManipulationCallback_) {
+      directManipulationCallback_(viewTag, props);
+    }
+    auto it = uncommittedProps_.find(viewTag);
+    if (it == uncommittedProps_.end()) {
+      uncommittedProps_.emplace(viewTag, std::move(props));
+    } else {
+      it->second.update(props);
+    }
+  }
+  updatedProps_.clear();
+}
+
+void NativeAnimatedNodesManager::updateNodesOrderIfNeeded() {
+  if (!updateOrderNeedsUpdate_) {
+    return;
+  }
+  updateOrderNeedsUpdate_ = false;
+
+  // Orders the nodes topologically (Kahn's algorithm), so that every node is
+  // updated after all of its parents.
+  auto parentsCount = std::unordered_map<Tag, size_t>{};
+  auto queue = std::vector<AnimatedNode*>{};
+  for (const auto& [tag, node] : nodes_) {
+    auto count = static_cast<size_t>(std::count_if(
+        node->parents_.begin(), node->parents_.end(), [&](Tag parentTag) {
+          return nodes_.count(parentTag) != 0;
+        }));
+    node->updateOrder_ = nodes_.size();
+    if (count == 0) {
+      queue.push_back(node.get());
+    } else {
+      parentsCount[tag] = count;
+    }
+  }
+
+  for (size_t i = 0; i < queue.size(); i++) {
+    queue[i]->updateOrder_ = i;
+    for (auto childTag : queue[i]->children_) {
+      auto it = parentsCount.find(childTag);
+      if (it != parentsCount.end() && --it->second == 0) {
+        queue.push_back(getNode(childTag));
+      }
+    }
+  }
+
+  // Nodes in a cycle keep being updated last.
+  if (queue.size() < nodes_.size()) {
+    LOG(ERROR) << "Detected a cycle in the animated graph";
+  }
+}
+
+void NativeAnimatedNodesManager::commitPropsIfIdle() {
+  if (!activeAnimations_.empty() || uncommittedProps_.empty()) {
+    return;
+  }
+
+  auto props = std::move(uncommittedProps_);
+  uncommittedProps_ = {};
+  if (fabricCommitCallback_) {
+    fabricCommitCallback_(props);
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <folly/dynamic.h>
+#include <react/renderer/animated/AnimatedNode.h>
+#include <react/renderer/animated/AnimationDriver.h>
+#include <react/renderer/core/ReactPrimitives.h>
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * The platform independent engine behind `NativeAnimatedModule`: it owns the
+ * graph of animated nodes created from JS, runs animations and animated
+ * events on the UI thread, and applies the resulting props to views without
+ * involving JS.
+ *
+ * Changes made from JS are applied on the next frame, and animated events
+ * right away. Every update of the props of a view is applied through the
+ * direct manipulation callback. Because such updates bypass the shadow tree,
+ * the latest props of every animated view are also committed through the
+ * Fabric commit callback once the graph settles (i.e. at the end of a batch of
+ * updates while no animation is running), so that the next commit from JS
+ * doesn't revert them.
+ *
+ * Not thread safe: all methods must be called on the UI thread.
+ */
+class NativeAnimatedNodesManager {
+ public:
+  /*
+   * Applies props to the mounted view with given tag synchronously.
+   */
+  using DirectManipulationCallback =
+      std::function<void(Tag viewTag, const folly::dynamic& props)>;
+
+  /*
+   * Commits the props of the views with given tags into the shadow tree,
+   * e.g. with `UIManager::setNativeProps_DEPRECATED`.
+   */
+  using FabricCommitCallback = std::function<void(
+      const std::unordered_map<Tag, folly::dynamic>& propsByViewTag)>;
+
+  /*
+   * Requests (or cancels requesting) `onAnimationFrame` to be called on every
+   * frame of the display.
+   */
+  using StartOnRenderCallback = std::function<void()>;
+  using StopOnRenderCallback = std::function<void()>;
+
+  NativeAnimatedNodesManager(
+      DirectManipulationCallback directManipulationCallback,
+      FabricCommitCallback fabricCommitCallback,
+      StartOnRenderCallback startOnRenderCallback,
+      StopOnRenderCallback stopOnRenderCallback);
+
+  ~NativeAnimatedNodesManager();
+
+  NativeAnimatedNodesManager(const NativeAnimatedNodesManager&) = delete;
+  NativeAnimatedNodesManager& operator=(const NativeAnimatedNodesManager&) =
+      delete;
+
+#pragma mark - Graph
+
+  void createAnimatedNode(Tag tag, const folly::dynamic& config);
+  void connectAnimatedNodes(Tag parentTag, Tag childTag);
+  void disconnectAnimatedNodes(Tag parentTag, Tag childTag);
+  void connectAnimatedNodeToView(Tag propsNodeTag, Tag viewTag);
+  void disconnectAnimatedNodeFromView(Tag propsNodeTag, Tag viewTag);
+  void dropAnimatedNode(Tag tag);
+
+  AnimatedNode* getNode(Tag tag) const;
+
+  template <typename NodeT>
+  NodeT* getNodeAs(Tag tag) const {
+    return dynamic_cast<NodeT*>(getNode(tag));
+  }
+
+#pragma mark - Values
+
+  void setAnimatedNodeValue(Tag tag, double value);
+  void setAnimatedNodeOffset(Tag tag, double offset);
+  void flattenAnimatedNodeOffset(Tag tag);
+  void extractAnimatedNodeOffset(Tag tag);
+
+  /*
+   * Returns the value of the value node with given tag, if there is one.
+   */
+  std::optional<double> getValue(Tag tag) const;
+
+#pragma mark - Animations
+
+  /*
+   * Starts animating the value node with given tag. If an animation with the
+   * same id is already running, it is restarted with the new config instead.
+   */
+  void startAnimatingNode(
+      int animationId,
+      Tag animatedNodeTag,
+      const folly::dynamic& config,
+      AnimationEndCallback endCallback);
+
+  void stopAnimation(int animationId);
+
+  bool isAnimating() const;
+
+  /*
+   * Steps all running animations to `timestamp` (in seconds) and applies the
+   * updated props.
+   */
+  void onAnimationFrame(double timestamp);
+
+#pragma mark - Events
+
+  /*
+   * Maps a numeric field of the payload of an event of the view to the value
+   * node, as `Animated.event` with `useNativeDriver` does. `eventMapping`
+   * contains the `animatedValueTag` and the `nativeEventPath` to the field.
+   */
+  void addAnimatedEventToView(
+      Tag viewTag,
+      const std::string& eventName,
+      const folly::dynamic& eventMapping);
+
+  void removeAnimatedEventFromView(
+      Tag viewTag,
+      const std::string& eventName,
+      Tag animatedValueTag);
+
+  /*
+   * Updates the value nodes mapped to the event and applies the updated
+   * props. Returns whether any value node is mapped to the event.
+   */
+  bool handleAnimatedEvent(
+      Tag viewTag,
+      const std::string& eventName,
+      const folly::dynamic& payload);
+
+#pragma mark - Nodes
+
+  /*
+   * Called by nodes. See `AnimatedNode::setNeedsUpdate`.
+   */
+  void setNodeNeedsUpdate(Tag tag);
+
+  /*
+   * Called by props nodes with the props to apply to their view at the end of
+   * the current update.
+   */
+  void schedulePropsUpdate(Tag viewTag, folly::dynamic props);
+
+ private:
+  struct EventAnimationDriver {
+    std::vector<std::string> eventPath;
+    Tag animatedValueTag;
+  };
+
+  std::unique_ptr<AnimatedNode> makeNode(
+      Tag tag,
+      const folly::dynamic& config);
+
+  void stopAnimationsForNode(Tag tag);
+
+  /*
+   * Requests frames while there are animations running or nodes to update.
+   */
+  void startRenderingIfNeeded();
+  void stopRendering();
+
+  /*
+   * Updates the nodes which need it, together with all nodes which depend on
+   * them, and applies the resulting props.
+   */
+  void updateNodes();
+  void updateNodesOrderIfNeeded();
+  void commitPropsIfIdle();
+
+  static std::string eventDriversKey(Tag viewTag, const std::string& name);
+
+  DirectManipulationCallback directManipulationCallback_;
+  FabricCommitCallback fabricCommitCallback_;
+  StartOnRenderCallback startOnRenderCallback_;
+  StopOnRenderCallback stopOnRenderCallback_;
+
+  std::unordered_map<Tag, std::unique_ptr<AnimatedNode>> nodes_;
+  std::vector<std::unique_ptr<AnimationDriver>> activeAnimations_;
+  std::unordered_map<std::string, std::vector<EventAnimationDriver>>
+      eventDrivers_;
+
+  std::vector<Tag> nodesNeedingUpdate_;
+  bool updateOrderNeedsUpdate_{false};
+  bool isRendering_{false};
+
+  // Props to apply in the current update, and props applied since the last
+  // Fabric commit.
+  std::unordered_map<Tag, folly::dynamic> updatedProps_;
+  std::unordered_map<Tag, folly::dynamic> uncommittedProps_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "PropsAnimatedNode.h"
+
+#include <react/renderer/animated/NativeAnimatedNodesManager.h>
+
+namespace facebook::react {
+
+TransformAnimatedNode::TransformAnimatedNode(
+    Tag tag,
+    const folly::dynamic& config,
+    NativeAnimatedNodesManager& manager)
+    : AnimatedNode(tag, manager),
+      transformsConfig_(
+          config.getDefault("transforms", folly::dynamic::array())) {}
+
+folly::dynamic TransformAnimatedNode::getTransform() const {
+  auto transform = folly::dynamic::array();
+  for (const auto& transformConfig : transformsConfig_) {
+    const auto& property = transformConfig["property"];
+    if (transformConfig.getDefault("type") == "animated") {
+      auto nodeTag =
+          static_cast<Tag>(transformConfig.getDefault("nodeTag", 0).asInt());
+      auto node = manager_.getNodeAs<ValueAnimatedNode>(nodeTag);
+      if (node == nullptr) {
+        continue;
+      }
+      transform.push_back(folly::dynamic::object(property, node->getValue()));
+    } else {
+      transform.push_back(
+          folly::dynamic::object(property, transformConfig["value"]));
+    }
+  }
+  return transform;
+}
+
+StyleAnimatedNode::StyleAnimatedNode(
+    Tag tag,
+    const folly::dynamic& config,
+    NativeAnimatedNodesManager& manager)
+    : AnimatedNode(tag, manager),
+      styleConfig_(config.getDefault("style", folly::dynamic::object())) {}
+
+void StyleAnimatedNode::collectProps(folly::dynamic& props) const {
+  for (const auto& [property, nodeTag] : styleConfig_.items()) {
+    auto node = manager_.getNode(static_cast<Tag>(nodeTag.asInt()));
+    if (auto valueNode = dynamic_cast<const ValueAnimatedNode*>(node)) {
+      props[property] = valueNode->getValue();
+    } else if (
+        auto transformNode = dynamic_cast<const TransformAnimatedNode*>(node)) {
+      props["transform"] = transformNode->getTransform();
+    }
+  }
+}
+
+PropsAnimatedNode::PropsAnimatedNode(
+    Tag tag,
+    const folly::dynamic& config,
+    NativeAnimatedNodesManager& manager)
+    : AnimatedNode(tag, manager),
+      propsConfig_(config.getDefault("props", folly::dynamic::object())) {}
+
+void PropsAnimatedNode::connectToView(Tag viewTag) {
+  connectedViewTag_ = viewTag;
+}
+
+void PropsAnimatedNode::disconnectFromView(Tag viewTag) {
+  if (connectedViewTag_ == viewTag) {
+    connectedViewTag_.reset();
+  }
+}
+
+std::optional<Tag> PropsAnimatedNode::getConnectedViewTag() const {
+  return connectedViewTag_;
+}
+
+void PropsAnimatedNode::update() {
+  // A node may still be updated right after its view was disconnected, in
+  // which case there is nothing to apply the props to.
+  if (!connectedViewTag_) {
+    return;
+  }
+
+  auto props = folly::dynamic::object();
+  for (const auto& [property, nodeTag] : propsConfig_.items()) {
+    auto node = manager_.getNode(static_cast<Tag>(nodeTag.asInt()));
+    if (auto styleNode = dynamic_cast<const StyleAnimatedNode*>(node)) {
+      // Style props are flattened into the props of the view.
+      styleNode->collectProps(props);
+    } else if (auto valueNode = dynamic_cast<const ValueAnimatedNode*>(node)) {
+      props[property] = valueNode->getValue();
+    }
+  }
+
+  if (!props.empty()) {
+    manager_.schedulePropsUpdate(*connectedViewTag_, std::move(props));
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/animated/AnimatedNode.h>
+
+#include <optional>
+
+namespace facebook::react {
+
+/*
+ * The `transform` of an animated style, mixing animated and static
+ * operations.
+ */
+class TransformAnimatedNode final : public AnimatedNode {
+ public:
+  TransformAnimatedNode(
+      Tag tag,
+      const folly::dynamic& config,
+      NativeAnimatedNodesManager& manager);
+
+  /*
+   * Returns the current `transform` value, e.g. `[{"translateX": 10}]`.
+   */
+  folly::dynamic getTransform() const;
+
+ private:
+  folly::dynamic transformsConfig_;
+};
+
+/*
+ * An animated `style` object, mapping style props to the nodes animating them.
+ */
+class StyleAnimatedNode final : public AnimatedNode {
+ public:
+  StyleAnimatedNode(
+      Tag tag,
+      const folly::dynamic& config,
+      NativeAnimatedNodesManager& manager);
+
+  /*
+   * Adds the current values of the animated style props to `props`.
+   */
+  void collectProps(folly::dynamic& props) const;
+
+ private:
+  folly::dynamic styleConfig_;
+};
+
+/*
+ * The animated props of a view. When the node is connected to a view, every
+ * update hands the current values of all props it animates to the manager,
+ * which applies them to the view.
+ */
+class PropsAnimatedNode final : public AnimatedNode {
+ public:
+  PropsAnimatedNode(
+      Tag tag,
+      const folly::dynamic& config,
+      NativeAnimatedNodesManager& manager);
+
+  void connectToView(Tag viewTag);
+  void disconnectFromView(Tag viewTag);
+
+  std::optional<Tag> getConnectedViewTag() const;
+
+  void update() override;
+
+ private:
+  folly::dynamic propsConfig_;
+  std::optional<Tag> connectedViewTag_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "UIManagerAnimatedPropsCommit.h"
+
+#include <vector>
+
+namespace facebook::react {
+
+NativeAnimatedNodesManager::FabricCommitCallback
+makeUIManagerAnimatedPropsCommitCallback(
+    std::weak_ptr<const UIManager> uiManager) {
+  return [uiManager = std::move(uiManager)](
+             const std::unordered_map<Tag, folly::dynamic>& propsByViewTag) {
+    auto strongUIManager = uiManager.lock();
+    if (!strongUIManager) {
+      return;
+    }
+
+    auto nativePropsUpdates = std::vector<UIManager::NativePropsUpdate>{};
+    nativePropsUpdates.reserve(propsByViewTag.size());
+    for (const auto& [viewTag, props] : propsByViewTag) {
+      auto shadowNode =
+          strongUIManager->findShadowNodeByTag_DEPRECATED(viewTag);
+      if (shadowNode) {
+        nativePropsUpdates.push_back({std::move(shadowNode), RawProps(props)});
+      }
+    }
+
+    if (!nativePropsUpdates.empty()) {
+      strongUIManager->setNativeProps_DEPRECATED(nativePropsUpdates);
+    }
+  };
+}
+
+} // namespace facebook::react
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/animated/NativeAnimatedNodesManager.h>
+#include <react/renderer/uimanager/UIManager.h>
+
+#include <memory>
+
+namespace facebook::react {
+
+/*
+ * Returns a Fabric commit callback for `NativeAnimatedNodesManager` which
+ * commits animated props into the shadow trees of `uiManager` with
+ * `setNativeProps_DEPRECATED`, performing one commit per surface, so that
+ * later commits from JS keep them.
+ * Views which are not mounted anymore are skipped.
+ */
+NativeAnimatedNodesManager::FabricCommitCallback
+makeUIManagerAnimatedPropsCommitCallback(
+    std::weak_ptr<const UIManager> uiManager);
+
+} // namespace facebook::react
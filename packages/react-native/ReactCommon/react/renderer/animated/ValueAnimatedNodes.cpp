@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ValueAnimatedNodes.h"
+
+#include <glog/logging.h>
+#include <react/debug/react_native_assert.h>
+#include <react/renderer/animated/NativeAnimatedNodesManager.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace facebook::react {
+
+static ExtrapolateType extrapolateTypeFromDynamic(
+    const folly::dynamic& value) {
+  if (value.isString()) {
+    const auto& string = value.getString();
+    if (string == "clamp") {
+      return ExtrapolateType::Clamp;
+    }
+    if (string == "identity") {
+      return ExtrapolateType::Identity;
+    }
+    if (string != "extend") {
+      LOG(ERROR) << "Invalid extrapolation type: " << string;
+    }
+  }
+  return ExtrapolateType::Extend;
+}
+
+static std::vector<double> numbersFromDynamic(const folly::dynamic& value) {
+  auto numbers = std::vector<double>{};
+  if (value.isArray()) {
+    numbers.reserve(value.size());
+    for (const auto& item : value) {
+      numbers.push_back(item.asDouble());
+    }
+  }
+  return numbers;
+}
+
+static std::vector<Tag> tagsFromDynamic(const folly::dynamic& value) {
+  auto tags = std::vector<Tag>{};
+  if (value.isArray()) {
+    tags.reserve(value.size());
+    for (const auto& item : value) {
+      tags.push_back(static_cast<Tag>(item.asInt()));
+    }
+  }
+  return tags;
+}
+
+double interpolateValue(
+    double value,
+    double inputMin,
+    double inputMax,
+    double outputMin,
+    double outputMax,
+    ExtrapolateType extrapolateLeft,
+    ExtrapolateType extrapolateRight) {
+  if (value < inputMin) {
+    if (extrapolateLeft == ExtrapolateType::Identity) {
+      return value;
+    }
+    if (extrapolateLeft == ExtrapolateType::Clamp) {
+      value = inputMin;
+    }
+  }
+
+  if (value > inputMax) {
+    if (extrapolateRight == ExtrapolateType::Identity) {
+      return value;
+    }
+    if (extrapolateRight == ExtrapolateType::Clamp) {
+      value = inputMax;
+    }
+  }
+
+  if (inputMin == inputMax) {
+    return value <= inputMin ? outputMin : outputMax;
+  }
+
+  return outputMin +
+      (value - inputMin) * (outputMax - outputMin) / (inputMax - inputMin);
+}
+
+double interpolateValueInRange(
+    double value,
+    const std::vector<double>& inputRange,
+    const std::vector<double>& outputRange,
+    ExtrapolateType extrapolateLeft,
+    ExtrapolateType extrapolateRight) {
+  react_native_assert(inputRange.size() >= 2);
+  react_native_assert(inputRange.size() == outputRange.size());
+
+  // Index of the segment of the input range containing the value, with values
+  // outside of the range falling into the first or the last segment.
+  auto rangeIndex = size_t{1};
+  while (rangeIndex < inputRange.size() - 1 && inputRange[rangeIndex] < value) {
+    rangeIndex++;
+  }
+  rangeIndex--;
+
+  return interpolateValue(
+      value,
+      inputRange[rangeIndex],
+      inputRange[rangeIndex + 1],
+      outputRange[rangeIndex],
+      outputRange[rangeIndex + 1],
+      extrapolateLeft,
+      extrapolateRight);
+}
+
+InterpolationAnimatedNode::InterpolationAnimatedNode(
+    Tag tag,
+    const folly::dynamic& config,
+    NativeAnimatedNodesManager& manager)
+    : ValueAnimatedNode(tag, config, manager),
+      inputRange_(numbersFromDynamic(config.getDefault("inputRange"))),
+      outputRange_(numbersFromDynamic(config.getDefault("outputRange"))),
+      extrapolateLeft_(
+          extrapolateTypeFromDynamic(config.getDefault("extrapolateLeft"))),
+      extrapolateRight_(
+          extrapolateTypeFromDynamic(config.getDefault("extrapolateRight"))) {
+  if (inputRange_.size() < 2 || inputRange_.size() != outputRange_.size()) {
+    LOG(ERROR) << "Animated.Interpolation node " << tag
+               << " needs numeric input and output ranges of the same size";
+    inputRange_.clear();
+    outputRange_.clear();
+  }
+}
+
+void InterpolationAnimatedNode::update() {
+  if (inputRange_.empty() || getParents().empty()) {
+    return;
+  }
+
+  auto parent = manager_.getNodeAs<ValueAnimatedNode>(getParents().front());
+  if (parent == nullptr) {
+    return;
+  }
+
+  setValue(interpolateValueInRange(
+      parent->getValue(),
+      inputRange_,
+      outputRange_,
+      extrapolateLeft_,
+      extrapolateRight_));
+}
+
+OperatorAnimatedNode::OperatorAnimatedNode(
+    Tag tag,
+    Operator op,
+    const folly::dynamic& config,
+    NativeAnimatedNodesManager& manager)
+    : ValueAnimatedNode(tag, config, manager),
+      operator_(op),
+      inputNodeTags_(tagsFromDynamic(config.getDefault("input"))) {}
+
+void OperatorAnimatedNode::update() {
+  auto inputValues = std::vector<double>{};
+  inputValues.reserve(inputNodeTags_.size());
+  for (auto inputNodeTag : inputNodeTags_) {
+    auto inputNode = manager_.getNodeAs<ValueAnimatedNode>(inputNodeTag);
+    if (inputNode == nullptr) {
+      // The graph is not fully connected yet.
+      return;
+    }
+    inputValues.push_back(inputNode->getValue());
+  }
+
+  if (inputValues.empty()) {
+    return;
+  }
+
+  auto value = inputValues.front();
+  for (auto it = inputValues.begin() + 1; it != inputValues.end(); ++it) {
+    switch (operator_) {
+      case Operator::Addition:
+        value += *it;
+        break;
+      case Operator::Subtraction:
+        value -= *it;
+        break;
+      case Operator::Multiplication:
+        value *= *it;
+        break;
+      case Operator::Division:
+        if (*it == 0) {
+          LOG(ERROR) << "Detected a division by zero in Animated.divide node "
+                     << tag_;
+          return;
+        }
+        value /= *it;
+        break;
+    }
+  }
+
+  setValue(value);
+}
+
+ModulusAnimatedNode::ModulusAnimatedNode(
+    Tag tag,
+    const folly::dynamic& config,
+    NativeAnimatedNodesManager& manager)
+    : ValueAnimatedNode(tag, config, manager),
+      inputNodeTag_(static_cast<Tag>(config.getDefault("input", 0).asInt())),
+      modulus_(config.getDefault("modulus", 1.0).asDouble()) {}
+
+void ModulusAnimatedNode::update() {
+  auto inputNode = manager_.getNodeAs<ValueAnimatedNode>(inputNodeTag_);
+  if (inputNode == nullptr || modulus_ == 0) {
+    return;
+  }
+
+  setValue(std::fmod(
+      std::fmod(inputNode->getValue(), modulus_) + modulus_, modulus_));
+}
+
+DiffClampAnimatedNode::DiffClampAnimatedNode(
+    Tag tag,
+    const folly::dynamic& config,
+    NativeAnimatedNodesManager& manager)
+    : ValueAnimatedNode(tag, config, manager),
+      inputNodeTag_(static_cast<Tag>(config.getDefault("input", 0).asInt())),
+      min_(config.getDefault("min", 0.0).asDouble()),
+      max_(config.getDefault("max", 0.0).asDouble()) {}
+
+void DiffClampAnimatedNode::update() {
+  auto inputNode = manager_.getNodeAs<ValueAnimatedNode>(inputNodeTag_);
+  if (inputNode == nullptr) {
+    return;
+  }
+
+  auto inputValue = inputNode->getValue();
+  if (!lastInputValue_) {
+    // The first input value is where the accumulation starts from.
+    lastInputValue_ = inputValue;
+    setValue(std::clamp(inputValue, min_, max_));
+    return;
+  }
+
+  auto diff = inputValue - *lastInputValue_;
+  lastInputValue_ = inputValue;
+  setValue(std::clamp(getValue() + diff, min_, max_));
+}
+
+} // namespace facebook::react
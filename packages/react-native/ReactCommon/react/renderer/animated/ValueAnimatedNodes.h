@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/animated/AnimatedNode.h>
+
+#include <optional>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Describes how `InterpolationAnimatedNode` maps input values outside of its
+ * input range.
+ */
+enum class ExtrapolateType { Extend, Clamp, Identity };
+
+/*
+ * Maps `value` linearly from `[inputMin, inputMax]` to
+ * `[outputMin, outputMax]`.
+ */
+double interpolateValue(
+    double value,
+    double inputMin,
+    double inputMax,
+    double outputMin,
+    double outputMax,
+    ExtrapolateType extrapolateLeft,
+    ExtrapolateType extrapolateRight);
+
+/*
+ * Maps `value` between the closest pair of points of `inputRange` to the
+ * corresponding points of `outputRange`. Both ranges must have the same size
+ * of at least two.
+ */
+double interpolateValueInRange(
+    double value,
+    const std::vector<double>& inputRange,
+    const std::vector<double>& outputRange,
+    ExtrapolateType extrapolateLeft,
+    ExtrapolateType extrapolateRight);
+
+/*
+ * `Animated.Interpolation` with a numeric output range.
+ */
+class InterpolationAnimatedNode final : public ValueAnimatedNode {
+ public:
+  InterpolationAnimatedNode(
+      Tag tag,
+      const folly::dynamic& config,
+      NativeAnimatedNodesManager& manager);
+
+  void update() override;
+
+ private:
+  std::vector<double> inputRange_;
+  std::vector<double> outputRange_;
+  ExtrapolateType extrapolateLeft_;
+  ExtrapolateType extrapolateRight_;
+};
+
+/*
+ * `Animated.add`, `Animated.subtract`, `Animated.multiply` and
+ * `Animated.divide`, applied from left to right to the values of the input
+ * nodes.
+ */
+class OperatorAnimatedNode final : public ValueAnimatedNode {
+ public:
+  enum class Operator { Addition, Subtraction, Multiplication, Division };
+
+  OperatorAnimatedNode(
+      Tag tag,
+      Operator op,
+      const folly::dynamic& config,
+      NativeAnimatedNodesManager& manager);
+
+  void update() override;
+
+ private:
+  const Operator operator_;
+  std::vector<Tag> inputNodeTags_;
+};
+
+/*
+ * `Animated.modulo`, which is always non-negative for a positive modulus.
+ */
+class ModulusAnimatedNode final : public ValueAnimatedNode {
+ public:
+  ModulusAnimatedNode(
+      Tag tag,
+      const folly::dynamic& config,
+      NativeAnimatedNodesManager& manager);
+
+  void update() override;
+
+ private:
+  Tag inputNodeTag_;
+  double modulus_;
+};
+
+/*
+ * `Animated.diffClamp`, which accumulates the changes of its input while
+ * keeping the result within `[min, max]`.
+ */
+class DiffClampAnimatedNode final : public ValueAnimatedNode {
+ public:
+  DiffClampAnimatedNode(
+      Tag tag,
+      const folly::dynamic& config,
+      NativeAnimatedNodesManager& manager);
+
+  void update() override;
+
+ private:
+  Tag inputNodeTag_;
+  double min_;
+  double max_;
+  std::optional<double> lastInputValue_;
+};
+
+} // namespace facebook::react
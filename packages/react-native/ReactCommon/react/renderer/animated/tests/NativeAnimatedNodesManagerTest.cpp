@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/animated/NativeAnimatedNodesManager.h>
+
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook::react {
+
+class NativeAnimatedNodesManagerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    manager_ = std::make_unique<NativeAnimatedNodesManager>(
+        [this](Tag viewTag, const folly::dynamic& props) {
+          appliedProps_.push_back({viewTag, props});
+        },
+        [this](const std::unordered_map<Tag, folly::dynamic>& propsByViewTag) {
+          committedProps_.push_back(propsByViewTag);
+        },
+        [this]() { isRendering_ = true; },
+        [this]() { isRendering_ = false; });
+  }
+
+  // Creates `value (1) -> style (2) -> props (3)`, connected to view 100.
+  void createOpacityGraph(double value) {
+    manager_->createAnimatedNode(
+        1, folly::dynamic::object("type", "value")("value", value));
+    manager_->createAnimatedNode(
+        2,
+        folly::dynamic::object("type", "style")(
+            "style", folly::dynamic::object("opacity", 1)));
+    manager_->createAnimatedNode(
+        3,
+        folly::dynamic::object("type", "props")(
+            "props", folly::dynamic::object("style", 2)));
+    manager_->connectAnimatedNodes(1, 2);
+    manager_->connectAnimatedNodes(2, 3);
+    manager_->connectAnimatedNodeToView(3, 100);
+  }
+
+  void renderFrame() {
+    manager_->onAnimationFrame(time_);
+    // Slightly longer than a frame of the 60 fps timeline of `frames`.
+    time_ += 0.017;
+  }
+
+  std::optional<double> lastAppliedValue(const std::string& prop) const {
+    if (appliedProps_.empty()) {
+      return std::nullopt;
+    }
+    return appliedProps_.back().props[prop].asDouble();
+  }
+
+  struct AppliedProps {
+    Tag viewTag;
+    folly::dynamic props;
+  };
+
+  std::unique_ptr<NativeAnimatedNodesManager> manager_;
+  std::vector<AppliedProps> appliedProps_;
+  std::vector<std::unordered_map<Tag, folly::dynamic>> committedProps_;
+  bool isRendering_{false};
+  double time_{1000};
+};
+
+TEST_F(NativeAnimatedNodesManagerTest, appliesGraphChangesOnNextFrame) {
+  createOpacityGraph(0.5);
+  EXPECT_TRUE(isRendering_);
+  EXPECT_TRUE(appliedProps_.empty());
+
+  renderFrame();
+  ASSERT_EQ(appliedProps_.size(), 1);
+  EXPECT_EQ(appliedProps_[0].viewTag, 100);
+  EXPECT_EQ(lastAppliedValue("opacity"), 0.5);
+
+  // The graph settled, so its props are committed and frames are not needed
+  // anymore.
+  EXPECT_FALSE(isRendering_);
+  ASSERT_EQ(committedProps_.size(), 1);
+  EXPECT_EQ(committedProps_[0].at(100)["opacity"].asDouble(), 0.5);
+}
+
+TEST_F(NativeAnimatedNodesManagerTest, runsFramesAnimation) {
+  createOpacityGraph(0);
+  renderFrame();
+  appliedProps_.clear();
+  committedProps_.clear();
+
+  auto endResult = std::optional<std::pair<bool, double>>{};
+  manager_->startAnimatingNode(
+      1,
+      1,
+      folly::dynamic::object("type", "frames")(
+          "frames", folly::dynamic::array(0, 0.25, 0.5, 0.75, 1))("toValue", 2),
+      [&](bool finished, double value) { endResult = {finished, value}; });
+  EXPECT_TRUE(isRendering_);
+
+  for (auto expectedValue : {0.0, 0.5, 1.0, 1.5}) {
+    renderFrame();
+    EXPECT_NEAR(*lastAppliedValue("opacity"), expectedValue, 0.05);
+    EXPECT_TRUE(committedProps_.empty());
+  }
+
+  renderFrame();
+  EXPECT_EQ(lastAppliedValue("opacity"), 2);
+  ASSERT_TRUE(endResult.has_value());
+  EXPECT_TRUE(endResult->first);
+  EXPECT_EQ(endResult->second, 2);
+  EXPECT_FALSE(manager_->isAnimating());
+  EXPECT_FALSE(isRendering_);
+  ASSERT_EQ(committedProps_.size(), 1);
+  EXPECT_EQ(committedProps_[0].at(100)["opacity"].asDouble(), 2);
+}
+
+TEST_F(NativeAnimatedNodesManagerTest, runsSpringAnimationToRest) {
+  createOpacityGraph(0);
+  renderFrame();
+
+  auto finished = std::optional<bool>{};
+  manager_->startAnimatingNode(
+      1,
+      1,
+      folly::dynamic::object("type", "spring")("toValue", 1)("stiffness", 100)(
+          "damping", 10)("mass", 1)("initialVelocity", 0)(
+          "overshootClamping", false)("restDisplacementThreshold", 0.001)(
+          "restSpeedThreshold", 0.001),
+      [&](bool isFinished, double /*value*/) { finished = isFinished; });
+
+  auto maxValue = 0.0;
+  for (int i = 0; i < 600 && manager_->isAnimating(); i++) {
+    renderFrame();
+    maxValue = std::max(maxValue, *lastAppliedValue("opacity"));
+  }
+
+  EXPECT_EQ(finished, true);
+  // An under damped spring overshoots its target before coming to rest at it.
+  EXPECT_GT(maxValue, 1);
+  EXPECT_EQ(manager_->getValue(1), 1);
+  EXPECT_EQ(lastAppliedValue("opacity"), 1);
+}
+
+TEST_F(NativeAnimatedNodesManagerTest, runsDecayAnimationToRest) {
+  createOpacityGraph(0);
+  renderFrame();
+
+  auto finished = false;
+  manager_->startAnimatingNode(
+      1,
+      1,
+      folly::dynamic::object("type", "decay")("velocity", 1)(
+          "deceleration", 0.99),
+      [&](bool isFinished, double /*value*/) { finished = isFinished; });
+
+  auto lastValue = 0.0;
+  for (int i = 0; i < 600 && manager_->isAnimating(); i++) {
+    renderFrame();
+    auto value = *manager_->getValue(1);
+    EXPECT_GE(value, lastValue);
+    lastValue = value;
+  }
+
+  EXPECT_TRUE(finished);
+  // Decays towards `velocity / (1 - deceleration)`.
+  EXPECT_NEAR(lastValue, 100, 10);
+}
+
+TEST_F(NativeAnimatedNodesManagerTest, stopsAnimationWhenValueIsSet) {
+  createOpacityGraph(0);
+  renderFrame();
+
+  auto finished = std::optional<bool>{};
+  manager_->startAnimatingNode(
+      1,
+      1,
+      folly::dynamic::object("type", "frames")(
+          "frames", folly::dynamic::array(0, 0.5, 1))("toValue", 1),
+      [&](bool isFinished, double /*value*/) { finished = isFinished; });
+  renderFrame();
+
+  manager_->setAnimatedNodeValue(1, 0.25);
+  EXPECT_EQ(finished, false);
+  EXPECT_FALSE(manager_->isAnimating());
+
+  renderFrame();
+  EXPECT_EQ(lastAppliedValue("opacity"), 0.25);
+}
+
+TEST_F(NativeAnimatedNodesManagerTest, updatesDependentNodesAfterParents) {
+  // value (1) -> interpolation (4) -> addition (5) <- value (1), and
+  // addition (5) -> style (2) -> props (3).
+  manager_->createAnimatedNode(
+      1, folly::dynamic::object("type", "value")("value", 0));
+  manager_->createAnimatedNode(
+      2,
+      folly::dynamic::object("type", "style")(
+          "style", folly::dynamic::object("translateY", 5)));
+  manager_->createAnimatedNode(
+      3,
+      folly::dynamic::object("type", "props")(
+          "props", folly::dynamic::object("style", 2)));
+  manager_->createAnimatedNode(
+      4,
+      folly::dynamic::object("type", "interpolation")(
+          "inputRange", folly::dynamic::array(0, 1))(
+          "outputRange", folly::dynamic::array(0, 100))(
+          "extrapolateLeft", "clamp")("extrapolateRight", "clamp"));
+  manager_->createAnimatedNode(
+      5,
+      folly::dynamic::object("type", "addition")(
+          "input", folly::dynamic::array(4, 1)));
+  manager_->connectAnimatedNodes(5, 2);
+  manager_->connectAnimatedNodes(2, 3);
+  manager_->connectAnimatedNodes(4, 5);
+  manager_->connectAnimatedNodes(1, 5);
+  manager_->connectAnimatedNodes(1, 4);
+  manager_->connectAnimatedNodeToView(3, 100);
+  renderFrame();
+  EXPECT_EQ(lastAppliedValue("translateY"), 0);
+
+  manager_->setAnimatedNodeValue(1, 0.5);
+  renderFrame();
+  EXPECT_EQ(lastAppliedValue("translateY"), 50.5);
+
+  manager_->setAnimatedNodeValue(1, 2);
+  renderFrame();
+  EXPECT_EQ(lastAppliedValue("translateY"), 102);
+}
+
+TEST_F(NativeAnimatedNodesManagerTest, appliesTransforms) {
+  manager_->createAnimatedNode(
+      1, folly::dynamic::object("type", "value")("value", 10));
+  manager_->createAnimatedNode(
+      2,
+      folly::dynamic::object("type", "transform")(
+          "transforms",
+          folly::dynamic::array(
+              folly::dynamic::object("type", "animated")(
+                  "property", "translateX")("nodeTag", 1),
+              folly::dynamic::object("type", "static")("property", "scale")(
+                  "value", 2))));
+  manager_->createAnimatedNode(
+      3,
+      folly::dynamic::object("type", "style")(
+          "style", folly::dynamic::object("transform", 2)));
+  manager_->createAnimatedNode(
+      4,
+      folly::dynamic::object("type", "props")(
+          "props", folly::dynamic::object("style", 3)));
+  manager_->connectAnimatedNodes(1, 2);
+  manager_->connectAnimatedNodes(2, 3);
+  manager_->connectAnimatedNodes(3, 4);
+  manager_->connectAnimatedNodeToView(4, 100);
+  renderFrame();
+
+  ASSERT_EQ(appliedProps_.size(), 1);
+  const auto& transform = appliedProps_[0].props["transform"];
+  ASSERT_EQ(transform.size(), 2);
+  EXPECT_EQ(transform[0]["translateX"].asDouble(), 10);
+  EXPECT_EQ(transform[1]["scale"].asDouble(), 2);
+}
+
+TEST_F(NativeAnimatedNodesManagerTest, appliesAnimatedEventsSynchronously) {
+  createOpacityGraph(0);
+  renderFrame();
+  committedProps_.clear();
+
+  manager_->addAnimatedEventToView(
+      100,
+      "onScroll",
+      folly::dynamic::object("animatedValueTag", 1)(
+          "nativeEventPath", folly::dynamic::array("contentOffset", "y")));
+
+  auto payload = folly::dynamic::object(
+      "contentOffset", folly::dynamic::object("x", 0)("y", 0.75));
+  EXPECT_FALSE(manager_->handleAnimatedEvent(100, "topLayout", payload));
+  EXPECT_FALSE(manager_->handleAnimatedEvent(101, "topScroll", payload));
+
+  EXPECT_TRUE(manager_->handleAnimatedEvent(100, "topScroll", payload));
+  EXPECT_EQ(lastAppliedValue("opacity"), 0.75);
+  ASSERT_EQ(committedProps_.size(), 1);
+  EXPECT_EQ(committedProps_[0].at(100)["opacity"].asDouble(), 0.75);
+
+  manager_->removeAnimatedEventFromView(100, "onScroll", 1);
+  EXPECT_FALSE(manager_->handleAnimatedEvent(100, "topScroll", payload));
+}
+
+} // namespace facebook::react
@@ -10,7 +10,10 @@
 #include <glog/logging.h>
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/animations/utils.h>
+#include <react/renderer/components/view/ViewPropsInterpolation.h>
 #include <algorithm>
+#include <utility>
+#include <vector>
 
 namespace facebook::react {
 
@@ -26,33 +29,76 @@ void LayoutAnimationDriver::animationMutationsForFrame(
       continue;
     }
 
-    int incompleteAnimations = 0;
-    for (auto& keyframe : animation.keyFrames) {
-      if (keyframe.invalidated) {
+    // Keyframes with the same configuration type share the same progress, so
+    // their frames are interpolated in one batch per type.
+    const auto& layoutAnimationConfig = animation.layoutAnimationConfig;
+    auto& keyFrames = animation.keyFrames;
+    std::vector<Rect> interpolatedFrames(keyFrames.size());
+    std::vector<std::pair<Float, Float>> keyFrameProgress(keyFrames.size());
+    std::vector<size_t> keyFrameIndices{};
+    std::vector<Rect> startFrames{};
+    std::vector<Rect> endFrames{};
+    std::vector<Rect> batchFrames{};
+    for (auto type :
+         {AnimationConfigurationType::Create,
+          AnimationConfigurationType::Update,
+          AnimationConfigurationType::Delete}) {
+      keyFrameIndices.clear();
+      startFrames.clear();
+      endFrames.clear();
+      for (size_t i = 0; i < keyFrames.size(); i++) {
+        const auto& keyframe = keyFrames[i];
+        if (keyframe.invalidated || keyframe.type != type) {
+          continue;
+        }
+        keyFrameIndices.push_back(i);
+        startFrames.push_back(keyframe.viewStart.layoutMetrics.frame);
+        endFrames.push_back(keyframe.viewEnd.layoutMetrics.frame);
+      }
+      if (keyFrameIndices.empty()) {
         continue;
       }
 
-      const auto& baselineShadowView = keyframe.viewStart;
-      const auto& finalShadowView = keyframe.viewEnd;
-
-      // The contract with the "keyframes generation" phase is that any animated
-      // node will have a valid configuration.
-      const auto layoutAnimationConfig = animation.layoutAnimationConfig;
+      // The contract with the "keyframes generation" phase is that any
+      // animated node will have a valid configuration.
       const auto& mutationConfig =
-          (keyframe.type == AnimationConfigurationType::Delete
+          (type == AnimationConfigurationType::Delete
                ? layoutAnimationConfig.deleteConfig
-               : (keyframe.type == AnimationConfigurationType::Create
+               : (type == AnimationConfigurationType::Create
                       ? layoutAnimationConfig.createConfig
                       : layoutAnimationConfig.updateConfig));
-
-      // Interpolate
       auto progress =
           calculateAnimationProgress(now, animation, mutationConfig);
-      auto animationTimeProgressLinear = progress.first;
-      auto animationInterpolationFactor = progress.second;
+
+      batchFrames.resize(keyFrameIndices.size());
+      interpolateFrames(
+          progress.second,
+          startFrames.data(),
+          endFrames.data(),
+          batchFrames.data(),
+          keyFrameIndices.size());
+      for (size_t i = 0; i < keyFrameIndices.size(); i++) {
+        interpolatedFrames[keyFrameIndices[i]] = batchFrames[i];
+        keyFrameProgress[keyFrameIndices[i]] = progress;
+      }
+    }
+
+    int incompleteAnimations = 0;
+    for (size_t i = 0; i < keyFrames.size(); i++) {
+      auto& keyframe = keyFrames[i];
+      if (keyframe.invalidated) {
+        continue;
+      }
+
+      // Interpolate
+      auto animationTimeProgressLinear = keyFrameProgress[i].first;
+      auto animationInterpolationFactor = keyFrameProgress[i].second;
 
       auto mutatedShadowView = createInterpolatedShadowView(
-          animationInterpolationFactor, baselineShadowView, finalShadowView);
+          animationInterpolationFactor,
+          keyframe.viewStart,
+          keyframe.viewEnd,
+          interpolatedFrames[i]);
 
       // Create the mutation instruction
       mutationsList.emplace_back(ShadowViewMutation::UpdateMutation(
@@ -93,6 +139,7 @@ void LayoutAnimationDriver::animationMutationsForFrame(
       }
 
       it = inflightAnimations_.erase(it);
+      invalidateKeyFrameIndex();
     } else {
       it++;
     }
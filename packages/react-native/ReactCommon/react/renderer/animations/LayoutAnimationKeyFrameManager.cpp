@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <sstream>
+#include <tuple>
 #include <utility>
 
 #include <react/debug/flags.h>
@@ -74,11 +75,6 @@ void PrintMutationInstructionRelative(
 }
 #endif
 
-static inline Float
-interpolateFloats(Float coefficient, Float oldValue, Float newValue) {
-  return oldValue + (newValue - oldValue) * coefficient;
-}
-
 #pragma mark -
 
 LayoutAnimationKeyFrameManager::LayoutAnimationKeyFrameManager(
@@ -802,6 +798,9 @@ LayoutAnimationKeyFrameManager::pullTransaction(
 
       animation.keyFrames = keyFramesToAnimate;
       inflightAnimations_.push_back(std::move(animation));
+      if (keyFrameIndex_) {
+        addAnimationToKeyFrameIndex(inflightAnimations_.size() - 1);
+      }
 
       // At this point, we have the following information and knowledge graph:
       // Knowledge Graph:
@@ -1081,7 +1080,8 @@ LayoutAnimationKeyFrameManager::getComponentDescriptorForShadowView(
 ShadowView LayoutAnimationKeyFrameManager::createInterpolatedShadowView(
     Float progress,
     const ShadowView& startingView,
-    const ShadowView& finalView) const {
+    const ShadowView& finalView,
+    const Rect& interpolatedFrame) const {
   react_native_assert(startingView.tag > 0);
   react_native_assert(finalView.tag > 0);
   if (!hasComponentDescriptorForShadowView(startingView)) {
@@ -1125,31 +1125,26 @@ ShadowView LayoutAnimationKeyFrameManager::createInterpolatedShadowView(
     return finalView;
   }
 
-  // Interpolate LayoutMetrics
-  const LayoutMetrics& finalLayoutMetrics = finalView.layoutMetrics;
-  const LayoutMetrics& baselineLayoutMetrics = startingView.layoutMetrics;
-  LayoutMetrics interpolatedLayoutMetrics = finalLayoutMetrics;
-  interpolatedLayoutMetrics.frame.origin.x = interpolateFloats(
-      progress,
-      baselineLayoutMetrics.frame.origin.x,
-      finalLayoutMetrics.frame.origin.x);
-  interpolatedLayoutMetrics.frame.origin.y = interpolateFloats(
-      progress,
-      baselineLayoutMetrics.frame.origin.y,
-      finalLayoutMetrics.frame.origin.y);
-  interpolatedLayoutMetrics.frame.size.width = interpolateFloats(
-      progress,
-      baselineLayoutMetrics.frame.size.width,
-      finalLayoutMetrics.frame.size.width);
-  interpolatedLayoutMetrics.frame.size.height = interpolateFloats(
-      progress,
-      baselineLayoutMetrics.frame.size.height,
-      finalLayoutMetrics.frame.size.height);
-  mutatedShadowView.layoutMetrics = interpolatedLayoutMetrics;
+  mutatedShadowView.layoutMetrics.frame = interpolatedFrame;
 
   return mutatedShadowView;
 }
 
+ShadowView LayoutAnimationKeyFrameManager::createInterpolatedShadowView(
+    Float progress,
+    const ShadowView& startingView,
+    const ShadowView& finalView) const {
+  Rect interpolatedFrame;
+  interpolateFrames(
+      progress,
+      &startingView.layoutMetrics.frame,
+      &finalView.layoutMetrics.frame,
+      &interpolatedFrame,
+      1);
+  return createInterpolatedShadowView(
+      progress, startingView, finalView, interpolatedFrame);
+}
+
 void LayoutAnimationKeyFrameManager::callCallback(
     const LayoutAnimationCallbackWrapper& callback) const {
   runtimeExecutor_(
@@ -1289,11 +1284,43 @@ void LayoutAnimationKeyFrameManager::
   // mutation.
   std::vector<const ShadowViewMutation*> candidateMutations{};
 
-  for (auto inflightAnimationIt =
-           inflightAnimations_.rbegin() + (skipLastAnimation ? 1 : 0);
-       inflightAnimationIt != inflightAnimations_.rend();
-       inflightAnimationIt++) {
-    auto& inflightAnimation = *inflightAnimationIt;
+  // Only delayed mutations of the same parent can change the index.
+  const auto& keyFrameIndex = getKeyFrameIndex();
+  auto keyFramesIt =
+      keyFrameIndex.byParentTag.find(mutation.parentShadowView.tag);
+  if (keyFramesIt == keyFrameIndex.byParentTag.end()) {
+    return;
+  }
+
+  std::optional<size_t> onlyAnimationIndex{};
+  if (lastAnimationOnly) {
+    for (auto animationIndex =
+             inflightAnimations_.size() - (skipLastAnimation ? 1 : 0);
+         animationIndex > 0;
+         animationIndex--) {
+      const auto& inflightAnimation = inflightAnimations_[animationIndex - 1];
+      if (inflightAnimation.surfaceId == surfaceId &&
+          !inflightAnimation.completed) {
+        onlyAnimationIndex = animationIndex - 1;
+        break;
+      }
+    }
+    if (!onlyAnimationIndex) {
+      return;
+    }
+  }
+
+  for (const auto& location : keyFramesIt->second) {
+    if (skipLastAnimation &&
+        location.animationIndex == inflightAnimations_.size() - 1) {
+      continue;
+    }
+    if (onlyAnimationIndex && location.animationIndex != *onlyAnimationIndex) {
+      continue;
+    }
+
+    const auto& inflightAnimation =
+        inflightAnimations_[location.animationIndex];
     if (inflightAnimation.surfaceId != surfaceId) {
       continue;
     }
@@ -1301,41 +1328,33 @@ void LayoutAnimationKeyFrameManager::
       continue;
     }
 
-    for (const auto& animatedKeyFrame : inflightAnimation.keyFrames) {
-      if (animatedKeyFrame.invalidated) {
+    const auto& animatedKeyFrame =
+        inflightAnimation.keyFrames[location.keyFrameIndex];
+    if (animatedKeyFrame.invalidated) {
+      continue;
+    }
+
+    // The keyframe is in the same view hierarchy, but not equivalent.
+    // We've already detected direct conflicts and removed them.
+    for (const auto& delayedMutation :
+         animatedKeyFrame.finalMutationsForKeyFrame) {
+      if (delayedMutation.type != ShadowViewMutation::Type::Remove) {
         continue;
       }
-
-      // Detect if they're in the same view hierarchy, but not equivalent
-      // We've already detected direct conflicts and removed them.
-      if (animatedKeyFrame.parentView.tag != mutation.parentShadowView.tag) {
+      if (delayedMutation.mutatedViewIsVirtual()) {
         continue;
       }
-
-      for (const auto& delayedMutation :
-           animatedKeyFrame.finalMutationsForKeyFrame) {
-        if (delayedMutation.type != ShadowViewMutation::Type::Remove) {
-          continue;
-        }
-        if (delayedMutation.mutatedViewIsVirtual()) {
-          continue;
-        }
-        if (delayedMutation.oldChildShadowView.tag ==
-            (isRemoveMutation ? mutation.oldChildShadowView.tag
-                              : mutation.newChildShadowView.tag)) {
-          continue;
-        }
-
-        PrintMutationInstructionRelative(
-            "[IndexAdjustment] adjustImmediateMutationIndicesForDelayedMutations CANDIDATE for:",
-            mutation,
-            delayedMutation);
-        candidateMutations.push_back(&delayedMutation);
+      if (delayedMutation.oldChildShadowView.tag ==
+          (isRemoveMutation ? mutation.oldChildShadowView.tag
+                            : mutation.newChildShadowView.tag)) {
+        continue;
       }
-    }
 
-    if (lastAnimationOnly) {
-      break;
+      PrintMutationInstructionRelative(
+          "[IndexAdjustment] adjustImmediateMutationIndicesForDelayedMutations CANDIDATE for:",
+          mutation,
+          delayedMutation);
+      candidateMutations.push_back(&delayedMutation);
     }
   }
 
@@ -1393,12 +1412,21 @@ void LayoutAnimationKeyFrameManager::adjustDelayedMutationIndicesForMutation(
   // mutation.
   std::vector<ShadowViewMutation*> candidateMutations{};
 
-  for (auto inflightAnimationIt =
-           inflightAnimations_.rbegin() + (skipLastAnimation ? 1 : 0);
-       inflightAnimationIt != inflightAnimations_.rend();
-       inflightAnimationIt++) {
-    auto& inflightAnimation = *inflightAnimationIt;
+  // Only delayed mutations of the same parent can be affected.
+  const auto& keyFrameIndex = getKeyFrameIndex();
+  auto keyFramesIt =
+      keyFrameIndex.byParentTag.find(mutation.parentShadowView.tag);
+  if (keyFramesIt == keyFrameIndex.byParentTag.end()) {
+    return;
+  }
 
+  for (const auto& location : keyFramesIt->second) {
+    if (skipLastAnimation &&
+        location.animationIndex == inflightAnimations_.size() - 1) {
+      continue;
+    }
+
+    auto& inflightAnimation = inflightAnimations_[location.animationIndex];
     if (inflightAnimation.surfaceId != surfaceId) {
       continue;
     }
@@ -1406,36 +1434,32 @@ void LayoutAnimationKeyFrameManager::adjustDelayedMutationIndicesForMutation(
       continue;
     }
 
-    for (auto& animatedKeyFrame : inflightAnimation.keyFrames) {
-      if (animatedKeyFrame.invalidated) {
+    auto& animatedKeyFrame =
+        inflightAnimation.keyFrames[location.keyFrameIndex];
+    if (animatedKeyFrame.invalidated) {
+      continue;
+    }
+
+    // The keyframe is in the same view hierarchy, but not equivalent.
+    // (We've already detected direct conflicts and handled them above)
+    for (auto& finalAnimationMutation :
+         animatedKeyFrame.finalMutationsForKeyFrame) {
+      if (finalAnimationMutation.oldChildShadowView.tag == tag) {
         continue;
       }
 
-      // Detect if they're in the same view hierarchy, but not equivalent
-      // (We've already detected direct conflicts and handled them above)
-      if (animatedKeyFrame.parentView.tag != mutation.parentShadowView.tag) {
+      if (finalAnimationMutation.type != ShadowViewMutation::Type::Remove) {
         continue;
       }
-
-      for (auto& finalAnimationMutation :
-           animatedKeyFrame.finalMutationsForKeyFrame) {
-        if (finalAnimationMutation.oldChildShadowView.tag == tag) {
-          continue;
-        }
-
-        if (finalAnimationMutation.type != ShadowViewMutation::Type::Remove) {
-          continue;
-        }
-        if (finalAnimationMutation.mutatedViewIsVirtual()) {
-          continue;
-        }
-
-        PrintMutationInstructionRelative(
-            "[IndexAdjustment] adjustDelayedMutationIndicesForMutation: CANDIDATE:",
-            mutation,
-            finalAnimationMutation);
-        candidateMutations.push_back(&finalAnimationMutation);
+      if (finalAnimationMutation.mutatedViewIsVirtual()) {
+        continue;
       }
+
+      PrintMutationInstructionRelative(
+          "[IndexAdjustment] adjustDelayedMutationIndicesForMutation: CANDIDATE:",
+          mutation,
+          finalAnimationMutation);
+      candidateMutations.push_back(&finalAnimationMutation);
     }
   }
 
@@ -1489,101 +1513,167 @@ void LayoutAnimationKeyFrameManager::getAndEraseConflictingAnimations(
     SurfaceId surfaceId,
     const ShadowViewMutationList& mutations,
     std::vector<AnimationKeyFrame>& conflictingAnimations) const {
+  const auto& keyFrameIndex = getKeyFrameIndex();
+
+  // Conflicting keyframes are marked as invalidated while looking for
+  // conflicts, and erased at the end, so that the locations in the index stay
+  // valid until then.
+  bool keyFramesInvalidated = false;
+  std::vector<KeyFrameLocation> locations{};
   ShadowViewMutationList localConflictingMutations{};
-  for (const auto& mutation : mutations) {
-    if (mutation.type == ShadowViewMutation::Type::RemoveDeleteTree) {
-      continue;
-    }
+  ShadowViewMutationList nextConflictingMutations{};
+  const ShadowViewMutationList* currentMutations = &mutations;
 
-    bool mutationIsCreateOrDelete =
-        mutation.type == ShadowViewMutation::Type::Create ||
-        mutation.type == ShadowViewMutation::Type::Delete;
-    const auto& baselineShadowView =
-        (mutation.type == ShadowViewMutation::Type::Insert ||
-         mutation.type == ShadowViewMutation::Type::Create)
-        ? mutation.newChildShadowView
-        : mutation.oldChildShadowView;
-    auto baselineTag = baselineShadowView.tag;
-
-    for (auto& inflightAnimation : inflightAnimations_) {
-      if (inflightAnimation.surfaceId != surfaceId) {
+  while (!currentMutations->empty()) {
+    for (const auto& mutation : *currentMutations) {
+      if (mutation.type == ShadowViewMutation::Type::RemoveDeleteTree) {
         continue;
       }
-      if (inflightAnimation.completed) {
-        continue;
+
+      bool mutationIsCreateOrDelete =
+          mutation.type == ShadowViewMutation::Type::Create ||
+          mutation.type == ShadowViewMutation::Type::Delete;
+      const auto& baselineShadowView =
+          (mutation.type == ShadowViewMutation::Type::Insert ||
+           mutation.type == ShadowViewMutation::Type::Create)
+          ? mutation.newChildShadowView
+          : mutation.oldChildShadowView;
+      auto baselineTag = baselineShadowView.tag;
+
+      // A conflict is when either: the animated node itself is mutated
+      // directly; or, the parent of the node is created or deleted. In cases
+      // of reparenting - say, the parent is deleted but the node was moved to
+      // a different parent first - the reparenting (remove/insert) conflict
+      // will be detected before we process the parent DELETE.
+      // Parent deletion is important because deleting a parent recursively
+      // deletes all children. If we previously deferred deletion of a child,
+      // we need to force deletion/removal to happen immediately.
+      locations.clear();
+      auto byTagIt = keyFrameIndex.byTag.find(baselineTag);
+      if (byTagIt != keyFrameIndex.byTag.end()) {
+        locations = byTagIt->second;
+      }
+      if (mutationIsCreateOrDelete && baselineTag != 0) {
+        auto byParentTagIt = keyFrameIndex.byParentTag.find(baselineTag);
+        if (byParentTagIt != keyFrameIndex.byParentTag.end()) {
+          locations.insert(
+              locations.end(),
+              byParentTagIt->second.begin(),
+              byParentTagIt->second.end());
+          // Keep the order of `inflightAnimations_` and their keyframes.
+          std::sort(
+              locations.begin(),
+              locations.end(),
+              [](const KeyFrameLocation& lhs, const KeyFrameLocation& rhs) {
+                return std::tie(lhs.animationIndex, lhs.keyFrameIndex) <
+                    std::tie(rhs.animationIndex, rhs.keyFrameIndex);
+              });
+        }
       }
 
-      for (auto it = inflightAnimation.keyFrames.begin();
-           it != inflightAnimation.keyFrames.end();) {
-        auto& animatedKeyFrame = *it;
+      for (const auto& location : locations) {
+        auto& inflightAnimation = inflightAnimations_[location.animationIndex];
+        if (inflightAnimation.surfaceId != surfaceId) {
+          continue;
+        }
+        if (inflightAnimation.completed) {
+          continue;
+        }
 
+        auto& animatedKeyFrame =
+            inflightAnimation.keyFrames[location.keyFrameIndex];
         if (animatedKeyFrame.invalidated) {
           continue;
         }
 
-        // A conflict is when either: the animated node itself is mutated
-        // directly; or, the parent of the node is created or deleted. In cases
-        // of reparenting - say, the parent is deleted but the node was moved to
-        // a different parent first - the reparenting (remove/insert) conflict
-        // will be detected before we process the parent DELETE.
-        // Parent deletion is important because deleting a parent recursively
-        // deletes all children. If we previously deferred deletion of a child,
-        // we need to force deletion/removal to happen immediately.
-        bool conflicting = animatedKeyFrame.tag == baselineTag ||
-            (mutationIsCreateOrDelete &&
-             animatedKeyFrame.parentView.tag == baselineTag &&
-             animatedKeyFrame.parentView.tag != 0);
-
         // Conflicting animation detected: if we're mutating a tag under
         // animation, or deleting the parent of a tag under animation, or
         // reparenting.
-        if (conflicting) {
-          animatedKeyFrame.invalidated = true;
-
-          // We construct a list of all conflicting animations, whether or not
-          // they have a "final mutation" to execute. This is important with,
-          // for example, "insert" mutations where the final update needs to set
-          // opacity to "1", even if there's no final ShadowNode update.
-          // TODO: don't animate virtual views in the first place?
-          bool isVirtual = false;
-          for (const auto& finalMutationForKeyFrame :
-               animatedKeyFrame.finalMutationsForKeyFrame) {
-            isVirtual =
-                isVirtual || finalMutationForKeyFrame.mutatedViewIsVirtual();
+        animatedKeyFrame.invalidated = true;
+        keyFramesInvalidated = true;
+
+        // We construct a list of all conflicting animations, whether or not
+        // they have a "final mutation" to execute. This is important with,
+        // for example, "insert" mutations where the final update needs to set
+        // opacity to "1", even if there's no final ShadowNode update.
+        // TODO: don't animate virtual views in the first place?
+        bool isVirtual = false;
+        for (const auto& finalMutationForKeyFrame :
+             animatedKeyFrame.finalMutationsForKeyFrame) {
+          isVirtual =
+              isVirtual || finalMutationForKeyFrame.mutatedViewIsVirtual();
 
 #ifdef LAYOUT_ANIMATION_VERBOSE_LOGGING
-            PrintMutationInstructionRelative(
-                "Found mutation that conflicts with existing in-flight animation:",
-                mutation,
-                finalMutationForKeyFrame);
+          PrintMutationInstructionRelative(
+              "Found mutation that conflicts with existing in-flight animation:",
+              mutation,
+              finalMutationForKeyFrame);
 #endif
-          }
+        }
 
-          conflictingAnimations.push_back(animatedKeyFrame);
-          for (const auto& finalMutationForKeyFrame :
-               animatedKeyFrame.finalMutationsForKeyFrame) {
-            if (!isVirtual ||
-                finalMutationForKeyFrame.type ==
-                    ShadowViewMutation::Type::Delete) {
-              localConflictingMutations.push_back(finalMutationForKeyFrame);
-            }
+        conflictingAnimations.push_back(animatedKeyFrame);
+        for (const auto& finalMutationForKeyFrame :
+             animatedKeyFrame.finalMutationsForKeyFrame) {
+          if (!isVirtual ||
+              finalMutationForKeyFrame.type ==
+                  ShadowViewMutation::Type::Delete) {
+            nextConflictingMutations.push_back(finalMutationForKeyFrame);
           }
-
-          // Delete from existing animation
-          it = inflightAnimation.keyFrames.erase(it);
-        } else {
-          it++;
         }
       }
     }
+
+    // Repeat, in case conflicting mutations conflict with other existing
+    // animations
+    std::swap(localConflictingMutations, nextConflictingMutations);
+    nextConflictingMutations.clear();
+    currentMutations = &localConflictingMutations;
   }
 
-  // Recurse, in case conflicting mutations conflict with other existing
-  // animations
-  if (!localConflictingMutations.empty()) {
-    getAndEraseConflictingAnimations(
-        surfaceId, localConflictingMutations, conflictingAnimations);
+  if (!keyFramesInvalidated) {
+    return;
+  }
+
+  // Delete conflicting keyframes from existing animations
+  for (auto& inflightAnimation : inflightAnimations_) {
+    auto& keyFrames = inflightAnimation.keyFrames;
+    keyFrames.erase(
+        std::remove_if(
+            keyFrames.begin(),
+            keyFrames.end(),
+            [](const AnimationKeyFrame& keyFrame) {
+              return keyFrame.invalidated;
+            }),
+        keyFrames.end());
   }
+  invalidateKeyFrameIndex();
+}
+
+const LayoutAnimationKeyFrameManager::KeyFrameIndex&
+LayoutAnimationKeyFrameManager::getKeyFrameIndex() const {
+  if (!keyFrameIndex_) {
+    keyFrameIndex_ = KeyFrameIndex{};
+    for (size_t i = 0; i < inflightAnimations_.size(); i++) {
+      addAnimationToKeyFrameIndex(i);
+    }
+  }
+  return *keyFrameIndex_;
+}
+
+void LayoutAnimationKeyFrameManager::addAnimationToKeyFrameIndex(
+    size_t animationIndex) const {
+  react_native_assert(keyFrameIndex_.has_value());
+  const auto& keyFrames = inflightAnimations_[animationIndex].keyFrames;
+  for (size_t i = 0; i < keyFrames.size(); i++) {
+    auto location = KeyFrameLocation{animationIndex, i};
+    keyFrameIndex_->byTag[keyFrames[i].tag].push_back(location);
+    keyFrameIndex_->byParentTag[keyFrames[i].parentView.tag].push_back(
+        location);
+  }
+}
+
+void LayoutAnimationKeyFrameManager::invalidateKeyFrameIndex() const {
+  keyFrameIndex_.reset();
 }
 
 void LayoutAnimationKeyFrameManager::deleteAnimationsForStoppedSurfaces()
@@ -1615,6 +1705,7 @@ void LayoutAnimationKeyFrameManager::deleteAnimationsForStoppedSurfaces()
       if (surfaceIdsToStop.find(animation.surfaceId) !=
           surfaceIdsToStop.end()) {
         it = inflightAnimations_.erase(it);
+        invalidateKeyFrameIndex();
       } else {
         it++;
       }
@@ -1628,6 +1719,15 @@ Props::Shared LayoutAnimationKeyFrameManager::interpolateProps(
     Float animationProgress,
     const Props::Shared& props,
     const Props::Shared& newProps) const {
+  // Only opacity and transform of views are interpolated. Animations which
+  // change neither (e.g. layout-only animations) reuse the final props instead
+  // of cloning them on every frame.
+  if (!componentDescriptor.getTraits().check(
+          ShadowNodeTraits::Trait::ViewKind) ||
+      !viewPropsNeedInterpolation(props, newProps)) {
+    return newProps;
+  }
+
 #ifdef ANDROID
   // On Android only, the merged props should have the same RawProps as the
   // final props struct
@@ -1641,11 +1741,8 @@ Props::Shared LayoutAnimationKeyFrameManager::interpolateProps(
       componentDescriptor.cloneProps(context, newProps, {});
 #endif
 
-  if (componentDescriptor.getTraits().check(
-          ShadowNodeTraits::Trait::ViewKind)) {
-    interpolateViewProps(
-        animationProgress, props, newProps, interpolatedPropsShared);
-  }
+  interpolateViewProps(
+      animationProgress, props, newProps, interpolatedPropsShared);
 
   return interpolatedPropsShared;
 };
@@ -12,6 +12,7 @@
 #include <react/renderer/animations/primitives.h>
 #include <react/renderer/core/RawValue.h>
 #include <react/renderer/debug/flags.h>
+#include <react/renderer/graphics/Rect.h>
 #include <react/renderer/mounting/MountingOverrideDelegate.h>
 #include <react/renderer/mounting/MountingTransaction.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
@@ -19,7 +20,9 @@
 #include <react/renderer/uimanager/UIManagerAnimationDelegate.h>
 
 #include <optional>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace facebook::react {
 
@@ -118,6 +121,16 @@ class LayoutAnimationKeyFrameManager : public UIManagerAnimationDelegate,
       const ShadowView& startingView,
       const ShadowView& finalView) const;
 
+  /**
+   * Same as above, with the frame of the returned ShadowView already
+   * interpolated, e.g. with other views sharing the same `progress`.
+   */
+  ShadowView createInterpolatedShadowView(
+      Float progress,
+      const ShadowView& startingView,
+      const ShadowView& finalView,
+      const Rect& interpolatedFrame) const;
+
   void callCallback(const LayoutAnimationCallbackWrapper& callback) const;
 
   virtual void animationMutationsForFrame(
@@ -135,6 +148,12 @@ class LayoutAnimationKeyFrameManager : public UIManagerAnimationDelegate,
       bool interrupted,
       const std::string& logPrefix) const;
 
+  /**
+   * Must be called whenever animations are added to or removed from
+   * `inflightAnimations_`, or keyframes are removed from them.
+   */
+  void invalidateKeyFrameIndex() const;
+
  private:
   RuntimeExecutor runtimeExecutor_;
   ContextContainer::Shared contextContainer_;
@@ -147,6 +166,30 @@ class LayoutAnimationKeyFrameManager : public UIManagerAnimationDelegate,
   // Function that returns current time in milliseconds
   std::function<uint64_t()> now_;
 
+  /**
+   * Position of a keyframe in `inflightAnimations_`.
+   */
+  struct KeyFrameLocation {
+    size_t animationIndex;
+    size_t keyFrameIndex;
+  };
+
+  /**
+   * Keyframes of `inflightAnimations_` by the tag of their view and by the tag
+   * of its parent, so that conflict detection and index adjustment only visit
+   * the keyframes of the views which are mutated. Built lazily, and reset by
+   * `invalidateKeyFrameIndex`.
+   */
+  struct KeyFrameIndex {
+    std::unordered_map<Tag, std::vector<KeyFrameLocation>> byTag;
+    std::unordered_map<Tag, std::vector<KeyFrameLocation>> byParentTag;
+  };
+
+  mutable std::optional<KeyFrameIndex> keyFrameIndex_{};
+
+  const KeyFrameIndex& getKeyFrameIndex() const;
+  void addAnimationToKeyFrameIndex(size_t animationIndex) const;
+
   void adjustImmediateMutationIndicesForDelayedMutations(
       SurfaceId surfaceId,
       ShadowViewMutation& mutation,
@@ -9,6 +9,8 @@
 
 #include <react/renderer/debug/DebugStringConvertibleItem.h>
 
+#include <atomic>
+
 namespace facebook::react {
 
 using Fragment = AttributedString::Fragment;
@@ -29,22 +31,26 @@ bool Fragment::isAttachment() const {
   return string == AttachmentCharacter();
 }
 
+bool Fragment::hasIdenticalTextAttributes(const Fragment& rhs) const {
+  return internedTextAttributes != nullptr &&
+      internedTextAttributes == rhs.internedTextAttributes;
+}
+
 bool Fragment::operator==(const Fragment& rhs) const {
   return std::tie(
-             string,
-             textAttributes,
-             parentShadowView.tag,
-             parentShadowView.layoutMetrics) ==
+             string, parentShadowView.tag, parentShadowView.layoutMetrics) ==
       std::tie(
              rhs.string,
-             rhs.textAttributes,
              rhs.parentShadowView.tag,
-             rhs.parentShadowView.layoutMetrics);
+             rhs.parentShadowView.layoutMetrics) &&
+      (hasIdenticalTextAttributes(rhs) ||
+       textAttributes == rhs.textAttributes);
 }
 
 bool Fragment::isContentEqual(const Fragment& rhs) const {
-  return std::tie(string, textAttributes) ==
-      std::tie(rhs.string, rhs.textAttributes);
+  return string == rhs.string &&
+      (hasIdenticalTextAttributes(rhs) ||
+       textAttributes == rhs.textAttributes);
 }
 
 bool Fragment::operator!=(const Fragment& rhs) const {
@@ -60,7 +66,9 @@ void AttributedString::appendFragment(const Fragment& fragment) {
     return;
   }
 
-  fragments_.push_back(fragment);
+  getMutableFragments().push_back(fragment);
+  hash_combine(
+      layoutWiseHash_, attributedStringFragmentHashLayoutWise(fragment));
 }
 
 void AttributedString::prependFragment(const Fragment& fragment) {
@@ -70,56 +78,114 @@ void AttributedString::prependFragment(const Fragment& fragment) {
     return;
   }
 
-  fragments_.insert(fragments_.begin(), fragment);
+  auto& fragments = getMutableFragments();
+  fragments.insert(fragments.begin(), fragment);
+  updateLayoutWiseHash();
 }
 
 void AttributedString::appendAttributedString(
     const AttributedString& attributedString) {
   ensureUnsealed();
-  fragments_.insert(
-      fragments_.end(),
-      attributedString.fragments_.begin(),
-      attributedString.fragments_.end());
+
+  if (attributedString.isEmpty()) {
+    return;
+  }
+
+  // Holding on to the appended fragments, which may be the fragments of this
+  // string and be copied by `getMutableFragments`.
+  auto otherFragments = attributedString.fragments_;
+  auto& fragments = getMutableFragments();
+  fragments.insert(
+      fragments.end(), otherFragments->begin(), otherFragments->end());
+  for (const auto& fragment : *otherFragments) {
+    hash_combine(
+        layoutWiseHash_, attributedStringFragmentHashLayoutWise(fragment));
+  }
 }
 
 void AttributedString::prependAttributedString(
     const AttributedString& attributedString) {
   ensureUnsealed();
-  fragments_.insert(
-      fragments_.begin(),
-      attributedString.fragments_.begin(),
-      attributedString.fragments_.end());
+
+  if (attributedString.isEmpty()) {
+    return;
+  }
+
+  auto otherFragments = attributedString.fragments_;
+  auto& fragments = getMutableFragments();
+  fragments.insert(
+      fragments.begin(), otherFragments->begin(), otherFragments->end());
+  updateLayoutWiseHash();
 }
 
 const Fragments& AttributedString::getFragments() const {
-  return fragments_;
+  static const auto emptyFragments = Fragments{};
+  return fragments_ ? *fragments_ : emptyFragments;
+}
+
+void AttributedString::setFragmentLayoutMetrics(
+    size_t fragmentIndex,
+    const LayoutMetrics& layoutMetrics) {
+  ensureUnsealed();
+  // Layout metrics do not contribute to the layout-wise hash.
+  getMutableFragments().at(fragmentIndex).parentShadowView.layoutMetrics =
+      layoutMetrics;
 }
 
-Fragments& AttributedString::getFragments() {
-  return fragments_;
+size_t AttributedString::getLayoutWiseHash() const {
+  return layoutWiseHash_;
+}
+
+Fragments& AttributedString::getMutableFragments() {
+  if (!fragments_) {
+    fragments_ = std::make_shared<Fragments>();
+  } else if (fragments_.use_count() == 1) {
+    // Other copies may have let go of the fragments on other threads.
+    std::atomic_thread_fence(std::memory_order_acquire);
+  } else {
+    fragments_ = std::make_shared<Fragments>(*fragments_);
+  }
+  return *fragments_;
+}
+
+void AttributedString::updateLayoutWiseHash() {
+  layoutWiseHash_ = 0;
+  for (const auto& fragment : getFragments()) {
+    hash_combine(
+        layoutWiseHash_, attributedStringFragmentHashLayoutWise(fragment));
+  }
 }
 
 std::string AttributedString::getString() const {
   auto string = std::string{};
-  for (const auto& fragment : fragments_) {
+  for (const auto& fragment : getFragments()) {
     string += fragment.string;
   }
   return string;
 }
 
 bool AttributedString::isEmpty() const {
-  return fragments_.empty();
+  return getFragments().empty();
 }
 
 bool AttributedString::compareTextAttributesWithoutFrame(
     const AttributedString& rhs) const {
-  if (fragments_.size() != rhs.fragments_.size()) {
+  if (fragments_ == rhs.fragments_) {
+    return true;
+  }
+
+  const auto& fragments = getFragments();
+  const auto& rhsFragments = rhs.getFragments();
+  if (fragments.size() != rhsFragments.size()) {
     return false;
   }
 
-  for (size_t i = 0; i < fragments_.size(); i++) {
-    if (fragments_[i].textAttributes != rhs.fragments_[i].textAttributes ||
-        fragments_[i].string != rhs.fragments_[i].string) {
+  for (size_t i = 0; i < fragments.size(); i++) {
+    const auto& fragment = fragments[i];
+    const auto& rhsFragment = rhsFragments[i];
+    if (fragment.string != rhsFragment.string ||
+        (!fragment.hasIdenticalTextAttributes(rhsFragment) &&
+         fragment.textAttributes != rhsFragment.textAttributes)) {
       return false;
     }
   }
@@ -128,7 +194,7 @@ bool AttributedString::compareTextAttributesWithoutFrame(
 }
 
 bool AttributedString::operator==(const AttributedString& rhs) const {
-  return fragments_ == rhs.fragments_;
+  return fragments_ == rhs.fragments_ || getFragments() == rhs.getFragments();
 }
 
 bool AttributedString::operator!=(const AttributedString& rhs) const {
@@ -136,12 +202,18 @@ bool AttributedString::operator!=(const AttributedString& rhs) const {
 }
 
 bool AttributedString::isContentEqual(const AttributedString& rhs) const {
-  if (fragments_.size() != rhs.fragments_.size()) {
+  if (fragments_ == rhs.fragments_) {
+    return true;
+  }
+
+  const auto& fragments = getFragments();
+  const auto& rhsFragments = rhs.getFragments();
+  if (fragments.size() != rhsFragments.size()) {
     return false;
   }
 
-  for (size_t i = 0; i < fragments_.size(); i++) {
-    if (!fragments_[i].isContentEqual(rhs.fragments_[i])) {
+  for (size_t i = 0; i < fragments.size(); i++) {
+    if (!fragments[i].isContentEqual(rhsFragments[i])) {
       return false;
     }
   }
@@ -149,13 +221,38 @@ bool AttributedString::isContentEqual(const AttributedString& rhs) const {
   return true;
 }
 
+size_t textAttributesHashLayoutWise(const TextAttributes& textAttributes) {
+  // Taking into account the same props as
+  // `areTextAttributesEquivalentLayoutWise` mentions.
+  return hash_combine(
+      textAttributes.fontFamily,
+      textAttributes.fontSize,
+      textAttributes.fontSizeMultiplier,
+      textAttributes.fontWeight,
+      textAttributes.fontStyle,
+      textAttributes.fontVariant,
+      textAttributes.allowFontScaling,
+      textAttributes.dynamicTypeRamp,
+      textAttributes.letterSpacing,
+      textAttributes.lineHeight,
+      textAttributes.alignment);
+}
+
+size_t attributedStringFragmentHashLayoutWise(const Fragment& fragment) {
+  // Here we are not taking `isAttachment` and `layoutMetrics` into account
+  // because they are logically interdependent and this can break an invariant
+  // between hash and equivalence functions (and cause cache misses).
+  return hash_combine(
+      fragment.string, textAttributesHashLayoutWise(fragment.textAttributes));
+}
+
 #pragma mark - DebugStringConvertible
 
 #if RN_DEBUG_STRING_CONVERTIBLE
 SharedDebugStringConvertibleList AttributedString::getDebugChildren() const {
   auto list = SharedDebugStringConvertibleList{};
 
-  for (auto&& fragment : fragments_) {
+  for (auto&& fragment : getFragments()) {
     auto propsList =
         fragment.textAttributes.DebugStringConvertible::getDebugProps();
 
@@ -38,12 +38,26 @@ class AttributedString : public Sealable, public DebugStringConvertible {
     TextAttributes textAttributes;
     ShadowView parentShadowView;
 
+    /*
+     * Interned instance equal to `textAttributes` (see
+     * `TextAttributes::intern`), if any, which allows comparing the
+     * attributes of fragments by identity. Must be reset or updated together
+     * with `textAttributes`.
+     */
+    SharedTextAttributes internedTextAttributes;
+
     /*
      * Returns true is the Fragment represents an attachment.
      * Equivalent to `string == AttachmentCharacter()`.
      */
     bool isAttachment() const;
 
+    /*
+     * Returns true if the text attributes of both fragments were interned to
+     * the same instance, meaning they are equal without comparing them.
+     */
+    bool hasIdenticalTextAttributes(const Fragment& rhs) const;
+
     /*
      * Returns whether the underlying text and attributes are equal,
      * disregarding layout or other information.
@@ -81,9 +95,19 @@ class AttributedString : public Sealable, public DebugStringConvertible {
   const Fragments& getFragments() const;
 
   /*
-   * Returns a reference to a list of fragments.
+   * Sets the layout metrics of the parent shadow view of the fragment at a
+   * given index, e.g. the measured size of an attachment.
    */
-  Fragments& getFragments();
+  void setFragmentLayoutMetrics(
+      size_t fragmentIndex,
+      const LayoutMetrics& layoutMetrics);
+
+  /*
+   * Returns a hash of the strings and the text attributes affecting layout of
+   * all fragments (see `attributedStringFragmentHashLayoutWise`). The hash is
+   * kept up to date as fragments are added, so it is computed only once.
+   */
+  size_t getLayoutWiseHash() const;
 
   /*
    * Returns a string constructed from all strings in all fragments.
@@ -112,9 +136,25 @@ class AttributedString : public Sealable, public DebugStringConvertible {
 #endif
 
  private:
-  Fragments fragments_;
+  Fragments& getMutableFragments();
+  void updateLayoutWiseHash();
+
+  // Fragments are shared by copies of the string, so copying the string and
+  // comparing it with its copies take constant time. They are copied before
+  // being mutated unless the string is their only owner. Empty strings do not
+  // allocate any storage.
+  std::shared_ptr<Fragments> fragments_;
+  size_t layoutWiseHash_{0};
 };
 
+/*
+ * Hashes of the parts of text attributes and fragments which affect the
+ * layout of text, disregarding e.g. colors.
+ */
+size_t textAttributesHashLayoutWise(const TextAttributes& textAttributes);
+size_t attributedStringFragmentHashLayoutWise(
+    const AttributedString::Fragment& fragment);
+
 } // namespace facebook::react
 
 namespace std {
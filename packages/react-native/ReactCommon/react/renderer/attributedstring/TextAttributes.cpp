@@ -11,6 +11,7 @@
 #include <react/renderer/core/conversions.h>
 #include <react/renderer/core/graphicsConversions.h>
 #include <react/utils/FloatComparison.h>
+#include <react/utils/ShardedThreadSafeCache.h>
 #include <cmath>
 
 #include <react/renderer/debug/debugStringConvertibleUtils.h>
@@ -171,6 +172,17 @@ bool TextAttributes::operator!=(const TextAttributes& rhs) const {
   return !(*this == rhs);
 }
 
+SharedTextAttributes TextAttributes::intern(
+    const TextAttributes& textAttributes) {
+  // Documents usually use a handful of distinct combinations of attributes,
+  // so a small table covers them.
+  static auto table =
+      ShardedThreadSafeCache<TextAttributes, SharedTextAttributes, 256>{};
+  return table.get(textAttributes, [](const TextAttributes& textAttributes) {
+    return std::make_shared<const TextAttributes>(textAttributes);
+  });
+}
+
 TextAttributes TextAttributes::defaultTextAttributes() {
   static auto textAttributes = [] {
     auto textAttributes = TextAttributes{};
@@ -36,6 +36,14 @@ class TextAttributes : public DebugStringConvertible {
    */
   static TextAttributes defaultTextAttributes();
 
+  /*
+   * Returns an immutable instance equal to `textAttributes`, which is shared
+   * by all callers interning equal attributes while it is among the recently
+   * interned ones. Allows telling equal attributes apart by identity.
+   * Can be called from any thread.
+   */
+  static SharedTextAttributes intern(const TextAttributes& textAttributes);
+
 #pragma mark - Fields
 
   // Color
@@ -1160,21 +1160,22 @@ inline MapBuffer toMapBuffer(const AttributedString::Fragment& fragment) {
 }
 
 inline MapBuffer toMapBuffer(const AttributedString& attributedString) {
-  auto fragmentsBuilder = MapBufferBuilder();
+  const auto& fragments = attributedString.getFragments();
+  auto fragmentsBuilder =
+      MapBufferBuilder(static_cast<uint32_t>(fragments.size()));
 
   int index = 0;
-  for (auto fragment : attributedString.getFragments()) {
+  for (const auto& fragment : fragments) {
     fragmentsBuilder.putMapBuffer(index++, toMapBuffer(fragment));
   }
 
-  auto builder = MapBufferBuilder();
+  auto builder = MapBufferBuilder(3);
   size_t hash =
       std::hash<facebook::react::AttributedString>{}(attributedString);
   // TODO: This truncates half the hash
   builder.putInt(AS_KEY_HASH, static_cast<int>(hash));
   builder.putString(AS_KEY_STRING, attributedString.getString());
-  auto fragmentsMap = fragmentsBuilder.build();
-  builder.putMapBuffer(AS_KEY_FRAGMENTS, fragmentsMap);
+  builder.putMapBuffer(AS_KEY_FRAGMENTS, fragmentsBuilder);
   return builder.build();
 }
 
@@ -42,4 +42,98 @@ TEST(AttributedStringTest, testToDynamic) {
 
 #endif
 
+static AttributedString::Fragment fragmentWithString(std::string string) {
+  auto fragment = AttributedString::Fragment{};
+  fragment.string = std::move(string);
+  fragment.textAttributes.fontSize = 14;
+  return fragment;
+}
+
+TEST(AttributedStringTest, testLayoutWiseHashOfBuiltStrings) {
+  auto appended = AttributedString{};
+  appended.appendFragment(fragmentWithString("Hello"));
+  appended.appendFragment(fragmentWithString(" world"));
+
+  auto prepended = AttributedString{};
+  prepended.prependFragment(fragmentWithString(" world"));
+  prepended.prependFragment(fragmentWithString("Hello"));
+
+  auto concatenated = AttributedString{};
+  concatenated.appendFragment(fragmentWithString(" world"));
+  concatenated.prependAttributedString(appended);
+  concatenated.appendAttributedString(prepended);
+
+  auto expected = AttributedString{};
+  for (auto string : {"Hello", " world", " world", "Hello", " world"}) {
+    expected.appendFragment(fragmentWithString(string));
+  }
+
+  EXPECT_EQ(AttributedString{}.getLayoutWiseHash(), size_t{0});
+  EXPECT_NE(appended.getLayoutWiseHash(), size_t{0});
+  EXPECT_EQ(appended.getLayoutWiseHash(), prepended.getLayoutWiseHash());
+  EXPECT_EQ(concatenated.getLayoutWiseHash(), expected.getLayoutWiseHash());
+  EXPECT_NE(appended.getLayoutWiseHash(), expected.getLayoutWiseHash());
+}
+
+TEST(AttributedStringTest, testLayoutWiseHashIgnoresDecorativeAttributes) {
+  auto fragment = fragmentWithString("Hello");
+  auto plain = AttributedString{};
+  plain.appendFragment(fragment);
+
+  fragment.textAttributes.foregroundColor = blackColor();
+  auto colored = AttributedString{};
+  colored.appendFragment(fragment);
+
+  fragment.textAttributes.fontSize = 16;
+  auto larger = AttributedString{};
+  larger.appendFragment(fragment);
+
+  EXPECT_NE(plain, colored);
+  EXPECT_EQ(plain.getLayoutWiseHash(), colored.getLayoutWiseHash());
+  EXPECT_NE(plain.getLayoutWiseHash(), larger.getLayoutWiseHash());
+}
+
+TEST(AttributedStringTest, testCopiesShareFragmentsUntilMutated) {
+  auto original = AttributedString{};
+  original.appendFragment(fragmentWithString("Hello"));
+
+  auto copy = original;
+  EXPECT_EQ(&copy.getFragments(), &original.getFragments());
+  EXPECT_EQ(copy, original);
+
+  auto layoutMetrics = LayoutMetrics{};
+  layoutMetrics.frame.size = {10, 10};
+  copy.setFragmentLayoutMetrics(0, layoutMetrics);
+  EXPECT_NE(&copy.getFragments(), &original.getFragments());
+  EXPECT_EQ(
+      copy.getFragments()[0].parentShadowView.layoutMetrics, layoutMetrics);
+  EXPECT_NE(
+      original.getFragments()[0].parentShadowView.layoutMetrics,
+      layoutMetrics);
+  EXPECT_EQ(copy.getLayoutWiseHash(), original.getLayoutWiseHash());
+
+  copy.appendFragment(fragmentWithString(" world"));
+  EXPECT_EQ(original.getFragments().size(), 1);
+  EXPECT_EQ(copy.getFragments().size(), 2);
+}
+
+TEST(AttributedStringTest, testInternedTextAttributesAreShared) {
+  auto textAttributes = TextAttributes{};
+  textAttributes.fontSize = 14;
+  auto interned = TextAttributes::intern(textAttributes);
+  EXPECT_EQ(*interned, textAttributes);
+  EXPECT_EQ(interned, TextAttributes::intern(textAttributes));
+
+  textAttributes.fontSize = 16;
+  EXPECT_NE(interned, TextAttributes::intern(textAttributes));
+
+  auto fragment = fragmentWithString("Hello");
+  auto internedFragment = fragment;
+  internedFragment.internedTextAttributes =
+      TextAttributes::intern(fragment.textAttributes);
+  EXPECT_FALSE(fragment.hasIdenticalTextAttributes(internedFragment));
+  EXPECT_TRUE(internedFragment.hasIdenticalTextAttributes(internedFragment));
+  EXPECT_EQ(fragment, internedFragment);
+}
+
 } // namespace facebook::react
@@ -26,12 +26,28 @@ ComponentDescriptorRegistry::ComponentDescriptorRegistry(
     ContextContainer::Shared contextContainer)
     : parameters_(std::move(parameters)),
       providerRegistry_(providerRegistry),
-      contextContainer_(std::move(contextContainer)) {}
+      contextContainer_(std::move(contextContainer)) {
+  snapshots_.push_back(std::make_unique<const Snapshot>());
+  snapshot_.store(snapshots_.back().get(), std::memory_order_release);
+}
+
+const ComponentDescriptorRegistry::Snapshot&
+ComponentDescriptorRegistry::getSnapshot() const {
+  return *snapshot_.load(std::memory_order_acquire);
+}
+
+void ComponentDescriptorRegistry::updateSnapshot(
+    const std::function<void(Snapshot&)>& mutation) const {
+  std::lock_guard lock(mutex_);
+
+  auto snapshot = std::make_unique<Snapshot>(*snapshots_.back());
+  mutation(*snapshot);
+  snapshot_.store(snapshot.get(), std::memory_order_release);
+  snapshots_.push_back(std::move(snapshot));
+}
 
 void ComponentDescriptorRegistry::add(
     ComponentDescriptorProvider componentDescriptorProvider) const {
-  std::unique_lock lock(mutex_);
-
   auto componentDescriptor = componentDescriptorProvider.constructor(
       {parameters_.eventDispatcher,
        parameters_.contextContainer,
@@ -43,35 +59,49 @@ void ComponentDescriptorRegistry::add(
       componentDescriptor->getComponentName() ==
       componentDescriptorProvider.name);
 
-  auto sharedComponentDescriptor = std::shared_ptr<const ComponentDescriptor>(
-      std::move(componentDescriptor));
-  _registryByHandle[componentDescriptorProvider.handle] =
-      sharedComponentDescriptor;
-  _registryByName[componentDescriptorProvider.name] = sharedComponentDescriptor;
+  registerComponentDescriptor(std::shared_ptr<const ComponentDescriptor>(
+      std::move(componentDescriptor)));
 }
 
 void ComponentDescriptorRegistry::registerComponentDescriptor(
     const SharedComponentDescriptor& componentDescriptor) const {
-  ComponentHandle componentHandle = componentDescriptor->getComponentHandle();
-  _registryByHandle[componentHandle] = componentDescriptor;
+  updateSnapshot([&](Snapshot& snapshot) {
+    componentDescriptors_.push_back(componentDescriptor);
+
+    ComponentHandle componentHandle = componentDescriptor->getComponentHandle();
+    snapshot.byHandle[componentHandle] = componentDescriptor.get();
 
-  ComponentName componentName = componentDescriptor->getComponentName();
-  _registryByName[componentName] = componentDescriptor;
+    ComponentName componentName = componentDescriptor->getComponentName();
+    snapshot.byName[componentName] = componentDescriptor.get();
+
+    // The new descriptor might replace memoized ones.
+    snapshot.byViewName.clear();
+  });
 }
 
 const ComponentDescriptor& ComponentDescriptorRegistry::at(
     const std::string& componentName) const {
-  std::shared_lock lock(mutex_);
+  {
+    const auto& snapshot = getSnapshot();
+    auto it = snapshot.byViewName.find(componentName);
+    if (it != snapshot.byViewName.end()) {
+      return *it->second;
+    }
+  }
 
   auto unifiedComponentName = componentNameByReactViewName(componentName);
 
-  auto it = _registryByName.find(unifiedComponentName);
-  if (it == _registryByName.end()) {
-    lock.unlock();
+  auto findByUnifiedName = [&]() -> const ComponentDescriptor* {
+    const auto& snapshot = getSnapshot();
+    auto it = snapshot.byName.find(unifiedComponentName);
+    return it != snapshot.byName.end() ? it->second : nullptr;
+  };
+
+  auto componentDescriptor = findByUnifiedName();
+  if (!componentDescriptor) {
     providerRegistry_.request(unifiedComponentName.c_str());
-    lock.lock();
 
-    it = _registryByName.find(unifiedComponentName);
+    componentDescriptor = findByUnifiedName();
 
     /*
      * TODO: T54849676
@@ -80,20 +110,20 @@ const ComponentDescriptor& ComponentDescriptorRegistry::at(
      * that `componentDescriptorProviderRequest` is always not null and register
      * some component on every single request.
      */
-    // assert(it != _registryByName.end());
+    // assert(componentDescriptor);
   }
 
-  if (it == _registryByName.end()) {
+  if (!componentDescriptor) {
     auto reactNativeConfig_ =
         contextContainer_->at<std::shared_ptr<const ReactNativeConfig>>(
             "ReactNativeConfig");
     if (reactNativeConfig_->getBool(
             "react_fabric:enabled_automatic_interop_android")) {
-      auto componentDescriptor = std::make_shared<
+      auto interopComponentDescriptor = std::make_shared<
           const UnstableLegacyViewManagerAutomaticComponentDescriptor>(
           parameters_, unifiedComponentName);
-      registerComponentDescriptor(componentDescriptor);
-      return *_registryByName.find(unifiedComponentName)->second;
+      registerComponentDescriptor(interopComponentDescriptor);
+      componentDescriptor = interopComponentDescriptor.get();
     } else if (_fallbackComponentDescriptor == nullptr) {
       throw std::invalid_argument(
           ("Unable to find componentDescriptor for " + unifiedComponentName)
@@ -103,35 +133,37 @@ const ComponentDescriptor& ComponentDescriptorRegistry::at(
     }
   }
 
-  return *it->second;
+  updateSnapshot([&](Snapshot& snapshot) {
+    snapshot.byViewName[componentName] = componentDescriptor;
+  });
+
+  return *componentDescriptor;
 }
 
 const ComponentDescriptor* ComponentDescriptorRegistry::
     findComponentDescriptorByHandle_DO_NOT_USE_THIS_IS_BROKEN(
         ComponentHandle componentHandle) const {
-  std::shared_lock lock(mutex_);
+  const auto& snapshot = getSnapshot();
 
-  auto iterator = _registryByHandle.find(componentHandle);
-  if (iterator == _registryByHandle.end()) {
+  auto iterator = snapshot.byHandle.find(componentHandle);
+  if (iterator == snapshot.byHandle.end()) {
     return nullptr;
   }
 
-  return iterator->second.get();
+  return iterator->second;
 }
 
 const ComponentDescriptor& ComponentDescriptorRegistry::at(
     ComponentHandle componentHandle) const {
-  std::shared_lock lock(mutex_);
-
-  return *_registryByHandle.at(componentHandle);
+  return *getSnapshot().byHandle.at(componentHandle);
 }
 
 bool ComponentDescriptorRegistry::hasComponentDescriptorAt(
     ComponentHandle componentHandle) const {
-  std::shared_lock lock(mutex_);
+  const auto& snapshot = getSnapshot();
 
-  auto iterator = _registryByHandle.find(componentHandle);
-  return iterator != _registryByHandle.end();
+  auto iterator = snapshot.byHandle.find(componentHandle);
+  return iterator != snapshot.byHandle.end();
 }
 
 void ComponentDescriptorRegistry::setFallbackComponentDescriptor(
@@ -145,4 +177,17 @@ ComponentDescriptorRegistry::getFallbackComponentDescriptor() const {
   return _fallbackComponentDescriptor;
 }
 
+void ComponentDescriptorRegistry::didReceiveMemoryPressure(
+    MemoryPressureLevel level) const {
+  auto componentDescriptors = std::vector<SharedComponentDescriptor>{};
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    componentDescriptors = componentDescriptors_;
+  }
+
+  for (const auto& componentDescriptor : componentDescriptors) {
+    componentDescriptor->didReceiveMemoryPressure(level);
+  }
+}
+
 } // namespace facebook::react
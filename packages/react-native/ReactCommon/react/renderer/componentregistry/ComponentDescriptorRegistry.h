@@ -7,14 +7,18 @@
 
 #pragma once
 
+#include <atomic>
+#include <functional>
 #include <memory>
-#include <shared_mutex>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include <react/renderer/componentregistry/ComponentDescriptorProvider.h>
 #include <react/renderer/core/ComponentDescriptor.h>
 #include <react/renderer/core/InstanceHandle.h>
 #include <react/utils/ContextContainer.h>
+#include <react/utils/FlatMap.h>
 
 namespace facebook::react {
 
@@ -26,6 +30,8 @@ using SharedComponentDescriptorRegistry =
 
 /*
  * Registry of particular `ComponentDescriptor`s.
+ * Lookups do not lock: they read an immutable snapshot of the registry, and
+ * registrations (which are rare) publish an updated copy of it.
  */
 class ComponentDescriptorRegistry {
  public:
@@ -58,6 +64,12 @@ class ComponentDescriptorRegistry {
       const SharedComponentDescriptor& descriptor);
   ComponentDescriptor::Shared getFallbackComponentDescriptor() const;
 
+  /*
+   * Forwards memory pressure to all registered `ComponentDescriptor`s.
+   * Thread safe.
+   */
+  void didReceiveMemoryPressure(MemoryPressureLevel level) const;
+
  private:
   friend class ComponentDescriptorProviderRegistry;
 
@@ -73,11 +85,44 @@ class ComponentDescriptorRegistry {
    */
   void add(ComponentDescriptorProvider componentDescriptorProvider) const;
 
-  mutable std::shared_mutex mutex_;
-  mutable std::unordered_map<ComponentHandle, SharedComponentDescriptor>
-      _registryByHandle;
-  mutable std::unordered_map<std::string, SharedComponentDescriptor>
-      _registryByName;
+  /*
+   * Descriptors are owned by `componentDescriptors_`.
+   */
+  struct Snapshot {
+    FlatMap<ComponentHandle, const ComponentDescriptor*> byHandle;
+    std::unordered_map<std::string, const ComponentDescriptor*> byName;
+
+    /*
+     * Memoized results of lookups by the (not unified) names which callers
+     * use, so that repeated lookups skip `componentNameByReactViewName`.
+     */
+    std::unordered_map<std::string, const ComponentDescriptor*> byViewName;
+  };
+
+  const Snapshot& getSnapshot() const;
+
+  /*
+   * Publishes a copy of the current snapshot changed by `mutation`.
+   */
+  void updateSnapshot(const std::function<void(Snapshot&)>& mutation) const;
+
+  /*
+   * Serializes updates of the snapshot.
+   */
+  mutable std::mutex mutex_;
+  mutable std::atomic<const Snapshot*> snapshot_;
+
+  /*
+   * All snapshots ever published. Lookups on other threads might still read
+   * replaced ones, so they are kept until the registry is destroyed.
+   */
+  mutable std::vector<std::unique_ptr<const Snapshot>> snapshots_;
+
+  /*
+   * All descriptors ever registered, including replaced ones which might
+   * still be referenced.
+   */
+  mutable std::vector<SharedComponentDescriptor> componentDescriptors_;
   ComponentDescriptor::Shared _fallbackComponentDescriptor;
   ComponentDescriptorParameters parameters_{};
   const ComponentDescriptorProviderRegistry& providerRegistry_;
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ImagePrefetchCommitHook.h"
+
+#include <algorithm>
+
+#include <react/renderer/components/image/ImageShadowNode.h>
+#include <react/renderer/components/scrollview/ScrollViewShadowNode.h>
+#include <react/renderer/core/LayoutableShadowNode.h>
+#include <react/renderer/mounting/ShadowTree.h>
+
+namespace facebook::react {
+
+static Point getOrigin(const ShadowNode& shadowNode) {
+  auto layoutableShadowNode =
+      dynamic_cast<const LayoutableShadowNode*>(&shadowNode);
+  return layoutableShadowNode != nullptr
+      ? layoutableShadowNode->getLayoutMetrics().frame.origin
+      : Point{};
+}
+
+// Collects <Image>s among the descendants of a scroll view, skipping the ones
+// inside of nested scroll views.
+static void collectCandidates(
+    const ShadowNode& shadowNode,
+    Point origin,
+    std::vector<ImagePrefetchCandidate>& candidates) {
+  for (const auto& child : shadowNode.getChildren()) {
+    if (child->getComponentName() == ScrollViewComponentName) {
+      continue;
+    }
+
+    auto childOrigin = origin + getOrigin(*child);
+    if (child->getComponentName() == ImageComponentName) {
+      const auto& imageShadowNode = static_cast<const ImageShadowNode&>(*child);
+      auto frame = imageShadowNode.getLayoutMetrics().frame;
+      frame.origin = childOrigin;
+      candidates.push_back(
+          {frame, &imageShadowNode.getStateData().getImageRequest()});
+      continue;
+    }
+
+    collectCandidates(*child, childOrigin, candidates);
+  }
+}
+
+ImagePrefetchCommitHook::ImagePrefetchCommitHook(
+    Float lookAheadTime,
+    Float maxLookAhead)
+    : prefetcher_(lookAheadTime, maxLookAhead) {}
+
+void ImagePrefetchCommitHook::visitScrollViews(
+    const ShadowNode& shadowNode,
+    std::vector<Tag>& scrollViewTags) {
+  if (shadowNode.getComponentName() == ScrollViewComponentName) {
+    const auto& scrollViewShadowNode =
+        static_cast<const ScrollViewShadowNode&>(shadowNode);
+    auto viewport = Rect{
+        scrollViewShadowNode.getStateData().contentOffset,
+        scrollViewShadowNode.getLayoutMetrics().frame.size};
+
+    auto candidates = std::vector<ImagePrefetchCandidate>{};
+    collectCandidates(shadowNode, {}, candidates);
+    prefetcher_.updateViewport(shadowNode.getTag(), viewport, candidates);
+    scrollViewTags.push_back(shadowNode.getTag());
+  }
+
+  for (const auto& child : shadowNode.getChildren()) {
+    visitScrollViews(*child, scrollViewTags);
+  }
+}
+
+RootShadowNode::Unshared ImagePrefetchCommitHook::shadowTreeWillCommit(
+    const ShadowTree& shadowTree,
+    const RootShadowNode::Shared& /*oldRootShadowNode*/,
+    const RootShadowNode::Unshared& newRootShadowNode) noexcept {
+  auto scrollViewTags = std::vector<Tag>{};
+  visitScrollViews(*newRootShadowNode, scrollViewTags);
+  std::sort(scrollViewTags.begin(), scrollViewTags.end());
+
+  std::scoped_lock lock(mutex_);
+  auto& previousScrollViewTags = scrollViewTags_[shadowTree.getSurfaceId()];
+  for (auto tag : previousScrollViewTags) {
+    if (!std::binary_search(
+            scrollViewTags.begin(), scrollViewTags.end(), tag)) {
+      prefetcher_.removeScrollView(tag);
+    }
+  }
+  previousScrollViewTags = std::move(scrollViewTags);
+
+  return newRootShadowNode;
+}
+
+void ImagePrefetchCommitHook::commitHookWasRegistered(
+    const UIManager& /*uiManager*/) noexcept {}
+
+void ImagePrefetchCommitHook::commitHookWasUnregistered(
+    const UIManager& /*uiManager*/) noexcept {}
+
+} // namespace facebook::react
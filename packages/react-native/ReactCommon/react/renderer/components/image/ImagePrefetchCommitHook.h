@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/imagemanager/ImagePrefetcher.h>
+#include <react/renderer/uimanager/UIManagerCommitHook.h>
+
+namespace facebook::react {
+
+/*
+ * Feeds the viewports of committed <ScrollView>s and the frames of <Image>s
+ * inside of them to an `ImagePrefetcher`, so that images ahead of the scroll
+ * are loaded before the ones which are farther away.
+ * Frames are taken from the last layout of the nodes; the commit hook runs
+ * before the new tree is laid out, which commits of scroll state don't need.
+ */
+class ImagePrefetchCommitHook final : public UIManagerCommitHook {
+ public:
+  ImagePrefetchCommitHook(Float lookAheadTime = 0.5, Float maxLookAhead = 2);
+
+#pragma mark - UIManagerCommitHook
+
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& shadowTree,
+      const RootShadowNode::Shared& oldRootShadowNode,
+      const RootShadowNode::Unshared& newRootShadowNode) noexcept override;
+
+  void commitHookWasRegistered(const UIManager& uiManager) noexcept override;
+
+  void commitHookWasUnregistered(const UIManager& uiManager) noexcept override;
+
+  const char* getName() const noexcept override {
+    return "ImagePrefetchCommitHook";
+  }
+
+ private:
+  /*
+   * Visits `shadowNode` and its descendants, updating the viewports of
+   * scroll views among them. Returns tags of visited scroll views.
+   */
+  void visitScrollViews(
+      const ShadowNode& shadowNode,
+      std::vector<Tag>& scrollViewTags);
+
+  ImagePrefetcher prefetcher_;
+
+  /*
+   * Tags of <ScrollView>s seen in the last commit of each surface.
+   */
+  std::mutex mutex_;
+  std::unordered_map<SurfaceId, std::vector<Tag>> scrollViewTags_;
+};
+
+} // namespace facebook::react
@@ -34,6 +34,12 @@ void ImageShadowNode::updateStateIfNeeded() {
     return;
   }
 
+  if (hasSameImageSource && imageSource.type != ImageSource::Type::Invalid) {
+    // The image doesn't need to be requested again to be blurred differently.
+    setStateData(ImageState{currentState, getConcreteProps().blurRadius});
+    return;
+  }
+
   auto state = ImageState{
       imageSource,
       imageManager_->requestImage(imageSource, getSurfaceId()),
@@ -30,6 +30,15 @@ class ImageState final {
         imageRequest_(std::make_shared<ImageRequest>(std::move(imageRequest))),
         blurRadius_(blurRadius){};
 
+  /*
+   * Creates a state which shares the image source and the request of
+   * `imageState`, with a different blur radius.
+   */
+  ImageState(const ImageState& imageState, const Float blurRadius)
+      : imageSource_(imageState.imageSource_),
+        imageRequest_(imageState.imageRequest_),
+        blurRadius_(blurRadius){};
+
   /*
    * Returns stored ImageSource object.
    */
@@ -6,17 +6,81 @@
  */
 
 #include "LegacyViewManagerInteropViewProps.h"
-#include <react/renderer/core/DynamicPropsUtilities.h>
+
+#include <optional>
 
 namespace facebook::react {
 
+namespace {
+
+using OtherPropValues = LegacyViewManagerInteropViewProps::OtherPropValues;
+
+std::shared_ptr<const OtherPropValues> mergeOtherPropValues(
+    const std::shared_ptr<const OtherPropValues>& source,
+    const RawProps& rawProps) {
+  auto patch = (folly::dynamic)rawProps;
+  if (!patch.isObject() || patch.empty()) {
+    return source;
+  }
+
+  // Only the values of updated props are copied; the others are shared with
+  // `source`.
+  auto values = std::optional<OtherPropValues>{};
+  for (auto& pair : patch.items()) {
+    auto name = pair.first.asString();
+    auto iterator = source->find(name);
+    if (iterator != source->end() && *iterator->second == pair.second) {
+      continue;
+    }
+    if (!values) {
+      values = *source;
+    }
+    (*values)[std::move(name)] =
+        std::make_shared<const folly::dynamic>(std::move(pair.second));
+  }
+
+  if (!values) {
+    return source;
+  }
+  return std::make_shared<const OtherPropValues>(std::move(*values));
+}
+
+} // namespace
+
 LegacyViewManagerInteropViewProps::LegacyViewManagerInteropViewProps(
     const PropsParserContext& context,
     const LegacyViewManagerInteropViewProps& sourceProps,
     const RawProps& rawProps)
     : ViewProps(context, sourceProps, rawProps),
-      otherProps(
-          mergeDynamicProps(sourceProps.otherProps, (folly::dynamic)rawProps)) {
+      otherPropValues(
+          mergeOtherPropValues(sourceProps.otherPropValues, rawProps)) {}
+
+folly::dynamic LegacyViewManagerInteropViewProps::getOtherProps() const {
+  auto result = folly::dynamic::object();
+  for (const auto& [name, value] : *otherPropValues) {
+    result[name] = *value;
+  }
+  return result;
+}
+
+folly::dynamic LegacyViewManagerInteropViewProps::getChangedOtherProps(
+    const LegacyViewManagerInteropViewProps& oldProps) const {
+  auto result = folly::dynamic::object();
+  if (otherPropValues == oldProps.otherPropValues) {
+    return result;
+  }
+
+  // Props are never removed (see `getOtherProps`), so comparing the props
+  // of `this` with the ones of `oldProps` finds all changes.
+  for (const auto& [name, value] : *otherPropValues) {
+    auto iterator = oldProps.otherPropValues->find(name);
+    if (iterator != oldProps.otherPropValues->end() &&
+        (iterator->second == value || *iterator->second == *value)) {
+      continue;
+    }
+    result[name] = *value;
+  }
+  return result;
 }
 
 } // namespace facebook::react
@@ -5,24 +5,54 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#pragma once
+
 #include <folly/dynamic.h>
 #include <react/renderer/components/view/ViewProps.h>
 #include <react/renderer/core/PropsParserContext.h>
+#include <memory>
+#include <string>
 #include <unordered_map>
 
 namespace facebook::react {
 
 class LegacyViewManagerInteropViewProps final : public ViewProps {
  public:
+  /*
+   * Values of props by name. Values are immutable, so props cloned from each
+   * other share the values of the props which weren't updated, and comparing
+   * pointers to them tells which props were updated.
+   */
+  using OtherPropValues =
+      std::unordered_map<std::string, std::shared_ptr<const folly::dynamic>>;
+
   LegacyViewManagerInteropViewProps() = default;
   LegacyViewManagerInteropViewProps(
       const PropsParserContext& context,
       const LegacyViewManagerInteropViewProps& sourceProps,
       const RawProps& rawProps);
 
+  /*
+   * Returns all props (including the ones of `ViewProps`) as an object.
+   * Props set to `null` are kept, as an indication for the legacy view
+   * manager that it needs to reset them.
+   */
+  folly::dynamic getOtherProps() const;
+
+  /*
+   * Returns the props whose values differ from the ones of `oldProps`, as an
+   * object.
+   */
+  folly::dynamic getChangedOtherProps(
+      const LegacyViewManagerInteropViewProps& oldProps) const;
+
 #pragma mark - Props
 
-  folly::dynamic const otherProps;
+  /*
+   * Shared by props cloned without updating any of them.
+   */
+  const std::shared_ptr<const OtherPropValues> otherPropValues{
+      std::make_shared<const OtherPropValues>()};
 };
 
 } // namespace facebook::react
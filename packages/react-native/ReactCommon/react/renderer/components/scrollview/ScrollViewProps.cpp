@@ -346,7 +346,25 @@ ScrollViewProps::ScrollViewProps(
                     rawProps,
                     "isInvertedVirtualizedList",
                     sourceProps.isInvertedVirtualizedList,
-                    {})) {}
+                    {})),
+      experimental_nativeWindowing(
+          CoreFeatures::enablePropIteratorSetter
+              ? sourceProps.experimental_nativeWindowing
+              : convertRawProp(
+                    context,
+                    rawProps,
+                    "experimental_nativeWindowing",
+                    sourceProps.experimental_nativeWindowing,
+                    {})),
+      experimental_nativeWindowingOverscan(
+          CoreFeatures::enablePropIteratorSetter
+              ? sourceProps.experimental_nativeWindowingOverscan
+              : convertRawProp(
+                    context,
+                    rawProps,
+                    "experimental_nativeWindowingOverscan",
+                    sourceProps.experimental_nativeWindowingOverscan,
+                    (Float)1.0)) {}
 
 void ScrollViewProps::setProp(
     const PropsParserContext& context,
@@ -396,6 +414,8 @@ void ScrollViewProps::setProp(
     RAW_SET_PROP_SWITCH_CASE_BASIC(contentInsetAdjustmentBehavior);
     RAW_SET_PROP_SWITCH_CASE_BASIC(scrollToOverflowEnabled);
     RAW_SET_PROP_SWITCH_CASE_BASIC(isInvertedVirtualizedList);
+    RAW_SET_PROP_SWITCH_CASE_BASIC(experimental_nativeWindowing);
+    RAW_SET_PROP_SWITCH_CASE_BASIC(experimental_nativeWindowingOverscan);
   }
 }
 
@@ -524,7 +544,15 @@ SharedDebugStringConvertibleList ScrollViewProps::getDebugProps() const {
           debugStringConvertibleItem(
               "isInvertedVirtualizedList",
               snapToEnd,
-              defaultScrollViewProps.isInvertedVirtualizedList)};
+              defaultScrollViewProps.isInvertedVirtualizedList),
+          debugStringConvertibleItem(
+              "experimental_nativeWindowing",
+              experimental_nativeWindowing,
+              defaultScrollViewProps.experimental_nativeWindowing),
+          debugStringConvertibleItem(
+              "experimental_nativeWindowingOverscan",
+              experimental_nativeWindowingOverscan,
+              defaultScrollViewProps.experimental_nativeWindowingOverscan)};
 }
 #endif
 
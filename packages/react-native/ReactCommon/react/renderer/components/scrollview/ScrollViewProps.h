@@ -72,6 +72,12 @@ class ScrollViewProps final : public ViewProps {
   bool scrollToOverflowEnabled{false};
   bool isInvertedVirtualizedList{false};
 
+  // Mounts only the views of the children of the content container which
+  // are within `experimental_nativeWindowingOverscan` viewport lengths of the
+  // visible area. The children stay in the shadow tree.
+  bool experimental_nativeWindowing{false};
+  Float experimental_nativeWindowingOverscan{1.0f};
+
 #pragma mark - DebugStringConvertible
 
 #if RN_DEBUG_STRING_CONVERTIBLE
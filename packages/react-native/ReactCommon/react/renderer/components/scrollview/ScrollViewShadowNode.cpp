@@ -10,10 +10,39 @@
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/core/LayoutMetrics.h>
 
+#include <algorithm>
+
 namespace facebook::react {
 
 const char ScrollViewComponentName[] = "ScrollView";
 
+double ScrollViewShadowNode::stateUpdateIntervalWhileScrollingMs = 100;
+
+ScrollViewShadowNode::ScrollViewShadowNode(
+    const ShadowNodeFragment& fragment,
+    const ShadowNodeFamily::Shared& family,
+    ShadowNodeTraits traits)
+    : ConcreteViewShadowNode(fragment, family, traits) {
+  initialize();
+}
+
+ScrollViewShadowNode::ScrollViewShadowNode(
+    const ShadowNode& sourceShadowNode,
+    const ShadowNodeFragment& fragment)
+    : ConcreteViewShadowNode(sourceShadowNode, fragment) {
+  initialize();
+}
+
+void ScrollViewShadowNode::initialize() noexcept {
+  // Traits are copied when the node is cloned, so the trait must be unset
+  // when windowing gets disabled.
+  if (getConcreteProps().experimental_nativeWindowing) {
+    traits_.set(ShadowNodeTraits::Trait::WindowsContent);
+  } else {
+    traits_.unset(ShadowNodeTraits::Trait::WindowsContent);
+  }
+}
+
 void ScrollViewShadowNode::updateStateIfNeeded() {
   ensureUnsealed();
 
@@ -55,6 +84,15 @@ ScrollViewState ScrollViewShadowNode::initialStateData(
   return {static_cast<const ScrollViewProps&>(*props).contentOffset, {}, 0};
 }
 
+std::optional<double>
+ScrollViewShadowNode::getStateUpdateIntervalWhileScrolling(
+    const ScrollViewState& state) {
+  if (!state.isContentOffsetRead()) {
+    return std::nullopt;
+  }
+  return stateUpdateIntervalWhileScrollingMs;
+}
+
 #pragma mark - LayoutableShadowNode
 
 void ScrollViewShadowNode::layout(LayoutContext layoutContext) {
@@ -64,9 +102,35 @@ void ScrollViewShadowNode::layout(LayoutContext layoutContext) {
 }
 
 Point ScrollViewShadowNode::getContentOriginOffset() const {
-  auto stateData = getStateData();
+  const auto& stateData = getStateData();
+  stateData.markContentOffsetRead();
   auto contentOffset = stateData.contentOffset;
   return {-contentOffset.x, -contentOffset.y + stateData.scrollAwayPaddingTop};
 }
 
+std::optional<Rect> ScrollViewShadowNode::getContentWindow() const {
+  const auto& props = getConcreteProps();
+  auto size = getLayoutMetrics().frame.size;
+  if (!props.experimental_nativeWindowing || size.width <= 0 ||
+      size.height <= 0) {
+    return std::nullopt;
+  }
+
+  // The visible area, in the coordinate space of the content container.
+  auto contentOriginOffset = getContentOriginOffset();
+  auto window = Rect{{-contentOriginOffset.x, -contentOriginOffset.y}, size};
+
+  auto overscan =
+      std::max(props.experimental_nativeWindowingOverscan, Float{0});
+  auto horizontalOverscan = size.width * overscan;
+  auto verticalOverscan = size.height * overscan;
+  return insetBy(
+      window,
+      EdgeInsets{
+          -horizontalOverscan,
+          -verticalOverscan,
+          -horizontalOverscan,
+          -verticalOverscan});
+}
+
 } // namespace facebook::react
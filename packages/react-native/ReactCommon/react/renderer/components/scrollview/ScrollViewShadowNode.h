@@ -14,6 +14,8 @@
 #include <react/renderer/core/LayoutContext.h>
 #include <react/renderer/core/ShadowNodeFamily.h>
 
+#include <optional>
+
 namespace facebook::react {
 
 extern const char ScrollViewComponentName[];
@@ -27,19 +29,45 @@ class ScrollViewShadowNode final : public ConcreteViewShadowNode<
                                        ScrollViewEventEmitter,
                                        ScrollViewState> {
  public:
-  using ConcreteViewShadowNode::ConcreteViewShadowNode;
+  ScrollViewShadowNode(
+      const ShadowNodeFragment& fragment,
+      const ShadowNodeFamily::Shared& family,
+      ShadowNodeTraits traits);
+
+  ScrollViewShadowNode(
+      const ShadowNode& sourceShadowNode,
+      const ShadowNodeFragment& fragment);
 
   static ScrollViewState initialStateData(
       const Props::Shared& props,
       const ShadowNodeFamily::Shared& family,
       const ComponentDescriptor& componentDescriptor);
 
+  /*
+   * Minimum time between the state updates of a ScrollView which is being
+   * scrolled while its content offset is read in C++. 100ms by default.
+   */
+  static double stateUpdateIntervalWhileScrollingMs;
+
+  /*
+   * Returns the minimum time (in milliseconds) between the updates of the
+   * content offset in the state of a ScrollView which is being scrolled, or
+   * nothing if only the offset at which scrolling ends has to be sent, as
+   * nothing in C++ reads the content offset of the ScrollView in between (see
+   * `ScrollViewState::isContentOffsetRead`). Used by the platforms when
+   * `CoreFeatures::enableThrottledScrollViewStateUpdates` is enabled.
+   */
+  static std::optional<double> getStateUpdateIntervalWhileScrolling(
+      const ScrollViewState& state);
+
 #pragma mark - LayoutableShadowNode
 
   void layout(LayoutContext layoutContext) override;
   Point getContentOriginOffset() const override;
+  std::optional<Rect> getContentWindow() const override;
 
  private:
+  void initialize() noexcept;
   void updateStateIfNeeded();
   void updateScrollContentOffsetIfNeeded();
 };
@@ -7,6 +7,8 @@
 
 #include "ScrollViewState.h"
 
+#include <react/renderer/components/scrollview/ScrollViewShadowNode.h>
+
 namespace facebook::react {
 
 ScrollViewState::ScrollViewState(
@@ -21,4 +23,34 @@ Size ScrollViewState::getContentSize() const {
   return contentBoundingRect.size;
 }
 
+void ScrollViewState::markContentOffsetRead() const {
+  contentOffsetRead_->store(true, std::memory_order_relaxed);
+}
+
+bool ScrollViewState::isContentOffsetRead() const {
+  return contentOffsetRead_->load(std::memory_order_relaxed);
+}
+
+#ifdef ANDROID
+folly::dynamic ScrollViewState::getDynamic() const {
+  return folly::dynamic::object("contentOffsetLeft", contentOffset.x)(
+      "contentOffsetTop", contentOffset.y)(
+      "scrollAwayPaddingTop", scrollAwayPaddingTop);
+}
+
+MapBuffer ScrollViewState::getMapBuffer() const {
+  auto builder = MapBufferBuilder();
+  builder.putDouble(SCROLL_STATE_KEY_CONTENT_OFFSET_LEFT, contentOffset.x);
+  builder.putDouble(SCROLL_STATE_KEY_CONTENT_OFFSET_TOP, contentOffset.y);
+  builder.putDouble(
+      SCROLL_STATE_KEY_SCROLL_AWAY_PADDING_TOP, scrollAwayPaddingTop);
+  // Negative if the content offset only needs to be sent once scrolling ends.
+  builder.putDouble(
+      SCROLL_STATE_KEY_UPDATE_INTERVAL_WHILE_SCROLLING,
+      ScrollViewShadowNode::getStateUpdateIntervalWhileScrolling(*this)
+          .value_or(-1));
+  return builder.build();
+}
+#endif
+
 } // namespace facebook::react
@@ -7,6 +7,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
+
 #include <react/renderer/graphics/Float.h>
 #include <react/renderer/graphics/Point.h>
 #include <react/renderer/graphics/Rect.h>
@@ -20,6 +23,16 @@
 
 namespace facebook::react {
 
+#ifdef ANDROID
+// Constants for ScrollView state serialization, in sync with
+// ReactScrollViewHelper.java.
+constexpr static MapBuffer::Key SCROLL_STATE_KEY_CONTENT_OFFSET_LEFT = 0;
+constexpr static MapBuffer::Key SCROLL_STATE_KEY_CONTENT_OFFSET_TOP = 1;
+constexpr static MapBuffer::Key SCROLL_STATE_KEY_SCROLL_AWAY_PADDING_TOP = 2;
+constexpr static MapBuffer::Key
+    SCROLL_STATE_KEY_UPDATE_INTERVAL_WHILE_SCROLLING = 3;
+#endif
+
 /*
  * State for <ScrollView> component.
  */
@@ -40,23 +53,40 @@ class ScrollViewState final {
    */
   Size getContentSize() const;
 
+  /*
+   * Records that the content offset was read in C++, e.g. to measure a
+   * descendant of the ScrollView or to compute intersections with it, so the
+   * ScrollView has to send its content offset while it is being scrolled
+   * (see `ScrollViewShadowNode::getStateUpdateIntervalWhileScrolling`).
+   * Shared by all states of a ScrollView.
+   */
+  void markContentOffsetRead() const;
+  bool isContentOffsetRead() const;
+
 #ifdef ANDROID
   ScrollViewState(const ScrollViewState& previousState, folly::dynamic data)
       : contentOffset(
             {(Float)data["contentOffsetLeft"].getDouble(),
              (Float)data["contentOffsetTop"].getDouble()}),
         contentBoundingRect({}),
-        scrollAwayPaddingTop((Float)data["scrollAwayPaddingTop"].getDouble()){};
-
-  folly::dynamic getDynamic() const {
-    return folly::dynamic::object("contentOffsetLeft", contentOffset.x)(
-        "contentOffsetTop", contentOffset.y)(
-        "scrollAwayPaddingTop", scrollAwayPaddingTop);
-  };
-  MapBuffer getMapBuffer() const {
-    return MapBufferBuilder::EMPTY();
-  };
+        scrollAwayPaddingTop((Float)data["scrollAwayPaddingTop"].getDouble()),
+        contentOffsetRead_(previousState.contentOffsetRead_){};
+  ScrollViewState(const ScrollViewState& previousState, const MapBuffer& data)
+      : contentOffset(
+            {(Float)data.getDouble(SCROLL_STATE_KEY_CONTENT_OFFSET_LEFT),
+             (Float)data.getDouble(SCROLL_STATE_KEY_CONTENT_OFFSET_TOP)}),
+        contentBoundingRect({}),
+        scrollAwayPaddingTop(
+            (Float)data.getDouble(SCROLL_STATE_KEY_SCROLL_AWAY_PADDING_TOP)),
+        contentOffsetRead_(previousState.contentOffsetRead_){};
+
+  folly::dynamic getDynamic() const;
+  MapBuffer getMapBuffer() const;
 #endif
+
+ private:
+  std::shared_ptr<std::atomic<bool>> contentOffsetRead_{
+      std::make_shared<std::atomic<bool>>(false)};
 };
 
 } // namespace facebook::react
@@ -9,6 +9,30 @@
 
 #include <gtest/gtest.h>
 
+#include <react/renderer/components/scrollview/ScrollViewShadowNode.h>
+
+using namespace facebook::react;
+
 TEST(ScrollViewTest, testSomething) {
   // TODO
 }
+
+TEST(ScrollViewTest, testStateIsUpdatedWhileScrollingOnlyOnceOffsetIsRead) {
+  auto state = ScrollViewState{{0, 0}, {}, 0};
+  EXPECT_FALSE(
+      ScrollViewShadowNode::getStateUpdateIntervalWhileScrolling(state)
+          .has_value());
+
+  // Updates of the state keep track of reads of their previous states.
+  auto newState = state;
+  newState.contentOffset = {0, 100};
+  state.markContentOffsetRead();
+
+  EXPECT_TRUE(newState.isContentOffsetRead());
+  EXPECT_EQ(
+      ScrollViewShadowNode::getStateUpdateIntervalWhileScrolling(newState),
+      ScrollViewShadowNode::stateUpdateIntervalWhileScrollingMs);
+
+  // Other ScrollViews are not affected.
+  EXPECT_FALSE(ScrollViewState({0, 0}, {}, 0).isContentOffsetRead());
+}
@@ -29,6 +29,16 @@ void BaseTextShadowNode::buildAttributedString(
     const ShadowNode& parentNode,
     AttributedString& outAttributedString,
     Attachments& outAttachments) {
+  // Fragments sharing the same attributes also share an interned instance of
+  // them, which allows comparing them by identity.
+  auto internedTextAttributes = SharedTextAttributes{};
+  auto internTextAttributes = [&]() {
+    if (!internedTextAttributes) {
+      internedTextAttributes = TextAttributes::intern(baseTextAttributes);
+    }
+    return internedTextAttributes;
+  };
+
   for (const auto& childNode : parentNode.getChildren()) {
     // RawShadowNode
     auto rawTextShadowNode =
@@ -37,6 +47,7 @@ void BaseTextShadowNode::buildAttributedString(
       auto fragment = AttributedString::Fragment{};
       fragment.string = rawTextShadowNode->getConcreteProps().text;
       fragment.textAttributes = baseTextAttributes;
+      fragment.internedTextAttributes = internTextAttributes();
 
       // Storing a retaining pointer to `ParagraphShadowNode` inside
       // `attributedString` causes a retain cycle (besides that fact that we
@@ -66,6 +77,7 @@ void BaseTextShadowNode::buildAttributedString(
     fragment.string = AttributedString::Fragment::AttachmentCharacter();
     fragment.parentShadowView = shadowViewFromShadowNode(*childNode);
     fragment.textAttributes = baseTextAttributes;
+    fragment.internedTextAttributes = internTextAttributes();
     outAttributedString.appendFragment(fragment);
     outAttachments.push_back(Attachment{
         childNode.get(), outAttributedString.getFragments().size() - 1});
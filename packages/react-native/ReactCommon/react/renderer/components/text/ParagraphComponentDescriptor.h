@@ -11,6 +11,7 @@
 #include <react/renderer/core/ConcreteComponentDescriptor.h>
 #include <react/renderer/textlayoutmanager/TextLayoutManager.h>
 #include <react/utils/ContextContainer.h>
+#include <react/utils/CoreFeatures.h>
 
 namespace facebook::react {
 
@@ -25,6 +26,24 @@ class ParagraphComponentDescriptor final
     // Every single `ParagraphShadowNode` will have a reference to
     // a shared `TextLayoutManager`.
     textLayoutManager_ = std::make_shared<TextLayoutManager>(contextContainer_);
+
+    if (CoreFeatures::enableParagraphPreMeasurement && contextContainer_) {
+      // Measuring text ahead of layout on an executor set up by the platform.
+      auto preMeasurementExecutor =
+          contextContainer_
+              ->find<ParagraphLayoutManager::PreMeasurementExecutor>(
+                  "TextPreMeasurementExecutor");
+      if (preMeasurementExecutor) {
+        preMeasurementExecutor_ = std::make_shared<
+            const ParagraphLayoutManager::PreMeasurementExecutor>(
+            std::move(*preMeasurementExecutor));
+      }
+    }
+  }
+
+  void didReceiveMemoryPressure(MemoryPressureLevel level) const override {
+    ConcreteComponentDescriptor::didReceiveMemoryPressure(level);
+    textLayoutManager_->didReceiveMemoryPressure(level);
   }
 
  protected:
@@ -36,10 +55,16 @@ class ParagraphComponentDescriptor final
     // `ParagraphShadowNode` uses `TextLayoutManager` to measure text content
     // and communicate text rendering metrics to mounting layer.
     paragraphShadowNode.setTextLayoutManager(textLayoutManager_);
+
+    if (preMeasurementExecutor_) {
+      paragraphShadowNode.setPreMeasurementExecutor(preMeasurementExecutor_);
+    }
   }
 
  private:
   std::shared_ptr<const TextLayoutManager> textLayoutManager_;
+  std::shared_ptr<const ParagraphLayoutManager::PreMeasurementExecutor>
+      preMeasurementExecutor_;
 };
 
 } // namespace facebook::react
@@ -17,20 +17,21 @@ TextMeasurement ParagraphLayoutManager::measure(
     const TextLayoutContext& layoutContext,
     LayoutConstraints layoutConstraints) const {
   if (CoreFeatures::cacheLastTextMeasurement) {
+    std::lock_guard<std::mutex> lock(cache_->mutex);
     bool shouldMeasure = shouldMeasureString(
         attributedString, paragraphAttributes, layoutConstraints);
 
     if (shouldMeasure) {
-      cachedTextMeasurement_ = textLayoutManager_->measure(
+      cache_->cachedTextMeasurement = textLayoutManager_->measure(
           AttributedStringBox(attributedString),
           paragraphAttributes,
           layoutContext,
           layoutConstraints,
-          hostTextStorage_);
-      lastAvailableWidth_ = layoutConstraints.maximumSize.width;
+          cache_->hostTextStorage);
+      cache_->lastAvailableWidth = layoutConstraints.maximumSize.width;
     }
 
-    return cachedTextMeasurement_;
+    return cache_->cachedTextMeasurement;
   } else {
     return textLayoutManager_->measure(
         AttributedStringBox(attributedString),
@@ -41,6 +42,29 @@ TextMeasurement ParagraphLayoutManager::measure(
   }
 }
 
+void ParagraphLayoutManager::preMeasure(
+    const AttributedString& attributedString,
+    const ParagraphAttributes& paragraphAttributes,
+    const TextLayoutContext& layoutContext,
+    LayoutConstraints layoutConstraints) const {
+  if (!preMeasurementExecutor_ || !textLayoutManager_) {
+    return;
+  }
+
+  (*preMeasurementExecutor_)([textLayoutManager = textLayoutManager_,
+                              attributedString,
+                              paragraphAttributes,
+                              layoutContext,
+                              layoutConstraints]() {
+    textLayoutManager->measure(
+        AttributedStringBox(attributedString),
+        paragraphAttributes,
+        layoutContext,
+        layoutConstraints,
+        nullptr);
+  });
+}
+
 bool ParagraphLayoutManager::shouldMeasureString(
     const AttributedString& attributedString,
     const ParagraphAttributes& paragraphAttributes,
@@ -48,12 +72,12 @@ bool ParagraphLayoutManager::shouldMeasureString(
   size_t newParagraphInputHash =
       hash_combine(attributedString, paragraphAttributes);
 
-  if (newParagraphInputHash != paragraphInputHash_) {
+  if (newParagraphInputHash != cache_->paragraphInputHash) {
     // AttributedString or ParagraphAttributes have changed.
     // Must create new host text storage and trigger measure.
-    hostTextStorage_ = textLayoutManager_->getHostTextStorage(
+    cache_->hostTextStorage = textLayoutManager_->getHostTextStorage(
         attributedString, paragraphAttributes, layoutConstraints);
-    paragraphInputHash_ = newParagraphInputHash;
+    cache_->paragraphInputHash = newParagraphInputHash;
 
     return true; // Must measure again.
   }
@@ -62,14 +86,14 @@ bool ParagraphLayoutManager::shouldMeasureString(
   // This is to prevent unnecessary re-creation of NSTextStorage on iOS.
   // On Android, this is no-op.
   bool hasMaximumSizeChanged =
-      layoutConstraints.maximumSize.width != lastAvailableWidth_;
+      layoutConstraints.maximumSize.width != cache_->lastAvailableWidth;
   Float threshold = 0.01f;
   bool doesMaximumSizeMatchLastMeasurement =
       std::abs(
           layoutConstraints.maximumSize.width -
-          cachedTextMeasurement_.size.width) < threshold;
+          cache_->cachedTextMeasurement.size.width) < threshold;
   if (hasMaximumSizeChanged && !doesMaximumSizeMatchLastMeasurement) {
-    hostTextStorage_ = textLayoutManager_->getHostTextStorage(
+    cache_->hostTextStorage = textLayoutManager_->getHostTextStorage(
         attributedString, paragraphAttributes, layoutConstraints);
     return true;
   }
@@ -94,7 +118,20 @@ ParagraphLayoutManager::getTextLayoutManager() const {
   return textLayoutManager_;
 }
 
-std::shared_ptr<void> ParagraphLayoutManager::getHostTextStorage() const {
-  return hostTextStorage_;
+void ParagraphLayoutManager::setPreMeasurementExecutor(
+    std::shared_ptr<const PreMeasurementExecutor> preMeasurementExecutor)
+    const {
+  preMeasurementExecutor_ = std::move(preMeasurementExecutor);
+}
+
+std::shared_ptr<void> ParagraphLayoutManager::getHostTextStorage(
+    const AttributedString& attributedString,
+    const ParagraphAttributes& paragraphAttributes) const {
+  auto paragraphInputHash = hash_combine(attributedString, paragraphAttributes);
+  std::lock_guard<std::mutex> lock(cache_->mutex);
+  if (paragraphInputHash != cache_->paragraphInputHash) {
+    return nullptr;
+  }
+  return cache_->hostTextStorage;
 }
 } // namespace facebook::react
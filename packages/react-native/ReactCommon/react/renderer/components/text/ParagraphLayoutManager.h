@@ -7,6 +7,10 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
+#include <mutex>
+
 #include <react/renderer/attributedstring/AttributedString.h>
 #include <react/renderer/attributedstring/ParagraphAttributes.h>
 #include <react/renderer/core/LayoutConstraints.h>
@@ -21,15 +25,33 @@ namespace facebook::react {
  * sure only one `NSTextStorage` is created for every string. `NSTextStorage`
  * can be re created on native views layer but it is expensive. On Android, this
  * class does not cache anything.
+ * Copies share their cache, so all revisions of a paragraph retain only the
+ * results of its latest measurement rather than one per revision.
  */
 class ParagraphLayoutManager {
  public:
+  /*
+   * Runs tasks on a background thread able to measure text.
+   */
+  using PreMeasurementExecutor =
+      std::function<void(std::function<void()>&& task)>;
+
   TextMeasurement measure(
       const AttributedString& attributedString,
       const ParagraphAttributes& paragraphAttributes,
       const TextLayoutContext& layoutContext,
       LayoutConstraints layoutConstraints) const;
 
+  /*
+   * Measures `attributedString` on the pre-measurement executor, if one was
+   * set, so the measurement is found in `TextMeasureCache` later.
+   */
+  void preMeasure(
+      const AttributedString& attributedString,
+      const ParagraphAttributes& paragraphAttributes,
+      const TextLayoutContext& layoutContext,
+      LayoutConstraints layoutConstraints) const;
+
   LinesMeasurements measureLines(
       const AttributedString& attributedString,
       const ParagraphAttributes& paragraphAttributes,
@@ -44,47 +66,66 @@ class ParagraphLayoutManager {
    */
   std::shared_ptr<const TextLayoutManager> getTextLayoutManager() const;
 
+  void setPreMeasurementExecutor(
+      std::shared_ptr<const PreMeasurementExecutor> preMeasurementExecutor)
+      const;
+
   /*
-   * Returns opaque shared_ptr holding `NSTextStorage`.
-   * May be nullptr.
+   * Returns opaque shared_ptr holding `NSTextStorage` of given
+   * `attributedString` and `paragraphAttributes`.
+   * May be nullptr, e.g. if the paragraph was measured with another string
+   * since.
    * Is used on a native views layer to prevent `NSTextStorage` from being
    * created twice.
    */
-  std::shared_ptr<void> getHostTextStorage() const;
+  std::shared_ptr<void> getHostTextStorage(
+      const AttributedString& attributedString,
+      const ParagraphAttributes& paragraphAttributes) const;
 
  private:
-  std::shared_ptr<const TextLayoutManager> mutable textLayoutManager_{};
-
   /*
-   * Stores opaque pointer to `NSTextStorage` on iOS. nullptr on Android.
-   * TODO: In the future, we may want to cache Android's text storage.
+   * Results of the latest measurement of the paragraph, shared by all copies.
    */
-  std::shared_ptr<void> mutable hostTextStorage_{};
+  struct Cache {
+    std::mutex mutex;
 
-  /*
-   * Hash of AttributedString and ParagraphAttributes last used to
-   * measure. Result of that measure is stored in cachedTextMeasurement_.
-   * The available width defined for the measurement is stored in
-   * lastAvailableWidth_.
-   */
-  size_t mutable paragraphInputHash_{};
-
-  /* The width Yoga set as maximum width.
-   * Yoga calls measure twice with two
-   * different maximum width. One of available space.
-   * The other one is exact space needed for the string.
-   * This happens when node is dirtied but its size is not affected.
-   * To deal with this inefficiency, we cache `TextMeasurement` for each
-   * `ParagraphShadowNode`. If Yoga tries to re-measure with available width
-   * or exact width, we provide it with the cached value.
-   */
-  Float mutable lastAvailableWidth_{};
-  TextMeasurement mutable cachedTextMeasurement_{};
+    /*
+     * Stores opaque pointer to `NSTextStorage` on iOS. nullptr on Android.
+     * TODO: In the future, we may want to cache Android's text storage.
+     */
+    std::shared_ptr<void> hostTextStorage{};
+
+    /*
+     * Hash of AttributedString and ParagraphAttributes last used to
+     * measure. Result of that measure is stored in cachedTextMeasurement.
+     * The available width defined for the measurement is stored in
+     * lastAvailableWidth.
+     */
+    size_t paragraphInputHash{};
+
+    /* The width Yoga set as maximum width.
+     * Yoga calls measure twice with two
+     * different maximum width. One of available space.
+     * The other one is exact space needed for the string.
+     * This happens when node is dirtied but its size is not affected.
+     * To deal with this inefficiency, we cache `TextMeasurement` for each
+     * `ParagraphShadowNode`. If Yoga tries to re-measure with available width
+     * or exact width, we provide it with the cached value.
+     */
+    Float lastAvailableWidth{};
+    TextMeasurement cachedTextMeasurement{};
+  };
+
+  std::shared_ptr<const TextLayoutManager> mutable textLayoutManager_{};
+  std::shared_ptr<const PreMeasurementExecutor> mutable
+      preMeasurementExecutor_{};
+
+  std::shared_ptr<Cache> cache_{std::make_shared<Cache>()};
 
   /*
    * Checks whether the inputs into text measurement meaningfully affect
    * text measurement result. Returns true if inputs have changed and measure is
-   * needed.
+   * needed. Must be called with the mutex of the cache locked.
    */
   bool shouldMeasureString(
       const AttributedString& attributedString,
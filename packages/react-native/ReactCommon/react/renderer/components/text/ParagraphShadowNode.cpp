@@ -8,6 +8,7 @@
 #include "ParagraphShadowNode.h"
 
 #include <cmath>
+#include <limits>
 
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/attributedstring/AttributedStringBox.h>
@@ -59,6 +60,13 @@ const Content& ParagraphShadowNode::getContent(
   auto attachments = Attachments{};
   buildAttributedString(textAttributes, *this, attributedString, attachments);
 
+  // Sharing the string of the state if it is equal, so revisions of the
+  // paragraph with the same text don't each retain a copy of it.
+  const auto& stateAttributedString = getStateData().attributedString;
+  if (attributedString == stateAttributedString) {
+    attributedString = stateAttributedString;
+  }
+
   content_ = Content{
       attributedString, getConcreteProps().paragraphAttributes, attachments};
 
@@ -79,8 +87,6 @@ Content ParagraphShadowNode::getContentWithMeasuredAttachments(
   // Having enforced minimum size for text fragments doesn't make much sense.
   localLayoutConstraints.minimumSize = Size{0, 0};
 
-  auto& fragments = content.attributedString.getFragments();
-
   for (const auto& attachment : content.attachments) {
     auto laytableShadowNode =
         dynamic_cast<const LayoutableShadowNode*>(attachment.shadowNode);
@@ -100,8 +106,8 @@ Content ParagraphShadowNode::getContentWithMeasuredAttachments(
     auto fragmentLayoutMetrics = LayoutMetrics{};
     fragmentLayoutMetrics.pointScaleFactor = layoutContext.pointScaleFactor;
     fragmentLayoutMetrics.frame.size = size;
-    fragments[attachment.fragmentIndex].parentShadowView.layoutMetrics =
-        fragmentLayoutMetrics;
+    content.attributedString.setFragmentLayoutMetrics(
+        attachment.fragmentIndex, fragmentLayoutMetrics);
   }
 
   return content;
@@ -114,6 +120,14 @@ void ParagraphShadowNode::setTextLayoutManager(
       std::move(textLayoutManager));
 }
 
+void ParagraphShadowNode::setPreMeasurementExecutor(
+    std::shared_ptr<const ParagraphLayoutManager::PreMeasurementExecutor>
+        preMeasurementExecutor) {
+  ensureUnsealed();
+  getStateData().paragraphLayoutManager.setPreMeasurementExecutor(
+      std::move(preMeasurementExecutor));
+}
+
 void ParagraphShadowNode::updateStateIfNeeded(const Content& content) {
   ensureUnsealed();
 
@@ -164,6 +178,92 @@ Size ParagraphShadowNode::measureContent(
       .size;
 }
 
+std::vector<Size> ParagraphShadowNode::measureContentBatch(
+    const LayoutContext& layoutContext,
+    const std::vector<const LayoutableShadowNode*>& nodes,
+    const std::vector<LayoutConstraints>& layoutConstraints) const {
+  // Building the same requests as `measureContent` measures.
+  auto requests = std::vector<TextMeasureCacheKey>{};
+  requests.reserve(nodes.size());
+  for (size_t i = 0; i < nodes.size(); i++) {
+    const auto& paragraphShadowNode =
+        static_cast<const ParagraphShadowNode&>(*nodes[i]);
+    auto content = paragraphShadowNode.getContentWithMeasuredAttachments(
+        layoutContext, layoutConstraints[i]);
+
+    auto attributedString = content.attributedString;
+    if (attributedString.isEmpty()) {
+      auto textAttributes = TextAttributes::defaultTextAttributes();
+      textAttributes.fontSizeMultiplier = layoutContext.fontSizeMultiplier;
+      textAttributes.apply(
+          paragraphShadowNode.getConcreteProps().textAttributes);
+      attributedString.appendFragment(
+          {BaseTextShadowNode::getEmptyPlaceholder(), textAttributes, {}});
+    }
+
+    requests.push_back(TextMeasureCacheKey{
+        std::move(attributedString),
+        content.paragraphAttributes,
+        layoutConstraints[i]});
+  }
+
+  TextLayoutContext textLayoutContext{};
+  textLayoutContext.pointScaleFactor = layoutContext.pointScaleFactor;
+  auto measurements =
+      getStateData()
+          .paragraphLayoutManager.getTextLayoutManager()
+          ->measureBatch(requests, textLayoutContext);
+
+  auto sizes = std::vector<Size>{};
+  sizes.reserve(measurements.size());
+  for (const auto& measurement : measurements) {
+    sizes.push_back(measurement.size);
+  }
+  return sizes;
+}
+
+void ParagraphShadowNode::prepareMeasurement(
+    const LayoutContext& layoutContext,
+    Float likelyWidth) const {
+  // Building the same string as `getContent` does, without caching it, as
+  // the layout direction is only known after layout. It does not affect
+  // measurements.
+  auto textAttributes = TextAttributes::defaultTextAttributes();
+  textAttributes.fontSizeMultiplier = layoutContext.fontSizeMultiplier;
+  textAttributes.apply(getConcreteProps().textAttributes);
+  auto attributedString = AttributedString{};
+  auto attachments = Attachments{};
+  buildAttributedString(textAttributes, *this, attributedString, attachments);
+
+  if (!attachments.empty()) {
+    // Measuring attachments requires laying them out.
+    return;
+  }
+
+  if (attributedString.isEmpty()) {
+    attributedString.appendFragment(
+        {BaseTextShadowNode::getEmptyPlaceholder(), textAttributes, {}});
+  }
+
+  // A paragraph which was laid out before is most likely measured at the same
+  // width again; a new one at the width of its container.
+  auto layoutMetrics = getLayoutMetrics();
+  if (layoutMetrics != EmptyLayoutMetrics) {
+    likelyWidth = layoutMetrics.getContentFrame().size.width;
+  }
+
+  TextLayoutContext textLayoutContext{};
+  textLayoutContext.pointScaleFactor = layoutContext.pointScaleFactor;
+  getStateData().paragraphLayoutManager.preMeasure(
+      attributedString,
+      getConcreteProps().paragraphAttributes,
+      textLayoutContext,
+      LayoutConstraints{
+          Size{0, 0},
+          Size{likelyWidth, std::numeric_limits<Float>::infinity()},
+          layoutMetrics.layoutDirection});
+}
+
 void ParagraphShadowNode::layout(LayoutContext layoutContext) {
   ensureUnsealed();
 
@@ -38,6 +38,9 @@ class ParagraphShadowNode final : public ConcreteViewShadowNode<
       const ShadowNode& sourceShadowNode,
       const ShadowNodeFragment& fragment);
 
+  // Paragraphs in lists are often created with equal props.
+  static constexpr bool InternsProps = true;
+
   static ShadowNodeTraits BaseTraits() {
     auto traits = ConcreteViewShadowNode::BaseTraits();
     traits.set(ShadowNodeTraits::Trait::LeafYogaNode);
@@ -60,9 +63,24 @@ class ParagraphShadowNode final : public ConcreteViewShadowNode<
   void setTextLayoutManager(
       std::shared_ptr<const TextLayoutManager> textLayoutManager);
 
+  /*
+   * Associates a shared executor with the node, which measures its text ahead
+   * of layout.
+   */
+  void setPreMeasurementExecutor(
+      std::shared_ptr<const ParagraphLayoutManager::PreMeasurementExecutor>
+          preMeasurementExecutor);
+
 #pragma mark - LayoutableShadowNode
 
   void layout(LayoutContext layoutContext) override;
+  std::vector<Size> measureContentBatch(
+      const LayoutContext& layoutContext,
+      const std::vector<const LayoutableShadowNode*>& nodes,
+      const std::vector<LayoutConstraints>& layoutConstraints) const override;
+  void prepareMeasurement(
+      const LayoutContext& layoutContext,
+      Float likelyWidth) const override;
   Size measureContent(
       const LayoutContext& layoutContext,
       const LayoutConstraints& layoutConstraints) const override;
@@ -26,6 +26,9 @@ constexpr static MapBuffer::Key TX_STATE_KEY_PARAGRAPH_ATTRIBUTES = 1;
 // Used for TextInput only
 constexpr static MapBuffer::Key TX_STATE_KEY_HASH = 2;
 constexpr static MapBuffer::Key TX_STATE_KEY_MOST_RECENT_EVENT_COUNT = 3;
+constexpr static MapBuffer::Key TX_STATE_KEY_OPAQUE_CACHE_ID = 4;
+constexpr static MapBuffer::Key TX_STATE_KEY_EDIT_START = 5;
+constexpr static MapBuffer::Key TX_STATE_KEY_EDIT_END = 6;
 #endif
 
 /*
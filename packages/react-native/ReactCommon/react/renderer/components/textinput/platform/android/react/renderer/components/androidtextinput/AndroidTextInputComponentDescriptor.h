@@ -34,6 +34,11 @@ class AndroidTextInputComponentDescriptor final
     textLayoutManager_ = std::make_shared<TextLayoutManager>(contextContainer_);
   }
 
+  void didReceiveMemoryPressure(MemoryPressureLevel level) const override {
+    ConcreteComponentDescriptor::didReceiveMemoryPressure(level);
+    textLayoutManager_->didReceiveMemoryPressure(level);
+  }
+
   virtual State::Shared createInitialState(
       const Props::Shared& props,
       const ShadowNodeFamily::Shared& family) const override {
@@ -17,7 +17,11 @@
 #include <react/renderer/core/LayoutContext.h>
 #include <react/renderer/core/conversions.h>
 #include <react/renderer/textlayoutmanager/TextLayoutContext.h>
+#include <react/utils/CoreFeatures.h>
 
+#include <algorithm>
+#include <optional>
+#include <string_view>
 #include <utility>
 
 using namespace facebook::jni;
@@ -26,6 +30,104 @@ namespace facebook::react {
 
 extern const char AndroidTextInputComponentName[] = "AndroidTextInput";
 
+namespace {
+
+bool isUTF8ContinuationByte(char byte) {
+  return (static_cast<unsigned char>(byte) & 0xC0) == 0x80;
+}
+
+// Returns the length in UTF-16 code units (as used by Java) of a range of
+// UTF-8 bytes which starts and ends at boundaries of code points.
+int64_t utf16Length(std::string_view string) {
+  auto length = int64_t{0};
+  for (auto byte : string) {
+    if (!isUTF8ContinuationByte(byte)) {
+      // Code points of four bytes take a surrogate pair.
+      length += static_cast<unsigned char>(byte) >= 0xF0 ? 2 : 1;
+    }
+  }
+  return length;
+}
+
+struct TextEdit {
+  int64_t start{-1};
+  int64_t end{-1};
+};
+
+// Returns the range of `previous` replaced to get `next`, when the strings
+// only differ by the text of a single fragment (e.g. when text is typed into
+// a plain input). Other differences (e.g. of the attributes or the number of
+// fragments) are not described by a range.
+TextEdit findTextEdit(
+    const AttributedString& previous,
+    const AttributedString& next) {
+  const auto& previousFragments = previous.getFragments();
+  const auto& nextFragments = next.getFragments();
+  if (previousFragments.size() != nextFragments.size()) {
+    return {};
+  }
+
+  auto offset = int64_t{0};
+  auto editedFragmentIndex = std::optional<size_t>{};
+  for (size_t i = 0; i < previousFragments.size(); i++) {
+    const auto& previousFragment = previousFragments[i];
+    const auto& nextFragment = nextFragments[i];
+    if (previousFragment.isContentEqual(nextFragment)) {
+      if (!editedFragmentIndex) {
+        offset += utf16Length(previousFragment.string);
+      }
+      continue;
+    }
+    if (editedFragmentIndex || previousFragment.isAttachment() ||
+        nextFragment.isAttachment() ||
+        !(previousFragment.hasIdenticalTextAttributes(nextFragment) ||
+          previousFragment.textAttributes == nextFragment.textAttributes)) {
+      return {};
+    }
+    editedFragmentIndex = i;
+  }
+
+  if (!editedFragmentIndex) {
+    return {offset, offset};
+  }
+
+  auto previousString =
+      std::string_view{previousFragments[*editedFragmentIndex].string};
+  auto nextString = std::string_view{nextFragments[*editedFragmentIndex].string};
+  auto maxLength = std::min(previousString.size(), nextString.size());
+
+  auto prefixLength = size_t{0};
+  while (prefixLength < maxLength &&
+         previousString[prefixLength] == nextString[prefixLength]) {
+    prefixLength++;
+  }
+  // Strings differing within a code point differ from its first byte on.
+  while (prefixLength > 0 && prefixLength < previousString.size() &&
+         isUTF8ContinuationByte(previousString[prefixLength])) {
+    prefixLength--;
+  }
+
+  auto suffixLength = size_t{0};
+  while (suffixLength < maxLength - prefixLength &&
+         previousString[previousString.size() - suffixLength - 1] ==
+             nextString[nextString.size() - suffixLength - 1]) {
+    suffixLength++;
+  }
+  while (suffixLength > 0 &&
+         isUTF8ContinuationByte(
+             previousString[previousString.size() - suffixLength])) {
+    suffixLength--;
+  }
+
+  auto start = offset + utf16Length(previousString.substr(0, prefixLength));
+  auto end = start +
+      utf16Length(previousString.substr(
+          prefixLength, previousString.size() - prefixLength - suffixLength));
+  return {start, end};
+}
+
+} // namespace
+
 void AndroidTextInputShadowNode::setContextContainer(
     ContextContainer* contextContainer) {
   ensureUnsealed();
@@ -96,11 +198,23 @@ void AndroidTextInputShadowNode::setTextLayoutManager(
   textLayoutManager_ = std::move(textLayoutManager);
 }
 
+const AttributedString&
+AndroidTextInputShadowNode::getReactTreeAttributedString() const {
+  // Props and children don't change while the node is laid out, so the
+  // string can be built once for all of its measurements and the update of
+  // its state.
+  if (!cachedAttributedString_ ||
+      !CoreFeatures::enableIncrementalTextInputUpdates) {
+    cachedAttributedString_ = getAttributedString();
+  }
+  return *cachedAttributedString_;
+}
+
 AttributedString AndroidTextInputShadowNode::getMostRecentAttributedString()
     const {
   const auto& state = getStateData();
 
-  auto reactTreeAttributedString = getAttributedString();
+  const auto& reactTreeAttributedString = getReactTreeAttributedString();
 
   // Sometimes the treeAttributedString will only differ from the state
   // not by inherent properties (string or prop attributes), but by the frame of
@@ -118,7 +232,7 @@ AttributedString AndroidTextInputShadowNode::getMostRecentAttributedString()
 void AndroidTextInputShadowNode::updateStateIfNeeded() {
   ensureUnsealed();
 
-  auto reactTreeAttributedString = getAttributedString();
+  const auto& reactTreeAttributedString = getReactTreeAttributedString();
   const auto& state = getStateData();
 
   // Tree is often out of sync with the value of the TextInput.
@@ -144,7 +258,7 @@ void AndroidTextInputShadowNode::updateStateIfNeeded() {
       : getConcreteProps().mostRecentEventCount;
   auto newAttributedString = getMostRecentAttributedString();
 
-  setStateData(AndroidTextInputState{
+  auto newState = AndroidTextInputState{
       newEventCount,
       newAttributedString,
       reactTreeAttributedString,
@@ -152,7 +266,19 @@ void AndroidTextInputShadowNode::updateStateIfNeeded() {
       state.defaultThemePaddingStart,
       state.defaultThemePaddingEnd,
       state.defaultThemePaddingTop,
-      state.defaultThemePaddingBottom});
+      state.defaultThemePaddingBottom};
+
+  // Lets Java replace only the edited range of the text of the view, so that
+  // the layout of the rest of the text is kept. Java checks that the text
+  // around the range matches, as it may have changed since the previous
+  // state.
+  if (CoreFeatures::enableIncrementalTextInputUpdates && newEventCount != 0) {
+    auto edit = findTextEdit(state.attributedString, newAttributedString);
+    newState.editStart = edit.start;
+    newState.editEnd = edit.end;
+  }
+
+  setStateData(std::move(newState));
 }
 
 #pragma mark - LayoutableShadowNode
@@ -62,6 +62,12 @@ class AndroidTextInputShadowNode final : public ConcreteViewShadowNode<
  private:
   ContextContainer* contextContainer_{};
 
+  /*
+   * Returns the attributed string built from props and children (see
+   * `getAttributedString`), memoized in `cachedAttributedString_`.
+   */
+  const AttributedString& getReactTreeAttributedString() const;
+
   /**
    * Get the most up-to-date attributed string for measurement and State.
    */
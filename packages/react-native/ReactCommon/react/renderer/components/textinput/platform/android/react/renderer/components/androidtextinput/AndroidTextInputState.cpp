@@ -65,6 +65,25 @@ AndroidTextInputState::AndroidTextInputState(
                                         previousState.defaultThemePaddingBottom)
                                     .getDouble()){};
 
+AndroidTextInputState::AndroidTextInputState(
+    const AndroidTextInputState& previousState,
+    const MapBuffer& data)
+    : mostRecentEventCount(
+          data.contains(TX_STATE_KEY_MOST_RECENT_EVENT_COUNT)
+              ? data.getInt(TX_STATE_KEY_MOST_RECENT_EVENT_COUNT)
+              : previousState.mostRecentEventCount),
+      cachedAttributedStringId(
+          data.contains(TX_STATE_KEY_OPAQUE_CACHE_ID)
+              ? data.getInt(TX_STATE_KEY_OPAQUE_CACHE_ID)
+              : previousState.cachedAttributedStringId),
+      attributedString(previousState.attributedString),
+      reactTreeAttributedString(previousState.reactTreeAttributedString),
+      paragraphAttributes(previousState.paragraphAttributes),
+      defaultThemePaddingStart(previousState.defaultThemePaddingStart),
+      defaultThemePaddingEnd(previousState.defaultThemePaddingEnd),
+      defaultThemePaddingTop(previousState.defaultThemePaddingTop),
+      defaultThemePaddingBottom(previousState.defaultThemePaddingBottom) {}
+
 folly::dynamic AndroidTextInputState::getDynamic() const {
   // Java doesn't need all fields, so we don't pass them all along.
   folly::dynamic newState = folly::dynamic::object();
@@ -80,6 +99,10 @@ folly::dynamic AndroidTextInputState::getDynamic() const {
     newState["hash"] = newState["attributedString"]["hash"];
     newState["paragraphAttributes"] =
         toDynamic(paragraphAttributes); // TODO: can we memoize this in Java?
+    if (editStart >= 0) {
+      newState["editStart"] = editStart;
+      newState["editEnd"] = editEnd;
+    }
   }
   return newState;
 }
@@ -99,6 +122,11 @@ MapBuffer AndroidTextInputState::getMapBuffer() const {
     builder.putMapBuffer(TX_STATE_KEY_PARAGRAPH_ATTRIBUTES, paMapBuffer);
 
     builder.putInt(TX_STATE_KEY_HASH, attStringMapBuffer.getInt(AS_KEY_HASH));
+
+    if (editStart >= 0) {
+      builder.putInt(TX_STATE_KEY_EDIT_START, static_cast<int32_t>(editStart));
+      builder.putInt(TX_STATE_KEY_EDIT_END, static_cast<int32_t>(editEnd));
+    }
   }
   return builder.build();
 }
@@ -44,6 +44,15 @@ class AndroidTextInputState final {
    */
   AttributedString reactTreeAttributedString{};
 
+  /*
+   * The range (in UTF-16 code units, as used by Java) of `attributedString`
+   * of the previous state replaced by `attributedString`, if the strings only
+   * differ within a single fragment; -1 otherwise. The text after the range
+   * is the same in both strings.
+   */
+  int64_t editStart{-1};
+  int64_t editEnd{-1};
+
   /*
    * Represents all visual attributes of a paragraph of text represented as
    * a ParagraphAttributes.
@@ -73,6 +82,9 @@ class AndroidTextInputState final {
   AndroidTextInputState(
       const AndroidTextInputState& previousState,
       const folly::dynamic& data);
+  AndroidTextInputState(
+      const AndroidTextInputState& previousState,
+      const MapBuffer& data);
   folly::dynamic getDynamic() const;
   MapBuffer getMapBuffer() const;
 };
@@ -24,6 +24,11 @@ class TextInputComponentDescriptor final
         std::make_shared<const TextLayoutManager>(contextContainer_);
   }
 
+  void didReceiveMemoryPressure(MemoryPressureLevel level) const override {
+    ConcreteComponentDescriptor::didReceiveMemoryPressure(level);
+    textLayoutManager_->didReceiveMemoryPressure(level);
+  }
+
  protected:
   void adopt(ShadowNode& shadowNode) const override {
     ConcreteComponentDescriptor::adopt(shadowNode);
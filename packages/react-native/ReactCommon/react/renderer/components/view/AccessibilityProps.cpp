@@ -11,10 +11,137 @@
 #include <react/renderer/components/view/propsConversions.h>
 #include <react/renderer/core/propsConversions.h>
 #include <react/renderer/debug/debugStringConvertibleUtils.h>
+#include <react/utils/ContextContainer.h>
 #include <react/utils/CoreFeatures.h>
 
+#include <array>
+
 namespace facebook::react {
 
+namespace {
+
+constexpr std::array<const char*, 7> kLazyPropNames = {
+    "accessibilityState",
+    "accessibilityLabel",
+    "accessibilityLabelledBy",
+    "accessibilityHint",
+    "accessibilityLanguage",
+    "accessibilityValue",
+    "accessibilityActions",
+};
+
+void setRawValue(
+    folly::dynamic& rawValues,
+    const char* propName,
+    const RawValue& value) {
+  // `null` means "the prop was removed".
+  if (value.hasValue()) {
+    rawValues[propName] = (folly::dynamic)value;
+  } else {
+    rawValues.erase(propName);
+  }
+}
+
+template <typename T>
+void parseRawValue(
+    const PropsParserContext& context,
+    const std::string& propName,
+    const RawValue& value,
+    T& result) {
+  try {
+    T parsedValue;
+    fromRawValue(context, value, parsedValue);
+    result = std::move(parsedValue);
+  } catch (const std::exception& e) {
+    LOG(ERROR) << "Error while converting prop '" << propName
+               << "': " << e.what();
+  }
+}
+
+} // namespace
+
+#pragma mark - LazyAccessibilityProps
+
+LazyAccessibilityProps::LazyAccessibilityProps(
+    SurfaceId surfaceId,
+    folly::dynamic rawValues)
+    : surfaceId_(surfaceId), rawValues_(std::move(rawValues)) {}
+
+LazyAccessibilityProps::Shared LazyAccessibilityProps::create(
+    const PropsParserContext& context,
+    const Shared& source,
+    const RawProps& rawProps) {
+  auto rawValues = std::optional<folly::dynamic>{};
+  for (const auto* propName : kLazyPropNames) {
+    const auto* value = rawProps.at(propName, nullptr, nullptr);
+    if (value == nullptr) [[likely]] {
+      continue;
+    }
+    if (!rawValues) {
+      rawValues = source ? source->rawValues_ : folly::dynamic::object();
+    }
+    setRawValue(*rawValues, propName, *value);
+  }
+
+  if (!rawValues) {
+    return source;
+  }
+  return fromRawValues(context.surfaceId, std::move(*rawValues));
+}
+
+LazyAccessibilityProps::Shared LazyAccessibilityProps::assign(
+    const PropsParserContext& context,
+    const Shared& source,
+    const char* propName,
+    const RawValue& value) {
+  auto rawValues = source ? source->rawValues_ : folly::dynamic::object();
+  setRawValue(rawValues, propName, value);
+  return fromRawValues(context.surfaceId, std::move(rawValues));
+}
+
+LazyAccessibilityProps::Shared LazyAccessibilityProps::fromRawValues(
+    SurfaceId surfaceId,
+    folly::dynamic rawValues) {
+  if (rawValues.empty()) {
+    return nullptr;
+  }
+  return std::make_shared<const LazyAccessibilityProps>(
+      surfaceId, std::move(rawValues));
+}
+
+const LazyAccessibilityProps::Values& LazyAccessibilityProps::getValues()
+    const {
+  std::call_once(parseFlag_, [this]() {
+    // None of the accessibility props needs the context container.
+    static const auto contextContainer = ContextContainer{};
+    auto context = PropsParserContext{surfaceId_, contextContainer};
+
+    for (const auto& [name, rawValue] : rawValues_.items()) {
+      const auto& propName = name.getString();
+      const auto value = RawValue{rawValue};
+      if (propName == "accessibilityState") {
+        parseRawValue(context, propName, value, values_.accessibilityState);
+      } else if (propName == "accessibilityLabel") {
+        parseRawValue(context, propName, value, values_.accessibilityLabel);
+      } else if (propName == "accessibilityLabelledBy") {
+        parseRawValue(
+            context, propName, value, values_.accessibilityLabelledBy);
+      } else if (propName == "accessibilityHint") {
+        parseRawValue(context, propName, value, values_.accessibilityHint);
+      } else if (propName == "accessibilityLanguage") {
+        parseRawValue(context, propName, value, values_.accessibilityLanguage);
+      } else if (propName == "accessibilityValue") {
+        parseRawValue(context, propName, value, values_.accessibilityValue);
+      } else if (propName == "accessibilityActions") {
+        parseRawValue(context, propName, value, values_.accessibilityActions);
+      }
+    }
+  });
+  return values_;
+}
+
+#pragma mark - AccessibilityProps
+
 AccessibilityProps::AccessibilityProps(
     const PropsParserContext& context,
     const AccessibilityProps& sourceProps,
@@ -27,33 +154,6 @@ AccessibilityProps::AccessibilityProps(
                                                        "accessible",
                                                        sourceProps.accessible,
                                                        false)),
-      accessibilityState(
-          CoreFeatures::enablePropIteratorSetter
-              ? sourceProps.accessibilityState
-              : convertRawProp(
-                    context,
-                    rawProps,
-                    "accessibilityState",
-                    sourceProps.accessibilityState,
-                    {})),
-      accessibilityLabel(
-          CoreFeatures::enablePropIteratorSetter
-              ? sourceProps.accessibilityLabel
-              : convertRawProp(
-                    context,
-                    rawProps,
-                    "accessibilityLabel",
-                    sourceProps.accessibilityLabel,
-                    "")),
-      accessibilityLabelledBy(
-          CoreFeatures::enablePropIteratorSetter
-              ? sourceProps.accessibilityLabelledBy
-              : convertRawProp(
-                    context,
-                    rawProps,
-                    "accessibilityLabelledBy",
-                    sourceProps.accessibilityLabelledBy,
-                    {})),
       accessibilityLiveRegion(
           CoreFeatures::enablePropIteratorSetter
               ? sourceProps.accessibilityLiveRegion
@@ -63,42 +163,6 @@ AccessibilityProps::AccessibilityProps(
                     "accessibilityLiveRegion",
                     sourceProps.accessibilityLiveRegion,
                     AccessibilityLiveRegion::None)),
-      accessibilityHint(
-          CoreFeatures::enablePropIteratorSetter
-              ? sourceProps.accessibilityHint
-              : convertRawProp(
-                    context,
-                    rawProps,
-                    "accessibilityHint",
-                    sourceProps.accessibilityHint,
-                    "")),
-      accessibilityLanguage(
-          CoreFeatures::enablePropIteratorSetter
-              ? sourceProps.accessibilityLanguage
-              : convertRawProp(
-                    context,
-                    rawProps,
-                    "accessibilityLanguage",
-                    sourceProps.accessibilityLanguage,
-                    "")),
-      accessibilityValue(
-          CoreFeatures::enablePropIteratorSetter
-              ? sourceProps.accessibilityValue
-              : convertRawProp(
-                    context,
-                    rawProps,
-                    "accessibilityValue",
-                    sourceProps.accessibilityValue,
-                    {})),
-      accessibilityActions(
-          CoreFeatures::enablePropIteratorSetter
-              ? sourceProps.accessibilityActions
-              : convertRawProp(
-                    context,
-                    rawProps,
-                    "accessibilityActions",
-                    sourceProps.accessibilityActions,
-                    {})),
       accessibilityViewIsModal(
           CoreFeatures::enablePropIteratorSetter
               ? sourceProps.accessibilityViewIsModal
@@ -178,7 +242,14 @@ AccessibilityProps::AccessibilityProps(
                                                        rawProps,
                                                        "testID",
                                                        sourceProps.testId,
-                                                       "")) {
+                                                       "")),
+      lazyProps_(
+          CoreFeatures::enablePropIteratorSetter
+              ? sourceProps.lazyProps_
+              : LazyAccessibilityProps::create(
+                    context,
+                    sourceProps.lazyProps_,
+                    rawProps)) {
   // It is a (severe!) perf deoptimization to request props out-of-order.
   // Thus, since we need to request the same prop twice here
   // (accessibilityRole) we "must" do them subsequently here to prevent
@@ -218,19 +289,12 @@ AccessibilityProps::AccessibilityProps(
 void AccessibilityProps::setProp(
     const PropsParserContext& context,
     RawPropsPropNameHash hash,
-    const char* /*propName*/,
+    const char* propName,
     const RawValue& value) {
   static auto defaults = AccessibilityProps{};
 
   switch (hash) {
     RAW_SET_PROP_SWITCH_CASE_BASIC(accessible);
-    RAW_SET_PROP_SWITCH_CASE_BASIC(accessibilityState);
-    RAW_SET_PROP_SWITCH_CASE_BASIC(accessibilityLabel);
-    RAW_SET_PROP_SWITCH_CASE_BASIC(accessibilityLabelledBy);
-    RAW_SET_PROP_SWITCH_CASE_BASIC(accessibilityHint);
-    RAW_SET_PROP_SWITCH_CASE_BASIC(accessibilityLanguage);
-    RAW_SET_PROP_SWITCH_CASE_BASIC(accessibilityValue);
-    RAW_SET_PROP_SWITCH_CASE_BASIC(accessibilityActions);
     RAW_SET_PROP_SWITCH_CASE_BASIC(accessibilityViewIsModal);
     RAW_SET_PROP_SWITCH_CASE_BASIC(accessibilityElementsHidden);
     RAW_SET_PROP_SWITCH_CASE_BASIC(accessibilityIgnoresInvertColors);
@@ -241,6 +305,16 @@ void AccessibilityProps::setProp(
     RAW_SET_PROP_SWITCH_CASE_BASIC(importantForAccessibility);
     RAW_SET_PROP_SWITCH_CASE_BASIC(role);
     RAW_SET_PROP_SWITCH_CASE(testId, "testID");
+    case CONSTEXPR_RAW_PROPS_KEY_HASH("accessibilityState"):
+    case CONSTEXPR_RAW_PROPS_KEY_HASH("accessibilityLabel"):
+    case CONSTEXPR_RAW_PROPS_KEY_HASH("accessibilityLabelledBy"):
+    case CONSTEXPR_RAW_PROPS_KEY_HASH("accessibilityHint"):
+    case CONSTEXPR_RAW_PROPS_KEY_HASH("accessibilityLanguage"):
+    case CONSTEXPR_RAW_PROPS_KEY_HASH("accessibilityValue"):
+    case CONSTEXPR_RAW_PROPS_KEY_HASH("accessibilityActions"):
+      lazyProps_ =
+          LazyAccessibilityProps::assign(context, lazyProps_, propName, value);
+      return;
     case CONSTEXPR_RAW_PROPS_KEY_HASH("accessibilityRole"): {
       AccessibilityTraits traits = AccessibilityTraits::None;
       std::string roleString;
@@ -256,6 +330,12 @@ void AccessibilityProps::setProp(
   }
 }
 
+const LazyAccessibilityProps::Values& AccessibilityProps::getLazyValues()
+    const {
+  static const auto defaultValues = LazyAccessibilityProps::Values{};
+  return lazyProps_ ? lazyProps_->getValues() : defaultValues;
+}
+
 #pragma mark - DebugStringConvertible
 
 #if RN_DEBUG_STRING_CONVERTIBLE
@@ -7,6 +7,10 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
+
+#include <folly/dynamic.h>
 #include <react/renderer/components/view/AccessibilityPrimitives.h>
 #include <react/renderer/core/Props.h>
 #include <react/renderer/core/PropsParserContext.h>
@@ -15,6 +19,68 @@
 
 namespace facebook::react {
 
+/*
+ * Accessibility props which most views don't set and which are expensive to
+ * parse and copy. `AccessibilityProps` keeps them in this side structure,
+ * which is only allocated when at least one of them is set and is shared
+ * between clones until one of them changes. The raw values are parsed on
+ * first access, usually by the platform layer at mount time.
+ */
+class LazyAccessibilityProps final {
+ public:
+  using Shared = std::shared_ptr<const LazyAccessibilityProps>;
+
+  struct Values {
+    std::optional<AccessibilityState> accessibilityState{std::nullopt};
+    std::string accessibilityLabel{""};
+    AccessibilityLabelledBy accessibilityLabelledBy{};
+    std::string accessibilityHint{""};
+    std::string accessibilityLanguage{""};
+    AccessibilityValue accessibilityValue{};
+    std::vector<AccessibilityAction> accessibilityActions{};
+  };
+
+  /*
+   * Returns the side structure of `source` updated with the lazy props of
+   * `rawProps`, or `source` itself if `rawProps` has none of them.
+   */
+  static Shared create(
+      const PropsParserContext& context,
+      const Shared& source,
+      const RawProps& rawProps);
+
+  /*
+   * Returns the side structure of `source` with the prop `propName` set to
+   * `value`.
+   */
+  static Shared assign(
+      const PropsParserContext& context,
+      const Shared& source,
+      const char* propName,
+      const RawValue& value);
+
+  LazyAccessibilityProps(SurfaceId surfaceId, folly::dynamic rawValues);
+
+  /*
+   * Returns the parsed values, parsing them on the first call.
+   * Thread-safe.
+   */
+  const Values& getValues() const;
+
+ private:
+  static Shared fromRawValues(SurfaceId surfaceId, folly::dynamic rawValues);
+
+  const SurfaceId surfaceId_;
+
+  /*
+   * Raw values of the props which are set, by prop name.
+   */
+  const folly::dynamic rawValues_;
+
+  mutable std::once_flag parseFlag_;
+  mutable Values values_;
+};
+
 class AccessibilityProps {
  public:
   AccessibilityProps() = default;
@@ -32,17 +98,10 @@ class AccessibilityProps {
 #pragma mark - Props
 
   bool accessible{false};
-  std::optional<AccessibilityState> accessibilityState{std::nullopt};
-  std::string accessibilityLabel{""};
-  AccessibilityLabelledBy accessibilityLabelledBy{};
   AccessibilityLiveRegion accessibilityLiveRegion{
       AccessibilityLiveRegion::None};
   AccessibilityTraits accessibilityTraits{AccessibilityTraits::None};
   std::string accessibilityRole{""};
-  std::string accessibilityHint{""};
-  std::string accessibilityLanguage{""};
-  AccessibilityValue accessibilityValue;
-  std::vector<AccessibilityAction> accessibilityActions{};
   bool accessibilityViewIsModal{false};
   bool accessibilityElementsHidden{false};
   bool accessibilityIgnoresInvertColors{false};
@@ -55,11 +114,40 @@ class AccessibilityProps {
   Role role{Role::None};
   std::string testId{""};
 
+#pragma mark - Lazy Props
+
+  const std::optional<AccessibilityState>& getAccessibilityState() const {
+    return getLazyValues().accessibilityState;
+  }
+  const std::string& getAccessibilityLabel() const {
+    return getLazyValues().accessibilityLabel;
+  }
+  const AccessibilityLabelledBy& getAccessibilityLabelledBy() const {
+    return getLazyValues().accessibilityLabelledBy;
+  }
+  const std::string& getAccessibilityHint() const {
+    return getLazyValues().accessibilityHint;
+  }
+  const std::string& getAccessibilityLanguage() const {
+    return getLazyValues().accessibilityLanguage;
+  }
+  const AccessibilityValue& getAccessibilityValue() const {
+    return getLazyValues().accessibilityValue;
+  }
+  const std::vector<AccessibilityAction>& getAccessibilityActions() const {
+    return getLazyValues().accessibilityActions;
+  }
+
 #pragma mark - DebugStringConvertible
 
 #if RN_DEBUG_STRING_CONVERTIBLE
   SharedDebugStringConvertibleList getDebugProps() const;
 #endif
+
+ private:
+  const LazyAccessibilityProps::Values& getLazyValues() const;
+
+  LazyAccessibilityProps::Shared lazyProps_{};
 };
 
 } // namespace facebook::react
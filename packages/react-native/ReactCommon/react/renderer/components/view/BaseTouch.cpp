@@ -7,22 +7,28 @@
 
 #include "Touch.h"
 
+#include <jsi/PropNameIDCache.h>
+
 namespace facebook::react {
 
 void setTouchPayloadOnObject(
     jsi::Object& object,
     jsi::Runtime& runtime,
     const BaseTouch& touch) {
-  object.setProperty(runtime, "locationX", touch.offsetPoint.x);
-  object.setProperty(runtime, "locationY", touch.offsetPoint.y);
-  object.setProperty(runtime, "pageX", touch.pagePoint.x);
-  object.setProperty(runtime, "pageY", touch.pagePoint.y);
-  object.setProperty(runtime, "screenX", touch.screenPoint.x);
-  object.setProperty(runtime, "screenY", touch.screenPoint.y);
-  object.setProperty(runtime, "identifier", touch.identifier);
-  object.setProperty(runtime, "target", touch.target);
-  object.setProperty(runtime, "timestamp", touch.timestamp * 1000);
-  object.setProperty(runtime, "force", touch.force);
+  auto cache = jsi::PropNameIDCache::get(runtime);
+  auto setProperty = [&](const std::string& name, const jsi::Value& value) {
+    object.setProperty(runtime, cache->forUtf8(runtime, name), value);
+  };
+  setProperty("locationX", touch.offsetPoint.x);
+  setProperty("locationY", touch.offsetPoint.y);
+  setProperty("pageX", touch.pagePoint.x);
+  setProperty("pageY", touch.pagePoint.y);
+  setProperty("screenX", touch.screenPoint.x);
+  setProperty("screenY", touch.screenPoint.y);
+  setProperty("identifier", touch.identifier);
+  setProperty("target", touch.target);
+  setProperty("timestamp", touch.timestamp * 1000);
+  setProperty("force", touch.force);
 }
 
 #if RN_DEBUG_STRING_CONVERTIBLE
@@ -8,10 +8,61 @@
 #pragma once
 
 #include <react/renderer/components/view/ViewProps.h>
+#include <react/renderer/graphics/Rect.h>
 #include <react/renderer/graphics/Transform.h>
 
+#include <cstddef>
+
 namespace facebook::react {
 
+/**
+ * Returns whether any of the view props which `interpolateViewProps`
+ * interpolates differ between old and new props. If not, the new props can be
+ * used as the interpolated props as is, for any animation progress.
+ */
+static inline bool viewPropsNeedInterpolation(
+    const Props::Shared& oldPropsShared,
+    const Props::Shared& newPropsShared) {
+  if (oldPropsShared == newPropsShared) {
+    return false;
+  }
+
+  const ViewProps* oldViewProps =
+      static_cast<const ViewProps*>(oldPropsShared.get());
+  const ViewProps* newViewProps =
+      static_cast<const ViewProps*>(newPropsShared.get());
+
+  return oldViewProps->opacity != newViewProps->opacity ||
+      oldViewProps->transform != newViewProps->transform;
+}
+
+/**
+ * Interpolates `count` frames between `oldFrames` and `newFrames` with the
+ * same animation progress into `interpolatedFrames`. Views which animate with
+ * the same progress are interpolated in one pass over contiguous arrays,
+ * which compilers vectorize.
+ */
+static inline void interpolateFrames(
+    Float animationProgress,
+    const Rect* oldFrames,
+    const Rect* newFrames,
+    Rect* interpolatedFrames,
+    size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    const auto& oldFrame = oldFrames[i];
+    const auto& newFrame = newFrames[i];
+    auto& interpolatedFrame = interpolatedFrames[i];
+    interpolatedFrame.origin.x = oldFrame.origin.x +
+        (newFrame.origin.x - oldFrame.origin.x) * animationProgress;
+    interpolatedFrame.origin.y = oldFrame.origin.y +
+        (newFrame.origin.y - oldFrame.origin.y) * animationProgress;
+    interpolatedFrame.size.width = oldFrame.size.width +
+        (newFrame.size.width - oldFrame.size.width) * animationProgress;
+    interpolatedFrame.size.height = oldFrame.size.height +
+        (newFrame.size.height - oldFrame.size.height) * animationProgress;
+  }
+}
+
 /**
  * Given animation progress, old props, new props, and an "interpolated" shared
  * props struct, this will mutate the "interpolated" struct in-place to give it
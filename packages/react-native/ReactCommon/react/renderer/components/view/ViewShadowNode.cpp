@@ -15,6 +15,10 @@ namespace facebook::react {
 
 const char ViewComponentName[] = "View";
 
+// Allows a node to be unflattened and flattened again once, and to be
+// unflattened a second time.
+static constexpr uint8_t kMaxFlatteningChanges = 3;
+
 ViewShadowNodeProps::ViewShadowNodeProps(
     const PropsParserContext& context,
     const ViewShadowNodeProps& sourceProps,
@@ -26,17 +30,17 @@ ViewShadowNode::ViewShadowNode(
     const ShadowNodeFamily::Shared& family,
     ShadowNodeTraits traits)
     : ConcreteViewShadowNode(fragment, family, traits) {
-  initialize();
+  initialize(nullptr);
 }
 
 ViewShadowNode::ViewShadowNode(
     const ShadowNode& sourceShadowNode,
     const ShadowNodeFragment& fragment)
     : ConcreteViewShadowNode(sourceShadowNode, fragment) {
-  initialize();
+  initialize(&sourceShadowNode);
 }
 
-void ViewShadowNode::initialize() noexcept {
+void ViewShadowNode::initialize(const ShadowNode* sourceShadowNode) noexcept {
   auto& viewProps = static_cast<const ViewProps&>(*props_);
 
   auto hasBorder = [&]() {
@@ -68,6 +72,25 @@ void ViewShadowNode::initialize() noexcept {
       !viewProps.testId.empty() ||
       HostPlatformViewTraitsInitializer::formsView(viewProps);
 
+  // Each switch between forming a view and being flattened makes the
+  // Differentiator reparent the children of the node. Nodes which switch back
+  // and forth (e.g. while their opacity is animated to 1) keep forming a view
+  // once they did so too often.
+  if (CoreFeatures::enableStickyViewUnflattening &&
+      sourceShadowNode != nullptr) {
+    auto sourceTraits = sourceShadowNode->getTraits();
+    auto sourceFormsView =
+        sourceTraits.check(ShadowNodeTraits::Trait::FormsView);
+    auto sourceFormsStackingContext =
+        sourceTraits.check(ShadowNodeTraits::Trait::FormsStackingContext);
+    if ((formsView != sourceFormsView ||
+         formsStackingContext != sourceFormsStackingContext) &&
+        getFamily().countFlatteningChange() > kMaxFlatteningChanges) {
+      formsView = formsView || sourceFormsView;
+      formsStackingContext = formsStackingContext || sourceFormsStackingContext;
+    }
+  }
+
   if (formsView) {
     traits_.set(ShadowNodeTraits::Trait::FormsView);
   } else {
@@ -43,8 +43,11 @@ class ViewShadowNode final : public ConcreteViewShadowNode<
       const ShadowNode& sourceShadowNode,
       const ShadowNodeFragment& fragment);
 
+  // Views in lists are often created with equal props.
+  static constexpr bool InternsProps = true;
+
  private:
-  void initialize() noexcept;
+  void initialize(const ShadowNode* sourceShadowNode) noexcept;
 };
 
 } // namespace facebook::react
@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "YogaLayoutProfiler.h"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include <react/renderer/core/ShadowNode.h>
+#include <yoga/Yoga.h>
+
+namespace facebook::react {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct ActiveLayoutPass {
+  YogaLayoutProfile profile;
+  std::unordered_map<YGNodeConstRef, YogaLayoutProfileNode> nodes;
+  std::vector<Clock::time_point> measureCallbackStartTimes;
+  std::vector<Clock::time_point> baselineStartTimes;
+};
+
+thread_local std::unique_ptr<ActiveLayoutPass> activeLayoutPass;
+
+YogaLayoutProfileNode& getProfileNode(
+    ActiveLayoutPass& pass,
+    YGNodeConstRef yogaNode) {
+  auto [iterator, inserted] = pass.nodes.try_emplace(yogaNode);
+  if (inserted) {
+    // Nodes of `YogaLayoutableShadowNode`s have their shadow node as context.
+    if (auto context = YGNodeGetContext(yogaNode)) {
+      const auto& shadowNode = *static_cast<const ShadowNode*>(context);
+      iterator->second.tag = shadowNode.getTag();
+      iterator->second.componentName = shadowNode.getComponentName();
+    }
+  }
+  return iterator->second;
+}
+
+template <typename T>
+bool isHotter(const T& lhs, const T& rhs) {
+  if (lhs.measureCallbackDuration != rhs.measureCallbackDuration) {
+    return lhs.measureCallbackDuration > rhs.measureCallbackDuration;
+  }
+  return lhs.layouts + lhs.measures > rhs.layouts + rhs.measures;
+}
+
+YogaLayoutProfile finishLayoutPass(ActiveLayoutPass& pass) {
+  auto& profile = pass.profile;
+
+  auto componentsByName =
+      std::unordered_map<std::string, YogaLayoutProfileComponent>{};
+  profile.hottestNodes.reserve(pass.nodes.size());
+  for (const auto& [yogaNode, node] : pass.nodes) {
+    auto& component = componentsByName[node.componentName];
+    component.componentName = node.componentName;
+    component.nodes += 1;
+    component.layouts += node.layouts;
+    component.measures += node.measures;
+    component.measureCallbacks += node.measureCallbacks;
+    component.measureCallbackDuration += node.measureCallbackDuration;
+
+    profile.hottestNodes.push_back(node);
+  }
+
+  auto& nodes = profile.hottestNodes;
+  auto hottestCount =
+      std::min(nodes.size(), YogaLayoutProfiler::kMaxNumberOfHottestNodes);
+  std::partial_sort(
+      nodes.begin(),
+      nodes.begin() + static_cast<std::ptrdiff_t>(hottestCount),
+      nodes.end(),
+      isHotter<YogaLayoutProfileNode>);
+  nodes.resize(hottestCount);
+
+  profile.components.reserve(componentsByName.size());
+  for (auto& [name, component] : componentsByName) {
+    profile.components.push_back(component);
+  }
+  std::sort(
+      profile.components.begin(),
+      profile.components.end(),
+      isHotter<YogaLayoutProfileComponent>);
+
+  return std::move(profile);
+}
+
+double toMicroseconds(Clock::duration duration) {
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+double toMicroseconds(Clock::time_point timePoint) {
+  return toMicroseconds(timePoint.time_since_epoch());
+}
+
+} // namespace
+
+YogaLayoutProfiler& YogaLayoutProfiler::getInstance() {
+  // Yoga provides no way to unsubscribe, so the profiler is never destroyed.
+  static auto& profiler = *new YogaLayoutProfiler();
+  return profiler;
+}
+
+void YogaLayoutProfiler::start() {
+  std::call_once(subscribeOnceFlag_, [] {
+    yoga::Event::subscribe(&YogaLayoutProfiler::handleEvent);
+  });
+  isProfiling_ = true;
+}
+
+void YogaLayoutProfiler::stop() {
+  isProfiling_ = false;
+}
+
+bool YogaLayoutProfiler::isProfiling() const {
+  return isProfiling_;
+}
+
+std::vector<YogaLayoutProfile> YogaLayoutProfiler::takeProfiles() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto profiles = std::vector<YogaLayoutProfile>{
+      std::make_move_iterator(profiles_.begin()),
+      std::make_move_iterator(profiles_.end())};
+  profiles_.clear();
+  return profiles;
+}
+
+void YogaLayoutProfiler::addProfile(YogaLayoutProfile&& profile) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (profiles_.size() == kMaxNumberOfProfiles) {
+    profiles_.pop_front();
+  }
+  profiles_.push_back(std::move(profile));
+}
+
+void YogaLayoutProfiler::handleEvent(
+    YGNodeConstRef node,
+    yoga::Event::Type type,
+    yoga::Event::Data data) {
+  if (type == yoga::Event::LayoutPassStart) {
+    if (!getInstance().isProfiling()) {
+      return;
+    }
+    activeLayoutPass = std::make_unique<ActiveLayoutPass>();
+    auto& profile = activeLayoutPass->profile;
+    profile.threadId = std::this_thread::get_id();
+    profile.startTime = Clock::now();
+    if (auto context = YGNodeGetContext(node)) {
+      const auto& shadowNode = *static_cast<const ShadowNode*>(context);
+      profile.surfaceId = shadowNode.getSurfaceId();
+      profile.rootTag = shadowNode.getTag();
+    }
+    return;
+  }
+
+  auto pass = activeLayoutPass.get();
+  if (pass == nullptr) {
+    return;
+  }
+
+  switch (type) {
+    case yoga::Event::NodeLayout: {
+      auto& profileNode = getProfileNode(*pass, node);
+      switch (data.get<yoga::Event::NodeLayout>().layoutType) {
+        case yoga::LayoutType::kLayout:
+          profileNode.layouts += 1;
+          break;
+        case yoga::LayoutType::kMeasure:
+          profileNode.measures += 1;
+          break;
+        case yoga::LayoutType::kCachedLayout:
+          profileNode.cachedLayouts += 1;
+          break;
+        case yoga::LayoutType::kCachedMeasure:
+          profileNode.cachedMeasures += 1;
+          break;
+      }
+      break;
+    }
+    case yoga::Event::MeasureCallbackStart:
+      pass->measureCallbackStartTimes.push_back(Clock::now());
+      break;
+    case yoga::Event::MeasureCallbackEnd: {
+      if (pass->measureCallbackStartTimes.empty()) {
+        break;
+      }
+      auto endTime = Clock::now();
+      auto startTime = pass->measureCallbackStartTimes.back();
+      pass->measureCallbackStartTimes.pop_back();
+
+      auto& profileNode = getProfileNode(*pass, node);
+      profileNode.measureCallbacks += 1;
+      profileNode.measureCallbackDuration += endTime - startTime;
+
+      auto& spans = pass->profile.measureCallbackSpans;
+      if (spans.size() < kMaxNumberOfMeasureCallbackSpans) {
+        spans.push_back(
+            {profileNode.tag, profileNode.componentName, startTime, endTime});
+      }
+      break;
+    }
+    case yoga::Event::NodeBaselineStart:
+      pass->baselineStartTimes.push_back(Clock::now());
+      break;
+    case yoga::Event::NodeBaselineEnd: {
+      if (pass->baselineStartTimes.empty()) {
+        break;
+      }
+      auto duration = Clock::now() - pass->baselineStartTimes.back();
+      pass->baselineStartTimes.pop_back();
+      getProfileNode(*pass, node).baselineDuration += duration;
+      break;
+    }
+    case yoga::Event::LayoutPassEnd: {
+      pass->profile.endTime = Clock::now();
+      const auto& eventData = data.get<yoga::Event::LayoutPassEnd>();
+      if (eventData.layoutData != nullptr) {
+        pass->profile.layoutData = *eventData.layoutData;
+      }
+      auto profile = finishLayoutPass(*pass);
+      activeLayoutPass.reset();
+      getInstance().addProfile(std::move(profile));
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+folly::dynamic toChromeTrace(const std::vector<YogaLayoutProfile>& profiles) {
+  auto traceEvents = folly::dynamic::array();
+
+  for (const auto& profile : profiles) {
+    auto threadId =
+        static_cast<int64_t>(std::hash<std::thread::id>{}(profile.threadId));
+
+    auto hottestNodes = folly::dynamic::array();
+    for (const auto& node : profile.hottestNodes) {
+      hottestNodes.push_back(folly::dynamic::object("tag", node.tag)(
+          "componentName", node.componentName)("layouts", node.layouts)(
+          "measures", node.measures)("cachedLayouts", node.cachedLayouts)(
+          "cachedMeasures", node.cachedMeasures)(
+          "measureCallbacks", node.measureCallbacks)(
+          "measureCallbackTimeUs",
+          toMicroseconds(node.measureCallbackDuration))(
+          "baselineTimeUs", toMicroseconds(node.baselineDuration)));
+    }
+
+    const auto& layoutData = profile.layoutData;
+    traceEvents.push_back(folly::dynamic::object("name", "YogaLayout")(
+        "cat", "yoga")("ph", "X")("ts", toMicroseconds(profile.startTime))(
+        "dur", toMicroseconds(profile.endTime - profile.startTime))("pid", 0)(
+        "tid", threadId)(
+        "args",
+        folly::dynamic::object("surfaceId", profile.surfaceId)(
+            "rootTag", profile.rootTag)("layouts", layoutData.layouts)(
+            "measures", layoutData.measures)(
+            "cachedLayouts", layoutData.cachedLayouts)(
+            "cachedMeasures", layoutData.cachedMeasures)(
+            "measureCallbacks", layoutData.measureCallbacks)(
+            "hottestNodes", std::move(hottestNodes))));
+
+    for (const auto& span : profile.measureCallbackSpans) {
+      traceEvents.push_back(folly::dynamic::object("name", span.componentName)(
+          "cat", "yoga.measure")("ph", "X")(
+          "ts", toMicroseconds(span.startTime))(
+          "dur", toMicroseconds(span.endTime - span.startTime))("pid", 0)(
+          "tid", threadId)("args", folly::dynamic::object("tag", span.tag)));
+    }
+  }
+
+  return folly::dynamic::object("traceEvents", std::move(traceEvents))(
+      "displayTimeUnit", "ms");
+}
+
+} // namespace facebook::react
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <folly/dynamic.h>
+#include <yoga/event/event.h>
+
+#include <react/renderer/core/ReactPrimitives.h>
+
+namespace facebook::react {
+
+/*
+ * Work Yoga did for a single node within a layout pass.
+ */
+struct YogaLayoutProfileNode {
+  Tag tag{-1};
+  ComponentName componentName{""};
+
+  int layouts{0};
+  int measures{0};
+  int cachedLayouts{0};
+  int cachedMeasures{0};
+
+  int measureCallbacks{0};
+  std::chrono::steady_clock::duration measureCallbackDuration{};
+  std::chrono::steady_clock::duration baselineDuration{};
+};
+
+/*
+ * Work Yoga did for all nodes of a component within a layout pass.
+ */
+struct YogaLayoutProfileComponent {
+  ComponentName componentName{""};
+  int nodes{0};
+  int layouts{0};
+  int measures{0};
+  int measureCallbacks{0};
+  std::chrono::steady_clock::duration measureCallbackDuration{};
+};
+
+/*
+ * A single call of the measure function of a node.
+ */
+struct YogaLayoutProfileSpan {
+  Tag tag{-1};
+  ComponentName componentName{""};
+  std::chrono::steady_clock::time_point startTime{};
+  std::chrono::steady_clock::time_point endTime{};
+};
+
+/*
+ * Everything recorded about one Yoga layout pass, which happens once per
+ * commit of a surface whose layout changed.
+ */
+struct YogaLayoutProfile {
+  SurfaceId surfaceId{-1};
+  Tag rootTag{-1};
+  std::thread::id threadId{};
+  std::chrono::steady_clock::time_point startTime{};
+  std::chrono::steady_clock::time_point endTime{};
+  yoga::LayoutData layoutData{};
+
+  /*
+   * Nodes which spent the most time in measure functions or were laid out
+   * or measured the most often, hottest first.
+   */
+  std::vector<YogaLayoutProfileNode> hottestNodes{};
+
+  /*
+   * Per-component totals, sorted the same way as `hottestNodes`.
+   */
+  std::vector<YogaLayoutProfileComponent> components{};
+
+  std::vector<YogaLayoutProfileSpan> measureCallbackSpans{};
+};
+
+/*
+ * Subscribes to Yoga events and attributes the work of every layout pass to
+ * the nodes (and their components) it was done for.
+ * Only passes which start on a thread after `start()` is called are recorded;
+ * work done by parallel layout tasks on other threads is not attributed.
+ */
+class YogaLayoutProfiler final {
+ public:
+  static constexpr size_t kMaxNumberOfProfiles = 64;
+  static constexpr size_t kMaxNumberOfHottestNodes = 32;
+  static constexpr size_t kMaxNumberOfMeasureCallbackSpans = 1024;
+
+  static YogaLayoutProfiler& getInstance();
+
+  void start();
+  void stop();
+  bool isProfiling() const;
+
+  /*
+   * Returns the profiles of the layout passes which finished since the last
+   * call, oldest first. Only the last `kMaxNumberOfProfiles` ones are kept.
+   */
+  std::vector<YogaLayoutProfile> takeProfiles();
+
+ private:
+  YogaLayoutProfiler() = default;
+
+  static void handleEvent(
+      YGNodeConstRef node,
+      yoga::Event::Type type,
+      yoga::Event::Data data);
+
+  void addProfile(YogaLayoutProfile&& profile);
+
+  std::atomic<bool> isProfiling_{false};
+  std::once_flag subscribeOnceFlag_;
+
+  std::mutex mutex_;
+  std::deque<YogaLayoutProfile> profiles_;
+};
+
+/*
+ * Converts profiles to the Chrome trace event format ("JSON Object Format"),
+ * to be serialized with `folly::toJson` and opened with chrome://tracing or
+ * Perfetto. Every pass becomes a complete event carrying its hottest nodes,
+ * and every recorded measure function call a nested one.
+ */
+folly::dynamic toChromeTrace(const std::vector<YogaLayoutProfile>& profiles);
+
+} // namespace facebook::react
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "YogaLayoutTemplateCache.h"
+
+#include <react/utils/hash_combine.h>
+
+namespace facebook::react {
+
+static bool nodeMatchesTemplate(
+    const YogaLayoutTemplate& layoutTemplate,
+    size_t& index,
+    const yoga::Node& node) {
+  if (index >= layoutTemplate.nodes.size()) {
+    return false;
+  }
+
+  const auto& templateNode = layoutTemplate.nodes[index++];
+  const auto& config = *node.getConfig();
+  if (templateNode.childCount != node.getChildCount() ||
+      templateNode.nodeType != node.getNodeType() ||
+      templateNode.isReferenceBaseline != node.isReferenceBaseline() ||
+      templateNode.alwaysFormsContainingBlock !=
+          node.alwaysFormsContainingBlock() ||
+      templateNode.errata != config.getErrata() ||
+      templateNode.enabledExperiments != config.getEnabledExperiments() ||
+      templateNode.useWebDefaults != config.useWebDefaults() ||
+      layoutTemplate.pointScaleFactor != config.getPointScaleFactor() ||
+      !YogaLayoutTemplateCache::isShareable(node) ||
+      templateNode.style != node.style()) {
+    return false;
+  }
+
+  for (auto child : node.getChildren()) {
+    if (!nodeMatchesTemplate(layoutTemplate, index, *child)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void copyLayoutFromTemplate(
+    const YogaLayoutTemplate& layoutTemplate,
+    size_t& index,
+    yoga::Node& node) {
+  const auto& templateNode = layoutTemplate.nodes[index];
+
+  node.setLayout(templateNode.layout);
+  if (index != 0) {
+    // The line index of the root is set by its owner.
+    node.setLineIndex(templateNode.lineIndex);
+  }
+  node.setHasNewLayout(true);
+  node.setDirty(false);
+  index++;
+
+  for (auto child : node.getChildren()) {
+    copyLayoutFromTemplate(layoutTemplate, index, *child);
+  }
+}
+
+static void appendTemplateNodes(
+    YogaLayoutTemplate& layoutTemplate,
+    const yoga::Node& node) {
+  const auto& config = *node.getConfig();
+  layoutTemplate.nodes.push_back(YogaLayoutTemplate::Node{
+      .style = node.style(),
+      .nodeType = node.getNodeType(),
+      .isReferenceBaseline = node.isReferenceBaseline(),
+      .alwaysFormsContainingBlock = node.alwaysFormsContainingBlock(),
+      .errata = config.getErrata(),
+      .enabledExperiments = config.getEnabledExperiments(),
+      .useWebDefaults = config.useWebDefaults(),
+      .childCount = node.getChildCount(),
+      .lineIndex = node.getLineIndex(),
+      .layout = node.getLayout()});
+
+  for (auto child : node.getChildren()) {
+    appendTemplateNodes(layoutTemplate, *child);
+  }
+}
+
+YogaLayoutTemplateCache& YogaLayoutTemplateCache::getInstance() {
+  static YogaLayoutTemplateCache cache;
+  return cache;
+}
+
+bool YogaLayoutTemplateCache::isShareable(const yoga::Node& node) {
+  return !node.hasMeasureFunc() && !node.hasBaselineFunc();
+}
+
+void YogaLayoutTemplateCache::hashNode(size_t& seed, const yoga::Node& node) {
+  const auto& config = *node.getConfig();
+  hash_combine(
+      seed,
+      node.style().hash(),
+      node.getNodeType(),
+      node.isReferenceBaseline(),
+      node.alwaysFormsContainingBlock(),
+      config.getErrata(),
+      config.getEnabledExperiments(),
+      config.useWebDefaults(),
+      config.getPointScaleFactor(),
+      node.getChildCount());
+}
+
+bool YogaLayoutTemplateCache::seed(size_t hash, yoga::Node& node) const {
+  auto layoutTemplate = cache_.get(hash);
+  if (!layoutTemplate) {
+    return false;
+  }
+
+  // Hashes of different subtrees may collide.
+  size_t index = 0;
+  if (!nodeMatchesTemplate(**layoutTemplate, index, node) ||
+      index != (*layoutTemplate)->nodes.size()) {
+    return false;
+  }
+
+  index = 0;
+  copyLayoutFromTemplate(**layoutTemplate, index, node);
+
+  // The flex basis of the root depends on its owner, which computes it again.
+  auto& layout = node.getLayout();
+  layout.computedFlexBasis = {};
+  layout.computedFlexBasisGeneration = 0;
+  return true;
+}
+
+void YogaLayoutTemplateCache::store(size_t hash, const yoga::Node& node)
+    const {
+  auto layoutTemplate = std::make_shared<YogaLayoutTemplate>();
+  layoutTemplate->pointScaleFactor = node.getConfig()->getPointScaleFactor();
+  appendTemplateNodes(*layoutTemplate, node);
+  cache_.set(hash, std::move(layoutTemplate));
+}
+
+void YogaLayoutTemplateCache::clear() const {
+  cache_.clear();
+}
+
+} // namespace facebook::react
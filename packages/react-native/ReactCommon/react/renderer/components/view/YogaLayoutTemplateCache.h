@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <yoga/node/Node.h>
+
+#include <react/utils/SimpleThreadSafeCache.h>
+
+namespace facebook::react {
+
+/*
+ * Layout results of a laid out Yoga subtree without measurable nodes, along
+ * with everything Yoga computed them from, in pre-order.
+ */
+struct YogaLayoutTemplate {
+  struct Node {
+    yoga::Style style;
+    yoga::NodeType nodeType;
+    bool isReferenceBaseline;
+    bool alwaysFormsContainingBlock;
+    yoga::Errata errata;
+    yoga::ExperimentalFeatureSet enabledExperiments;
+    bool useWebDefaults;
+    size_t childCount;
+    size_t lineIndex;
+    yoga::LayoutResults layout;
+  };
+
+  float pointScaleFactor;
+  std::vector<Node> nodes;
+};
+
+/*
+ * Shares the layout of structurally identical Yoga subtrees, e.g. the ones of
+ * the cells of a list, between their first and following layout passes.
+ * Subtrees are identified by a hash of the Yoga styles, node types and configs
+ * of their nodes; subtrees with measurable nodes (e.g. text) depend on their
+ * content and are never shared.
+ * Copying the layout results of a template into a new subtree gives it the
+ * state Yoga leaves a subtree in after laying it out, so Yoga skips laying it
+ * out whenever it is given the same constraints as the template was; with
+ * other constraints the subtree is laid out as usual.
+ * Can be used from any thread.
+ */
+class YogaLayoutTemplateCache final {
+ public:
+  static constexpr int kMaxNumberOfTemplates = 256;
+
+  static YogaLayoutTemplateCache& getInstance();
+
+  /*
+   * Whether the layout of a node may be shared, not considering its children.
+   */
+  static bool isShareable(const yoga::Node& node);
+
+  /*
+   * Combines the hash of everything the layout of a node (besides its
+   * children) is computed from into `seed`.
+   */
+  static void hashNode(size_t& seed, const yoga::Node& node);
+
+  /*
+   * Copies the layout results of the template stored for `hash` into the
+   * subtree of `node` if the template matches it. The nodes of the subtree
+   * must not have been laid out before and must be owned by their parents.
+   * Returns whether the subtree was seeded.
+   */
+  bool seed(size_t hash, yoga::Node& node) const;
+
+  /*
+   * Stores the layout results of the laid out subtree of `node` as the
+   * template for `hash`.
+   */
+  void store(size_t hash, const yoga::Node& node) const;
+
+  /*
+   * Removes all templates.
+   */
+  void clear() const;
+
+ private:
+  YogaLayoutTemplateCache() = default;
+
+  SimpleThreadSafeCache<
+      size_t,
+      std::shared_ptr<const YogaLayoutTemplate>,
+      kMaxNumberOfTemplates>
+      cache_;
+};
+
+} // namespace facebook::react
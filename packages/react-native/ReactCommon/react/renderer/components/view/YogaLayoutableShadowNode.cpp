@@ -11,12 +11,14 @@
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/components/view/ViewProps.h>
 #include <react/renderer/components/view/ViewShadowNode.h>
+#include <react/renderer/components/view/YogaLayoutTemplateCache.h>
 #include <react/renderer/components/view/conversions.h>
 #include <react/renderer/core/LayoutConstraints.h>
 #include <react/renderer/core/LayoutContext.h>
 #include <react/renderer/debug/DebugStringConvertibleItem.h>
 #include <react/renderer/debug/SystraceSection.h>
 #include <react/utils/CoreFeatures.h>
+#include <react/utils/hash_combine.h>
 #include <yoga/Yoga.h>
 #include <algorithm>
 #include <limits>
@@ -134,9 +136,19 @@ YogaLayoutableShadowNode::YogaLayoutableShadowNode(
   // This is the only legit place where we can dirty cloned Yoga node.
   // If we do it later, ancestor nodes will not be able to observe this and
   // dirty (and clone) themselves as a result.
-  if (getTraits().check(ShadowNodeTraits::Trait::DirtyYogaNode) ||
-      getTraits().check(ShadowNodeTraits::Trait::MeasurableYogaNode)) {
+  if (getTraits().check(ShadowNodeTraits::Trait::DirtyYogaNode)) {
     yogaNode_.setDirty(true);
+  } else if (getTraits().check(ShadowNodeTraits::Trait::MeasurableYogaNode)) {
+    // The measured size of a node depends on its props, children and state
+    // (along with constraints that Yoga checks on its own). Clones which do not
+    // change any of them (e.g. ones made by Yoga to lay out a shared node) can
+    // keep the measurement cache of their source.
+    if (!CoreFeatures::enableYogaLayoutReuse ||
+        (fragment.props && fragment.props != sourceShadowNode.getProps()) ||
+        fragment.children ||
+        (fragment.state && fragment.state != sourceShadowNode.getState())) {
+      yogaNode_.setDirty(true);
+    }
   }
 
   // We do not need to reconfigure this subtree before the next layout pass if
@@ -149,7 +161,16 @@ YogaLayoutableShadowNode::YogaLayoutableShadowNode(
   }
 
   if (fragment.props) {
-    updateYogaProps();
+    // The style of the cloned Yoga node is still the one of the source props,
+    // unless `configureYogaTree` swapped its left and right edges (that is
+    // redone once the props change).
+    auto& props = static_cast<const YogaStylableProps&>(*props_);
+    if (props.hasUnchangedYogaStyle &&
+        !getLayoutMetrics().wasLeftAndRightSwapped) {
+      updateYogaContainingBlock();
+    } else {
+      updateYogaProps();
+    }
   }
 
   if (fragment.children) {
@@ -333,6 +354,11 @@ void YogaLayoutableShadowNode::updateYogaChildren() {
 
   ensureUnsealed();
 
+  if (CoreFeatures::enableIncrementalYogaChildrenUpdates) {
+    updateYogaChildrenIncrementally();
+    return;
+  }
+
   bool isClean = !yogaNode_.isDirty() &&
       getChildren().size() == yogaNode_.getChildren().size();
 
@@ -367,6 +393,82 @@ void YogaLayoutableShadowNode::updateYogaChildren() {
   yogaNode_.setDirty(!isClean);
 }
 
+void YogaLayoutableShadowNode::updateYogaChildrenIncrementally() {
+  const auto& children = getChildren();
+
+  bool isClean = !yogaNode_.isDirty() &&
+      children.size() == yogaNode_.getChildren().size();
+
+  // The Yoga children are still the ones of the source node here.
+  auto oldYogaChildren = yogaNode_.getChildren();
+
+  auto childIndices = std::vector<size_t>{};
+  yogaLayoutableChildren_.clear();
+  for (size_t i = 0; i < children.size(); i++) {
+    if (auto yogaLayoutableChild =
+            std::dynamic_pointer_cast<const YogaLayoutableShadowNode>(
+                children[i])) {
+      yogaLayoutableChildren_.push_back(std::move(yogaLayoutableChild));
+      childIndices.push_back(i);
+    }
+  }
+
+  auto oldSize = oldYogaChildren.size();
+  auto newSize = yogaLayoutableChildren_.size();
+  auto isKept = [&](size_t oldIndex, size_t newIndex) {
+    return oldYogaChildren[oldIndex] ==
+        &yogaLayoutableChildren_[newIndex]->yogaNode_;
+  };
+
+  // Only the range of children between the common prefix and suffix of both
+  // lists changed, e.g. nothing but the new children of an append.
+  size_t prefixSize = 0;
+  while (prefixSize < std::min(oldSize, newSize) &&
+         isKept(prefixSize, prefixSize)) {
+    prefixSize++;
+  }
+  size_t suffixSize = 0;
+  while (suffixSize < std::min(oldSize, newSize) - prefixSize &&
+         isKept(oldSize - 1 - suffixSize, newSize - 1 - suffixSize)) {
+    suffixSize++;
+  }
+
+  for (auto i = oldSize - suffixSize; i > prefixSize; i--) {
+    yogaNode_.removeChild(i - 1);
+  }
+
+  // Kept children stay owned by their current owner (like the children of a
+  // node cloned with new props only); Yoga clones them through
+  // `yogaNodeCloneCallbackConnector` once it needs to lay them out.
+  auto isKeptChildClean = [&](size_t index) {
+    return !yogaLayoutableChildren_[index]->yogaNode_.isDirty();
+  };
+  for (size_t i = 0; isClean && i < prefixSize; i++) {
+    isClean = isKeptChildClean(i);
+  }
+  for (auto i = newSize - suffixSize; isClean && i < newSize; i++) {
+    isClean = isKeptChildClean(i);
+  }
+
+  for (auto i = prefixSize; i < newSize - suffixSize; i++) {
+    yogaNode_.insertChild(&yogaLayoutableChildren_[i]->yogaNode_, i);
+    adoptYogaChild(childIndices[i]);
+
+    if (isClean) {
+      auto& oldYogaChildNode = *oldYogaChildren.at(i);
+      auto& newYogaChildNode = yogaLayoutableChildren_[i]->yogaNode_;
+
+      isClean = isClean && !newYogaChildNode.isDirty() &&
+          (newYogaChildNode.style() == oldYogaChildNode.style());
+    }
+  }
+
+  react_native_assert(
+      yogaLayoutableChildren_.size() == yogaNode_.getChildren().size());
+
+  yogaNode_.setDirty(!isClean);
+}
+
 void YogaLayoutableShadowNode::updateYogaProps() {
   ensureUnsealed();
 
@@ -379,6 +481,10 @@ void YogaLayoutableShadowNode::updateYogaProps() {
   }
 
   yogaNode_.setStyle(styleResult);
+  updateYogaContainingBlock();
+}
+
+void YogaLayoutableShadowNode::updateYogaContainingBlock() {
   if (getTraits().check(ShadowNodeTraits::ViewKind)) {
     auto& viewProps = static_cast<const ViewProps&>(*props_);
     YGNodeSetAlwaysFormsContainingBlock(
@@ -491,6 +597,83 @@ void YogaLayoutableShadowNode::configureYogaTree(
   }
 }
 
+void YogaLayoutableShadowNode::prepareMeasurements(
+    const LayoutContext& layoutContext,
+    Float likelyWidth) const {
+  if (getLayoutMetrics() != EmptyLayoutMetrics) {
+    likelyWidth = getLayoutMetrics().getContentFrame().size.width;
+  }
+
+  for (const auto& child : yogaLayoutableChildren_) {
+    if (!child->yogaNode_.isDirty()) {
+      // Nothing in the subtree is going to be measured again.
+      continue;
+    }
+
+    if (child->getTraits().check(ShadowNodeTraits::Trait::MeasurableYogaNode)) {
+      child->prepareMeasurement(layoutContext, likelyWidth);
+    } else {
+      child->prepareMeasurements(layoutContext, likelyWidth);
+    }
+  }
+}
+
+std::optional<size_t> YogaLayoutableShadowNode::seedLayoutTemplates(
+    bool canBeShared,
+    std::vector<std::pair<yoga::Node*, size_t>>& unseededSubtrees) const {
+  // Only nodes which were never laid out (and nothing else has a reference
+  // to) may take over the layout of a template.
+  canBeShared = canBeShared && !getSealed() &&
+      yogaNode_.getLayout().generationCount == 0 &&
+      YogaLayoutTemplateCache::isShareable(yogaNode_);
+
+  auto hash = size_t{0};
+  YogaLayoutTemplateCache::hashNode(hash, yogaNode_);
+
+  // Absolutely positioned children of nodes which don't form a containing
+  // block are laid out by an ancestor, which may be outside of the subtree.
+  const bool formsContainingBlock =
+      yogaNode_.style().positionType() != yoga::PositionType::Static ||
+      yogaNode_.alwaysFormsContainingBlock();
+
+  auto shareableChildren = std::vector<std::pair<yoga::Node*, size_t>>{};
+  for (const auto& child : yogaLayoutableChildren_) {
+    if (!child->yogaNode_.isDirty() || !doesOwn(*child)) {
+      canBeShared = false;
+      continue;
+    }
+
+    if (!formsContainingBlock &&
+        child->yogaNode_.style().positionType() ==
+            yoga::PositionType::Absolute) {
+      canBeShared = false;
+    }
+
+    auto childHash =
+        child->seedLayoutTemplates(/* canBeShared */ true, unseededSubtrees);
+    if (childHash) {
+      hash_combine(hash, *childHash);
+      shareableChildren.emplace_back(&child->yogaNode_, *childHash);
+    } else {
+      canBeShared = false;
+    }
+  }
+
+  if (canBeShared) {
+    return hash;
+  }
+
+  auto& cache = YogaLayoutTemplateCache::getInstance();
+  for (const auto& [childYogaNode, childHash] : shareableChildren) {
+    // Laying out a single node is as cheap as copying its layout.
+    if (childYogaNode->getChildCount() > 0 &&
+        !cache.seed(childHash, *childYogaNode)) {
+      unseededSubtrees.emplace_back(childYogaNode, childHash);
+    }
+  }
+  return std::nullopt;
+}
+
 YGErrata YogaLayoutableShadowNode::resolveErrata(YGErrata defaultErrata) const {
   if (auto viewShadowNode = dynamic_cast<const ViewShadowNode*>(this)) {
     const auto& props = viewShadowNode->getConcreteProps();
@@ -589,6 +772,17 @@ void YogaLayoutableShadowNode::layoutTree(
   auto minimumSize = layoutConstraints.minimumSize;
   auto maximumSize = layoutConstraints.maximumSize;
 
+  if (CoreFeatures::enableParagraphPreMeasurement && yogaNode_.isDirty()) {
+    SystraceSection s2("YogaLayoutableShadowNode::prepareMeasurements");
+    prepareMeasurements(layoutContext, maximumSize.width);
+  }
+
+  auto unseededSubtrees = std::vector<std::pair<yoga::Node*, size_t>>{};
+  if (CoreFeatures::enableYogaLayoutTemplates && yogaNode_.isDirty()) {
+    SystraceSection s2("YogaLayoutableShadowNode::seedLayoutTemplates");
+    seedLayoutTemplates(/* canBeShared */ false, unseededSubtrees);
+  }
+
   // The caller must ensure that layout constraints make sense.
   // Values cannot be NaN.
   react_native_assert(!std::isnan(minimumSize.width));
@@ -613,7 +807,7 @@ void YogaLayoutableShadowNode::layoutTree(
   // `ownerHeight` to allow proper calculation of relative (e.g. specified in
   // percents) style values.
 
-  auto& yogaStyle = yogaNode_.style();
+  auto yogaStyle = yogaNode_.style();
 
   auto ownerWidth = yogaFloatFromFloat(maximumSize.width);
   auto ownerHeight = yogaFloatFromFloat(maximumSize.height);
@@ -630,6 +824,8 @@ void YogaLayoutableShadowNode::layoutTree(
   yogaStyle.setMinDimension(
       yoga::Dimension::Height, yoga::value::points(minimumSize.height));
 
+  yogaNode_.setStyle(yogaStyle);
+
   auto direction =
       yogaDirectionFromLayoutDirection(layoutConstraints.layoutDirection);
 
@@ -640,6 +836,12 @@ void YogaLayoutableShadowNode::layoutTree(
     YGNodeCalculateLayout(&yogaNode_, ownerWidth, ownerHeight, direction);
   }
 
+  for (const auto& [subtreeYogaNode, hash] : unseededSubtrees) {
+    if (!subtreeYogaNode->isDirty()) {
+      YogaLayoutTemplateCache::getInstance().store(hash, *subtreeYogaNode);
+    }
+  }
+
   // Update layout metrics for root node. Updated for children in
   // YogaLayoutableShadowNode::layout
   if (yogaNode_.getHasNewLayout()) {
@@ -791,17 +993,11 @@ YGNodeRef YogaLayoutableShadowNode::yogaNodeCloneCallbackConnector(
   return &parentNode.cloneChildInPlace(childIndex).yogaNode_;
 }
 
-YGSize YogaLayoutableShadowNode::yogaNodeMeasureCallbackConnector(
-    YGNodeConstRef yogaNode,
+static LayoutConstraints layoutConstraintsFromYogaMeasureConstraints(
     float width,
     YGMeasureMode widthMode,
     float height,
     YGMeasureMode heightMode) {
-  SystraceSection s(
-      "YogaLayoutableShadowNode::yogaNodeMeasureCallbackConnector");
-
-  auto& shadowNode = shadowNodeFromContext(yogaNode);
-
   auto minimumSize = Size{0, 0};
   auto maximumSize = Size{
       std::numeric_limits<Float>::infinity(),
@@ -831,13 +1027,83 @@ YGSize YogaLayoutableShadowNode::yogaNodeMeasureCallbackConnector(
       break;
   }
 
+  return {minimumSize, maximumSize};
+}
+
+YGSize YogaLayoutableShadowNode::yogaNodeMeasureCallbackConnector(
+    YGNodeConstRef yogaNode,
+    float width,
+    YGMeasureMode widthMode,
+    float height,
+    YGMeasureMode heightMode) {
+  SystraceSection s(
+      "YogaLayoutableShadowNode::yogaNodeMeasureCallbackConnector");
+
+  auto& shadowNode = shadowNodeFromContext(yogaNode);
+
   auto size = shadowNode.measureContent(
-      threadLocalLayoutContext, {minimumSize, maximumSize});
+      threadLocalLayoutContext,
+      layoutConstraintsFromYogaMeasureConstraints(
+          width, widthMode, height, heightMode));
 
   return YGSize{
       yogaFloatFromFloat(size.width), yogaFloatFromFloat(size.height)};
 }
 
+void YogaLayoutableShadowNode::yogaNodeBatchMeasureCallbackConnector(
+    YGNodeConstRef /*owner*/,
+    const YGMeasureRequest* requests,
+    YGSize* results,
+    size_t count) {
+  SystraceSection s(
+      "YogaLayoutableShadowNode::yogaNodeBatchMeasureCallbackConnector");
+
+  // Measuring the nodes of each component together, in the order of their
+  // first request.
+  auto measured = std::vector<bool>(count, false);
+  for (size_t i = 0; i < count; i++) {
+    if (measured[i]) {
+      continue;
+    }
+
+    auto& shadowNode = shadowNodeFromContext(requests[i].node);
+    auto componentHandle = shadowNode.getComponentHandle();
+
+    auto indices = std::vector<size_t>{};
+    auto nodes = std::vector<const LayoutableShadowNode*>{};
+    auto layoutConstraints = std::vector<LayoutConstraints>{};
+    for (size_t j = i; j < count; j++) {
+      const auto& request = requests[j];
+      if (measured[j]) {
+        continue;
+      }
+      auto& node = shadowNodeFromContext(request.node);
+      if (node.getComponentHandle() != componentHandle) {
+        continue;
+      }
+
+      measured[j] = true;
+      indices.push_back(j);
+      nodes.push_back(&node);
+      layoutConstraints.push_back(layoutConstraintsFromYogaMeasureConstraints(
+          request.width,
+          request.widthMode,
+          request.height,
+          request.heightMode));
+    }
+
+    auto sizes = shadowNode.measureContentBatch(
+        threadLocalLayoutContext, nodes, layoutConstraints);
+
+    react_native_assert(sizes.size() == indices.size());
+    for (size_t j = 0; j < indices.size(); j++) {
+      results[indices[j]] = YGSize{
+          yogaFloatFromFloat(sizes[j].width),
+          yogaFloatFromFloat(sizes[j].height)};
+    }
+  }
+}
+
 YogaLayoutableShadowNode& YogaLayoutableShadowNode::shadowNodeFromContext(
     YGNodeConstRef yogaNode) {
   return dynamic_cast<YogaLayoutableShadowNode&>(
@@ -849,6 +1115,11 @@ yoga::Config& YogaLayoutableShadowNode::initializeYogaConfig(
     YGConfigConstRef previousConfig) {
   YGConfigSetCloneNodeFunc(
       &config, YogaLayoutableShadowNode::yogaNodeCloneCallbackConnector);
+  if (CoreFeatures::enableBatchedTextMeasurement) {
+    YGConfigSetBatchMeasureFunc(
+        &config,
+        YogaLayoutableShadowNode::yogaNodeBatchMeasureCallbackConnector);
+  }
   if (previousConfig != nullptr) {
     YGConfigSetPointScaleFactor(
         &config, YGConfigGetPointScaleFactor(previousConfig));
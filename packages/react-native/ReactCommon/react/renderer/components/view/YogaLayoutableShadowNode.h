@@ -8,6 +8,8 @@
 #pragma once
 
 #include <memory>
+#include <optional>
+#include <utility>
 #include <vector>
 
 #include <yoga/node/Node.h>
@@ -111,6 +113,18 @@ class YogaLayoutableShadowNode : public LayoutableShadowNode {
    */
   void updateYogaChildrenOwnersIfNeeded();
 
+  /*
+   * Makes the Yoga node form a containing block for its absolutely positioned
+   * descendants if the view is transformed. Part of `updateYogaProps`.
+   */
+  void updateYogaContainingBlock();
+
+  /*
+   * Implementation of `updateYogaChildren` which only replaces the Yoga
+   * children that changed, and keeps the other ones (and their owners) as is.
+   */
+  void updateYogaChildrenIncrementally();
+
   /*
    * Return true if child's yogaNode's owner is this->yogaNode_. Otherwise
    * returns false.
@@ -140,6 +154,25 @@ class YogaLayoutableShadowNode : public LayoutableShadowNode {
       YGErrata defaultErrata,
       bool swapLeftAndRight);
 
+  /**
+   * Calls `prepareMeasurement` on measurable descendants with dirty layout,
+   * passing the content width of their nearest laid out ancestor.
+   */
+  void prepareMeasurements(
+      const LayoutContext& layoutContext,
+      Float likelyWidth) const;
+
+  /**
+   * Seeds the largest subtrees of fresh descendants with dirty layout whose
+   * layout can be shared with a template of `YogaLayoutTemplateCache`, and
+   * collects the ones it had no template for into `unseededSubtrees`.
+   * Returns the hash of the subtree of the node if the subtree can be shared
+   * as a whole (and `canBeShared` is true), leaving it to the caller.
+   */
+  std::optional<size_t> seedLayoutTemplates(
+      bool canBeShared,
+      std::vector<std::pair<yoga::Node*, size_t>>& unseededSubtrees) const;
+
   /**
    * Return an errata based on a `layoutConformance` prop if given, otherwise
    * the passed default
@@ -164,6 +197,11 @@ class YogaLayoutableShadowNode : public LayoutableShadowNode {
       YGMeasureMode widthMode,
       float height,
       YGMeasureMode heightMode);
+  static void yogaNodeBatchMeasureCallbackConnector(
+      YGNodeConstRef owner,
+      const YGMeasureRequest* requests,
+      YGSize* results,
+      size_t count);
   static YogaLayoutableShadowNode& shadowNodeFromContext(
       YGNodeConstRef yogaNode);
 
@@ -534,6 +534,25 @@ YogaStylableProps::YogaStylableProps(
       yogaStyle.aspectRatio()));
 
   convertRawPropAliases(context, sourceProps, rawProps);
+
+  hasUnchangedYogaStyle = CoreFeatures::enableSkippingUnchangedYogaStyles &&
+      yogaStyle == sourceProps.yogaStyle &&
+      insetInlineStart == sourceProps.insetInlineStart &&
+      insetInlineEnd == sourceProps.insetInlineEnd &&
+      marginInline == sourceProps.marginInline &&
+      marginInlineStart == sourceProps.marginInlineStart &&
+      marginInlineEnd == sourceProps.marginInlineEnd &&
+      marginBlock == sourceProps.marginBlock &&
+      paddingInline == sourceProps.paddingInline &&
+      paddingInlineStart == sourceProps.paddingInlineStart &&
+      paddingInlineEnd == sourceProps.paddingInlineEnd &&
+      paddingBlock == sourceProps.paddingBlock &&
+      insetBlockStart == sourceProps.insetBlockStart &&
+      insetBlockEnd == sourceProps.insetBlockEnd &&
+      marginBlockStart == sourceProps.marginBlockStart &&
+      marginBlockEnd == sourceProps.marginBlockEnd &&
+      paddingBlockStart == sourceProps.paddingBlockStart &&
+      paddingBlockEnd == sourceProps.paddingBlockEnd;
 };
 
 void YogaStylableProps::setProp(
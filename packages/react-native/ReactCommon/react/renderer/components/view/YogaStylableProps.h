@@ -59,6 +59,11 @@ class YogaStylableProps : public Props {
   yoga::Style::Length paddingBlockStart;
   yoga::Style::Length paddingBlockEnd;
 
+  // Set when these props were cloned from `sourceProps` without changing any
+  // of the props above, so that a clone of a Yoga node can keep the style of
+  // its source (see `CoreFeatures::enableSkippingUnchangedYogaStyles`).
+  bool hasUnchangedYogaStyle{false};
+
 #if RN_DEBUG_STRING_CONVERTIBLE
 
 #pragma mark - DebugStringConvertible (Partial)
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/PropsParserContext.h>
+
+namespace facebook::react {
+
+class AccessibilityPropsTest : public ::testing::Test {
+ protected:
+  AccessibilityPropsTest()
+      : descriptor_(std::make_shared<ViewComponentDescriptor>(
+            ComponentDescriptorParameters{nullptr, nullptr, nullptr})),
+        parserContext_(-1, contextContainer_) {}
+
+  std::shared_ptr<const ViewProps> cloneProps(
+      const Props::Shared& props,
+      folly::dynamic rawProps) {
+    return std::static_pointer_cast<const ViewProps>(descriptor_->cloneProps(
+        parserContext_, props, RawProps(std::move(rawProps))));
+  }
+
+  std::shared_ptr<const ComponentDescriptor> descriptor_;
+  ContextContainer contextContainer_{};
+  PropsParserContext parserContext_;
+};
+
+TEST_F(AccessibilityPropsTest, lazyPropsDefaultToEmpty) {
+  auto props = cloneProps(nullptr, folly::dynamic::object("nativeID", "abc"));
+
+  EXPECT_EQ(props->getAccessibilityLabel(), "");
+  EXPECT_FALSE(props->getAccessibilityState().has_value());
+  EXPECT_TRUE(props->getAccessibilityActions().empty());
+}
+
+TEST_F(AccessibilityPropsTest, lazyPropsAreParsedOnAccess) {
+  auto props = cloneProps(
+      nullptr,
+      folly::dynamic::object("accessibilityLabel", "label")(
+          "accessibilityState", folly::dynamic::object("disabled", true))(
+          "accessibilityActions",
+          folly::dynamic::array(folly::dynamic::object("name", "activate"))));
+
+  EXPECT_EQ(props->getAccessibilityLabel(), "label");
+  EXPECT_TRUE(props->getAccessibilityState().value().disabled);
+  ASSERT_EQ(props->getAccessibilityActions().size(), 1);
+  EXPECT_EQ(props->getAccessibilityActions()[0].name, "activate");
+}
+
+TEST_F(AccessibilityPropsTest, lazyPropsAreKeptAcrossClones) {
+  auto props = cloneProps(
+      nullptr,
+      folly::dynamic::object("accessibilityLabel", "label")(
+          "accessibilityHint", "hint"));
+
+  // Props other than the lazy ones don't touch them.
+  props = cloneProps(props, folly::dynamic::object("opacity", 0.5));
+  EXPECT_EQ(props->getAccessibilityLabel(), "label");
+  EXPECT_EQ(props->getAccessibilityHint(), "hint");
+
+  // Changing one of them keeps the others.
+  props = cloneProps(props, folly::dynamic::object("accessibilityHint", "new"));
+  EXPECT_EQ(props->getAccessibilityLabel(), "label");
+  EXPECT_EQ(props->getAccessibilityHint(), "new");
+
+  // `null` resets a prop to its default.
+  props = cloneProps(
+      props, folly::dynamic::object("accessibilityLabel", nullptr));
+  EXPECT_EQ(props->getAccessibilityLabel(), "");
+  EXPECT_EQ(props->getAccessibilityHint(), "new");
+}
+
+} // namespace facebook::react
@@ -19,6 +19,7 @@
 
 #include <react/renderer/element/Element.h>
 #include <react/renderer/element/testUtils.h>
+#include <react/utils/CoreFeatures.h>
 
 namespace facebook::react {
 
@@ -104,6 +105,55 @@ TEST_F(YogaDirtyFlagTest, cloningPropsWithoutChangingThem) {
       static_cast<RootShadowNode&>(*newRootShadowNode).layoutIfNeeded());
 }
 
+TEST_F(YogaDirtyFlagTest, cloningPropsWithUnchangedYogaStyle) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+
+  CoreFeatures::enableSkippingUnchangedYogaStyles = true;
+
+  /*
+   * Props that only change non-layout props keep the Yoga style of their
+   * source, and must *not* dirty a Yoga node.
+   */
+  auto hasUnchangedYogaStyle = false;
+  auto newRootShadowNode = rootShadowNode_->cloneTree(
+      innerShadowNode_->getFamily(), [&](const ShadowNode& oldShadowNode) {
+        auto& componentDescriptor = oldShadowNode.getComponentDescriptor();
+        auto props = componentDescriptor.cloneProps(
+            parserContext,
+            oldShadowNode.getProps(),
+            RawProps(folly::dynamic::object("opacity", 0.5)));
+        hasUnchangedYogaStyle =
+            static_cast<const YogaStylableProps&>(*props).hasUnchangedYogaStyle;
+        return oldShadowNode.clone(ShadowNodeFragment{props});
+      });
+
+  EXPECT_TRUE(hasUnchangedYogaStyle);
+  EXPECT_FALSE(
+      static_cast<RootShadowNode&>(*newRootShadowNode).layoutIfNeeded());
+
+  /*
+   * Changing a Yoga style prop *must* dirty a Yoga node.
+   */
+  newRootShadowNode = rootShadowNode_->cloneTree(
+      innerShadowNode_->getFamily(), [&](const ShadowNode& oldShadowNode) {
+        auto& componentDescriptor = oldShadowNode.getComponentDescriptor();
+        auto props = componentDescriptor.cloneProps(
+            parserContext,
+            oldShadowNode.getProps(),
+            RawProps(folly::dynamic::object("paddingBlock", 7)));
+        hasUnchangedYogaStyle =
+            static_cast<const YogaStylableProps&>(*props).hasUnchangedYogaStyle;
+        return oldShadowNode.clone(ShadowNodeFragment{props});
+      });
+
+  CoreFeatures::enableSkippingUnchangedYogaStyles = false;
+
+  EXPECT_FALSE(hasUnchangedYogaStyle);
+  EXPECT_TRUE(
+      static_cast<RootShadowNode&>(*newRootShadowNode).layoutIfNeeded());
+}
+
 TEST_F(YogaDirtyFlagTest, changingNonLayoutSubPropsMustNotDirtyYogaNode) {
   /*
    * Changing *non-layout* sub-props must *not* dirty a Yoga node.
@@ -181,6 +231,37 @@ TEST_F(YogaDirtyFlagTest, removingLastChildMustDirtyYogaNode) {
       static_cast<RootShadowNode&>(*newRootShadowNode).layoutIfNeeded());
 }
 
+TEST_F(YogaDirtyFlagTest, removingLastChildKeepsOtherChildrenIncrementally) {
+  CoreFeatures::enableIncrementalYogaChildrenUpdates = true;
+
+  /*
+   * Removing the last child *must* dirty the Yoga node, without cloning the
+   * other children before the layout pass.
+   */
+  auto oldChildren = innerShadowNode_->getChildren();
+  auto newChildren = ShadowNode::ListOfShared{};
+  auto newRootShadowNode = rootShadowNode_->cloneTree(
+      innerShadowNode_->getFamily(), [&](const ShadowNode& oldShadowNode) {
+        auto children = oldShadowNode.getChildren();
+        children.pop_back();
+
+        auto newShadowNode = oldShadowNode.clone(
+            {ShadowNodeFragment::propsPlaceholder(),
+             std::make_shared<ShadowNode::ListOfShared const>(children)});
+        newChildren = newShadowNode->getChildren();
+        return newShadowNode;
+      });
+
+  CoreFeatures::enableIncrementalYogaChildrenUpdates = false;
+
+  ASSERT_EQ(newChildren.size(), oldChildren.size() - 1);
+  for (size_t i = 0; i < newChildren.size(); i++) {
+    EXPECT_EQ(newChildren[i], oldChildren[i]);
+  }
+  EXPECT_TRUE(
+      static_cast<RootShadowNode&>(*newRootShadowNode).layoutIfNeeded());
+}
+
 TEST_F(YogaDirtyFlagTest, reversingListOfChildrenMustDirtyYogaNode) {
   /*
    * Reversing a list of children *must* dirty a Yoga node.
@@ -225,4 +306,36 @@ TEST_F(YogaDirtyFlagTest, updatingStateForScrollViewMistNotDirtyYogaNode) {
       static_cast<RootShadowNode&>(*newRootShadowNode).layoutIfNeeded());
 }
 
+TEST_F(YogaDirtyFlagTest, viewsFlippingFlatteningOftenStayUnflattened) {
+  CoreFeatures::enableStickyViewUnflattening = true;
+
+  ShadowNode::Shared shadowNode = innerShadowNode_;
+  auto setOpacity = [&](Float opacity) {
+    auto props = std::make_shared<ViewShadowNodeProps>();
+    props->opacity = opacity;
+    shadowNode = shadowNode->clone({props});
+  };
+  auto formsView = [&]() {
+    return shadowNode->getTraits().check(ShadowNodeTraits::Trait::FormsView);
+  };
+
+  EXPECT_FALSE(formsView());
+
+  // The first changes are applied as usual.
+  setOpacity(0.5);
+  EXPECT_TRUE(formsView());
+  setOpacity(1);
+  EXPECT_FALSE(formsView());
+  setOpacity(0.5);
+  EXPECT_TRUE(formsView());
+
+  // Then the node keeps forming a view.
+  setOpacity(1);
+  EXPECT_TRUE(formsView());
+  EXPECT_TRUE(shadowNode->getTraits().check(
+      ShadowNodeTraits::Trait::FormsStackingContext));
+
+  CoreFeatures::enableStickyViewUnflattening = false;
+}
+
 } // namespace facebook::react
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/components/view/YogaLayoutProfiler.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+
+namespace facebook::react {
+
+static std::shared_ptr<RootShadowNode> buildTree(ComponentBuilder& builder) {
+  auto rootShadowNode = std::shared_ptr<RootShadowNode>{};
+
+  // clang-format off
+  auto element =
+      Element<RootShadowNode>()
+        .reference(rootShadowNode)
+        .tag(1)
+        .surfaceId(11)
+        .props([] {
+          auto sharedProps = std::make_shared<RootProps>();
+          auto &props = *sharedProps;
+          props.layoutConstraints = LayoutConstraints{{0,0}, {500, 500}};
+          auto &yogaStyle = props.yogaStyle;
+          yogaStyle.setDimension(yoga::Dimension::Width, yoga::value::points(200));
+          yogaStyle.setDimension(yoga::Dimension::Height, yoga::value::points(200));
+          return sharedProps;
+        })
+        .children({
+          Element<ViewShadowNode>()
+            .tag(2)
+            .surfaceId(11)
+            .props([] {
+              auto sharedProps = std::make_shared<ViewShadowNodeProps>();
+              sharedProps->yogaStyle.setFlex(yoga::FloatOptional{1});
+              return sharedProps;
+            }),
+          Element<ViewShadowNode>()
+            .tag(3)
+            .surfaceId(11)
+        });
+  // clang-format on
+
+  builder.build(element);
+  return rootShadowNode;
+}
+
+TEST(YogaLayoutProfilerTest, recordsLayoutPassesWhileProfiling) {
+  auto builder = simpleComponentBuilder();
+  auto& profiler = YogaLayoutProfiler::getInstance();
+
+  buildTree(builder)->layoutIfNeeded();
+  EXPECT_TRUE(profiler.takeProfiles().empty());
+
+  profiler.start();
+  buildTree(builder)->layoutIfNeeded();
+  profiler.stop();
+
+  auto profiles = profiler.takeProfiles();
+  ASSERT_EQ(profiles.size(), 1);
+
+  const auto& profile = profiles[0];
+  EXPECT_EQ(profile.surfaceId, 11);
+  EXPECT_EQ(profile.rootTag, 1);
+  EXPECT_LE(profile.startTime, profile.endTime);
+  EXPECT_GT(profile.layoutData.layouts, 0);
+
+  ASSERT_EQ(profile.hottestNodes.size(), 3);
+  auto tags = std::vector<Tag>{};
+  for (const auto& node : profile.hottestNodes) {
+    tags.push_back(node.tag);
+    EXPECT_GT(node.layouts + node.measures, 0);
+  }
+  std::sort(tags.begin(), tags.end());
+  EXPECT_EQ(tags, (std::vector<Tag>{1, 2, 3}));
+
+  ASSERT_EQ(profile.components.size(), 2);
+  auto viewComponent = std::find_if(
+      profile.components.begin(),
+      profile.components.end(),
+      [](const YogaLayoutProfileComponent& component) {
+        return std::string{component.componentName} == "View";
+      });
+  ASSERT_NE(viewComponent, profile.components.end());
+  EXPECT_EQ(viewComponent->nodes, 2);
+
+  EXPECT_TRUE(profiler.takeProfiles().empty());
+}
+
+TEST(YogaLayoutProfilerTest, exportsChromeTrace) {
+  auto builder = simpleComponentBuilder();
+  auto& profiler = YogaLayoutProfiler::getInstance();
+
+  profiler.start();
+  buildTree(builder)->layoutIfNeeded();
+  profiler.stop();
+
+  auto trace = toChromeTrace(profiler.takeProfiles());
+  const auto& traceEvents = trace["traceEvents"];
+  ASSERT_EQ(traceEvents.size(), 1);
+
+  const auto& event = traceEvents[0];
+  EXPECT_EQ(event["name"], "YogaLayout");
+  EXPECT_EQ(event["ph"], "X");
+  EXPECT_EQ(event["args"]["surfaceId"], 11);
+  EXPECT_EQ(event["args"]["hottestNodes"].size(), 3);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/components/view/YogaLayoutProfiler.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/utils/CoreFeatures.h>
+
+namespace facebook::react {
+
+// Builds a list cell: a row with an icon and a column of two lines.
+static std::shared_ptr<RootShadowNode> buildTree(
+    ComponentBuilder& builder,
+    float iconSize) {
+  auto rootShadowNode = std::shared_ptr<RootShadowNode>{};
+
+  // clang-format off
+  auto element =
+      Element<RootShadowNode>()
+        .reference(rootShadowNode)
+        .tag(1)
+        .surfaceId(11)
+        .props([] {
+          auto sharedProps = std::make_shared<RootProps>();
+          auto &props = *sharedProps;
+          props.layoutConstraints = LayoutConstraints{{0,0}, {500, 500}};
+          auto &yogaStyle = props.yogaStyle;
+          yogaStyle.setDimension(yoga::Dimension::Width, yoga::value::points(200));
+          yogaStyle.setDimension(yoga::Dimension::Height, yoga::value::points(200));
+          return sharedProps;
+        })
+        .children({
+          Element<ViewShadowNode>()
+            .tag(2)
+            .surfaceId(11)
+            .props([] {
+              auto sharedProps = std::make_shared<ViewShadowNodeProps>();
+              auto &yogaStyle = sharedProps->yogaStyle;
+              yogaStyle.setFlexDirection(yoga::FlexDirection::Row);
+              yogaStyle.setPadding(yoga::Edge::All, yoga::value::points(10.5));
+              return sharedProps;
+            })
+            .children({
+              Element<ViewShadowNode>()
+                .tag(3)
+                .surfaceId(11)
+                .props([=] {
+                  auto sharedProps = std::make_shared<ViewShadowNodeProps>();
+                  auto &yogaStyle = sharedProps->yogaStyle;
+                  yogaStyle.setDimension(yoga::Dimension::Width, yoga::value::points(iconSize));
+                  yogaStyle.setDimension(yoga::Dimension::Height, yoga::value::points(iconSize));
+                  return sharedProps;
+                }),
+              Element<ViewShadowNode>()
+                .tag(4)
+                .surfaceId(11)
+                .props([] {
+                  auto sharedProps = std::make_shared<ViewShadowNodeProps>();
+                  sharedProps->yogaStyle.setFlex(yoga::FloatOptional{1});
+                  return sharedProps;
+                })
+                .children({
+                  Element<ViewShadowNode>()
+                    .tag(5)
+                    .surfaceId(11)
+                    .props([] {
+                      auto sharedProps = std::make_shared<ViewShadowNodeProps>();
+                      sharedProps->yogaStyle.setDimension(yoga::Dimension::Height, yoga::value::percent(33.3));
+                      return sharedProps;
+                    }),
+                  Element<ViewShadowNode>()
+                    .tag(6)
+                    .surfaceId(11)
+                    .props([] {
+                      auto sharedProps = std::make_shared<ViewShadowNodeProps>();
+                      sharedProps->yogaStyle.setDimension(yoga::Dimension::Height, yoga::value::points(12.25));
+                      return sharedProps;
+                    })
+                })
+            })
+        });
+  // clang-format on
+
+  builder.build(element);
+  return rootShadowNode;
+}
+
+static std::vector<LayoutMetrics> collectLayoutMetrics(
+    const ShadowNode& shadowNode) {
+  auto layoutMetrics = std::vector<LayoutMetrics>{};
+  if (auto layoutableShadowNode =
+          dynamic_cast<const LayoutableShadowNode*>(&shadowNode)) {
+    layoutMetrics.push_back(layoutableShadowNode->getLayoutMetrics());
+  }
+  for (const auto& child : shadowNode.getChildren()) {
+    auto childLayoutMetrics = collectLayoutMetrics(*child);
+    layoutMetrics.insert(
+        layoutMetrics.end(),
+        childLayoutMetrics.begin(),
+        childLayoutMetrics.end());
+  }
+  return layoutMetrics;
+}
+
+TEST(YogaLayoutTemplateCacheTest, identicalSubtreesShareLayout) {
+  auto builder = simpleComponentBuilder();
+
+  auto expectedTree = buildTree(builder, 40);
+  expectedTree->layoutIfNeeded();
+
+  CoreFeatures::enableYogaLayoutTemplates = true;
+  buildTree(builder, 40)->layoutIfNeeded();
+
+  auto& profiler = YogaLayoutProfiler::getInstance();
+  profiler.start();
+  auto tree = buildTree(builder, 40);
+  tree->layoutIfNeeded();
+  profiler.stop();
+  CoreFeatures::enableYogaLayoutTemplates = false;
+
+  EXPECT_EQ(collectLayoutMetrics(*tree), collectLayoutMetrics(*expectedTree));
+
+  // Yoga doesn't visit the descendants of the cell.
+  auto profiles = profiler.takeProfiles();
+  ASSERT_EQ(profiles.size(), 1);
+  for (const auto& node : profiles[0].hottestNodes) {
+    EXPECT_LE(node.tag, 2);
+  }
+}
+
+TEST(YogaLayoutTemplateCacheTest, differentSubtreesDoNotShareLayout) {
+  auto builder = simpleComponentBuilder();
+
+  auto expectedTree = buildTree(builder, 24);
+  expectedTree->layoutIfNeeded();
+
+  CoreFeatures::enableYogaLayoutTemplates = true;
+  buildTree(builder, 40)->layoutIfNeeded();
+  auto tree = buildTree(builder, 24);
+  tree->layoutIfNeeded();
+  CoreFeatures::enableYogaLayoutTemplates = false;
+
+  EXPECT_EQ(collectLayoutMetrics(*tree), collectLayoutMetrics(*expectedTree));
+}
+
+} // namespace facebook::react
@@ -11,8 +11,12 @@ namespace facebook::react {
 
 BatchedEventQueue::BatchedEventQueue(
     EventQueueProcessor eventProcessor,
-    std::unique_ptr<EventBeat> eventBeat)
-    : EventQueue(std::move(eventProcessor), std::move(eventBeat)) {}
+    std::unique_ptr<EventBeat> eventBeat,
+    RuntimeExecutor discreteEventExecutor)
+    : EventQueue(
+          std::move(eventProcessor),
+          std::move(eventBeat),
+          std::move(discreteEventExecutor)) {}
 
 void BatchedEventQueue::onEnqueue() const {
   eventBeat_->request();
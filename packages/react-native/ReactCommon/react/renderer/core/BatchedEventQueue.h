@@ -20,7 +20,8 @@ class BatchedEventQueue final : public EventQueue {
  public:
   BatchedEventQueue(
       EventQueueProcessor eventProcessor,
-      std::unique_ptr<EventBeat> eventBeat);
+      std::unique_ptr<EventBeat> eventBeat,
+      RuntimeExecutor discreteEventExecutor = nullptr);
 
   void onEnqueue() const override;
 };
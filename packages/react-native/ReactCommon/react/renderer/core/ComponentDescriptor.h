@@ -16,6 +16,7 @@
 #include <react/renderer/core/State.h>
 #include <react/renderer/core/StateData.h>
 #include <react/utils/ContextContainer.h>
+#include <react/utils/MemoryPressureCoordinator.h>
 
 namespace facebook::react {
 
@@ -128,12 +129,34 @@ class ComponentDescriptor {
   virtual ShadowNodeFamily::Shared createFamily(
       const ShadowNodeFamilyFragment& fragment) const = 0;
 
+  /*
+   * Sizes (in bytes) of the shadow nodes, props and states of the component
+   * type itself, not including memory they reference (e.g. strings or
+   * children). Used to attribute memory in snapshots of shadow trees.
+   */
+  struct ShallowSizes {
+    size_t shadowNode{0};
+    size_t props{0};
+    size_t state{0};
+  };
+
+  virtual ShallowSizes getShallowSizes() const {
+    return {};
+  }
+
+  /*
+   * Releases the caches of the component type which `level` calls for (see
+   * `MemoryPressureLevel`). Can be called from any thread.
+   */
+  virtual void didReceiveMemoryPressure(MemoryPressureLevel /*level*/) const {
+    // Default implementation does nothing.
+  }
+
  protected:
   friend ShadowNode;
 
   EventDispatcher::Weak eventDispatcher_;
   ContextContainer::Shared contextContainer_;
-  RawPropsParser rawPropsParser_{};
   Flavor flavor_;
 
   /*
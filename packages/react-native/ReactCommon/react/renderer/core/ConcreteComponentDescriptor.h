@@ -20,9 +20,20 @@
 #include <react/renderer/core/State.h>
 #include <react/renderer/graphics/Float.h>
 #include <react/utils/CoreFeatures.h>
+#include <react/utils/PooledAllocator.h>
+#include <react/utils/ShardedThreadSafeCache.h>
 
 namespace facebook::react {
 
+/*
+ * Shadow nodes which opt into interning their props: nodes created with equal
+ * raw props on the same surface share one instance of props, if
+ * `CoreFeatures::enablePropsInterning` is enabled. Only suitable for props
+ * which are never mutated after being parsed.
+ */
+template <typename T>
+concept PropsInternable = requires { requires T::InternsProps; };
+
 /*
  * Default template-based implementation of ComponentDescriptor.
  * Use your `ShadowNode` type as a template argument and override any methods
@@ -48,7 +59,12 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
 
   ConcreteComponentDescriptor(const ComponentDescriptorParameters& parameters)
       : ComponentDescriptor(parameters) {
-    rawPropsParser_.prepare<ConcreteProps>();
+    if (!CoreFeatures::enableLazyRawPropsParserPreparation) {
+      getRawPropsParser();
+    }
+    if constexpr (PropsInternable<ShadowNodeT>) {
+      internedProps_ = std::make_unique<InternedPropsCache>();
+    }
   }
 
   ComponentHandle getComponentHandle() const override {
@@ -63,11 +79,23 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
     return ShadowNodeT::BaseTraits();
   }
 
+  void didReceiveMemoryPressure(MemoryPressureLevel level) const override {
+    // Interned props are only shared by nodes created later on.
+    if (internedProps_ && level >= MemoryPressureLevel::Moderate) {
+      internedProps_->clear();
+    }
+  }
+
+  ShallowSizes getShallowSizes() const override {
+    return {sizeof(ShadowNodeT), sizeof(ConcreteProps), sizeof(ConcreteState)};
+  }
+
   std::shared_ptr<ShadowNode> createShadowNode(
       const ShadowNodeFragment& fragment,
       const ShadowNodeFamily::Shared& family) const override {
-    auto shadowNode =
-        std::make_shared<ShadowNodeT>(fragment, family, getTraits());
+    auto shadowNode = CoreFeatures::enablePooledShadowNodeAllocation
+        ? allocatePooledShared<ShadowNodeT>(fragment, family, getTraits())
+        : std::make_shared<ShadowNodeT>(fragment, family, getTraits());
 
     adopt(*shadowNode);
 
@@ -77,7 +105,9 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
   ShadowNode::Unshared cloneShadowNode(
       const ShadowNode& sourceShadowNode,
       const ShadowNodeFragment& fragment) const override {
-    auto shadowNode = std::make_shared<ShadowNodeT>(sourceShadowNode, fragment);
+    auto shadowNode = CoreFeatures::enablePooledShadowNodeAllocation
+        ? allocatePooledShared<ShadowNodeT>(sourceShadowNode, fragment)
+        : std::make_shared<ShadowNodeT>(sourceShadowNode, fragment);
 
     adopt(*shadowNode);
     return shadowNode;
@@ -105,11 +135,31 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
       return ShadowNodeT::defaultSharedProps();
     }
 
+    // Props parsed from equal raw props without a base are equal, so nodes
+    // created with them can share one instance (and compare equal by
+    // identity). The key is taken before the raw props are filtered.
+    auto internedPropsKey = folly::dynamic{};
+    if constexpr (PropsInternable<ShadowNodeT>) {
+      if (CoreFeatures::enablePropsInterning && !props) {
+        internedPropsKey =
+            folly::dynamic::array(context.surfaceId, (folly::dynamic)rawProps);
+        if (auto internedProps = internedProps_->get(internedPropsKey)) {
+          return *internedProps;
+        }
+      }
+    }
+
     if constexpr (RawPropsFilterable<ShadowNodeT>) {
       ShadowNodeT::filterRawProps(rawProps);
     }
 
-    rawProps.parse(rawPropsParser_);
+    // Values of props which did not change since `props` do not need to be
+    // converted again.
+    rawProps.parse(
+        getRawPropsParser(),
+        CoreFeatures::enableSkippingUnchangedRawProps && props
+            ? props->rawPropsPrimitiveValues.get()
+            : nullptr);
 
     // Call old-style constructor
     auto shadowNodeProps = ShadowNodeT::Props(context, rawProps, props);
@@ -125,6 +175,10 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
       });
     }
 
+    if (!internedPropsKey.isNull()) [[unlikely]] {
+      internedProps_->set(internedPropsKey, shadowNodeProps);
+    }
+
     return shadowNodeProps;
   };
 
@@ -136,6 +190,15 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
       return nullptr;
     }
 
+    if (auto coallocationBlock = family->coallocationBlock) {
+      return allocateCoallocatedShared<ConcreteState>(
+          *coallocationBlock,
+          allocateCoallocatedShared<ConcreteStateData>(
+              *coallocationBlock,
+              ConcreteShadowNode::initialStateData(props, family, *this)),
+          family);
+    }
+
     return std::make_shared<ConcreteState>(
         std::make_shared<const ConcreteStateData>(
             ConcreteShadowNode::initialStateData(props, family, *this)),
@@ -159,6 +222,10 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
 
   ShadowNodeFamily::Shared createFamily(
       const ShadowNodeFamilyFragment& fragment) const override {
+    if (CoreFeatures::enableCoallocatedShadowNodeFamilies) {
+      return createCoallocatedFamily(fragment);
+    }
+
     auto eventEmitter = std::make_shared<const ConcreteEventEmitter>(
         std::make_shared<EventTarget>(fragment.instanceHandle),
         eventDispatcher_);
@@ -172,6 +239,65 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
     react_native_assert(
         shadowNode.getComponentHandle() == getComponentHandle());
   }
+
+  /*
+   * Returns the parser of raw props, prepared on first use (see
+   * `CoreFeatures::enableLazyRawPropsParserPreparation`).
+   * The parser is immutable once prepared, so all descriptors of the
+   * component in the process (e.g. of several React instances) share it.
+   */
+  const RawPropsParser& getRawPropsParser() const {
+    static const auto rawPropsParser = [] {
+      auto rawPropsParser = std::make_unique<RawPropsParser>();
+      rawPropsParser->prepare<ConcreteProps>();
+      return rawPropsParser;
+    }();
+    return *rawPropsParser;
+  }
+
+ private:
+  // Keyed by the surface id and the raw props the props were parsed from.
+  using InternedPropsCache =
+      ShardedThreadSafeCache<folly::dynamic, Props::Shared, 256>;
+
+  // Only allocated for shadow nodes which intern their props.
+  std::unique_ptr<InternedPropsCache> internedProps_;
+
+  /*
+   * Allocates the family, its event emitter and event target from one block,
+   * which keeps room for the initial state and its data, if the component
+   * has state.
+   */
+  ShadowNodeFamily::Shared createCoallocatedFamily(
+      const ShadowNodeFamilyFragment& fragment) const {
+    constexpr auto capacity =
+        CoallocationBlock::capacityFor<
+            EventTarget,
+            ConcreteEventEmitter,
+            ShadowNodeFamily>() +
+        (std::is_same<ConcreteStateData, StateData>::value
+             ? 0
+             : CoallocationBlock::
+                   capacityFor<ConcreteState, ConcreteStateData>());
+    auto coallocationBlock = CoallocationBlock::create(capacity);
+
+    auto eventEmitter = allocateCoallocatedShared<ConcreteEventEmitter>(
+        *coallocationBlock,
+        allocateCoallocatedShared<EventTarget>(
+            *coallocationBlock, fragment.instanceHandle),
+        eventDispatcher_);
+    auto family = allocateCoallocatedShared<ShadowNodeFamily>(
+        *coallocationBlock,
+        fragment,
+        std::move(eventEmitter),
+        eventDispatcher_,
+        *this);
+    family->coallocationBlock = coallocationBlock;
+
+    // From now on, the objects allocated from the block keep it alive.
+    coallocationBlock->release();
+    return family;
+  }
 };
 
 } // namespace facebook::react
@@ -15,6 +15,8 @@
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/core/ShadowNodeFamily.h>
 #include <react/renderer/core/StateData.h>
+#include <react/utils/CoreFeatures.h>
+#include <react/utils/PooledAllocator.h>
 
 namespace facebook::react {
 
@@ -74,11 +76,13 @@ class ConcreteShadowNode : public BaseShadowNodeT {
       const PropsParserContext& context,
       const RawProps& rawProps,
       const Props::Shared& baseProps = nullptr) {
-    return std::make_shared<PropsT>(
-        context,
-        baseProps ? static_cast<const PropsT&>(*baseProps)
-                  : *defaultSharedProps(),
-        rawProps);
+    const auto& sourceProps = baseProps
+        ? static_cast<const PropsT&>(*baseProps)
+        : *defaultSharedProps();
+    if (CoreFeatures::enablePooledShadowNodeAllocation) {
+      return allocatePooledShared<PropsT>(context, sourceProps, rawProps);
+    }
+    return std::make_shared<PropsT>(context, sourceProps, rawProps);
   }
 
   static const SharedConcreteProps& defaultSharedProps() {
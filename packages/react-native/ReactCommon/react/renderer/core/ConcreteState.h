@@ -9,6 +9,7 @@
 
 #include <functional>
 #include <memory>
+#include <type_traits>
 
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/core/State.h>
@@ -59,11 +60,12 @@ class ConcreteState : public State {
    * value.
    */
   void updateState(Data&& newData, EventPriority priority) const {
-    updateState(
+    dispatchUpdate(
         [data{std::move(newData)}](const Data& oldData) -> SharedData {
           return std::make_shared<Data const>(data);
         },
-        priority);
+        priority,
+        /* replacesQueuedUpdate = */ true);
   }
 
   void updateState(Data&& newData) const {
@@ -81,21 +83,8 @@ class ConcreteState : public State {
   void updateState(
       std::function<StateData::Shared(const Data& oldData)> callback,
       EventPriority priority = EventPriority::AsynchronousBatched) const {
-    auto family = family_.lock();
-
-    if (!family) {
-      // No more nodes of this family exist anymore,
-      // updating state is impossible.
-      return;
-    }
-
-    auto stateUpdate = StateUpdate{
-        family, [=](const StateData::Shared& oldData) -> StateData::Shared {
-          react_native_assert(oldData);
-          return callback(*static_cast<Data const*>(oldData.get()));
-        }};
-
-    family->dispatchRawState(std::move(stateUpdate), priority);
+    dispatchUpdate(
+        std::move(callback), priority, /* replacesQueuedUpdate = */ false);
   }
 
 #ifdef ANDROID
@@ -107,10 +96,42 @@ class ConcreteState : public State {
     updateState(Data(getData(), std::move(data)));
   }
 
+  void updateState(MapBuffer&& data) const override {
+    if constexpr (std::is_constructible_v<Data, const Data&, MapBuffer&&>) {
+      updateState(Data(getData(), std::move(data)));
+    } else {
+      react_native_assert(
+          false && "This state does not support updates from a MapBuffer.");
+    }
+  }
+
   MapBuffer getMapBuffer() const override {
     return getData().getMapBuffer();
   }
 #endif
+
+ private:
+  void dispatchUpdate(
+      std::function<StateData::Shared(const Data& oldData)> callback,
+      EventPriority priority,
+      bool replacesQueuedUpdate) const {
+    auto family = family_.lock();
+
+    if (!family) {
+      // No more nodes of this family exist anymore,
+      // updating state is impossible.
+      return;
+    }
+
+    auto stateUpdate = StateUpdate{
+        family, [=](const StateData::Shared& oldData) -> StateData::Shared {
+          react_native_assert(oldData);
+          return callback(*static_cast<Data const*>(oldData.get()));
+        },
+        replacesQueuedUpdate};
+
+    family->dispatchRawState(std::move(stateUpdate), priority);
+  }
 };
 
 } // namespace facebook::react
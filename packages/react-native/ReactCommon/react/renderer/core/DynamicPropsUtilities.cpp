@@ -7,25 +7,46 @@
 
 #include "DynamicPropsUtilities.h"
 
-namespace facebook::react {
+#include <utility>
 
-folly::dynamic mergeDynamicProps(
-    const folly::dynamic& source,
-    const folly::dynamic& patch) {
-  auto result = source;
+namespace facebook::react {
 
-  if (!result.isObject()) {
-    result = folly::dynamic::object();
+folly::dynamic mergeDynamicProps(folly::dynamic source, folly::dynamic patch) {
+  if (!patch.isObject()) {
+    return source.isObject() ? std::move(source) : folly::dynamic::object();
   }
 
-  if (!patch.isObject()) {
-    return result;
+  if (!source.isObject() || source.empty()) {
+    return patch;
   }
 
   // Note, here we have to preserve sub-prop objects with `null` value as
   // an indication for the legacy mounting layer that it needs to clean them up.
-  for (const auto& pair : patch.items()) {
-    result[pair.first] = pair.second;
+  for (auto& pair : patch.items()) {
+    source[pair.first] = std::move(pair.second);
+  }
+
+  return source;
+}
+
+folly::dynamic diffDynamicProps(
+    const folly::dynamic& source,
+    const folly::dynamic& target) {
+  auto result = folly::dynamic::object();
+
+  if (!target.isObject()) {
+    return result;
+  }
+
+  if (!source.isObject()) {
+    return target;
+  }
+
+  for (const auto& pair : target.items()) {
+    auto iterator = source.find(pair.first);
+    if (iterator == source.items().end() || iterator->second != pair.second) {
+      result[pair.first] = pair.second;
+    }
   }
 
   return result;
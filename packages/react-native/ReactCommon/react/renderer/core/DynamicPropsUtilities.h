@@ -16,9 +16,20 @@ namespace facebook::react {
  * Accepts two `folly::dynamic` objects as arguments. Both arguments need to
  * represent a dictionary. It updates `source` with key/value pairs from
  * `patch`, overriding existing keys.
+ * Both are taken by value, so callers which no longer need them can move
+ * them in to have their values moved into the result instead of copied.
  */
-folly::dynamic mergeDynamicProps(
+folly::dynamic mergeDynamicProps(folly::dynamic source, folly::dynamic patch);
+
+/*
+ * Accepts two `folly::dynamic` objects as arguments. Both arguments need to
+ * represent a dictionary. Returns key/value pairs of `target` which `source`
+ * does not have with an equal value, i.e. the patch which updates the values
+ * of `source` to the ones of `target`, disregarding keys `target` does not
+ * have.
+ */
+folly::dynamic diffDynamicProps(
     const folly::dynamic& source,
-    const folly::dynamic& patch);
+    const folly::dynamic& target);
 
 } // namespace facebook::react
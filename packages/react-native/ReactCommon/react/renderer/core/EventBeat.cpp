@@ -15,21 +15,43 @@ EventBeat::EventBeat(SharedOwnerBox ownerBox)
     : ownerBox_(std::move(ownerBox)) {}
 
 void EventBeat::request() const {
-  isRequested_ = true;
+  state_.fetch_or(kRequested);
 }
 
 void EventBeat::beat(jsi::Runtime& runtime) const {
-  if (!this->isRequested_) {
+  if ((state_.fetch_and(~kRequested) & kRequested) == 0) {
     return;
   }
 
-  isRequested_ = false;
+  if (beatCallback_) {
+    beatCallback_(runtime);
+  }
+}
+
+bool EventBeat::scheduleBeat() const {
+  auto state = state_.load();
+  do {
+    if ((state & kRequested) == 0 || (state & kScheduled) != 0) {
+      return false;
+    }
+  } while (!state_.compare_exchange_weak(state, kScheduled));
+  return true;
+}
+
+void EventBeat::beatScheduled(jsi::Runtime& runtime) const {
+  // The callback handles everything requested until now, including requests
+  // made since the beat was scheduled.
+  state_ = 0;
 
   if (beatCallback_) {
     beatCallback_(runtime);
   }
 }
 
+bool EventBeat::isRequested() const {
+  return (state_.load() & kRequested) != 0;
+}
+
 void EventBeat::induce() const {
   // Default implementation does nothing.
 }
@@ -9,6 +9,7 @@
 
 #include <jsi/jsi.h>
 #include <atomic>
+#include <cstdint>
 #include <functional>
 #include <memory>
 
@@ -81,9 +82,33 @@ class EventBeat {
    */
   void beat(jsi::Runtime& runtime) const;
 
+  /*
+   * Should be used by subclasses which send beats asynchronously (e.g. by
+   * scheduling them on the JavaScript thread) before scheduling a beat.
+   * Returns `true` if a beat is requested and none is scheduled yet, and
+   * marks a beat as scheduled; the caller must then send it with
+   * `beatScheduled`. Any number of requests (and concurrent calls) until then
+   * are served by that single beat.
+   */
+  bool scheduleBeat() const;
+
+  /*
+   * Sends a beat scheduled with `scheduleBeat`. Requests made from now on are
+   * served by the next beat.
+   */
+  void beatScheduled(jsi::Runtime& runtime) const;
+
+  bool isRequested() const;
+
   BeatCallback beatCallback_;
   SharedOwnerBox ownerBox_;
-  mutable std::atomic<bool> isRequested_{false};
+
+ private:
+  // Bits of `state_`.
+  static constexpr uint8_t kRequested = 1 << 0;
+  static constexpr uint8_t kScheduled = 1 << 1;
+
+  mutable std::atomic<uint8_t> state_{0};
 };
 
 } // namespace facebook::react
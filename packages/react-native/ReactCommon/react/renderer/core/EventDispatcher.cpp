@@ -16,11 +16,39 @@
 
 namespace facebook::react {
 
+namespace {
+
+/*
+ * Wraps `executor` so that the callback is skipped if the owner of the event
+ * dispatcher is gone by the time it runs (see `EventBeat::Owner`).
+ */
+RuntimeExecutor makeOwnedExecutor(
+    const RuntimeExecutor& executor,
+    const EventBeat::SharedOwnerBox& ownerBox) {
+  if (!executor) {
+    return nullptr;
+  }
+  return [executor, ownerBox](
+             std::function<void(jsi::Runtime & runtime)>&& callback) {
+    executor([ownerBox, callback = std::move(callback)](
+                 jsi::Runtime& runtime) {
+      auto owner = ownerBox->owner.lock();
+      if (!owner) {
+        return;
+      }
+      callback(runtime);
+    });
+  };
+}
+
+} // namespace
+
 EventDispatcher::EventDispatcher(
     const EventQueueProcessor& eventProcessor,
     const EventBeat::Factory& synchonousEventBeatFactory,
     const EventBeat::Factory& asynchronousEventBeatFactory,
-    const EventBeat::SharedOwnerBox& ownerBox)
+    const EventBeat::SharedOwnerBox& ownerBox,
+    const RuntimeExecutor& discreteEventExecutor)
     : synchronousUnbatchedQueue_(std::make_unique<UnbatchedEventQueue>(
           eventProcessor,
           synchonousEventBeatFactory(ownerBox))),
@@ -32,7 +60,8 @@ EventDispatcher::EventDispatcher(
           asynchronousEventBeatFactory(ownerBox))),
       asynchronousBatchedQueue_(std::make_unique<BatchedEventQueue>(
           eventProcessor,
-          asynchronousEventBeatFactory(ownerBox))) {}
+          asynchronousEventBeatFactory(ownerBox),
+          makeOwnedExecutor(discreteEventExecutor, ownerBox))) {}
 
 void EventDispatcher::dispatchEvent(RawEvent&& rawEvent, EventPriority priority)
     const {
@@ -54,12 +83,14 @@ void EventDispatcher::dispatchStateUpdate(
   getEventQueue(priority).enqueueStateUpdate(std::move(stateUpdate));
 }
 
-void EventDispatcher::dispatchUniqueEvent(RawEvent&& rawEvent) const {
+void EventDispatcher::dispatchUniqueEvent(
+    RawEvent&& rawEvent,
+    const EventPayloadCoalescer& coalescer) const {
   // Allows the event listener to interrupt default event dispatch
   if (eventListeners_.willDispatchEvent(rawEvent)) {
     return;
   }
-  asynchronousBatchedQueue_->enqueueUniqueEvent(std::move(rawEvent));
+  asynchronousBatchedQueue_->enqueueUniqueEvent(std::move(rawEvent), coalescer);
 }
 
 const EventQueue& EventDispatcher::getEventQueue(EventPriority priority) const {
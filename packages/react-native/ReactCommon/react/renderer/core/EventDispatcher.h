@@ -28,11 +28,16 @@ class EventDispatcher {
   using Shared = std::shared_ptr<const EventDispatcher>;
   using Weak = std::weak_ptr<const EventDispatcher>;
 
+  /*
+   * `discreteEventExecutor` is used to flush discrete events dispatched with
+   * asynchronous batched priority right away (see `EventQueue`).
+   */
   EventDispatcher(
       const EventQueueProcessor& eventProcessor,
       const EventBeat::Factory& synchonousEventBeatFactory,
       const EventBeat::Factory& asynchronousEventBeatFactory,
-      const EventBeat::SharedOwnerBox& ownerBox);
+      const EventBeat::SharedOwnerBox& ownerBox,
+      const RuntimeExecutor& discreteEventExecutor = nullptr);
 
   /*
    * Dispatches a raw event with given priority using event-delivery pipe.
@@ -42,9 +47,11 @@ class EventDispatcher {
   /*
    * Dispatches a raw event with asynchronous batched priority. Before the
    * dispatch we make sure that no other RawEvent of same type and same target
-   * is on the queue.
+   * is on the queue, coalescing their payloads with `coalescer` if provided.
    */
-  void dispatchUniqueEvent(RawEvent&& rawEvent) const;
+  void dispatchUniqueEvent(
+      RawEvent&& rawEvent,
+      const EventPayloadCoalescer& coalescer = nullptr) const;
 
   /*
    * Dispatches a state update with given priority.
@@ -120,7 +120,8 @@ void EventEmitter::dispatchUniqueEvent(
 
 void EventEmitter::dispatchUniqueEvent(
     std::string type,
-    SharedEventPayload payload) const {
+    SharedEventPayload payload,
+    const EventPayloadCoalescer& coalescer) const {
   SystraceSection s("EventEmitter::dispatchUniqueEvent");
 
   auto eventDispatcher = eventDispatcher_.lock();
@@ -128,11 +129,13 @@ void EventEmitter::dispatchUniqueEvent(
     return;
   }
 
-  eventDispatcher->dispatchUniqueEvent(RawEvent(
-      normalizeEventType(std::move(type)),
-      std::move(payload),
-      eventTarget_,
-      RawEvent::Category::Continuous));
+  eventDispatcher->dispatchUniqueEvent(
+      RawEvent(
+          normalizeEventType(std::move(type)),
+          std::move(payload),
+          eventTarget_,
+          RawEvent::Category::Continuous),
+      coalescer);
 }
 
 void EventEmitter::setEnabled(bool enabled) const {
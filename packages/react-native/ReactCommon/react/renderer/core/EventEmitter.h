@@ -89,7 +89,10 @@ class EventEmitter {
       const ValueFactory& payloadFactory =
           EventEmitter::defaultPayloadFactory()) const;
 
-  void dispatchUniqueEvent(std::string type, SharedEventPayload payload) const;
+  void dispatchUniqueEvent(
+      std::string type,
+      SharedEventPayload payload,
+      const EventPayloadCoalescer& coalescer = nullptr) const;
 
  private:
   void toggleEventTargetOwnership_() const;
@@ -7,6 +7,9 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
+
 #include <jsi/jsi.h>
 
 #include <react/renderer/core/EventPayloadType.h>
@@ -37,4 +40,15 @@ struct EventPayload {
 
 using SharedEventPayload = std::shared_ptr<const EventPayload>;
 
+/*
+ * Produces the payload of an event which coalesces with a queued event of the
+ * same type and target, given the payloads of both (e.g. to accumulate deltas
+ * instead of only keeping the newest payload).
+ * Called on the thread which dispatches the event, while the event queue is
+ * locked; must not access the JavaScript runtime.
+ */
+using EventPayloadCoalescer = std::function<SharedEventPayload(
+    const SharedEventPayload& queuedPayload,
+    SharedEventPayload payload)>;
+
 } // namespace facebook::react
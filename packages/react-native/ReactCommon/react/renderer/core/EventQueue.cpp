@@ -7,6 +7,8 @@
 
 #include "EventQueue.h"
 
+#include <react/utils/CoreFeatures.h>
+
 #include "EventEmitter.h"
 #include "ShadowNodeFamily.h"
 
@@ -14,67 +16,136 @@ namespace facebook::react {
 
 EventQueue::EventQueue(
     EventQueueProcessor eventProcessor,
-    std::unique_ptr<EventBeat> eventBeat)
+    std::unique_ptr<EventBeat> eventBeat,
+    RuntimeExecutor discreteEventExecutor)
     : eventProcessor_(std::move(eventProcessor)),
-      eventBeat_(std::move(eventBeat)) {
+      eventBeat_(std::move(eventBeat)),
+      discreteEventExecutor_(std::move(discreteEventExecutor)) {
   eventBeat_->setBeatCallback(
       [this](jsi::Runtime& runtime) { onBeat(runtime); });
 }
 
 void EventQueue::enqueueEvent(RawEvent&& rawEvent) const {
+  auto shouldFlush = false;
   {
     std::scoped_lock lock(queueMutex_);
+    shouldFlush = isDiscreteEvent(rawEvent) && shouldScheduleDiscreteFlush();
+    lastEventIndices_[rawEvent.eventTarget.get()] = eventQueue_.size();
     eventQueue_.push_back(std::move(rawEvent));
   }
 
   onEnqueue();
+  if (shouldFlush) {
+    scheduleDiscreteFlush();
+  }
 }
 
-void EventQueue::enqueueUniqueEvent(RawEvent&& rawEvent) const {
+void EventQueue::enqueueUniqueEvent(
+    RawEvent&& rawEvent,
+    const EventPayloadCoalescer& coalescer) const {
+  auto shouldFlush = false;
   {
     std::scoped_lock lock(queueMutex_);
-
-    auto repeatedEvent = eventQueue_.rend();
-
-    for (auto it = eventQueue_.rbegin(); it != eventQueue_.rend(); ++it) {
-      if (it->type == rawEvent.type &&
-          it->eventTarget == rawEvent.eventTarget) {
-        repeatedEvent = it;
-        break;
-      } else if (it->eventTarget == rawEvent.eventTarget) {
-        // It is necessary to maintain order of different event types
-        // for the same target. If the same target has event types A1, B1
-        // in the event queue and event A2 occurs. A1 has to stay in the
-        // queue.
-        break;
+    shouldFlush = isDiscreteEvent(rawEvent) && shouldScheduleDiscreteFlush();
+
+    // Only the last event of the same target can be replaced: it is necessary
+    // to maintain order of different event types for the same target. If the
+    // same target has event types A1, B1 in the event queue and event A2
+    // occurs, A1 has to stay in the queue.
+    auto [lastEventIndex, isFirstEventOfTarget] = lastEventIndices_.try_emplace(
+        rawEvent.eventTarget.get(), eventQueue_.size());
+
+    if (!isFirstEventOfTarget &&
+        eventQueue_[lastEventIndex->second].type == rawEvent.type) {
+      auto& repeatedEvent = eventQueue_[lastEventIndex->second];
+      if (coalescer) {
+        rawEvent.eventPayload = coalescer(
+            repeatedEvent.eventPayload, std::move(rawEvent.eventPayload));
       }
-    }
-
-    if (repeatedEvent == eventQueue_.rend()) {
-      eventQueue_.push_back(std::move(rawEvent));
+      repeatedEvent = std::move(rawEvent);
     } else {
-      *repeatedEvent = std::move(rawEvent);
+      lastEventIndex->second = eventQueue_.size();
+      eventQueue_.push_back(std::move(rawEvent));
     }
   }
 
   onEnqueue();
+  if (shouldFlush) {
+    scheduleDiscreteFlush();
+  }
 }
 
 void EventQueue::enqueueStateUpdate(StateUpdate&& stateUpdate) const {
   {
     std::scoped_lock lock(queueMutex_);
-    if (!stateUpdateQueue_.empty()) {
-      const auto position = stateUpdateQueue_.back();
-      if (stateUpdate.family == position.family) {
-        stateUpdateQueue_.pop_back();
+
+    auto [queuedUpdateIndex, isFirstUpdateOfFamily] =
+        stateUpdateIndices_.try_emplace(
+            stateUpdate.family.get(), stateUpdateQueue_.size());
+
+    if (isFirstUpdateOfFamily) {
+      stateUpdateQueue_.push_back(std::move(stateUpdate));
+    } else {
+      auto& queuedUpdate = stateUpdateQueue_[queuedUpdateIndex->second];
+      if (!stateUpdate.replacesQueuedUpdate) {
+        // Both callbacks are applied in order, as if they were committed one
+        // after another; either of them can still cancel its own part.
+        stateUpdate.callback =
+            [queuedCallback = std::move(queuedUpdate.callback),
+             callback = std::move(stateUpdate.callback)](
+                const StateData::Shared& oldData) -> StateData::Shared {
+          auto queuedData = queuedCallback(oldData);
+          auto newData = callback(queuedData ? queuedData : oldData);
+          return newData ? newData : queuedData;
+        };
+        stateUpdate.replacesQueuedUpdate = queuedUpdate.replacesQueuedUpdate;
       }
+      queuedUpdate = std::move(stateUpdate);
     }
-    stateUpdateQueue_.push_back(std::move(stateUpdate));
   }
 
   onEnqueue();
 }
 
+bool EventQueue::isDiscreteEvent(const RawEvent& rawEvent) const {
+  switch (rawEvent.category) {
+    case RawEvent::Category::ContinuousStart: {
+      auto isDiscrete = !hasContinuousEventStarted_;
+      hasContinuousEventStarted_ = true;
+      return isDiscrete;
+    }
+    case RawEvent::Category::ContinuousEnd:
+      hasContinuousEventStarted_ = false;
+      return true;
+    case RawEvent::Category::Unspecified:
+      return !hasContinuousEventStarted_;
+    case RawEvent::Category::Discrete:
+      return true;
+    case RawEvent::Category::Continuous:
+      return false;
+  }
+}
+
+bool EventQueue::shouldScheduleDiscreteFlush() const {
+  if (!discreteEventExecutor_ ||
+      !CoreFeatures::enableImmediateDiscreteEvents ||
+      isDiscreteFlushScheduled_) {
+    return false;
+  }
+  isDiscreteFlushScheduled_ = true;
+  return true;
+}
+
+void EventQueue::scheduleDiscreteFlush() const {
+  discreteEventExecutor_([this](jsi::Runtime& runtime) {
+    {
+      std::scoped_lock lock(queueMutex_);
+      isDiscreteFlushScheduled_ = false;
+    }
+    onBeat(runtime);
+  });
+}
+
 void EventQueue::onBeat(jsi::Runtime& runtime) const {
   flushStateUpdates();
   flushEvents(runtime);
@@ -92,6 +163,7 @@ void EventQueue::flushEvents(jsi::Runtime& runtime) const {
 
     queue = std::move(eventQueue_);
     eventQueue_.clear();
+    lastEventIndices_.clear();
   }
 
   eventProcessor_.flushEvents(runtime, std::move(queue));
@@ -109,6 +181,7 @@ void EventQueue::flushStateUpdates() const {
 
     stateUpdateQueue = std::move(stateUpdateQueue_);
     stateUpdateQueue_.clear();
+    stateUpdateIndices_.clear();
   }
 
   eventProcessor_.flushStateUpdates(std::move(stateUpdateQueue));
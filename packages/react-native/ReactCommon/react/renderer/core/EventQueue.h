@@ -9,8 +9,10 @@
 
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
+#include <ReactCommon/RuntimeExecutor.h>
 #include <jsi/jsi.h>
 #include <react/renderer/core/EventBeat.h>
 #include <react/renderer/core/EventQueueProcessor.h>
@@ -22,12 +24,21 @@ namespace facebook::react {
 /*
  * Event Queue synchronized with given Event Beat and dispatching event
  * using given Event Pipe.
+ * Events belong to one of two lanes, depending on the React priority they are
+ * going to be dispatched with (see `EventQueueProcessor`): continuous events
+ * wait for the next beat, while discrete events are flushed right away with
+ * `discreteEventExecutor` (when provided and
+ * `CoreFeatures::enableImmediateDiscreteEvents` is on). A flush dispatches
+ * all queued events in order, so a discrete event never overtakes the
+ * continuous events enqueued before it; these are coalesced, so a burst of
+ * them doesn't delay it much.
  */
 class EventQueue {
  public:
   EventQueue(
       EventQueueProcessor eventProcessor,
-      std::unique_ptr<EventBeat> eventBeat);
+      std::unique_ptr<EventBeat> eventBeat,
+      RuntimeExecutor discreteEventExecutor = nullptr);
   virtual ~EventQueue() = default;
 
   /*
@@ -38,13 +49,20 @@ class EventQueue {
 
   /*
    * Enqueues and (probably later) dispatches a given event.
-   * Deletes last RawEvent from the queue if it has the same type and target.
+   * Replaces the last RawEvent of the same target in the queue if it has the
+   * same type, using `coalescer` (if provided) to produce the payload of the
+   * resulting event. Events of other types for the same target are never
+   * reordered.
    * Can be called on any thread.
    */
-  void enqueueUniqueEvent(RawEvent&& rawEvent) const;
+  void enqueueUniqueEvent(
+      RawEvent&& rawEvent,
+      const EventPayloadCoalescer& coalescer = nullptr) const;
 
   /*
    * Enqueues and (probably later) dispatch a given state update.
+   * Coalesces it with the queued update of the same family, if any (see
+   * `StateUpdate::replacesQueuedUpdate`).
    * Can be called on any thread.
    */
   void enqueueStateUpdate(StateUpdate&& stateUpdate) const;
@@ -64,11 +82,35 @@ class EventQueue {
   EventQueueProcessor eventProcessor_;
 
   const std::unique_ptr<EventBeat> eventBeat_;
+  const RuntimeExecutor discreteEventExecutor_;
   // Thread-safe, protected by `queueMutex_`.
   mutable std::vector<RawEvent> eventQueue_;
   mutable std::vector<StateUpdate> stateUpdateQueue_;
+  // Index of the last event of every target in `eventQueue_`, so coalescing
+  // unique events doesn't need to search the queue.
+  mutable std::unordered_map<const EventTarget*, size_t> lastEventIndices_;
+  // Index of the update of every family in `stateUpdateQueue_`.
+  mutable std::unordered_map<const ShadowNodeFamily*, size_t>
+      stateUpdateIndices_;
   mutable std::mutex queueMutex_;
   mutable bool hasContinuousEventStarted_{false};
+  mutable bool isDiscreteFlushScheduled_{false};
+
+ private:
+  /*
+   * Returns whether `rawEvent` goes to the discrete lane, keeping track of
+   * ongoing continuous events the same way `EventQueueProcessor` does.
+   * Must be called with `queueMutex_` locked, in the order of the queue.
+   */
+  bool isDiscreteEvent(const RawEvent& rawEvent) const;
+
+  /*
+   * Returns whether an enqueued discrete event has to schedule a flush.
+   * Must be called with `queueMutex_` locked.
+   */
+  bool shouldScheduleDiscreteFlush() const;
+
+  void scheduleDiscreteFlush() const;
 };
 
 } // namespace facebook::react
@@ -95,9 +95,7 @@ void EventQueueProcessor::flushEvents(
 
 void EventQueueProcessor::flushStateUpdates(
     std::vector<StateUpdate>&& states) const {
-  for (const auto& stateUpdate : states) {
-    statePipe_(stateUpdate);
-  }
+  statePipe_(states);
 }
 
 } // namespace facebook::react
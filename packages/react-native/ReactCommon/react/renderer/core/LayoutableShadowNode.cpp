@@ -14,6 +14,8 @@
 #include <react/renderer/core/graphicsConversions.h>
 #include <react/renderer/debug/DebugStringConvertibleItem.h>
 
+#include <algorithm>
+
 namespace facebook::react {
 
 template <class T>
@@ -159,10 +161,12 @@ LayoutMetrics LayoutableShadowNode::computeRelativeLayoutMetrics(
 
   // ------------------------------
   // TODO: T127619309 remove after validating that T127619309 is fixed
+  static const auto calculateTransformedFramesKey =
+      ContextContainer::Key<bool>("CalculateTransformedFramesEnabled");
   auto optionalCalculateTransformedFrames =
       descendantNode->getContextContainer()
-      ? descendantNode->getContextContainer()->find<bool>(
-            "CalculateTransformedFramesEnabled")
+      ? descendantNode->getContextContainer()->find(
+            calculateTransformedFramesKey)
       : std::optional<bool>(false);
 
   bool shouldCalculateTransformedFrames =
@@ -262,6 +266,10 @@ Point LayoutableShadowNode::getContentOriginOffset() const {
   return {0, 0};
 }
 
+std::optional<Rect> LayoutableShadowNode::getContentWindow() const {
+  return std::nullopt;
+}
+
 LayoutableShadowNode::UnsharedList
 LayoutableShadowNode::getLayoutableChildNodes() const {
   LayoutableShadowNode::UnsharedList layoutableChildren;
@@ -282,6 +290,23 @@ Size LayoutableShadowNode::measureContent(
   return {};
 }
 
+std::vector<Size> LayoutableShadowNode::measureContentBatch(
+    const LayoutContext& layoutContext,
+    const std::vector<const LayoutableShadowNode*>& nodes,
+    const std::vector<LayoutConstraints>& layoutConstraints) const {
+  auto sizes = std::vector<Size>{};
+  sizes.reserve(nodes.size());
+  for (size_t i = 0; i < nodes.size(); i++) {
+    sizes.push_back(
+        nodes[i]->measureContent(layoutContext, layoutConstraints[i]));
+  }
+  return sizes;
+}
+
+void LayoutableShadowNode::prepareMeasurement(
+    const LayoutContext& /*layoutContext*/,
+    Float /*likelyWidth*/) const {}
+
 Size LayoutableShadowNode::measure(
     const LayoutContext& layoutContext,
     const LayoutConstraints& layoutConstraints) const {
@@ -325,15 +350,24 @@ ShadowNode::Shared LayoutableShadowNode::findNodeAtPoint(
   auto newPoint = point - transformedFrame.origin -
       layoutableShadowNode->getContentOriginOffset();
 
-  auto sortedChildren = node->getChildren();
-  std::stable_sort(
-      sortedChildren.begin(),
-      sortedChildren.end(),
-      [](const auto& lhs, const auto& rhs) -> bool {
-        return lhs->getOrderIndex() < rhs->getOrderIndex();
-      });
+  auto compareOrderIndex = [](const auto& lhs, const auto& rhs) -> bool {
+    return lhs->getOrderIndex() < rhs->getOrderIndex();
+  };
+
+  // Children are usually in order (e.g. without any `zIndex`), in which case
+  // they are hit tested in place rather than from a sorted copy.
+  const auto& children = node->getChildren();
+  auto sortedChildren = ShadowNode::ListOfShared{};
+  if (!std::is_sorted(children.begin(), children.end(), compareOrderIndex)) {
+    sortedChildren = children;
+    std::stable_sort(
+        sortedChildren.begin(), sortedChildren.end(), compareOrderIndex);
+  }
+  const auto& orderedChildren =
+      sortedChildren.empty() ? children : sortedChildren;
 
-  for (auto it = sortedChildren.rbegin(); it != sortedChildren.rend(); it++) {
+  for (auto it = orderedChildren.rbegin(); it != orderedChildren.rend();
+       it++) {
     const auto& childShadowNode = *it;
     auto hitView = findNodeAtPoint(childShadowNode, newPoint);
     if (hitView) {
@@ -10,6 +10,7 @@
 #include <array>
 #include <cmath>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include <react/debug/react_native_assert.h>
@@ -83,6 +84,28 @@ class LayoutableShadowNode : public ShadowNode {
       const LayoutContext& layoutContext,
       const LayoutConstraints& layoutConstraints) const;
 
+  /*
+   * Measures the content of `nodes`, which are all of the same component as
+   * this node, each with the constraints at the same index in
+   * `layoutConstraints`. Lets nodes measure their content with a single call
+   * to the platform. Default implementation calls `measureContent` on every
+   * node.
+   */
+  virtual std::vector<Size> measureContentBatch(
+      const LayoutContext& layoutContext,
+      const std::vector<const LayoutableShadowNode*>& nodes,
+      const std::vector<LayoutConstraints>& layoutConstraints) const;
+
+  /*
+   * Called on nodes with dirty layout before the layout of their tree is
+   * calculated, with the width they are likely to be measured at. Lets nodes
+   * with expensive measurements (e.g. of text) start them asynchronously.
+   * Default implementation does nothing.
+   */
+  virtual void prepareMeasurement(
+      const LayoutContext& layoutContext,
+      Float likelyWidth) const;
+
   /*
    * Measures the node with given `layoutContext` and `layoutConstraints`.
    * The size of nested content and the padding should be included, the margin
@@ -125,6 +148,14 @@ class LayoutableShadowNode : public ShadowNode {
    */
   virtual Point getContentOriginOffset() const;
 
+  /*
+   * Returns the rectangle (in the coordinate space of the node) outside of
+   * which the children of the children of the node don't need to be mounted,
+   * or nothing if all of them must be mounted. Only called on nodes which
+   * have the `WindowsContent` trait.
+   */
+  virtual std::optional<Rect> getContentWindow() const;
+
   /*
    * Sets layout metrics for the shadow node.
    */
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "MapBufferEventPayload.h"
+
+namespace facebook::react {
+
+static jsi::Value mapBufferToJSIValue(
+    jsi::Runtime& runtime,
+    const MapBuffer& map);
+
+static jsi::Value mapBufferEntryToJSIValue(
+    jsi::Runtime& runtime,
+    const MapBuffer& map,
+    MapBuffer::Key key) {
+  if (!map.contains(key)) {
+    return jsi::Value::null();
+  }
+  switch (map.getType(key)) {
+    case MapBuffer::DataType::Boolean:
+      return {map.getBool(key)};
+    case MapBuffer::DataType::Int:
+      return {map.getInt(key)};
+    case MapBuffer::DataType::Double:
+      return {map.getDouble(key)};
+    case MapBuffer::DataType::String:
+      return jsi::String::createFromUtf8(runtime, map.getString(key));
+    case MapBuffer::DataType::Map:
+      return mapBufferToJSIValue(runtime, map.getMapBuffer(key));
+  }
+  return jsi::Value::null();
+}
+
+static jsi::Value mapBufferToJSIValue(
+    jsi::Runtime& runtime,
+    const MapBuffer& map) {
+  if (map.contains(MapBufferEventPayload::kArrayLengthKey)) {
+    auto length =
+        static_cast<size_t>(map.getInt(MapBufferEventPayload::kArrayLengthKey));
+    auto array = jsi::Array(runtime, length);
+    for (size_t i = 0; i < length; i++) {
+      array.setValueAtIndex(
+          runtime,
+          i,
+          mapBufferEntryToJSIValue(
+              runtime, map, static_cast<MapBuffer::Key>(i)));
+    }
+    return array;
+  }
+
+  auto object = jsi::Object(runtime);
+  for (MapBuffer::Key nameKey = 0;
+       nameKey < MapBufferEventPayload::kArrayLengthKey &&
+       map.contains(nameKey);
+       nameKey += 2) {
+    object.setProperty(
+        runtime,
+        jsi::PropNameID::forUtf8(runtime, map.getString(nameKey)),
+        mapBufferEntryToJSIValue(
+            runtime, map, static_cast<MapBuffer::Key>(nameKey + 1)));
+  }
+  return object;
+}
+
+MapBufferEventPayload::MapBufferEventPayload(MapBuffer payload)
+    : payload_(std::move(payload)) {}
+
+jsi::Value MapBufferEventPayload::asJSIValue(jsi::Runtime& runtime) const {
+  return mapBufferToJSIValue(runtime, payload_);
+}
+
+EventPayloadType MapBufferEventPayload::getType() const {
+  return EventPayloadType::MapBuffer;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/core/EventPayload.h>
+#include <react/renderer/mapbuffer/MapBuffer.h>
+
+#include <limits>
+
+namespace facebook::react {
+
+/*
+ * An event payload serialized into a `MapBuffer`, which is converted to JSI
+ * values straight from the buffer when the event is dispatched to JS.
+ *
+ * As `MapBuffer` keys are integers, the payload is a JS object laid out as:
+ *  - the name of the property `i` is the string at key `2 * i`;
+ *  - its value is at key `2 * i + 1`, and is `null` when there is none.
+ * Nested `MapBuffer`s are objects with the same layout, except for those with
+ * an int at `kArrayLengthKey`, which are arrays of that length whose element
+ * `i` is at key `i` (or `null` when there is none).
+ */
+class MapBufferEventPayload : public EventPayload {
+ public:
+  static constexpr MapBuffer::Key kArrayLengthKey =
+      std::numeric_limits<MapBuffer::Key>::max();
+
+  explicit MapBufferEventPayload(MapBuffer payload);
+  jsi::Value asJSIValue(jsi::Runtime& runtime) const override;
+  EventPayloadType getType() const override;
+
+ private:
+  MapBuffer payload_;
+};
+
+} // namespace facebook::react
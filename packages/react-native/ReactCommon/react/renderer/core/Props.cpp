@@ -30,6 +30,18 @@ void Props::initialize(
 #ifdef ANDROID
   this->rawProps = (folly::dynamic)rawProps;
 #endif
+  if (CoreFeatures::enableSkippingUnchangedRawProps) {
+    rawPropsPrimitiveValues =
+        rawProps.getPrimitiveValues(sourceProps.rawPropsPrimitiveValues);
+  }
+  if (CoreFeatures::enableCommitCapture) {
+    auto capturedRawProps = sourceProps.capturedRawProps
+        ? *sourceProps.capturedRawProps
+        : folly::dynamic::object();
+    capturedRawProps.update((folly::dynamic)rawProps);
+    this->capturedRawProps =
+        std::make_shared<const folly::dynamic>(std::move(capturedRawProps));
+  }
 }
 
 void Props::setProp(
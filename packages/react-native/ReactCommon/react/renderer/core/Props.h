@@ -61,6 +61,20 @@ class Props : public virtual Sealable, public virtual DebugStringConvertible {
   folly::dynamic rawProps = folly::dynamic::object();
 #endif
 
+  /*
+   * Primitive values of the raw props this object reflects, which allow
+   * skipping unchanged values when parsing the raw props of its clones.
+   * Only kept if `CoreFeatures::enableSkippingUnchangedRawProps` is enabled.
+   */
+  std::shared_ptr<const RawPropsPrimitiveValues> rawPropsPrimitiveValues;
+
+  /*
+   * Raw props this object was parsed from, merged with those of the props it
+   * was cloned from, so that `CommitCaptureHook` can capture them.
+   * Only kept if `CoreFeatures::enableCommitCapture` is enabled.
+   */
+  std::shared_ptr<const folly::dynamic> capturedRawProps;
+
  protected:
   /** Initialize member variables of Props instance */
   void initialize(
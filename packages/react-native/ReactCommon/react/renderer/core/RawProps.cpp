@@ -11,6 +11,8 @@
 #include <react/renderer/core/RawPropsKey.h>
 #include <react/renderer/core/RawPropsParser.h>
 
+#include <algorithm>
+
 namespace facebook::react {
 
 namespace {
@@ -101,6 +103,15 @@ inline bool isYogaStyleProp(const std::string& prop) {
 
   return yogaStylePropNames.find(prop) != yogaStylePropNames.end();
 }
+
+// Longer strings are not worth keeping for comparisons.
+constexpr auto kMaxPrimitiveStringLength = size_t{32};
+
+inline bool isPrimitiveValue(const folly::dynamic& value) {
+  return value.isNull() || value.isBool() || value.isNumber() ||
+      (value.isString() &&
+       value.getString().size() <= kMaxPrimitiveStringLength);
+}
 } // namespace
 
 RawProps::RawProps() {
@@ -160,10 +171,55 @@ RawProps& RawProps::operator=(const RawProps& other) noexcept {
   return *this;
 }
 
-void RawProps::parse(const RawPropsParser& parser) noexcept {
+void RawProps::parse(
+    const RawPropsParser& parser,
+    const RawPropsPrimitiveValues* sourceValues) noexcept {
   react_native_assert(parser_ == nullptr && "A parser was already assigned.");
   parser_ = &parser;
+  sourceValues_ = sourceValues;
   parser.preparse(*this);
+  sourceValues_ = nullptr;
+}
+
+std::shared_ptr<const RawPropsPrimitiveValues> RawProps::getPrimitiveValues(
+    const std::shared_ptr<const RawPropsPrimitiveValues>& sourceValues)
+    const {
+  // Props which were left out keep the values of the source props.
+  if (std::all_of(
+          keyIndexToValueIndex_.begin(),
+          keyIndexToValueIndex_.end(),
+          [](RawPropsValueIndex valueIndex) {
+            return valueIndex == kRawPropsValueIndexEmpty;
+          })) {
+    return sourceValues;
+  }
+
+  static const auto noValues = RawPropsPrimitiveValues{};
+  const auto& source = sourceValues ? *sourceValues : noValues;
+  auto primitiveValues = std::make_shared<RawPropsPrimitiveValues>();
+  primitiveValues->reserve(source.size());
+
+  auto sourceIndex = size_t{0};
+  for (size_t keyIndex = 0; keyIndex < keyIndexToValueIndex_.size();
+       keyIndex++) {
+    auto hasSourceValue = sourceIndex < source.size() &&
+        source[sourceIndex].keyIndex == keyIndex;
+    auto valueIndex = keyIndexToValueIndex_[keyIndex];
+    if (valueIndex == kRawPropsValueIndexEmpty) {
+      if (hasSourceValue) {
+        primitiveValues->push_back(source[sourceIndex]);
+      }
+    } else if (isPrimitiveValue(values_[valueIndex].dynamic_)) {
+      primitiveValues->push_back(RawPropsPrimitiveValue{
+          static_cast<RawPropsValueIndex>(keyIndex),
+          values_[valueIndex].dynamic_});
+    }
+    if (hasSourceValue) {
+      sourceIndex++;
+    }
+  }
+
+  return primitiveValues;
 }
 
 /*
@@ -203,10 +259,14 @@ const RawValue* RawProps::at(
     const char* name,
     const char* prefix,
     const char* suffix) const noexcept {
+  return at(RawPropsKey{prefix, name, suffix});
+}
+
+const RawValue* RawProps::at(const RawPropsKey& key) const noexcept {
   react_native_assert(
       parser_ &&
       "The object is not parsed. `parse` must be called before `at`.");
-  return parser_->at(*this, RawPropsKey{prefix, name, suffix});
+  return parser_->at(*this, key);
 }
 
 void RawProps::iterateOverValues(
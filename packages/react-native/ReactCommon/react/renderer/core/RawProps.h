@@ -8,12 +8,15 @@
 #pragma once
 
 #include <limits>
+#include <memory>
 #include <optional>
+#include <string>
 
 #include <folly/dynamic.h>
 #include <jsi/JSIDynamic.h>
 #include <jsi/jsi.h>
 #include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/core/RawPropsKey.h>
 #include <react/renderer/core/RawPropsPrimitives.h>
 #include <react/renderer/core/RawValue.h>
 #include <vector>
@@ -22,6 +25,22 @@ namespace facebook::react {
 
 class RawPropsParser;
 
+/*
+ * A primitive value (`null`, a boolean, a number or a short string) of a raw
+ * prop, stored with the index of its key in the parser.
+ */
+struct RawPropsPrimitiveValue {
+  RawPropsValueIndex keyIndex;
+  folly::dynamic value;
+};
+
+/*
+ * Primitive values of the raw props a `Props` object reflects, sorted by the
+ * index of their key. Allows telling which values of the raw props of a clone
+ * are unchanged without converting them.
+ */
+using RawPropsPrimitiveValues = std::vector<RawPropsPrimitiveValue>;
+
 /*
  * `RawProps` represents an untyped map of props comes from JavaScript side.
  * `RawProps` stores JSI (or `folly::dynamic`) primitives inside and abstract
@@ -64,7 +83,24 @@ class RawProps final {
    */
   explicit RawProps(folly::dynamic dynamic) noexcept;
 
-  void parse(const RawPropsParser& parser) noexcept;
+  /*
+   * Prepares the object for `at` calls by `Props` constructors.
+   * If `sourceValues` are given (the primitive values of the props which are
+   * cloned), JSI values equal to them are left out, as if they were not sent,
+   * so the constructors keep the values of the source props for them. That is
+   * what the constructors do for props React left out of the update anyway.
+   */
+  void parse(
+      const RawPropsParser& parser,
+      const RawPropsPrimitiveValues* sourceValues = nullptr) noexcept;
+
+  /*
+   * Returns the primitive values of the raw props reflected by a `Props`
+   * object parsed from this object, given those of its source props.
+   */
+  std::shared_ptr<const RawPropsPrimitiveValues> getPrimitiveValues(
+      const std::shared_ptr<const RawPropsPrimitiveValues>& sourceValues)
+      const;
 
   /*
    * Deprecated. Do not use.
@@ -95,6 +131,12 @@ class RawProps final {
   const RawValue* at(const char* name, const char* prefix, const char* suffix)
       const noexcept;
 
+  /*
+   * Same as above, for a key constructed by the caller. Prefer this in inline
+   * code, where the hash of the key can be computed at compile time.
+   */
+  const RawValue* at(const RawPropsKey& key) const noexcept;
+
   /**
    * Iterator functions: for when you want to iterate over values in-order
    * instead of using `at` to access values randomly.
@@ -107,6 +149,7 @@ class RawProps final {
   friend class RawPropsParser;
 
   mutable const RawPropsParser* parser_{nullptr};
+  const RawPropsPrimitiveValues* sourceValues_{nullptr};
 
   /*
    * Source artefacts:
@@ -59,8 +59,9 @@ static bool areFieldsEqual(const char* lhs, const char* rhs) {
 }
 
 bool operator==(const RawPropsKey& lhs, const RawPropsKey& rhs) noexcept {
-  // Note: We check the name first.
-  return areFieldsEqual(lhs.name, rhs.name) &&
+  // Note: We check the hash and the name first, so comparing fragments of
+  // different keys almost never compares strings.
+  return lhs.hash == rhs.hash && areFieldsEqual(lhs.name, rhs.name) &&
       areFieldsEqual(lhs.prefix, rhs.prefix) &&
       areFieldsEqual(lhs.suffix, rhs.suffix);
 }
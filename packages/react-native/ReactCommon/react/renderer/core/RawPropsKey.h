@@ -8,20 +8,38 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 #include <react/renderer/core/RawPropsPrimitives.h>
+#include <react/utils/fnv1a.h>
 
 namespace facebook::react {
 
 /*
  * Represent a prop name stored as three `char const *` fragments.
+ * Also stores the hash of the compound prop name, which is computed at compile
+ * time for keys made of string literals.
  */
 class RawPropsKey final {
  public:
+  constexpr RawPropsKey() noexcept = default;
+
+  constexpr RawPropsKey(
+      const char* prefix,
+      const char* name,
+      const char* suffix) noexcept
+      : prefix(prefix), name(name), suffix(suffix), hash(hashOf(*this)) {}
+
   const char* prefix{};
   const char* name{};
   const char* suffix{};
 
+  /*
+   * The `fnv1a` hash of the compound prop name, which is equal to the
+   * `RAW_PROPS_KEY_HASH` of the rendered name.
+   */
+  RawPropsPropNameHash hash{fnv1a({})};
+
   /*
    * Converts to `std::string`.
    */
@@ -32,6 +50,22 @@ class RawPropsKey final {
    * into `length`.
    */
   void render(char* buffer, RawPropsPropNameLength* length) const noexcept;
+
+ private:
+  static constexpr RawPropsPropNameHash hashOf(
+      const RawPropsKey& key) noexcept {
+    auto hash = fnv1a({});
+    if (key.prefix != nullptr) {
+      hash = fnv1a(key.prefix, hash);
+    }
+    if (key.name != nullptr) {
+      hash = fnv1a(key.name, hash);
+    }
+    if (key.suffix != nullptr) {
+      hash = fnv1a(key.suffix, hash);
+    }
+    return hash;
+  }
 };
 
 bool operator==(const RawPropsKey& lhs, const RawPropsKey& rhs) noexcept;
@@ -8,12 +8,14 @@
 #include "RawPropsKeyMap.h"
 
 #include <react/debug/react_native_assert.h>
+#include <react/utils/fnv1a.h>
 
 #include <glog/logging.h>
 #include <algorithm>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <string_view>
 
 namespace facebook::react {
 
@@ -32,12 +34,102 @@ bool RawPropsKeyMap::shouldFirstOneBeBeforeSecondOne(
   return std::memcmp(lhs.name, rhs.name, rhs.length) < 0;
 }
 
+uint32_t RawPropsKeyMap::hashOfName(
+    const char* name,
+    RawPropsPropNameLength length) noexcept {
+  return fnv1a(std::string_view{name, length});
+}
+
+size_t RawPropsKeyMap::slotOfHash(
+    uint32_t hash,
+    uint16_t displacement,
+    size_t slotCount) noexcept {
+  // Mixing the displacement into all bits of the hash (with the finalizer of
+  // MurmurHash3), so names of a bucket are moved independently of each other.
+  auto mixed = hash ^ (uint32_t{displacement} * 0x9e3779b9u);
+  mixed ^= mixed >> 16;
+  mixed *= 0x85ebca6bu;
+  mixed ^= mixed >> 13;
+  return mixed & (slotCount - 1);
+}
+
+bool RawPropsKeyMap::buildPerfectHash(size_t slotCount) noexcept {
+  // Searching for a displacement of each bucket of names, starting with the
+  // largest buckets, which are the hardest to place (aka "hash and
+  // displace").
+  constexpr auto kMaxDisplacement = uint16_t{4096};
+
+  auto bucketCount = size_t{1};
+  while (bucketCount * 2 < items_.size()) {
+    bucketCount *= 2;
+  }
+
+  auto hashes = std::vector<uint32_t>(items_.size());
+  auto bucketItems = std::vector<std::vector<size_t>>(bucketCount);
+  for (size_t i = 0; i < items_.size(); i++) {
+    hashes[i] = items_[i].hash;
+    bucketItems[hashes[i] & (bucketCount - 1)].push_back(i);
+  }
+
+  auto bucketOrder = std::vector<size_t>(bucketCount);
+  for (size_t i = 0; i < bucketCount; i++) {
+    bucketOrder[i] = i;
+  }
+  std::stable_sort(
+      bucketOrder.begin(), bucketOrder.end(), [&](size_t lhs, size_t rhs) {
+        return bucketItems[lhs].size() > bucketItems[rhs].size();
+      });
+
+  displacements_.assign(bucketCount, 0);
+  slots_.assign(slotCount, kRawPropsValueIndexEmpty);
+  auto bucketSlots = std::vector<size_t>{};
+
+  for (auto bucket : bucketOrder) {
+    const auto& items = bucketItems[bucket];
+    if (items.empty()) {
+      break;
+    }
+
+    auto displacement = uint16_t{0};
+    for (; displacement < kMaxDisplacement; displacement++) {
+      bucketSlots.clear();
+      for (auto item : items) {
+        auto slot = slotOfHash(hashes[item], displacement, slotCount);
+        if (slots_[slot] != kRawPropsValueIndexEmpty ||
+            std::find(bucketSlots.begin(), bucketSlots.end(), slot) !=
+                bucketSlots.end()) {
+          break;
+        }
+        bucketSlots.push_back(slot);
+      }
+      if (bucketSlots.size() == items.size()) {
+        break;
+      }
+    }
+
+    if (displacement == kMaxDisplacement) {
+      displacements_.clear();
+      slots_.clear();
+      return false;
+    }
+
+    displacements_[bucket] = displacement;
+    for (size_t i = 0; i < items.size(); i++) {
+      slots_[bucketSlots[i]] = static_cast<RawPropsValueIndex>(items[i]);
+    }
+  }
+
+  return true;
+}
+
 void RawPropsKeyMap::insert(
     const RawPropsKey& key,
     RawPropsValueIndex value) noexcept {
   auto item = Item{};
   item.value = value;
+  item.hash = key.hash;
   key.render(item.name, &item.length);
+  react_native_assert(item.hash == hashOfName(item.name, item.length));
   items_.push_back(item);
   react_native_assert(
       items_.size() < std::numeric_limits<RawPropsPropNameLength>::max());
@@ -89,13 +181,53 @@ void RawPropsKeyMap::reindex() noexcept {
   for (auto j = length; j < buckets_.size(); j++) {
     buckets_[j] = static_cast<RawPropsPropNameLength>(items_.size());
   }
+
+  displacements_.clear();
+  slots_.clear();
+  if (items_.empty()) {
+    return;
+  }
+
+  // Half of the slots are left empty, which makes finding displacements fast.
+  // Names with colliding hashes cannot be told apart by any displacement, in
+  // which case more slots do not help either.
+  auto slotCount = size_t{2};
+  while (slotCount < items_.size() * 2) {
+    slotCount *= 2;
+  }
+  for (auto attempt = 0; attempt < 3; attempt++, slotCount *= 2) {
+    if (buildPerfectHash(slotCount)) {
+      break;
+    }
+  }
 }
 
 RawPropsValueIndex RawPropsKeyMap::at(
     const char* name,
     RawPropsPropNameLength length) noexcept {
+  return at(name, length, hashOfName(name, length));
+}
+
+RawPropsValueIndex RawPropsKeyMap::at(
+    const char* name,
+    RawPropsPropNameLength length,
+    RawPropsPropNameHash hash) noexcept {
   react_native_assert(length > 0);
   react_native_assert(length < kPropNameLengthHardCap);
+  react_native_assert(hash == hashOfName(name, length));
+  if (!slots_.empty()) [[likely]] {
+    auto displacement = displacements_[hash & (displacements_.size() - 1)];
+    auto index = slots_[slotOfHash(hash, displacement, slots_.size())];
+    if (index == kRawPropsValueIndexEmpty) {
+      return kRawPropsValueIndexEmpty;
+    }
+    const auto& item = items_[index];
+    return item.hash == hash && item.length == length &&
+            std::memcmp(item.name, name, length) == 0
+        ? item.value
+        : kRawPropsValueIndexEmpty;
+  }
+
   // 1. Find the bucket.
   auto lower = int{buckets_[length - 1]};
   auto upper = int{buckets_[length]} - 1;
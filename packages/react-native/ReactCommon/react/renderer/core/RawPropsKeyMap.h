@@ -9,16 +9,18 @@
 
 #include <react/renderer/core/RawPropsKey.h>
 #include <react/renderer/core/RawPropsPrimitives.h>
+#include <cstdint>
 #include <vector>
 
 namespace facebook::react {
 
 /*
  * A map especially optimized to hold `{name: index}` relations.
- * The implementation is conceptually similar to a classic hash map with a hash
- * function that returns the length of the string.
  * The map is optimized for reads only (the map must be reindexed before a bunch
- * of reads).
+ * of reads). Reindexing builds a perfect hash of the stored names, so a lookup
+ * takes a single probe and a single comparison of names. If no perfect hash is
+ * found (which is very unlikely), lookups search the stored names of the same
+ * length instead.
  */
 class RawPropsKeyMap final {
  public:
@@ -41,10 +43,20 @@ class RawPropsKeyMap final {
       const char* name,
       RawPropsPropNameLength length) noexcept;
 
+  /*
+   * Same as above, with the `RAW_PROPS_KEY_HASH` of the name computed by the
+   * caller.
+   */
+  RawPropsValueIndex at(
+      const char* name,
+      RawPropsPropNameLength length,
+      RawPropsPropNameHash hash) noexcept;
+
  private:
   struct Item {
     RawPropsValueIndex value;
     RawPropsPropNameLength length;
+    RawPropsPropNameHash hash;
     char name[kPropNameLengthHardCap];
   };
 
@@ -52,9 +64,25 @@ class RawPropsKeyMap final {
       const Item& lhs,
       const Item& rhs) noexcept;
   static bool hasSameName(const Item& lhs, const Item& rhs) noexcept;
+  static uint32_t hashOfName(
+      const char* name,
+      RawPropsPropNameLength length) noexcept;
+  static size_t slotOfHash(
+      uint32_t hash,
+      uint16_t displacement,
+      size_t slotCount) noexcept;
+
+  bool buildPerfectHash(size_t slotCount) noexcept;
 
   std::vector<Item> items_{};
   std::vector<RawPropsPropNameLength> buckets_{};
+
+  // Perfect hash of the names of `items_`: the hash of a name selects a
+  // displacement, which moves the name to a slot no other name occupies. Slots
+  // hold indices of `items_`, or `kRawPropsValueIndexEmpty`. Both sizes are
+  // powers of two. Empty if no perfect hash was found.
+  std::vector<uint16_t> displacements_{};
+  std::vector<RawPropsValueIndex> slots_{};
 };
 
 } // namespace facebook::react
@@ -11,9 +11,43 @@
 #include <react/renderer/core/RawProps.h>
 
 #include <glog/logging.h>
+#include <algorithm>
 
 namespace facebook::react {
 
+static bool isUnchangedValue(
+    jsi::Runtime& runtime,
+    const jsi::Value& value,
+    const RawPropsPrimitiveValues& sourceValues,
+    RawPropsValueIndex keyIndex) {
+  auto iterator = std::lower_bound(
+      sourceValues.begin(),
+      sourceValues.end(),
+      keyIndex,
+      [](const RawPropsPrimitiveValue& sourceValue, RawPropsValueIndex index) {
+        return sourceValue.keyIndex < index;
+      });
+  if (iterator == sourceValues.end() || iterator->keyIndex != keyIndex) {
+    return false;
+  }
+
+  const auto& sourceValue = iterator->value;
+  switch (sourceValue.type()) {
+    case folly::dynamic::NULLT:
+      return value.isNull() || value.isUndefined();
+    case folly::dynamic::BOOL:
+      return value.isBool() && value.getBool() == sourceValue.getBool();
+    case folly::dynamic::DOUBLE:
+    case folly::dynamic::INT64:
+      return value.isNumber() && value.getNumber() == sourceValue.asDouble();
+    case folly::dynamic::STRING:
+      return value.isString() &&
+          value.getString(runtime).utf8(runtime) == sourceValue.getString();
+    default:
+      return false;
+  }
+}
+
 // During parser initialization, Props structs are used to parse
 // "fake"/empty objects, and `at` is called repeatedly which tells us
 // which props are accessed during parsing, and in which order.
@@ -125,17 +159,25 @@ void RawPropsParser::preparse(const RawProps& rawProps) const noexcept {
 
       for (size_t i = 0; i < count; i++) {
         auto nameValue = names.getValueAtIndex(runtime, i).getString(runtime);
-        auto value = object.getProperty(runtime, nameValue);
-
         auto name = nameValue.utf8(runtime);
 
         auto keyIndex = nameToIndex_.at(
-            name.data(), static_cast<RawPropsPropNameLength>(name.size()));
+            name.data(),
+            static_cast<RawPropsPropNameLength>(name.size()),
+            RAW_PROPS_KEY_HASH(name));
 
         if (keyIndex == kRawPropsValueIndexEmpty) {
           continue;
         }
 
+        auto value = object.getProperty(runtime, nameValue);
+
+        if (rawProps.sourceValues_ != nullptr &&
+            isUnchangedValue(
+                runtime, value, *rawProps.sourceValues_, keyIndex)) {
+          continue;
+        }
+
         rawProps.keyIndexToValueIndex_[keyIndex] = valueIndex;
         rawProps.values_.push_back(
             RawValue(jsi::dynamicFromValue(runtime, value)));
@@ -153,7 +195,9 @@ void RawPropsParser::preparse(const RawProps& rawProps) const noexcept {
         auto name = pair.first.getString();
 
         auto keyIndex = nameToIndex_.at(
-            name.data(), static_cast<RawPropsPropNameLength>(name.size()));
+            name.data(),
+            static_cast<RawPropsPropNameLength>(name.size()),
+            RAW_PROPS_KEY_HASH(name));
 
         if (keyIndex == kRawPropsValueIndexEmpty) {
           continue;
@@ -66,6 +66,7 @@ class RawValue {
   }
 
  private:
+  friend class LazyAccessibilityProps;
   friend class RawProps;
   friend class RawPropsParser;
   friend class UIManagerBinding;
@@ -14,7 +14,10 @@
 #include <react/renderer/core/ShadowNodeFragment.h>
 #include <react/renderer/debug/DebugStringConvertible.h>
 #include <react/renderer/debug/debugStringConvertibleUtils.h>
+#include <react/utils/CoreFeatures.h>
+#include <react/utils/PooledAllocator.h>
 
+#include <unordered_map>
 #include <utility>
 
 namespace facebook::react {
@@ -42,7 +45,7 @@ Props::Shared ShadowNode::propsForClonedShadowNode(
   if (!hasBeenMounted && sourceNodeHasRawProps && props) {
     auto& castedProps = const_cast<Props&>(*props);
     castedProps.rawProps = mergeDynamicProps(
-        sourceShadowNode.getProps()->rawProps, props->rawProps);
+        sourceShadowNode.getProps()->rawProps, std::move(castedProps.rawProps));
     return props;
   }
 #endif
@@ -53,6 +56,12 @@ bool ShadowNode::sameFamily(const ShadowNode& first, const ShadowNode& second) {
   return first.family_ == second.family_;
 }
 
+bool ShadowNode::sameChildren(
+    const ShadowNode& first,
+    const ShadowNode& second) {
+  return first.children_ == second.children_;
+}
+
 #pragma mark - Constructors
 
 ShadowNode::ShadowNode(
@@ -268,7 +277,9 @@ void ShadowNode::cloneChildrenIfShared() {
   }
 
   traits_.unset(ShadowNodeTraits::Trait::ChildrenAreShared);
-  children_ = std::make_shared<ShadowNode::ListOfShared>(*children_);
+  children_ = CoreFeatures::enablePooledShadowNodeAllocation
+      ? allocatePooledShared<ShadowNode::ListOfShared>(*children_)
+      : std::make_shared<ShadowNode::ListOfShared>(*children_);
 }
 
 void ShadowNode::setMounted(bool mounted) const {
@@ -317,26 +328,109 @@ ShadowNode::Unshared ShadowNode::cloneTree(
       newShadowNode &&
       "`callback` returned `nullptr` which is not allowed value.");
 
-  auto childNode = newShadowNode;
+  auto childNode = std::move(newShadowNode);
 
   for (auto it = ancestors.rbegin(); it != ancestors.rend(); ++it) {
     auto& parentNode = it->first.get();
     auto childIndex = it->second;
 
-    auto children = parentNode.getChildren();
+    // The list is copied once, straight into the new shared list, and the
+    // new child is moved into it to avoid needless reference count traffic.
+    auto children =
+        std::make_shared<ShadowNode::ListOfShared>(parentNode.getChildren());
     react_native_assert(
-        ShadowNode::sameFamily(*children.at(childIndex), *childNode));
-    children[childIndex] = childNode;
+        ShadowNode::sameFamily(*children->at(childIndex), *childNode));
+    (*children)[childIndex] = std::move(childNode);
 
     childNode = parentNode.clone({
         ShadowNodeFragment::propsPlaceholder(),
-        std::make_shared<ShadowNode::ListOfShared>(children),
+        children,
     });
   }
 
   return std::const_pointer_cast<ShadowNode>(childNode);
 }
 
+/*
+ * Maps the families of the ancestors of the nodes being cloned to the indices
+ * of their children which are (or contain) such nodes.
+ */
+using ChildIndicesOfAncestors =
+    std::unordered_map<const ShadowNodeFamily*, std::vector<size_t>>;
+
+static ShadowNode::Unshared cloneMultipleRecursive(
+    const ShadowNode& shadowNode,
+    const std::unordered_set<const ShadowNodeFamily*>& shadowNodeFamilies,
+    const ChildIndicesOfAncestors& childIndicesOfAncestors,
+    const std::function<ShadowNode::Unshared(
+        ShadowNode const& oldShadowNode,
+        const ShadowNodeFragment& fragment)>& callback) {
+  const auto* family = &shadowNode.getFamily();
+
+  auto newChildren = ShadowNode::SharedListOfShared{};
+  auto childIndices = childIndicesOfAncestors.find(family);
+  if (childIndices != childIndicesOfAncestors.end()) {
+    const auto& children = shadowNode.getChildren();
+    auto clonedChildren = std::make_shared<ShadowNode::ListOfShared>(children);
+    for (auto childIndex : childIndices->second) {
+      (*clonedChildren)[childIndex] = cloneMultipleRecursive(
+          *children[childIndex],
+          shadowNodeFamilies,
+          childIndicesOfAncestors,
+          callback);
+    }
+    newChildren = std::move(clonedChildren);
+  }
+
+  auto fragment = ShadowNodeFragment{
+      /* .props = */ ShadowNodeFragment::propsPlaceholder(),
+      /* .children = */ newChildren
+          ? newChildren
+          : ShadowNodeFragment::childrenPlaceholder(),
+  };
+
+  if (shadowNodeFamilies.find(family) == shadowNodeFamilies.end()) {
+    return shadowNode.clone(fragment);
+  }
+
+  auto newShadowNode = callback(shadowNode, fragment);
+  react_native_assert(
+      newShadowNode &&
+      "`callback` returned `nullptr` which is not allowed value.");
+  return newShadowNode;
+}
+
+ShadowNode::Unshared ShadowNode::cloneMultiple(
+    const std::unordered_set<const ShadowNodeFamily*>& shadowNodeFamilies,
+    const std::function<Unshared(
+        ShadowNode const& oldShadowNode,
+        const ShadowNodeFragment& fragment)>& callback) const {
+  auto childIndicesOfAncestors = ChildIndicesOfAncestors{};
+  // Families of nodes already on a path to clone, so that every shared
+  // ancestor records each of its affected children once.
+  auto familiesOnPaths = std::unordered_set<const ShadowNodeFamily*>{};
+
+  for (const auto* shadowNodeFamily : shadowNodeFamilies) {
+    auto ancestors = shadowNodeFamily->getAncestors(*this);
+
+    for (const auto& [parentNode, childIndex] : ancestors) {
+      const auto& parent = parentNode.get();
+      const auto* childFamily = &parent.getChildren()[childIndex]->getFamily();
+      if (!familiesOnPaths.insert(childFamily).second) {
+        continue;
+      }
+      childIndicesOfAncestors[&parent.getFamily()].push_back(childIndex);
+    }
+  }
+
+  if (childIndicesOfAncestors.empty()) {
+    return ShadowNode::Unshared{nullptr};
+  }
+
+  return cloneMultipleRecursive(
+      *this, shadowNodeFamilies, childIndicesOfAncestors, callback);
+}
+
 #pragma mark - DebugStringConvertible
 
 #if RN_DEBUG_STRING_CONVERTIBLE
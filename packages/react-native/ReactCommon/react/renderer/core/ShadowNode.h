@@ -10,6 +10,7 @@
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <unordered_set>
 #include <vector>
 
 #include <react/renderer/core/EventEmitter.h>
@@ -51,6 +52,14 @@ class ShadowNode : public Sealable,
    */
   static bool sameFamily(const ShadowNode& first, const ShadowNode& second);
 
+  /*
+   * Returns `true` if nodes share the same list of children, meaning that
+   * everything below them is identical. The list works as a subtree identity:
+   * clones that don't touch children keep sharing it, while any change deeper
+   * in the tree makes every ancestor along the path own a new list.
+   */
+  static bool sameChildren(const ShadowNode& first, const ShadowNode& second);
+
   /*
    * A set of traits associated with a particular class.
    * Reimplement in subclasses to declare class-specific traits.
@@ -103,6 +112,23 @@ class ShadowNode : public Sealable,
       const std::function<Unshared(ShadowNode const& oldShadowNode)>& callback)
       const;
 
+  /*
+   * Clones the node (and partially the tree starting from the node) by
+   * replacing the nodes of all `shadowNodeFamilies` with nodes that
+   * `callback` returns. Ancestors shared by several of these nodes are cloned
+   * only once. `callback` receives the fragment with the new children of the
+   * old node (or placeholders if none of its descendants changed) and must
+   * apply it to the node it returns. Families which are not descendants of
+   * this node are ignored.
+   *
+   * Returns `nullptr` if none of the families is a descendant of this node.
+   */
+  Unshared cloneMultiple(
+      const std::unordered_set<const ShadowNodeFamily*>& shadowNodeFamilies,
+      const std::function<Unshared(
+          ShadowNode const& oldShadowNode,
+          const ShadowNodeFragment& fragment)>& callback) const;
+
 #pragma mark - Getters
 
   ComponentName getComponentName() const;
@@ -127,6 +127,18 @@ void ShadowNodeFamily::setMostRecentState(const State::Shared& state) const {
   mostRecentState_ = state;
 }
 
+uint8_t ShadowNodeFamily::countFlatteningChange() const {
+  auto count = flatteningChangeCount_.load(std::memory_order_relaxed);
+  while (count != UINT8_MAX) {
+    auto newCount = static_cast<uint8_t>(count + 1);
+    if (flatteningChangeCount_.compare_exchange_weak(
+            count, newCount, std::memory_order_relaxed)) {
+      return newCount;
+    }
+  }
+  return count;
+}
+
 std::shared_ptr<const State> ShadowNodeFamily::getMostRecentStateIfObsolete(
     const State& state) const {
   std::unique_lock lock(mutex_);
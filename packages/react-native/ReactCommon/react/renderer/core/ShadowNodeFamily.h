@@ -7,12 +7,15 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <shared_mutex>
 
 #include <react/renderer/core/EventEmitter.h>
 #include <react/renderer/core/InstanceHandle.h>
 #include <react/renderer/core/ReactPrimitives.h>
+#include <react/utils/CoallocatingAllocator.h>
 
 namespace facebook::react {
 
@@ -93,6 +96,13 @@ class ShadowNodeFamily final {
   std::shared_ptr<const State> getMostRecentState() const;
   void setMostRecentState(const std::shared_ptr<State const>& state) const;
 
+  /*
+   * Counts the times nodes of the family switched between forming a view and
+   * being flattened (see `ViewShadowNode`), saturating at 255. Returns the
+   * updated count. Can be called from any thread.
+   */
+  uint8_t countFlatteningChange() const;
+
   /*
    * Dispatches a state update with given priority.
    */
@@ -106,6 +116,15 @@ class ShadowNodeFamily final {
    */
   mutable std::unique_ptr<folly::dynamic> nativeProps_DEPRECATED;
 
+  /*
+   * Block which the family, its event emitter and its event target were
+   * allocated from, with room for the initial state (see
+   * `CoreFeatures::enableCoallocatedShadowNodeFamilies`). `nullptr` if the
+   * family was allocated on its own. Set only before the family is shared;
+   * the block outlives the family, since the family is allocated from it.
+   */
+  CoallocationBlock* coallocationBlock{nullptr};
+
  private:
   friend ShadowNode;
   friend State;
@@ -121,6 +140,7 @@ class ShadowNodeFamily final {
   EventDispatcher::Weak eventDispatcher_;
   mutable std::shared_ptr<const State> mostRecentState_;
   mutable std::shared_mutex mutex_;
+  mutable std::atomic<uint8_t> flatteningChangeCount_{0};
 
   /*
    * Deprecated.
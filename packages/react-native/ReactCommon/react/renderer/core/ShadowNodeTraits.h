@@ -72,6 +72,10 @@ class ShadowNodeTraits {
 
     // Temporary (?) to indicate MapBuffer support on Android
     AndroidMapBufferPropsSupported = 1 << 9,
+
+    // Indicates that the node only mounts the views of the children of its
+    // children which intersect `LayoutableShadowNode::getContentWindow()`.
+    WindowsContent = 1 << 10,
   };
 
   /*
@@ -68,6 +68,7 @@ class State {
   virtual folly::dynamic getDynamic() const = 0;
   virtual MapBuffer getMapBuffer() const = 0;
   virtual void updateState(folly::dynamic&& data) const = 0;
+  virtual void updateState(MapBuffer&& data) const = 0;
 #endif
 
  protected:
@@ -8,11 +8,17 @@
 #pragma once
 
 #include <functional>
+#include <vector>
 
 #include <react/renderer/core/StateUpdate.h>
 
 namespace facebook::react {
 
-using StatePipe = std::function<void(const StateUpdate& stateUpdate)>;
+/*
+ * Receives all state updates flushed from an event queue at once, so updates
+ * of the same surface can be applied together.
+ */
+using StatePipe =
+    std::function<void(const std::vector<StateUpdate>& stateUpdates)>;
 
 } // namespace facebook::react
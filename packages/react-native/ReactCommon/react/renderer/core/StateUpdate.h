@@ -24,6 +24,13 @@ class StateUpdate {
 
   SharedShadowNodeFamily family;
   Callback callback;
+
+  /*
+   * Whether `callback` produces new data regardless of the old data. Such an
+   * update replaces a queued update of the same family; otherwise, the two
+   * are merged into one which applies both callbacks in order.
+   */
+  bool replacesQueuedUpdate{false};
 };
 
 } // namespace facebook::react
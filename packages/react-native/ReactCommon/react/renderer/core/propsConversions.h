@@ -114,7 +114,8 @@ T convertRawProp(
     U const& defaultValue,
     const char* namePrefix = nullptr,
     const char* nameSuffix = nullptr) {
-  const auto* rawValue = rawProps.at(name, namePrefix, nameSuffix);
+  const auto key = RawPropsKey{namePrefix, name, nameSuffix};
+  const auto* rawValue = rawProps.at(key);
   if (rawValue == nullptr) [[likely]] {
     return sourceValue;
   }
@@ -131,7 +132,6 @@ T convertRawProp(
     return result;
   } catch (const std::exception& e) {
     // In case of errors, log the error and fall back to the default
-    RawPropsKey key{namePrefix, name, nameSuffix};
     // TODO: report this using ErrorUtils so it's more visible to the user
     LOG(ERROR) << "Error while converting prop '"
                << static_cast<std::string>(key) << "': " << e.what();
@@ -7,7 +7,9 @@
 
 #include <gtest/gtest.h>
 
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
 #include <react/renderer/core/PropsParserContext.h>
+#include <react/utils/CoreFeatures.h>
 
 #include "TestComponent.h"
 
@@ -135,3 +137,102 @@ TEST(ComponentDescriptorTest, appendChild) {
   EXPECT_EQ(node1Children.at(0), node2);
   EXPECT_EQ(node1Children.at(1), node3);
 }
+
+TEST(ComponentDescriptorTest, internProps) {
+  auto eventDispatcher = std::shared_ptr<const EventDispatcher>();
+  auto descriptor = ViewComponentDescriptor(
+      ComponentDescriptorParameters{eventDispatcher, nullptr, nullptr});
+
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  PropsParserContext otherParserContext{1, contextContainer};
+  auto createProps = [&](const PropsParserContext& context,
+                         const char* nativeId) {
+    auto rawProps = RawProps(folly::dynamic::object("nativeID", nativeId));
+    return descriptor.cloneProps(context, nullptr, std::move(rawProps));
+  };
+
+  EXPECT_NE(
+      createProps(parserContext, "abc"), createProps(parserContext, "abc"));
+
+  CoreFeatures::enablePropsInterning = true;
+  auto props = createProps(parserContext, "abc");
+  EXPECT_EQ(props, createProps(parserContext, "abc"));
+  EXPECT_NE(props, createProps(parserContext, "def"));
+  EXPECT_NE(props, createProps(otherParserContext, "abc"));
+
+  // Clones are not interned, as they may be mutated (e.g. by animations).
+  EXPECT_NE(
+      descriptor.cloneProps(parserContext, props, RawProps()),
+      descriptor.cloneProps(parserContext, props, RawProps()));
+  CoreFeatures::enablePropsInterning = false;
+}
+
+TEST(ComponentDescriptorTest, lazilyPreparedRawPropsParser) {
+  CoreFeatures::enableLazyRawPropsParserPreparation = true;
+  auto eventDispatcher = std::shared_ptr<const EventDispatcher>();
+  SharedComponentDescriptor descriptor =
+      std::make_shared<TestComponentDescriptor>(
+          ComponentDescriptorParameters{eventDispatcher, nullptr, nullptr});
+  CoreFeatures::enableLazyRawPropsParserPreparation = false;
+
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+
+  // The parser is prepared by the first parsing.
+  for (auto nativeId : {"abc", "def"}) {
+    auto rawProps = RawProps(folly::dynamic::object("nativeID", nativeId));
+    auto props =
+        descriptor->cloneProps(parserContext, nullptr, std::move(rawProps));
+    EXPECT_EQ(props->nativeId, nativeId);
+  }
+}
+
+TEST(ComponentDescriptorTest, sharesRawPropsParserAcrossDescriptors) {
+  auto eventDispatcher = std::shared_ptr<const EventDispatcher>();
+  auto parameters =
+      ComponentDescriptorParameters{eventDispatcher, nullptr, nullptr};
+  auto descriptor = TestComponentDescriptor(parameters);
+  auto otherDescriptor = TestComponentDescriptor(parameters);
+
+  EXPECT_EQ(
+      &descriptor.getRawPropsParser(), &otherDescriptor.getRawPropsParser());
+
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  auto rawProps = RawProps(folly::dynamic::object("nativeID", "abc"));
+  auto props =
+      otherDescriptor.cloneProps(parserContext, nullptr, std::move(rawProps));
+  EXPECT_EQ(props->nativeId, "abc");
+}
+
+TEST(ComponentDescriptorTest, coallocatesFamilyWithEventEmitterAndState) {
+  CoreFeatures::enableCoallocatedShadowNodeFamilies = true;
+  auto eventDispatcher = std::shared_ptr<const EventDispatcher>();
+  auto descriptor = TestComponentDescriptor(
+      ComponentDescriptorParameters{eventDispatcher, nullptr, nullptr});
+
+  auto family = descriptor.createFamily(ShadowNodeFamilyFragment{
+      /* .tag = */ 9,
+      /* .surfaceId = */ 1,
+      /* .instanceHandle = */ nullptr,
+  });
+  CoreFeatures::enableCoallocatedShadowNodeFamilies = false;
+
+  auto block = family->coallocationBlock;
+  ASSERT_NE(block, nullptr);
+  auto eventEmitter = family->getEventEmitter();
+  EXPECT_TRUE(block->contains(family.get()));
+  EXPECT_TRUE(block->contains(eventEmitter.get()));
+  EXPECT_TRUE(block->contains(eventEmitter->getEventTarget().get()));
+
+  auto state = descriptor.createInitialState(
+      TestShadowNode::defaultSharedProps(), family);
+  EXPECT_TRUE(block->contains(state.get()));
+  EXPECT_TRUE(block->contains(state->getDataPointer().get()));
+
+  // Objects are still released independently.
+  family.reset();
+  state.reset();
+  EXPECT_NE(eventEmitter->getEventTarget(), nullptr);
+}
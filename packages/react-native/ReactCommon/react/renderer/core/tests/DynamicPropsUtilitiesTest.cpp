@@ -64,3 +64,51 @@ TEST(DynamicPropsUtilitiesTest, handleNull) {
 
   EXPECT_TRUE(result["height"].isNull());
 }
+
+TEST(DynamicPropsUtilitiesTest, handleMovedArguments) {
+  dynamic source = dynamic::object;
+  source["height"] = 100;
+  source["style"] = dynamic::object("color", "black");
+
+  dynamic patch = dynamic::object;
+  patch["style"] = dynamic::object("color", "red");
+
+  auto result = mergeDynamicProps(std::move(source), std::move(patch));
+
+  EXPECT_EQ(result["height"], 100);
+  EXPECT_EQ(result["style"]["color"], "red");
+
+  patch = dynamic::object("width", 50);
+  result = mergeDynamicProps(nullptr, std::move(patch));
+  EXPECT_EQ(result, dynamic::object("width", 50));
+
+  result = mergeDynamicProps(dynamic::object("width", 50), nullptr);
+  EXPECT_EQ(result, dynamic::object("width", 50));
+}
+
+TEST(DynamicPropsUtilitiesTest, diffKeepsChangedAndAddedValues) {
+  dynamic source = dynamic::object;
+  source["height"] = 100;
+  source["width"] = 100;
+  source["transform"] = dynamic::array(dynamic::object("scale", 2));
+  source["opacity"] = 0.5;
+
+  dynamic target = dynamic::object;
+  target["height"] = 100;
+  target["width"] = 200;
+  target["transform"] = dynamic::array(dynamic::object("scale", 2));
+  target["opacity"] = nullptr;
+  target["testID"] = "view";
+
+  auto result = diffDynamicProps(source, target);
+
+  EXPECT_EQ(result.size(), 3);
+  EXPECT_EQ(result["width"], 200);
+  EXPECT_TRUE(result["opacity"].isNull());
+  EXPECT_EQ(result["testID"], "view");
+  EXPECT_EQ(result.count("height"), 0);
+  EXPECT_EQ(result.count("transform"), 0);
+
+  EXPECT_EQ(diffDynamicProps(nullptr, target), target);
+  EXPECT_TRUE(diffDynamicProps(target, target).empty());
+}
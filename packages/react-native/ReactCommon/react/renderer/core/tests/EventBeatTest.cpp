@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/core/EventBeat.h>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+// Schedules beats like event beats sending them on the JavaScript thread, but
+// keeps them until `runScheduledBeats` is called.
+class TestAsynchronousEventBeat final : public EventBeat {
+ public:
+  TestAsynchronousEventBeat() : EventBeat(std::make_shared<OwnerBox>()) {}
+
+  void induce() const override {
+    if (!scheduleBeat()) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    scheduledBeats_.push_back(
+        [this](jsi::Runtime& runtime) { beatScheduled(runtime); });
+  }
+
+  size_t runScheduledBeats(jsi::Runtime& runtime) const {
+    auto scheduledBeats = std::vector<std::function<void(jsi::Runtime&)>>{};
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      std::swap(scheduledBeats, scheduledBeats_);
+    }
+    for (const auto& scheduledBeat : scheduledBeats) {
+      scheduledBeat(runtime);
+    }
+    return scheduledBeats.size();
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  mutable std::vector<std::function<void(jsi::Runtime&)>> scheduledBeats_;
+};
+
+class EventBeatTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    runtime_ = facebook::hermes::makeHermesRuntime();
+    eventBeat_.setBeatCallback([this](jsi::Runtime& /*runtime*/) {
+      beatCount_++;
+      if (onBeat_) {
+        onBeat_();
+      }
+    });
+  }
+
+  std::unique_ptr<jsi::Runtime> runtime_;
+  TestAsynchronousEventBeat eventBeat_;
+  std::atomic<int> beatCount_{0};
+  std::function<void()> onBeat_;
+};
+
+TEST_F(EventBeatTest, testBeatIsNotScheduledWithoutRequest) {
+  eventBeat_.induce();
+
+  EXPECT_EQ(eventBeat_.runScheduledBeats(*runtime_), 0);
+  EXPECT_EQ(beatCount_, 0);
+}
+
+TEST_F(EventBeatTest, testConcurrentRequestsScheduleSingleBeat) {
+  auto threads = std::vector<std::thread>{};
+  for (auto i = 0; i < 8; i++) {
+    threads.emplace_back([this]() {
+      for (auto j = 0; j < 1000; j++) {
+        eventBeat_.request();
+        eventBeat_.induce();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(eventBeat_.runScheduledBeats(*runtime_), 1);
+  EXPECT_EQ(beatCount_, 1);
+
+  // Requests made before the beat were served by it.
+  eventBeat_.induce();
+  EXPECT_EQ(eventBeat_.runScheduledBeats(*runtime_), 0);
+}
+
+TEST_F(EventBeatTest, testRequestDuringBeatSchedulesNextBeat) {
+  onBeat_ = [this]() {
+    onBeat_ = nullptr;
+    eventBeat_.request();
+    eventBeat_.induce();
+  };
+
+  eventBeat_.request();
+  eventBeat_.induce();
+
+  EXPECT_EQ(eventBeat_.runScheduledBeats(*runtime_), 1);
+  EXPECT_EQ(eventBeat_.runScheduledBeats(*runtime_), 1);
+  EXPECT_EQ(beatCount_, 2);
+}
+
+} // namespace facebook::react
@@ -33,7 +33,7 @@ class EventQueueProcessorTest : public testing::Test {
     };
 
     auto dummyEventPipeConclusion = [](jsi::Runtime& runtime) {};
-    auto dummyStatePipe = [](const StateUpdate& stateUpdate) {};
+    auto dummyStatePipe = [](const std::vector<StateUpdate>& stateUpdates) {};
 
     eventProcessor_ = std::make_unique<EventQueueProcessor>(
         eventPipe, dummyEventPipeConclusion, dummyStatePipe);
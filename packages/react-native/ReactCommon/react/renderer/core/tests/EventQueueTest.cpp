@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/BatchedEventQueue.h>
+#include <react/renderer/core/EventTarget.h>
+#include <react/renderer/core/ValueFactoryEventPayload.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/utils/CoreFeatures.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+class TestEventBeat final : public EventBeat {
+ public:
+  TestEventBeat() : EventBeat(std::make_shared<OwnerBox>()) {}
+
+  void flush(jsi::Runtime& runtime) const {
+    beat(runtime);
+  }
+};
+
+class EventQueueTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    runtime_ = facebook::hermes::makeHermesRuntime();
+
+    auto eventPipe = [this](
+                         jsi::Runtime& /*runtime*/,
+                         const EventTarget* eventTarget,
+                         const std::string& type,
+                         ReactEventPriority /*priority*/,
+                         const EventPayload& payload) {
+      dispatchedEvents_.push_back({eventTarget, type, &payload});
+    };
+
+    auto dummyEventPipeConclusion = [](jsi::Runtime& runtime) {};
+    auto statePipe = [this](const std::vector<StateUpdate>& stateUpdates) {
+      flushedStateUpdates_ = stateUpdates;
+    };
+
+    auto eventBeat = std::make_unique<TestEventBeat>();
+    eventBeat_ = eventBeat.get();
+    eventQueue_ = std::make_unique<BatchedEventQueue>(
+        EventQueueProcessor(eventPipe, dummyEventPipeConclusion, statePipe),
+        std::move(eventBeat),
+        [this](std::function<void(jsi::Runtime & runtime)>&& callback) {
+          scheduledFlushes_.push_back(std::move(callback));
+        });
+
+    auto eventDispatcher = EventDispatcher::Shared{};
+    componentDescriptorRegistry_ =
+        componentDescriptorProviderRegistry_.createComponentDescriptorRegistry(
+            ComponentDescriptorParameters{eventDispatcher, nullptr, nullptr});
+    componentDescriptorProviderRegistry_.add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+
+    auto builder = ComponentBuilder{componentDescriptorRegistry_};
+    for (auto tag : {1, 2}) {
+      auto shadowNode = builder.build(Element<ViewShadowNode>().tag(tag));
+      // Aliases the family of the node, which is kept alive by the node.
+      families_.emplace_back(shadowNode, &shadowNode->getFamily());
+    }
+  }
+
+  StateUpdate makeStateUpdate(
+      const SharedShadowNodeFamily& family,
+      int value,
+      bool replacesQueuedUpdate) {
+    return {
+        family,
+        [=](const StateData::Shared& oldData) -> StateData::Shared {
+          if (replacesQueuedUpdate) {
+            return std::make_shared<const int>(value);
+          }
+          if (value == 0) {
+            // Cancels this update.
+            return nullptr;
+          }
+          return std::make_shared<const int>(
+              *std::static_pointer_cast<const int>(oldData) * 10 + value);
+        },
+        replacesQueuedUpdate};
+  }
+
+  static int applyStateUpdate(const StateUpdate& stateUpdate, int value) {
+    auto newData = stateUpdate.callback(std::make_shared<const int>(value));
+    return newData ? *std::static_pointer_cast<const int>(newData) : -1;
+  }
+
+  RawEvent makeEvent(
+      std::string type,
+      const SharedEventTarget& eventTarget,
+      SharedEventPayload payload = nullptr,
+      RawEvent::Category category = RawEvent::Category::Continuous) {
+    if (!payload) {
+      payload = std::make_shared<ValueFactoryEventPayload>(dummyValueFactory_);
+    }
+    return {std::move(type), std::move(payload), eventTarget, category};
+  }
+
+  RawEvent makeEvent(
+      std::string type,
+      const SharedEventTarget& eventTarget,
+      RawEvent::Category category) {
+    return makeEvent(std::move(type), eventTarget, nullptr, category);
+  }
+
+  std::vector<std::string> runScheduledFlushes() {
+    dispatchedEvents_.clear();
+    auto scheduledFlushes = std::move(scheduledFlushes_);
+    scheduledFlushes_.clear();
+    for (const auto& scheduledFlush : scheduledFlushes) {
+      scheduledFlush(*runtime_);
+    }
+    return dispatchedEventTypes();
+  }
+
+  std::vector<std::string> flush() {
+    dispatchedEvents_.clear();
+    eventBeat_->flush(*runtime_);
+    return dispatchedEventTypes();
+  }
+
+  std::vector<std::string> dispatchedEventTypes() const {
+    auto types = std::vector<std::string>{};
+    for (const auto& event : dispatchedEvents_) {
+      types.push_back(
+          event.type + (event.eventTarget == firstTarget_.get() ? "1" : "2"));
+    }
+    return types;
+  }
+
+  struct DispatchedEvent {
+    const EventTarget* eventTarget;
+    std::string type;
+    const EventPayload* payload;
+  };
+
+  std::unique_ptr<facebook::hermes::HermesRuntime> runtime_;
+  const TestEventBeat* eventBeat_;
+  std::unique_ptr<EventQueue> eventQueue_;
+  std::vector<DispatchedEvent> dispatchedEvents_;
+  std::vector<StateUpdate> flushedStateUpdates_;
+  std::vector<std::function<void(jsi::Runtime& runtime)>> scheduledFlushes_;
+  ComponentDescriptorProviderRegistry componentDescriptorProviderRegistry_;
+  ComponentDescriptorRegistry::Shared componentDescriptorRegistry_;
+  std::vector<SharedShadowNodeFamily> families_;
+  ValueFactory dummyValueFactory_;
+  SharedEventTarget firstTarget_ = std::make_shared<EventTarget>(nullptr);
+  SharedEventTarget secondTarget_ = std::make_shared<EventTarget>(nullptr);
+};
+
+TEST_F(EventQueueTest, uniqueEventReplacesLastEventOfSameTypeAndTarget) {
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", firstTarget_));
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", secondTarget_));
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", firstTarget_));
+
+  auto payload =
+      std::make_shared<ValueFactoryEventPayload>(dummyValueFactory_);
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", firstTarget_, payload));
+
+  EXPECT_EQ(flush(), (std::vector<std::string>{"scroll1", "scroll2"}));
+  EXPECT_EQ(dispatchedEvents_[0].payload, payload.get());
+}
+
+TEST_F(EventQueueTest, uniqueEventKeepsOrderOfEventsOfSameTarget) {
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", firstTarget_));
+  eventQueue_->enqueueEvent(makeEvent("layout", firstTarget_));
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", firstTarget_));
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", firstTarget_));
+
+  EXPECT_EQ(
+      flush(), (std::vector<std::string>{"scroll1", "layout1", "scroll1"}));
+}
+
+TEST_F(EventQueueTest, uniqueEventIsNotCoalescedAcrossFlushes) {
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", firstTarget_));
+  EXPECT_EQ(flush(), (std::vector<std::string>{"scroll1"}));
+
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", secondTarget_));
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", firstTarget_));
+  EXPECT_EQ(flush(), (std::vector<std::string>{"scroll2", "scroll1"}));
+}
+
+TEST_F(EventQueueTest, uniqueEventUsesCoalescer) {
+  auto queuedPayloads = std::vector<const EventPayload*>{};
+  auto coalescer = [&](const SharedEventPayload& queuedPayload,
+                       SharedEventPayload payload) {
+    queuedPayloads.push_back(queuedPayload.get());
+    return queuedPayload;
+  };
+
+  auto firstPayload =
+      std::make_shared<ValueFactoryEventPayload>(dummyValueFactory_);
+  eventQueue_->enqueueUniqueEvent(
+      makeEvent("scroll", firstTarget_, firstPayload), coalescer);
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", firstTarget_), coalescer);
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", firstTarget_), coalescer);
+
+  EXPECT_EQ(flush(), (std::vector<std::string>{"scroll1"}));
+  EXPECT_EQ(queuedPayloads.size(), 2);
+  EXPECT_EQ(queuedPayloads[1], firstPayload.get());
+  EXPECT_EQ(dispatchedEvents_[0].payload, firstPayload.get());
+}
+
+TEST_F(EventQueueTest, stateUpdateReplacesQueuedUpdateOfSameFamily) {
+  eventQueue_->enqueueStateUpdate(makeStateUpdate(families_[0], 1, true));
+  eventQueue_->enqueueStateUpdate(makeStateUpdate(families_[1], 2, true));
+  eventQueue_->enqueueStateUpdate(makeStateUpdate(families_[0], 3, true));
+  flush();
+
+  EXPECT_EQ(flushedStateUpdates_.size(), 2);
+  EXPECT_EQ(flushedStateUpdates_[0].family, families_[0]);
+  EXPECT_EQ(applyStateUpdate(flushedStateUpdates_[0], 0), 3);
+  EXPECT_EQ(flushedStateUpdates_[1].family, families_[1]);
+  EXPECT_EQ(applyStateUpdate(flushedStateUpdates_[1], 0), 2);
+}
+
+TEST_F(EventQueueTest, stateUpdateMergesWithQueuedUpdateOfSameFamily) {
+  eventQueue_->enqueueStateUpdate(makeStateUpdate(families_[0], 1, false));
+  eventQueue_->enqueueStateUpdate(makeStateUpdate(families_[1], 5, false));
+  eventQueue_->enqueueStateUpdate(makeStateUpdate(families_[0], 2, false));
+  eventQueue_->enqueueStateUpdate(makeStateUpdate(families_[0], 0, false));
+  eventQueue_->enqueueStateUpdate(makeStateUpdate(families_[0], 3, false));
+  flush();
+
+  EXPECT_EQ(flushedStateUpdates_.size(), 2);
+  EXPECT_FALSE(flushedStateUpdates_[0].replacesQueuedUpdate);
+  EXPECT_EQ(applyStateUpdate(flushedStateUpdates_[0], 4), 4123);
+  EXPECT_EQ(applyStateUpdate(flushedStateUpdates_[1], 4), 45);
+}
+
+TEST_F(EventQueueTest, stateUpdateMergesWithQueuedReplacingUpdate) {
+  eventQueue_->enqueueStateUpdate(makeStateUpdate(families_[0], 1, true));
+  eventQueue_->enqueueStateUpdate(makeStateUpdate(families_[0], 2, false));
+  flush();
+
+  EXPECT_EQ(flushedStateUpdates_.size(), 1);
+  EXPECT_TRUE(flushedStateUpdates_[0].replacesQueuedUpdate);
+  EXPECT_EQ(applyStateUpdate(flushedStateUpdates_[0], 4), 12);
+
+  eventQueue_->enqueueStateUpdate(makeStateUpdate(families_[0], 0, false));
+  flush();
+
+  EXPECT_EQ(flushedStateUpdates_.size(), 1);
+  EXPECT_EQ(applyStateUpdate(flushedStateUpdates_[0], 4), -1);
+}
+
+TEST_F(EventQueueTest, discreteEventIsFlushedRightAway) {
+  CoreFeatures::enableImmediateDiscreteEvents = true;
+
+  eventQueue_->enqueueUniqueEvent(makeEvent("scroll", firstTarget_));
+  EXPECT_TRUE(scheduledFlushes_.empty());
+
+  // Only one flush is scheduled at a time, and it dispatches the continuous
+  // events enqueued before the discrete ones first.
+  eventQueue_->enqueueEvent(
+      makeEvent("press", secondTarget_, RawEvent::Category::Discrete));
+  eventQueue_->enqueueEvent(
+      makeEvent("press", firstTarget_, RawEvent::Category::Discrete));
+  EXPECT_EQ(scheduledFlushes_.size(), 1);
+  EXPECT_EQ(
+      runScheduledFlushes(),
+      (std::vector<std::string>{"scroll1", "press2", "press1"}));
+  EXPECT_TRUE(flush().empty());
+
+  eventQueue_->enqueueEvent(
+      makeEvent("press", firstTarget_, RawEvent::Category::Discrete));
+  EXPECT_EQ(scheduledFlushes_.size(), 1);
+
+  CoreFeatures::enableImmediateDiscreteEvents = false;
+}
+
+TEST_F(EventQueueTest, continuousEventsWaitForBeat) {
+  CoreFeatures::enableImmediateDiscreteEvents = true;
+
+  eventQueue_->enqueueEvent(makeEvent(
+      "touchStart", firstTarget_, RawEvent::Category::ContinuousStart));
+  EXPECT_EQ(runScheduledFlushes(), (std::vector<std::string>{"touchStart1"}));
+
+  // Events of an ongoing gesture are continuous, unless forced otherwise.
+  eventQueue_->enqueueEvent(makeEvent(
+      "touchMove", firstTarget_, RawEvent::Category::Unspecified));
+  eventQueue_->enqueueEvent(makeEvent(
+      "touchStart", secondTarget_, RawEvent::Category::ContinuousStart));
+  EXPECT_TRUE(scheduledFlushes_.empty());
+  EXPECT_EQ(
+      flush(), (std::vector<std::string>{"touchMove1", "touchStart2"}));
+
+  eventQueue_->enqueueEvent(makeEvent(
+      "touchEnd", firstTarget_, RawEvent::Category::ContinuousEnd));
+  EXPECT_EQ(runScheduledFlushes(), (std::vector<std::string>{"touchEnd1"}));
+
+  CoreFeatures::enableImmediateDiscreteEvents = false;
+}
+
+TEST_F(EventQueueTest, discreteEventWaitsForBeatWhenDisabled) {
+  eventQueue_->enqueueEvent(
+      makeEvent("press", firstTarget_, RawEvent::Category::Discrete));
+
+  EXPECT_TRUE(scheduledFlushes_.empty());
+  EXPECT_EQ(flush(), (std::vector<std::string>{"press1"}));
+}
+
+} // namespace facebook::react
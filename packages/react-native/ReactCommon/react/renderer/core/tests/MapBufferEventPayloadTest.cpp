@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/core/MapBufferEventPayload.h>
+#include <react/renderer/mapbuffer/MapBufferBuilder.h>
+
+#include <vector>
+
+namespace facebook::react {
+
+TEST(MapBufferEventPayloadTest, convertsPayloadToJSIObject) {
+  auto runtime = facebook::hermes::makeHermesRuntime();
+
+  auto point = MapBufferBuilder();
+  point.putString(0, "x");
+  point.putDouble(1, 1.5);
+  point.putString(2, "y");
+  point.putInt(3, 2);
+
+  auto touches = MapBufferBuilder();
+  touches.putInt(MapBufferEventPayload::kArrayLengthKey, 2);
+  touches.putMapBuffer(0, point.build());
+
+  auto builder = MapBufferBuilder();
+  builder.putString(0, "target");
+  builder.putInt(1, 42);
+  builder.putString(2, "name");
+  builder.putString(3, "press");
+  builder.putString(4, "isPrimary");
+  builder.putBool(5, true);
+  builder.putString(6, "changedTouches");
+  builder.putMapBuffer(7, touches.build());
+  builder.putString(8, "extra");
+
+  auto payload = MapBufferEventPayload(builder.build());
+  auto value = payload.asJSIValue(*runtime);
+  EXPECT_EQ(payload.getType(), EventPayloadType::MapBuffer);
+
+  auto object = value.asObject(*runtime);
+  EXPECT_EQ(object.getProperty(*runtime, "target").asNumber(), 42);
+  EXPECT_EQ(
+      object.getProperty(*runtime, "name").asString(*runtime).utf8(*runtime),
+      "press");
+  EXPECT_TRUE(object.getProperty(*runtime, "isPrimary").getBool());
+  EXPECT_TRUE(object.getProperty(*runtime, "extra").isNull());
+
+  auto array =
+      object.getPropertyAsObject(*runtime, "changedTouches").asArray(*runtime);
+  ASSERT_EQ(array.length(*runtime), 2);
+  EXPECT_TRUE(array.getValueAtIndex(*runtime, 1).isNull());
+  auto first = array.getValueAtIndex(*runtime, 0).asObject(*runtime);
+  EXPECT_EQ(first.getProperty(*runtime, "x").asNumber(), 1.5);
+  EXPECT_EQ(first.getProperty(*runtime, "y").asNumber(), 2);
+}
+
+} // namespace facebook::react
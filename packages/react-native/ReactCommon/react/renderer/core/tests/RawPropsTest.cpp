@@ -6,12 +6,15 @@
  */
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <hermes/hermes.h>
 #include <react/debug/flags.h>
 #include <react/renderer/core/ConcreteShadowNode.h>
 #include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/core/RawPropsKeyMap.h>
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/core/propsConversions.h>
 
@@ -468,6 +471,54 @@ TEST(RawPropsTest, copyJSIRawProps) {
       copyProps->derivedFloatValue, originalProps->derivedFloatValue, 0.00001);
 }
 
+TEST(RawPropsTest, skipUnchangedJSIRawProps) {
+  auto runtime = facebook::hermes::makeHermesRuntime();
+
+  auto parser = RawPropsParser();
+  parser.prepare<PropsPrimitiveTypes>();
+
+  auto object = jsi::Object(*runtime);
+  object.setProperty(*runtime, "intValue", 42);
+  object.setProperty(*runtime, "stringValue", "hello");
+  auto rawProps = RawProps(*runtime, jsi::Value(*runtime, object));
+  rawProps.parse(parser);
+
+  auto sourceValues = rawProps.getPrimitiveValues(nullptr);
+  ASSERT_NE(sourceValues, nullptr);
+  EXPECT_EQ(sourceValues->size(), 2);
+
+  auto clonedObject = jsi::Object(*runtime);
+  clonedObject.setProperty(*runtime, "intValue", 42);
+  clonedObject.setProperty(*runtime, "stringValue", "world");
+  clonedObject.setProperty(*runtime, "boolValue", true);
+  auto clonedRawProps = RawProps(*runtime, jsi::Value(*runtime, clonedObject));
+  clonedRawProps.parse(parser, sourceValues.get());
+
+  // Unchanged values are left out, so the source values are kept.
+  EXPECT_EQ(clonedRawProps.at("intValue", nullptr, nullptr), nullptr);
+  EXPECT_EQ(
+      (std::string)*clonedRawProps.at("stringValue", nullptr, nullptr),
+      "world");
+  EXPECT_TRUE((bool)*clonedRawProps.at("boolValue", nullptr, nullptr));
+
+  auto clonedValues = clonedRawProps.getPrimitiveValues(sourceValues);
+  ASSERT_NE(clonedValues, nullptr);
+  EXPECT_EQ(clonedValues->size(), 3);
+
+  // Values changed back are converted again.
+  auto revertedRawProps = RawProps(*runtime, jsi::Value(*runtime, object));
+  revertedRawProps.parse(parser, clonedValues.get());
+  EXPECT_EQ(
+      (std::string)*revertedRawProps.at("stringValue", nullptr, nullptr),
+      "hello");
+  EXPECT_NE(revertedRawProps.getPrimitiveValues(clonedValues), clonedValues);
+
+  // Clones without changed values share the values of their source.
+  auto sameRawProps = RawProps(*runtime, jsi::Value(*runtime, clonedObject));
+  sameRawProps.parse(parser, clonedValues.get());
+  EXPECT_EQ(sameRawProps.getPrimitiveValues(clonedValues), clonedValues);
+}
+
 TEST(RawPropsTest, filterYogaRawProps) {
   auto runtime = facebook::hermes::makeHermesRuntime();
 
@@ -503,3 +554,51 @@ TEST(RawPropsTest, filterYogaRawProps) {
   EXPECT_EQ(dynamicPropsFromCopy["floatValue"], 10.0);
   EXPECT_EQ(dynamicPropsFromCopy["flex"], nullptr);
 }
+
+TEST(RawPropsTest, keyHashIsHashOfCompoundName) {
+  static_assert(
+      RawPropsKey{"margin", "Start", "Width"}.hash ==
+      RAW_PROPS_KEY_HASH("marginStartWidth"));
+  static_assert(
+      RawPropsKey{nullptr, "opacity", nullptr}.hash ==
+      CONSTEXPR_RAW_PROPS_KEY_HASH("opacity"));
+
+  auto name = std::string{"borderWidth"};
+  auto key = RawPropsKey{nullptr, name.c_str(), nullptr};
+  EXPECT_EQ(key.hash, RAW_PROPS_KEY_HASH(name));
+  EXPECT_EQ(key, (RawPropsKey{nullptr, "borderWidth", nullptr}));
+  EXPECT_NE(key, (RawPropsKey{nullptr, "borderWidth", ""}));
+  EXPECT_NE(key, (RawPropsKey{"border", "Width", nullptr}));
+  EXPECT_NE(key, (RawPropsKey{nullptr, "borderHeight", nullptr}));
+}
+
+TEST(RawPropsTest, keyMapFindsAllInsertedNames) {
+  auto names = std::vector<std::string>{};
+  for (auto i = 0; i < 300; i++) {
+    names.push_back("prop" + std::to_string(i));
+  }
+
+  auto map = RawPropsKeyMap{};
+  for (size_t i = 0; i < names.size(); i++) {
+    map.insert(
+        RawPropsKey{nullptr, names[i].c_str(), nullptr},
+        static_cast<RawPropsValueIndex>(i));
+  }
+  // A compound name equal to a simple one is a duplicate.
+  map.insert(RawPropsKey{"pr", "op", "7"}, 42);
+  map.reindex();
+
+  for (size_t i = 0; i < names.size(); i++) {
+    EXPECT_EQ(
+        map.at(
+            names[i].data(),
+            static_cast<RawPropsPropNameLength>(names[i].size())),
+        i);
+  }
+
+  for (auto name : std::vector<std::string>{"prop", "prop300", "porp1"}) {
+    EXPECT_EQ(
+        map.at(name.data(), static_cast<RawPropsPropNameLength>(name.size())),
+        kRawPropsValueIndexEmpty);
+  }
+}
@@ -6,6 +6,7 @@
  */
 
 #include <memory>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <react/renderer/core/ConcreteShadowNode.h>
@@ -194,6 +195,23 @@ TEST_F(ShadowNodeTest, handleShadowNodeMutation) {
   EXPECT_TRUE(nodeABB_->getSealed());
 }
 
+TEST_F(ShadowNodeTest, handleSameChildren) {
+  auto nodeABRevision2 =
+      std::make_shared<TestShadowNode>(*nodeAB_, ShadowNodeFragment{});
+
+  // A clone that does not touch children shares the subtree.
+  EXPECT_TRUE(ShadowNode::sameChildren(*nodeAB_, *nodeABRevision2));
+
+  auto nodeABArevision2 =
+      std::make_shared<TestShadowNode>(*nodeABA_, ShadowNodeFragment{});
+  nodeABRevision2->replaceChild(*nodeABA_, nodeABArevision2);
+
+  // Mutating children of the clone must not affect the source node.
+  EXPECT_FALSE(ShadowNode::sameChildren(*nodeAB_, *nodeABRevision2));
+  EXPECT_EQ(nodeAB_->getChildren().at(0), nodeABA_);
+  EXPECT_EQ(nodeABRevision2->getChildren().at(0), nodeABArevision2);
+}
+
 TEST_F(ShadowNodeTest, handleCloneFunction) {
   auto nodeABClone = nodeAB_->clone({});
 
@@ -266,3 +284,43 @@ TEST_F(ShadowNodeTest, handleState) {
       { secondNode->setStateData(TestState()); },
       "Attempt to mutate a sealed object.");
 }
+
+TEST_F(ShadowNodeTest, handleCloneMultiple) {
+  auto clonedFamilies = std::vector<const ShadowNodeFamily*>{};
+  auto newNodeA = nodeA_->cloneMultiple(
+      {&nodeAA_->getFamily(), &nodeABA_->getFamily(), &nodeABB_->getFamily()},
+      [&](const ShadowNode& oldShadowNode, const ShadowNodeFragment& fragment) {
+        clonedFamilies.push_back(&oldShadowNode.getFamily());
+        return oldShadowNode.clone(fragment);
+      });
+
+  ASSERT_NE(newNodeA, nullptr);
+  EXPECT_EQ(clonedFamilies.size(), 3);
+
+  const auto& children = newNodeA->getChildren();
+  EXPECT_TRUE(ShadowNode::sameFamily(*children.at(0), *nodeAA_));
+  EXPECT_NE(children.at(0), nodeAA_);
+  // Untouched subtrees are shared.
+  EXPECT_EQ(children.at(2), nodeAC_);
+
+  // The shared ancestor `AB` is cloned once with both of its new children.
+  const auto& newNodeAB = children.at(1);
+  EXPECT_NE(newNodeAB, nodeAB_);
+  EXPECT_NE(newNodeAB->getChildren().at(0), nodeABA_);
+  EXPECT_NE(newNodeAB->getChildren().at(1), nodeABB_);
+  EXPECT_TRUE(
+      ShadowNode::sameFamily(*newNodeAB->getChildren().at(1), *nodeABB_));
+
+  // The source tree is not affected.
+  EXPECT_EQ(nodeAB_->getChildren().at(0), nodeABA_);
+
+  // Families which are not in the tree are ignored.
+  EXPECT_EQ(
+      nodeA_->cloneMultiple(
+          {&nodeZ_->getFamily()},
+          [](const ShadowNode& oldShadowNode,
+             const ShadowNodeFragment& fragment) {
+            return oldShadowNode.clone(fragment);
+          }),
+      nullptr);
+}
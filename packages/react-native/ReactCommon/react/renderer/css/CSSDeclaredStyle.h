@@ -8,12 +8,14 @@
 #pragma once
 
 #include <algorithm>
-#include <bitset>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <type_traits>
-#include <vector>
 
-#include <react/debug/react_native_assert.h>
 #include <react/renderer/css/CSSParser.h>
 #include <react/renderer/css/CSSProperties.h>
 
@@ -23,29 +25,74 @@ namespace facebook::react {
  * CSSDeclaredStyle represents the set of style declarations on an element set
  * by the user. Users should generally not read from CSSDeclaredStyle directly,
  * and should instead use the computed style calculated on ShadowTree commit.
+ *
+ * Declared values are packed in the order of their props, and a bitset of the
+ * specified props locates them: the value of a prop is at the index of the
+ * number of specified props before it. Getting and overwriting a value is
+ * constant-time, and the first values are stored inline, so most styles don't
+ * allocate.
  */
 class CSSDeclaredStyle {
  public:
+  CSSDeclaredStyle() = default;
+
+  CSSDeclaredStyle(const CSSDeclaredStyle& other)
+      : specifiedProperties_(other.specifiedProperties_),
+        count_(other.count_),
+        capacity_(std::max(other.count_, kInlineCapacity)),
+        inlineValues_(other.inlineValues_) {
+    if (other.heapValues_) {
+      heapValues_ = std::make_unique<Value[]>(capacity_);
+      std::copy_n(other.heapValues_.get(), count_, heapValues_.get());
+    }
+  }
+
+  CSSDeclaredStyle(CSSDeclaredStyle&& other) noexcept
+      : specifiedProperties_(other.specifiedProperties_),
+        count_(other.count_),
+        capacity_(other.capacity_),
+        inlineValues_(other.inlineValues_),
+        heapValues_(std::move(other.heapValues_)) {
+    other.specifiedProperties_ = {};
+    other.count_ = 0;
+    other.capacity_ = kInlineCapacity;
+  }
+
+  CSSDeclaredStyle& operator=(const CSSDeclaredStyle& other) {
+    if (this != &other) {
+      *this = CSSDeclaredStyle{other};
+    }
+    return *this;
+  }
+
+  CSSDeclaredStyle& operator=(CSSDeclaredStyle&& other) noexcept {
+    if (this != &other) {
+      specifiedProperties_ = other.specifiedProperties_;
+      count_ = other.count_;
+      capacity_ = other.capacity_;
+      inlineValues_ = other.inlineValues_;
+      heapValues_ = std::move(other.heapValues_);
+      other.specifiedProperties_ = {};
+      other.count_ = 0;
+      other.capacity_ = kInlineCapacity;
+    }
+    return *this;
+  }
+
   template <CSSProp Prop>
   void set(const CSSDeclaredValue<Prop>& value) {
     using DeclaredValueT = std::remove_cvref_t<CSSDeclaredValue<Prop>>;
-    static_assert(sizeof(value) <= sizeof(PropMapping::value));
+    static_assert(sizeof(value) <= sizeof(Value));
     static_assert(std::is_trivially_destructible_v<DeclaredValueT>);
 
-    if (specifiedProperties_.test(to_underlying(Prop))) {
-      auto it = std::lower_bound(
-          properties_.begin(), properties_.end(), PropMapping{Prop, {}});
-      react_native_assert(it->prop == Prop);
-      std::construct_at(
-          reinterpret_cast<DeclaredValueT*>(it->value.data()), value);
-    } else {
-      auto it = std::upper_bound(
-          properties_.begin(), properties_.end(), PropMapping{Prop, {}});
-      it = properties_.insert(it, {Prop, {}});
-      std::construct_at(
-          reinterpret_cast<DeclaredValueT*>(it->value.data()), value);
-      specifiedProperties_.set(to_underlying(Prop));
+    auto index = indexOf(Prop);
+    if (!isSpecified(Prop)) {
+      insertAt(index);
+      specifiedProperties_[to_underlying(Prop) / kWordBits] |=
+          bitOf(to_underlying(Prop));
     }
+    std::construct_at(
+        reinterpret_cast<DeclaredValueT*>(values()[index].data()), value);
   }
 
   template <CSSProp Prop>
@@ -60,13 +107,10 @@ class CSSDeclaredStyle {
    */
   template <CSSProp Prop, CSSProp... ShorthandsT>
   CSSDeclaredValue<Prop> get() const {
-    if (specifiedProperties_.test(to_underlying(Prop))) {
-      auto it = std::lower_bound(
-          properties_.begin(), properties_.end(), PropMapping{Prop, {}});
-      react_native_assert(it->prop == Prop);
-
-      CSSDeclaredValue<Prop> value{*std::launder(
-          reinterpret_cast<const CSSDeclaredValue<Prop>*>(it->value.data()))};
+    if (isSpecified(Prop)) {
+      CSSDeclaredValue<Prop> value{
+          *std::launder(reinterpret_cast<const CSSDeclaredValue<Prop>*>(
+              values()[indexOf(Prop)].data()))};
 
       if (value) {
         return value;
@@ -80,29 +124,79 @@ class CSSDeclaredStyle {
     }
   }
 
-  bool operator==(const CSSDeclaredStyle& rhs) const = default;
+  bool operator==(const CSSDeclaredStyle& rhs) const {
+    return specifiedProperties_ == rhs.specifiedProperties_ &&
+        std::equal(values(), values() + count_, rhs.values());
+  }
 
  private:
-  struct PropMapping {
-    CSSProp prop;
-    std::array<
-        std::byte,
-        sizeof(CSSValueVariant<
-               CSSWideKeyword,
-               CSSKeyword,
-               CSSLength,
-               CSSNumber,
-               CSSPercentage,
-               CSSRatio>)>
-        value;
-
-    constexpr bool operator<(const PropMapping& rhs) const {
-      return to_underlying(prop) < to_underlying(rhs.prop);
+  using Value = std::array<
+      std::byte,
+      sizeof(CSSValueVariant<
+             CSSWideKeyword,
+             CSSKeyword,
+             CSSLength,
+             CSSNumber,
+             CSSPercentage,
+             CSSRatio>)>;
+
+  static constexpr size_t kWordBits = 64;
+  static constexpr size_t kWordCount =
+      (kCSSPropCount + kWordBits - 1) / kWordBits;
+
+  // Enough for the declarations of most styles.
+  static constexpr uint8_t kInlineCapacity = 16;
+
+  static_assert(kCSSPropCount <= std::numeric_limits<uint8_t>::max());
+
+  static constexpr uint64_t bitOf(size_t prop) {
+    return uint64_t{1} << (prop % kWordBits);
+  }
+
+  constexpr bool isSpecified(CSSProp prop) const {
+    auto bit = to_underlying(prop);
+    return (specifiedProperties_[bit / kWordBits] & bitOf(bit)) != 0;
+  }
+
+  // The index of the value of `prop` in the packed values (or the index to
+  // insert it at, if it isn't specified).
+  constexpr size_t indexOf(CSSProp prop) const {
+    auto bit = to_underlying(prop);
+    auto word = bit / kWordBits;
+    size_t index = std::popcount(specifiedProperties_[word] & (bitOf(bit) - 1));
+    for (size_t i = 0; i < word; i++) {
+      index += std::popcount(specifiedProperties_[i]);
     }
-  };
+    return index;
+  }
+
+  Value* values() {
+    return heapValues_ ? heapValues_.get() : inlineValues_.data();
+  }
+
+  const Value* values() const {
+    return heapValues_ ? heapValues_.get() : inlineValues_.data();
+  }
+
+  void insertAt(size_t index) {
+    if (count_ == capacity_) {
+      auto capacity = static_cast<uint8_t>(
+          std::min<size_t>(capacity_ * 2, kCSSPropCount));
+      auto heapValues = std::make_unique<Value[]>(capacity);
+      std::copy_n(values(), count_, heapValues.get());
+      heapValues_ = std::move(heapValues);
+      capacity_ = capacity;
+    }
+    auto values = this->values();
+    std::copy_backward(values + index, values + count_, values + count_ + 1);
+    count_++;
+  }
 
-  std::vector<PropMapping> properties_;
-  std::bitset<kCSSPropCount> specifiedProperties_;
+  std::array<uint64_t, kWordCount> specifiedProperties_{};
+  uint8_t count_{0};
+  uint8_t capacity_{kInlineCapacity};
+  std::array<Value, kInlineCapacity> inlineValues_{};
+  std::unique_ptr<Value[]> heapValues_;
 };
 
 } // namespace facebook::react
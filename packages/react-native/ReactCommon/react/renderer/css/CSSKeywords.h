@@ -162,6 +162,50 @@ CSS_DEFINE_KEYWORD_CONEPTS(Visible)
 CSS_DEFINE_KEYWORD_CONEPTS(Wrap)
 CSS_DEFINE_KEYWORD_CONEPTS(WrapReverse)
 
+namespace detail {
+
+struct CSSLowerCaseTransform {
+  constexpr char operator()(char c) const {
+    if (c >= 'A' && c <= 'Z') {
+      return c + static_cast<char>('a' - 'A');
+    }
+    return c;
+  }
+};
+
+/**
+ * Whether an ident equals a lower-case keyword, case-insensitive.
+ */
+constexpr bool identEqualsKeyword(
+    std::string_view ident,
+    std::string_view keyword) {
+  if (ident.size() != keyword.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < ident.size(); i++) {
+    if (CSSLowerCaseTransform{}(ident[i]) != keyword[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace detail
+
+/**
+ * Matches the ident of `parseCSSKeyword` against one keyword. The hash of the
+ * keyword is computed at compile time and only selects the candidate, which
+ * is then compared, so unrelated idents with the same hash are not matched.
+ */
+#define CSS_HANDLE_KEYWORD(name, str)               \
+  case fnv1a(str):                                  \
+    if constexpr (detail::has##name<KeywordT>) {    \
+      if (detail::identEqualsKeyword(ident, str)) { \
+        return KeywordT::name;                      \
+      }                                             \
+    }                                               \
+    break;
+
 /**
  * Parses an ident token, case-insensitive, into a keyword.
  *
@@ -170,284 +214,63 @@ CSS_DEFINE_KEYWORD_CONEPTS(WrapReverse)
  */
 template <CSSKeywordSet KeywordT>
 constexpr std::optional<KeywordT> parseCSSKeyword(std::string_view ident) {
-  struct LowerCaseTransform {
-    constexpr char operator()(char c) const {
-      if (c >= 'A' && c <= 'Z') {
-        return c + static_cast<char>('a' - 'A');
-      }
-      return c;
-    }
-  };
-
-  switch (fnv1a<LowerCaseTransform>(ident)) {
-    case fnv1a("absolute"):
-      if constexpr (detail::hasAbsolute<KeywordT>) {
-        return KeywordT::Absolute;
-      }
-      break;
-    case fnv1a("auto"):
-      if constexpr (detail::hasAuto<KeywordT>) {
-        return KeywordT::Auto;
-      }
-      break;
-    case fnv1a("baseline"):
-      if constexpr (detail::hasBaseline<KeywordT>) {
-        return KeywordT::Baseline;
-      }
-      break;
-    case fnv1a("block"):
-      if constexpr (detail::hasBlock<KeywordT>) {
-        return KeywordT::Block;
-      }
-      break;
-    case fnv1a("center"):
-      if constexpr (detail::hasCenter<KeywordT>) {
-        return KeywordT::Center;
-      }
-      break;
-    case fnv1a("clip"):
-      if constexpr (detail::hasClip<KeywordT>) {
-        return KeywordT::Clip;
-      }
-      break;
-    case fnv1a("column"):
-      if constexpr (detail::hasColumn<KeywordT>) {
-        return KeywordT::Column;
-      }
-      break;
-    case fnv1a("column-reverse"):
-      if constexpr (detail::hasColumnReverse<KeywordT>) {
-        return KeywordT::ColumnReverse;
-      }
-      break;
-    case fnv1a("content"):
-      if constexpr (detail::hasContent<KeywordT>) {
-        return KeywordT::Content;
-      }
-      break;
-    case fnv1a("contents"):
-      if constexpr (detail::hasContents<KeywordT>) {
-        return KeywordT::Contents;
-      }
-      break;
-    case fnv1a("dashed"):
-      if constexpr (detail::hasDashed<KeywordT>) {
-        return KeywordT::Dashed;
-      }
-      break;
-    case fnv1a("dotted"):
-      if constexpr (detail::hasDotted<KeywordT>) {
-        return KeywordT::Dotted;
-      }
-      break;
-    case fnv1a("double"):
-      if constexpr (detail::hasDouble<KeywordT>) {
-        return KeywordT::Double;
-      }
-      break;
-    case fnv1a("end"):
-      if constexpr (detail::hasEnd<KeywordT>) {
-        return KeywordT::End;
-      }
-      break;
-    case fnv1a("fixed"):
-      if constexpr (detail::hasFixed<KeywordT>) {
-        return KeywordT::Fixed;
-      }
-    case fnv1a("flex"):
-      if constexpr (detail::hasFlex<KeywordT>) {
-        return KeywordT::Flex;
-      }
-      break;
-    case fnv1a("flex-end"):
-      if constexpr (detail::hasFlexEnd<KeywordT>) {
-        return KeywordT::FlexEnd;
-      }
-      break;
-    case fnv1a("flex-start"):
-      if constexpr (detail::hasFlexStart<KeywordT>) {
-        return KeywordT::FlexStart;
-      }
-      break;
-    case fnv1a("grid"):
-      if constexpr (detail::hasGrid<KeywordT>) {
-        return KeywordT::Grid;
-      }
-      break;
-    case fnv1a("groove"):
-      if constexpr (detail::hasGroove<KeywordT>) {
-        return KeywordT::Groove;
-      }
-      break;
-    case fnv1a("hidden"):
-      if constexpr (detail::hasHidden<KeywordT>) {
-        return KeywordT::Hidden;
-      }
-      break;
-    case fnv1a("inherit"):
-      if constexpr (detail::hasInherit<KeywordT>) {
-        return KeywordT::Inherit;
-      }
-      break;
-    case fnv1a("inline"):
-      if constexpr (detail::hasInline<KeywordT>) {
-        return KeywordT::Inline;
-      }
-      break;
-    case fnv1a("inline-block"):
-      if constexpr (detail::hasInlineBlock<KeywordT>) {
-        return KeywordT::InlineBlock;
-      }
-      break;
-    case fnv1a("inline-flex"):
-      if constexpr (detail::hasInlineFlex<KeywordT>) {
-        return KeywordT::InlineFlex;
-      }
-      break;
-    case fnv1a("inline-grid"):
-      if constexpr (detail::hasInlineGrid<KeywordT>) {
-        return KeywordT::InlineGrid;
-      }
-      break;
-    case fnv1a("ltr"):
-      if constexpr (detail::hasLtr<KeywordT>) {
-        return KeywordT::Ltr;
-      }
-      break;
-    case fnv1a("max-content"):
-      if constexpr (detail::hasMaxContent<KeywordT>) {
-        return KeywordT::MaxContent;
-      }
-      break;
-    case fnv1a("medium"):
-      if constexpr (detail::hasMedium<KeywordT>) {
-        return KeywordT::Medium;
-      }
-      break;
-    case fnv1a("min-content"):
-      if constexpr (detail::hasMinContent<KeywordT>) {
-        return KeywordT::MinContent;
-      }
-      break;
-    case fnv1a("none"):
-      if constexpr (detail::hasNone<KeywordT>) {
-        return KeywordT::None;
-      }
-      break;
-    case fnv1a("normal"):
-      if constexpr (detail::hasNormal<KeywordT>) {
-        return KeywordT::Normal;
-      }
-      break;
-    case fnv1a("nowrap"):
-      if constexpr (detail::hasNoWrap<KeywordT>) {
-        return KeywordT::NoWrap;
-      }
-      break;
-    case fnv1a("outset"):
-      if constexpr (detail::hasOutset<KeywordT>) {
-        return KeywordT::Outset;
-      }
-      break;
-    case fnv1a("relative"):
-      if constexpr (detail::hasRelative<KeywordT>) {
-        return KeywordT::Relative;
-      }
-      break;
-    case fnv1a("ridge"):
-      if constexpr (detail::hasRidge<KeywordT>) {
-        return KeywordT::Ridge;
-      }
-      break;
-    case fnv1a("row"):
-      if constexpr (detail::hasRow<KeywordT>) {
-        return KeywordT::Row;
-      }
-      break;
-    case fnv1a("row-reverse"):
-      if constexpr (detail::hasRowReverse<KeywordT>) {
-        return KeywordT::RowReverse;
-      }
-      break;
-    case fnv1a("rtl"):
-      if constexpr (detail::hasRtl<KeywordT>) {
-        return KeywordT::Rtl;
-      }
-      break;
-    case fnv1a("space-between"):
-      if constexpr (detail::hasSpaceBetween<KeywordT>) {
-        return KeywordT::SpaceBetween;
-      }
-      break;
-    case fnv1a("space-around"):
-      if constexpr (detail::hasSpaceAround<KeywordT>) {
-        return KeywordT::SpaceAround;
-      }
-      break;
-    case fnv1a("space-evenly"):
-      if constexpr (detail::hasSpaceEvenly<KeywordT>) {
-        return KeywordT::SpaceEvenly;
-      }
-      break;
-    case fnv1a("scroll"):
-      if constexpr (detail::hasScroll<KeywordT>) {
-        return KeywordT::Scroll;
-      }
-      break;
-    case fnv1a("solid"):
-      if constexpr (detail::hasSolid<KeywordT>) {
-        return KeywordT::Solid;
-      }
-      break;
-    case fnv1a("start"):
-      if constexpr (detail::hasStart<KeywordT>) {
-        return KeywordT::Start;
-      }
-    case fnv1a("static"):
-      if constexpr (detail::hasStatic<KeywordT>) {
-        return KeywordT::Static;
-      }
-      break;
-    case fnv1a("sticky"):
-      if constexpr (detail::hasSticky<KeywordT>) {
-        return KeywordT::Sticky;
-      }
-      break;
-    case fnv1a("stretch"):
-      if constexpr (detail::hasStretch<KeywordT>) {
-        return KeywordT::Stretch;
-      }
-      break;
-    case fnv1a("thick"):
-      if constexpr (detail::hasThick<KeywordT>) {
-        return KeywordT::Thick;
-      }
-      break;
-    case fnv1a("thin"):
-      if constexpr (detail::hasThin<KeywordT>) {
-        return KeywordT::Thin;
-      }
-      break;
-    case fnv1a("unset"):
-      if constexpr (detail::hasUnset<KeywordT>) {
-        return KeywordT::Unset;
-      }
-      break;
-    case fnv1a("visible"):
-      if constexpr (detail::hasVisible<KeywordT>) {
-        return KeywordT::Visible;
-      }
-      break;
-    case fnv1a("wrap"):
-      if constexpr (detail::hasWrap<KeywordT>) {
-        return KeywordT::Wrap;
-      }
-      break;
-    case fnv1a("wrap-reverse"):
-      if constexpr (detail::hasWrapReverse<KeywordT>) {
-        return KeywordT::WrapReverse;
-      }
-      break;
+  switch (fnv1a<detail::CSSLowerCaseTransform>(ident)) {
+    CSS_HANDLE_KEYWORD(Absolute, "absolute")
+    CSS_HANDLE_KEYWORD(Auto, "auto")
+    CSS_HANDLE_KEYWORD(Baseline, "baseline")
+    CSS_HANDLE_KEYWORD(Block, "block")
+    CSS_HANDLE_KEYWORD(Center, "center")
+    CSS_HANDLE_KEYWORD(Clip, "clip")
+    CSS_HANDLE_KEYWORD(Column, "column")
+    CSS_HANDLE_KEYWORD(ColumnReverse, "column-reverse")
+    CSS_HANDLE_KEYWORD(Content, "content")
+    CSS_HANDLE_KEYWORD(Contents, "contents")
+    CSS_HANDLE_KEYWORD(Dashed, "dashed")
+    CSS_HANDLE_KEYWORD(Dotted, "dotted")
+    CSS_HANDLE_KEYWORD(Double, "double")
+    CSS_HANDLE_KEYWORD(End, "end")
+    CSS_HANDLE_KEYWORD(Fixed, "fixed")
+    CSS_HANDLE_KEYWORD(Flex, "flex")
+    CSS_HANDLE_KEYWORD(FlexEnd, "flex-end")
+    CSS_HANDLE_KEYWORD(FlexStart, "flex-start")
+    CSS_HANDLE_KEYWORD(Grid, "grid")
+    CSS_HANDLE_KEYWORD(Groove, "groove")
+    CSS_HANDLE_KEYWORD(Hidden, "hidden")
+    CSS_HANDLE_KEYWORD(Inherit, "inherit")
+    CSS_HANDLE_KEYWORD(Initial, "initial")
+    CSS_HANDLE_KEYWORD(Inline, "inline")
+    CSS_HANDLE_KEYWORD(InlineBlock, "inline-block")
+    CSS_HANDLE_KEYWORD(InlineFlex, "inline-flex")
+    CSS_HANDLE_KEYWORD(InlineGrid, "inline-grid")
+    CSS_HANDLE_KEYWORD(Inset, "inset")
+    CSS_HANDLE_KEYWORD(Ltr, "ltr")
+    CSS_HANDLE_KEYWORD(MaxContent, "max-content")
+    CSS_HANDLE_KEYWORD(Medium, "medium")
+    CSS_HANDLE_KEYWORD(MinContent, "min-content")
+    CSS_HANDLE_KEYWORD(None, "none")
+    CSS_HANDLE_KEYWORD(Normal, "normal")
+    CSS_HANDLE_KEYWORD(NoWrap, "nowrap")
+    CSS_HANDLE_KEYWORD(Outset, "outset")
+    CSS_HANDLE_KEYWORD(Relative, "relative")
+    CSS_HANDLE_KEYWORD(Ridge, "ridge")
+    CSS_HANDLE_KEYWORD(Row, "row")
+    CSS_HANDLE_KEYWORD(RowReverse, "row-reverse")
+    CSS_HANDLE_KEYWORD(Rtl, "rtl")
+    CSS_HANDLE_KEYWORD(Scroll, "scroll")
+    CSS_HANDLE_KEYWORD(Solid, "solid")
+    CSS_HANDLE_KEYWORD(SpaceAround, "space-around")
+    CSS_HANDLE_KEYWORD(SpaceBetween, "space-between")
+    CSS_HANDLE_KEYWORD(SpaceEvenly, "space-evenly")
+    CSS_HANDLE_KEYWORD(Start, "start")
+    CSS_HANDLE_KEYWORD(Static, "static")
+    CSS_HANDLE_KEYWORD(Sticky, "sticky")
+    CSS_HANDLE_KEYWORD(Stretch, "stretch")
+    CSS_HANDLE_KEYWORD(Thick, "thick")
+    CSS_HANDLE_KEYWORD(Thin, "thin")
+    CSS_HANDLE_KEYWORD(Unset, "unset")
+    CSS_HANDLE_KEYWORD(Visible, "visible")
+    CSS_HANDLE_KEYWORD(Wrap, "wrap")
+    CSS_HANDLE_KEYWORD(WrapReverse, "wrap-reverse")
     default:
       break;
   }
@@ -455,4 +278,6 @@ constexpr std::optional<KeywordT> parseCSSKeyword(std::string_view ident) {
   return std::nullopt;
 }
 
+#undef CSS_HANDLE_KEYWORD
+
 } // namespace facebook::react
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <limits>
 #include <optional>
 
 #include <react/renderer/css/CSSKeywords.h>
@@ -203,7 +204,8 @@ constexpr void parseCSSComponentValue(
 };
 
 template <CSSDataType... AllowedTypesT>
-CSSValueVariant<AllowedTypesT...> parseCSSComponentValue(std::string_view css) {
+constexpr CSSValueVariant<AllowedTypesT...> parseCSSComponentValue(
+    std::string_view css) {
   CSSValueVariant<AllowedTypesT...> value;
   parseCSSComponentValue<AllowedTypesT...>(css, value);
   return value;
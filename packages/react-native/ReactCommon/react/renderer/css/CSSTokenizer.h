@@ -7,7 +7,7 @@
 
 #pragma once
 
-#include <cmath>
+#include <cstdint>
 #include <string_view>
 
 namespace facebook::react {
@@ -190,9 +190,8 @@ class CSSTokenizer {
       value = static_cast<float>(signPart * intPart);
     } else {
       value = static_cast<float>(
-          signPart *
-          (intPart + (fractionalPart * std::pow(10, -fractionDigits))) *
-          std::pow(10, exponentSign * exponentPart));
+          signPart * (intPart + (fractionalPart * powerOf10(-fractionDigits))) *
+          powerOf10(exponentSign * exponentPart));
     }
 
     consumeRunningValue();
@@ -234,6 +233,15 @@ class CSSTokenizer {
     return next;
   }
 
+  static constexpr double powerOf10(int32_t exponent) {
+    // Unlike `std::pow`, can be evaluated at compile time.
+    double result = 1.0;
+    for (auto i = exponent < 0 ? -exponent : exponent; i > 0; i--) {
+      result *= 10.0;
+    }
+    return exponent < 0 ? 1.0 / result : result;
+  }
+
   static constexpr bool isDigit(char c) {
     // https://www.w3.org/TR/css-syntax-3/#digit
     return c >= '0' && c <= '9';
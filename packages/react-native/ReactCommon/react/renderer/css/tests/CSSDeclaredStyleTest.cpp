@@ -148,4 +148,106 @@ TEST(CSSDeclaredStyle, get_with_precedence) {
   EXPECT_EQ(margin2.getLength().unit, CSSLengthUnit::Px);
 }
 
+template <CSSProp... Props>
+static void setLengths(CSSDeclaredStyle& style, std::string_view value) {
+  (style.set<Props>(value), ...);
+}
+
+template <CSSProp... Props>
+static bool hasLengths(const CSSDeclaredStyle& style, float value) {
+  return ((style.get<Props>().getLength().value == value) && ...);
+}
+
+TEST(CSSDeclaredStyle, set_beyond_inline_values) {
+  CSSDeclaredStyle style;
+
+  // In reverse order of the props, so every value is inserted first.
+  setLengths<
+      CSSProp::Width,
+      CSSProp::Top,
+      CSSProp::Right,
+      CSSProp::PaddingTop,
+      CSSProp::PaddingLeft,
+      CSSProp::Padding,
+      CSSProp::MinWidth,
+      CSSProp::MinHeight,
+      CSSProp::MaxWidth,
+      CSSProp::MaxHeight,
+      CSSProp::MarginTop,
+      CSSProp::MarginLeft,
+      CSSProp::Margin,
+      CSSProp::Left,
+      CSSProp::Height,
+      CSSProp::FlexBasis,
+      CSSProp::End,
+      CSSProp::Bottom,
+      CSSProp::BorderWidth,
+      CSSProp::BorderRadius>(style, "1px");
+  style.set<CSSProp::AspectRatio>("16 / 9");
+  setLengths<CSSProp::Top, CSSProp::Margin, CSSProp::BorderWidth>(
+      style, "2px");
+
+  EXPECT_TRUE((hasLengths<
+               CSSProp::Width,
+               CSSProp::Right,
+               CSSProp::PaddingTop,
+               CSSProp::PaddingLeft,
+               CSSProp::Padding,
+               CSSProp::MinWidth,
+               CSSProp::MinHeight,
+               CSSProp::MaxWidth,
+               CSSProp::MaxHeight,
+               CSSProp::MarginTop,
+               CSSProp::MarginLeft,
+               CSSProp::Left,
+               CSSProp::Height,
+               CSSProp::FlexBasis,
+               CSSProp::End,
+               CSSProp::Bottom,
+               CSSProp::BorderRadius>(style, 1.0f)));
+  EXPECT_TRUE(
+      (hasLengths<CSSProp::Top, CSSProp::Margin, CSSProp::BorderWidth>(
+          style, 2.0f)));
+  EXPECT_EQ(style.get<CSSProp::AspectRatio>().getRatio().numerator, 16.0f);
+  EXPECT_EQ(
+      style.get<CSSProp::MarginRight>().type(), CSSValueType::CSSWideKeyword);
+}
+
+TEST(CSSDeclaredStyle, copy_and_compare) {
+  CSSDeclaredStyle style;
+  setLengths<
+      CSSProp::Top,
+      CSSProp::Right,
+      CSSProp::Bottom,
+      CSSProp::Left,
+      CSSProp::Start,
+      CSSProp::End,
+      CSSProp::Margin,
+      CSSProp::MarginTop,
+      CSSProp::MarginRight,
+      CSSProp::MarginBottom,
+      CSSProp::MarginLeft,
+      CSSProp::Padding,
+      CSSProp::PaddingTop,
+      CSSProp::PaddingRight,
+      CSSProp::PaddingBottom,
+      CSSProp::PaddingLeft>(style, "1px");
+  for (auto value : {"1px", "2px", "3px", "4px", "5px", "6px", "7px"}) {
+    style.set<CSSProp::Width>(value);
+    style.set<CSSProp::Height>(value);
+  }
+
+  auto copy = style;
+  EXPECT_EQ(copy, style);
+  EXPECT_EQ(copy.get<CSSProp::Width>().getLength().value, 7.0f);
+  EXPECT_EQ(copy.get<CSSProp::Margin>().getLength().value, 1.0f);
+
+  copy.set<CSSProp::Margin>("2px");
+  EXPECT_NE(copy, style);
+  EXPECT_EQ(style.get<CSSProp::Margin>().getLength().value, 1.0f);
+
+  auto moved = std::move(copy);
+  EXPECT_EQ(moved.get<CSSProp::Margin>().getLength().value, 2.0f);
+}
+
 } // namespace facebook::react
@@ -314,4 +314,31 @@ TEST(CSSParser, parse_length_prop_constexpr) {
   EXPECT_EQ(pxValue.getLength().unit, CSSLengthUnit::Px);
 }
 
+TEST(CSSParser, parse_fractional_length_prop_constexpr) {
+  constexpr auto pxValue = parseCSSProp<CSSProp::BorderWidth>("1.5e1px");
+  EXPECT_EQ(pxValue.type(), CSSValueType::Length);
+  EXPECT_EQ(pxValue.getLength().value, 15.0f);
+  EXPECT_EQ(pxValue.getLength().unit, CSSLengthUnit::Px);
+}
+
+TEST(CSSParser, keywords_match_only_their_ident) {
+  auto initialValue = parseCSSComponentValue<CSSWideKeyword>("initial");
+  EXPECT_EQ(initialValue.type(), CSSValueType::CSSWideKeyword);
+  EXPECT_EQ(initialValue.getCSSWideKeyword(), CSSWideKeyword::Initial);
+
+  auto insetValue = parseCSSComponentValue<CSSWideKeyword, CSSKeyword>("inset");
+  EXPECT_EQ(insetValue.type(), CSSValueType::Keyword);
+  EXPECT_EQ(insetValue.getKeyword(), CSSKeyword::Inset);
+
+  // "fixed" and "start" are not keywords of these properties, and must not be
+  // parsed as keywords which follow them ("flex" and "static").
+  auto fixedValue = parseCSSProp<CSSProp::Display>("fixed");
+  EXPECT_EQ(fixedValue.type(), CSSValueType::CSSWideKeyword);
+  EXPECT_EQ(fixedValue.getCSSWideKeyword(), CSSWideKeyword::Unset);
+
+  auto startValue = parseCSSProp<CSSProp::Position>("start");
+  EXPECT_EQ(startValue.type(), CSSValueType::CSSWideKeyword);
+  EXPECT_EQ(startValue.getCSSWideKeyword(), CSSWideKeyword::Unset);
+}
+
 } // namespace facebook::react
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/css/CSSDeclaredStyle.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bitset>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+// Counts heap allocations, so benchmarks can report how many building styles
+// does.
+static std::atomic<size_t> allocationCount{0};
+
+void* operator new(size_t size) {
+  allocationCount++;
+  if (auto pointer = std::malloc(size == 0 ? 1 : size)) {
+    return pointer;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t /*size*/) noexcept {
+  std::free(pointer);
+}
+
+namespace facebook::react {
+
+/**
+ * The previous storage of CSSDeclaredStyle, kept as a baseline: declared
+ * values in a vector sorted by prop, found by binary search and inserted in
+ * place.
+ */
+class SortedVectorDeclaredStyle {
+ public:
+  template <CSSProp Prop>
+  void set(const CSSDeclaredValue<Prop>& value) {
+    using DeclaredValueT = std::remove_cvref_t<CSSDeclaredValue<Prop>>;
+    if (specifiedProperties_.test(to_underlying(Prop))) {
+      auto it = std::lower_bound(
+          properties_.begin(), properties_.end(), PropMapping{Prop, {}});
+      std::construct_at(
+          reinterpret_cast<DeclaredValueT*>(it->value.data()), value);
+    } else {
+      auto it = std::upper_bound(
+          properties_.begin(), properties_.end(), PropMapping{Prop, {}});
+      it = properties_.insert(it, {Prop, {}});
+      std::construct_at(
+          reinterpret_cast<DeclaredValueT*>(it->value.data()), value);
+      specifiedProperties_.set(to_underlying(Prop));
+    }
+  }
+
+  template <CSSProp Prop>
+  CSSDeclaredValue<Prop> get() const {
+    if (specifiedProperties_.test(to_underlying(Prop))) {
+      auto it = std::lower_bound(
+          properties_.begin(), properties_.end(), PropMapping{Prop, {}});
+      return *std::launder(
+          reinterpret_cast<const CSSDeclaredValue<Prop>*>(it->value.data()));
+    }
+    return {};
+  }
+
+ private:
+  struct PropMapping {
+    CSSProp prop;
+    std::array<
+        std::byte,
+        sizeof(CSSValueVariant<
+               CSSWideKeyword,
+               CSSKeyword,
+               CSSLength,
+               CSSNumber,
+               CSSPercentage,
+               CSSRatio>)>
+        value;
+
+    constexpr bool operator<(const PropMapping& rhs) const {
+      return to_underlying(prop) < to_underlying(rhs.prop);
+    }
+  };
+
+  std::vector<PropMapping> properties_;
+  std::bitset<kCSSPropCount> specifiedProperties_;
+};
+
+// Parsed at compile time, so only storing values is measured.
+template <CSSProp Prop>
+constexpr auto kLength = parseCSSProp<Prop>("12px");
+constexpr auto kRow = parseCSSProp<CSSProp::FlexDirection>("row");
+constexpr auto kCenter = parseCSSProp<CSSProp::AlignItems>("center");
+constexpr auto kRatio = parseCSSProp<CSSProp::AspectRatio>("16 / 9");
+constexpr auto kRelative = parseCSSProp<CSSProp::Position>("relative");
+
+// Declarations of a typical style of a list item, in the order they would be
+// written (which isn't the order of the props).
+template <typename StyleT>
+static void declareTypicalStyle(StyleT& style) {
+  style.template set<CSSProp::Width>(kLength<CSSProp::Width>);
+  style.template set<CSSProp::Height>(kLength<CSSProp::Height>);
+  style.template set<CSSProp::FlexDirection>(kRow);
+  style.template set<CSSProp::AlignItems>(kCenter);
+  style.template set<CSSProp::PaddingHorizontal>(kLength<CSSProp::PaddingHorizontal>);
+  style.template set<CSSProp::PaddingVertical>(kLength<CSSProp::PaddingVertical>);
+  style.template set<CSSProp::MarginBottom>(kLength<CSSProp::MarginBottom>);
+  style.template set<CSSProp::BorderBottomLeftRadius>(kLength<CSSProp::BorderBottomLeftRadius>);
+  style.template set<CSSProp::BorderBottomRightRadius>(kLength<CSSProp::BorderBottomRightRadius>);
+  style.template set<CSSProp::AspectRatio>(kRatio);
+  style.template set<CSSProp::Position>(kRelative);
+  style.template set<CSSProp::Top>(kLength<CSSProp::Top>);
+  style.template set<CSSProp::Width>(kLength<CSSProp::Width>);
+}
+
+template <typename StyleT>
+static void readTypicalStyle(const StyleT& style) {
+  benchmark::DoNotOptimize(style.template get<CSSProp::Width>());
+  benchmark::DoNotOptimize(style.template get<CSSProp::Height>());
+  benchmark::DoNotOptimize(style.template get<CSSProp::FlexDirection>());
+  benchmark::DoNotOptimize(style.template get<CSSProp::AlignItems>());
+  benchmark::DoNotOptimize(style.template get<CSSProp::PaddingHorizontal>());
+  benchmark::DoNotOptimize(style.template get<CSSProp::MarginBottom>());
+  benchmark::DoNotOptimize(style.template get<CSSProp::AspectRatio>());
+  benchmark::DoNotOptimize(style.template get<CSSProp::Position>());
+  benchmark::DoNotOptimize(style.template get<CSSProp::Top>());
+  benchmark::DoNotOptimize(style.template get<CSSProp::Left>());
+  benchmark::DoNotOptimize(style.template get<CSSProp::MarginTop>());
+  benchmark::DoNotOptimize(style.template get<CSSProp::FlexWrap>());
+}
+
+static void reportAllocations(benchmark::State& state, size_t initialCount) {
+  state.counters["allocations"] = benchmark::Counter(
+      static_cast<double>(allocationCount - initialCount),
+      benchmark::Counter::kAvgIterations);
+}
+
+template <typename StyleT>
+static void declareStyle(benchmark::State& state) {
+  auto initialCount = allocationCount.load();
+  for (auto _ : state) {
+    auto style = StyleT{};
+    declareTypicalStyle(style);
+    benchmark::DoNotOptimize(style);
+  }
+  reportAllocations(state, initialCount);
+}
+BENCHMARK(declareStyle<SortedVectorDeclaredStyle>);
+BENCHMARK(declareStyle<CSSDeclaredStyle>);
+
+template <typename StyleT>
+static void readStyle(benchmark::State& state) {
+  auto style = StyleT{};
+  declareTypicalStyle(style);
+  for (auto _ : state) {
+    readTypicalStyle(style);
+  }
+}
+BENCHMARK(readStyle<SortedVectorDeclaredStyle>);
+BENCHMARK(readStyle<CSSDeclaredStyle>);
+
+template <typename StyleT>
+static void copyStyle(benchmark::State& state) {
+  auto style = StyleT{};
+  declareTypicalStyle(style);
+  auto initialCount = allocationCount.load();
+  for (auto _ : state) {
+    auto copy = style;
+    benchmark::DoNotOptimize(copy);
+  }
+  reportAllocations(state, initialCount);
+}
+BENCHMARK(copyStyle<SortedVectorDeclaredStyle>);
+BENCHMARK(copyStyle<CSSDeclaredStyle>);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
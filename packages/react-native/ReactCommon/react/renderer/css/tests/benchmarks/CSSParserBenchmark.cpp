@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/css/CSSParser.h>
+#include <react/renderer/css/CSSTokenizer.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Counts heap allocations, so benchmarks can report how many parsing does
+// (which should be none).
+static std::atomic<size_t> allocationCount{0};
+
+void* operator new(size_t size) {
+  allocationCount++;
+  if (auto pointer = std::malloc(size == 0 ? 1 : size)) {
+    return pointer;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t /*size*/) noexcept {
+  std::free(pointer);
+}
+
+namespace facebook::react {
+
+// Declarations typical for styles of list items, repeated into a large sheet.
+constexpr auto kSheetRepetitions = 100;
+
+static std::vector<std::string> lengths() {
+  return {"12px", "0", "50%", "1.5em", "auto", "100vw", "-4px", "inherit"};
+}
+
+static std::vector<std::string> keywords() {
+  return {
+      "row",
+      "column-reverse",
+      "flex-start",
+      "space-between",
+      "absolute",
+      "hidden",
+      "Center",
+      "unset"};
+}
+
+static std::vector<std::string> numbers() {
+  return {"1", "0.5", "16 / 9", "2.5e-1", "initial"};
+}
+
+static std::vector<std::string> sheetOf(std::vector<std::string> values) {
+  auto sheet = std::vector<std::string>{};
+  for (auto i = 0; i < kSheetRepetitions; i++) {
+    sheet.insert(sheet.end(), values.begin(), values.end());
+  }
+  return sheet;
+}
+
+static void reportAllocations(benchmark::State& state, size_t initialCount) {
+  state.counters["allocations"] = benchmark::Counter(
+      static_cast<double>(allocationCount - initialCount),
+      benchmark::Counter::kAvgIterations);
+}
+
+static void tokenizeSheet(benchmark::State& state) {
+  auto sheet = sheetOf(lengths());
+  auto initialCount = allocationCount.load();
+  for (auto _ : state) {
+    for (const auto& declaration : sheet) {
+      auto tokenizer = CSSTokenizer{declaration};
+      while (tokenizer.next().type() != CSSTokenType::EndOfFile) {
+      }
+    }
+  }
+  reportAllocations(state, initialCount);
+}
+BENCHMARK(tokenizeSheet);
+
+static void parseLengthSheet(benchmark::State& state) {
+  auto sheet = sheetOf(lengths());
+  auto initialCount = allocationCount.load();
+  for (auto _ : state) {
+    for (const auto& declaration : sheet) {
+      benchmark::DoNotOptimize(parseCSSProp<CSSProp::Width>(declaration));
+    }
+  }
+  reportAllocations(state, initialCount);
+}
+BENCHMARK(parseLengthSheet);
+
+static void parseKeywordSheet(benchmark::State& state) {
+  auto sheet = sheetOf(keywords());
+  auto initialCount = allocationCount.load();
+  for (auto _ : state) {
+    for (const auto& declaration : sheet) {
+      benchmark::DoNotOptimize(
+          parseCSSComponentValue<CSSWideKeyword, CSSKeyword>(declaration));
+    }
+  }
+  reportAllocations(state, initialCount);
+}
+BENCHMARK(parseKeywordSheet);
+
+static void parseNumberSheet(benchmark::State& state) {
+  auto sheet = sheetOf(numbers());
+  auto initialCount = allocationCount.load();
+  for (auto _ : state) {
+    for (const auto& declaration : sheet) {
+      benchmark::DoNotOptimize(
+          parseCSSComponentValue<CSSWideKeyword, CSSNumber, CSSRatio>(
+              declaration));
+    }
+  }
+  reportAllocations(state, initialCount);
+}
+BENCHMARK(parseNumberSheet);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
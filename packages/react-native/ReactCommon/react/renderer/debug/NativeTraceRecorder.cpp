@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "NativeTraceRecorder.h"
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+namespace facebook::react {
+
+std::atomic<bool> NativeTraceRecorder::isRecording_{false};
+
+static uint64_t currentThreadId() {
+  thread_local auto threadId =
+      static_cast<uint64_t>(std::hash<std::thread::id>{}(
+          std::this_thread::get_id()));
+  return threadId;
+}
+
+NativeTraceRecorder& NativeTraceRecorder::getInstance() {
+  static auto instance = new NativeTraceRecorder();
+  return *instance;
+}
+
+NativeTraceRecorder::NativeTraceRecorder()
+    : slots_(std::make_unique<Slot[]>(kCapacity)) {}
+
+void NativeTraceRecorder::start() {
+  std::lock_guard<std::mutex> lock(sessionMutex_);
+  startIndex_ = nextIndex_.load(std::memory_order_acquire);
+  isRecording_.store(true, std::memory_order_release);
+}
+
+std::vector<NativeTraceRecorder::Event> NativeTraceRecorder::stop(
+    bool* dataLossOccurred) {
+  std::lock_guard<std::mutex> lock(sessionMutex_);
+  isRecording_.store(false, std::memory_order_release);
+
+  auto endIndex = nextIndex_.load(std::memory_order_acquire);
+  auto beginIndex = std::max(
+      startIndex_, endIndex > kCapacity ? endIndex - kCapacity : uint64_t{0});
+  if (dataLossOccurred != nullptr) {
+    *dataLossOccurred = beginIndex != startIndex_;
+  }
+  startIndex_ = endIndex;
+
+  auto events = std::vector<Event>{};
+  events.reserve(endIndex - beginIndex);
+  for (auto index = beginIndex; index < endIndex; index++) {
+    const auto& slot = slots_[index % kCapacity];
+    auto sequence = slot.sequence.load(std::memory_order_acquire);
+    auto event = Event{
+        slot.name.load(std::memory_order_relaxed),
+        slot.category.load(std::memory_order_relaxed),
+        Clock::time_point(
+            Clock::duration(slot.startTime.load(std::memory_order_relaxed))),
+        Clock::time_point(
+            Clock::duration(slot.endTime.load(std::memory_order_relaxed))),
+        slot.threadId.load(std::memory_order_relaxed)};
+    std::atomic_thread_fence(std::memory_order_acquire);
+    // Events which are still being written (or were already overwritten by a
+    // later one) are skipped.
+    if (sequence != 2 * index + 2 ||
+        slot.sequence.load(std::memory_order_relaxed) != sequence) {
+      continue;
+    }
+    events.push_back(event);
+  }
+  return events;
+}
+
+void NativeTraceRecorder::record(
+    const char* category,
+    const char* name,
+    Clock::time_point startTime,
+    Clock::time_point endTime) noexcept {
+  auto index = nextIndex_.fetch_add(1, std::memory_order_relaxed);
+  auto& slot = slots_[index % kCapacity];
+  slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.name.store(name, std::memory_order_relaxed);
+  slot.category.store(category, std::memory_order_relaxed);
+  slot.startTime.store(
+      startTime.time_since_epoch().count(), std::memory_order_relaxed);
+  slot.endTime.store(
+      endTime.time_since_epoch().count(), std::memory_order_relaxed);
+  slot.threadId.store(currentThreadId(), std::memory_order_relaxed);
+  slot.sequence.store(2 * index + 2, std::memory_order_release);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Records the durations of native sections of work (e.g. `SystraceSection`s)
+ * while a trace is being recorded by a debugger, so that they can be shown
+ * alongside JavaScript in the Performance panel.
+ *
+ * Recording is lock-free: events are written to a fixed size ring buffer
+ * which overwrites the oldest events when it is full. While no trace is being
+ * recorded, `record` is never called and `isRecording` is a single relaxed
+ * load.
+ */
+class NativeTraceRecorder final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Event {
+    /*
+     * Must be static strings, they are not copied.
+     */
+    const char* name;
+    const char* category;
+    Clock::time_point startTime;
+    Clock::time_point endTime;
+    uint64_t threadId;
+  };
+
+  static constexpr size_t kCapacity = 1 << 14;
+
+  static NativeTraceRecorder& getInstance();
+
+  static bool isRecording() noexcept {
+    return isRecording_.load(std::memory_order_relaxed);
+  }
+
+  /*
+   * Drops all recorded events and starts recording.
+   */
+  void start();
+
+  /*
+   * Stops recording and returns the events recorded since `start`, oldest
+   * first. Sets `dataLossOccurred` if older events had to be overwritten.
+   */
+  std::vector<Event> stop(bool* dataLossOccurred = nullptr);
+
+  /*
+   * Can be called from any thread.
+   */
+  void record(
+      const char* category,
+      const char* name,
+      Clock::time_point startTime,
+      Clock::time_point endTime) noexcept;
+
+ private:
+  /*
+   * A seqlock: `sequence` is odd while the slot is written and
+   * `2 * index + 2` once the event with given index is written.
+   */
+  struct Slot {
+    std::atomic<uint64_t> sequence{0};
+    std::atomic<const char*> name{nullptr};
+    std::atomic<const char*> category{nullptr};
+    std::atomic<int64_t> startTime{0};
+    std::atomic<int64_t> endTime{0};
+    std::atomic<uint64_t> threadId{0};
+  };
+
+  NativeTraceRecorder();
+
+  static std::atomic<bool> isRecording_;
+
+  std::unique_ptr<Slot[]> slots_;
+  std::atomic<uint64_t> nextIndex_{0};
+  uint64_t startIndex_{0};
+  std::mutex sessionMutex_;
+};
+
+/*
+ * Records the duration of its scope while `NativeTraceRecorder` is recording.
+ * `name` must be a static string.
+ */
+class NativeTraceSection final {
+ public:
+  explicit NativeTraceSection(
+      const char* name,
+      const char* category = "native") noexcept
+      : name_(NativeTraceRecorder::isRecording() ? name : nullptr),
+        category_(category) {
+    if (name_ != nullptr) {
+      startTime_ = NativeTraceRecorder::Clock::now();
+    }
+  }
+
+  ~NativeTraceSection() {
+    if (name_ != nullptr) {
+      NativeTraceRecorder::getInstance().record(
+          category_, name_, startTime_, NativeTraceRecorder::Clock::now());
+    }
+  }
+
+  NativeTraceSection(const NativeTraceSection&) = delete;
+  NativeTraceSection& operator=(const NativeTraceSection&) = delete;
+
+ private:
+  const char* name_;
+  const char* category_;
+  NativeTraceRecorder::Clock::time_point startTime_{};
+};
+
+} // namespace facebook::react
@@ -7,8 +7,14 @@
 
 #pragma once
 
+#include <react/renderer/debug/NativeTraceRecorder.h>
+
+#include <cstdint>
+
 #ifdef WITH_FBSYSTRACE
 #include <fbsystrace.h>
+#elif defined(WITH_PERFETTO)
+#include <reactperflogger/ReactPerfetto.h>
 #endif
 
 namespace facebook::react {
@@ -18,6 +24,10 @@ namespace facebook::react {
  * quickly and can throttle too frequent events so we can get useful traces even
  * if rendering etc. is spinning. For throttling we'll need file/line info so we
  * use a macro.
+ *
+ * Unless `WITH_LOOM_TRACE` is defined, sections are also recorded by
+ * `NativeTraceRecorder` while a debugger records a trace, so their names must
+ * be static strings.
  */
 #if defined(WITH_LOOM_TRACE)
 #define SystraceSection                                         \
@@ -39,21 +49,72 @@ struct ConcreteSystraceSection {
   explicit ConcreteSystraceSection(
       const char* name,
       ConvertsToStringPiece&&... args)
-      : m_section(TRACE_TAG_REACT_CXX_BRIDGE, name, args...) {}
+      : m_section(TRACE_TAG_REACT_CXX_BRIDGE, name, args...),
+        m_nativeTraceSection(name) {}
 
  private:
   fbsystrace::FbSystraceSection m_section;
+  NativeTraceSection m_nativeTraceSection;
 };
 using SystraceSection = ConcreteSystraceSection;
+#elif defined(WITH_PERFETTO)
+/**
+ * Records sections as Perfetto track events of the "react-native" category,
+ * with `args` (pairs of static keys and values) as typed arguments. Costs a
+ * single load while the category is disabled.
+ */
+struct PerfettoSystraceSection {
+ public:
+  template <typename... ConvertsToStringPiece>
+  explicit PerfettoSystraceSection(
+      const char* name,
+      ConvertsToStringPiece&&... args)
+      : m_nativeTraceSection(name) {
+    TRACE_EVENT_BEGIN("react-native", perfetto::StaticString{name}, args...);
+  }
+
+  ~PerfettoSystraceSection() {
+    TRACE_EVENT_END("react-native");
+  }
+
+ private:
+  NativeTraceSection m_nativeTraceSection;
+};
+using SystraceSection = PerfettoSystraceSection;
 #else
 struct DummySystraceSection {
  public:
   template <typename... ConvertsToStringPiece>
   explicit DummySystraceSection(
-      __unused const char* name,
-      __unused ConvertsToStringPiece&&... args) {}
+      const char* name,
+      __unused ConvertsToStringPiece&&... args)
+      : m_nativeTraceSection(name) {}
+
+ private:
+  NativeTraceSection m_nativeTraceSection;
 };
 using SystraceSection = DummySystraceSection;
 #endif
 
+/**
+ * Connects the current section to the next ones that call `systraceFlowStep`
+ * or `systraceFlowEnd` with the same id, on any thread (e.g. the commits of a
+ * surface to their mount). Only recorded by the Perfetto backend.
+ */
+inline void systraceFlowStep([[maybe_unused]] uint64_t flowId) {
+#if defined(WITH_PERFETTO) && !defined(WITH_FBSYSTRACE)
+  TRACE_EVENT_INSTANT(
+      "react-native.fabric", "flow", perfetto::Flow::ProcessScoped(flowId));
+#endif
+}
+
+inline void systraceFlowEnd([[maybe_unused]] uint64_t flowId) {
+#if defined(WITH_PERFETTO) && !defined(WITH_FBSYSTRACE)
+  TRACE_EVENT_INSTANT(
+      "react-native.fabric",
+      "flow",
+      perfetto::TerminatingFlow::ProcessScoped(flowId));
+#endif
+}
+
 } // namespace facebook::react
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/debug/NativeTraceRecorder.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+TEST(NativeTraceRecorderTest, recordsSectionsOnlyWhileRecording) {
+  auto& recorder = NativeTraceRecorder::getInstance();
+
+  { NativeTraceSection section("before"); }
+
+  recorder.start();
+  EXPECT_TRUE(NativeTraceRecorder::isRecording());
+  { NativeTraceSection section("during", "test"); }
+
+  auto dataLossOccurred = true;
+  auto events = recorder.stop(&dataLossOccurred);
+  EXPECT_FALSE(NativeTraceRecorder::isRecording());
+  { NativeTraceSection section("after"); }
+
+  EXPECT_FALSE(dataLossOccurred);
+  ASSERT_EQ(events.size(), 1);
+  EXPECT_EQ(std::string(events[0].name), "during");
+  EXPECT_EQ(std::string(events[0].category), "test");
+  EXPECT_LE(events[0].startTime, events[0].endTime);
+
+  recorder.start();
+  EXPECT_TRUE(recorder.stop().empty());
+}
+
+TEST(NativeTraceRecorderTest, keepsLatestEventsWhenFull) {
+  auto& recorder = NativeTraceRecorder::getInstance();
+  auto now = NativeTraceRecorder::Clock::now();
+
+  recorder.start();
+  auto count = NativeTraceRecorder::kCapacity + 10;
+  for (size_t i = 0; i < count; i++) {
+    recorder.record("test", "event", now + std::chrono::nanoseconds(i), now);
+  }
+
+  auto dataLossOccurred = false;
+  auto events = recorder.stop(&dataLossOccurred);
+  EXPECT_TRUE(dataLossOccurred);
+  ASSERT_EQ(events.size(), NativeTraceRecorder::kCapacity);
+  EXPECT_EQ(events.front().startTime, now + std::chrono::nanoseconds(10));
+  EXPECT_EQ(
+      events.back().startTime, now + std::chrono::nanoseconds(count - 1));
+}
+
+TEST(NativeTraceRecorderTest, recordsFromManyThreads) {
+  auto& recorder = NativeTraceRecorder::getInstance();
+
+  recorder.start();
+  auto threads = std::vector<std::thread>{};
+  for (int i = 0; i < 4; i++) {
+    threads.emplace_back([] {
+      for (int j = 0; j < 1000; j++) {
+        NativeTraceSection section("section");
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto events = recorder.stop();
+  EXPECT_EQ(events.size(), 4000);
+  EXPECT_NE(events.front().threadId, 0);
+}
+
+} // namespace facebook::react
@@ -14,6 +14,67 @@
 
 namespace facebook::react {
 
+namespace {
+
+using Matrix = std::array<Float, 16>;
+
+/*
+ * Computes `lhs * rhs` into `result`, which must not alias either of them.
+ * Each column of the result is a combination of the rows of `lhs`, which are
+ * contiguous, so compilers vectorize the inner loop on every architecture
+ * (`Float` is `double` on some platforms and `float` on others).
+ */
+void multiplyMatrices(const Matrix& lhs, const Matrix& rhs, Matrix& result) {
+  for (size_t i = 0; i < 16; i += 4) {
+    auto rhs0 = rhs[i];
+    auto rhs1 = rhs[i + 1];
+    auto rhs2 = rhs[i + 2];
+    auto rhs3 = rhs[i + 3];
+    for (size_t j = 0; j < 4; j++) {
+      result[i + j] = rhs0 * lhs[j] + rhs1 * lhs[4 + j] + rhs2 * lhs[8 + j] +
+          rhs3 * lhs[12 + j];
+    }
+  }
+}
+
+/*
+ * Equivalent to `transform = transform * rhs`, but appends to the operations
+ * of `transform` instead of copying them into a new transform.
+ */
+void concatenate(Transform& transform, const Transform& rhs) {
+  if (transform == Transform::Identity()) {
+    transform = rhs;
+    return;
+  }
+
+  for (const auto& op : rhs.operations) {
+    if (op.type == TransformOperationType::Identity &&
+        !transform.operations.empty()) {
+      continue;
+    }
+    transform.operations.push_back(op);
+  }
+
+  auto matrix = Matrix{};
+  multiplyMatrices(transform.matrix, rhs.matrix, matrix);
+  transform.matrix = matrix;
+}
+
+/*
+ * Returns whether a transform can be recomposed from its operations alone.
+ */
+bool isComposedOfOperations(const Transform& transform) {
+  for (const auto& op : transform.operations) {
+    if (op.type == TransformOperationType::Arbitrary ||
+        op.type == TransformOperationType::Identity) {
+      return false;
+    }
+  }
+  return !transform.operations.empty();
+}
+
+} // namespace
+
 #if RN_DEBUG_STRING_CONVERTIBLE
 void Transform::print(const Transform& t, std::string prefix) {
   LOG(ERROR) << prefix << "[ " << t.matrix[0] << " " << t.matrix[1] << " "
@@ -132,13 +193,13 @@ Transform Transform::Rotate(Float x, Float y, Float z) {
   transform.operations.push_back(
       TransformOperation{TransformOperationType::Rotate, x, y, z});
   if (!isZero(x)) {
-    transform = transform * Transform::RotateX(x);
+    concatenate(transform, Transform::RotateX(x));
   }
   if (!isZero(y)) {
-    transform = transform * Transform::RotateY(y);
+    concatenate(transform, Transform::RotateY(y));
   }
   if (!isZero(z)) {
-    transform = transform * Transform::RotateZ(z);
+    concatenate(transform, Transform::RotateZ(z));
   }
   return transform;
 }
@@ -193,6 +254,13 @@ Transform Transform::Interpolate(
     Float animationProgress,
     const Transform& lhs,
     const Transform& rhs) {
+  // Interpolating between equal operations yields the same operations, so
+  // recomposing them is only needed if the matrix may not be derived from
+  // them.
+  if (lhs.operations == rhs.operations && isComposedOfOperations(rhs)) {
+    return rhs;
+  }
+
   // Iterate through operations and reconstruct an interpolated resulting
   // transform If at any point we hit an "Arbitrary" Transform, return at that
   // point
@@ -205,7 +273,7 @@ Transform Transform::Interpolate(
     if ((haveLHS &&
          lhs.operations[i].type == TransformOperationType::Arbitrary) ||
         (haveRHS &&
-         rhs.operations[i].type == TransformOperationType::Arbitrary)) {
+         rhs.operations[j].type == TransformOperationType::Arbitrary)) {
       return result;
     }
     if (haveLHS && lhs.operations[i].type == TransformOperationType::Identity) {
@@ -237,12 +305,13 @@ Transform Transform::Interpolate(
     react_native_assert(type == lhsOp.type);
     react_native_assert(type == rhsOp.type);
 
-    result = result *
+    concatenate(
+        result,
         Transform::FromTransformOperation(TransformOperation{
             type,
             lhsOp.x + (rhsOp.x - lhsOp.x) * animationProgress,
             lhsOp.y + (rhsOp.y - lhsOp.y) * animationProgress,
-            lhsOp.z + (rhsOp.z - lhsOp.z) * animationProgress});
+            lhsOp.z + (rhsOp.z - lhsOp.z) * animationProgress}));
   }
 
   return result;
@@ -276,6 +345,7 @@ Transform Transform::operator*(const Transform& rhs) const {
 
   const auto& lhs = *this;
   auto result = Transform{};
+  result.operations.reserve(operations.size() + rhs.operations.size());
   for (const auto& op : this->operations) {
     if (op.type == TransformOperationType::Identity &&
         !result.operations.empty()) {
@@ -291,58 +361,7 @@ Transform Transform::operator*(const Transform& rhs) const {
     result.operations.push_back(op);
   }
 
-  auto lhs00 = lhs.matrix[0];
-  auto lhs01 = lhs.matrix[1];
-  auto lhs02 = lhs.matrix[2];
-  auto lhs03 = lhs.matrix[3];
-  auto lhs10 = lhs.matrix[4];
-  auto lhs11 = lhs.matrix[5];
-  auto lhs12 = lhs.matrix[6];
-  auto lhs13 = lhs.matrix[7];
-  auto lhs20 = lhs.matrix[8];
-  auto lhs21 = lhs.matrix[9];
-  auto lhs22 = lhs.matrix[10];
-  auto lhs23 = lhs.matrix[11];
-  auto lhs30 = lhs.matrix[12];
-  auto lhs31 = lhs.matrix[13];
-  auto lhs32 = lhs.matrix[14];
-  auto lhs33 = lhs.matrix[15];
-
-  auto rhs0 = rhs.matrix[0];
-  auto rhs1 = rhs.matrix[1];
-  auto rhs2 = rhs.matrix[2];
-  auto rhs3 = rhs.matrix[3];
-  result.matrix[0] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[1] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[2] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[3] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[4];
-  rhs1 = rhs.matrix[5];
-  rhs2 = rhs.matrix[6];
-  rhs3 = rhs.matrix[7];
-  result.matrix[4] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[5] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[6] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[7] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[8];
-  rhs1 = rhs.matrix[9];
-  rhs2 = rhs.matrix[10];
-  rhs3 = rhs.matrix[11];
-  result.matrix[8] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[9] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[10] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[11] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[12];
-  rhs1 = rhs.matrix[13];
-  rhs2 = rhs.matrix[14];
-  rhs3 = rhs.matrix[15];
-  result.matrix[12] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[13] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[14] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[15] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
+  multiplyMatrices(lhs.matrix, rhs.matrix, result.matrix);
 
   return result;
 }
@@ -50,6 +50,8 @@ struct TransformOperation {
   Float x;
   Float y;
   Float z;
+
+  bool operator==(const TransformOperation& rhs) const = default;
 };
 
 struct TransformOrigin {
@@ -26,13 +26,7 @@ inline void fromRawValueShared(
 
   if (value.hasType<int>()) {
     auto argb = (int64_t)value;
-    auto ratio = 255.f;
-    colorComponents.alpha = ((argb >> 24) & 0xFF) / ratio;
-    colorComponents.red = ((argb >> 16) & 0xFF) / ratio;
-    colorComponents.green = ((argb >> 8) & 0xFF) / ratio;
-    colorComponents.blue = (argb & 0xFF) / ratio;
-
-    result = colorFromComponents(colorComponents);
+    result = hostPlatformColorFromArgb(static_cast<int32_t>(argb & 0xFFFFFFFF));
   } else if (value.hasType<std::vector<float>>()) {
     auto items = (std::vector<float>)value;
     auto length = items.size();
@@ -27,6 +27,10 @@ inline Color hostPlatformColorFromComponents(ColorComponents components) {
       ((int)round(components.blue * ratio) & 0xff);
 }
 
+inline Color hostPlatformColorFromArgb(int32_t argb) {
+  return argb;
+}
+
 inline ColorComponents colorComponentsFromHostPlatformColor(Color color) {
   float ratio = 255;
   return ColorComponents{
@@ -21,12 +21,11 @@ inline SharedColor parsePlatformColor(
     const ContextContainer& contextContainer,
     int32_t surfaceId,
     const RawValue& value) {
-  ColorComponents colorComponents = {0, 0, 0, 0};
-
   if (value.hasType<
           std::unordered_map<std::string, std::vector<std::string>>>()) {
-    const auto& fabricUIManager =
-        contextContainer.at<jni::global_ref<jobject>>("FabricUIManager");
+    static const auto fabricUIManagerKey =
+        ContextContainer::Key<jni::global_ref<jobject>>("FabricUIManager");
+    const auto& fabricUIManager = contextContainer.at(fabricUIManagerKey);
     static auto getColorFromJava =
         fabricUIManager->getClass()
             ->getMethod<jint(jint, jni::JArrayClass<jni::JString>)>("getColor");
@@ -41,16 +40,10 @@ inline SharedColor parsePlatformColor(
     }
     auto color =
         getColorFromJava(fabricUIManager, surfaceId, *javaResourcePaths);
-
-    auto argb = (int64_t)color;
-    auto ratio = 255.f;
-    colorComponents.alpha = ((argb >> 24) & 0xFF) / ratio;
-    colorComponents.red = ((argb >> 16) & 0xFF) / ratio;
-    colorComponents.green = ((argb >> 8) & 0xFF) / ratio;
-    colorComponents.blue = (argb & 0xFF) / ratio;
+    return {hostPlatformColorFromArgb(color)};
   }
 
-  return {colorFromComponents(colorComponents)};
+  return clearColor();
 }
 
 inline void fromRawValue(
@@ -63,6 +63,12 @@ inline Color hostPlatformColorFromComponents(ColorComponents components) {
   return Color(components);
 }
 
+/*
+ * Returns the color of a packed ARGB integer. Colors are interned, so repeated
+ * values (e.g. of themes) share one `UIColor`.
+ */
+Color hostPlatformColorFromArgb(int32_t argb);
+
 inline ColorComponents colorComponentsFromHostPlatformColor(Color color) {
   return color.getColorComponents();
 }
@@ -10,6 +10,7 @@
 #import <Foundation/Foundation.h>
 #import <UIKit/UIKit.h>
 #import <react/utils/ManagedObjectWrapper.h>
+#import <react/utils/ShardedThreadSafeCache.h>
 #import <string>
 
 using namespace facebook::react;
@@ -127,6 +128,17 @@ int32_t Color::getColor() const
 {
   return ColorFromUIColor(uiColor_);
 }
+
+Color hostPlatformColorFromArgb(int32_t argb)
+{
+  static auto uiColors = ShardedThreadSafeCache<int32_t, std::shared_ptr<void>, 1024>{};
+  return Color(uiColors.get(argb, [](const int32_t &key) {
+    auto ratio = 255.f;
+    auto components = ColorComponents{
+        ((key >> 16) & 0xFF) / ratio, ((key >> 8) & 0xFF) / ratio, (key & 0xFF) / ratio, ((key >> 24) & 0xFF) / ratio};
+    return wrapManagedObject(UIColorFromComponentsColor(components));
+  }));
+}
 } // namespace facebook::react
 
 NS_ASSUME_NONNULL_END
@@ -11,6 +11,7 @@
 #import <react/renderer/graphics/HostPlatformColor.h>
 #import <react/renderer/graphics/RCTPlatformColorUtils.h>
 #import <react/utils/ManagedObjectWrapper.h>
+#import <react/utils/ShardedThreadSafeCache.h>
 #import <string>
 #import <unordered_map>
 
@@ -50,13 +51,29 @@ inline facebook::react::SharedColor RCTPlatformColorComponentsFromDynamicItems(
   return SharedColor(color);
 }
 
+namespace {
+// Semantic colors adapt to the trait collection themselves, so all uses of the same names can share one `UIColor`.
+std::shared_ptr<void> RCTInternedPlatformColorFromSemanticItems(std::vector<std::string> &semanticItems)
+{
+  static auto uiColors = ShardedThreadSafeCache<std::string, std::shared_ptr<void>, 256>{};
+  auto key = std::string{};
+  for (const auto &item : semanticItems) {
+    key += item;
+    key += '\0';
+  }
+  return uiColors.get(key, [&](const std::string & /*key*/) {
+    return wrapManagedObject(RCTPlatformColorFromSemanticItems(semanticItems));
+  });
+}
+} // namespace
+
 SharedColor parsePlatformColor(const ContextContainer &contextContainer, int32_t surfaceId, const RawValue &value)
 {
   if (value.hasType<std::unordered_map<std::string, RawValue>>()) {
     auto items = (std::unordered_map<std::string, RawValue>)value;
     if (items.find("semantic") != items.end() && items.at("semantic").hasType<std::vector<std::string>>()) {
       auto semanticItems = (std::vector<std::string>)items.at("semantic");
-      return {wrapManagedObject(RCTPlatformColorFromSemanticItems(semanticItems))};
+      return {RCTInternedPlatformColorFromSemanticItems(semanticItems)};
     } else if (
         items.find("dynamic") != items.end() &&
         items.at("dynamic").hasType<std::unordered_map<std::string, RawValue>>()) {
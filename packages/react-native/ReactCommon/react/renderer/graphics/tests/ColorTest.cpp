@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/graphics/Color.h>
+
+using namespace facebook::react;
+
+TEST(ColorTest, colorFromArgbMatchesColorFromComponents) {
+  for (uint32_t argb : {0x00000000u, 0xFF000000u, 0xFFFFFFFFu, 0x80FF7F01u}) {
+    auto ratio = 255.f;
+    auto components = ColorComponents{
+        ((argb >> 16) & 0xFF) / ratio,
+        ((argb >> 8) & 0xFF) / ratio,
+        (argb & 0xFF) / ratio,
+        ((argb >> 24) & 0xFF) / ratio};
+
+    auto color = SharedColor{hostPlatformColorFromArgb((int32_t)argb)};
+    EXPECT_EQ(color, colorFromComponents(components));
+    EXPECT_EQ(colorComponentsFromColor(color).alpha, components.alpha);
+  }
+}
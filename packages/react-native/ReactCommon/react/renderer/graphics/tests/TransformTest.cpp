@@ -90,3 +90,26 @@ TEST(TransformTest, scalingAndTranslatingRect) {
   EXPECT_EQ(transformedRect.size.width, 150);
   EXPECT_EQ(transformedRect.size.height, 200);
 }
+
+TEST(TransformTest, multiplyingTransforms) {
+  auto transform = Transform::Scale(2, 3, 1) * Transform::Translate(10, 20, 0);
+  auto point = facebook::react::Point{1, 1} * transform;
+
+  EXPECT_EQ(point.x, 22);
+  EXPECT_EQ(point.y, 63);
+  EXPECT_EQ(transform.operations.size(), 2);
+}
+
+TEST(TransformTest, interpolatingTransforms) {
+  auto lhs = Transform::Translate(10, 0, 0) * Transform::Scale(1, 1, 1);
+  auto rhs = Transform::Translate(20, 0, 0) * Transform::Scale(3, 3, 1);
+
+  auto interpolated = Transform::Interpolate(0.5, lhs, rhs);
+  EXPECT_EQ(
+      interpolated,
+      Transform::Translate(15, 0, 0) * Transform::Scale(2, 2, 1));
+
+  // Interpolating between equal operations yields the same transform.
+  auto rotate = Transform::Translate(5, 5, 0) * Transform::RotateZ(1);
+  EXPECT_EQ(Transform::Interpolate(0.3, rotate, rotate), rotate);
+}
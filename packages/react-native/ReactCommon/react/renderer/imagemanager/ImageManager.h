@@ -11,6 +11,7 @@
 
 #include <react/renderer/core/ReactPrimitives.h>
 #include <react/renderer/imagemanager/ImageRequest.h>
+#include <react/renderer/imagemanager/ImageRequestDeduplicator.h>
 #include <react/renderer/imagemanager/primitives.h>
 #include <react/utils/ContextContainer.h>
 
@@ -35,6 +36,11 @@ class ImageManager {
 
  private:
   void* self_{};
+
+  /*
+   * Used when `CoreFeatures::enableImageRequestDeduplication` is enabled.
+   */
+  mutable ImageRequestDeduplicator deduplicator_;
 };
 
 } // namespace facebook::react
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ImagePrefetcher.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace facebook::react {
+
+// Viewports updated after a longer pause don't tell the scroll velocity.
+static constexpr auto kMaxVelocityInterval = std::chrono::milliseconds(500);
+
+ImagePrefetcher::ImagePrefetcher(Float lookAheadTime, Float maxLookAhead)
+    : lookAheadTime_(lookAheadTime), maxLookAhead_(maxLookAhead) {}
+
+Rect ImagePrefetcher::getLookAheadRect(
+    Rect viewport,
+    Point velocity,
+    Float lookAheadTime,
+    Float maxLookAhead) {
+  auto maxDistance = Point{
+      viewport.size.width * maxLookAhead, viewport.size.height * maxLookAhead};
+  auto distance = Point{
+      std::clamp(velocity.x * lookAheadTime, -maxDistance.x, maxDistance.x),
+      std::clamp(velocity.y * lookAheadTime, -maxDistance.y, maxDistance.y)};
+  return {
+      {viewport.origin.x + std::min<Float>(distance.x, 0),
+       viewport.origin.y + std::min<Float>(distance.y, 0)},
+      {viewport.size.width + std::abs(distance.x),
+       viewport.size.height + std::abs(distance.y)}};
+}
+
+void ImagePrefetcher::updateViewport(
+    Tag tag,
+    Rect viewport,
+    const std::vector<ImagePrefetchCandidate>& candidates,
+    TelemetryTimePoint time) {
+  std::scoped_lock lock(mutex_);
+
+  auto velocity = Point{};
+  auto iterator = scrollViews_.find(tag);
+  if (iterator != scrollViews_.end()) {
+    auto interval = time - iterator->second.time;
+    if (interval > TelemetryDuration::zero() &&
+        interval <= kMaxVelocityInterval) {
+      auto seconds = std::chrono::duration<Float>(interval).count();
+      auto distance = viewport.origin - iterator->second.viewport.origin;
+      velocity = {distance.x / seconds, distance.y / seconds};
+    }
+  } else {
+    iterator = scrollViews_.emplace(tag, ScrollView{}).first;
+  }
+
+  auto& scrollView = iterator->second;
+  scrollView.viewport = viewport;
+  scrollView.time = time;
+
+  auto lookAheadRect =
+      getLookAheadRect(viewport, velocity, lookAheadTime_, maxLookAhead_);
+
+  auto priorities = decltype(scrollView.priorities){};
+  priorities.reserve(candidates.size());
+  for (const auto& candidate : candidates) {
+    const auto& coordinator = candidate.request->getSharedObserverCoordinator();
+    if (!coordinator ||
+        coordinator->getStatus() != ImageResponse::Status::Loading) {
+      continue;
+    }
+
+    auto intersection = Rect::intersect(lookAheadRect, candidate.frame);
+    auto priority = intersection.size.width > 0 && intersection.size.height > 0
+        ? ImageRequestPriority::Visible
+        : ImageRequestPriority::Offscreen;
+
+    // Requests are created with the `Visible` priority.
+    auto previousPriority = ImageRequestPriority::Visible;
+    auto previous = scrollView.priorities.find(coordinator.get());
+    if (previous != scrollView.priorities.end() &&
+        previous->second.coordinator.lock() == coordinator) {
+      previousPriority = previous->second.priority;
+    }
+
+    if (priority != previousPriority) {
+      candidate.request->setPriority(priority);
+    }
+    priorities[coordinator.get()] = Priority{coordinator, priority};
+  }
+  scrollView.priorities = std::move(priorities);
+}
+
+void ImagePrefetcher::removeScrollView(Tag tag) {
+  std::scoped_lock lock(mutex_);
+  scrollViews_.erase(tag);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <react/renderer/core/ReactPrimitives.h>
+#include <react/renderer/graphics/Rect.h>
+#include <react/renderer/imagemanager/ImageRequest.h>
+#include <react/utils/Telemetry.h>
+
+namespace facebook::react {
+
+/*
+ * An image inside of a scrollable area whose loading may be prioritized.
+ */
+struct ImagePrefetchCandidate {
+  /*
+   * Frame of the image in the coordinate space of the scrollable content.
+   */
+  Rect frame;
+
+  /*
+   * The request of the image. Must be alive until `updateViewport` returns.
+   */
+  const ImageRequest* request;
+};
+
+/*
+ * Prioritizes loading and decoding of images which are about to become
+ * visible in scrollable areas.
+ * The velocity of each scrollable area is estimated from its successive
+ * viewports, and the viewport is extended in the direction of the scroll by
+ * the distance covered during `lookAheadTime` (bounded by `maxLookAhead`
+ * viewports). Images intersecting that look-ahead window are loaded with the
+ * `Visible` priority, before images which are farther away and are loaded
+ * with the `Offscreen` one.
+ * Can be called from any thread.
+ */
+class ImagePrefetcher final {
+ public:
+  ImagePrefetcher(Float lookAheadTime = 0.5, Float maxLookAhead = 2);
+
+  /*
+   * Updates the priorities of `candidates` for the new `viewport` of the
+   * scrollable area with `tag`, in the coordinate space of its content.
+   */
+  void updateViewport(
+      Tag tag,
+      Rect viewport,
+      const std::vector<ImagePrefetchCandidate>& candidates,
+      TelemetryTimePoint time = telemetryTimePointNow());
+
+  /*
+   * Forgets everything about the scrollable area with `tag`.
+   */
+  void removeScrollView(Tag tag);
+
+  /*
+   * Returns `viewport` extended in the direction of `velocity` (in points per
+   * second) by the distance covered during `lookAheadTime`, bounded by
+   * `maxLookAhead` viewports.
+   */
+  static Rect getLookAheadRect(
+      Rect viewport,
+      Point velocity,
+      Float lookAheadTime,
+      Float maxLookAhead);
+
+ private:
+  struct Priority {
+    std::weak_ptr<const ImageResponseObserverCoordinator> coordinator;
+    ImageRequestPriority priority;
+  };
+
+  struct ScrollView {
+    Rect viewport;
+    TelemetryTimePoint time;
+    std::unordered_map<const ImageResponseObserverCoordinator*, Priority>
+        priorities;
+  };
+
+  const Float lookAheadTime_;
+  const Float maxLookAhead_;
+
+  std::mutex mutex_;
+  std::unordered_map<Tag, ScrollView> scrollViews_;
+};
+
+} // namespace facebook::react
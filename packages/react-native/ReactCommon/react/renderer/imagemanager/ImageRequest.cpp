@@ -12,17 +12,35 @@ namespace facebook::react {
 ImageRequest::ImageRequest(
     ImageSource imageSource,
     std::shared_ptr<const ImageTelemetry> telemetry,
-    SharedFunction<> cancelationFunction)
+    AtomicSharedFunction<> cancelationFunction,
+    AtomicSharedFunction<ImageRequestPriority> priorityFunction)
     : imageSource_(std::move(imageSource)),
       telemetry_(std::move(telemetry)),
-      cancelRequest_(std::move(cancelationFunction)) {
+      cancelRequest_(std::move(cancelationFunction)),
+      setRequestPriority_(std::move(priorityFunction)) {
   coordinator_ = std::make_shared<ImageResponseObserverCoordinator>();
 }
 
+ImageRequest::ImageRequest(
+    ImageSource imageSource,
+    std::shared_ptr<const ImageTelemetry> telemetry,
+    std::shared_ptr<const ImageResponseObserverCoordinator> coordinator,
+    AtomicSharedFunction<> cancelationFunction,
+    AtomicSharedFunction<ImageRequestPriority> priorityFunction)
+    : imageSource_(std::move(imageSource)),
+      telemetry_(std::move(telemetry)),
+      coordinator_(std::move(coordinator)),
+      cancelRequest_(std::move(cancelationFunction)),
+      setRequestPriority_(std::move(priorityFunction)) {}
+
 void ImageRequest::cancel() const {
   cancelRequest_();
 }
 
+void ImageRequest::setPriority(ImageRequestPriority priority) const {
+  setRequestPriority_(priority);
+}
+
 const ImageSource& ImageRequest::getImageSource() const {
   return imageSource_;
 }
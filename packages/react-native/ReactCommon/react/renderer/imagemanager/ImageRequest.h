@@ -12,7 +12,7 @@
 #include <react/renderer/imagemanager/ImageResponseObserverCoordinator.h>
 #include <react/renderer/imagemanager/ImageTelemetry.h>
 #include <react/renderer/imagemanager/primitives.h>
-#include <react/utils/SharedFunction.h>
+#include <react/utils/AtomicSharedFunction.h>
 
 namespace facebook::react {
 
@@ -31,7 +31,20 @@ class ImageRequest final {
   ImageRequest(
       ImageSource imageSource,
       std::shared_ptr<const ImageTelemetry> telemetry,
-      SharedFunction<> cancelationFunction);
+      AtomicSharedFunction<> cancelationFunction,
+      AtomicSharedFunction<ImageRequestPriority> priorityFunction = {});
+
+  /*
+   * Constructs a request which shares the observer coordinator (and so the
+   * response) of another request for the same image, e.g. deduplicated by
+   * `ImageRequestDeduplicator`.
+   */
+  ImageRequest(
+      ImageSource imageSource,
+      std::shared_ptr<const ImageTelemetry> telemetry,
+      std::shared_ptr<const ImageResponseObserverCoordinator> coordinator,
+      AtomicSharedFunction<> cancelationFunction,
+      AtomicSharedFunction<ImageRequestPriority> priorityFunction = {});
 
   /*
    * The move constructor.
@@ -49,6 +62,13 @@ class ImageRequest final {
    */
   void cancel() const;
 
+  /*
+   * Calls priority function if one is defined. Should be called when the view
+   * displaying the image enters or leaves the viewport, so that loading and
+   * decoding of visible images is not queued behind offscreen ones.
+   */
+  void setPriority(ImageRequestPriority priority) const;
+
   /*
    * Returns the Image Source associated with the request.
    */
@@ -93,7 +113,12 @@ class ImageRequest final {
   /*
    * Function we can call to cancel image request.
    */
-  SharedFunction<> cancelRequest_;
+  AtomicSharedFunction<> cancelRequest_;
+
+  /*
+   * Function we can call to change the priority of image request.
+   */
+  AtomicSharedFunction<ImageRequestPriority> setRequestPriority_;
 };
 
 } // namespace facebook::react
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ImageRequestDeduplicator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+#include <react/utils/hash_combine.h>
+
+namespace facebook::react {
+
+/*
+ * A platform request shared by one or more requests.
+ */
+class ImageRequestDeduplicator::Load final {
+ public:
+  explicit Load(ImageRequest request) : request(std::move(request)) {}
+
+  bool isReusable() const {
+    return !cancelled &&
+        request.getObserverCoordinator().getStatus() !=
+        ImageResponse::Status::Failed;
+  }
+
+  void addRequest() {
+    activeRequests++;
+    visibleRequests++;
+  }
+
+  void removeRequest(bool wasVisible) {
+    if (wasVisible) {
+      updateVisibleRequests(-1);
+    }
+    // Completed loads are kept, as they may be shared by later requests.
+    if (--activeRequests == 0 &&
+        request.getObserverCoordinator().getStatus() !=
+            ImageResponse::Status::Completed) {
+      cancelled = true;
+      request.cancel();
+    }
+  }
+
+  void updateVisibleRequests(int delta) {
+    auto previous = visibleRequests.fetch_add(delta);
+    if (previous == 0 && delta > 0) {
+      request.setPriority(ImageRequestPriority::Visible);
+    } else if (previous + delta == 0) {
+      request.setPriority(ImageRequestPriority::Offscreen);
+    }
+  }
+
+  const ImageRequest request;
+  std::atomic<int> activeRequests{0};
+  std::atomic<int> visibleRequests{0};
+  std::atomic<bool> cancelled{false};
+};
+
+size_t ImageRequestDeduplicator::KeyHash::operator()(const Key& key) const {
+  return hash_combine(
+      static_cast<int>(key.type),
+      key.uri,
+      key.bundle,
+      key.scale,
+      key.size.width,
+      key.size.height);
+}
+
+static Float bucketDimension(Float dimension) {
+  if (!(dimension > 0) || std::isinf(dimension)) {
+    return dimension;
+  }
+  auto exponent = 0;
+  std::frexp(dimension, &exponent);
+  auto step = std::ldexp(Float{1}, exponent - 4);
+  return std::ceil(dimension / step) * step;
+}
+
+Size ImageRequestDeduplicator::bucketSize(Size size) {
+  return {bucketDimension(size.width), bucketDimension(size.height)};
+}
+
+ImageRequest ImageRequestDeduplicator::requestImage(
+    const ImageSource& imageSource,
+    SurfaceId surfaceId,
+    const Loader& loader) {
+  auto key = Key{
+      imageSource.type,
+      imageSource.uri,
+      imageSource.bundle,
+      imageSource.scale,
+      bucketSize(imageSource.size)};
+
+  {
+    std::scoped_lock lock(mutex_);
+    auto iterator = loads_.find(key);
+    if (iterator != loads_.end()) {
+      auto load = iterator->second.lock();
+      if (load && load->isReusable()) {
+        retainLoad(load);
+        return makeRequest(load, imageSource, surfaceId, true);
+      }
+      loads_.erase(iterator);
+    }
+  }
+
+  // Loading the image at the size of the bucket, which suits every request
+  // sharing the load.
+  auto bucketImageSource = imageSource;
+  bucketImageSource.size = key.size;
+
+  // The loader is called without holding the lock, so concurrent requests for
+  // the same new source may start separate loads; the last one is shared.
+  auto load = std::make_shared<Load>(loader(bucketImageSource, surfaceId));
+  auto request = makeRequest(load, imageSource, surfaceId, false);
+
+  std::scoped_lock lock(mutex_);
+  if (loads_.size() >= removeExpiredLoadsThreshold_) {
+    removeExpiredLoads();
+  }
+  loads_[key] = load;
+  retainLoad(load);
+  return request;
+}
+
+ImageRequest ImageRequestDeduplicator::makeRequest(
+    const std::shared_ptr<Load>& load,
+    const ImageSource& imageSource,
+    SurfaceId surfaceId,
+    bool isDeduplicated) const {
+  load->addRequest();
+
+  struct State {
+    std::atomic<bool> cancelled{false};
+    std::atomic<bool> visible{true};
+  };
+  auto state = std::make_shared<State>();
+
+  auto cancelationFunction = AtomicSharedFunction<>([load, state]() {
+    if (!state->cancelled.exchange(true)) {
+      load->removeRequest(state->visible);
+    }
+  });
+
+  auto priorityFunction =
+      AtomicSharedFunction<ImageRequestPriority>([load, state](auto priority) {
+        auto visible = priority == ImageRequestPriority::Visible;
+        if (state->cancelled || state->visible.exchange(visible) == visible) {
+          return;
+        }
+        load->updateVisibleRequests(visible ? 1 : -1);
+      });
+
+  auto telemetry = load->request.getSharedTelemetry();
+  if (isDeduplicated && telemetry) {
+    telemetry = std::make_shared<ImageTelemetry>(surfaceId, true);
+  }
+
+  return {
+      imageSource,
+      std::move(telemetry),
+      load->request.getSharedObserverCoordinator(),
+      std::move(cancelationFunction),
+      std::move(priorityFunction)};
+}
+
+void ImageRequestDeduplicator::retainLoad(const std::shared_ptr<Load>& load) {
+  auto iterator = std::find(retainedLoads_.begin(), retainedLoads_.end(), load);
+  if (iterator != retainedLoads_.end()) {
+    retainedLoads_.erase(iterator);
+  } else if (retainedLoads_.size() >= kMaxNumberOfRetainedLoads) {
+    retainedLoads_.erase(retainedLoads_.begin());
+  }
+  retainedLoads_.push_back(load);
+}
+
+void ImageRequestDeduplicator::removeExpiredLoads() {
+  for (auto iterator = loads_.begin(); iterator != loads_.end();) {
+    if (iterator->second.expired()) {
+      iterator = loads_.erase(iterator);
+    } else {
+      ++iterator;
+    }
+  }
+  removeExpiredLoadsThreshold_ = std::max<size_t>(64, loads_.size() * 2);
+}
+
+} // namespace facebook::react
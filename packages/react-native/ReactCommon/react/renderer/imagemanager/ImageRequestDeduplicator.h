@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <react/renderer/core/ReactPrimitives.h>
+#include <react/renderer/imagemanager/ImageRequest.h>
+#include <react/renderer/imagemanager/primitives.h>
+
+namespace facebook::react {
+
+/*
+ * Shares the loads of images between requests for equal image sources (e.g.
+ * avatars repeated in a list), so that the platform loader is called once
+ * per unique source and size while at least one of those requests is alive.
+ * Requests sharing a load share its observer coordinator and so its response,
+ * including a response which already completed. The shared load is cancelled
+ * when all of the requests sharing it are cancelled before it completes, and
+ * is loaded with the highest priority among them.
+ * Sizes are rounded up to buckets, so that requests for the same image laid
+ * out at slightly different sizes share a load (which loads the image at the
+ * size of the bucket). The most recently used completed loads are retained
+ * after all of their requests are gone, so an image is not loaded again when
+ * e.g. a list recycles the cell displaying it.
+ * Can be called from any thread.
+ */
+class ImageRequestDeduplicator final {
+ public:
+  using Loader =
+      std::function<ImageRequest(const ImageSource& imageSource, SurfaceId)>;
+
+  /*
+   * Returns a request for the given image source which shares the load of an
+   * earlier request for an equal source if it is still alive and didn't fail
+   * or get cancelled; otherwise, calls `loader` to start a new load.
+   * Telemetry of requests sharing a load reports them as deduplicated.
+   */
+  ImageRequest requestImage(
+      const ImageSource& imageSource,
+      SurfaceId surfaceId,
+      const Loader& loader);
+
+  /*
+   * Returns the size rounded up to the size bucket it belongs to: every
+   * dimension is rounded up to keep only its four most significant bits, so
+   * sizes are rounded up by less than 12.5%.
+   */
+  static Size bucketSize(Size size);
+
+ private:
+  constexpr static size_t kMaxNumberOfRetainedLoads = 32;
+
+  struct Key {
+    ImageSource::Type type;
+    std::string uri;
+    std::string bundle;
+    Float scale;
+    Size size;
+
+    bool operator==(const Key& rhs) const = default;
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  class Load;
+
+  ImageRequest makeRequest(
+      const std::shared_ptr<Load>& load,
+      const ImageSource& imageSource,
+      SurfaceId surfaceId,
+      bool isDeduplicated) const;
+
+  void removeExpiredLoads();
+
+  void retainLoad(const std::shared_ptr<Load>& load);
+
+  std::mutex mutex_;
+  std::unordered_map<Key, std::weak_ptr<Load>, KeyHash> loads_;
+  size_t removeExpiredLoadsThreshold_{64};
+
+  /*
+   * Most recently used loads, least recently used first.
+   */
+  std::vector<std::shared_ptr<Load>> retainedLoads_;
+};
+
+} // namespace facebook::react
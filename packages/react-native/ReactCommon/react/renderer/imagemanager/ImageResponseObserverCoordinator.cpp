@@ -13,12 +13,20 @@
 
 namespace facebook::react {
 
+ImageResponseObserverCoordinator::ImageResponseObserverCoordinator(
+    float progressGranularity)
+    : progressGranularity_(progressGranularity) {}
+
 void ImageResponseObserverCoordinator::addObserver(
     const ImageResponseObserver& observer) const {
   mutex_.lock();
-  switch (status_) {
+  switch (status_.load()) {
     case ImageResponse::Status::Loading: {
-      observers_.push_back(&observer);
+      auto observers =
+          observers_ ? std::make_shared<Observers>(*observers_)
+                     : std::make_shared<Observers>();
+      observers->push_back(&observer);
+      observers_ = std::move(observers);
       mutex_.unlock();
       break;
     }
@@ -40,22 +48,41 @@ void ImageResponseObserverCoordinator::addObserver(
 void ImageResponseObserverCoordinator::removeObserver(
     const ImageResponseObserver& observer) const {
   std::scoped_lock lock(mutex_);
+  if (!observers_) {
+    return;
+  }
 
   // We remove only one element to maintain a balance between add/remove calls.
-  auto position = std::find(observers_.begin(), observers_.end(), &observer);
-  if (position != observers_.end()) {
-    observers_.erase(position, observers_.end());
+  auto position = std::find(observers_->begin(), observers_->end(), &observer);
+  if (position != observers_->end()) {
+    auto observers = std::make_shared<Observers>(*observers_);
+    observers->erase(observers->begin() + (position - observers_->begin()));
+    observers_ = std::move(observers);
   }
 }
 
 void ImageResponseObserverCoordinator::nativeImageResponseProgress(
     float progress) const {
-  mutex_.lock();
-  auto observers = observers_;
-  react_native_assert(status_ == ImageResponse::Status::Loading);
-  mutex_.unlock();
+  auto status = status_.load(std::memory_order_relaxed);
+  react_native_assert(status == ImageResponse::Status::Loading);
+  if (status != ImageResponse::Status::Loading) {
+    return;
+  }
+
+  auto lastProgress = lastProgress_.load(std::memory_order_relaxed);
+  do {
+    if (progress < 1 && progress - lastProgress < progressGranularity_) {
+      return;
+    }
+  } while (!lastProgress_.compare_exchange_weak(
+      lastProgress, progress, std::memory_order_relaxed));
+
+  auto observers = getObservers();
+  if (!observers) {
+    return;
+  }
 
-  for (auto observer : observers) {
+  for (auto observer : *observers) {
     observer->didReceiveProgress(progress);
   }
 }
@@ -70,7 +97,11 @@ void ImageResponseObserverCoordinator::nativeImageResponseComplete(
   auto observers = observers_;
   mutex_.unlock();
 
-  for (auto observer : observers_) {
+  if (!observers) {
+    return;
+  }
+
+  for (auto observer : *observers) {
     observer->didReceiveImage(imageResponse);
   }
 }
@@ -82,9 +113,23 @@ void ImageResponseObserverCoordinator::nativeImageResponseFailed() const {
   auto observers = observers_;
   mutex_.unlock();
 
-  for (auto observer : observers) {
+  if (!observers) {
+    return;
+  }
+
+  for (auto observer : *observers) {
     observer->didReceiveFailure();
   }
 }
 
+ImageResponse::Status ImageResponseObserverCoordinator::getStatus() const {
+  return status_.load();
+}
+
+std::shared_ptr<const ImageResponseObserverCoordinator::Observers>
+ImageResponseObserverCoordinator::getObservers() const {
+  std::scoped_lock lock(mutex_);
+  return observers_;
+}
+
 } // namespace facebook::react
@@ -10,6 +10,8 @@
 #include <react/renderer/imagemanager/ImageResponse.h>
 #include <react/renderer/imagemanager/ImageResponseObserver.h>
 
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <vector>
 
@@ -20,9 +22,20 @@ namespace facebook::react {
  * data from native image loaders and sends events to any observers attached
  * to the coordinator. The Coordinator also keeps track of response status
  * and caches completed images.
+ * The list of observers is copied on write, so notifying observers neither
+ * copies it nor holds a lock while observers are called; progress updates
+ * smaller than the progress granularity are dropped without taking a lock.
  */
 class ImageResponseObserverCoordinator {
  public:
+  /*
+   * Progress updates are delivered to observers only when the progress grew
+   * by at least `progressGranularity` since the last delivered update, or
+   * when the progress is complete.
+   */
+  explicit ImageResponseObserverCoordinator(
+      float progressGranularity = 0.01f);
+
   /*
    * Interested parties may observe the image response.
    * If the current image request status is not equal to `Loading`, the observer
@@ -52,18 +65,41 @@ class ImageResponseObserverCoordinator {
    */
   void nativeImageResponseFailed() const;
 
+  /*
+   * Returns the current status of image loading.
+   */
+  ImageResponse::Status getStatus() const;
+
  private:
+  using Observers = std::vector<const ImageResponseObserver*>;
+
   /*
-   * List of observers.
+   * Returns the current snapshot of the list of observers.
+   */
+  std::shared_ptr<const Observers> getObservers() const;
+
+  /*
+   * Snapshot of the list of observers, replaced (never mutated) on writes.
    * Mutable: protected by mutex_.
    */
-  mutable std::vector<const ImageResponseObserver*> observers_;
+  mutable std::shared_ptr<const Observers> observers_;
 
   /*
    * Current status of image loading.
-   * Mutable: protected by mutex_.
+   * Mutable: written under mutex_, can be read without it.
+   */
+  mutable std::atomic<ImageResponse::Status> status_{
+      ImageResponse::Status::Loading};
+
+  /*
+   * Minimal growth of progress between delivered progress updates.
+   */
+  const float progressGranularity_;
+
+  /*
+   * The last progress delivered to observers.
    */
-  mutable ImageResponse::Status status_{ImageResponse::Status::Loading};
+  mutable std::atomic<float> lastProgress_{0};
 
   /*
    * Cache image data.
@@ -78,7 +114,7 @@ class ImageResponseObserverCoordinator {
   mutable std::shared_ptr<void> imageMetadata_;
 
   /*
-   * Observer and data mutex.
+   * Observer list and data mutex.
    */
   mutable std::mutex mutex_;
 };
@@ -17,4 +17,8 @@ TelemetryTimePoint ImageTelemetry::getWillRequestUrlTime() const {
   return willRequestUrlTime_;
 }
 
+bool ImageTelemetry::isDeduplicated() const {
+  return isDeduplicated_;
+}
+
 } // namespace facebook::react
@@ -18,7 +18,8 @@ namespace facebook::react {
  */
 class ImageTelemetry final {
  public:
-  ImageTelemetry(const SurfaceId surfaceId) : surfaceId_(surfaceId) {
+  ImageTelemetry(const SurfaceId surfaceId, bool isDeduplicated = false)
+      : surfaceId_(surfaceId), isDeduplicated_(isDeduplicated) {
     willRequestUrlTime_ = telemetryTimePointNow();
   }
 
@@ -26,10 +27,18 @@ class ImageTelemetry final {
 
   SurfaceId getSurfaceId() const;
 
+  /*
+   * Whether the request shares the load of an earlier request for the same
+   * image instead of loading it on its own.
+   */
+  bool isDeduplicated() const;
+
  private:
   TelemetryTimePoint willRequestUrlTime_;
 
   const SurfaceId surfaceId_;
+
+  const bool isDeduplicated_;
 };
 
 } // namespace facebook::react
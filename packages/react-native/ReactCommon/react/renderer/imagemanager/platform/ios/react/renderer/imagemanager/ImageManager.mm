@@ -9,6 +9,7 @@
 
 #import <React/RCTImageLoaderWithAttributionProtocol.h>
 #import <React/RCTUtils.h>
+#import <react/utils/CoreFeatures.h>
 #import <react/utils/ManagedObjectWrapper.h>
 
 #import "RCTImageManager.h"
@@ -37,7 +38,13 @@ ImageManager::~ImageManager()
 ImageRequest ImageManager::requestImage(const ImageSource &imageSource, SurfaceId surfaceId) const
 {
   RCTImageManager *imageManager = (__bridge RCTImageManager *)self_;
-  return [imageManager requestImage:imageSource surfaceId:surfaceId];
+  if (!CoreFeatures::enableImageRequestDeduplication) {
+    return [imageManager requestImage:imageSource surfaceId:surfaceId];
+  }
+  return deduplicator_.requestImage(
+      imageSource, surfaceId, [imageManager](const ImageSource &imageSource, SurfaceId surfaceId) {
+        return [imageManager requestImage:imageSource surfaceId:surfaceId];
+      });
 }
 
 } // namespace facebook::react
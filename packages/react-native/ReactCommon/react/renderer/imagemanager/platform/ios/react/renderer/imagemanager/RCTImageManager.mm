@@ -8,8 +8,8 @@
 #import "RCTImageManager.h"
 
 #import <react/renderer/debug/SystraceSection.h>
+#import <react/utils/AtomicSharedFunction.h>
 #import <react/utils/ManagedObjectWrapper.h>
-#import <react/utils/SharedFunction.h>
 
 #import <React/RCTImageLoaderWithAttributionProtocol.h>
 
@@ -48,8 +48,9 @@ using namespace facebook::react;
     telemetry = nullptr;
   }
 
-  auto sharedCancelationFunction = SharedFunction<>();
-  auto imageRequest = ImageRequest(imageSource, telemetry, sharedCancelationFunction);
+  auto sharedCancelationFunction = AtomicSharedFunction<>();
+  auto sharedPriorityFunction = AtomicSharedFunction<ImageRequestPriority>();
+  auto imageRequest = ImageRequest(imageSource, telemetry, sharedCancelationFunction, sharedPriorityFunction);
   auto weakObserverCoordinator =
       (std::weak_ptr<const ImageResponseObserverCoordinator>)imageRequest.getSharedObserverCoordinator();
 
@@ -102,6 +103,15 @@ using namespace facebook::react;
                                     completionBlock:completionBlock];
     RCTImageLoaderCancellationBlock cancelationBlock = loaderRequest.cancellationBlock;
     sharedCancelationFunction.assign([cancelationBlock]() { cancelationBlock(); });
+
+    id<RCTImageLoaderWithAttributionProtocol> imageLoader = self->_imageLoader;
+    if ([imageLoader respondsToSelector:@selector(setPriority:forRequest:)]) {
+      sharedPriorityFunction.assign([imageLoader, loaderRequest](ImageRequestPriority priority) {
+        [imageLoader setPriority:priority == ImageRequestPriority::Visible ? RCTImageLoaderPriorityImmediate
+                                                                            : RCTImageLoaderPriorityPrefetch
+                      forRequest:loaderRequest];
+      });
+    }
   });
 
   return imageRequest;
@@ -7,8 +7,8 @@
 
 #import "RCTSyncImageManager.h"
 
+#import <react/utils/AtomicSharedFunction.h>
 #import <react/utils/ManagedObjectWrapper.h>
-#import <react/utils/SharedFunction.h>
 
 #import <React/RCTAssert.h>
 #import <React/RCTImageLoaderWithAttributionProtocol.h>
@@ -37,7 +37,7 @@ using namespace facebook::react;
 - (ImageRequest)requestImage:(ImageSource)imageSource surfaceId:(SurfaceId)surfaceId
 {
   auto telemetry = std::make_shared<ImageTelemetry>(surfaceId);
-  auto sharedCancelationFunction = SharedFunction<>();
+  auto sharedCancelationFunction = AtomicSharedFunction<>();
   auto imageRequest = ImageRequest(imageSource, telemetry, sharedCancelationFunction);
   auto weakObserverCoordinator =
       (std::weak_ptr<const ImageResponseObserverCoordinator>)imageRequest.getSharedObserverCoordinator();
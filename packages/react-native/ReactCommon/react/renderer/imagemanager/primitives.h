@@ -36,6 +36,15 @@ class ImageSource {
 
 using ImageSources = std::vector<ImageSource>;
 
+/*
+ * Priority of an image request, updated by the mounting layer as the view
+ * displaying the image enters or leaves the viewport.
+ */
+enum class ImageRequestPriority {
+  Visible,
+  Offscreen,
+};
+
 enum class ImageResizeMode {
   Cover,
   Contain,
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/imagemanager/ImagePrefetcher.h>
+
+using namespace facebook::react;
+
+namespace {
+
+class ImagePrefetcherTest : public ::testing::Test {
+ protected:
+  void addImage(Float y) {
+    auto index = priorities_.size();
+    priorities_.push_back(ImageRequestPriority::Visible);
+    requests_.push_back(std::make_unique<ImageRequest>(
+        ImageSource{},
+        nullptr,
+        AtomicSharedFunction<>{},
+        AtomicSharedFunction<ImageRequestPriority>(
+            [this, index](ImageRequestPriority priority) {
+              priorities_[index] = priority;
+            })));
+    candidates_.push_back({{{0, y}, {100, 100}}, requests_.back().get()});
+  }
+
+  void scrollTo(Float y, int milliseconds) {
+    prefetcher_.updateViewport(
+        1,
+        {{0, y}, {100, 100}},
+        candidates_,
+        TelemetryTimePoint{std::chrono::milliseconds(milliseconds)});
+  }
+
+  ImagePrefetcher prefetcher_{0.5, 2};
+  std::vector<std::unique_ptr<ImageRequest>> requests_;
+  std::vector<ImagePrefetchCandidate> candidates_;
+  std::vector<ImageRequestPriority> priorities_;
+};
+
+} // namespace
+
+TEST_F(ImagePrefetcherTest, extendsViewportInDirectionOfVelocity) {
+  auto viewport = Rect{{0, 100}, {100, 100}};
+
+  EXPECT_EQ(
+      ImagePrefetcher::getLookAheadRect(viewport, {0, 100}, 0.5, 2),
+      (Rect{{0, 100}, {100, 150}}));
+  EXPECT_EQ(
+      ImagePrefetcher::getLookAheadRect(viewport, {0, -100}, 0.5, 2),
+      (Rect{{0, 50}, {100, 150}}));
+  // The look-ahead distance is bounded by the size of the viewport.
+  EXPECT_EQ(
+      ImagePrefetcher::getLookAheadRect(viewport, {10000, 0}, 0.5, 2),
+      (Rect{{0, 100}, {300, 100}}));
+}
+
+TEST_F(ImagePrefetcherTest, prioritizesImagesAheadOfScroll) {
+  for (auto y : {0, 150, 300, 450}) {
+    addImage(y);
+  }
+
+  scrollTo(0, 0);
+  EXPECT_EQ(priorities_[0], ImageRequestPriority::Visible);
+  EXPECT_EQ(priorities_[1], ImageRequestPriority::Offscreen);
+  EXPECT_EQ(priorities_[2], ImageRequestPriority::Offscreen);
+
+  // Scrolling down at 500 points per second looks 250 points ahead.
+  scrollTo(50, 100);
+  EXPECT_EQ(priorities_[0], ImageRequestPriority::Visible);
+  EXPECT_EQ(priorities_[1], ImageRequestPriority::Visible);
+  EXPECT_EQ(priorities_[2], ImageRequestPriority::Visible);
+  EXPECT_EQ(priorities_[3], ImageRequestPriority::Offscreen);
+
+  // After a long pause, the velocity is not known.
+  scrollTo(50, 1000);
+  EXPECT_EQ(priorities_[2], ImageRequestPriority::Offscreen);
+}
+
+TEST_F(ImagePrefetcherTest, skipsCompletedImages) {
+  addImage(300);
+  requests_[0]->getObserverCoordinator().nativeImageResponseComplete(
+      ImageResponse{nullptr, nullptr});
+
+  scrollTo(0, 0);
+  EXPECT_EQ(priorities_[0], ImageRequestPriority::Visible);
+}
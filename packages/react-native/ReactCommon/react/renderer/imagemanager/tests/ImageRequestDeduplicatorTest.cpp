@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/imagemanager/ImageRequestDeduplicator.h>
+
+using namespace facebook::react;
+
+namespace {
+
+class ImageRequestDeduplicatorTest : public ::testing::Test {
+ protected:
+  ImageRequest requestImage(const std::string& uri, Size size = {}) {
+    auto imageSource = ImageSource{};
+    imageSource.type = ImageSource::Type::Remote;
+    imageSource.uri = uri;
+    imageSource.size = size;
+    return deduplicator_.requestImage(
+        imageSource, 1, [this](const ImageSource& imageSource, SurfaceId) {
+          loads_++;
+          loadedSizes_.push_back(imageSource.size);
+          auto index = priorities_.size();
+          priorities_.push_back(ImageRequestPriority::Visible);
+          cancellations_.push_back(false);
+          return ImageRequest{
+              imageSource,
+              std::make_shared<const ImageTelemetry>(1),
+              AtomicSharedFunction<>([this, index]() {
+                cancellations_[index] = true;
+              }),
+              AtomicSharedFunction<ImageRequestPriority>(
+                  [this, index](ImageRequestPriority priority) {
+                    priorities_[index] = priority;
+                  })};
+        });
+  }
+
+  ImageRequestDeduplicator deduplicator_;
+  int loads_{0};
+  std::vector<Size> loadedSizes_;
+  std::vector<ImageRequestPriority> priorities_;
+  std::vector<bool> cancellations_;
+};
+
+} // namespace
+
+TEST_F(ImageRequestDeduplicatorTest, sharesLoadsOfEqualSources) {
+  auto first = requestImage("a");
+  auto second = requestImage("a");
+  auto third = requestImage("b");
+
+  EXPECT_EQ(loads_, 2);
+  EXPECT_EQ(
+      first.getSharedObserverCoordinator(),
+      second.getSharedObserverCoordinator());
+  EXPECT_NE(
+      first.getSharedObserverCoordinator(),
+      third.getSharedObserverCoordinator());
+  EXPECT_FALSE(first.getSharedTelemetry()->isDeduplicated());
+  EXPECT_TRUE(second.getSharedTelemetry()->isDeduplicated());
+}
+
+TEST_F(ImageRequestDeduplicatorTest, cancelsLoadWhenAllRequestsCancel) {
+  auto first = requestImage("a");
+  auto second = requestImage("a");
+
+  first.cancel();
+  first.cancel();
+  EXPECT_FALSE(cancellations_[0]);
+  second.cancel();
+  EXPECT_TRUE(cancellations_[0]);
+
+  // Cancelled loads are not shared anymore.
+  auto third = requestImage("a");
+  EXPECT_EQ(loads_, 2);
+}
+
+TEST_F(ImageRequestDeduplicatorTest, doesNotShareFailedLoads) {
+  auto first = requestImage("a");
+  first.getObserverCoordinator().nativeImageResponseFailed();
+
+  auto second = requestImage("a");
+  EXPECT_EQ(loads_, 2);
+}
+
+TEST_F(ImageRequestDeduplicatorTest, loadsWithHighestPriorityOfRequests) {
+  auto first = requestImage("a");
+  auto second = requestImage("a");
+
+  first.setPriority(ImageRequestPriority::Offscreen);
+  EXPECT_EQ(priorities_[0], ImageRequestPriority::Visible);
+  second.setPriority(ImageRequestPriority::Offscreen);
+  EXPECT_EQ(priorities_[0], ImageRequestPriority::Offscreen);
+  first.setPriority(ImageRequestPriority::Visible);
+  EXPECT_EQ(priorities_[0], ImageRequestPriority::Visible);
+}
+
+TEST_F(ImageRequestDeduplicatorTest, sharesLoadsOfSizesInTheSameBucket) {
+  auto first = requestImage("a", {100, 50});
+  auto second = requestImage("a", {103, 52});
+  auto third = requestImage("a", {120, 50});
+
+  EXPECT_EQ(loads_, 2);
+  EXPECT_EQ(
+      first.getSharedObserverCoordinator(),
+      second.getSharedObserverCoordinator());
+  // Images are loaded at the size of the bucket, which fits every request.
+  EXPECT_EQ(loadedSizes_[0], (Size{104, 52}));
+  EXPECT_EQ(loadedSizes_[1], (Size{120, 52}));
+  EXPECT_EQ(first.getImageSource().size, (Size{100, 50}));
+}
+
+TEST_F(ImageRequestDeduplicatorTest, sharesCompletedLoadsAfterRelease) {
+  {
+    auto first = requestImage("a");
+    first.getObserverCoordinator().nativeImageResponseComplete(
+        ImageResponse{nullptr, nullptr});
+    first.cancel();
+  }
+  EXPECT_FALSE(cancellations_[0]);
+
+  // E.g. a recycled list cell displays the image again.
+  auto second = requestImage("a");
+  EXPECT_EQ(loads_, 1);
+  EXPECT_EQ(
+      second.getObserverCoordinator().getStatus(),
+      ImageResponse::Status::Completed);
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/imagemanager/ImageResponseObserverCoordinator.h>
+
+using namespace facebook::react;
+
+namespace {
+
+class TestObserver final : public ImageResponseObserver {
+ public:
+  void didReceiveProgress(float progress) const override {
+    progresses.push_back(progress);
+  }
+
+  void didReceiveImage(const ImageResponse& /*imageResponse*/) const override {
+    images++;
+  }
+
+  void didReceiveFailure() const override {
+    failures++;
+  }
+
+  mutable std::vector<float> progresses;
+  mutable int images{0};
+  mutable int failures{0};
+};
+
+} // namespace
+
+TEST(ImageResponseObserverCoordinatorTest, throttlesProgress) {
+  auto coordinator = ImageResponseObserverCoordinator{0.1f};
+  auto observer = TestObserver{};
+  coordinator.addObserver(observer);
+
+  for (auto progress : {0.05f, 0.1f, 0.15f, 0.3f, 0.35f, 1.0f}) {
+    coordinator.nativeImageResponseProgress(progress);
+  }
+
+  EXPECT_EQ(observer.progresses, (std::vector<float>{0.1f, 0.3f, 1.0f}));
+}
+
+TEST(ImageResponseObserverCoordinatorTest, removesOneObserver) {
+  auto coordinator = ImageResponseObserverCoordinator{0};
+  auto first = TestObserver{};
+  auto second = TestObserver{};
+  coordinator.addObserver(first);
+  coordinator.addObserver(second);
+  coordinator.addObserver(first);
+  coordinator.removeObserver(first);
+
+  coordinator.nativeImageResponseProgress(0.5f);
+  EXPECT_EQ(first.progresses.size(), 1);
+  EXPECT_EQ(second.progresses.size(), 1);
+}
+
+TEST(ImageResponseObserverCoordinatorTest, notifiesLateObservers) {
+  auto coordinator = ImageResponseObserverCoordinator{};
+  auto early = TestObserver{};
+  coordinator.addObserver(early);
+  coordinator.nativeImageResponseComplete(ImageResponse{nullptr, nullptr});
+  EXPECT_EQ(coordinator.getStatus(), ImageResponse::Status::Completed);
+
+  auto late = TestObserver{};
+  coordinator.addObserver(late);
+  EXPECT_EQ(early.images, 1);
+  EXPECT_EQ(late.images, 1);
+}
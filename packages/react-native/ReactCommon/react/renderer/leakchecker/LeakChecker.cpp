@@ -10,16 +10,50 @@
 #include <glog/logging.h>
 #include <jsi/instrumentation.h>
 
+#include <algorithm>
 #include <utility>
 
 namespace facebook::react {
 
+// Sampling decisions use the upper bits of a multiplicative (Fibonacci) hash
+// of the sequence number of created families, which spreads any fraction
+// evenly over consecutive families without a random number generator.
+static constexpr uint64_t kFibonacciHashMultiplier = 0x9E3779B97F4A7C15;
+static constexpr uint64_t kSamplingRange = uint64_t{1} << 32;
+
+static uint32_t samplingThresholdForRate(double samplingRate) {
+  if (!(samplingRate > 0)) {
+    return 0;
+  }
+  return static_cast<uint32_t>(std::min(
+      static_cast<double>(kSamplingRange - 1),
+      samplingRate * static_cast<double>(kSamplingRange)));
+}
+
 LeakChecker::LeakChecker(RuntimeExecutor runtimeExecutor)
-    : runtimeExecutor_(std::move(runtimeExecutor)) {}
+    : LeakChecker(std::move(runtimeExecutor), Options{}) {}
+
+LeakChecker::LeakChecker(RuntimeExecutor runtimeExecutor, Options options)
+    : runtimeExecutor_(std::move(runtimeExecutor)),
+      options_(std::move(options)),
+      samplingThreshold_(samplingThresholdForRate(options_.samplingRate)) {}
+
+bool LeakChecker::shouldTrackNextFamily() const {
+  if (options_.samplingRate >= 1) {
+    return true;
+  }
+  auto sequenceNumber =
+      numberOfCreatedFamilies_.fetch_add(1, std::memory_order_relaxed);
+  auto hash = static_cast<uint32_t>(
+      (sequenceNumber * kFibonacciHashMultiplier) >> 32);
+  return hash < samplingThreshold_;
+}
 
 void LeakChecker::uiManagerDidCreateShadowNodeFamily(
     const ShadowNodeFamily::Shared& shadowNodeFamily) const {
-  registry_.add(shadowNodeFamily);
+  if (shouldTrackNextFamily()) {
+    registry_.add(shadowNodeFamily);
+  }
 }
 
 void LeakChecker::stopSurface(SurfaceId surfaceId) {
@@ -28,7 +62,9 @@ void LeakChecker::stopSurface(SurfaceId surfaceId) {
     // cleanup code has had chance to run.
     runtimeExecutor_([previouslyStoppedSurface = previouslyStoppedSurface_,
                       this](jsi::Runtime& runtime) {
-      runtime.instrumentation().collectGarbage("LeakChecker");
+      if (options_.collectGarbage) {
+        runtime.instrumentation().collectGarbage("LeakChecker");
+      }
       // For now check the previous surface because React uses double
       // buffering which keeps the surface that was just stopped in
       // memory. This is a documented problem in the last point of
@@ -41,20 +77,27 @@ void LeakChecker::stopSurface(SurfaceId surfaceId) {
 }
 
 void LeakChecker::checkSurfaceForLeaks(SurfaceId surfaceId) const {
-  auto weakFamilies = registry_.weakFamiliesForSurfaceId(surfaceId);
-  unsigned int numberOfLeaks = 0;
+  auto weakFamilies = registry_.takeFamiliesWithSurfaceId(surfaceId);
+  auto leakedFamilies = std::vector<LeakedFamily>{};
   for (const auto& weakFamily : weakFamilies) {
     auto strong = weakFamily.lock();
     if (strong) {
-      ++numberOfLeaks;
+      leakedFamilies.push_back(
+          {strong->getSurfaceId(), strong->getComponentName()});
     }
   }
-  if (numberOfLeaks > 0) {
+
+  if (options_.reporter) {
+    options_.reporter(surfaceId, weakFamilies.size(), leakedFamilies);
+    return;
+  }
+
+  if (!leakedFamilies.empty()) {
     LOG(ERROR) << "[LeakChecker] Surface with id: " << surfaceId
-               << " has leaked " << numberOfLeaks << " components out of "
-               << weakFamilies.size();
+               << " has leaked " << leakedFamilies.size()
+               << " components out of " << weakFamilies.size()
+               << ", e.g. " << leakedFamilies.front().componentName;
   }
-  registry_.removeFamiliesWithSurfaceId(surfaceId);
 }
 
 } // namespace facebook::react
@@ -11,6 +11,9 @@
 #include <react/renderer/core/ReactPrimitives.h>
 #include <react/renderer/core/ShadowNodeFamily.h>
 #include <react/renderer/leakchecker/WeakFamilyRegistry.h>
+
+#include <atomic>
+#include <functional>
 #include <vector>
 
 namespace facebook::react {
@@ -19,18 +22,65 @@ using GarbageCollectionTrigger = std::function<void()>;
 
 class LeakChecker final {
  public:
+  /*
+   * A family which is still alive after its surface was stopped.
+   */
+  struct LeakedFamily {
+    SurfaceId surfaceId;
+    ComponentName componentName;
+  };
+
+  /*
+   * Receives the results of checking a stopped surface:
+   * `numberOfCheckedFamilies` tracked families of which `leakedFamilies` are
+   * still alive. Called on the JavaScript thread.
+   */
+  using LeakReporter = std::function<void(
+      SurfaceId surfaceId,
+      size_t numberOfCheckedFamilies,
+      const std::vector<LeakedFamily>& leakedFamilies)>;
+
+  /*
+   * Key of an optional `LeakReporter` in `ContextContainer`, used to forward
+   * leaks to telemetry. Leaks are logged if there's none.
+   */
+  static constexpr auto kLeakReporterKey = "LeakCheckerReporter";
+
+  struct Options {
+    /*
+     * Fraction of families which are tracked, within [0, 1]. Whether a family
+     * is tracked is decided when it's created.
+     */
+    double samplingRate{1};
+
+    /*
+     * Whether to collect garbage of the JavaScript runtime before a check,
+     * which avoids reporting families only referenced by garbage but is too
+     * expensive outside of development.
+     */
+    bool collectGarbage{true};
+
+    LeakReporter reporter{};
+  };
+
   LeakChecker(RuntimeExecutor runtimeExecutor);
+  LeakChecker(RuntimeExecutor runtimeExecutor, Options options);
 
   void uiManagerDidCreateShadowNodeFamily(
       const ShadowNodeFamily::Shared& shadowNodeFamily) const;
   void stopSurface(SurfaceId surfaceId);
 
  private:
+  bool shouldTrackNextFamily() const;
   void checkSurfaceForLeaks(SurfaceId surfaceId) const;
 
   const RuntimeExecutor runtimeExecutor_{};
+  const Options options_;
+  // Families are tracked if the hash of their sequence number is below it.
+  const uint32_t samplingThreshold_;
 
   WeakFamilyRegistry registry_{};
+  mutable std::atomic<uint64_t> numberOfCreatedFamilies_{0};
   SurfaceId previouslyStoppedSurface_{};
 };
 
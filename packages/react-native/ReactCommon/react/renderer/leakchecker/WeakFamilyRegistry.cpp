@@ -7,6 +7,8 @@
 
 #include "WeakFamilyRegistry.h"
 
+#include <utility>
+
 namespace facebook::react {
 
 void WeakFamilyRegistry::add(
@@ -16,19 +18,16 @@ void WeakFamilyRegistry::add(
   families_[shadowNodeFamily->getSurfaceId()].push_back(weakFamily);
 }
 
-void WeakFamilyRegistry::removeFamiliesWithSurfaceId(
-    SurfaceId surfaceId) const {
-  std::scoped_lock lock(familiesMutex_);
-  families_.erase(surfaceId);
-}
-
-WeakFamilyRegistry::WeakFamilies WeakFamilyRegistry::weakFamiliesForSurfaceId(
-    SurfaceId surfaceId) const {
+WeakFamilyRegistry::WeakFamilies
+WeakFamilyRegistry::takeFamiliesWithSurfaceId(SurfaceId surfaceId) const {
   std::scoped_lock lock(familiesMutex_);
-  if (families_.find(surfaceId) != families_.end()) {
-    return families_[surfaceId];
+  auto iterator = families_.find(surfaceId);
+  if (iterator == families_.end()) {
+    return {};
   }
-  return {};
+  auto weakFamilies = std::move(iterator->second);
+  families_.erase(iterator);
+  return weakFamilies;
 }
 
 } // namespace facebook::react
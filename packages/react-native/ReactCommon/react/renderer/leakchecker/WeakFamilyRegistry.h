@@ -9,6 +9,7 @@
 
 #include <react/renderer/core/ReactPrimitives.h>
 #include <react/renderer/core/ShadowNodeFamily.h>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -19,8 +20,11 @@ class WeakFamilyRegistry final {
   using WeakFamilies = std::vector<ShadowNodeFamily::Weak>;
 
   void add(const ShadowNodeFamily::Shared& shadowNodeFamily) const;
-  void removeFamiliesWithSurfaceId(SurfaceId surfaceId) const;
-  WeakFamilies weakFamiliesForSurfaceId(SurfaceId surfaceId) const;
+
+  /*
+   * Removes families used on the surface from the registry and returns them.
+   */
+  WeakFamilies takeFamiliesWithSurfaceId(SurfaceId surfaceId) const;
 
  private:
   /**
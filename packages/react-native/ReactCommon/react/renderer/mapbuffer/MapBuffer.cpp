@@ -7,6 +7,8 @@
 
 #include "MapBuffer.h"
 
+#include <algorithm>
+
 using namespace facebook::react;
 
 namespace facebook::react {
@@ -32,14 +34,38 @@ MapBuffer::MapBuffer(std::vector<uint8_t> data) : bytes_(std::move(data)) {
   }
 }
 
+MapBuffer::Key MapBuffer::getKey(int32_t bucketIndex) const {
+  return *reinterpret_cast<const Key*>(
+      bytes_.data() + bucketOffset(bucketIndex));
+}
+
 int32_t MapBuffer::getKeyBucket(Key key) const {
-  int32_t lo = 0;
-  int32_t hi = count_ - 1;
+  if (count_ == 0) {
+    return -1;
+  }
+
+  // Keys are sorted and unique, so the bucket of a key can't be more than
+  // `key - firstKey` buckets after the first one, and is exactly there if the
+  // keys are dense.
+  Key firstKey = getKey(0);
+  if (key < firstKey) {
+    return -1;
+  }
+  int32_t hi = std::min<int32_t>(count_ - 1, key - firstKey);
+  Key hiVal = getKey(hi);
+  if (hiVal == key) {
+    return hi;
+  }
+  if (hiVal < key) {
+    return -1;
+  }
+
+  int32_t lo = 1;
+  hi = hi - 1;
   while (lo <= hi) {
     int32_t mid = (lo + hi) >> 1;
 
-    Key midVal =
-        *reinterpret_cast<const Key*>(bytes_.data() + bucketOffset(mid));
+    Key midVal = getKey(mid);
 
     if (midVal < key) {
       lo = mid + 1;
@@ -79,17 +105,17 @@ int32_t MapBuffer::getDynamicDataOffset() const {
   return bucketOffset(count_);
 }
 
-std::string MapBuffer::getString(Key key) const {
+std::string_view MapBuffer::getString(Key key) const {
   // TODO T83483191:Add checks to verify that offsets are under the boundaries
   // of the map buffer
   int32_t dynamicDataOffset = getDynamicDataOffset();
   int32_t offset = getInt(key);
   int32_t stringLength = *reinterpret_cast<const int32_t*>(
       bytes_.data() + dynamicDataOffset + offset);
-  const uint8_t* stringPtr =
-      bytes_.data() + dynamicDataOffset + offset + sizeof(int);
+  const auto* stringPtr = reinterpret_cast<const char*>(
+      bytes_.data() + dynamicDataOffset + offset + sizeof(int));
 
-  return {stringPtr, stringPtr + stringLength};
+  return {stringPtr, static_cast<size_t>(stringLength)};
 }
 
 MapBuffer MapBuffer::getMapBuffer(Key key) const {
@@ -136,6 +162,19 @@ std::vector<MapBuffer> MapBuffer::getMapBufferList(MapBuffer::Key key) const {
   return mapBufferList;
 }
 
+bool MapBuffer::contains(Key key) const {
+  return getKeyBucket(key) != -1;
+}
+
+MapBuffer::DataType MapBuffer::getType(Key key) const {
+  auto bucketIndex = getKeyBucket(key);
+  react_native_assert(bucketIndex != -1 && "Key not found in MapBuffer");
+
+  return static_cast<DataType>(*reinterpret_cast<const uint16_t*>(
+      bytes_.data() + bucketOffset(bucketIndex) +
+      offsetof(MapBuffer::Bucket, type)));
+}
+
 size_t MapBuffer::size() const {
   return bytes_.size();
 }
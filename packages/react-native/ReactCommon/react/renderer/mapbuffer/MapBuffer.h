@@ -15,6 +15,7 @@
 #include <cstdlib>
 #include <limits>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace facebook::react {
@@ -61,6 +62,11 @@ class JReadableMapBuffer;
  * │  associated byte in the array. The format of the data is not restricted, but common    │
  * │  practice is to use [length | bytes].                                                  │
  * └────────────────────────────────────────────────────────────────────────────────────────┘
+ *
+ * Buckets are sorted by key, and keys are unique. When the keys are a dense range (which is
+ * the case for most props, text attributes and state), the bucket of each key is at index
+ * `key - firstKey`, so readers find it without searching. Readers fall back to a binary
+ * search bounded by that index for sparse keys.
  */
 
 // clang-format on
@@ -122,13 +128,21 @@ class MapBuffer {
 
   double getDouble(MapBuffer::Key key) const;
 
-  std::string getString(MapBuffer::Key key) const;
+  /**
+   * Returns the string stored for the key without copying it. The view is
+   * valid as long as the MapBuffer is.
+   */
+  std::string_view getString(MapBuffer::Key key) const;
 
   // TODO T83483191: review this declaration
   MapBuffer getMapBuffer(MapBuffer::Key key) const;
 
   std::vector<MapBuffer> getMapBufferList(MapBuffer::Key key) const;
 
+  bool contains(MapBuffer::Key key) const;
+
+  DataType getType(MapBuffer::Key key) const;
+
   size_t size() const;
 
   const uint8_t* data() const;
@@ -145,6 +159,8 @@ class MapBuffer {
   // returns the relative offset of the first byte of dynamic data
   int32_t getDynamicDataOffset() const;
 
+  MapBuffer::Key getKey(int32_t bucketIndex) const;
+
   int32_t getKeyBucket(MapBuffer::Key key) const;
 
   friend JReadableMapBuffer;
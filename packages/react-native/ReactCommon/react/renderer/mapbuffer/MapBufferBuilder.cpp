@@ -20,10 +20,53 @@ MapBuffer MapBufferBuilder::EMPTY() {
   return MapBufferBuilder(0).build();
 }
 
-MapBufferBuilder::MapBufferBuilder(uint32_t initialSize) {
+MapBufferBuilder::MapBufferBuilder(
+    uint32_t initialSize,
+    uint32_t initialDynamicDataSize)
+    : reservedBucketCount_(initialSize),
+      reservedDynamicDataSize_(initialDynamicDataSize) {
   buckets_.reserve(initialSize);
+  reset();
+}
+
+void MapBufferBuilder::reserve(uint32_t bucketCount, uint32_t dynamicDataSize) {
+  buckets_.reserve(bucketCount);
+  reservedDynamicDataSize_ = dynamicDataSize;
+  if (header_.count == 0) {
+    // Nothing was written yet, so the room for buckets can be resized for
+    // free.
+    reservedBucketCount_ = bucketCount;
+    reset();
+  } else {
+    buffer_.reserve(getDynamicDataOffset() + dynamicDataSize);
+  }
+}
+
+void MapBufferBuilder::reset() {
   header_.count = 0;
   header_.bufferSize = 0;
+  buckets_.clear();
+  lastKey_ = 0;
+  needsSort_ = false;
+
+  buffer_.clear();
+  buffer_.reserve(getDynamicDataOffset() + reservedDynamicDataSize_);
+  buffer_.resize(getDynamicDataOffset(), 0);
+}
+
+size_t MapBufferBuilder::getDynamicDataOffset() const {
+  return sizeof(MapBuffer::Header) +
+      sizeof(MapBuffer::Bucket) * reservedBucketCount_;
+}
+
+uint32_t MapBufferBuilder::allocateDynamicData(size_t size) {
+  auto offset = buffer_.size();
+  buffer_.resize(offset + size, 0);
+  return static_cast<uint32_t>(offset - getDynamicDataOffset());
+}
+
+uint8_t* MapBufferBuilder::getDynamicData(uint32_t offset) {
+  return buffer_.data() + getDynamicDataOffset() + offset;
 }
 
 void MapBufferBuilder::storeKeyValue(
@@ -43,11 +86,10 @@ void MapBufferBuilder::storeKeyValue(
 
   buckets_.emplace_back(key, static_cast<uint16_t>(type), data);
 
-  header_.count++;
-
-  if (lastKey_ > key) {
+  if (header_.count > 0 && lastKey_ >= key) {
     needsSort_ = true;
   }
+  header_.count++;
   lastKey_ = key;
 }
 
@@ -76,15 +118,16 @@ void MapBufferBuilder::putInt(MapBuffer::Key key, int32_t value) {
       INT_SIZE);
 }
 
-void MapBufferBuilder::putString(MapBuffer::Key key, const std::string& value) {
-  auto strSize = value.size();
-  const char* strData = value.data();
+void MapBufferBuilder::putString(
+    MapBuffer::Key key,
+    std::string_view value) {
+  auto strSize = static_cast<uint32_t>(value.size());
 
   // format [length of string (int)] + [Array of Characters in the string]
-  auto offset = dynamicData_.size();
-  dynamicData_.resize(offset + INT_SIZE + strSize, 0);
-  memcpy(dynamicData_.data() + offset, &strSize, INT_SIZE);
-  memcpy(dynamicData_.data() + offset + INT_SIZE, strData, strSize);
+  auto offset = allocateDynamicData(INT_SIZE + strSize);
+  auto* data = getDynamicData(offset);
+  memcpy(data, &strSize, INT_SIZE);
+  memcpy(data + INT_SIZE, value.data(), strSize);
 
   // Store Key and pointer to the string
   storeKeyValue(
@@ -95,15 +138,14 @@ void MapBufferBuilder::putString(MapBuffer::Key key, const std::string& value) {
 }
 
 void MapBufferBuilder::putMapBuffer(MapBuffer::Key key, const MapBuffer& map) {
-  auto mapBufferSize = map.size();
-
-  auto offset = dynamicData_.size();
+  auto mapBufferSize = static_cast<uint32_t>(map.size());
 
   // format [length of buffer (int)] + [bytes of MapBuffer]
-  dynamicData_.resize(offset + INT_SIZE + mapBufferSize, 0);
-  memcpy(dynamicData_.data() + offset, &mapBufferSize, INT_SIZE);
-  // Copy the content of the map into dynamicData_
-  memcpy(dynamicData_.data() + offset + INT_SIZE, map.data(), mapBufferSize);
+  auto offset = allocateDynamicData(INT_SIZE + mapBufferSize);
+  auto* data = getDynamicData(offset);
+  memcpy(data, &mapBufferSize, INT_SIZE);
+  // Copy the content of the map into the dynamic data
+  memcpy(data + INT_SIZE, map.data(), mapBufferSize);
 
   // Store Key and pointer to the string
   storeKeyValue(
@@ -113,29 +155,59 @@ void MapBufferBuilder::putMapBuffer(MapBuffer::Key key, const MapBuffer& map) {
       INT_SIZE);
 }
 
+void MapBufferBuilder::putMapBuffer(
+    MapBuffer::Key key,
+    MapBufferBuilder& builder) {
+  react_native_assert(&builder != this && "Can't put a builder into itself");
+  builder.finalizeBuckets();
+
+  auto headerSize = sizeof(MapBuffer::Header);
+  auto bucketSize = builder.buckets_.size() * sizeof(MapBuffer::Bucket);
+  auto dynamicDataSize =
+      builder.buffer_.size() - builder.getDynamicDataOffset();
+  auto mapBufferSize =
+      static_cast<uint32_t>(headerSize + bucketSize + dynamicDataSize);
+  auto header = builder.header_;
+  header.bufferSize = mapBufferSize;
+
+  // format [length of buffer (int)] + [bytes of MapBuffer]
+  auto offset = allocateDynamicData(INT_SIZE + mapBufferSize);
+  auto* data = getDynamicData(offset);
+  memcpy(data, &mapBufferSize, INT_SIZE);
+  memcpy(data + INT_SIZE, &header, headerSize);
+  memcpy(data + INT_SIZE + headerSize, builder.buckets_.data(), bucketSize);
+  memcpy(
+      data + INT_SIZE + headerSize + bucketSize,
+      builder.getDynamicData(0),
+      dynamicDataSize);
+
+  storeKeyValue(
+      key,
+      MapBuffer::DataType::Map,
+      reinterpret_cast<const uint8_t*>(&offset),
+      INT_SIZE);
+}
+
 void MapBufferBuilder::putMapBufferList(
     MapBuffer::Key key,
     const std::vector<MapBuffer>& mapBufferList) {
-  auto offset = static_cast<int32_t>(dynamicData_.size());
-  int32_t dataSize = 0;
+  uint32_t dataSize = 0;
   for (const MapBuffer& mapBuffer : mapBufferList) {
-    dataSize = dataSize + INT_SIZE + static_cast<int32_t>(mapBuffer.size());
+    dataSize = dataSize + INT_SIZE + static_cast<uint32_t>(mapBuffer.size());
   }
 
-  dynamicData_.resize(offset + INT_SIZE, 0);
-  memcpy(dynamicData_.data() + offset, &dataSize, INT_SIZE);
+  auto offset = allocateDynamicData(INT_SIZE + dataSize);
+  auto* data = getDynamicData(offset);
+  memcpy(data, &dataSize, INT_SIZE);
+  data += INT_SIZE;
 
   for (const MapBuffer& mapBuffer : mapBufferList) {
-    auto mapBufferSize = static_cast<int32_t>(mapBuffer.size());
-    auto dynamicDataSize = static_cast<int32_t>(dynamicData_.size());
-    dynamicData_.resize(dynamicDataSize + INT_SIZE + mapBufferSize, 0);
+    auto mapBufferSize = static_cast<uint32_t>(mapBuffer.size());
     // format [length of buffer (int)] + [bytes of MapBuffer]
-    memcpy(dynamicData_.data() + dynamicDataSize, &mapBufferSize, INT_SIZE);
-    // Copy the content of the map into dynamicData_
-    memcpy(
-        dynamicData_.data() + dynamicDataSize + INT_SIZE,
-        mapBuffer.data(),
-        mapBufferSize);
+    memcpy(data, &mapBufferSize, INT_SIZE);
+    // Copy the content of the map into the dynamic data
+    memcpy(data + INT_SIZE, mapBuffer.data(), mapBufferSize);
+    data += INT_SIZE + mapBufferSize;
   }
 
   // Store Key and pointer to the string
@@ -152,29 +224,52 @@ static inline bool compareBuckets(
   return a.key < b.key;
 }
 
+void MapBufferBuilder::finalizeBuckets() {
+  if (!needsSort_) {
+    return;
+  }
+
+  std::stable_sort(buckets_.begin(), buckets_.end(), compareBuckets);
+
+  // Readers rely on keys being unique; the last value put for a key wins.
+  auto last = buckets_.begin();
+  for (auto it = last + 1; it != buckets_.end(); it++) {
+    if (it->key != last->key) {
+      last++;
+    }
+    *last = *it;
+  }
+  buckets_.erase(++last, buckets_.end());
+  header_.count = static_cast<uint16_t>(buckets_.size());
+  needsSort_ = false;
+}
+
 MapBuffer MapBufferBuilder::build() {
+  finalizeBuckets();
+
   // Create buffer: [header] + [key, values] + [dynamic data]
-  auto bucketSize = buckets_.size() * sizeof(MapBuffer::Bucket);
   auto headerSize = sizeof(MapBuffer::Header);
-  auto bufferSize = headerSize + bucketSize + dynamicData_.size();
-
-  header_.bufferSize = static_cast<uint32_t>(bufferSize);
+  auto bucketSize = buckets_.size() * sizeof(MapBuffer::Bucket);
 
-  if (needsSort_) {
-    std::sort(buckets_.begin(), buckets_.end(), compareBuckets);
+  // The dynamic data only moves if the number of buckets differs from the
+  // reserved one.
+  auto reservedSize = getDynamicDataOffset();
+  auto requiredSize = headerSize + bucketSize;
+  if (requiredSize > reservedSize) {
+    buffer_.insert(
+        buffer_.begin() + reservedSize, requiredSize - reservedSize, 0);
+  } else if (requiredSize < reservedSize) {
+    buffer_.erase(
+        buffer_.begin() + requiredSize, buffer_.begin() + reservedSize);
   }
 
-  // TODO(T83483191): add pass to check for duplicates
-
-  std::vector<uint8_t> buffer(bufferSize);
-  memcpy(buffer.data(), &header_, headerSize);
-  memcpy(buffer.data() + headerSize, buckets_.data(), bucketSize);
-  memcpy(
-      buffer.data() + headerSize + bucketSize,
-      dynamicData_.data(),
-      dynamicData_.size());
+  header_.bufferSize = static_cast<uint32_t>(buffer_.size());
+  memcpy(buffer_.data(), &header_, headerSize);
+  memcpy(buffer_.data() + headerSize, buckets_.data(), bucketSize);
 
-  return MapBuffer(std::move(buffer));
+  auto mapBuffer = MapBuffer(std::move(buffer_));
+  reset();
+  return mapBuffer;
 }
 
 } // namespace facebook::react
@@ -17,14 +17,38 @@ namespace facebook::react {
 constexpr uint32_t INITIAL_BUCKETS_SIZE = 10;
 
 /**
- * MapBufferBuilder is a builder class for MapBuffer
+ * MapBufferBuilder is a builder class for MapBuffer.
+ *
+ * Dynamic data (strings and nested MapBuffers) is written in place into the
+ * buffer of the MapBuffer being built, after room for the header and the
+ * expected number of buckets, so `build()` doesn't copy it. A builder is
+ * reset by `build()` and can be reused (e.g. per thread) to build more
+ * MapBuffers without reallocating its buckets.
  */
 class MapBufferBuilder {
  public:
-  MapBufferBuilder(uint32_t initialSize = INITIAL_BUCKETS_SIZE);
+  /**
+   * \param initialSize The expected number of entries.
+   * \param initialDynamicDataSize The expected size in bytes of the dynamic
+   * data (strings and nested MapBuffers).
+   */
+  MapBufferBuilder(
+      uint32_t initialSize = INITIAL_BUCKETS_SIZE,
+      uint32_t initialDynamicDataSize = 0);
 
   static MapBuffer EMPTY();
 
+  /**
+   * Updates the expected number of entries and size of the dynamic data of
+   * the MapBuffers built from now on.
+   */
+  void reserve(uint32_t bucketCount, uint32_t dynamicDataSize);
+
+  /**
+   * Discards the entries put so far.
+   */
+  void reset();
+
   void putInt(MapBuffer::Key key, int32_t value);
 
   // TODO: Support 64 bit integers
@@ -33,14 +57,23 @@ class MapBufferBuilder {
 
   void putDouble(MapBuffer::Key key, double value);
 
-  void putString(MapBuffer::Key key, const std::string& value);
+  void putString(MapBuffer::Key key, std::string_view value);
 
   void putMapBuffer(MapBuffer::Key key, const MapBuffer& map);
 
+  /**
+   * Puts the MapBuffer being built by `builder` without building it first:
+   * its entries are written straight into the dynamic data of this builder.
+   */
+  void putMapBuffer(MapBuffer::Key key, MapBufferBuilder& builder);
+
   void putMapBufferList(
       MapBuffer::Key key,
       const std::vector<MapBuffer>& mapBufferList);
 
+  /**
+   * Builds the MapBuffer and resets the builder.
+   */
   MapBuffer build();
 
  private:
@@ -48,10 +81,18 @@ class MapBufferBuilder {
 
   std::vector<MapBuffer::Bucket> buckets_{};
 
-  std::vector<uint8_t> dynamicData_{};
+  // The buffer of the MapBuffer being built: room for the header and
+  // `reservedBucketCount_` buckets, followed by the dynamic data.
+  std::vector<uint8_t> buffer_{};
+
+  uint32_t reservedBucketCount_{0};
+
+  uint32_t reservedDynamicDataSize_{0};
 
   uint16_t lastKey_{0};
 
+  // Whether buckets were not put in strictly increasing key order, and need to
+  // be sorted and deduplicated.
   bool needsSort_{false};
 
   void storeKeyValue(
@@ -59,6 +100,18 @@ class MapBufferBuilder {
       MapBuffer::DataType type,
       const uint8_t* value,
       uint32_t valueSize);
+
+  size_t getDynamicDataOffset() const;
+
+  // Appends `size` bytes of dynamic data, and returns their offset relative
+  // to the start of the dynamic data.
+  uint32_t allocateDynamicData(size_t size);
+
+  uint8_t* getDynamicData(uint32_t offset);
+
+  // Sorts and deduplicates the buckets, and updates the header with their
+  // final count.
+  void finalizeBuckets();
 };
 
 } // namespace facebook::react
@@ -5,7 +5,9 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <cstring>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -189,3 +191,120 @@ TEST(MapBufferTest, testMapRandomAccess) {
   EXPECT_EQ(map.getInt(1234), 4321);
   EXPECT_EQ(map.getString(65535), "Let's count: 的, 一, 是");
 }
+
+TEST(MapBufferTest, testDenseAndSparseKeys) {
+  auto denseBuilder = MapBufferBuilder();
+  for (MapBuffer::Key key = 10; key < 20; key++) {
+    denseBuilder.putInt(key, key * 2);
+  }
+  auto dense = denseBuilder.build();
+
+  for (MapBuffer::Key key = 10; key < 20; key++) {
+    EXPECT_EQ(dense.getInt(key), key * 2);
+  }
+  EXPECT_FALSE(dense.contains(9));
+  EXPECT_FALSE(dense.contains(20));
+
+  auto sparseBuilder = MapBufferBuilder();
+  for (MapBuffer::Key key : {1, 2, 5, 6, 7, 100, 1000, 65535}) {
+    sparseBuilder.putInt(key, key);
+  }
+  auto sparse = sparseBuilder.build();
+
+  for (MapBuffer::Key key : {1, 2, 5, 6, 7, 100, 1000, 65535}) {
+    EXPECT_EQ(sparse.getInt(key), key);
+  }
+  for (MapBuffer::Key key : {0, 3, 4, 8, 99, 101, 65534}) {
+    EXPECT_FALSE(sparse.contains(key));
+  }
+  EXPECT_FALSE(MapBufferBuilder::EMPTY().contains(0));
+}
+
+TEST(MapBufferTest, testDuplicateKeys) {
+  auto builder = MapBufferBuilder();
+  builder.putInt(1, 1);
+  builder.putInt(2, 2);
+  builder.putInt(1, 3);
+  builder.putString(3, "first");
+  builder.putString(3, "second");
+  auto map = builder.build();
+
+  EXPECT_EQ(map.count(), 3);
+  EXPECT_EQ(map.getInt(1), 3);
+  EXPECT_EQ(map.getInt(2), 2);
+  EXPECT_EQ(map.getString(3), "second");
+}
+
+TEST(MapBufferTest, testReservedCapacity) {
+  // Fewer, then more buckets than reserved.
+  for (uint32_t bucketCount : {1, 20}) {
+    auto builder = MapBufferBuilder(4, 64);
+    for (MapBuffer::Key key = 0; key < bucketCount; key++) {
+      builder.putString(key, std::to_string(key));
+    }
+    auto map = builder.build();
+
+    EXPECT_EQ(map.count(), bucketCount);
+    for (MapBuffer::Key key = 0; key < bucketCount; key++) {
+      EXPECT_EQ(map.getString(key), std::to_string(key));
+    }
+  }
+}
+
+TEST(MapBufferTest, testReuseBuilder) {
+  auto builder = MapBufferBuilder();
+  builder.putString(0, "first");
+  builder.putInt(1, 1);
+  auto first = builder.build();
+
+  builder.putString(0, "discarded");
+  builder.reset();
+  builder.putInt(2, 2);
+  auto second = builder.build();
+
+  EXPECT_EQ(first.count(), 2);
+  EXPECT_EQ(first.getString(0), "first");
+  EXPECT_EQ(first.getInt(1), 1);
+  EXPECT_EQ(second.count(), 1);
+  EXPECT_EQ(second.getInt(2), 2);
+}
+
+TEST(MapBufferTest, testPutMapBufferBuilder) {
+  auto innerBuilder = MapBufferBuilder();
+  innerBuilder.putString(1, "This is a test");
+  innerBuilder.putInt(0, 1234);
+
+  auto builder = MapBufferBuilder();
+  builder.putString(0, "outer");
+  builder.putMapBuffer(1, innerBuilder);
+  auto map = builder.build();
+
+  EXPECT_EQ(map.getString(0), "outer");
+  auto inner = map.getMapBuffer(1);
+  EXPECT_EQ(inner.count(), 2);
+  EXPECT_EQ(inner.getInt(0), 1234);
+  EXPECT_EQ(inner.getString(1), "This is a test");
+
+  // The inner builder can still build its MapBuffer.
+  auto innerMap = innerBuilder.build();
+  EXPECT_EQ(innerMap.size(), inner.size());
+  EXPECT_EQ(memcmp(innerMap.data(), inner.data(), inner.size()), 0);
+}
+
+TEST(MapBufferTest, testContainsAndGetType) {
+  auto builder = MapBufferBuilder();
+  builder.putBool(0, true);
+  builder.putInt(1, 1234);
+  builder.putDouble(2, 908.1);
+  builder.putString(3, "This is a test");
+  builder.putMapBuffer(4, MapBufferBuilder::EMPTY());
+  auto map = builder.build();
+
+  EXPECT_TRUE(map.contains(3));
+  EXPECT_FALSE(map.contains(5));
+  EXPECT_EQ(map.getType(0), MapBuffer::DataType::Boolean);
+  EXPECT_EQ(map.getType(1), MapBuffer::DataType::Int);
+  EXPECT_EQ(map.getType(2), MapBuffer::DataType::Double);
+  EXPECT_EQ(map.getType(3), MapBuffer::DataType::String);
+  EXPECT_EQ(map.getType(4), MapBuffer::DataType::Map);
+}
@@ -10,7 +10,14 @@
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/core/LayoutableShadowNode.h>
 #include <react/renderer/debug/SystraceSection.h>
+#include <react/utils/CoreFeatures.h>
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <thread>
 #include "ShadowView.h"
 
 #ifdef DEBUG_LOGS_DIFFER
@@ -165,11 +172,141 @@ class TinyMap final {
     erasedAtFront_ = 0;
   }
 
-  std::vector<Pair> vector_;
+  std::vector<Pair, DifferentiatorArenaAllocator<Pair>> vector_;
   size_t numErased_{0};
   size_t erasedAtFront_{0};
 };
 
+/*
+ * Minimal number of matched sibling pairs (with subtrees that need to be
+ * diffed) on a single level that makes the Differentiator hand subtrees off to
+ * worker threads. For smaller lists the cost of the hand-off is higher than
+ * the gain.
+ */
+static constexpr size_t kParallelDiffingMinimalPairCount = 4;
+
+/*
+ * Upper bound for the number of worker threads used for parallel diffing.
+ * On big.LITTLE devices using every core is counterproductive.
+ */
+static constexpr size_t kParallelDiffingMaximumWorkerCount = 7;
+
+/*
+ * Set on threads that are currently diffing a subtree as part of a parallel
+ * batch; nested levels are diffed sequentially on the same thread to avoid
+ * oversubscription.
+ */
+static thread_local bool isDiffingInParallel = false;
+
+/*
+ * A small process-wide pool of threads which diff independent subtrees
+ * concurrently (see `CoreFeatures::enableParallelDifferentiator`).
+ *
+ * Work items are distributed through an atomic cursor: the calling thread and
+ * every idle worker keep claiming the next unprocessed index until all of them
+ * are taken. This way load is balanced dynamically, and the calling thread
+ * never waits for busy workers to pick a job up; it only waits for items that
+ * were already claimed by somebody else.
+ */
+class DifferentiatorThreadPool final {
+ public:
+  static DifferentiatorThreadPool& shared() {
+    // Intentionally leaked: worker threads live as long as the process.
+    static auto& threadPool = *new DifferentiatorThreadPool();
+    return threadPool;
+  }
+
+  void parallelFor(size_t count, const std::function<void(size_t)>& work) {
+    auto job = std::make_shared<Job>(count, work);
+
+    auto helperCount = std::min(workerCount_, count - 1);
+    if (helperCount > 0) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t i = 0; i < helperCount; i++) {
+          queue_.push_back(job);
+        }
+      }
+      condition_.notify_all();
+    }
+
+    runJob(*job);
+
+    std::unique_lock<std::mutex> lock(job->mutex);
+    job->finished.wait(
+        lock, [&] { return job->completedCount.load() == job->count; });
+  }
+
+ private:
+  struct Job {
+    Job(size_t count, const std::function<void(size_t)>& work)
+        : count(count), work(work) {}
+
+    const size_t count;
+
+    // Refers to the caller's stack frame; only dereferenced for claimed
+    // indices, which the caller always waits for.
+    const std::function<void(size_t)>& work;
+
+    std::atomic<size_t> nextIndex{0};
+    std::atomic<size_t> completedCount{0};
+    std::mutex mutex;
+    std::condition_variable finished;
+  };
+
+  DifferentiatorThreadPool()
+      : workerCount_(std::min(
+            static_cast<size_t>(
+                std::max(std::thread::hardware_concurrency(), 1u) - 1),
+            kParallelDiffingMaximumWorkerCount)) {
+    for (size_t i = 0; i < workerCount_; i++) {
+      std::thread([this] { workerLoop(); }).detach();
+    }
+  }
+
+  static void runJob(Job& job) {
+    auto wasDiffingInParallel = isDiffingInParallel;
+    isDiffingInParallel = true;
+
+    size_t completedCount = 0;
+    while (true) {
+      auto index = job.nextIndex.fetch_add(1);
+      if (index >= job.count) {
+        break;
+      }
+      job.work(index);
+      completedCount++;
+    }
+
+    isDiffingInParallel = wasDiffingInParallel;
+
+    if (completedCount > 0 &&
+        job.completedCount.fetch_add(completedCount) + completedCount ==
+            job.count) {
+      std::lock_guard<std::mutex> lock(job.mutex);
+      job.finished.notify_all();
+    }
+  }
+
+  void workerLoop() {
+    while (true) {
+      std::shared_ptr<Job> job;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [this] { return !queue_.empty(); });
+        job = std::move(queue_.front());
+        queue_.pop_front();
+      }
+      runJob(*job);
+    }
+  }
+
+  const size_t workerCount_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<std::shared_ptr<Job>> queue_;
+};
+
 /*
  * Sorting comparator for `reorderInPlaceIfNeeded`.
  */
@@ -208,12 +345,93 @@ static inline bool shadowNodeIsConcrete(const ShadowNode& shadowNode) {
   return shadowNode.getTraits().check(ShadowNodeTraits::Trait::FormsView);
 }
 
+/*
+ * Returns the content window of `shadowNode` if it windows its content.
+ */
+static std::optional<Rect> contentWindowOf(const ShadowNode& shadowNode) {
+  if (!shadowNode.getTraits().check(ShadowNodeTraits::Trait::WindowsContent)) {
+    return std::nullopt;
+  }
+  auto layoutableShadowNode =
+      dynamic_cast<const LayoutableShadowNode*>(&shadowNode);
+  return layoutableShadowNode != nullptr
+      ? layoutableShadowNode->getContentWindow()
+      : std::nullopt;
+}
+
+/*
+ * Returns the culling rectangle of `childShadowNode` (in its own coordinate
+ * space) given the content window of its parent, or nothing if its children
+ * must not be culled.
+ */
+static std::optional<Rect> cullingRectOf(
+    const ShadowNode& childShadowNode,
+    const LayoutMetrics& layoutMetrics,
+    const std::optional<Rect>& contentWindow) {
+  if (!contentWindow.has_value() || layoutMetrics == EmptyLayoutMetrics ||
+      !childShadowNode.getTraits().check(
+          ShadowNodeTraits::Trait::FormsStackingContext)) {
+    return std::nullopt;
+  }
+  // The window can't be mapped through transforms (e.g. of inverted lists)
+  // cheaply, so such content containers are not windowed.
+  auto layoutableShadowNode =
+      dynamic_cast<const LayoutableShadowNode*>(&childShadowNode);
+  if (layoutableShadowNode == nullptr ||
+      layoutableShadowNode->getTransform() != Transform::Identity()) {
+    return std::nullopt;
+  }
+  auto origin = layoutMetrics.frame.origin;
+  return Rect{
+      {contentWindow->origin.x - origin.x, contentWindow->origin.y - origin.y},
+      contentWindow->size};
+}
+
+/*
+ * Returns whether the view of `childShadowNode` (and all of its descendants)
+ * is wholly outside of `cullingRect`, in which case it's not mounted.
+ */
+static bool isCulled(
+    const ShadowNode& childShadowNode,
+    const LayoutMetrics& layoutMetrics,
+    const Rect& cullingRect) {
+  if (layoutMetrics == EmptyLayoutMetrics) {
+    return false;
+  }
+  auto overflowRect = insetBy(layoutMetrics.frame, layoutMetrics.overflowInset);
+  if (auto layoutableShadowNode =
+          dynamic_cast<const LayoutableShadowNode*>(&childShadowNode)) {
+    overflowRect = overflowRect * layoutableShadowNode->getTransform();
+  }
+  return overflowRect.getMaxX() <= cullingRect.getMinX() ||
+      overflowRect.getMinX() >= cullingRect.getMaxX() ||
+      overflowRect.getMaxY() <= cullingRect.getMinY() ||
+      overflowRect.getMinY() >= cullingRect.getMaxY();
+}
+
+/*
+ * Returns whether the mounted children of the matched pairs can differ: either
+ * the children themselves, or the part of them that is culled, changed.
+ */
+static bool mountedChildrenMayDiffer(
+    const ShadowViewNodePair& oldPair,
+    const ShadowViewNodePair& newPair) {
+  if (oldPair.cullingRect != newPair.cullingRect) {
+    return true;
+  }
+  return oldPair.shadowNode != newPair.shadowNode &&
+      !ShadowNode::sameChildren(*oldPair.shadowNode, *newPair.shadowNode);
+}
+
 static void sliceChildShadowNodeViewPairsRecursivelyV2(
     ShadowViewNodePair::NonOwningList& pairList,
     size_t& startOfStaticIndex,
     ViewNodePairScope& scope,
     Point layoutOffset,
-    const ShadowNode& shadowNode) {
+    const ShadowNode& shadowNode,
+    const std::optional<Rect>& cullingRect = std::nullopt) {
+  auto contentWindow = contentWindowOf(shadowNode);
+
   for (const auto& sharedChildShadowNode : shadowNode.getChildren()) {
     auto& childShadowNode = *sharedChildShadowNode;
 
@@ -226,6 +444,10 @@ static void sliceChildShadowNodeViewPairsRecursivelyV2(
 #endif
 
     auto shadowView = ShadowView(childShadowNode);
+    if (cullingRect.has_value() &&
+        isCulled(childShadowNode, shadowView.layoutMetrics, *cullingRect)) {
+      continue;
+    }
     auto origin = layoutOffset;
     if (shadowView.layoutMetrics != EmptyLayoutMetrics) {
       origin += shadowView.layoutMetrics.frame.origin;
@@ -247,7 +469,9 @@ static void sliceChildShadowNodeViewPairsRecursivelyV2(
          &childShadowNode,
          areChildrenFlattened,
          isConcreteView,
-         storedOrigin});
+         storedOrigin,
+         cullingRectOf(
+             childShadowNode, shadowView.layoutMetrics, contentWindow)});
 
     if (shadowView.layoutMetrics.positionType == PositionType::Static) {
       auto it = pairList.begin();
@@ -273,7 +497,8 @@ ShadowViewNodePair::NonOwningList sliceChildShadowNodeViewPairsV2(
     const ShadowNode& shadowNode,
     ViewNodePairScope& scope,
     bool allowFlattened,
-    Point layoutOffset) {
+    Point layoutOffset,
+    const std::optional<Rect>& cullingRect) {
   auto pairList = ShadowViewNodePair::NonOwningList{};
 
   if (!shadowNode.getTraits().check(
@@ -285,7 +510,12 @@ ShadowViewNodePair::NonOwningList sliceChildShadowNodeViewPairsV2(
 
   size_t startOfStaticIndex = 0;
   sliceChildShadowNodeViewPairsRecursivelyV2(
-      pairList, startOfStaticIndex, scope, layoutOffset, shadowNode);
+      pairList,
+      startOfStaticIndex,
+      scope,
+      layoutOffset,
+      shadowNode,
+      cullingRect);
 
   // Sorting pairs based on `orderIndex` if needed.
   reorderInPlaceIfNeeded(pairList);
@@ -313,7 +543,8 @@ sliceChildShadowNodeViewPairsFromViewNodePair(
       *shadowViewNodePair.shadowNode,
       scope,
       allowFlattened,
-      shadowViewNodePair.contextOrigin);
+      shadowViewNodePair.contextOrigin,
+      shadowViewNodePair.cullingRect);
 }
 
 /*
@@ -354,14 +585,54 @@ static void calculateShadowViewMutationsV2(
     ShadowViewNodePair::NonOwningList&& newChildPairs,
     bool isRecursionRedundant = false);
 
+/*
+ * Intermediate mutation lists are drained into the caller's list at the end of
+ * every `calculateShadowViewMutationsV2` call. Instead of allocating them anew
+ * on every level of every diff, their storage is recycled per thread.
+ */
+static constexpr size_t kMaximumRecycledMutationListCount = 128;
+static constexpr size_t kMaximumRecycledMutationListCapacity = 1024;
+
+static thread_local std::vector<ShadowViewMutation::List>
+    recycledMutationLists{};
+
+static ShadowViewMutation::List acquireMutationList() {
+  if (recycledMutationLists.empty()) {
+    return {};
+  }
+  auto list = std::move(recycledMutationLists.back());
+  recycledMutationLists.pop_back();
+  return list;
+}
+
+static void recycleMutationList(ShadowViewMutation::List& list) {
+  list.clear();
+  if (list.capacity() == 0 ||
+      list.capacity() > kMaximumRecycledMutationListCapacity ||
+      recycledMutationLists.size() >= kMaximumRecycledMutationListCount) {
+    return;
+  }
+  recycledMutationLists.push_back(std::move(list));
+}
+
 struct OrderedMutationInstructionContainer {
-  ShadowViewMutation::List createMutations{};
-  ShadowViewMutation::List deleteMutations{};
-  ShadowViewMutation::List insertMutations{};
-  ShadowViewMutation::List removeMutations{};
-  ShadowViewMutation::List updateMutations{};
-  ShadowViewMutation::List downwardMutations{};
-  ShadowViewMutation::List destructiveDownwardMutations{};
+  ShadowViewMutation::List createMutations = acquireMutationList();
+  ShadowViewMutation::List deleteMutations = acquireMutationList();
+  ShadowViewMutation::List insertMutations = acquireMutationList();
+  ShadowViewMutation::List removeMutations = acquireMutationList();
+  ShadowViewMutation::List updateMutations = acquireMutationList();
+  ShadowViewMutation::List downwardMutations = acquireMutationList();
+  ShadowViewMutation::List destructiveDownwardMutations = acquireMutationList();
+
+  ~OrderedMutationInstructionContainer() {
+    recycleMutationList(createMutations);
+    recycleMutationList(deleteMutations);
+    recycleMutationList(insertMutations);
+    recycleMutationList(removeMutations);
+    recycleMutationList(updateMutations);
+    recycleMutationList(downwardMutations);
+    recycleMutationList(destructiveDownwardMutations);
+  }
 };
 
 static void updateMatchedPairSubtrees(
@@ -373,6 +644,12 @@ static void updateMatchedPairSubtrees(
     const ShadowViewNodePair& oldPair,
     const ShadowViewNodePair& newPair);
 
+static void calculateShadowViewMutationsForMatchedPairChildren(
+    ShadowViewMutation::List& downwardMutations,
+    ShadowViewMutation::List& destructiveDownwardMutations,
+    const ShadowViewNodePair& oldPair,
+    const ShadowViewNodePair& newPair);
+
 static void updateMatchedPair(
     OrderedMutationInstructionContainer& mutationContainer,
     bool oldNodeFoundInOrder,
@@ -492,21 +769,13 @@ static void updateMatchedPairSubtrees(
 
   // Update subtrees if View is not flattened, and if node addresses
   // are not equal
-  if (oldPair.shadowNode != newPair.shadowNode) {
-    ViewNodePairScope innerScope{};
-    auto oldGrandChildPairs =
-        sliceChildShadowNodeViewPairsFromViewNodePair(oldPair, innerScope);
-    auto newGrandChildPairs =
-        sliceChildShadowNodeViewPairsFromViewNodePair(newPair, innerScope);
-    const size_t newGrandChildPairsSize = newGrandChildPairs.size();
-    calculateShadowViewMutationsV2(
-        innerScope,
-        *(newGrandChildPairsSize != 0u
-              ? &mutationContainer.downwardMutations
-              : &mutationContainer.destructiveDownwardMutations),
-        oldPair.shadowView,
-        std::move(oldGrandChildPairs),
-        std::move(newGrandChildPairs));
+  if (oldPair.shadowNode != newPair.shadowNode ||
+      oldPair.cullingRect != newPair.cullingRect) {
+    calculateShadowViewMutationsForMatchedPairChildren(
+        mutationContainer.downwardMutations,
+        mutationContainer.destructiveDownwardMutations,
+        oldPair,
+        newPair);
   }
 }
 
@@ -832,7 +1101,7 @@ static void calculateShadowViewMutationsFlattener(
 
       // Update children if appropriate.
       if (!oldTreeNodePair.flattened && !newTreeNodePair.flattened) {
-        if (oldTreeNodePair.shadowNode != newTreeNodePair.shadowNode) {
+        if (mountedChildrenMayDiffer(oldTreeNodePair, newTreeNodePair)) {
           ViewNodePairScope innerScope{};
           calculateShadowViewMutationsV2(
               innerScope,
@@ -1036,6 +1305,304 @@ static void calculateShadowViewMutationsFlattener(
   }
 }
 
+using DifferentiatorIndexList =
+    std::vector<size_t, DifferentiatorArenaAllocator<size_t>>;
+
+static constexpr size_t kNoIndex = std::numeric_limits<size_t>::max();
+
+/*
+ * Marks in `isInSubsequence` the positions of `sequence` forming its longest
+ * increasing subsequence (patience sorting, O(n log n)). The values must be
+ * distinct; `kNoIndex` values are skipped.
+ */
+static void markLongestIncreasingSubsequence(
+    const DifferentiatorIndexList& sequence,
+    std::vector<bool, DifferentiatorArenaAllocator<bool>>& isInSubsequence) {
+  // `tails[k]` is the position of the smallest value that ends an increasing
+  // subsequence of length `k + 1`; `predecessors` links positions backwards.
+  auto tails = DifferentiatorIndexList{};
+  auto predecessors = DifferentiatorIndexList(sequence.size(), kNoIndex);
+
+  for (size_t position = 0; position < sequence.size(); position++) {
+    auto value = sequence[position];
+    if (value == kNoIndex) {
+      continue;
+    }
+
+    auto it = std::lower_bound(
+        tails.begin(),
+        tails.end(),
+        value,
+        [&](size_t tailPosition, size_t value) {
+          return sequence[tailPosition] < value;
+        });
+
+    if (it != tails.begin()) {
+      predecessors[position] = *(it - 1);
+    }
+
+    if (it == tails.end()) {
+      tails.push_back(position);
+    } else {
+      *it = position;
+    }
+  }
+
+  isInSubsequence.assign(sequence.size(), false);
+  for (auto position = tails.empty() ? kNoIndex : tails.back();
+       position != kNoIndex;
+       position = predecessors[position]) {
+    isInSubsequence[position] = true;
+  }
+}
+
+/*
+ * Alternative strategy for the keyed part of child list diffing (everything
+ * after the prefix matched in-order by the first stage of
+ * `calculateShadowViewMutationsV2`).
+ *
+ * Matched pairs whose old positions form the longest increasing subsequence
+ * (in the new order) stay in place, and only the remaining ones are moved with
+ * a Remove/Insert pair. This gives the minimal number of moves, e.g. moving
+ * the first child to the end is a single move instead of moving every other
+ * child.
+ *
+ * Only lists where every remaining pair is a concrete view and no matched pair
+ * changes its flattening are supported. Returns `false` without generating
+ * any mutations otherwise, in which case the caller falls back to the default
+ * algorithm.
+ */
+static bool calculateShadowViewMutationsWithMinimalMoves(
+    ViewNodePairScope& scope,
+    OrderedMutationInstructionContainer& mutationContainer,
+    const ShadowView& parentShadowView,
+    ShadowViewNodePair::NonOwningList& oldChildPairs,
+    ShadowViewNodePair::NonOwningList& newChildPairs,
+    size_t startIndex) {
+  using TagIndex = std::pair<Tag, size_t>;
+  auto oldTagIndices =
+      std::vector<TagIndex, DifferentiatorArenaAllocator<TagIndex>>{};
+  oldTagIndices.reserve(oldChildPairs.size() - startIndex);
+  for (size_t oldIndex = startIndex; oldIndex < oldChildPairs.size();
+       oldIndex++) {
+    const auto& oldChildPair = *oldChildPairs[oldIndex];
+    if (!oldChildPair.isConcreteView || oldChildPair.inOtherTree()) {
+      return false;
+    }
+    oldTagIndices.push_back({oldChildPair.shadowView.tag, oldIndex});
+  }
+  std::sort(oldTagIndices.begin(), oldTagIndices.end());
+
+  // For every remaining new pair: the index of the matching old pair.
+  auto oldIndices = DifferentiatorIndexList{};
+  oldIndices.reserve(newChildPairs.size() - startIndex);
+  // For every old pair: the index of the matching new pair.
+  auto newIndices = DifferentiatorIndexList(oldChildPairs.size(), kNoIndex);
+
+  for (size_t newIndex = startIndex; newIndex < newChildPairs.size();
+       newIndex++) {
+    const auto& newChildPair = *newChildPairs[newIndex];
+    if (!newChildPair.isConcreteView || newChildPair.inOtherTree()) {
+      return false;
+    }
+
+    auto tag = newChildPair.shadowView.tag;
+    auto it = std::lower_bound(
+        oldTagIndices.begin(),
+        oldTagIndices.end(),
+        tag,
+        [](const TagIndex& tagIndex, Tag tag) { return tagIndex.first < tag; });
+    if (it == oldTagIndices.end() || it->first != tag) {
+      oldIndices.push_back(kNoIndex);
+      continue;
+    }
+
+    if (oldChildPairs[it->second]->flattened != newChildPair.flattened) {
+      return false;
+    }
+
+    oldIndices.push_back(it->second);
+    newIndices[it->second] = newIndex;
+  }
+
+  auto isStable = std::vector<bool, DifferentiatorArenaAllocator<bool>>{};
+  markLongestIncreasingSubsequence(oldIndices, isStable);
+
+  // Flattening never changes here, so the map is never consulted.
+  auto newRemainingPairs = TinyMap<Tag, ShadowViewNodePair*>{};
+
+  // Removes are generated in ascending order of old indices (and executed in
+  // reverse order).
+  for (size_t oldIndex = startIndex; oldIndex < oldChildPairs.size();
+       oldIndex++) {
+    const auto& oldChildPair = *oldChildPairs[oldIndex];
+    auto newIndex = newIndices[oldIndex];
+
+    if (newIndex == kNoIndex) {
+      mutationContainer.removeMutations.push_back(
+          ShadowViewMutation::RemoveMutation(
+              parentShadowView,
+              oldChildPair.shadowView,
+              static_cast<int>(oldChildPair.mountIndex)));
+      mutationContainer.deleteMutations.push_back(
+          ShadowViewMutation::DeleteMutation(oldChildPair.shadowView));
+
+      ViewNodePairScope innerScope{};
+      calculateShadowViewMutationsV2(
+          innerScope,
+          mutationContainer.destructiveDownwardMutations,
+          oldChildPair.shadowView,
+          sliceChildShadowNodeViewPairsFromViewNodePair(
+              oldChildPair, innerScope),
+          {});
+      continue;
+    }
+
+    const auto& newChildPair = *newChildPairs[newIndex];
+    updateMatchedPair(
+        mutationContainer,
+        true,
+        isStable[newIndex - startIndex],
+        parentShadowView,
+        oldChildPair,
+        newChildPair);
+    updateMatchedPairSubtrees(
+        scope,
+        mutationContainer,
+        newRemainingPairs,
+        oldChildPairs,
+        parentShadowView,
+        oldChildPair,
+        newChildPair);
+  }
+
+  // Inserts are generated (and executed) in ascending order of new indices.
+  for (size_t newIndex = startIndex; newIndex < newChildPairs.size();
+       newIndex++) {
+    const auto& newChildPair = *newChildPairs[newIndex];
+    auto position = newIndex - startIndex;
+
+    if (oldIndices[position] != kNoIndex && isStable[position]) {
+      continue;
+    }
+
+    mutationContainer.insertMutations.push_back(
+        ShadowViewMutation::InsertMutation(
+            parentShadowView,
+            newChildPair.shadowView,
+            static_cast<int>(newChildPair.mountIndex)));
+
+    if (oldIndices[position] != kNoIndex) {
+      continue;
+    }
+
+    mutationContainer.createMutations.push_back(
+        ShadowViewMutation::CreateMutation(newChildPair.shadowView));
+
+    ViewNodePairScope innerScope{};
+    calculateShadowViewMutationsV2(
+        innerScope,
+        mutationContainer.downwardMutations,
+        newChildPair.shadowView,
+        {},
+        sliceChildShadowNodeViewPairsFromViewNodePair(
+            newChildPair, innerScope));
+  }
+
+  return true;
+}
+
+/**
+ * Diffs the children of a matched pair of non-flattened nodes.
+ * Mutations go to `destructiveDownwardMutations` if the new node has no
+ * children (the whole subtree is being torn down), and to `downwardMutations`
+ * otherwise.
+ */
+static void calculateShadowViewMutationsForMatchedPairChildren(
+    ShadowViewMutation::List& downwardMutations,
+    ShadowViewMutation::List& destructiveDownwardMutations,
+    const ShadowViewNodePair& oldPair,
+    const ShadowViewNodePair& newPair) {
+  // Only the node itself changed (e.g. props, state or its own layout), the
+  // subtree below (and the part of it that is culled) is exactly the same, so
+  // there is nothing to descend into.
+  if (!mountedChildrenMayDiffer(oldPair, newPair)) {
+    return;
+  }
+
+  ViewNodePairScope innerScope{};
+  auto oldGrandChildPairs =
+      sliceChildShadowNodeViewPairsFromViewNodePair(oldPair, innerScope);
+  auto newGrandChildPairs =
+      sliceChildShadowNodeViewPairsFromViewNodePair(newPair, innerScope);
+  const size_t newGrandChildPairsSize = newGrandChildPairs.size();
+  calculateShadowViewMutationsV2(
+      innerScope,
+      newGrandChildPairsSize != 0u ? downwardMutations
+                                   : destructiveDownwardMutations,
+      oldPair.shadowView,
+      std::move(oldGrandChildPairs),
+      std::move(newGrandChildPairs));
+}
+
+/**
+ * Diffs the children of several matched pairs (found in-order during the
+ * first stage of `calculateShadowViewMutationsV2`), possibly concurrently.
+ *
+ * Subtrees of distinct matched pairs are independent: every recursive call
+ * only reads the (sealed) shadow nodes and writes to its own scope and
+ * mutation lists. The per-pair results are appended in the original pair
+ * order, so the output is identical to diffing them one by one.
+ */
+static void calculateShadowViewMutationsForMatchedPairsChildren(
+    OrderedMutationInstructionContainer& mutationContainer,
+    const ShadowViewNodePair::NonOwningList& oldChildPairs,
+    const ShadowViewNodePair::NonOwningList& newChildPairs,
+    std::vector<size_t, DifferentiatorArenaAllocator<size_t>>&& pairIndices) {
+  if (pairIndices.size() < kParallelDiffingMinimalPairCount) {
+    for (auto index : pairIndices) {
+      calculateShadowViewMutationsForMatchedPairChildren(
+          mutationContainer.downwardMutations,
+          mutationContainer.destructiveDownwardMutations,
+          *oldChildPairs[index],
+          *newChildPairs[index]);
+    }
+    return;
+  }
+
+  SystraceSection s("calculateShadowViewMutationsForMatchedPairsChildren");
+
+  struct Result {
+    ShadowViewMutation::List downwardMutations;
+    ShadowViewMutation::List destructiveDownwardMutations;
+  };
+
+  auto results = std::vector<Result>(pairIndices.size());
+
+  DifferentiatorThreadPool::shared().parallelFor(
+      pairIndices.size(), [&](size_t i) {
+        // Scratch data of every subtree lives in the arena of the thread that
+        // diffs it.
+        DifferentiatorArena::Scope arenaScope{};
+        calculateShadowViewMutationsForMatchedPairChildren(
+            results[i].downwardMutations,
+            results[i].destructiveDownwardMutations,
+            *oldChildPairs[pairIndices[i]],
+            *newChildPairs[pairIndices[i]]);
+      });
+
+  for (auto& result : results) {
+    std::move(
+        result.downwardMutations.begin(),
+        result.downwardMutations.end(),
+        std::back_inserter(mutationContainer.downwardMutations));
+    std::move(
+        result.destructiveDownwardMutations.begin(),
+        result.destructiveDownwardMutations.end(),
+        std::back_inserter(mutationContainer.destructiveDownwardMutations));
+  }
+}
+
 static void calculateShadowViewMutationsV2(
     ViewNodePairScope& scope,
     ShadowViewMutation::List& mutations,
@@ -1077,6 +1644,13 @@ static void calculateShadowViewMutationsV2(
     LOG(ERROR) << "Differ Entry: New Child Pairs: " << strNewChildPairs;
   });
 
+  // Matched pairs which subtrees are going to be diffed concurrently after
+  // the first stage; see `calculateShadowViewMutationsForMatchedPairsChildren`.
+  const bool shouldDiffInParallel =
+      CoreFeatures::enableParallelDifferentiator && !isDiffingInParallel;
+  auto parallelPairIndices =
+      std::vector<size_t, DifferentiatorArenaAllocator<size_t>>{};
+
   // Stage 1: Collecting `Update` mutations
   for (index = 0; index < oldChildPairs.size() && index < newChildPairs.size();
        index++) {
@@ -1122,26 +1696,32 @@ static void calculateShadowViewMutationsV2(
               parentShadowView));
     }
 
-    // Recursively update tree if ShadowNode pointers are not equal
+    // Recursively update tree if ShadowNode pointers (or culling rects) are
+    // not equal
     if (!oldChildPair.flattened &&
-        oldChildPair.shadowNode != newChildPair.shadowNode) {
-      ViewNodePairScope innerScope{};
-      auto oldGrandChildPairs = sliceChildShadowNodeViewPairsFromViewNodePair(
-          oldChildPair, innerScope);
-      auto newGrandChildPairs = sliceChildShadowNodeViewPairsFromViewNodePair(
-          newChildPair, innerScope);
-      const size_t newGrandChildPairsSize = newGrandChildPairs.size();
-      calculateShadowViewMutationsV2(
-          innerScope,
-          *(newGrandChildPairsSize != 0u
-                ? &mutationContainer.downwardMutations
-                : &mutationContainer.destructiveDownwardMutations),
-          oldChildPair.shadowView,
-          std::move(oldGrandChildPairs),
-          std::move(newGrandChildPairs));
+        (oldChildPair.shadowNode != newChildPair.shadowNode ||
+         oldChildPair.cullingRect != newChildPair.cullingRect)) {
+      if (shouldDiffInParallel) {
+        parallelPairIndices.push_back(index);
+        continue;
+      }
+
+      calculateShadowViewMutationsForMatchedPairChildren(
+          mutationContainer.downwardMutations,
+          mutationContainer.destructiveDownwardMutations,
+          oldChildPair,
+          newChildPair);
     }
   }
 
+  if (shouldDiffInParallel) {
+    calculateShadowViewMutationsForMatchedPairsChildren(
+        mutationContainer,
+        oldChildPairs,
+        newChildPairs,
+        std::move(parallelPairIndices));
+  }
+
   size_t lastIndexAfterFirstStage = index;
 
   if (index == newChildPairs.size()) {
@@ -1239,6 +1819,17 @@ static void calculateShadowViewMutationsV2(
           sliceChildShadowNodeViewPairsFromViewNodePair(
               newChildPair, innerScope));
     }
+  } else if (
+      CoreFeatures::enableDifferentiatorMinimalMoves &&
+      calculateShadowViewMutationsWithMinimalMoves(
+          scope,
+          mutationContainer,
+          parentShadowView,
+          oldChildPairs,
+          newChildPairs,
+          lastIndexAfterFirstStage)) {
+    // All mutations for the remaining children were generated with the
+    // minimal-moves strategy.
   } else {
     // Collect map of tags in the new list
     auto newRemainingPairs = TinyMap<Tag, ShadowViewNodePair*>{};
@@ -1559,7 +2150,10 @@ static void calculateShadowViewMutationsV2(
 static void sliceChildShadowNodeViewPairsRecursivelyForTesting(
     ShadowViewNodePair::OwningList& pairList,
     Point layoutOffset,
-    const ShadowNode& shadowNode) {
+    const ShadowNode& shadowNode,
+    const std::optional<Rect>& cullingRect = std::nullopt) {
+  auto contentWindow = contentWindowOf(shadowNode);
+
   for (const auto& sharedChildShadowNode : shadowNode.getChildren()) {
     auto& childShadowNode = *sharedChildShadowNode;
 
@@ -1572,6 +2166,10 @@ static void sliceChildShadowNodeViewPairsRecursivelyForTesting(
 #endif
 
     auto shadowView = ShadowView(childShadowNode);
+    if (cullingRect.has_value() &&
+        isCulled(childShadowNode, shadowView.layoutMetrics, *cullingRect)) {
+      continue;
+    }
     auto origin = layoutOffset;
     if (shadowView.layoutMetrics != EmptyLayoutMetrics) {
       origin += shadowView.layoutMetrics.frame.origin;
@@ -1580,7 +2178,14 @@ static void sliceChildShadowNodeViewPairsRecursivelyForTesting(
 
     if (childShadowNode.getTraits().check(
             ShadowNodeTraits::Trait::FormsStackingContext)) {
-      pairList.push_back({shadowView, &childShadowNode});
+      pairList.push_back(
+          {shadowView,
+           &childShadowNode,
+           false,
+           true,
+           {0, 0},
+           cullingRectOf(
+               childShadowNode, shadowView.layoutMetrics, contentWindow)});
     } else {
       if (childShadowNode.getTraits().check(
               ShadowNodeTraits::Trait::FormsView)) {
@@ -1597,7 +2202,8 @@ static void sliceChildShadowNodeViewPairsRecursivelyForTesting(
  * Only used by unit tests currently.
  */
 ShadowViewNodePair::OwningList sliceChildShadowNodeViewPairsForTesting(
-    const ShadowNode& shadowNode) {
+    const ShadowNode& shadowNode,
+    const std::optional<Rect>& cullingRect) {
   auto pairList = ShadowViewNodePair::OwningList{};
 
   if (!shadowNode.getTraits().check(
@@ -1607,7 +2213,7 @@ ShadowViewNodePair::OwningList sliceChildShadowNodeViewPairsForTesting(
   }
 
   sliceChildShadowNodeViewPairsRecursivelyForTesting(
-      pairList, {0, 0}, shadowNode);
+      pairList, {0, 0}, shadowNode, cullingRect);
 
   return pairList;
 }
@@ -1621,6 +2227,10 @@ ShadowViewMutation::List calculateShadowViewMutations(
   react_native_assert(
       ShadowNode::sameFamily(oldRootShadowNode, newRootShadowNode));
 
+  // All scratch data-structures below are allocated from the arena, which is
+  // reset once the diff is done. Must outlive all of them.
+  DifferentiatorArena::Scope arenaScope{};
+
   // See explanation of scope in Differentiator.h.
   ViewNodePairScope viewNodePairScope{};
   ViewNodePairScope innerViewNodePairScope{};
@@ -1636,6 +2246,10 @@ ShadowViewMutation::List calculateShadowViewMutations(
         oldRootShadowView, newRootShadowView, {}));
   }
 
+  if (ShadowNode::sameChildren(oldRootShadowNode, newRootShadowNode)) {
+    return mutations;
+  }
+
   calculateShadowViewMutationsV2(
       innerViewNodePairScope,
       mutations,
@@ -9,6 +9,7 @@
 
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/debug/flags.h>
+#include <react/renderer/mounting/DifferentiatorArena.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
 #include <deque>
 
@@ -36,8 +37,12 @@ enum class ReparentMode { Flatten, Unflatten };
  * both (1) ensures that pointers into the data-structure are never invalidated,
  * and (2) tries to efficiently allocate storage such that as many objects as
  * possible are close in memory, but does not guarantee adjacency.
+ *
+ * During a diff, the storage comes from the thread's `DifferentiatorArena`.
  */
-using ViewNodePairScope = std::deque<ShadowViewNodePair>;
+using ViewNodePairScope = std::deque<
+    ShadowViewNodePair,
+    DifferentiatorArenaAllocator<ShadowViewNodePair>>;
 
 /*
  * Calculates a list of view mutations which describes how the old
@@ -51,19 +56,22 @@ ShadowViewMutation::List calculateShadowViewMutations(
 /**
  * Generates a list of `ShadowViewNodePair`s that represents a layer of a
  * flattened view hierarchy. The V2 version preserves nodes even if they do
- * not form views and their children are flattened.
+ * not form views and their children are flattened. Children wholly outside
+ * of `cullingRect` (if any) are left out.
  */
 ShadowViewNodePair::NonOwningList sliceChildShadowNodeViewPairsV2(
     const ShadowNode& shadowNode,
     ViewNodePairScope& viewNodePairScope,
     bool allowFlattened = false,
-    Point layoutOffset = {0, 0});
+    Point layoutOffset = {0, 0},
+    const std::optional<Rect>& cullingRect = std::nullopt);
 
 /*
  * Generates a list of `ShadowViewNodePair`s that represents a layer of a
  * flattened view hierarchy. This is *only* used by unit tests currently.
  */
 ShadowViewNodePair::OwningList sliceChildShadowNodeViewPairsForTesting(
-    const ShadowNode& shadowNode);
+    const ShadowNode& shadowNode,
+    const std::optional<Rect>& cullingRect = std::nullopt);
 
 } // namespace facebook::react
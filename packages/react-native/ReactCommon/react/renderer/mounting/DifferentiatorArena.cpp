@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "DifferentiatorArena.h"
+
+#include <react/debug/react_native_assert.h>
+#include <algorithm>
+#include <cstdint>
+
+namespace facebook::react {
+
+/*
+ * Size of a regular block; bigger allocations get a dedicated block.
+ */
+static constexpr size_t kBlockSize = 16 * 1024;
+
+/*
+ * Amount of memory that an arena keeps around between diffs. Blocks beyond
+ * that (allocated for exceptionally large diffs) are returned to the system.
+ */
+static constexpr size_t kMaximumRetainedSize = 256 * 1024;
+
+static thread_local DifferentiatorArena threadLocalArena;
+
+DifferentiatorArena::Scope::Scope()
+    : isOutermost_(!threadLocalArena.isActive_) {
+  threadLocalArena.isActive_ = true;
+}
+
+DifferentiatorArena::Scope::~Scope() {
+  if (isOutermost_) {
+    threadLocalArena.reset();
+    threadLocalArena.isActive_ = false;
+  }
+}
+
+DifferentiatorArena* DifferentiatorArena::current() noexcept {
+  return threadLocalArena.isActive_ ? &threadLocalArena : nullptr;
+}
+
+void* DifferentiatorArena::allocate(size_t size, size_t alignment) {
+  react_native_assert(isActive_);
+
+  if (blockIndex_ < blocks_.size()) {
+    auto& block = blocks_[blockIndex_];
+    auto address = reinterpret_cast<uintptr_t>(block.data.get()) + offset_;
+    auto padding = (alignment - address % alignment) % alignment;
+    if (offset_ + padding + size <= block.size) {
+      offset_ += padding + size;
+      return reinterpret_cast<void*>(address + padding);
+    }
+  }
+
+  // The current block is exhausted; find the next retained block that can
+  // fit the allocation or create a new one.
+  auto requiredSize = size + alignment;
+  auto nextBlockIndex = blockIndex_ + 1;
+  while (nextBlockIndex < blocks_.size() &&
+         blocks_[nextBlockIndex].size < requiredSize) {
+    nextBlockIndex++;
+  }
+
+  if (nextBlockIndex >= blocks_.size()) {
+    auto blockSize = std::max(kBlockSize, requiredSize);
+    blocks_.push_back(
+        Block{std::make_unique<std::byte[]>(blockSize), blockSize});
+    nextBlockIndex = blocks_.size() - 1;
+  }
+
+  blockIndex_ = nextBlockIndex;
+  offset_ = 0;
+  return allocate(size, alignment);
+}
+
+void DifferentiatorArena::reset() noexcept {
+  size_t retainedSize = 0;
+  size_t retainedCount = 0;
+  for (const auto& block : blocks_) {
+    if (retainedSize + block.size > kMaximumRetainedSize) {
+      break;
+    }
+    retainedSize += block.size;
+    retainedCount++;
+  }
+  blocks_.resize(retainedCount);
+
+  blockIndex_ = 0;
+  offset_ = 0;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * A per-thread bump allocator for the short-lived scratch data-structures
+ * that the Differentiator builds during a single diff (`ViewNodePairScope`s,
+ * `ShadowViewNodePair::NonOwningList`s, lookup maps).
+ *
+ * Nothing is freed individually; instead, the whole arena is rewound when the
+ * outermost `DifferentiatorArena::Scope` on the thread ends. Memory blocks are
+ * retained between diffs, so in steady state diffing does not hit the heap for
+ * scratch data at all.
+ */
+class DifferentiatorArena final {
+ public:
+  /*
+   * Makes the arena of the current thread active for the lifetime of the
+   * object. Scopes can be nested; the arena is reset when the outermost one
+   * is destroyed, so every container allocated from the arena must be
+   * destroyed before that.
+   */
+  class Scope final {
+   public:
+    Scope();
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    bool isOutermost_;
+  };
+
+  /*
+   * Returns the arena active on the current thread, or `nullptr` if there is
+   * no active `Scope` (in which case allocators fall back to the heap).
+   */
+  static DifferentiatorArena* current() noexcept;
+
+  void* allocate(size_t size, size_t alignment);
+
+ private:
+  struct Block {
+    std::unique_ptr<std::byte[]> data;
+    size_t size;
+  };
+
+  void reset() noexcept;
+
+  std::vector<Block> blocks_{};
+  size_t blockIndex_{0};
+  size_t offset_{0};
+  bool isActive_{false};
+};
+
+/*
+ * Standard-library compatible allocator which allocates from the
+ * `DifferentiatorArena` that was active on the thread when the allocator was
+ * created, and from the heap otherwise.
+ */
+template <typename T>
+class DifferentiatorArenaAllocator {
+ public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  DifferentiatorArenaAllocator() noexcept
+      : arena_(DifferentiatorArena::current()) {}
+
+  template <typename U>
+  DifferentiatorArenaAllocator(
+      const DifferentiatorArenaAllocator<U>& other) noexcept
+      : arena_(other.arena_) {}
+
+  T* allocate(size_t count) {
+    if (arena_ == nullptr) {
+      return std::allocator<T>{}.allocate(count);
+    }
+    return static_cast<T*>(arena_->allocate(count * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* pointer, size_t count) noexcept {
+    if (arena_ == nullptr) {
+      std::allocator<T>{}.deallocate(pointer, count);
+    }
+  }
+
+  template <typename U>
+  bool operator==(const DifferentiatorArenaAllocator<U>& rhs) const noexcept {
+    return arena_ == rhs.arena_;
+  }
+
+  template <typename U>
+  bool operator!=(const DifferentiatorArenaAllocator<U>& rhs) const noexcept {
+    return arena_ != rhs.arena_;
+  }
+
+ private:
+  template <typename U>
+  friend class DifferentiatorArenaAllocator;
+
+  DifferentiatorArena* arena_;
+};
+
+} // namespace facebook::react
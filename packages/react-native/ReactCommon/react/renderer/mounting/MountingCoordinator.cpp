@@ -16,10 +16,16 @@
 
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/debug/SystraceSection.h>
+#include <react/renderer/mounting/ProgressiveMounting.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
+#include <react/utils/CoreFeatures.h>
 
 namespace facebook::react {
 
+// Number of mutations of off-screen views mounted by a single transaction when
+// a transaction is mounted progressively.
+static constexpr size_t kProgressiveMountingChunkSize = 256;
+
 MountingCoordinator::MountingCoordinator(const ShadowTreeRevision& baseRevision)
     : surfaceId_(baseRevision.rootShadowNode->getSurfaceId()),
       baseRevision_(baseRevision),
@@ -34,7 +40,29 @@ SurfaceId MountingCoordinator::getSurfaceId() const {
   return surfaceId_;
 }
 
+// The platform is behind once it has been notified of two transactions it
+// hasn't mounted: one it is mounting and one waiting for it. Revisions are not
+// held back for longer than `kMaxHoldBackTime` though, in case the platform
+// doesn't report mounts (e.g. as the surface is not visible).
+constexpr auto kMaxUnmountedNotificationCount = 2;
+constexpr auto kMaxHoldBackTime = std::chrono::milliseconds(500);
+
+// Connects the commits of a surface to the transaction which mounts them in
+// traces. Flow ids are process-wide, so they are tagged to not collide with
+// other flows.
+static uint64_t commitFlowId(SurfaceId surfaceId) {
+  return (uint64_t{0x52454e44} << 32) | static_cast<uint32_t>(surfaceId);
+}
+
 void MountingCoordinator::push(ShadowTreeRevision revision) const {
+  SystraceSection section(
+      "MountingCoordinator::push",
+      "surfaceId",
+      surfaceId_,
+      "revision",
+      revision.number);
+  systraceFlowStep(commitFlowId(surfaceId_));
+
   {
     std::scoped_lock lock(mutex_);
 
@@ -57,13 +85,16 @@ void MountingCoordinator::revoke() const {
   // 2. A possible call to `pullTransaction()` should return empty optional.
   baseRevision_.rootShadowNode.reset();
   lastRevision_.reset();
+  pendingMutationChunks_.clear();
 }
 
 bool MountingCoordinator::waitForTransaction(
     std::chrono::duration<double> timeout) const {
   std::unique_lock<std::mutex> lock(mutex_);
   return signal_.wait_for(
-      lock, timeout, [this]() { return lastRevision_.has_value(); });
+      lock, timeout, [this]() {
+        return lastRevision_.has_value() || !pendingMutationChunks_.empty();
+      });
 }
 
 void MountingCoordinator::updateBaseRevision(
@@ -77,12 +108,30 @@ void MountingCoordinator::resetLatestRevision() const {
 
 std::optional<MountingTransaction> MountingCoordinator::pullTransaction()
     const {
-  SystraceSection section("MountingCoordinator::pullTransaction");
+  SystraceSection section(
+      "MountingCoordinator::pullTransaction", "surfaceId", surfaceId_);
 
   std::scoped_lock lock(mutex_);
 
   auto transaction = std::optional<MountingTransaction>{};
 
+  // Remaining chunks of a progressively mounted transaction go first; newer
+  // revisions are diffed against the base revision which includes them.
+  if (!pendingMutationChunks_.empty()) {
+    number_++;
+
+    auto telemetry = TransactionTelemetry{};
+    telemetry.setRevisionNumber(static_cast<int>(baseRevision_.number));
+
+    transaction = MountingTransaction{
+        surfaceId_,
+        number_,
+        std::move(pendingMutationChunks_.front()),
+        telemetry};
+    pendingMutationChunks_.pop_front();
+    return transaction;
+  }
+
   // Base case
   if (lastRevision_.has_value()) {
     number_++;
@@ -95,17 +144,21 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction()
         *baseRevision_.rootShadowNode, *lastRevision_->rootShadowNode);
 
     telemetry.didDiff();
+    systraceFlowEnd(commitFlowId(surfaceId_));
 
     transaction = MountingTransaction{
         surfaceId_, number_, std::move(mutations), telemetry};
   }
 
   // Override case
-  auto mountingOverrideDelegate = mountingOverrideDelegate_.lock();
-  auto shouldOverridePullTransaction = mountingOverrideDelegate &&
-      mountingOverrideDelegate->shouldOverridePullTransaction();
+  auto shouldOverridePullTransaction = false;
+  for (const auto& weakMountingOverrideDelegate : mountingOverrideDelegates_) {
+    auto mountingOverrideDelegate = weakMountingOverrideDelegate.lock();
+    if (!mountingOverrideDelegate ||
+        !mountingOverrideDelegate->shouldOverridePullTransaction()) {
+      continue;
+    }
 
-  if (shouldOverridePullTransaction) {
     auto mutations = ShadowViewMutation::List{};
     auto telemetry = TransactionTelemetry{};
 
@@ -113,7 +166,9 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction()
       mutations = transaction->getMutations();
       telemetry = transaction->getTelemetry();
     } else {
-      number_++;
+      if (!shouldOverridePullTransaction) {
+        number_++;
+      }
       telemetry.willLayout();
       telemetry.didLayout();
       telemetry.willCommit();
@@ -122,10 +177,21 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction()
       telemetry.didDiff();
     }
 
+    shouldOverridePullTransaction = true;
     transaction = mountingOverrideDelegate->pullTransaction(
         surfaceId_, number_, telemetry, std::move(mutations));
   }
 
+  // Pending revisions are already coalesced by diffing the base revision with
+  // the last one, but mutations that the override delegate merges in (e.g.
+  // final frames of interrupted animations) can still cancel each other out.
+  if (CoreFeatures::enableMountingTransactionCompaction &&
+      transaction.has_value()) {
+    SystraceSection compactionSection(
+        "MountingCoordinator::pullTransaction::compactMutations");
+    transaction->compactMutations();
+  }
+
 #ifdef RN_SHADOW_TREE_INTROSPECTION
   if (transaction.has_value()) {
     // We have something to validate.
@@ -171,6 +237,31 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction()
   }
 #endif
 
+  // Splitting happens after the validation above which tracks whole
+  // transactions.
+  if (CoreFeatures::enableProgressiveMounting && transaction.has_value() &&
+      !shouldOverridePullTransaction && lastRevision_.has_value()) {
+    SystraceSection progressiveMountingSection(
+        "MountingCoordinator::pullTransaction::splitMutations");
+    const auto& rootShadowNode = *lastRevision_->rootShadowNode;
+    auto chunks = splitMutationsForProgressiveMounting(
+        transaction->getMutations(),
+        rootShadowNode.getTag(),
+        Rect{{0, 0}, rootShadowNode.getLayoutMetrics().frame.size},
+        kProgressiveMountingChunkSize);
+    if (!chunks.empty()) {
+      transaction = MountingTransaction{
+          surfaceId_,
+          transaction->getNumber(),
+          std::move(chunks.front()),
+          transaction->getTelemetry()};
+      pendingMutationChunks_.insert(
+          pendingMutationChunks_.end(),
+          std::make_move_iterator(chunks.begin() + 1),
+          std::make_move_iterator(chunks.end()));
+    }
+  }
+
   if (lastRevision_.has_value()) {
     baseRevision_ = std::move(*lastRevision_);
     lastRevision_.reset();
@@ -178,8 +269,50 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction()
   return transaction;
 }
 
+bool MountingCoordinator::shouldNotifyOfPushedRevision(
+    bool mountSynchronously) const {
+  if (!CoreFeatures::enableCommitLoadShedding) {
+    return true;
+  }
+
+  std::scoped_lock lock(mutex_);
+
+  auto now = std::chrono::steady_clock::now();
+  if (!mountSynchronously &&
+      unmountedNotificationCount_ >= kMaxUnmountedNotificationCount &&
+      now - firstUnmountedNotificationTime_ < kMaxHoldBackTime) {
+    SystraceSection section(
+        "MountingCoordinator::holdBackRevision", "surfaceId", surfaceId_);
+    hasHeldBackRevision_ = true;
+    return false;
+  }
+
+  if (unmountedNotificationCount_ == 0) {
+    firstUnmountedNotificationTime_ = now;
+  }
+  unmountedNotificationCount_++;
+  hasHeldBackRevision_ = false;
+  return true;
+}
+
+bool MountingCoordinator::didMountTransactions() const {
+  std::scoped_lock lock(mutex_);
+
+  if (!hasHeldBackRevision_ || !lastRevision_.has_value()) {
+    unmountedNotificationCount_ = 0;
+    hasHeldBackRevision_ = false;
+    return false;
+  }
+
+  // The caller notifies the platform of the held back revisions.
+  unmountedNotificationCount_ = 1;
+  firstUnmountedNotificationTime_ = std::chrono::steady_clock::now();
+  hasHeldBackRevision_ = false;
+  return true;
+}
+
 bool MountingCoordinator::hasPendingTransactions() const {
-  return lastRevision_.has_value();
+  return lastRevision_.has_value() || !pendingMutationChunks_.empty();
 }
 
 const TelemetryController& MountingCoordinator::getTelemetryController() const {
@@ -190,10 +323,10 @@ const ShadowTreeRevision& MountingCoordinator::getBaseRevision() const {
   return baseRevision_;
 }
 
-void MountingCoordinator::setMountingOverrideDelegate(
+void MountingCoordinator::addMountingOverrideDelegate(
     std::weak_ptr<const MountingOverrideDelegate> delegate) const {
   std::scoped_lock lock(mutex_);
-  mountingOverrideDelegate_ = std::move(delegate);
+  mountingOverrideDelegates_.push_back(std::move(delegate));
 }
 
 } // namespace facebook::react
@@ -9,7 +9,9 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <optional>
+#include <vector>
 
 #include <react/renderer/debug/flags.h>
 #include <react/renderer/mounting/Differentiator.h>
@@ -52,6 +54,10 @@ class MountingCoordinator final {
    * The returning transaction can accumulate multiple recent revisions of a
    * shadow tree. Returns empty optional if there no new shadow tree revision to
    * mount.
+   * With `CoreFeatures::enableProgressiveMounting`, a transaction that mounts
+   * a large number of new views gets split: views within the viewport of the
+   * surface are returned first and the rest is returned in chunks by
+   * following calls, before any newer revision.
    * The method is thread-safe and can be called from any thread.
    * However, a consumer should always call it on the same thread (e.g. on the
    * main thread) or ensure sequentiality of mount transactions separately.
@@ -81,6 +87,14 @@ class MountingCoordinator final {
 
   const ShadowTreeRevision& getBaseRevision() const;
 
+  /*
+   * Reports that the host platform mounted the transactions pulled so far.
+   * Returns `true` if revisions were held back meanwhile (see
+   * `shouldNotifyOfPushedRevision`), in which case the platform must be
+   * notified again to mount them.
+   */
+  bool didMountTransactions() const;
+
   /*
    * Methods from this section are meant to be used by
    * `MountingOverrideDelegate` only.
@@ -89,7 +103,12 @@ class MountingCoordinator final {
   void updateBaseRevision(const ShadowTreeRevision& baseRevision) const;
   void resetLatestRevision() const;
 
-  void setMountingOverrideDelegate(
+  /*
+   * Adds a delegate which can override pulled transactions. Delegates are
+   * consulted in the order they were added; each one receives the mutations
+   * returned by the previous ones.
+   */
+  void addMountingOverrideDelegate(
       std::weak_ptr<const MountingOverrideDelegate> delegate) const;
 
   /*
@@ -100,6 +119,18 @@ class MountingCoordinator final {
 
   void push(ShadowTreeRevision revision) const;
 
+  /*
+   * Returns whether the host platform should be notified to mount the
+   * revision pushed last. With `CoreFeatures::enableCommitLoadShedding`,
+   * revisions committed while the platform has yet to mount the transactions
+   * it was notified of before are held back until it reports they were
+   * mounted (see `didMountTransactions`), so the revisions committed in the
+   * meantime are never diffed: the platform mounts the newest one, diffed
+   * against the last mounted revision directly.
+   * Revisions which must be mounted synchronously are never held back.
+   */
+  bool shouldNotifyOfPushedRevision(bool mountSynchronously) const;
+
   /*
    * Revokes the last pushed `ShadowTreeRevision`.
    * Generating a `MountingTransaction` requires some resources which the
@@ -117,8 +148,18 @@ class MountingCoordinator final {
   mutable std::optional<ShadowTreeRevision> lastRevision_{};
   mutable MountingTransaction::Number number_{0};
   mutable std::condition_variable signal_;
-  mutable std::weak_ptr<const MountingOverrideDelegate>
-      mountingOverrideDelegate_;
+  mutable std::vector<std::weak_ptr<const MountingOverrideDelegate>>
+      mountingOverrideDelegates_;
+
+  // Chunks of a progressively mounted transaction which are yet to be pulled.
+  mutable std::deque<ShadowViewMutation::List> pendingMutationChunks_{};
+
+  // Notifications of the platform since it last reported a mount, see
+  // `shouldNotifyOfPushedRevision`.
+  mutable int unmountedNotificationCount_{0};
+  mutable std::chrono::steady_clock::time_point
+      firstUnmountedNotificationTime_{};
+  mutable bool hasHeldBackRevision_{false};
 
   TelemetryController telemetryController_;
 
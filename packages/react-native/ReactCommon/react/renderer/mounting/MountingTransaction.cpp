@@ -7,10 +7,36 @@
 
 #include "MountingTransaction.h"
 
+#include <limits>
+#include <unordered_map>
+
 namespace facebook::react {
 
 using Number = MountingTransaction::Number;
 
+static constexpr auto kNoIndex = std::numeric_limits<size_t>::max();
+
+namespace {
+
+/*
+ * Describes what the compaction pass knows about a view at the current
+ * position in the list of mutations.
+ */
+struct CompactionRecord {
+  /*
+   * Index of the `Create` mutation of the view if all mutations of the view
+   * since then were `Update`s.
+   */
+  size_t createIndex{kNoIndex};
+
+  /*
+   * Index of the last mutation of the view if it is an `Update`.
+   */
+  size_t updateIndex{kNoIndex};
+};
+
+} // namespace
+
 MountingTransaction::MountingTransaction(
     SurfaceId surfaceId,
     Number number,
@@ -41,4 +67,93 @@ Number MountingTransaction::getNumber() const {
   return number_;
 }
 
+void MountingTransaction::compactMutations() {
+  if (mutations_.size() < 2) {
+    return;
+  }
+
+  auto records = std::unordered_map<Tag, CompactionRecord>{};
+  records.reserve(mutations_.size());
+
+  auto dropped = std::vector<bool>(mutations_.size(), false);
+  auto droppedCount = size_t{0};
+  auto drop = [&](size_t index) {
+    dropped[index] = true;
+    droppedCount++;
+  };
+
+  for (size_t index = 0; index < mutations_.size(); index++) {
+    auto& mutation = mutations_[index];
+
+    switch (mutation.type) {
+      case ShadowViewMutation::Create: {
+        records[mutation.newChildShadowView.tag] =
+            CompactionRecord{index, kNoIndex};
+        break;
+      }
+
+      case ShadowViewMutation::Delete: {
+        auto& record = records[mutation.oldChildShadowView.tag];
+        if (record.createIndex != kNoIndex) {
+          // The view was created and deleted without ever being mounted.
+          drop(record.createIndex);
+          if (record.updateIndex != kNoIndex) {
+            drop(record.updateIndex);
+          }
+          drop(index);
+        }
+        record = CompactionRecord{};
+        break;
+      }
+
+      case ShadowViewMutation::Update: {
+        auto& record = records[mutation.newChildShadowView.tag];
+        if (record.updateIndex != kNoIndex) {
+          // Nothing happened to the view since the previous `Update`, so both
+          // can be applied at once.
+          mutation.oldChildShadowView =
+              std::move(mutations_[record.updateIndex].oldChildShadowView);
+          drop(record.updateIndex);
+          record.updateIndex = kNoIndex;
+        }
+        if (mutation.oldChildShadowView == mutation.newChildShadowView) {
+          drop(index);
+        } else {
+          record.updateIndex = index;
+        }
+        break;
+      }
+
+      case ShadowViewMutation::Insert:
+      case ShadowViewMutation::Remove:
+      case ShadowViewMutation::RemoveDeleteTree: {
+        // Mutations of the child and the parent view cannot be moved across
+        // this one.
+        auto childTag = mutation.type == ShadowViewMutation::Insert
+            ? mutation.newChildShadowView.tag
+            : mutation.oldChildShadowView.tag;
+        records[childTag] = CompactionRecord{};
+        records[mutation.parentShadowView.tag] = CompactionRecord{};
+        break;
+      }
+    }
+  }
+
+  if (droppedCount == 0) {
+    return;
+  }
+
+  size_t keptCount = 0;
+  for (size_t index = 0; index < mutations_.size(); index++) {
+    if (dropped[index]) {
+      continue;
+    }
+    if (keptCount != index) {
+      mutations_[keptCount] = std::move(mutations_[index]);
+    }
+    keptCount++;
+  }
+  mutations_.erase(mutations_.begin() + keptCount, mutations_.end());
+}
+
 } // namespace facebook::react
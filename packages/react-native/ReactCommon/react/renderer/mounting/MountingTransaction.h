@@ -76,6 +76,15 @@ class MountingTransaction final {
    */
   Number getNumber() const;
 
+  /*
+   * Removes mutations which cancel each other out: a `Create` followed by a
+   * `Delete` of a view that was never inserted in between, and chains of
+   * `Update`s of the same view that are not interleaved with other mutations
+   * of that view (those are collapsed into a single `Update`).
+   * The resulting list produces the same view tree as the original one.
+   */
+  void compactMutations();
+
  private:
   SurfaceId surfaceId_;
   Number number_;
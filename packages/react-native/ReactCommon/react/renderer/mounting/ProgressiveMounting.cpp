@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ProgressiveMounting.h"
+
+#include <react/debug/react_native_assert.h>
+
+#include <unordered_map>
+#include <unordered_set>
+
+namespace facebook::react {
+
+namespace {
+
+struct InsertedView {
+  Point origin{};
+  std::vector<Tag> children{};
+};
+
+} // namespace
+
+std::vector<ShadowViewMutation::List> splitMutationsForProgressiveMounting(
+    const ShadowViewMutation::List& mutations,
+    Tag rootTag,
+    const Rect& viewport,
+    size_t maximumChunkSize) {
+  react_native_assert(maximumChunkSize > 0);
+
+  if (mutations.size() <= maximumChunkSize) {
+    return {};
+  }
+
+  auto createdTags = std::unordered_set<Tag>{};
+  for (const auto& mutation : mutations) {
+    if (mutation.type == ShadowViewMutation::Create) {
+      createdTags.insert(mutation.newChildShadowView.tag);
+    }
+  }
+
+  // Absolute positions are only known for views which are inserted into the
+  // root or into views created in this transaction.
+  auto views = std::unordered_map<Tag, InsertedView>{};
+  views[rootTag] = InsertedView{};
+  for (const auto& mutation : mutations) {
+    switch (mutation.type) {
+      case ShadowViewMutation::Create:
+        break;
+      case ShadowViewMutation::Update:
+        if (createdTags.find(mutation.newChildShadowView.tag) !=
+            createdTags.end()) {
+          return {};
+        }
+        break;
+      case ShadowViewMutation::Insert: {
+        auto parentTag = mutation.parentShadowView.tag;
+        if (parentTag != rootTag &&
+            createdTags.find(parentTag) == createdTags.end()) {
+          return {};
+        }
+        views[parentTag].children.push_back(mutation.newChildShadowView.tag);
+        views[mutation.newChildShadowView.tag].origin =
+            mutation.newChildShadowView.layoutMetrics.frame.origin;
+        break;
+      }
+      default:
+        return {};
+    }
+  }
+
+  // Walking the tree top-down; once a child of a view is off-screen, it and
+  // all its following siblings are deferred together with their subtrees.
+  auto deferredTags = std::unordered_set<Tag>{};
+  auto stack = std::vector<std::pair<Tag, Point>>{{rootTag, Point{}}};
+  while (!stack.empty()) {
+    auto [tag, origin] = stack.back();
+    stack.pop_back();
+
+    auto isDeferring = deferredTags.find(tag) != deferredTags.end();
+    for (auto childTag : views[tag].children) {
+      auto childOrigin = origin + views[childTag].origin;
+      if (!isDeferring &&
+          (childOrigin.y >= viewport.getMaxY() ||
+           childOrigin.x >= viewport.getMaxX())) {
+        isDeferring = true;
+      }
+      if (isDeferring) {
+        deferredTags.insert(childTag);
+      }
+      stack.emplace_back(childTag, childOrigin);
+    }
+  }
+
+  if (deferredTags.empty()) {
+    return {};
+  }
+
+  // Both chunks keep the original order of mutations, so every `Insert` still
+  // follows the `Create` of its parent and child and preceding siblings.
+  auto chunks = std::vector<ShadowViewMutation::List>{1};
+  for (const auto& mutation : mutations) {
+    auto tag = mutation.newChildShadowView.tag;
+    if (deferredTags.find(tag) == deferredTags.end()) {
+      chunks.front().push_back(mutation);
+      continue;
+    }
+
+    if (chunks.size() == 1 || chunks.back().size() >= maximumChunkSize) {
+      chunks.emplace_back();
+      chunks.back().reserve(maximumChunkSize);
+    }
+    chunks.back().push_back(mutation);
+  }
+
+  return chunks;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <react/renderer/graphics/Rect.h>
+#include <react/renderer/mounting/ShadowViewMutation.h>
+
+namespace facebook::react {
+
+/*
+ * Splits mutations of a transaction that only mounts new views (e.g. the
+ * initial render of a surface) into chunks that can be mounted one after
+ * another: the first chunk contains everything that is laid out within
+ * `viewport`, the rest contain off-screen views in chunks of at most
+ * `maximumChunkSize` mutations.
+ * A view is considered off-screen when its origin (relative to the root view
+ * with tag `rootTag`) lies below or to the right of the viewport. Siblings that
+ * follow an off-screen view are deferred too so that insertion indices stay
+ * valid.
+ * Returns an empty list if mutations cannot be (or do not need to be) split.
+ */
+std::vector<ShadowViewMutation::List> splitMutationsForProgressiveMounting(
+    const ShadowViewMutation::List& mutations,
+    Tag rootTag,
+    const Rect& viewport,
+    size_t maximumChunkSize);
+
+} // namespace facebook::react
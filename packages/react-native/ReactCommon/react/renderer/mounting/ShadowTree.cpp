@@ -17,6 +17,7 @@
 #include <react/renderer/mounting/ShadowViewMutation.h>
 #include <react/renderer/telemetry/TransactionTelemetry.h>
 #include <react/utils/CoreFeatures.h>
+#include <yoga/event/event.h>
 
 #include "ShadowTreeDelegate.h"
 
@@ -273,6 +274,36 @@ static void updateMountedFlag(
   }
 }
 
+/*
+ * Records how many layouts and measurements of Yoga nodes were served from
+ * their caches in the telemetry of the transaction being committed on the
+ * thread, once a layout pass finishes.
+ */
+static void recordLayoutCacheLookUps(
+    YGNodeConstRef /*node*/,
+    yoga::Event::Type type,
+    yoga::Event::Data data) {
+  if (type != yoga::Event::LayoutPassEnd) {
+    return;
+  }
+
+  auto telemetry = TransactionTelemetry::threadLocalTelemetry();
+  const auto* layoutData = data.get<yoga::Event::LayoutPassEnd>().layoutData;
+  if (telemetry == nullptr || layoutData == nullptr) {
+    return;
+  }
+
+  auto numberOfHits = 0;
+  for (auto count : layoutData->cacheHitReasonsCount) {
+    numberOfHits += count;
+  }
+  auto numberOfMisses = 0;
+  for (auto count : layoutData->cacheMissReasonsCount) {
+    numberOfMisses += count;
+  }
+  telemetry->didLookUpLayoutCache(numberOfHits, numberOfMisses);
+}
+
 ShadowTree::ShadowTree(
     SurfaceId surfaceId,
     const LayoutConstraints& layoutConstraints,
@@ -280,6 +311,12 @@ ShadowTree::ShadowTree(
     const ShadowTreeDelegate& delegate,
     const ContextContainer& contextContainer)
     : surfaceId_(surfaceId), delegate_(delegate) {
+  // Yoga provides no way to unsubscribe, so this is done once for all trees.
+  static std::once_flag subscribeOnceFlag;
+  std::call_once(subscribeOnceFlag, [] {
+    yoga::Event::subscribe(&recordLayoutCacheLookUps);
+  });
+
   static auto globalRootComponentDescriptor =
       std::make_unique<const RootComponentDescriptor>(
           ComponentDescriptorParameters{
@@ -353,15 +390,22 @@ CommitStatus ShadowTree::commit(
   SystraceSection s("ShadowTree::commit");
 
   [[maybe_unused]] int attempts = 0;
+  const auto& telemetryController =
+      mountingCoordinator_->getTelemetryController();
 
   while (true) {
     attempts++;
 
     auto status = tryCommit(transaction, commitOptions);
+    if (status == CommitStatus::Cancelled) {
+      telemetryController.didCancelCommit();
+    }
     if (status != CommitStatus::Failed) {
       return status;
     }
 
+    telemetryController.didRetryCommit();
+
     // After multiple attempts, we failed to commit the transaction.
     // Something internally went terribly wrong.
     react_native_assert(attempts < 1024);
@@ -371,7 +415,7 @@ CommitStatus ShadowTree::commit(
 CommitStatus ShadowTree::tryCommit(
     const ShadowTreeCommitTransaction& transaction,
     const CommitOptions& commitOptions) const {
-  SystraceSection s("ShadowTree::tryCommit");
+  SystraceSection s("ShadowTree::tryCommit", "surfaceId", surfaceId_);
 
   auto telemetry = TransactionTelemetry{};
   telemetry.willCommit();
@@ -397,6 +441,11 @@ CommitStatus ShadowTree::tryCommit(
     return CommitStatus::Cancelled;
   }
 
+  if (CoreFeatures::enableOptimisticShadowTreeCommit &&
+      isRevisionStale(oldRevision)) {
+    return CommitStatus::Failed;
+  }
+
   if (commitOptions.enableStateReconciliation) {
     if (CoreFeatures::enableClonelessStateProgression) {
       progressStateIfNecessary(*newRootShadowNode, *oldRootShadowNode);
@@ -411,8 +460,10 @@ CommitStatus ShadowTree::tryCommit(
   }
 
   // Run commit hooks.
+  telemetry.setAsThreadLocal();
   newRootShadowNode = delegate_.shadowTreeWillCommit(
       *this, oldRootShadowNode, newRootShadowNode);
+  telemetry.unsetAsThreadLocal();
 
   if (!newRootShadowNode ||
       (commitOptions.shouldYield && commitOptions.shouldYield())) {
@@ -429,6 +480,70 @@ CommitStatus ShadowTree::tryCommit(
   telemetry.unsetAsThreadLocal();
   telemetry.didLayout(static_cast<int>(affectedLayoutableNodes.size()));
 
+  if (CoreFeatures::enableOptimisticShadowTreeCommit) {
+    if (isRevisionStale(oldRevision)) {
+      return CommitStatus::Failed;
+    }
+
+    // Sealing does not depend on the current revision, so it's done before
+    // acquiring the lock.
+    newRootShadowNode->sealRecursive();
+
+    auto mountedFlagLock = std::unique_lock<std::mutex>{};
+
+    {
+      // Publishing the new revision only if the base revision is still the
+      // current one (compare-and-swap); otherwise `commit` retries, rebasing
+      // the transaction (and reconciling the state) on the current revision.
+      std::unique_lock lock(commitMutex_);
+
+      if (commitOptions.shouldYield && commitOptions.shouldYield()) {
+        return CommitStatus::Cancelled;
+      }
+
+      if (currentRevision_.number != oldRevision.number) {
+        return CommitStatus::Failed;
+      }
+
+      auto newRevisionNumber = currentRevision_.number + 1;
+
+      telemetry.didCommit();
+      telemetry.setRevisionNumber(static_cast<int>(newRevisionNumber));
+
+      newRevision = ShadowTreeRevision{
+          std::move(newRootShadowNode), newRevisionNumber, telemetry};
+
+      currentRevision_ = newRevision;
+      currentRevisionNumber_.store(
+          newRevisionNumber, std::memory_order_release);
+      if (!commitOptions.enableStateReconciliation) {
+        lastRevisionNumberWithNewState_ = newRevisionNumber;
+      }
+
+      // Acquired before releasing `commitMutex_` so consecutive commits update
+      // `mounted` flags in the order of their revisions.
+      mountedFlagLock = std::unique_lock(mountedFlagMutex_);
+    }
+
+    {
+      std::scoped_lock dispatchLock(EventEmitter::DispatchMutex());
+
+      updateMountedFlag(
+          oldRevision.rootShadowNode->getChildren(),
+          newRevision.rootShadowNode->getChildren());
+    }
+
+    mountedFlagLock.unlock();
+
+    emitLayoutEvents(affectedLayoutableNodes);
+
+    if (commitMode == CommitMode::Normal) {
+      mount(std::move(newRevision), commitOptions.mountSynchronously);
+    }
+
+    return CommitStatus::Succeeded;
+  }
+
   {
     // Updating `currentRevision_` in unique manner if it hasn't changed.
     std::unique_lock lock(commitMutex_);
@@ -471,6 +586,7 @@ CommitStatus ShadowTree::tryCommit(
         std::move(newRootShadowNode), newRevisionNumber, telemetry};
 
     currentRevision_ = newRevision;
+    currentRevisionNumber_.store(newRevisionNumber, std::memory_order_release);
     if (!commitOptions.enableStateReconciliation) {
       lastRevisionNumberWithNewState_ = newRevisionNumber;
     }
@@ -485,6 +601,11 @@ CommitStatus ShadowTree::tryCommit(
   return CommitStatus::Succeeded;
 }
 
+bool ShadowTree::isRevisionStale(const ShadowTreeRevision& revision) const {
+  return currentRevisionNumber_.load(std::memory_order_acquire) !=
+      revision.number;
+}
+
 ShadowTreeRevision ShadowTree::getCurrentRevision() const {
   std::shared_lock lock(commitMutex_);
   return currentRevision_;
@@ -493,6 +614,10 @@ ShadowTreeRevision ShadowTree::getCurrentRevision() const {
 void ShadowTree::mount(ShadowTreeRevision revision, bool mountSynchronously)
     const {
   mountingCoordinator_->push(std::move(revision));
+  if (!mountingCoordinator_->shouldNotifyOfPushedRevision(
+          mountSynchronously)) {
+    return;
+  }
   delegate_.shadowTreeDidFinishTransaction(
       mountingCoordinator_, mountSynchronously);
 }
@@ -7,7 +7,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 
 #include <react/renderer/components/root/RootComponentDescriptor.h>
 #include <react/renderer/components/root/RootShadowNode.h>
@@ -138,6 +140,12 @@ class ShadowTree final {
 
   void mount(ShadowTreeRevision revision, bool mountSynchronously) const;
 
+  /*
+   * Returns `true` if a newer revision was committed after `revision`.
+   * Does not acquire `commitMutex_`.
+   */
+  bool isRevisionStale(const ShadowTreeRevision& revision) const;
+
   void emitLayoutEvents(
       std::vector<const LayoutableShadowNode*>& affectedLayoutableNodes) const;
 
@@ -149,6 +157,19 @@ class ShadowTree final {
   mutable ShadowTreeRevision currentRevision_; // Protected by `commitMutex_`.
   mutable ShadowTreeRevision::Number
       lastRevisionNumberWithNewState_; // Protected by `commitMutex_`.
+
+  /*
+   * Mirrors `currentRevision_.number`; allows optimistic commits to detect a
+   * stale base revision without acquiring `commitMutex_`.
+   */
+  mutable std::atomic<ShadowTreeRevision::Number> currentRevisionNumber_{
+      INITIAL_REVISION};
+
+  /*
+   * Orders `mounted` flag updates of optimistic commits, which happen after
+   * `commitMutex_` is released.
+   */
+  mutable std::mutex mountedFlagMutex_;
   MountingCoordinator::Shared mountingCoordinator_;
 };
 
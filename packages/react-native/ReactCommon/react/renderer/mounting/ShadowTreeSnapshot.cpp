@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ShadowTreeSnapshot.h"
+
+#include <react/renderer/core/ComponentDescriptor.h>
+#include <react/renderer/core/LayoutableShadowNode.h>
+
+#include <cerrno>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <unistd.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr size_t kChunkSize = 16 * 1024;
+
+class SnapshotWriter final {
+ public:
+  explicit SnapshotWriter(const ShadowTreeSnapshotSink& sink) : sink_(sink) {
+    buffer_.reserve(kChunkSize + 256);
+  }
+
+  void append(std::string_view string) {
+    buffer_.append(string);
+    flushIfNeeded();
+  }
+
+  void appendString(std::string_view string) {
+    buffer_.push_back('"');
+    for (auto character : string) {
+      if (character == '"' || character == '\\') {
+        buffer_.push_back('\\');
+        buffer_.push_back(character);
+      } else if (static_cast<unsigned char>(character) < 0x20) {
+        char escaped[8];
+        snprintf(escaped, sizeof(escaped), "\\u%04x", character);
+        buffer_.append(escaped);
+      } else {
+        buffer_.push_back(character);
+      }
+    }
+    buffer_.push_back('"');
+    flushIfNeeded();
+  }
+
+  void appendInteger(int64_t value) {
+    char string[24];
+    snprintf(string, sizeof(string), "%" PRId64, value);
+    append(string);
+  }
+
+  void appendNumber(Float value) {
+    if (!std::isfinite(value)) {
+      append("null");
+      return;
+    }
+    char string[32];
+    snprintf(string, sizeof(string), "%.1f", static_cast<double>(value));
+    append(string);
+  }
+
+  /*
+   * Passes what is buffered to the sink; returns `false` if the sink aborted
+   * writing now or earlier.
+   */
+  bool flush() {
+    if (!failed_ && !buffer_.empty()) {
+      failed_ = !sink_(buffer_);
+    }
+    buffer_.clear();
+    return !failed_;
+  }
+
+ private:
+  void flushIfNeeded() {
+    if (buffer_.size() >= kChunkSize) {
+      flush();
+    }
+  }
+
+  const ShadowTreeSnapshotSink& sink_;
+  std::string buffer_;
+  bool failed_{false};
+};
+
+struct ComponentMemory {
+  size_t numberOfNodes{0};
+  size_t retainedBytes{0};
+};
+
+} // namespace
+
+bool writeShadowTreeSnapshot(
+    SurfaceId surfaceId,
+    const ShadowTreeRevision& revision,
+    const ShadowTreeSnapshotSink& sink) {
+  auto writer = SnapshotWriter{sink};
+
+  writer.append("{\"surfaceId\":");
+  writer.appendInteger(surfaceId);
+  writer.append(",\"revision\":");
+  writer.appendInteger(revision.number);
+  writer.append(
+      ",\"nodeFields\":[\"tag\",\"parentTag\",\"component\",\"propsBytes\","
+      "\"stateBytes\",\"x\",\"y\",\"width\",\"height\",\"nodeOwners\","
+      "\"propsOwners\"],\"nodes\":[");
+
+  auto memoryByComponent =
+      std::unordered_map<std::string_view, ComponentMemory>{};
+  auto countedProps = std::unordered_set<const Props*>{};
+  auto countedStates = std::unordered_set<const State*>{};
+
+  struct StackEntry {
+    const ShadowNode* shadowNode;
+    const ShadowNode* parentShadowNode;
+    long numberOfOwners;
+  };
+  auto stack = std::vector<StackEntry>{};
+  if (revision.rootShadowNode) {
+    stack.push_back({
+        revision.rootShadowNode.get(),
+        nullptr,
+        revision.rootShadowNode.use_count(),
+    });
+  }
+
+  auto isFirstNode = true;
+  while (!stack.empty()) {
+    auto [shadowNodePointer, parentShadowNode, numberOfOwners] = stack.back();
+    stack.pop_back();
+    const auto& shadowNode = *shadowNodePointer;
+
+    const auto& componentDescriptor = shadowNode.getComponentDescriptor();
+    auto sizes = componentDescriptor.getShallowSizes();
+    const auto& props = shadowNode.getProps();
+    const auto& state = shadowNode.getState();
+    auto propsBytes = props ? sizes.props : 0;
+    auto stateBytes = state ? sizes.state : 0;
+
+    auto& memory = memoryByComponent[shadowNode.getComponentName()];
+    memory.numberOfNodes++;
+    memory.retainedBytes += sizes.shadowNode;
+    if (props && countedProps.insert(props.get()).second) {
+      memory.retainedBytes += propsBytes;
+    }
+    if (state && countedStates.insert(state.get()).second) {
+      memory.retainedBytes += stateBytes;
+    }
+
+    writer.append(isFirstNode ? "[" : ",[");
+    isFirstNode = false;
+    writer.appendInteger(shadowNode.getTag());
+    writer.append(",");
+    if (parentShadowNode != nullptr) {
+      writer.appendInteger(parentShadowNode->getTag());
+    } else {
+      writer.append("null");
+    }
+    writer.append(",");
+    writer.appendString(shadowNode.getComponentName());
+    writer.append(",");
+    writer.appendInteger(static_cast<int64_t>(propsBytes));
+    writer.append(",");
+    writer.appendInteger(static_cast<int64_t>(stateBytes));
+    writer.append(",");
+    const auto* layoutableShadowNode =
+        dynamic_cast<const LayoutableShadowNode*>(&shadowNode);
+    if (layoutableShadowNode != nullptr) {
+      auto frame = layoutableShadowNode->getLayoutMetrics().frame;
+      writer.appendNumber(frame.origin.x);
+      writer.append(",");
+      writer.appendNumber(frame.origin.y);
+      writer.append(",");
+      writer.appendNumber(frame.size.width);
+      writer.append(",");
+      writer.appendNumber(frame.size.height);
+    } else {
+      writer.append("null,null,null,null");
+    }
+    writer.append(",");
+    writer.appendInteger(numberOfOwners);
+    writer.append(",");
+    writer.appendInteger(props ? props.use_count() : 0);
+    writer.append("]");
+
+    // Children are pushed in reverse to be visited in order.
+    const auto& children = shadowNode.getChildren();
+    for (auto it = children.rbegin(); it != children.rend(); ++it) {
+      stack.push_back({it->get(), &shadowNode, it->use_count()});
+    }
+  }
+
+  writer.append("],\"components\":{");
+  auto isFirstComponent = true;
+  for (const auto& [componentName, memory] : memoryByComponent) {
+    if (!isFirstComponent) {
+      writer.append(",");
+    }
+    isFirstComponent = false;
+    writer.appendString(componentName);
+    writer.append(":{\"nodes\":");
+    writer.appendInteger(static_cast<int64_t>(memory.numberOfNodes));
+    writer.append(",\"retainedBytes\":");
+    writer.appendInteger(static_cast<int64_t>(memory.retainedBytes));
+    writer.append("}");
+  }
+  writer.append("}}\n");
+
+  return writer.flush();
+}
+
+bool writeShadowTreeSnapshot(
+    SurfaceId surfaceId,
+    const ShadowTreeRevision& revision,
+    int fileDescriptor) {
+  return writeShadowTreeSnapshot(
+      surfaceId, revision, [fileDescriptor](std::string_view chunk) {
+        while (!chunk.empty()) {
+          auto written = ::write(fileDescriptor, chunk.data(), chunk.size());
+          if (written < 0) {
+            if (errno == EINTR) {
+              continue;
+            }
+            return false;
+          }
+          chunk.remove_prefix(static_cast<size_t>(written));
+        }
+        return true;
+      });
+}
+
+} // namespace facebook::react
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/core/ReactPrimitives.h>
+#include <react/renderer/mounting/ShadowTreeRevision.h>
+
+#include <functional>
+#include <string_view>
+
+namespace facebook::react {
+
+/*
+ * Receives consecutive chunks of a snapshot; returns `false` to abort writing.
+ */
+using ShadowTreeSnapshotSink = std::function<bool(std::string_view chunk)>;
+
+/*
+ * Writes a compact JSON description of a revision of the shadow tree of a
+ * surface to `sink`, in chunks of bounded size, so that the description is
+ * never built in memory as a whole. Available in all builds.
+ *
+ * The snapshot has the shape
+ *   {"surfaceId":1,"revision":42,"nodeFields":[...],"nodes":[[...],...],
+ *    "components":{"View":{"nodes":10,"retainedBytes":9000},...}}
+ * where every node (in pre-order) is an array with values of `nodeFields`:
+ * tag, tag of the parent (or `null`), component name, shallow sizes of props
+ * and state, frame (x, y, width and height, or `null`s for nodes which are
+ * not layoutable) and the numbers of owners of the node and of its props;
+ * more than one owner means that it's shared with other revisions or nodes.
+ * `retainedBytes` is the sum of shallow sizes of the nodes of the component,
+ * and of their props and states counted once even if they are shared.
+ *
+ * Returns `false` if `sink` aborted writing.
+ */
+bool writeShadowTreeSnapshot(
+    SurfaceId surfaceId,
+    const ShadowTreeRevision& revision,
+    const ShadowTreeSnapshotSink& sink);
+
+/*
+ * Writes the snapshot to an open file descriptor (e.g. of a file attached to
+ * a memory warning report). Returns `false` if writing failed.
+ */
+bool writeShadowTreeSnapshot(
+    SurfaceId surfaceId,
+    const ShadowTreeRevision& revision,
+    int fileDescriptor);
+
+} // namespace facebook::react
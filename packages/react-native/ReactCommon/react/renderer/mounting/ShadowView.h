@@ -13,8 +13,11 @@
 #include <react/renderer/core/ReactPrimitives.h>
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/debug/flags.h>
+#include <react/renderer/mounting/DifferentiatorArena.h>
 #include <react/utils/hash_combine.h>
 
+#include <optional>
+
 namespace facebook::react {
 
 /*
@@ -63,7 +66,9 @@ std::vector<DebugStringConvertibleObject> getDebugProps(
  *
  */
 struct ShadowViewNodePair final {
-  using NonOwningList = std::vector<ShadowViewNodePair*>;
+  using NonOwningList = std::vector<
+      ShadowViewNodePair*,
+      DifferentiatorArenaAllocator<ShadowViewNodePair*>>;
   using OwningList = std::vector<ShadowViewNodePair>;
 
   ShadowView shadowView;
@@ -72,6 +77,13 @@ struct ShadowViewNodePair final {
   bool isConcreteView{true};
   Point contextOrigin{0, 0};
 
+  /*
+   * The rectangle (in the coordinate space of the node) outside of which
+   * the children of the node are not mounted, if the parent of the node
+   * windows its content.
+   */
+  std::optional<Rect> cullingRect{};
+
   size_t mountIndex{0};
 
   /**
@@ -8,10 +8,10 @@
 #pragma once
 
 #include <memory>
-#include <unordered_map>
 
 #include <react/renderer/mounting/ShadowViewMutation.h>
 #include <react/renderer/mounting/StubView.h>
+#include <react/utils/FlatMap.h>
 
 namespace facebook::react {
 
@@ -36,7 +36,7 @@ class StubViewTree {
 
  private:
   Tag rootTag_{};
-  std::unordered_map<Tag, StubView::Shared> registry_{};
+  FlatMap<Tag, StubView::Shared> registry_{};
 
   friend bool operator==(const StubViewTree& lhs, const StubViewTree& rhs);
   friend bool operator!=(const StubViewTree& lhs, const StubViewTree& rhs);
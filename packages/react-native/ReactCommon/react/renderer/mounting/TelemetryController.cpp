@@ -7,7 +7,9 @@
 
 #include "TelemetryController.h"
 
+#include <react/renderer/debug/SystraceSection.h>
 #include <react/renderer/mounting/MountingCoordinator.h>
+#include <react/renderer/telemetry/FrameHistory.h>
 
 namespace facebook::react {
 
@@ -27,7 +29,32 @@ bool TelemetryController::pullTransaction(
   auto transaction = std::move(*optional);
 
   auto& telemetry = transaction.getTelemetry();
-  auto numberOfMutations = static_cast<int>(transaction.getMutations().size());
+  const auto& mutations = transaction.getMutations();
+  auto numberOfMutations = static_cast<int>(mutations.size());
+
+  auto mutationCounts = SurfaceTelemetry::MutationCounts{};
+  for (const auto& mutation : mutations) {
+    switch (mutation.type) {
+      case ShadowViewMutation::Create:
+        mutationCounts.creates++;
+        break;
+      case ShadowViewMutation::Delete:
+        mutationCounts.deletes++;
+        break;
+      case ShadowViewMutation::Insert:
+        mutationCounts.inserts++;
+        break;
+      case ShadowViewMutation::Remove:
+        mutationCounts.removes++;
+        break;
+      case ShadowViewMutation::Update:
+        mutationCounts.updates++;
+        break;
+      case ShadowViewMutation::RemoveDeleteTree:
+        mutationCounts.removeDeleteTrees++;
+        break;
+    }
+  }
 
   mutex_.lock();
   auto compoundTelemetry = compoundTelemetry_;
@@ -35,19 +62,75 @@ bool TelemetryController::pullTransaction(
 
   willMount(transaction, compoundTelemetry);
 
-  telemetry.willMount();
-  doMount(transaction, compoundTelemetry);
-  telemetry.didMount();
+  {
+    SystraceSection section(
+        "TelemetryController::mount",
+        "surfaceId",
+        transaction.getSurfaceId(),
+        "revision",
+        transaction.getNumber(),
+        "numberOfMutations",
+        numberOfMutations);
+    telemetry.willMount();
+    doMount(transaction, compoundTelemetry);
+    telemetry.didMount();
+  }
 
-  compoundTelemetry.incorporate(telemetry, numberOfMutations);
+  // Incorporating into the shared telemetry rather than replacing it with the
+  // copy, so counters recorded by other threads while mounting are kept.
+  mutex_.lock();
+  compoundTelemetry_.incorporate(telemetry, numberOfMutations);
+  compoundTelemetry_.incorporateMutationCounts(mutationCounts);
+  compoundTelemetry = compoundTelemetry_;
+  auto numberOfCommits =
+      static_cast<int>(transaction.getNumber() - lastTransactionNumber_);
+  lastTransactionNumber_ = transaction.getNumber();
+  mutex_.unlock();
 
   didMount(transaction, compoundTelemetry);
 
-  mutex_.lock();
-  compoundTelemetry_ = compoundTelemetry;
-  mutex_.unlock();
+  FrameHistory::getInstance().record(FrameRecord{
+      transaction.getSurfaceId(),
+      telemetry.getCommitStartTime(),
+      telemetry.getMountEndTime(),
+      numberOfCommits,
+      numberOfMutations,
+      telemetry.getCommitEndTime() - telemetry.getCommitStartTime(),
+      telemetry.getDiffEndTime() - telemetry.getDiffStartTime(),
+      telemetry.getLayoutEndTime() - telemetry.getLayoutStartTime(),
+      telemetry.getMountEndTime() - telemetry.getMountStartTime()});
 
   return true;
 }
 
+SurfaceTelemetry TelemetryController::getSurfaceTelemetry() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return compoundTelemetry_;
+}
+
+void TelemetryController::didRunMountHook(
+    const char* hookName,
+    TelemetryDuration duration) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  compoundTelemetry_.incorporateMountHookTime(hookName, duration);
+}
+
+void TelemetryController::didCancelCommit() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  compoundTelemetry_.incorporateCancelledCommit();
+}
+
+void TelemetryController::didRetryCommit() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  compoundTelemetry_.incorporateRetriedCommit();
+}
+
+void TelemetryController::didMountViews(
+    int numberOfCreatedViews,
+    int numberOfRecycledViews) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  compoundTelemetry_.incorporateViews(
+      numberOfCreatedViews, numberOfRecycledViews);
+}
+
 } // namespace facebook::react
@@ -43,15 +43,44 @@ class TelemetryController final {
  public:
   /*
    * Calls `MountingCoordinator::pullTransaction()` and aggregates telemetry.
+   * Also records the transaction in `FrameHistory`.
    */
   bool pullTransaction(
       const MountingTransactionCallback& willMount,
       const MountingTransactionCallback& doMount,
       const MountingTransactionCallback& didMount) const;
 
+  /*
+   * Returns a snapshot of the telemetry aggregated over the transactions
+   * pulled so far. Thread-safe.
+   */
+  SurfaceTelemetry getSurfaceTelemetry() const;
+
+  /*
+   * Records the time spent in a `UIManagerMountHook` after a transaction of
+   * the surface was mounted. Thread-safe.
+   */
+  void didRunMountHook(const char* hookName, TelemetryDuration duration)
+      const;
+
+  /*
+   * Records a commit of the surface which was cancelled, or which has to be
+   * retried. Thread-safe.
+   */
+  void didCancelCommit() const;
+  void didRetryCommit() const;
+
+  /*
+   * Records the views the platform created from scratch or took from a
+   * recycle pool to mount a transaction of the surface. Thread-safe.
+   */
+  void didMountViews(int numberOfCreatedViews, int numberOfRecycledViews)
+      const;
+
  private:
   const MountingCoordinator& mountingCoordinator_;
   mutable SurfaceTelemetry compoundTelemetry_{};
+  mutable MountingTransaction::Number lastTransactionNumber_{0};
   mutable std::mutex mutex_;
 };
 
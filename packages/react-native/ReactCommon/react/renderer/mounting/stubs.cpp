@@ -54,8 +54,8 @@ static void calculateShadowViewMutationsForNewTree(
     mutations.push_back(ShadowViewMutation::InsertMutation(
         parentShadowView, newChildPair.shadowView, static_cast<int>(index)));
 
-    auto newGrandChildPairs =
-        sliceChildShadowNodeViewPairsForTesting(*newChildPair.shadowNode);
+    auto newGrandChildPairs = sliceChildShadowNodeViewPairsForTesting(
+        *newChildPair.shadowNode, newChildPair.cullingRect);
 
     calculateShadowViewMutationsForNewTree(
         mutations, newChildPair.shadowView, newGrandChildPairs);
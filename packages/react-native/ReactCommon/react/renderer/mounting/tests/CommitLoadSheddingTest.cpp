@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/mounting/MountingCoordinator.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/utils/CoreFeatures.h>
+
+using namespace facebook::react;
+
+namespace {
+
+class CountingShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& /*shadowTree*/,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode) const override {
+    return newRootShadowNode;
+  };
+
+  void shadowTreeDidFinishTransaction(
+      MountingCoordinator::Shared /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override {
+    transactionCount++;
+  };
+
+  mutable int transactionCount{0};
+};
+
+} // namespace
+
+class CommitLoadSheddingTest : public ::testing::Test {
+ protected:
+  CommitLoadSheddingTest() : builder_(simpleComponentBuilder()) {
+    CoreFeatures::enableCommitLoadShedding = true;
+
+    // clang-format off
+    auto element =
+        Element<RootShadowNode>()
+          .children({
+            Element<ViewShadowNode>()
+          });
+    // clang-format on
+
+    rootShadowNode_ = builder_.build(element);
+  }
+
+  ~CommitLoadSheddingTest() override {
+    CoreFeatures::enableCommitLoadShedding = false;
+  }
+
+  // Commits a clone of the current tree, as React does.
+  void commitFromReact(const ShadowTree& shadowTree) {
+    shadowTree.commit(
+        [](const RootShadowNode& oldRootShadowNode) {
+          return std::static_pointer_cast<RootShadowNode>(
+              oldRootShadowNode.ShadowNode::clone({}));
+        },
+        {/* .enableStateReconciliation = */ true,
+         /* .mountSynchronously = */ false});
+  }
+
+  ComponentBuilder builder_;
+  std::shared_ptr<RootShadowNode> rootShadowNode_;
+  ContextContainer contextContainer_{};
+  CountingShadowTreeDelegate delegate_{};
+};
+
+TEST_F(CommitLoadSheddingTest, holdsBackCommitsUntilPlatformMounted) {
+  ShadowTree shadowTree{
+      SurfaceId{11},
+      LayoutConstraints{},
+      LayoutContext{},
+      delegate_,
+      contextContainer_};
+  shadowTree.commit(
+      [&](const RootShadowNode& /*oldRootShadowNode*/) {
+        return rootShadowNode_;
+      },
+      {true});
+  const auto& mountingCoordinator = *shadowTree.getMountingCoordinator();
+  EXPECT_EQ(delegate_.transactionCount, 1);
+
+  // The platform is notified of one more commit, and then falls behind.
+  commitFromReact(shadowTree);
+  commitFromReact(shadowTree);
+  commitFromReact(shadowTree);
+  EXPECT_EQ(delegate_.transactionCount, 2);
+
+  // The platform mounts everything committed so far in a single transaction.
+  EXPECT_TRUE(mountingCoordinator.didMountTransactions());
+  EXPECT_TRUE(mountingCoordinator.pullTransaction().has_value());
+  EXPECT_FALSE(mountingCoordinator.pullTransaction().has_value());
+  EXPECT_EQ(
+      mountingCoordinator.getBaseRevision().number,
+      shadowTree.getCurrentRevision().number);
+
+  // Nothing is held back anymore.
+  EXPECT_FALSE(mountingCoordinator.didMountTransactions());
+  commitFromReact(shadowTree);
+  EXPECT_EQ(delegate_.transactionCount, 3);
+}
+
+TEST_F(CommitLoadSheddingTest, neverHoldsBackSynchronousCommits) {
+  ShadowTree shadowTree{
+      SurfaceId{11},
+      LayoutConstraints{},
+      LayoutContext{},
+      delegate_,
+      contextContainer_};
+  shadowTree.commit(
+      [&](const RootShadowNode& /*oldRootShadowNode*/) {
+        return rootShadowNode_;
+      },
+      {true});
+  commitFromReact(shadowTree);
+  EXPECT_EQ(delegate_.transactionCount, 2);
+
+  shadowTree.commit(
+      [](const RootShadowNode& oldRootShadowNode) {
+        return std::static_pointer_cast<RootShadowNode>(
+            oldRootShadowNode.ShadowNode::clone({}));
+      },
+      {/* .enableStateReconciliation = */ true,
+       /* .mountSynchronously = */ true});
+  EXPECT_EQ(delegate_.transactionCount, 3);
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/view/ViewProps.h>
+#include <react/renderer/mounting/MountingTransaction.h>
+#include <react/renderer/mounting/StubViewTree.h>
+
+namespace facebook::react {
+
+static ShadowView makeShadowView(Tag tag) {
+  auto shadowView = ShadowView{};
+  shadowView.surfaceId = 1;
+  shadowView.tag = tag;
+  shadowView.props = std::make_shared<const ViewProps>();
+  return shadowView;
+}
+
+static ShadowView makeUpdatedShadowView(ShadowView shadowView) {
+  shadowView.props = std::make_shared<const ViewProps>();
+  return shadowView;
+}
+
+static MountingTransaction makeTransaction(
+    ShadowViewMutation::List mutations) {
+  return MountingTransaction{1, 1, std::move(mutations), {}};
+}
+
+TEST(MountingTransactionTest, dropsCreateDeletePairs) {
+  auto root = makeShadowView(1);
+  auto mounted = makeShadowView(2);
+  auto transient = makeShadowView(3);
+  auto transientUpdated = makeUpdatedShadowView(transient);
+
+  auto mutations = ShadowViewMutation::List{
+      ShadowViewMutation::CreateMutation(mounted),
+      ShadowViewMutation::CreateMutation(transient),
+      ShadowViewMutation::InsertMutation(root, mounted, 0),
+      ShadowViewMutation::UpdateMutation(transient, transientUpdated, {}),
+      ShadowViewMutation::DeleteMutation(transientUpdated)};
+
+  auto transaction = makeTransaction(mutations);
+  transaction.compactMutations();
+
+  const auto& compacted = transaction.getMutations();
+  ASSERT_EQ(compacted.size(), 2);
+  EXPECT_EQ(compacted[0].type, ShadowViewMutation::Create);
+  EXPECT_EQ(compacted[0].newChildShadowView.tag, 2);
+  EXPECT_EQ(compacted[1].type, ShadowViewMutation::Insert);
+
+  auto originalViewTree = StubViewTree{root};
+  originalViewTree.mutate(mutations);
+  auto compactedViewTree = StubViewTree{root};
+  compactedViewTree.mutate(compacted);
+  EXPECT_EQ(originalViewTree, compactedViewTree);
+}
+
+TEST(MountingTransactionTest, keepsCreateDeletePairsOfMountedViews) {
+  auto root = makeShadowView(1);
+  auto child = makeShadowView(2);
+
+  auto transaction = makeTransaction(
+      {ShadowViewMutation::CreateMutation(child),
+       ShadowViewMutation::InsertMutation(root, child, 0),
+       ShadowViewMutation::RemoveMutation(root, child, 0),
+       ShadowViewMutation::DeleteMutation(child)});
+  transaction.compactMutations();
+
+  EXPECT_EQ(transaction.getMutations().size(), 4);
+}
+
+TEST(MountingTransactionTest, collapsesChainsOfUpdates) {
+  auto root = makeShadowView(1);
+  auto child = makeShadowView(2);
+  auto grandchild = makeShadowView(3);
+  auto childUpdated = makeUpdatedShadowView(child);
+  auto childUpdatedTwice = makeUpdatedShadowView(childUpdated);
+
+  auto mutations = ShadowViewMutation::List{
+      ShadowViewMutation::CreateMutation(child),
+      ShadowViewMutation::InsertMutation(root, child, 0),
+      ShadowViewMutation::CreateMutation(grandchild),
+      ShadowViewMutation::UpdateMutation(child, childUpdated, root),
+      ShadowViewMutation::UpdateMutation(childUpdated, childUpdatedTwice, root),
+      ShadowViewMutation::InsertMutation(child, grandchild, 0),
+      ShadowViewMutation::UpdateMutation(childUpdatedTwice, child, root)};
+
+  auto transaction = makeTransaction(mutations);
+  transaction.compactMutations();
+
+  // The last `Update` is separated from the others by an `Insert` into the
+  // view, so only the first two collapse.
+  const auto& compacted = transaction.getMutations();
+  ASSERT_EQ(compacted.size(), 6);
+  EXPECT_EQ(compacted[3].type, ShadowViewMutation::Update);
+  EXPECT_EQ(compacted[3].oldChildShadowView, child);
+  EXPECT_EQ(compacted[3].newChildShadowView, childUpdatedTwice);
+  EXPECT_EQ(compacted[4].type, ShadowViewMutation::Insert);
+  EXPECT_EQ(compacted[5].type, ShadowViewMutation::Update);
+  EXPECT_EQ(compacted[5].oldChildShadowView, childUpdatedTwice);
+  EXPECT_EQ(compacted[5].newChildShadowView, child);
+
+  auto originalViewTree = StubViewTree{root};
+  originalViewTree.mutate(mutations);
+  auto compactedViewTree = StubViewTree{root};
+  compactedViewTree.mutate(compacted);
+  EXPECT_EQ(originalViewTree, compactedViewTree);
+}
+
+TEST(MountingTransactionTest, dropsUpdatesThatCancelEachOtherOut) {
+  auto root = makeShadowView(1);
+  auto child = makeShadowView(2);
+  auto childUpdated = makeUpdatedShadowView(child);
+
+  auto transaction = makeTransaction(
+      {ShadowViewMutation::UpdateMutation(child, childUpdated, root),
+       ShadowViewMutation::UpdateMutation(childUpdated, child, root)});
+  transaction.compactMutations();
+
+  EXPECT_TRUE(transaction.getMutations().empty());
+}
+
+} // namespace facebook::react
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/view/ViewProps.h>
+#include <react/renderer/mounting/ProgressiveMounting.h>
+#include <react/renderer/mounting/StubViewTree.h>
+
+namespace facebook::react {
+
+static ShadowView makeShadowView(Tag tag, Rect frame) {
+  auto shadowView = ShadowView{};
+  shadowView.surfaceId = 1;
+  shadowView.tag = tag;
+  shadowView.props = std::make_shared<const ViewProps>();
+  shadowView.layoutMetrics.frame = frame;
+  return shadowView;
+}
+
+static const auto kViewport = Rect{{0, 0}, {100, 100}};
+
+// A container with `count` rows which are 30 points tall each.
+static ShadowViewMutation::List makeInitialRenderMutations(
+    const ShadowView& root,
+    size_t count) {
+  auto container = makeShadowView(2, {{0, 0}, {100, 30.0f * count}});
+  auto rows = std::vector<ShadowView>{};
+  for (size_t index = 0; index < count; index++) {
+    rows.push_back(makeShadowView(
+        static_cast<Tag>(3 + index), {{0, 30.0f * index}, {100, 30}}));
+  }
+
+  auto mutations =
+      ShadowViewMutation::List{ShadowViewMutation::CreateMutation(container)};
+  for (const auto& row : rows) {
+    mutations.push_back(ShadowViewMutation::CreateMutation(row));
+  }
+  mutations.push_back(ShadowViewMutation::InsertMutation(root, container, 0));
+  for (size_t index = 0; index < rows.size(); index++) {
+    mutations.push_back(ShadowViewMutation::InsertMutation(
+        container, rows[index], static_cast<int>(index)));
+  }
+  return mutations;
+}
+
+TEST(ProgressiveMountingTest, mountsVisibleViewsFirst) {
+  auto root = makeShadowView(1, kViewport);
+  auto mutations = makeInitialRenderMutations(root, 10);
+
+  auto chunks =
+      splitMutationsForProgressiveMounting(mutations, 1, kViewport, 4);
+
+  // Rows at 0, 30, 60 and 90 intersect the viewport.
+  ASSERT_EQ(chunks.size(), 4);
+  EXPECT_EQ(chunks[0].size(), 10);
+  for (const auto& mutation : chunks[0]) {
+    EXPECT_LE(mutation.newChildShadowView.tag, 6);
+  }
+  EXPECT_EQ(chunks[1].size(), 4);
+  EXPECT_EQ(chunks[2].size(), 4);
+  EXPECT_EQ(chunks[3].size(), 4);
+
+  auto viewTree = StubViewTree{root};
+  viewTree.mutate(mutations);
+  auto progressiveViewTree = StubViewTree{root};
+  for (const auto& chunk : chunks) {
+    progressiveViewTree.mutate(chunk);
+  }
+  EXPECT_EQ(viewTree, progressiveViewTree);
+}
+
+TEST(ProgressiveMountingTest, keepsSmallTransactions) {
+  auto root = makeShadowView(1, kViewport);
+  auto mutations = makeInitialRenderMutations(root, 10);
+
+  EXPECT_TRUE(splitMutationsForProgressiveMounting(
+                  mutations, 1, kViewport, mutations.size())
+                  .empty());
+}
+
+TEST(ProgressiveMountingTest, keepsTransactionsThatFitIntoViewport) {
+  auto root = makeShadowView(1, kViewport);
+  auto mutations = makeInitialRenderMutations(root, 3);
+
+  EXPECT_TRUE(
+      splitMutationsForProgressiveMounting(mutations, 1, kViewport, 2).empty());
+}
+
+TEST(ProgressiveMountingTest, keepsTransactionsWhichRemoveViews) {
+  auto root = makeShadowView(1, kViewport);
+  auto mutations = makeInitialRenderMutations(root, 10);
+  auto mounted = makeShadowView(100, kViewport);
+  mutations.push_back(ShadowViewMutation::RemoveMutation(root, mounted, 1));
+
+  EXPECT_TRUE(
+      splitMutationsForProgressiveMounting(mutations, 1, kViewport, 4).empty());
+}
+
+} // namespace facebook::react
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/scrollview/ScrollViewComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/renderer/mounting/stubs.h>
+
+namespace facebook::react {
+
+static void setFrame(LayoutableShadowNode& shadowNode, Rect frame) {
+  auto layoutMetrics = EmptyLayoutMetrics;
+  layoutMetrics.frame = frame;
+  shadowNode.setLayoutMetrics(layoutMetrics);
+}
+
+class ScrollViewWindowingTest : public ::testing::Test {
+ protected:
+  ComponentBuilder builder_;
+  std::shared_ptr<RootShadowNode> rootShadowNode_;
+  std::shared_ptr<ScrollViewShadowNode> scrollViewShadowNode_;
+
+  ScrollViewWindowingTest() : builder_(simpleComponentBuilder()) {}
+
+  // A 100x100 ScrollView with ten 100x100 cells stacked vertically.
+  void build_(bool nativeWindowing) {
+    auto cells = std::vector<ElementFragment>{};
+    for (int index = 0; index < 10; index++) {
+      cells.push_back(
+          Element<ViewShadowNode>()
+              .tag(10 + index)
+              .props([] {
+                auto props = std::make_shared<ViewShadowNodeProps>();
+                props->collapsable = false;
+                return props;
+              })
+              .finalize([=](ViewShadowNode& shadowNode) {
+                setFrame(shadowNode, {{0, Float(100 * index)}, {100, 100}});
+              }));
+    }
+
+    // clang-format off
+    auto element =
+        Element<RootShadowNode>()
+          .reference(rootShadowNode_)
+          .tag(1)
+          .children({
+            Element<ScrollViewShadowNode>()
+              .reference(scrollViewShadowNode_)
+              .tag(2)
+              .props([=] {
+                auto props = std::make_shared<ScrollViewProps>();
+                props->experimental_nativeWindowing = nativeWindowing;
+                props->experimental_nativeWindowingOverscan = 0;
+                return props;
+              })
+              .finalize([](ScrollViewShadowNode& shadowNode) {
+                setFrame(shadowNode, {{0, 0}, {100, 100}});
+              })
+              .children({
+                Element<ViewShadowNode>()
+                  .tag(3)
+                  .props([] {
+                    auto props = std::make_shared<ViewShadowNodeProps>();
+                    props->collapsable = false;
+                    return props;
+                  })
+                  .finalize([](ViewShadowNode& shadowNode) {
+                    setFrame(shadowNode, {{0, 0}, {100, 1000}});
+                  })
+                  .children(cells)
+              })
+          });
+    // clang-format on
+
+    builder_.build(element);
+  }
+
+  std::shared_ptr<RootShadowNode> scrollTo_(Point contentOffset) {
+    auto& family = scrollViewShadowNode_->getFamily();
+    auto stateData = scrollViewShadowNode_->getStateData();
+    stateData.contentOffset = contentOffset;
+    auto state = scrollViewShadowNode_->getComponentDescriptor().createState(
+        family, std::make_shared<const ScrollViewState>(stateData));
+    return std::static_pointer_cast<RootShadowNode>(rootShadowNode_->cloneTree(
+        family, [&](const ShadowNode& oldShadowNode) {
+          return oldShadowNode.clone(
+              {ShadowNodeFragment::propsPlaceholder(),
+               ShadowNodeFragment::childrenPlaceholder(),
+               state});
+        }));
+  }
+
+  static std::vector<Tag> mountedCellTags_(const StubViewTree& viewTree) {
+    auto tags = std::vector<Tag>{};
+    for (const auto& child : viewTree.getStubView(3).children) {
+      tags.push_back(child->tag);
+    }
+    return tags;
+  }
+};
+
+TEST_F(ScrollViewWindowingTest, allCellsAreMountedByDefault) {
+  build_(false);
+
+  auto viewTree = buildStubViewTreeUsingDifferentiator(*rootShadowNode_);
+
+  EXPECT_EQ(viewTree.getStubView(3).children.size(), 10);
+  EXPECT_EQ(
+      viewTree, buildStubViewTreeWithoutUsingDifferentiator(*rootShadowNode_));
+}
+
+TEST_F(ScrollViewWindowingTest, onlyVisibleCellsAreMounted) {
+  build_(true);
+
+  auto viewTree = buildStubViewTreeUsingDifferentiator(*rootShadowNode_);
+
+  EXPECT_EQ(mountedCellTags_(viewTree), std::vector<Tag>{10});
+  // The root, the ScrollView, its content container, and the cell.
+  EXPECT_EQ(viewTree.size(), 4);
+  EXPECT_EQ(
+      viewTree, buildStubViewTreeWithoutUsingDifferentiator(*rootShadowNode_));
+}
+
+TEST_F(ScrollViewWindowingTest, cellsAreMountedAndUnmountedOnScroll) {
+  build_(true);
+
+  auto viewTree = buildStubViewTreeUsingDifferentiator(*rootShadowNode_);
+
+  auto scrolledRootShadowNode = scrollTo_({0, 250});
+  viewTree.mutate(
+      calculateShadowViewMutations(*rootShadowNode_, *scrolledRootShadowNode));
+
+  EXPECT_EQ(mountedCellTags_(viewTree), (std::vector<Tag>{12, 13}));
+  EXPECT_EQ(viewTree.size(), 5);
+  EXPECT_EQ(
+      viewTree,
+      buildStubViewTreeWithoutUsingDifferentiator(*scrolledRootShadowNode));
+}
+
+} // namespace facebook::react
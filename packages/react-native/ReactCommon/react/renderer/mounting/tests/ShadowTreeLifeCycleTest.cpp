@@ -16,6 +16,7 @@
 #include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/mounting/Differentiator.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
+#include <react/utils/CoreFeatures.h>
 
 #include <react/renderer/mounting/stubs.h>
 #include <react/test_utils/Entropy.h>
@@ -402,6 +403,28 @@ TEST(
       /* stages */ 32);
 }
 
+TEST(ShadowTreeLifecycleTest, stableBiggerTreeFewerIterationsMinimalMoves) {
+  CoreFeatures::enableDifferentiatorMinimalMoves = true;
+  testShadowNodeTreeLifeCycle(
+      /* seed */ 0,
+      /* size */ 512,
+      /* repeats */ 32,
+      /* stages */ 32);
+  CoreFeatures::enableDifferentiatorMinimalMoves = false;
+}
+
+TEST(
+    ShadowTreeLifecycleTest,
+    unstableSmallerTreeMoreIterationsExtensiveFlatteningUnflatteningMinimalMoves) {
+  CoreFeatures::enableDifferentiatorMinimalMoves = true;
+  testShadowNodeTreeLifeCycleExtensiveFlatteningUnflattening(
+      /* seed */ 1337,
+      /* size */ 32,
+      /* repeats */ 512,
+      /* stages */ 32);
+  CoreFeatures::enableDifferentiatorMinimalMoves = false;
+}
+
 // You may uncomment this - locally only! - to generate failing seeds.
 // TEST(
 //     ShadowTreeLifecycleTest,
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <string>
+
+#include <folly/json.h>
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/mounting/ShadowTreeSnapshot.h>
+
+namespace facebook::react {
+
+class ShadowTreeSnapshotTest : public ::testing::Test {
+ protected:
+  ShadowTreeSnapshotTest() : builder_(simpleComponentBuilder()) {
+    // clang-format off
+    auto element =
+        Element<RootShadowNode>()
+          .reference(rootShadowNode_)
+          .tag(1)
+          .children({
+            Element<ViewShadowNode>()
+              .tag(2)
+              .children({
+                Element<ViewShadowNode>()
+                  .tag(3)
+              }),
+            Element<ViewShadowNode>()
+              .tag(4)
+          });
+    // clang-format on
+
+    builder_.build(element);
+    rootShadowNode_->layoutIfNeeded();
+  }
+
+  ComponentBuilder builder_;
+  std::shared_ptr<RootShadowNode> rootShadowNode_;
+};
+
+TEST_F(ShadowTreeSnapshotTest, describesNodesAndComponents) {
+  auto revision = ShadowTreeRevision{rootShadowNode_, 7, {}};
+
+  auto snapshot = std::string{};
+  auto numberOfChunks = 0;
+  EXPECT_TRUE(writeShadowTreeSnapshot(
+      11, revision, [&](std::string_view chunk) {
+        snapshot.append(chunk);
+        numberOfChunks++;
+        return true;
+      }));
+  EXPECT_EQ(numberOfChunks, 1);
+
+  auto json = folly::parseJson(snapshot);
+  EXPECT_EQ(json["surfaceId"].asInt(), 11);
+  EXPECT_EQ(json["revision"].asInt(), 7);
+
+  const auto& nodes = json["nodes"];
+  ASSERT_EQ(nodes.size(), 4);
+  // Nodes are listed in pre-order: tag, parent tag, component name.
+  EXPECT_EQ(nodes[0][0].asInt(), 1);
+  EXPECT_TRUE(nodes[0][1].isNull());
+  EXPECT_EQ(nodes[0][2].asString(), "RootView");
+  EXPECT_EQ(nodes[1][0].asInt(), 2);
+  EXPECT_EQ(nodes[2][0].asInt(), 3);
+  EXPECT_EQ(nodes[2][1].asInt(), 2);
+  EXPECT_EQ(nodes[3][0].asInt(), 4);
+  EXPECT_EQ(nodes[3][1].asInt(), 1);
+  EXPECT_EQ(nodes[3][2].asString(), "View");
+  EXPECT_GT(nodes[3][3].asInt(), 0);
+
+  const auto& view = json["components"]["View"];
+  EXPECT_EQ(view["nodes"].asInt(), 3);
+  EXPECT_GE(
+      view["retainedBytes"].asInt(),
+      3 * static_cast<int64_t>(sizeof(ViewShadowNode)));
+}
+
+TEST_F(ShadowTreeSnapshotTest, stopsWhenSinkFails) {
+  auto revision = ShadowTreeRevision{rootShadowNode_, 1, {}};
+
+  EXPECT_FALSE(writeShadowTreeSnapshot(
+      1, revision, [](std::string_view /*chunk*/) { return false; }));
+}
+
+} // namespace facebook::react
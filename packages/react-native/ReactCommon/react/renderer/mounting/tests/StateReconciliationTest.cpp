@@ -295,6 +295,60 @@ TEST_P(StateReconciliationTest, testCloneslessStateReconciliationDoesntClone) {
     EXPECT_EQ(scrollViewShadowNode, newlyClonedShadowNode.get());
   }
 }
+TEST_P(StateReconciliationTest, testOptimisticCommitRetriesStaleRevision) {
+  CoreFeatures::enableOptimisticShadowTreeCommit = true;
+
+  auto shadowNodeA = std::shared_ptr<RootShadowNode>{};
+
+  // clang-format off
+  auto element =
+      Element<RootShadowNode>()
+        .reference(shadowNodeA)
+        .children({
+          Element<ViewShadowNode>()
+        });
+  // clang-format on
+
+  ContextContainer contextContainer{};
+
+  auto shadowNode = builder_.build(element);
+
+  auto shadowTreeDelegate = DummyShadowTreeDelegate{};
+  ShadowTree shadowTree{
+      SurfaceId{11},
+      LayoutConstraints{},
+      LayoutContext{},
+      shadowTreeDelegate,
+      contextContainer};
+
+  auto cloneRoot = [&](const RootShadowNode& oldRootShadowNode) {
+    return std::static_pointer_cast<RootShadowNode>(
+        oldRootShadowNode.ShadowNode::clone(
+            {ShadowNodeFragment::propsPlaceholder(),
+             std::make_shared<ShadowNode::ListOfShared>(
+                 shadowNode->getChildren())}));
+  };
+
+  // A concurrent commit lands while the transaction is being computed, so the
+  // first attempt is based on a stale revision.
+  auto attempts = 0;
+  auto status = shadowTree.commit(
+      [&](const RootShadowNode& oldRootShadowNode) {
+        attempts++;
+        if (attempts == 1) {
+          shadowTree.commit(cloneRoot, {true});
+        }
+        return cloneRoot(oldRootShadowNode);
+      },
+      {true});
+
+  EXPECT_EQ(status, ShadowTree::CommitStatus::Succeeded);
+  EXPECT_EQ(attempts, 2);
+  EXPECT_EQ(shadowTree.getCurrentRevision().number, 2);
+
+  CoreFeatures::enableOptimisticShadowTreeCommit = false;
+}
+
 INSTANTIATE_TEST_SUITE_P(
     StateReconciliationTestInstantiation,
     StateReconciliationTest,
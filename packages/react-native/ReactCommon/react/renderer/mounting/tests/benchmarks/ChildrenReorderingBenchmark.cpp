@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/EventDispatcher.h>
+#include <react/renderer/graphics/Color.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/renderer/mounting/stubs.h>
+#include <react/utils/ContextContainer.h>
+#include <react/utils/CoreFeatures.h>
+#include <algorithm>
+#include <functional>
+#include <random>
+
+namespace facebook::react {
+
+/*
+ * Compares the default keyed reordering of the Differentiator with the
+ * minimal-moves strategy (`CoreFeatures::enableDifferentiatorMinimalMoves`).
+ * Every benchmark reports the number of generated mutations next to the time
+ * spent to diff the trees and to apply the mutations to a `StubViewTree`.
+ */
+
+auto contextContainer = std::make_shared<const ContextContainer>();
+auto eventDispatcher = std::shared_ptr<EventDispatcher>{nullptr};
+auto componentDescriptorParameters =
+    ComponentDescriptorParameters{eventDispatcher, contextContainer};
+auto viewComponentDescriptor =
+    ViewComponentDescriptor{componentDescriptorParameters};
+auto rootComponentDescriptor =
+    RootComponentDescriptor{componentDescriptorParameters};
+
+using Reordering = std::function<void(ShadowNode::ListOfShared&)>;
+
+static ShadowNode::Shared createRootShadowNode(
+    const ShadowNode::ListOfShared& children) {
+  static auto rootFamily =
+      rootComponentDescriptor.createFamily({Tag(1), SurfaceId(1), nullptr});
+
+  // A single container sits between the root and the reordered children.
+  static auto containerFamily =
+      viewComponentDescriptor.createFamily({Tag(2), SurfaceId(1), nullptr});
+  auto containerProps = std::make_shared<ViewShadowNodeProps>();
+  containerProps->backgroundColor = blackColor();
+  auto container = viewComponentDescriptor.createShadowNode(
+      {containerProps,
+       std::make_shared<ShadowNode::ListOfShared>(children)},
+      containerFamily);
+
+  auto rootNode = rootComponentDescriptor.createShadowNode(
+      {RootShadowNode::defaultSharedProps(),
+       std::make_shared<ShadowNode::ListOfShared>(
+           ShadowNode::ListOfShared{container})},
+      rootFamily);
+  rootNode->sealRecursive();
+  return rootNode;
+}
+
+static ShadowNode::ListOfShared createChildren(size_t count) {
+  auto props = std::make_shared<ViewShadowNodeProps>();
+  // Keeps the views from being flattened.
+  props->backgroundColor = blackColor();
+
+  auto children = ShadowNode::ListOfShared{};
+  children.reserve(count);
+  for (size_t index = 0; index < count; index++) {
+    auto family = viewComponentDescriptor.createFamily(
+        {static_cast<Tag>(100 + index), SurfaceId(1), nullptr});
+    children.push_back(
+        viewComponentDescriptor.createShadowNode({props}, family));
+  }
+  return children;
+}
+
+static void reorderChildren(
+    benchmark::State& state,
+    bool minimalMoves,
+    const Reordering& reordering) {
+  auto children = createChildren(static_cast<size_t>(state.range(0)));
+  auto oldRootNode = createRootShadowNode(children);
+  reordering(children);
+  auto newRootNode = createRootShadowNode(children);
+
+  CoreFeatures::enableDifferentiatorMinimalMoves = minimalMoves;
+
+  size_t mutationCount = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto viewTree = buildStubViewTreeWithoutUsingDifferentiator(*oldRootNode);
+    state.ResumeTiming();
+
+    auto mutations = calculateShadowViewMutations(*oldRootNode, *newRootNode);
+    viewTree.mutate(mutations);
+    mutationCount = mutations.size();
+  }
+
+  CoreFeatures::enableDifferentiatorMinimalMoves = false;
+
+  state.counters["mutations"] = static_cast<double>(mutationCount);
+}
+
+static void moveFirstToEnd(ShadowNode::ListOfShared& children) {
+  std::rotate(children.begin(), children.begin() + 1, children.end());
+}
+
+static void moveLastToFront(ShadowNode::ListOfShared& children) {
+  std::rotate(children.rbegin(), children.rbegin() + 1, children.rend());
+}
+
+static void reverse(ShadowNode::ListOfShared& children) {
+  std::reverse(children.begin(), children.end());
+}
+
+static void shuffle(ShadowNode::ListOfShared& children) {
+  std::shuffle(children.begin(), children.end(), std::mt19937{42});
+}
+
+BENCHMARK_CAPTURE(reorderChildren, moveFirstToEndDefault, false, moveFirstToEnd)
+    ->Range(8, 1024);
+BENCHMARK_CAPTURE(reorderChildren, moveFirstToEndMinimal, true, moveFirstToEnd)
+    ->Range(8, 1024);
+BENCHMARK_CAPTURE(
+    reorderChildren,
+    moveLastToFrontDefault,
+    false,
+    moveLastToFront)
+    ->Range(8, 1024);
+BENCHMARK_CAPTURE(
+    reorderChildren,
+    moveLastToFrontMinimal,
+    true,
+    moveLastToFront)
+    ->Range(8, 1024);
+BENCHMARK_CAPTURE(reorderChildren, reverseDefault, false, reverse)
+    ->Range(8, 1024);
+BENCHMARK_CAPTURE(reorderChildren, reverseMinimal, true, reverse)
+    ->Range(8, 1024);
+BENCHMARK_CAPTURE(reorderChildren, shuffleDefault, false, shuffle)
+    ->Range(8, 1024);
+BENCHMARK_CAPTURE(reorderChildren, shuffleMinimal, true, shuffle)
+    ->Range(8, 1024);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/config/ReactNativeConfig.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/scrollview/ScrollViewComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/renderer/mounting/stubs.h>
+#include <react/renderer/uimanager/CommitCapture.h>
+#include <react/utils/ContextContainer.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+
+namespace facebook::react {
+
+/*
+ * Replays commits captured by `CommitCaptureHook` (e.g. on a slow screen of
+ * an app) and measures the stages of the render pipeline which follow the
+ * commit: layout of the new tree, diffing it with the old one and mounting
+ * the mutations into a `StubViewTree`. Every commit of the file is measured
+ * separately:
+ *
+ *   CommitReplayBenchmark <capture file> [--benchmark_... flags]
+ */
+
+struct ReplayEnvironment {
+  ReplayEnvironment() : contextContainer(std::make_shared<ContextContainer>()) {
+    contextContainer->insert(
+        "ReactNativeConfig", std::make_shared<EmptyReactNativeConfig>());
+
+    auto providers = {
+        concreteComponentDescriptorProvider<RootComponentDescriptor>(),
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>(),
+        concreteComponentDescriptorProvider<ScrollViewComponentDescriptor>()};
+    for (const auto& provider : providers) {
+      providerRegistry.add(provider);
+    }
+    registry = providerRegistry.createComponentDescriptorRegistry(
+        ComponentDescriptorParameters{nullptr, contextContainer, nullptr});
+    for (const auto& provider : providers) {
+      componentDescriptors[provider.name] = &registry->at(provider.handle);
+    }
+  }
+
+  ReplayedCommit replay(const MapBuffer& capture) const {
+    return replayCommit(
+        capture,
+        [this](const std::string& componentName) -> const ComponentDescriptor* {
+          auto iterator = componentDescriptors.find(componentName);
+          return iterator != componentDescriptors.end() ? iterator->second
+                                                        : nullptr;
+        },
+        *contextContainer);
+  }
+
+  ContextContainer::Shared contextContainer;
+  ComponentDescriptorProviderRegistry providerRegistry{};
+  ComponentDescriptorRegistry::Shared registry;
+  std::unordered_map<std::string, const ComponentDescriptor*>
+      componentDescriptors{};
+};
+
+static void layout(
+    benchmark::State& state,
+    const ReplayEnvironment& environment,
+    const MapBuffer& capture) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto replayedCommit = environment.replay(capture);
+    state.ResumeTiming();
+
+    replayedCommit.newRootShadowNode->layoutIfNeeded();
+
+    state.PauseTiming();
+    replayedCommit = {};
+    state.ResumeTiming();
+  }
+}
+
+static void diff(
+    benchmark::State& state,
+    const ReplayEnvironment& environment,
+    const MapBuffer& capture) {
+  auto replayedCommit = environment.replay(capture);
+  replayedCommit.newRootShadowNode->layoutIfNeeded();
+  replayedCommit.newRootShadowNode->sealRecursive();
+
+  size_t mutationCount = 0;
+  for (auto _ : state) {
+    auto mutations = calculateShadowViewMutations(
+        *replayedCommit.oldRootShadowNode, *replayedCommit.newRootShadowNode);
+    mutationCount = mutations.size();
+  }
+
+  state.counters["mutations"] = static_cast<double>(mutationCount);
+}
+
+static void stubMount(
+    benchmark::State& state,
+    const ReplayEnvironment& environment,
+    const MapBuffer& capture) {
+  auto replayedCommit = environment.replay(capture);
+  replayedCommit.newRootShadowNode->layoutIfNeeded();
+  replayedCommit.newRootShadowNode->sealRecursive();
+  auto mutations = calculateShadowViewMutations(
+      *replayedCommit.oldRootShadowNode, *replayedCommit.newRootShadowNode);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto viewTree = buildStubViewTreeWithoutUsingDifferentiator(
+        *replayedCommit.oldRootShadowNode);
+    state.ResumeTiming();
+
+    viewTree.mutate(mutations);
+
+    state.PauseTiming();
+    viewTree = StubViewTree{};
+    state.ResumeTiming();
+  }
+
+  state.counters["mutations"] = static_cast<double>(mutations.size());
+}
+
+} // namespace facebook::react
+
+int main(int argc, char** argv) {
+  using namespace facebook::react;
+
+  benchmark::Initialize(&argc, argv);
+  if (argc != 2) {
+    fprintf(stderr, "Usage: %s <capture file> [benchmark flags]\n", argv[0]);
+    return 1;
+  }
+
+  auto fileDescriptor = open(argv[1], O_RDONLY);
+  if (fileDescriptor < 0) {
+    perror(argv[1]);
+    return 1;
+  }
+  auto captures = readCommitCaptures(fileDescriptor);
+  close(fileDescriptor);
+
+  auto environment = ReplayEnvironment{};
+  for (size_t index = 0; index < captures.size(); index++) {
+    const auto& capture = captures[index];
+    auto suffix = "/commit:" + std::to_string(index);
+    benchmark::RegisterBenchmark(
+        ("layout" + suffix).c_str(),
+        [&](benchmark::State& state) { layout(state, environment, capture); });
+    benchmark::RegisterBenchmark(
+        ("diff" + suffix).c_str(),
+        [&](benchmark::State& state) { diff(state, environment, capture); });
+    benchmark::RegisterBenchmark(
+        ("stubMount" + suffix).c_str(), [&](benchmark::State& state) {
+          stubMount(state, environment, capture);
+        });
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
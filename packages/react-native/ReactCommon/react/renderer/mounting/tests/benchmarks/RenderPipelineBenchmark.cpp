@@ -0,0 +1,370 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/core/LayoutConstraints.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/graphics/Color.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/renderer/mounting/stubs.h>
+#include <react/utils/ContextContainer.h>
+#include <functional>
+#include <limits>
+
+namespace facebook::react {
+
+/*
+ * Headless benchmarks of the stages of the render pipeline (commit, layout,
+ * diff and mount into a `StubViewTree`) on synthetic trees of different
+ * shapes. Every stage is measured separately; the rest of the pipeline runs
+ * with paused timing.
+ * Run with `--benchmark_out=<file> --benchmark_out_format=json` to get
+ * machine-readable results.
+ */
+
+enum class TreeShape {
+  // A container with many items; every item has a few (partially flattened)
+  // descendants.
+  List,
+  // A single chain of nested views, alternating flattened and not flattened.
+  DeepNesting,
+  // A container with many children which are flattened into it.
+  WideFlattening,
+};
+
+class DummyShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& /*shadowTree*/,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode) const override {
+    return newRootShadowNode;
+  };
+
+  void shadowTreeDidFinishTransaction(
+      MountingCoordinator::Shared /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override{};
+};
+
+static constexpr Float kRootWidth = 400;
+
+using ViewPropsSetter = std::function<void(ViewShadowNodeProps& props)>;
+
+static ElementFragment viewElement(
+    Tag& lastTag,
+    const ViewPropsSetter& setter,
+    std::vector<ElementFragment> children = {}) {
+  return Element<ViewShadowNode>()
+      .tag(++lastTag)
+      .props([=] {
+        auto props = std::make_shared<ViewShadowNodeProps>();
+        setter(*props);
+        return props;
+      })
+      .children(std::move(children));
+}
+
+// Views with a background color are never flattened.
+static void opaque(ViewShadowNodeProps& props) {
+  props.backgroundColor = blackColor();
+}
+
+static void transparent(ViewShadowNodeProps& /*props*/) {}
+
+static std::vector<ElementFragment> generateChildren(
+    TreeShape shape,
+    size_t size,
+    Tag& lastTag) {
+  auto children = std::vector<ElementFragment>{};
+
+  switch (shape) {
+    case TreeShape::List: {
+      auto items = std::vector<ElementFragment>{};
+      items.reserve(size);
+      for (size_t index = 0; index < size; index++) {
+        items.push_back(viewElement(
+            lastTag,
+            [](ViewShadowNodeProps& props) {
+              opaque(props);
+              props.yogaStyle.setFlexDirection(yoga::FlexDirection::Row);
+              props.yogaStyle.setDimension(
+                  yoga::Dimension::Height, yoga::value::points(48));
+            },
+            {viewElement(
+                 lastTag,
+                 [](ViewShadowNodeProps& props) {
+                   opaque(props);
+                   props.yogaStyle.setDimension(
+                       yoga::Dimension::Width, yoga::value::points(48));
+                 }),
+             viewElement(
+                 lastTag,
+                 [](ViewShadowNodeProps& props) {
+                   props.yogaStyle.setFlex(yoga::FloatOptional{1});
+                 },
+                 {viewElement(lastTag, opaque),
+                  viewElement(lastTag, opaque)})}));
+      }
+      children.push_back(viewElement(lastTag, opaque, std::move(items)));
+      break;
+    }
+
+    case TreeShape::DeepNesting: {
+      auto element = viewElement(lastTag, opaque);
+      for (size_t depth = 1; depth < size; depth++) {
+        element = viewElement(
+            lastTag,
+            [depth](ViewShadowNodeProps& props) {
+              if (depth % 2 == 0) {
+                opaque(props);
+              }
+              props.yogaStyle.setPadding(
+                  yoga::Edge::All, yoga::value::points(1));
+            },
+            {element});
+      }
+      children.push_back(element);
+      break;
+    }
+
+    case TreeShape::WideFlattening: {
+      auto items = std::vector<ElementFragment>{};
+      items.reserve(size);
+      for (size_t index = 0; index < size; index++) {
+        items.push_back(viewElement(
+            lastTag,
+            transparent,
+            {viewElement(lastTag, opaque),
+             viewElement(lastTag, opaque),
+             viewElement(lastTag, opaque)}));
+      }
+      children.push_back(viewElement(lastTag, opaque, std::move(items)));
+      break;
+    }
+  }
+
+  return children;
+}
+
+static std::shared_ptr<RootShadowNode> buildRootShadowNode(
+    const ComponentBuilder& builder,
+    TreeShape shape,
+    size_t size) {
+  // Tag `1` is reserved for the root.
+  auto lastTag = Tag{1};
+  auto children = size == 0 ? std::vector<ElementFragment>{}
+                            : generateChildren(shape, size, lastTag);
+
+  return builder.build(
+      Element<RootShadowNode>()
+          .tag(1)
+          .props([] {
+            auto props = std::make_shared<RootProps>();
+            props->layoutConstraints = LayoutConstraints{
+                {kRootWidth, 0},
+                {kRootWidth, std::numeric_limits<Float>::infinity()}};
+            return props;
+          })
+          .children(std::move(children)));
+}
+
+static std::shared_ptr<RootShadowNode> relayoutRootShadowNode(
+    const RootShadowNode& rootShadowNode,
+    Float width) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  auto newRootShadowNode = rootShadowNode.clone(
+      parserContext,
+      LayoutConstraints{
+          {width, 0}, {width, std::numeric_limits<Float>::infinity()}},
+      LayoutContext{});
+  newRootShadowNode->layoutIfNeeded();
+  newRootShadowNode->sealRecursive();
+  return newRootShadowNode;
+}
+
+static void commit(benchmark::State& state, TreeShape shape) {
+  auto builder = simpleComponentBuilder();
+  auto emptyRootShadowNode = buildRootShadowNode(builder, shape, 0);
+  auto rootShadowNode =
+      buildRootShadowNode(builder, shape, static_cast<size_t>(state.range(0)));
+
+  // Laying out both trees up front; the commit itself does not need to.
+  emptyRootShadowNode->layoutIfNeeded();
+  rootShadowNode->layoutIfNeeded();
+
+  ContextContainer contextContainer{};
+  auto shadowTreeDelegate = DummyShadowTreeDelegate{};
+  auto shadowTree = ShadowTree{
+      SurfaceId{1},
+      LayoutConstraints{},
+      LayoutContext{},
+      shadowTreeDelegate,
+      contextContainer};
+
+  for (auto _ : state) {
+    shadowTree.commit(
+        [&](const RootShadowNode& /*oldRootShadowNode*/) {
+          return rootShadowNode;
+        },
+        {});
+
+    state.PauseTiming();
+    shadowTree.commit(
+        [&](const RootShadowNode& /*oldRootShadowNode*/) {
+          return emptyRootShadowNode;
+        },
+        {});
+    state.ResumeTiming();
+  }
+}
+
+static void layout(benchmark::State& state, TreeShape shape) {
+  auto builder = simpleComponentBuilder();
+  auto rootShadowNode = relayoutRootShadowNode(
+      *buildRootShadowNode(builder, shape, static_cast<size_t>(state.range(0))),
+      kRootWidth);
+
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+
+  // Changing the width invalidates the layout of the whole tree.
+  auto width = kRootWidth + 1;
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto newRootShadowNode = rootShadowNode->clone(
+        parserContext,
+        LayoutConstraints{
+            {width, 0}, {width, std::numeric_limits<Float>::infinity()}},
+        LayoutContext{});
+    state.ResumeTiming();
+
+    newRootShadowNode->layoutIfNeeded();
+
+    state.PauseTiming();
+    newRootShadowNode.reset();
+    state.ResumeTiming();
+  }
+}
+
+static void diffInitialRender(benchmark::State& state, TreeShape shape) {
+  auto builder = simpleComponentBuilder();
+  auto emptyRootShadowNode = relayoutRootShadowNode(
+      *buildRootShadowNode(builder, shape, 0), kRootWidth);
+  auto rootShadowNode = relayoutRootShadowNode(
+      *buildRootShadowNode(builder, shape, static_cast<size_t>(state.range(0))),
+      kRootWidth);
+
+  size_t mutationCount = 0;
+  for (auto _ : state) {
+    auto mutations =
+        calculateShadowViewMutations(*emptyRootShadowNode, *rootShadowNode);
+    mutationCount = mutations.size();
+  }
+
+  state.counters["mutations"] = static_cast<double>(mutationCount);
+}
+
+static void diffRelayout(benchmark::State& state, TreeShape shape) {
+  auto builder = simpleComponentBuilder();
+  auto rootShadowNode =
+      buildRootShadowNode(builder, shape, static_cast<size_t>(state.range(0)));
+  auto oldRootShadowNode = relayoutRootShadowNode(*rootShadowNode, kRootWidth);
+  auto newRootShadowNode =
+      relayoutRootShadowNode(*rootShadowNode, kRootWidth + 1);
+
+  size_t mutationCount = 0;
+  for (auto _ : state) {
+    auto mutations =
+        calculateShadowViewMutations(*oldRootShadowNode, *newRootShadowNode);
+    mutationCount = mutations.size();
+  }
+
+  state.counters["mutations"] = static_cast<double>(mutationCount);
+}
+
+static void stubMount(benchmark::State& state, TreeShape shape) {
+  auto builder = simpleComponentBuilder();
+  auto emptyRootShadowNode = relayoutRootShadowNode(
+      *buildRootShadowNode(builder, shape, 0), kRootWidth);
+  auto rootShadowNode = relayoutRootShadowNode(
+      *buildRootShadowNode(builder, shape, static_cast<size_t>(state.range(0))),
+      kRootWidth);
+  auto mutations =
+      calculateShadowViewMutations(*emptyRootShadowNode, *rootShadowNode);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto viewTree =
+        buildStubViewTreeWithoutUsingDifferentiator(*emptyRootShadowNode);
+    state.ResumeTiming();
+
+    viewTree.mutate(mutations);
+
+    state.PauseTiming();
+    viewTree = StubViewTree{};
+    state.ResumeTiming();
+  }
+
+  state.counters["mutations"] = static_cast<double>(mutations.size());
+}
+
+BENCHMARK_CAPTURE(commit, list, TreeShape::List)->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(commit, deepNesting, TreeShape::DeepNesting)
+    ->Arg(100)
+    ->Arg(500);
+BENCHMARK_CAPTURE(commit, wideFlattening, TreeShape::WideFlattening)
+    ->Arg(1000)
+    ->Arg(10000);
+
+BENCHMARK_CAPTURE(layout, list, TreeShape::List)->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(layout, deepNesting, TreeShape::DeepNesting)
+    ->Arg(100)
+    ->Arg(500);
+BENCHMARK_CAPTURE(layout, wideFlattening, TreeShape::WideFlattening)
+    ->Arg(1000)
+    ->Arg(10000);
+
+BENCHMARK_CAPTURE(diffInitialRender, list, TreeShape::List)
+    ->Arg(1000)
+    ->Arg(10000);
+BENCHMARK_CAPTURE(diffInitialRender, deepNesting, TreeShape::DeepNesting)
+    ->Arg(100)
+    ->Arg(500);
+BENCHMARK_CAPTURE(
+    diffInitialRender,
+    wideFlattening,
+    TreeShape::WideFlattening)
+    ->Arg(1000)
+    ->Arg(10000);
+
+BENCHMARK_CAPTURE(diffRelayout, list, TreeShape::List)
+    ->Arg(1000)
+    ->Arg(10000);
+BENCHMARK_CAPTURE(diffRelayout, deepNesting, TreeShape::DeepNesting)
+    ->Arg(100)
+    ->Arg(500);
+BENCHMARK_CAPTURE(diffRelayout, wideFlattening, TreeShape::WideFlattening)
+    ->Arg(1000)
+    ->Arg(10000);
+
+BENCHMARK_CAPTURE(stubMount, list, TreeShape::List)->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(stubMount, deepNesting, TreeShape::DeepNesting)
+    ->Arg(100)
+    ->Arg(500);
+BENCHMARK_CAPTURE(stubMount, wideFlattening, TreeShape::WideFlattening)
+    ->Arg(1000)
+    ->Arg(10000);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -101,6 +101,14 @@ IntersectionObserver::updateIntersectionObservation(
   auto targetAncestors =
       targetShadowNode_->getFamily().getAncestors(rootShadowNode);
 
+  // Nothing that affects the intersection changed since the previous
+  // observation, so neither did its state. This is the common case for most
+  // targets, as mounts usually only change small parts of the tree.
+  if (isSameLayoutAsPreviousObservation(
+          *layoutableRootShadowNode, targetAncestors)) {
+    return std::nullopt;
+  }
+
   // Absolute coordinates of the root
   auto rootBoundingRect = getRootBoundingRect(*layoutableRootShadowNode);
 
@@ -139,6 +147,40 @@ IntersectionObserver::updateIntersectionObservation(
       mountTime);
 }
 
+bool IntersectionObserver::isSameLayoutAsPreviousObservation(
+    const LayoutableShadowNode& layoutableRootShadowNode,
+    const ShadowNodeFamily::AncestorList& targetAncestors) {
+  auto rootLayoutMetrics = layoutableRootShadowNode.getLayoutMetrics();
+  auto rootTransform = layoutableRootShadowNode.getTransform();
+
+  // The root is cloned on every commit, so only its layout is compared. The
+  // path is made of every node below the root, down to the target.
+  auto isSameLayout = previousRootLayoutMetrics_ == rootLayoutMetrics &&
+      previousRootTransform_ == rootTransform &&
+      previousTargetPath_.size() == targetAncestors.size();
+  for (size_t i = 0; isSameLayout && i < targetAncestors.size(); i++) {
+    const auto& [parentNode, childIndex] = targetAncestors[i];
+    const auto& node = parentNode.get().getChildren().at(childIndex);
+    const auto& previousNode = previousTargetPath_[i];
+    isSameLayout =
+        !previousNode.owner_before(node) && !node.owner_before(previousNode);
+  }
+
+  if (isSameLayout) {
+    return true;
+  }
+
+  previousRootLayoutMetrics_ = rootLayoutMetrics;
+  previousRootTransform_ = rootTransform;
+  previousTargetPath_.clear();
+  previousTargetPath_.reserve(targetAncestors.size());
+  for (const auto& [parentNode, childIndex] : targetAncestors) {
+    previousTargetPath_.emplace_back(
+        parentNode.get().getChildren().at(childIndex));
+  }
+  return false;
+}
+
 Float IntersectionObserver::getHighestThresholdCrossed(
     Float intersectionRatio) {
   Float highestThreshold = -1;
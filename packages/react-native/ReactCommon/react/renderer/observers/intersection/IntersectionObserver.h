@@ -8,10 +8,14 @@
 #pragma once
 
 #include <react/renderer/components/root/RootShadowNode.h>
+#include <react/renderer/core/LayoutMetrics.h>
+#include <react/renderer/core/LayoutableShadowNode.h>
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/graphics/Float.h>
 #include <react/renderer/graphics/Rect.h>
+#include <react/renderer/graphics/Transform.h>
 #include <memory>
+#include <vector>
 #include "IntersectionObserverState.h"
 
 namespace facebook::react {
@@ -58,6 +62,15 @@ class IntersectionObserver {
  private:
   Float getHighestThresholdCrossed(Float intersectionRatio);
 
+  /*
+   * Returns whether the layout of the root and the nodes between the root and
+   * the target (which are all the intersection depends on) is the same as in
+   * the previous observation. Otherwise, stores it for the next observation.
+   */
+  bool isSameLayoutAsPreviousObservation(
+      const LayoutableShadowNode& layoutableRootShadowNode,
+      const ShadowNodeFamily::AncestorList& targetAncestors);
+
   std::optional<IntersectionObserverEntry> setIntersectingState(
       const Rect& rootBoundingRect,
       const Rect& targetBoundingRect,
@@ -75,6 +88,13 @@ class IntersectionObserver {
   std::vector<Float> thresholds_;
   mutable IntersectionObserverState state_ =
       IntersectionObserverState::Initial();
+
+  // Layout of the previous observation. The nodes on the path to the target
+  // are compared by identity, as any change to them clones them. Weak
+  // references don't retain the previous trees.
+  std::optional<LayoutMetrics> previousRootLayoutMetrics_;
+  Transform previousRootTransform_;
+  std::vector<std::weak_ptr<const ShadowNode>> previousTargetPath_;
 };
 
 } // namespace facebook::react
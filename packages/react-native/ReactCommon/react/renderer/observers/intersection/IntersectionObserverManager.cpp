@@ -8,6 +8,7 @@
 #include "IntersectionObserverManager.h"
 #include <cxxreact/JSExecutor.h>
 #include <react/renderer/debug/SystraceSection.h>
+#include <chrono>
 #include <utility>
 #include "IntersectionObserver.h"
 
@@ -15,6 +16,15 @@ namespace facebook::react {
 
 IntersectionObserverManager::IntersectionObserverManager() = default;
 
+IntersectionObserverManager::~IntersectionObserverManager() {
+  stopBackgroundObservations();
+}
+
+void IntersectionObserverManager::setBackgroundObservationInterval(
+    double minimumIntervalMs) {
+  backgroundObservationIntervalMs_ = minimumIntervalMs;
+}
+
 void IntersectionObserverManager::observe(
     IntersectionObserverObserverId intersectionObserverId,
     const ShadowNode::Shared& shadowNode,
@@ -126,6 +136,7 @@ void IntersectionObserverManager::connect(
     return;
   }
 
+  startBackgroundObservations();
   uiManager.registerMountHook(*this);
   mountHookRegistered_ = true;
 }
@@ -140,6 +151,7 @@ void IntersectionObserverManager::disconnect(UIManager& uiManager) {
 
   uiManager.unregisterMountHook(*this);
   mountHookRegistered_ = false;
+  stopBackgroundObservations();
   notifyIntersectionObserversCallback_ = nullptr;
 }
 
@@ -157,9 +169,75 @@ IntersectionObserverManager::takeRecords() {
 void IntersectionObserverManager::shadowTreeDidMount(
     const RootShadowNode::Shared& rootShadowNode,
     double mountTime) noexcept {
+  if (backgroundThread_.joinable()) {
+    {
+      std::unique_lock lock(backgroundMutex_);
+      pendingMounts_[rootShadowNode->getSurfaceId()] =
+          PendingMount{rootShadowNode, mountTime};
+    }
+    backgroundCondition_.notify_one();
+    return;
+  }
+
   updateIntersectionObservations(*rootShadowNode, mountTime);
 }
 
+void IntersectionObserverManager::startBackgroundObservations() {
+  if (!backgroundObservationIntervalMs_ || backgroundThread_.joinable()) {
+    return;
+  }
+
+  backgroundThreadStopped_ = false;
+  backgroundThread_ = std::thread(
+      &IntersectionObserverManager::runBackgroundObservations,
+      this,
+      *backgroundObservationIntervalMs_);
+}
+
+void IntersectionObserverManager::stopBackgroundObservations() {
+  if (!backgroundThread_.joinable()) {
+    return;
+  }
+
+  {
+    std::unique_lock lock(backgroundMutex_);
+    backgroundThreadStopped_ = true;
+    pendingMounts_.clear();
+  }
+  backgroundCondition_.notify_one();
+  backgroundThread_.join();
+}
+
+void IntersectionObserverManager::runBackgroundObservations(
+    double minimumIntervalMs) {
+  auto minimumInterval =
+      std::chrono::duration<double, std::milli>(minimumIntervalMs);
+
+  std::unique_lock lock(backgroundMutex_);
+  while (true) {
+    backgroundCondition_.wait(lock, [this]() {
+      return backgroundThreadStopped_ || !pendingMounts_.empty();
+    });
+    if (backgroundThreadStopped_) {
+      return;
+    }
+
+    auto pendingMounts = std::move(pendingMounts_);
+    pendingMounts_.clear();
+
+    lock.unlock();
+    for (const auto& [surfaceId, pendingMount] : pendingMounts) {
+      updateIntersectionObservations(
+          *pendingMount.rootShadowNode, pendingMount.mountTime);
+    }
+    lock.lock();
+
+    // Mounts until the end of the interval are coalesced and observed next.
+    backgroundCondition_.wait_for(
+        lock, minimumInterval, [this]() { return backgroundThreadStopped_; });
+  }
+}
+
 void IntersectionObserverManager::updateIntersectionObservations(
     const RootShadowNode& rootShadowNode,
     double mountTime) {
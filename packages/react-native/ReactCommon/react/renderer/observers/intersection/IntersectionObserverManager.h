@@ -11,6 +11,10 @@
 #include <react/renderer/graphics/Float.h>
 #include <react/renderer/uimanager/UIManager.h>
 #include <react/renderer/uimanager/UIManagerMountHook.h>
+#include <condition_variable>
+#include <optional>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 #include "IntersectionObserver.h"
 
@@ -19,6 +23,15 @@ namespace facebook::react {
 class IntersectionObserverManager final : public UIManagerMountHook {
  public:
   IntersectionObserverManager();
+  ~IntersectionObserverManager();
+
+  /*
+   * Moves intersection observation out of the mount hook: mounted trees are
+   * observed on a background thread instead, at most once every
+   * `minimumIntervalMs`. Mounts in between are coalesced, so only the last
+   * mounted tree of each surface is observed. Takes effect on `connect`.
+   */
+  void setBackgroundObservationInterval(double minimumIntervalMs);
 
   void observe(
       IntersectionObserverObserverId intersectionObserverId,
@@ -44,6 +57,10 @@ class IntersectionObserverManager final : public UIManagerMountHook {
       const RootShadowNode::Shared& rootShadowNode,
       double mountTime) noexcept override;
 
+  const char* getName() const noexcept override {
+    return "IntersectionObserverManager";
+  }
+
  private:
   mutable std::unordered_map<SurfaceId, std::vector<IntersectionObserver>>
       observersBySurfaceId_;
@@ -57,6 +74,22 @@ class IntersectionObserverManager final : public UIManagerMountHook {
   mutable bool notifiedIntersectionObservers_{};
   mutable bool mountHookRegistered_{};
 
+  struct PendingMount {
+    RootShadowNode::Shared rootShadowNode;
+    double mountTime;
+  };
+
+  std::optional<double> backgroundObservationIntervalMs_;
+  std::thread backgroundThread_;
+  std::mutex backgroundMutex_;
+  std::condition_variable backgroundCondition_;
+  bool backgroundThreadStopped_{};
+  std::unordered_map<SurfaceId, PendingMount> pendingMounts_;
+
+  void startBackgroundObservations();
+  void stopBackgroundObservations();
+  void runBackgroundObservations(double minimumIntervalMs);
+
   void notifyObserversIfNecessary();
   void notifyObservers();
 
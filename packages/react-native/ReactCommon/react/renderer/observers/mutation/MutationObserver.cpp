@@ -8,6 +8,8 @@
 #include "MutationObserver.h"
 #include <react/renderer/core/ShadowNodeTraits.h>
 #include <react/renderer/uimanager/primitives.h>
+#include <optional>
+#include <unordered_map>
 
 namespace facebook::react {
 
@@ -63,15 +65,31 @@ static ShadowNode::Shared getShadowNodeInTree(
   return pair->first.get().getChildren().at(pair->second);
 }
 
-static ShadowNode::Shared findNodeOfSameFamily(
+using ShadowNodesByFamily =
+    std::unordered_map<const ShadowNodeFamily*, const ShadowNode*>;
+
+// Children mostly keep their positions between commits, so the child at the
+// same index is checked first. The families of `list` are only indexed (once
+// per list) when that fails, which avoids quadratic scans of long lists.
+static const ShadowNode* findNodeOfSameFamily(
     const ShadowNode::ListOfShared& list,
-    const ShadowNode& node) {
-  for (auto& current : list) {
-    if (ShadowNode::sameFamily(node, *current)) {
-      return current;
+    size_t index,
+    const ShadowNode& node,
+    std::optional<ShadowNodesByFamily>& nodesByFamily) {
+  if (index < list.size() && ShadowNode::sameFamily(node, *list[index])) {
+    return list[index].get();
+  }
+
+  if (!nodesByFamily) {
+    nodesByFamily.emplace();
+    nodesByFamily->reserve(list.size());
+    for (const auto& current : list) {
+      nodesByFamily->emplace(&current->getFamily(), current.get());
     }
   }
-  return nullptr;
+
+  auto nodeIt = nodesByFamily->find(&node.getFamily());
+  return nodeIt == nodesByFamily->end() ? nullptr : nodeIt->second;
 }
 
 void MutationObserver::recordMutations(
@@ -133,7 +151,7 @@ void MutationObserver::recordMutationsInTarget(
   }
 
   recordMutationsInSubtrees(
-      std::move(targetShadowNode),
+      targetShadowNode,
       *oldTargetShadowNode,
       *newTargetShadowNode,
       observeSubtree,
@@ -142,12 +160,12 @@ void MutationObserver::recordMutationsInTarget(
 }
 
 void MutationObserver::recordMutationsInSubtrees(
-    ShadowNode::Shared targetShadowNode,
+    const ShadowNode::Shared& targetShadowNode,
     const ShadowNode& oldNode,
     const ShadowNode& newNode,
     bool observeSubtree,
     std::vector<MutationRecord>& recordedMutations,
-    SetOfShadowNodePointers processedNodes) const {
+    SetOfShadowNodePointers& processedNodes) const {
   bool isSameNode = &oldNode == &newNode;
   // If the nodes are referentially equal, their children are also the same.
   if (isSameNode || processedNodes.find(&newNode) != processedNodes.end()) {
@@ -156,16 +174,21 @@ void MutationObserver::recordMutationsInSubtrees(
 
   processedNodes.insert(&newNode);
 
-  auto oldChildren = oldNode.getChildren();
-  auto newChildren = newNode.getChildren();
+  const auto& oldChildren = oldNode.getChildren();
+  const auto& newChildren = newNode.getChildren();
 
   std::vector<ShadowNode::Shared> addedNodes;
   std::vector<ShadowNode::Shared> removedNodes;
 
+  std::optional<ShadowNodesByFamily> oldChildrenByFamily;
+  std::optional<ShadowNodesByFamily> newChildrenByFamily;
+
   // Check for removed nodes (and equal nodes for further inspection)
-  for (auto& oldChild : oldChildren) {
-    auto newChild = findNodeOfSameFamily(newChildren, *oldChild);
-    if (!newChild) {
+  for (size_t i = 0; i < oldChildren.size(); i++) {
+    const auto& oldChild = oldChildren[i];
+    auto newChild =
+        findNodeOfSameFamily(newChildren, i, *oldChild, newChildrenByFamily);
+    if (newChild == nullptr) {
       removedNodes.push_back(oldChild);
     } else if (observeSubtree) {
       // Nodes are present in both tress. If `subtree` is set to true,
@@ -181,9 +204,11 @@ void MutationObserver::recordMutationsInSubtrees(
   }
 
   // Check for added nodes
-  for (auto& newChild : newChildren) {
-    auto oldChild = findNodeOfSameFamily(oldChildren, *newChild);
-    if (!oldChild) {
+  for (size_t i = 0; i < newChildren.size(); i++) {
+    const auto& newChild = newChildren[i];
+    auto oldChild =
+        findNodeOfSameFamily(oldChildren, i, *newChild, oldChildrenByFamily);
+    if (oldChild == nullptr) {
       addedNodes.push_back(newChild);
     }
   }
@@ -53,12 +53,12 @@ class MutationObserver {
       SetOfShadowNodePointers& processedNodes) const;
 
   void recordMutationsInSubtrees(
-      ShadowNode::Shared targetShadowNode,
+      const ShadowNode::Shared& targetShadowNode,
       const ShadowNode& oldNode,
       const ShadowNode& newNode,
       bool observeSubtree,
       std::vector<MutationRecord>& recordedMutations,
-      SetOfShadowNodePointers processedNodes) const;
+      SetOfShadowNodePointers& processedNodes) const;
 };
 
 } // namespace facebook::react
@@ -45,6 +45,10 @@ class MutationObserverManager final : public UIManagerCommitHook {
       const RootShadowNode::Shared& oldRootShadowNode,
       const RootShadowNode::Unshared& newRootShadowNode) noexcept override;
 
+  const char* getName() const noexcept override {
+    return "MutationObserverManager";
+  }
+
  private:
   std::unordered_map<
       SurfaceId,
@@ -54,6 +54,18 @@ std::shared_ptr<Task> RuntimeScheduler::scheduleTask(
   return runtimeSchedulerImpl_->scheduleTask(priority, std::move(callback));
 }
 
+std::shared_ptr<Task> RuntimeScheduler::scheduleIdleTask(
+    jsi::Function&& callback,
+    std::optional<std::chrono::milliseconds> timeout) noexcept {
+  return runtimeSchedulerImpl_->scheduleIdleTask(std::move(callback), timeout);
+}
+
+std::shared_ptr<Task> RuntimeScheduler::scheduleIdleTask(
+    RawCallback&& callback,
+    std::optional<std::chrono::milliseconds> timeout) noexcept {
+  return runtimeSchedulerImpl_->scheduleIdleTask(std::move(callback), timeout);
+}
+
 bool RuntimeScheduler::getShouldYield() const noexcept {
   return runtimeSchedulerImpl_->getShouldYield();
 }
@@ -88,4 +100,20 @@ void RuntimeScheduler::scheduleRenderingUpdate(
       std::move(renderingUpdate));
 }
 
+void RuntimeScheduler::scheduleRenderingUpdate(
+    int32_t surfaceId,
+    RuntimeSchedulerRenderingUpdate&& renderingUpdate) {
+  return runtimeSchedulerImpl_->scheduleRenderingUpdate(
+      surfaceId, std::move(renderingUpdate));
+}
+
+void RuntimeScheduler::setFrameDeadline(
+    RuntimeSchedulerTimePoint deadline) noexcept {
+  return runtimeSchedulerImpl_->setFrameDeadline(deadline);
+}
+
+RuntimeSchedulerTelemetry RuntimeScheduler::getTelemetry() const {
+  return runtimeSchedulerImpl_->getTelemetry();
+}
+
 } // namespace facebook::react
@@ -9,8 +9,13 @@
 
 #include <ReactCommon/RuntimeExecutor.h>
 #include <react/renderer/runtimescheduler/RuntimeSchedulerClock.h>
+#include <react/renderer/runtimescheduler/RuntimeSchedulerTelemetry.h>
 #include <react/renderer/runtimescheduler/Task.h>
 
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
 namespace facebook::react {
 
 using RuntimeSchedulerRenderingUpdate = std::function<void()>;
@@ -28,6 +33,12 @@ class RuntimeSchedulerBase {
   virtual std::shared_ptr<Task> scheduleTask(
       SchedulerPriority priority,
       RawCallback&& callback) noexcept = 0;
+  virtual std::shared_ptr<Task> scheduleIdleTask(
+      jsi::Function&& callback,
+      std::optional<std::chrono::milliseconds> timeout) noexcept = 0;
+  virtual std::shared_ptr<Task> scheduleIdleTask(
+      RawCallback&& callback,
+      std::optional<std::chrono::milliseconds> timeout) noexcept = 0;
   virtual void cancelTask(Task& task) noexcept = 0;
   virtual bool getShouldYield() const noexcept = 0;
   virtual bool getIsSynchronous() const noexcept = 0;
@@ -36,6 +47,12 @@ class RuntimeSchedulerBase {
   virtual void callExpiredTasks(jsi::Runtime& runtime) = 0;
   virtual void scheduleRenderingUpdate(
       RuntimeSchedulerRenderingUpdate&& renderingUpdate) = 0;
+  virtual void scheduleRenderingUpdate(
+      int32_t surfaceId,
+      RuntimeSchedulerRenderingUpdate&& renderingUpdate) = 0;
+  virtual void setFrameDeadline(
+      RuntimeSchedulerTimePoint deadline) noexcept = 0;
+  virtual RuntimeSchedulerTelemetry getTelemetry() const = 0;
 };
 
 // This is a proxy for RuntimeScheduler implementation, which will be selected
@@ -84,6 +101,25 @@ class RuntimeScheduler final : RuntimeSchedulerBase {
       SchedulerPriority priority,
       RawCallback&& callback) noexcept override;
 
+  /*
+   * Adds a callback to be executed when the runtime is idle, i.e. when there
+   * are no other tasks to execute and there is time left until the deadline of
+   * the current frame. JavaScript callbacks receive an `IdleDeadline` object,
+   * as with `requestIdleCallback` on the Web. If `timeout` is given, the
+   * callback is executed once it passes even if the runtime is not idle.
+   *
+   * Can be cancelled with `cancelTask`.
+   */
+  std::shared_ptr<Task> scheduleIdleTask(
+      jsi::Function&& callback,
+      std::optional<std::chrono::milliseconds> timeout =
+          std::nullopt) noexcept override;
+
+  std::shared_ptr<Task> scheduleIdleTask(
+      RawCallback&& callback,
+      std::optional<std::chrono::milliseconds> timeout =
+          std::nullopt) noexcept override;
+
   /*
    * Cancelled task will never be executed.
    *
@@ -136,6 +172,33 @@ class RuntimeScheduler final : RuntimeSchedulerBase {
   void scheduleRenderingUpdate(
       RuntimeSchedulerRenderingUpdate&& renderingUpdate) override;
 
+  /*
+   * Same as above, but a rendering update replaces the one scheduled for the
+   * same surface before it was executed, if any (e.g. when a task commits to
+   * a surface several times, only the last commit is mounted).
+   */
+  void scheduleRenderingUpdate(
+      int32_t surfaceId,
+      RuntimeSchedulerRenderingUpdate&& renderingUpdate) override;
+
+  /*
+   * Informs the scheduler about the time by which the host platform needs the
+   * rendering updates of the current frame (e.g. the next vsync reported by
+   * `Choreographer` or `CADisplayLink`). Once it is reached, `getShouldYield`
+   * returns true so the current task gives the updates a chance to be flushed.
+   *
+   * Can be called from any thread.
+   */
+  void setFrameDeadline(RuntimeSchedulerTimePoint deadline) noexcept override;
+
+  /*
+   * Returns a snapshot of the telemetry aggregated over the tasks executed so
+   * far, if `CoreFeatures::enableRuntimeSchedulerTelemetry` is enabled.
+   *
+   * Can be called from any thread.
+   */
+  RuntimeSchedulerTelemetry getTelemetry() const override;
+
  private:
   // Actual implementation, stored as a unique pointer to simplify memory
   // management.
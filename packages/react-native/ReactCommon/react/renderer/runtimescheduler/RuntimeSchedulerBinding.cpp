@@ -13,6 +13,7 @@
 
 #include <chrono>
 #include <memory>
+#include <optional>
 #include <utility>
 
 namespace facebook::react {
@@ -105,6 +106,52 @@ jsi::Value RuntimeSchedulerBinding::get(
         });
   }
 
+  if (propertyName == "requestIdleCallback") {
+    return jsi::Function::createFromHostFunction(
+        runtime,
+        name,
+        2,
+        [this](
+            jsi::Runtime& runtime,
+            const jsi::Value&,
+            const jsi::Value* arguments,
+            size_t count) noexcept -> jsi::Value {
+          auto callback = arguments[0].getObject(runtime).getFunction(runtime);
+
+          auto timeout = std::optional<std::chrono::milliseconds>{};
+          if (count > 1 && arguments[1].isObject()) {
+            auto timeoutValue =
+                arguments[1].getObject(runtime).getProperty(runtime, "timeout");
+            if (timeoutValue.isNumber() && timeoutValue.getNumber() > 0) {
+              timeout = std::chrono::milliseconds(
+                  static_cast<int64_t>(timeoutValue.getNumber()));
+            }
+          }
+
+          auto task =
+              runtimeScheduler_->scheduleIdleTask(std::move(callback), timeout);
+
+          return valueFromTask(runtime, task);
+        });
+  }
+
+  if (propertyName == "cancelIdleCallback") {
+    return jsi::Function::createFromHostFunction(
+        runtime,
+        name,
+        1,
+        [this](
+            jsi::Runtime& runtime,
+            const jsi::Value&,
+            const jsi::Value* arguments,
+            size_t) noexcept -> jsi::Value {
+          if (auto task = taskFromValue(runtime, arguments[0])) {
+            runtimeScheduler_->cancelTask(*task);
+          }
+          return jsi::Value::undefined();
+        });
+  }
+
   if (propertyName == "unstable_shouldYield") {
     return jsi::Function::createFromHostFunction(
         runtime,
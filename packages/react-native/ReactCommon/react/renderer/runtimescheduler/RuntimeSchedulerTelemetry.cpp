@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "RuntimeSchedulerTelemetry.h"
+#include "SchedulerPriorityUtils.h"
+
+#include <algorithm>
+
+namespace facebook::react {
+
+const RuntimeSchedulerPriorityTelemetry&
+RuntimeSchedulerTelemetry::getPriorityTelemetry(
+    SchedulerPriority priority) const {
+  return priorityTelemetries_[serialize(priority) - 1];
+}
+
+size_t RuntimeSchedulerTelemetry::getMaxQueueDepth() const {
+  return maxQueueDepth_;
+}
+
+void RuntimeSchedulerTelemetry::incorporateTask(
+    SchedulerPriority priority,
+    RuntimeSchedulerDuration waitTime,
+    RuntimeSchedulerDuration runTime,
+    bool didTimeout) {
+  auto& telemetry = priorityTelemetries_[serialize(priority) - 1];
+  telemetry.numberOfTasks++;
+  if (didTimeout) {
+    telemetry.numberOfTimedOutTasks++;
+  }
+  telemetry.totalWaitTime += waitTime;
+  telemetry.maxWaitTime = std::max(telemetry.maxWaitTime, waitTime);
+  telemetry.totalRunTime += runTime;
+  telemetry.maxRunTime = std::max(telemetry.maxRunTime, runTime);
+}
+
+void RuntimeSchedulerTelemetry::incorporateQueueDepth(size_t queueDepth) {
+  maxQueueDepth_ = std::max(maxQueueDepth_, queueDepth);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <ReactCommon/SchedulerPriority.h>
+#include <react/renderer/runtimescheduler/RuntimeSchedulerClock.h>
+
+#include <array>
+#include <cstddef>
+
+namespace facebook::react {
+
+/*
+ * Telemetry aggregated over the tasks of one priority executed by
+ * `RuntimeScheduler`.
+ */
+struct RuntimeSchedulerPriorityTelemetry final {
+  int numberOfTasks{0};
+
+  /*
+   * Number of tasks executed after their timeout passed (which is all of
+   * them for the immediate priority).
+   */
+  int numberOfTimedOutTasks{0};
+
+  /*
+   * Time from scheduling a task (or from the end of its previous execution,
+   * for continuations) to the start of its execution.
+   */
+  RuntimeSchedulerDuration totalWaitTime{};
+  RuntimeSchedulerDuration maxWaitTime{};
+
+  /*
+   * Time spent executing tasks, including their microtasks and the rendering
+   * updates which followed them.
+   */
+  RuntimeSchedulerDuration totalRunTime{};
+  RuntimeSchedulerDuration maxRunTime{};
+};
+
+/*
+ * Represents telemetry data of `RuntimeScheduler`, aggregated over executed
+ * tasks and broken down by priority.
+ */
+class RuntimeSchedulerTelemetry final {
+ public:
+  /*
+   * Metrics
+   */
+  const RuntimeSchedulerPriorityTelemetry& getPriorityTelemetry(
+      SchedulerPriority priority) const;
+
+  /*
+   * Largest number of tasks which waited for execution at the same time.
+   */
+  size_t getMaxQueueDepth() const;
+
+  /*
+   * Incorporate data about an executed task into the aggregated data.
+   */
+  void incorporateTask(
+      SchedulerPriority priority,
+      RuntimeSchedulerDuration waitTime,
+      RuntimeSchedulerDuration runTime,
+      bool didTimeout);
+
+  /*
+   * Incorporate the current number of tasks waiting for execution.
+   */
+  void incorporateQueueDepth(size_t queueDepth);
+
+ private:
+  std::array<RuntimeSchedulerPriorityTelemetry, 5> priorityTelemetries_{};
+  size_t maxQueueDepth_{0};
+};
+
+} // namespace facebook::react
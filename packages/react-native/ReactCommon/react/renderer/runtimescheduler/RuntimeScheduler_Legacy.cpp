@@ -7,6 +7,7 @@
 
 #include "RuntimeScheduler_Legacy.h"
 #include "SchedulerPriorityUtils.h"
+#include "primitives.h"
 
 #include <react/renderer/debug/SystraceSection.h>
 #include <utility>
@@ -75,6 +76,39 @@ std::shared_ptr<Task> RuntimeScheduler_Legacy::scheduleTask(
   return task;
 }
 
+std::shared_ptr<Task> RuntimeScheduler_Legacy::scheduleIdleTask(
+    jsi::Function&& callback,
+    std::optional<std::chrono::milliseconds> timeout) noexcept {
+  auto expirationTime = expirationTimeForIdleTask(now_(), timeout);
+  auto sharedCallback = std::make_shared<jsi::Function>(std::move(callback));
+
+  return scheduleIdleTask(
+      [now = now_, sharedCallback, expirationTime](jsi::Runtime& runtime) {
+        auto currentTime = now();
+        auto didTimeout = expirationTime <= currentTime;
+        auto deadline = didTimeout ? currentTime : currentTime + kMaxIdlePeriod;
+        sharedCallback->call(
+            runtime,
+            valueFromIdleDeadline(runtime, now, deadline, didTimeout));
+      },
+      timeout);
+}
+
+std::shared_ptr<Task> RuntimeScheduler_Legacy::scheduleIdleTask(
+    RawCallback&& callback,
+    std::optional<std::chrono::milliseconds> timeout) noexcept {
+  SystraceSection s("RuntimeScheduler::scheduleIdleTask");
+
+  auto expirationTime = expirationTimeForIdleTask(now_(), timeout);
+  auto task = std::make_shared<Task>(
+      SchedulerPriority::IdlePriority, std::move(callback), expirationTime);
+  taskQueue_.push(task);
+
+  scheduleWorkLoopIfNecessary();
+
+  return task;
+}
+
 bool RuntimeScheduler_Legacy::getShouldYield() const noexcept {
   return runtimeAccessRequests_ > 0;
 }
@@ -151,6 +185,19 @@ void RuntimeScheduler_Legacy::scheduleRenderingUpdate(
   }
 }
 
+void RuntimeScheduler_Legacy::scheduleRenderingUpdate(
+    int32_t /*surfaceId*/,
+    RuntimeSchedulerRenderingUpdate&& renderingUpdate) {
+  scheduleRenderingUpdate(std::move(renderingUpdate));
+}
+
+void RuntimeScheduler_Legacy::setFrameDeadline(
+    RuntimeSchedulerTimePoint /*deadline*/) noexcept {}
+
+RuntimeSchedulerTelemetry RuntimeScheduler_Legacy::getTelemetry() const {
+  return {};
+}
+
 #pragma mark - Private
 
 void RuntimeScheduler_Legacy::scheduleWorkLoopIfNecessary() {
@@ -61,6 +61,19 @@ class RuntimeScheduler_Legacy final : public RuntimeSchedulerBase {
       SchedulerPriority priority,
       RawCallback&& callback) noexcept override;
 
+  /*
+   * Adds an idle callback as a task with idle priority. Its idle period
+   * always lasts `kMaxIdlePeriod`, as this implementation doesn't know about
+   * frame deadlines.
+   */
+  std::shared_ptr<Task> scheduleIdleTask(
+      jsi::Function&& callback,
+      std::optional<std::chrono::milliseconds> timeout) noexcept override;
+
+  std::shared_ptr<Task> scheduleIdleTask(
+      RawCallback&& callback,
+      std::optional<std::chrono::milliseconds> timeout) noexcept override;
+
   /*
    * Cancelled task will never be executed.
    *
@@ -113,6 +126,21 @@ class RuntimeScheduler_Legacy final : public RuntimeSchedulerBase {
   void scheduleRenderingUpdate(
       RuntimeSchedulerRenderingUpdate&& renderingUpdate) override;
 
+  void scheduleRenderingUpdate(
+      int32_t surfaceId,
+      RuntimeSchedulerRenderingUpdate&& renderingUpdate) override;
+
+  /*
+   * Frame deadlines are not taken into account by this implementation, which
+   * doesn't batch rendering updates.
+   */
+  void setFrameDeadline(RuntimeSchedulerTimePoint deadline) noexcept override;
+
+  /*
+   * Telemetry is not recorded by this implementation.
+   */
+  RuntimeSchedulerTelemetry getTelemetry() const override;
+
  private:
   std::priority_queue<
       std::shared_ptr<Task>,
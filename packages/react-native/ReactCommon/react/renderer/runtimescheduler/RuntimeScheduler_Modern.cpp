@@ -7,10 +7,14 @@
 
 #include "RuntimeScheduler_Modern.h"
 #include "SchedulerPriorityUtils.h"
+#include "primitives.h"
 
 #include <cxxreact/ErrorUtils.h>
 #include <react/featureflags/ReactNativeFeatureFlags.h>
 #include <react/renderer/debug/SystraceSection.h>
+#include <react/utils/CoreFeatures.h>
+#include <react/utils/PooledAllocator.h>
+#include <algorithm>
 #include <utility>
 #include "ErrorUtils.h"
 
@@ -55,7 +59,9 @@ void executeMicrotasks(jsi::Runtime& runtime) {
 RuntimeScheduler_Modern::RuntimeScheduler_Modern(
     RuntimeExecutor runtimeExecutor,
     std::function<RuntimeSchedulerTimePoint()> now)
-    : runtimeExecutor_(std::move(runtimeExecutor)), now_(std::move(now)) {}
+    : runtimeExecutor_(std::move(runtimeExecutor)),
+      featureFlags_(ReactNativeFeatureFlags::getSnapshot()),
+      now_(std::move(now)) {}
 
 void RuntimeScheduler_Modern::scheduleWork(RawCallback&& callback) noexcept {
   SystraceSection s("RuntimeScheduler::scheduleWork");
@@ -73,8 +79,8 @@ std::shared_ptr<Task> RuntimeScheduler_Modern::scheduleTask(
       "jsi::Function");
 
   auto expirationTime = now_() + timeoutForSchedulerPriority(priority);
-  auto task =
-      std::make_shared<Task>(priority, std::move(callback), expirationTime);
+  auto task = allocatePooledShared<Task>(
+      priority, std::move(callback), expirationTime);
 
   scheduleTask(task);
 
@@ -92,19 +98,53 @@ std::shared_ptr<Task> RuntimeScheduler_Modern::scheduleTask(
       "RawCallback");
 
   auto expirationTime = now_() + timeoutForSchedulerPriority(priority);
-  auto task =
-      std::make_shared<Task>(priority, std::move(callback), expirationTime);
+  auto task = allocatePooledShared<Task>(
+      priority, std::move(callback), expirationTime);
 
   scheduleTask(task);
 
   return task;
 }
 
+std::shared_ptr<Task> RuntimeScheduler_Modern::scheduleIdleTask(
+    jsi::Function&& callback,
+    std::optional<std::chrono::milliseconds> timeout) noexcept {
+  SystraceSection s(
+      "RuntimeScheduler::scheduleIdleTask", "callbackType", "jsi::Function");
+
+  auto expirationTime = expirationTimeForIdleTask(now_(), timeout);
+  auto task = allocatePooledShared<Task>(
+      SchedulerPriority::IdlePriority, std::move(callback), expirationTime);
+
+  scheduleIdleTask(task);
+
+  return task;
+}
+
+std::shared_ptr<Task> RuntimeScheduler_Modern::scheduleIdleTask(
+    RawCallback&& callback,
+    std::optional<std::chrono::milliseconds> timeout) noexcept {
+  SystraceSection s(
+      "RuntimeScheduler::scheduleIdleTask", "callbackType", "RawCallback");
+
+  auto expirationTime = expirationTimeForIdleTask(now_(), timeout);
+  auto task = allocatePooledShared<Task>(
+      SchedulerPriority::IdlePriority, std::move(callback), expirationTime);
+
+  scheduleIdleTask(task);
+
+  return task;
+}
+
 bool RuntimeScheduler_Modern::getShouldYield() const noexcept {
   std::shared_lock lock(schedulingMutex_);
 
-  return syncTaskRequests_ > 0 ||
-      (!taskQueue_.empty() && taskQueue_.top() != currentTask_);
+  if (syncTaskRequests_ > 0 || now_() >= frameDeadline_.load()) {
+    return true;
+  }
+
+  auto nextQueue = getQueueOfNextTask();
+  return nextQueue != nullptr && nextQueue->front() != currentTask_;
 }
 
 bool RuntimeScheduler_Modern::getIsSynchronous() const noexcept {
@@ -130,9 +170,14 @@ void RuntimeScheduler_Modern::executeNowOnTheSameThread(
 
   syncTaskRequests_++;
 
+  auto scheduledTime = CoreFeatures::enableRuntimeSchedulerTelemetry
+      ? now_()
+      : RuntimeSchedulerTimePoint{};
+
   executeSynchronouslyOnSameThread_CAN_DEADLOCK(
       runtimeExecutor_,
-      [this, callback = std::move(callback)](jsi::Runtime& runtime) mutable {
+      [this, callback = std::move(callback), scheduledTime](
+          jsi::Runtime& runtime) mutable {
         SystraceSection s2(
             "RuntimeScheduler::executeNowOnTheSameThread callback");
 
@@ -146,6 +191,7 @@ void RuntimeScheduler_Modern::executeNowOnTheSameThread(
             currentTime + timeoutForSchedulerPriority(priority);
         auto task = std::make_shared<Task>(
             priority, std::move(callback), expirationTime);
+        task->scheduledTime = scheduledTime;
 
         executeTask(runtime, task, currentTime);
 
@@ -159,8 +205,9 @@ void RuntimeScheduler_Modern::executeNowOnTheSameThread(
     std::unique_lock lock(schedulingMutex_);
 
     // We only need to schedule the work loop if there any remaining tasks
-    // in the queue.
-    if (!taskQueue_.empty() && !isWorkLoopScheduled_) {
+    // in the queues.
+    if ((getQueueOfNextTask() != nullptr || !idleTaskQueue_.empty()) &&
+        !isWorkLoopScheduled_) {
       isWorkLoopScheduled_ = true;
       shouldScheduleWorkLoop = true;
     }
@@ -173,7 +220,7 @@ void RuntimeScheduler_Modern::executeNowOnTheSameThread(
 
 void RuntimeScheduler_Modern::callExpiredTasks(jsi::Runtime& runtime) {
   // If we have first-class support for microtasks, this a no-op.
-  if (ReactNativeFeatureFlags::enableMicrotasks()) {
+  if (featureFlags_.enableMicrotasks) {
     return;
   }
 
@@ -185,8 +232,8 @@ void RuntimeScheduler_Modern::scheduleRenderingUpdate(
     RuntimeSchedulerRenderingUpdate&& renderingUpdate) {
   SystraceSection s("RuntimeScheduler::scheduleRenderingUpdate");
 
-  if (ReactNativeFeatureFlags::batchRenderingUpdatesInEventLoop()) {
-    pendingRenderingUpdates_.push(renderingUpdate);
+  if (featureFlags_.batchRenderingUpdatesInEventLoop) {
+    pendingRenderingUpdates_.push_back(std::move(renderingUpdate));
   } else {
     if (renderingUpdate != nullptr) {
       renderingUpdate();
@@ -194,11 +241,44 @@ void RuntimeScheduler_Modern::scheduleRenderingUpdate(
   }
 }
 
+void RuntimeScheduler_Modern::scheduleRenderingUpdate(
+    int32_t surfaceId,
+    RuntimeSchedulerRenderingUpdate&& renderingUpdate) {
+  if (!featureFlags_.batchRenderingUpdatesInEventLoop) {
+    scheduleRenderingUpdate(std::move(renderingUpdate));
+    return;
+  }
+
+  SystraceSection s("RuntimeScheduler::scheduleRenderingUpdate");
+
+  auto [iterator, inserted] = pendingRenderingUpdateIndices_.try_emplace(
+      surfaceId, pendingRenderingUpdates_.size());
+  if (inserted) {
+    pendingRenderingUpdates_.push_back(std::move(renderingUpdate));
+  } else {
+    pendingRenderingUpdates_[iterator->second] = std::move(renderingUpdate);
+  }
+}
+
+void RuntimeScheduler_Modern::setFrameDeadline(
+    RuntimeSchedulerTimePoint deadline) noexcept {
+  frameDeadline_ = deadline;
+}
+
+RuntimeSchedulerTelemetry RuntimeScheduler_Modern::getTelemetry() const {
+  std::lock_guard lock(telemetryMutex_);
+  return telemetry_;
+}
+
 #pragma mark - Private
 
 void RuntimeScheduler_Modern::scheduleTask(std::shared_ptr<Task> task) {
   bool shouldScheduleWorkLoop = false;
 
+  if (CoreFeatures::enableRuntimeSchedulerTelemetry) {
+    task->scheduledTime = now_();
+  }
+
   {
     std::unique_lock lock(schedulingMutex_);
 
@@ -206,12 +286,16 @@ void RuntimeScheduler_Modern::scheduleTask(std::shared_ptr<Task> task) {
     // schedule is the only one in the queue.
     // Otherwise, we don't need to schedule it because there's another one
     // running already that will pick up the new task.
-    if (taskQueue_.empty() && !isWorkLoopScheduled_) {
+    if (getQueueOfNextTask() == nullptr && !isWorkLoopScheduled_) {
       isWorkLoopScheduled_ = true;
       shouldScheduleWorkLoop = true;
     }
 
-    taskQueue_.push(task);
+    taskQueues_[serialize(task->priority) - 1].push(task);
+
+    if (CoreFeatures::enableRuntimeSchedulerTelemetry) {
+      recordQueueDepth();
+    }
   }
 
   if (shouldScheduleWorkLoop) {
@@ -219,6 +303,65 @@ void RuntimeScheduler_Modern::scheduleTask(std::shared_ptr<Task> task) {
   }
 }
 
+void RuntimeScheduler_Modern::scheduleIdleTask(std::shared_ptr<Task> task) {
+  bool shouldScheduleWorkLoop = false;
+
+  if (CoreFeatures::enableRuntimeSchedulerTelemetry) {
+    task->scheduledTime = now_();
+  }
+
+  {
+    std::unique_lock lock(schedulingMutex_);
+
+    // Once there is no other work to do, a scheduled or running work loop
+    // executes the idle tasks too.
+    if (getQueueOfNextTask() == nullptr && idleTaskQueue_.empty() &&
+        !isWorkLoopScheduled_) {
+      isWorkLoopScheduled_ = true;
+      shouldScheduleWorkLoop = true;
+    }
+
+    idleTaskQueue_.push_back(std::move(task));
+
+    if (CoreFeatures::enableRuntimeSchedulerTelemetry) {
+      recordQueueDepth();
+    }
+  }
+
+  if (shouldScheduleWorkLoop) {
+    scheduleWorkLoop();
+  }
+}
+
+void RuntimeScheduler_Modern::recordQueueDepth() {
+  auto queueDepth = idleTaskQueue_.size();
+  for (const auto& queue : taskQueues_) {
+    queueDepth += queue.size();
+  }
+
+  std::lock_guard lock(telemetryMutex_);
+  telemetry_.incorporateQueueDepth(queueDepth);
+}
+
+RuntimeScheduler_Modern::TaskQueue*
+RuntimeScheduler_Modern::getQueueOfNextTask() {
+  return const_cast<TaskQueue*>(std::as_const(*this).getQueueOfNextTask());
+}
+
+const RuntimeScheduler_Modern::TaskQueue*
+RuntimeScheduler_Modern::getQueueOfNextTask() const {
+  const TaskQueue* nextQueue = nullptr;
+  for (const auto& queue : taskQueues_) {
+    // On equal expiration times, the higher priority wins.
+    if (!queue.empty() &&
+        (nextQueue == nullptr ||
+         queue.front()->expirationTime < nextQueue->front()->expirationTime)) {
+      nextQueue = &queue;
+    }
+  }
+  return nextQueue;
+}
+
 void RuntimeScheduler_Modern::scheduleWorkLoop() {
   runtimeExecutor_(
       [this](jsi::Runtime& runtime) { startWorkLoop(runtime, false); });
@@ -236,6 +379,15 @@ void RuntimeScheduler_Modern::startWorkLoop(
       auto currentTime = now_();
       auto topPriorityTask = selectTask(currentTime, onlyExpired);
 
+      // Idle tasks are executed when there is nothing else to do, unless they
+      // timed out.
+      auto idleTask = selectIdleTask(
+          currentTime, onlyExpired || topPriorityTask != nullptr);
+      if (idleTask) {
+        executeTask(runtime, idleTask, currentTime, true);
+        continue;
+      }
+
       if (!topPriorityTask) {
         // No pending work to do.
         // Events will restart the loop when necessary.
@@ -263,12 +415,14 @@ std::shared_ptr<Task> RuntimeScheduler_Modern::selectTask(
   isWorkLoopScheduled_ = false;
 
   // Skip executed tasks
-  while (!taskQueue_.empty() && !taskQueue_.top()->callback) {
-    taskQueue_.pop();
+  auto nextQueue = getQueueOfNextTask();
+  while (nextQueue != nullptr && !nextQueue->front()->callback) {
+    nextQueue->pop();
+    nextQueue = getQueueOfNextTask();
   }
 
-  if (!taskQueue_.empty()) {
-    auto task = taskQueue_.top();
+  if (nextQueue != nullptr) {
+    auto task = nextQueue->front();
     auto didUserCallbackTimeout = task->expirationTime <= currentTime;
     if (!onlyExpired || didUserCallbackTimeout) {
       return task;
@@ -278,33 +432,141 @@ std::shared_ptr<Task> RuntimeScheduler_Modern::selectTask(
   return nullptr;
 }
 
+std::shared_ptr<Task> RuntimeScheduler_Modern::selectIdleTask(
+    RuntimeSchedulerTimePoint currentTime,
+    bool onlyTimedOut) {
+  if (onlyTimedOut) {
+    // Other work interrupts the idle period.
+    idlePeriodDeadline_.reset();
+  }
+
+  bool shouldScheduleWorkLoop = false;
+
+  {
+    std::unique_lock lock(schedulingMutex_);
+
+    // Skip cancelled tasks
+    while (!idleTaskQueue_.empty() && !idleTaskQueue_.front()->callback) {
+      idleTaskQueue_.pop_front();
+    }
+
+    if (idleTaskQueue_.empty()) {
+      idlePeriodDeadline_.reset();
+      return nullptr;
+    }
+
+    auto timedOutTask = std::find_if(
+        idleTaskQueue_.begin(),
+        idleTaskQueue_.end(),
+        [currentTime](const std::shared_ptr<Task>& task) {
+          return task->callback && task->expirationTime <= currentTime;
+        });
+    if (timedOutTask != idleTaskQueue_.end()) {
+      auto task = std::move(*timedOutTask);
+      idleTaskQueue_.erase(timedOutTask);
+      return task;
+    }
+
+    if (onlyTimedOut) {
+      return nullptr;
+    }
+
+    if (!idlePeriodDeadline_) {
+      // The idle period lasts until the rendering updates for the current
+      // frame are needed.
+      auto frameDeadline = frameDeadline_.load();
+      auto maxDeadline = currentTime + kMaxIdlePeriod;
+      idlePeriodDeadline_ = frameDeadline > currentTime
+          ? std::min(frameDeadline, maxDeadline)
+          : maxDeadline;
+    }
+
+    if (currentTime < *idlePeriodDeadline_) {
+      auto task = std::move(idleTaskQueue_.front());
+      idleTaskQueue_.pop_front();
+      return task;
+    }
+
+    // The remaining idle tasks are executed in the next idle period, after
+    // the work scheduled on the runtime in the meantime.
+    idlePeriodDeadline_.reset();
+    if (!isWorkLoopScheduled_) {
+      isWorkLoopScheduled_ = true;
+      shouldScheduleWorkLoop = true;
+    }
+  }
+
+  if (shouldScheduleWorkLoop) {
+    scheduleWorkLoop();
+  }
+
+  return nullptr;
+}
+
 void RuntimeScheduler_Modern::executeTask(
     jsi::Runtime& runtime,
     const std::shared_ptr<Task>& task,
-    RuntimeSchedulerTimePoint currentTime) {
+    RuntimeSchedulerTimePoint currentTime,
+    bool isIdleTask) {
   auto didUserCallbackTimeout = task->expirationTime <= currentTime;
+  auto isTelemetryEnabled = CoreFeatures::enableRuntimeSchedulerTelemetry;
+  auto waitTime = isTelemetryEnabled ? currentTime - task->scheduledTime
+                                     : RuntimeSchedulerDuration{};
 
   SystraceSection s(
       "RuntimeScheduler::executeTask",
       "priority",
       serialize(task->priority),
       "didUserCallbackTimeout",
-      didUserCallbackTimeout);
+      didUserCallbackTimeout,
+      "waitTimeUs",
+      std::chrono::duration_cast<std::chrono::microseconds>(waitTime).count());
 
   currentTask_ = task;
   currentPriority_ = task->priority;
 
-  executeMacrotask(runtime, task, didUserCallbackTimeout);
+  if (isIdleTask) {
+    auto deadline = didUserCallbackTimeout
+        ? currentTime
+        : idlePeriodDeadline_.value_or(currentTime);
+    executeIdleMacrotask(runtime, task, deadline, didUserCallbackTimeout);
+  } else {
+    executeMacrotask(runtime, task, didUserCallbackTimeout);
+  }
 
-  if (ReactNativeFeatureFlags::enableMicrotasks()) {
+  if (featureFlags_.enableMicrotasks) {
     // "Perform a microtask checkpoint" step.
     executeMicrotasks(runtime);
   }
 
-  if (ReactNativeFeatureFlags::batchRenderingUpdatesInEventLoop()) {
+  if (featureFlags_.batchRenderingUpdatesInEventLoop) {
     // "Update the rendering" step.
     updateRendering();
   }
+
+  if (isTelemetryEnabled) {
+    auto endTime = now_();
+    {
+      std::lock_guard lock(telemetryMutex_);
+      telemetry_.incorporateTask(
+          task->priority,
+          waitTime,
+          endTime - currentTime,
+          didUserCallbackTimeout);
+    }
+    // A continuation waits from the end of this execution.
+    task->scheduledTime = endTime;
+  }
+
+  // A task which ran past the deadline of the frame has yielded (or finished)
+  // for its rendering updates already, so the deadline must not make the
+  // following tasks yield too. A deadline that was reported in the meantime
+  // is kept.
+  auto frameDeadline = frameDeadline_.load();
+  if (frameDeadline <= now_()) {
+    frameDeadline_.compare_exchange_strong(
+        frameDeadline, RuntimeSchedulerTimePoint::max());
+  }
 }
 
 /**
@@ -315,12 +577,17 @@ void RuntimeScheduler_Modern::executeTask(
 void RuntimeScheduler_Modern::updateRendering() {
   SystraceSection s("RuntimeScheduler::updateRendering");
 
+  // Rendering updates may schedule more of them, which run in this step too.
   while (!pendingRenderingUpdates_.empty()) {
-    auto& pendingRenderingUpdate = pendingRenderingUpdates_.front();
-    if (pendingRenderingUpdate != nullptr) {
-      pendingRenderingUpdate();
+    auto renderingUpdates = std::move(pendingRenderingUpdates_);
+    pendingRenderingUpdates_.clear();
+    pendingRenderingUpdateIndices_.clear();
+
+    for (auto& renderingUpdate : renderingUpdates) {
+      if (renderingUpdate != nullptr) {
+        renderingUpdate();
+      }
     }
-    pendingRenderingUpdates_.pop();
   }
 }
 
@@ -339,4 +606,16 @@ void RuntimeScheduler_Modern::executeMacrotask(
   }
 }
 
+void RuntimeScheduler_Modern::executeIdleMacrotask(
+    jsi::Runtime& runtime,
+    const std::shared_ptr<Task>& task,
+    RuntimeSchedulerTimePoint deadline,
+    bool didTimeout) const {
+  SystraceSection s("RuntimeScheduler::executeIdleMacrotask");
+
+  // Idle callbacks don't return continuations.
+  task->execute(
+      runtime, valueFromIdleDeadline(runtime, now_, deadline, didTimeout));
+}
+
 } // namespace facebook::react
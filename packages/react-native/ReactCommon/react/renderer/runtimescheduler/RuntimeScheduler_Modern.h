@@ -8,13 +8,21 @@
 #pragma once
 
 #include <ReactCommon/RuntimeExecutor.h>
+#include <react/featureflags/ReactNativeFeatureFlagsSnapshot.h>
 #include <react/renderer/runtimescheduler/RuntimeScheduler.h>
 #include <react/renderer/runtimescheduler/RuntimeSchedulerClock.h>
 #include <react/renderer/runtimescheduler/Task.h>
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <queue>
 #include <shared_mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace facebook::react {
 
@@ -70,6 +78,22 @@ class RuntimeScheduler_Modern final : public RuntimeSchedulerBase {
       SchedulerPriority priority,
       RawCallback&& callback) noexcept override;
 
+  /*
+   * Adds a callback to execute in the next idle period, which starts when
+   * there are no other tasks to execute and lasts until the deadline of the
+   * current frame (or at most `kMaxIdlePeriod`). Idle callbacks which don't
+   * fit in the period are executed in the next one, after the work scheduled
+   * on the runtime in the meantime. If `timeout` passes before, the callback
+   * is executed as soon as possible instead.
+   */
+  std::shared_ptr<Task> scheduleIdleTask(
+      jsi::Function&& callback,
+      std::optional<std::chrono::milliseconds> timeout) noexcept override;
+
+  std::shared_ptr<Task> scheduleIdleTask(
+      RawCallback&& callback,
+      std::optional<std::chrono::milliseconds> timeout) noexcept override;
+
   /*
    * Cancelled task will never be executed.
    *
@@ -130,27 +154,91 @@ class RuntimeScheduler_Modern final : public RuntimeSchedulerBase {
   void scheduleRenderingUpdate(
       RuntimeSchedulerRenderingUpdate&& renderingUpdate) override;
 
+  /**
+   * Same as above, but only the last rendering update scheduled for a surface
+   * is executed in the "Update the rendering" step; it takes the place of the
+   * ones scheduled before it.
+   */
+  void scheduleRenderingUpdate(
+      int32_t surfaceId,
+      RuntimeSchedulerRenderingUpdate&& renderingUpdate) override;
+
+  /*
+   * Sets the time by which the rendering updates of the current frame are
+   * needed. Once it is reached, `getShouldYield` returns true until the task
+   * being executed finishes (and the rendering is updated), so React yields
+   * at most once per reported frame.
+   *
+   * Can be called from any thread.
+   */
+  void setFrameDeadline(RuntimeSchedulerTimePoint deadline) noexcept override;
+
+  /*
+   * Returns a snapshot of the telemetry aggregated over the tasks executed so
+   * far. Tasks are only measured with
+   * `CoreFeatures::enableRuntimeSchedulerTelemetry`.
+   *
+   * Can be called from any thread.
+   */
+  RuntimeSchedulerTelemetry getTelemetry() const override;
+
  private:
   std::atomic<uint_fast8_t> syncTaskRequests_{0};
 
-  std::priority_queue<
-      std::shared_ptr<Task>,
-      std::vector<std::shared_ptr<Task>>,
-      TaskPriorityComparer>
-      taskQueue_;
+  /*
+   * Deadline of the current frame, or `RuntimeSchedulerTimePoint::max()` if
+   * there is none (either never reported or already used by a yield).
+   */
+  std::atomic<RuntimeSchedulerTimePoint> frameDeadline_{
+      RuntimeSchedulerTimePoint::max()};
+
+  using TaskQueue = std::queue<std::shared_ptr<Task>>;
+
+  /*
+   * Tasks of each priority (indexed by priority, highest first) in the order
+   * they were scheduled. Tasks of a priority share the same timeout, so they
+   * expire in that order too, and the next task to execute is the one which
+   * expires first among the fronts of the queues.
+   */
+  std::array<TaskQueue, 5> taskQueues_;
+
+  /*
+   * Idle tasks in the order they were scheduled.
+   */
+  std::deque<std::shared_ptr<Task>> idleTaskQueue_;
+
+  /*
+   * Deadline of the idle period in progress, if any. Only accessed on the
+   * JavaScript thread.
+   */
+  std::optional<RuntimeSchedulerTimePoint> idlePeriodDeadline_;
 
   std::shared_ptr<Task> currentTask_;
 
   /**
-   * This protects the access to `taskQueue_` and `isWorkLoopScheduled_`.
+   * This protects the access to `taskQueues_`, `idleTaskQueue_` and
+   * `isWorkLoopScheduled_`.
    */
   mutable std::shared_mutex schedulingMutex_;
 
   const RuntimeExecutor runtimeExecutor_;
+
+  /*
+   * Feature flags read on every iteration of the event loop.
+   */
+  const ReactNativeFeatureFlagsSnapshot& featureFlags_;
+
   SchedulerPriority currentPriority_{SchedulerPriority::NormalPriority};
 
   std::atomic_bool isSynchronous_{false};
 
+  RuntimeSchedulerTelemetry telemetry_;
+
+  /**
+   * This protects the access to `telemetry_`.
+   */
+  mutable std::mutex telemetryMutex_;
+
   void scheduleWorkLoop();
   void startWorkLoop(jsi::Runtime& runtime, bool onlyExpired);
 
@@ -158,8 +246,32 @@ class RuntimeScheduler_Modern final : public RuntimeSchedulerBase {
       RuntimeSchedulerTimePoint currentTime,
       bool onlyExpired);
 
+  /*
+   * Returns the idle task to execute next, if any: one which timed out, or,
+   * unless `onlyTimedOut`, the next one if there is time left in the idle
+   * period. Ends the idle period otherwise.
+   */
+  std::shared_ptr<Task> selectIdleTask(
+      RuntimeSchedulerTimePoint currentTime,
+      bool onlyTimedOut);
+
   void scheduleTask(std::shared_ptr<Task> task);
 
+  void scheduleIdleTask(std::shared_ptr<Task> task);
+
+  /*
+   * Returns the queue whose front task is to be executed next, or `nullptr`
+   * if there are no tasks. Must be called with `schedulingMutex_` held.
+   */
+  TaskQueue* getQueueOfNextTask();
+  const TaskQueue* getQueueOfNextTask() const;
+
+  /*
+   * Incorporates the number of waiting tasks into the telemetry. Must be
+   * called with `schedulingMutex_` held.
+   */
+  void recordQueueDepth();
+
   /**
    * Follows all the steps necessary to execute the given task.
    * Depending on feature flags, this could also execute its microtasks.
@@ -169,13 +281,20 @@ class RuntimeScheduler_Modern final : public RuntimeSchedulerBase {
   void executeTask(
       jsi::Runtime& runtime,
       const std::shared_ptr<Task>& task,
-      RuntimeSchedulerTimePoint currentTime);
+      RuntimeSchedulerTimePoint currentTime,
+      bool isIdleTask = false);
 
   void executeMacrotask(
       jsi::Runtime& runtime,
       std::shared_ptr<Task> task,
       bool didUserCallbackTimeout) const;
 
+  void executeIdleMacrotask(
+      jsi::Runtime& runtime,
+      const std::shared_ptr<Task>& task,
+      RuntimeSchedulerTimePoint deadline,
+      bool didTimeout) const;
+
   void updateRendering();
 
   /*
@@ -190,7 +309,13 @@ class RuntimeScheduler_Modern final : public RuntimeSchedulerBase {
    */
   bool isWorkLoopScheduled_{false};
 
-  std::queue<RuntimeSchedulerRenderingUpdate> pendingRenderingUpdates_;
+  std::vector<RuntimeSchedulerRenderingUpdate> pendingRenderingUpdates_;
+
+  /*
+   * Indices of the pending rendering updates of surfaces in
+   * `pendingRenderingUpdates_`.
+   */
+  std::unordered_map<int32_t, size_t> pendingRenderingUpdateIndices_;
 };
 
 } // namespace facebook::react
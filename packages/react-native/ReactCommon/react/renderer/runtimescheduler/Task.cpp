@@ -26,6 +26,13 @@ Task::Task(
       expirationTime(expirationTime) {}
 
 jsi::Value Task::execute(jsi::Runtime& runtime, bool didUserCallbackTimeout) {
+  // Callback in JavaScript is expecting a single bool parameter.
+  // React team plans to remove it in the future when a scheduler bug on web
+  // is resolved.
+  return execute(runtime, jsi::Value(didUserCallbackTimeout));
+}
+
+jsi::Value Task::execute(jsi::Runtime& runtime, const jsi::Value& argument) {
   auto result = jsi::Value::undefined();
   // Canceled task doesn't have a callback.
   if (!callback) {
@@ -35,11 +42,8 @@ jsi::Value Task::execute(jsi::Runtime& runtime, bool didUserCallbackTimeout) {
   auto& cbVal = callback.value();
 
   if (cbVal.index() == 0) {
-    // Callback in JavaScript is expecting a single bool parameter.
-    // React team plans to remove it in the future when a scheduler bug on web
-    // is resolved.
     result =
-        std::get<jsi::Function>(cbVal).call(runtime, {didUserCallbackTimeout});
+        std::get<jsi::Function>(cbVal).call(runtime, &argument, size_t{1});
   } else {
     // Calling a raw callback
     std::get<RawCallback>(cbVal)(runtime);
@@ -42,7 +42,17 @@ struct Task final : public jsi::NativeState {
   std::optional<std::variant<jsi::Function, RawCallback>> callback;
   RuntimeSchedulerClock::time_point expirationTime;
 
+  // Time since when the task waits for execution; only recorded with
+  // `CoreFeatures::enableRuntimeSchedulerTelemetry`.
+  RuntimeSchedulerClock::time_point scheduledTime{};
+
   jsi::Value execute(jsi::Runtime& runtime, bool didUserCallbackTimeout);
+
+  /*
+   * Executes the callback with the given argument (e.g. an `IdleDeadline`)
+   * instead of whether the task timed out.
+   */
+  jsi::Value execute(jsi::Runtime& runtime, const jsi::Value& argument);
 };
 
 class TaskPriorityComparer {
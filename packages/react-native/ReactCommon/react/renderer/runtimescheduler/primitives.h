@@ -8,11 +8,33 @@
 #pragma once
 
 #include <jsi/jsi.h>
+#include <react/renderer/runtimescheduler/RuntimeSchedulerClock.h>
 #include <react/renderer/runtimescheduler/Task.h>
 #include <react/utils/CoreFeatures.h>
 
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <optional>
+
 namespace facebook::react {
 
+/*
+ * Longest idle period given to idle callbacks, so they don't delay work which
+ * is scheduled while they run (as on the Web).
+ */
+static constexpr auto kMaxIdlePeriod = std::chrono::milliseconds(50);
+
+/*
+ * Returns the expiration time of an idle task scheduled at `now`, which never
+ * expires without a timeout.
+ */
+inline static RuntimeSchedulerTimePoint expirationTimeForIdleTask(
+    RuntimeSchedulerTimePoint now,
+    std::optional<std::chrono::milliseconds> timeout) {
+  return timeout ? now + *timeout : RuntimeSchedulerTimePoint::max();
+}
+
 inline static jsi::Value valueFromTask(
     jsi::Runtime& runtime,
     std::shared_ptr<Task> task) {
@@ -30,4 +52,34 @@ inline static std::shared_ptr<Task> taskFromValue(
   return value.getObject(runtime).getNativeState<Task>(runtime);
 }
 
+/*
+ * Creates an `IdleDeadline` object passed to idle callbacks, which returns
+ * the time remaining until `deadline` from `timeRemaining()`.
+ */
+inline static jsi::Value valueFromIdleDeadline(
+    jsi::Runtime& runtime,
+    std::function<RuntimeSchedulerTimePoint()> now,
+    RuntimeSchedulerTimePoint deadline,
+    bool didTimeout) {
+  jsi::Object obj(runtime);
+  obj.setProperty(runtime, "didTimeout", didTimeout);
+  obj.setProperty(
+      runtime,
+      "timeRemaining",
+      jsi::Function::createFromHostFunction(
+          runtime,
+          jsi::PropNameID::forAscii(runtime, "timeRemaining"),
+          0,
+          [now = std::move(now), deadline](
+              jsi::Runtime&,
+              const jsi::Value&,
+              const jsi::Value*,
+              size_t) noexcept -> jsi::Value {
+            auto timeRemaining =
+                std::chrono::duration<double, std::milli>(deadline - now());
+            return {std::max(timeRemaining.count(), 0.0)};
+          }));
+  return obj;
+}
+
 } // namespace facebook::react
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/runtimescheduler/RuntimeSchedulerTelemetry.h>
+#include <chrono>
+
+using namespace facebook::react;
+using namespace std::chrono_literals;
+
+TEST(RuntimeSchedulerTelemetryTest, incorporateTask) {
+  auto telemetry = RuntimeSchedulerTelemetry{};
+
+  telemetry.incorporateTask(SchedulerPriority::NormalPriority, 2ms, 5ms, false);
+  telemetry.incorporateTask(SchedulerPriority::NormalPriority, 8ms, 1ms, true);
+  telemetry.incorporateTask(SchedulerPriority::LowPriority, 3ms, 4ms, false);
+
+  const auto& normalPriorityTelemetry =
+      telemetry.getPriorityTelemetry(SchedulerPriority::NormalPriority);
+  EXPECT_EQ(normalPriorityTelemetry.numberOfTasks, 2);
+  EXPECT_EQ(normalPriorityTelemetry.numberOfTimedOutTasks, 1);
+  EXPECT_EQ(normalPriorityTelemetry.totalWaitTime, 10ms);
+  EXPECT_EQ(normalPriorityTelemetry.maxWaitTime, 8ms);
+  EXPECT_EQ(normalPriorityTelemetry.totalRunTime, 6ms);
+  EXPECT_EQ(normalPriorityTelemetry.maxRunTime, 5ms);
+
+  const auto& lowPriorityTelemetry =
+      telemetry.getPriorityTelemetry(SchedulerPriority::LowPriority);
+  EXPECT_EQ(lowPriorityTelemetry.numberOfTasks, 1);
+  EXPECT_EQ(lowPriorityTelemetry.numberOfTimedOutTasks, 0);
+  EXPECT_EQ(lowPriorityTelemetry.totalWaitTime, 3ms);
+  EXPECT_EQ(lowPriorityTelemetry.totalRunTime, 4ms);
+
+  EXPECT_EQ(
+      telemetry.getPriorityTelemetry(SchedulerPriority::ImmediatePriority)
+          .numberOfTasks,
+      0);
+}
+
+TEST(RuntimeSchedulerTelemetryTest, incorporateQueueDepth) {
+  auto telemetry = RuntimeSchedulerTelemetry{};
+  EXPECT_EQ(telemetry.getMaxQueueDepth(), 0);
+
+  telemetry.incorporateQueueDepth(3);
+  telemetry.incorporateQueueDepth(7);
+  telemetry.incorporateQueueDepth(2);
+
+  EXPECT_EQ(telemetry.getMaxQueueDepth(), 7);
+}
@@ -11,8 +11,12 @@
 #include <react/featureflags/ReactNativeFeatureFlags.h>
 #include <react/featureflags/ReactNativeFeatureFlagsDefaults.h>
 #include <react/renderer/runtimescheduler/RuntimeScheduler.h>
+#include <react/renderer/runtimescheduler/primitives.h>
+#include <react/utils/CoreFeatures.h>
 #include <memory>
 #include <semaphore>
+#include <string>
+#include <vector>
 
 #include "StubClock.h"
 #include "StubErrorUtils.h"
@@ -62,7 +66,17 @@ class RuntimeSchedulerTest : public testing::TestWithParam<bool> {
         facebook::hermes::makeHermesRuntime(runtimeConfigBuilder.build());
     stubErrorUtils_ = StubErrorUtils::createAndInstallIfNeeded(*runtime_);
     stubQueue_ = std::make_unique<StubQueue>();
+    stubClock_ = std::make_unique<StubClock>(StubClock());
+
+    createRuntimeScheduler();
+  }
+
+  void TearDown() override {
+    ReactNativeFeatureFlags::dangerouslyReset();
+    forcedBatchRenderingUpdatesInEventLoop = false;
+  }
 
+  void createRuntimeScheduler() {
     RuntimeExecutor runtimeExecutor =
         [this](
             std::function<void(facebook::jsi::Runtime & runtime)>&& callback) {
@@ -71,8 +85,6 @@ class RuntimeSchedulerTest : public testing::TestWithParam<bool> {
           });
         };
 
-    stubClock_ = std::make_unique<StubClock>(StubClock());
-
     auto stubNow = [this]() -> RuntimeSchedulerTimePoint {
       return stubClock_->getNow();
     };
@@ -81,8 +93,13 @@ class RuntimeSchedulerTest : public testing::TestWithParam<bool> {
         std::make_unique<RuntimeScheduler>(runtimeExecutor, stubNow);
   }
 
-  void TearDown() override {
+  // The scheduler reads feature flags once, when it's created.
+  void setBatchRenderingUpdatesInEventLoop(bool enabled) {
+    forcedBatchRenderingUpdatesInEventLoop = enabled;
     ReactNativeFeatureFlags::dangerouslyReset();
+    ReactNativeFeatureFlags::override(
+        std::make_unique<RuntimeSchedulerTestFeatureFlags>(GetParam()));
+    createRuntimeScheduler();
   }
 
   jsi::Function createHostFunctionFromLambda(
@@ -152,7 +169,7 @@ TEST_P(RuntimeSchedulerTest, scheduleSingleTask) {
 }
 
 TEST_P(RuntimeSchedulerTest, scheduleNonBatchedRenderingUpdate) {
-  forcedBatchRenderingUpdatesInEventLoop = false;
+  setBatchRenderingUpdatesInEventLoop(false);
 
   bool didRunRenderingUpdate = false;
 
@@ -170,7 +187,7 @@ TEST_P(
     return;
   }
 
-  forcedBatchRenderingUpdatesInEventLoop = true;
+  setBatchRenderingUpdatesInEventLoop(true);
 
   uint nextOperationPosition = 1;
 
@@ -227,6 +244,50 @@ TEST_P(
   EXPECT_EQ(stubQueue_->size(), 0);
 }
 
+TEST_P(RuntimeSchedulerTest, coalesceBatchedRenderingUpdatesOfSurface) {
+  // Only for modern runtime scheduler
+  if (!GetParam()) {
+    return;
+  }
+
+  setBatchRenderingUpdatesInEventLoop(true);
+
+  auto renderingUpdates = std::vector<std::string>{};
+
+  auto callback = createHostFunctionFromLambda([&](bool /* unused */) {
+    runtimeScheduler_->scheduleRenderingUpdate(
+        1, [&]() { renderingUpdates.push_back("surface 1, first"); });
+    runtimeScheduler_->scheduleRenderingUpdate(
+        2, [&]() { renderingUpdates.push_back("surface 2"); });
+    runtimeScheduler_->scheduleRenderingUpdate(
+        [&]() { renderingUpdates.push_back("unkeyed"); });
+    runtimeScheduler_->scheduleRenderingUpdate(
+        1, [&]() { renderingUpdates.push_back("surface 1, second"); });
+    return jsi::Value::undefined();
+  });
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(callback));
+  stubQueue_->tick();
+
+  EXPECT_EQ(
+      renderingUpdates,
+      (std::vector<std::string>{"surface 1, second", "surface 2", "unkeyed"}));
+
+  // Updates of the next task are not coalesced with those of this one.
+  renderingUpdates.clear();
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority,
+      createHostFunctionFromLambda([&](bool /* unused */) {
+        runtimeScheduler_->scheduleRenderingUpdate(
+            1, [&]() { renderingUpdates.push_back("surface 1, third"); });
+        return jsi::Value::undefined();
+      }));
+  stubQueue_->tick();
+
+  EXPECT_EQ(renderingUpdates, (std::vector<std::string>{"surface 1, third"}));
+}
+
 TEST_P(RuntimeSchedulerTest, scheduleImmediatePriorityTask) {
   bool didRunTask = false;
   auto callback =
@@ -338,6 +399,39 @@ TEST_P(RuntimeSchedulerTest, scheduleTwoTasksWithDifferentPriorities) {
   EXPECT_EQ(hostFunctionCallCount_, 2);
 }
 
+TEST_P(RuntimeSchedulerTest, scheduleTasksWithDifferentPrioritiesByExpiration) {
+  uint normalPriorityTaskCallOrder = 0;
+  auto callbackOne = createHostFunctionFromLambda(
+      [this, &normalPriorityTaskCallOrder](bool /*unused*/) {
+        normalPriorityTaskCallOrder = hostFunctionCallCount_;
+        return jsi::Value::undefined();
+      });
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(callbackOne));
+
+  // The normal priority task expires before the user blocking one, which is
+  // scheduled almost 5 seconds later.
+  stubClock_->advanceTimeBy(std::chrono::milliseconds(4900));
+
+  uint userBlockingPriorityTaskCallOrder = 0;
+  auto callbackTwo = createHostFunctionFromLambda(
+      [this, &userBlockingPriorityTaskCallOrder](bool /*unused*/) {
+        userBlockingPriorityTaskCallOrder = hostFunctionCallCount_;
+        return jsi::Value::undefined();
+      });
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::UserBlockingPriority, std::move(callbackTwo));
+
+  stubQueue_->tick();
+
+  EXPECT_EQ(normalPriorityTaskCallOrder, 1);
+  EXPECT_EQ(userBlockingPriorityTaskCallOrder, 2);
+  EXPECT_EQ(stubQueue_->size(), 0);
+  EXPECT_EQ(hostFunctionCallCount_, 2);
+}
+
 TEST_P(RuntimeSchedulerTest, cancelTask) {
   bool didRunTask = false;
   auto callback = createHostFunctionFromLambda([&didRunTask](bool /*unused*/) {
@@ -723,6 +817,191 @@ TEST_P(RuntimeSchedulerTest, immediateTaskYieldsToSynchronousAccess) {
   EXPECT_EQ(stubQueue_->size(), 0);
 }
 
+TEST_P(RuntimeSchedulerTest, normalTaskYieldsAtFrameDeadline) {
+  // Only for modern runtime scheduler
+  if (!GetParam()) {
+    return;
+  }
+
+  runtimeScheduler_->setFrameDeadline(stubClock_->getNow() + 16ms);
+
+  uint firstTaskYieldCount = 0;
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority,
+      [this, &firstTaskYieldCount](jsi::Runtime& /*unused*/) {
+        EXPECT_FALSE(runtimeScheduler_->getShouldYield());
+        stubClock_->advanceTimeBy(10ms);
+        EXPECT_FALSE(runtimeScheduler_->getShouldYield());
+        stubClock_->advanceTimeBy(6ms);
+        if (runtimeScheduler_->getShouldYield()) {
+          firstTaskYieldCount++;
+        }
+      });
+
+  bool didSecondTaskYield = true;
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority,
+      [this, &didSecondTaskYield](jsi::Runtime& /*unused*/) {
+        didSecondTaskYield = runtimeScheduler_->getShouldYield();
+      });
+
+  stubQueue_->tick();
+
+  // The deadline made the first task yield and was used up by it.
+  EXPECT_EQ(firstTaskYieldCount, 1);
+  EXPECT_FALSE(didSecondTaskYield);
+  EXPECT_FALSE(runtimeScheduler_->getShouldYield());
+
+  // The deadline of the next frame is honoured again.
+  runtimeScheduler_->setFrameDeadline(stubClock_->getNow());
+  EXPECT_TRUE(runtimeScheduler_->getShouldYield());
+}
+
+TEST_P(RuntimeSchedulerTest, idleTaskRunsWhenThereIsNothingElseToDo) {
+  // Only for modern runtime scheduler
+  if (!GetParam()) {
+    return;
+  }
+
+  runtimeScheduler_->setFrameDeadline(stubClock_->getNow() + 10ms);
+
+  uint idleTaskCallOrder = 0;
+  double timeRemaining = 0;
+  bool didTimeout = true;
+  auto idleCallback = jsi::Function::createFromHostFunction(
+      *runtime_,
+      jsi::PropNameID::forUtf8(*runtime_, ""),
+      1,
+      [&](jsi::Runtime& runtime,
+          const jsi::Value& /*unused*/,
+          const jsi::Value* arguments,
+          size_t /*unused*/) -> jsi::Value {
+        idleTaskCallOrder = ++hostFunctionCallCount_;
+        auto idleDeadline = arguments[0].getObject(runtime);
+        timeRemaining =
+            idleDeadline.getPropertyAsFunction(runtime, "timeRemaining")
+                .call(runtime)
+                .getNumber();
+        didTimeout = idleDeadline.getProperty(runtime, "didTimeout").getBool();
+        return jsi::Value::undefined();
+      });
+
+  runtimeScheduler_->scheduleIdleTask(std::move(idleCallback));
+
+  uint normalTaskCallOrder = 0;
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority,
+      [this, &normalTaskCallOrder](jsi::Runtime& /*unused*/) {
+        normalTaskCallOrder = ++hostFunctionCallCount_;
+      });
+
+  stubQueue_->tick();
+
+  EXPECT_EQ(normalTaskCallOrder, 1);
+  EXPECT_EQ(idleTaskCallOrder, 2);
+  EXPECT_EQ(timeRemaining, 10);
+  EXPECT_FALSE(didTimeout);
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
+TEST_P(RuntimeSchedulerTest, idleTasksWaitForNextIdlePeriod) {
+  // Only for modern runtime scheduler
+  if (!GetParam()) {
+    return;
+  }
+
+  uint idleTaskCount = 0;
+  runtimeScheduler_->scheduleIdleTask(
+      [this, &idleTaskCount](jsi::Runtime& /*unused*/) {
+        idleTaskCount++;
+        stubClock_->advanceTimeBy(kMaxIdlePeriod);
+      });
+  runtimeScheduler_->scheduleIdleTask(
+      [&idleTaskCount](jsi::Runtime& /*unused*/) { idleTaskCount++; });
+
+  stubQueue_->tick();
+
+  // The first task used up the idle period.
+  EXPECT_EQ(idleTaskCount, 1);
+  EXPECT_EQ(stubQueue_->size(), 1);
+
+  stubQueue_->tick();
+
+  EXPECT_EQ(idleTaskCount, 2);
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
+TEST_P(RuntimeSchedulerTest, timedOutIdleTaskRunsBeforeOtherTasks) {
+  // Only for modern runtime scheduler
+  if (!GetParam()) {
+    return;
+  }
+
+  uint idleTaskCallOrder = 0;
+  runtimeScheduler_->scheduleIdleTask(
+      [this, &idleTaskCallOrder](jsi::Runtime& /*unused*/) {
+        idleTaskCallOrder = ++hostFunctionCallCount_;
+      },
+      100ms);
+
+  uint normalTaskCallOrder = 0;
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority,
+      [this, &normalTaskCallOrder](jsi::Runtime& /*unused*/) {
+        normalTaskCallOrder = ++hostFunctionCallCount_;
+      });
+
+  stubClock_->advanceTimeBy(200ms);
+  stubQueue_->tick();
+
+  EXPECT_EQ(idleTaskCallOrder, 1);
+  EXPECT_EQ(normalTaskCallOrder, 2);
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
+TEST_P(RuntimeSchedulerTest, cancelIdleTask) {
+  bool didRunTask = false;
+  auto task = runtimeScheduler_->scheduleIdleTask(
+      [&didRunTask](jsi::Runtime& /*unused*/) { didRunTask = true; });
+
+  runtimeScheduler_->cancelTask(*task);
+  stubQueue_->tick();
+
+  EXPECT_FALSE(didRunTask);
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
+TEST_P(RuntimeSchedulerTest, recordsTelemetryOfTasks) {
+  // Only for modern runtime scheduler
+  if (!GetParam()) {
+    return;
+  }
+
+  CoreFeatures::enableRuntimeSchedulerTelemetry = true;
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, [this](jsi::Runtime& /*unused*/) {
+        stubClock_->advanceTimeBy(2ms);
+      });
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, [](jsi::Runtime& /*unused*/) {});
+
+  stubClock_->advanceTimeBy(3ms);
+  stubQueue_->tick();
+
+  CoreFeatures::enableRuntimeSchedulerTelemetry = false;
+
+  auto telemetry = runtimeScheduler_->getTelemetry();
+  const auto& normalPriorityTelemetry =
+      telemetry.getPriorityTelemetry(SchedulerPriority::NormalPriority);
+  EXPECT_EQ(normalPriorityTelemetry.numberOfTasks, 2);
+  EXPECT_EQ(normalPriorityTelemetry.numberOfTimedOutTasks, 0);
+  EXPECT_EQ(normalPriorityTelemetry.totalWaitTime, 8ms);
+  EXPECT_EQ(normalPriorityTelemetry.maxWaitTime, 5ms);
+  EXPECT_EQ(normalPriorityTelemetry.totalRunTime, 2ms);
+  EXPECT_EQ(telemetry.getMaxQueueDepth(), 2);
+}
+
 TEST_P(RuntimeSchedulerTest, scheduleTaskFromTask) {
   bool didRunFirstTask = false;
   bool didRunSecondTask = false;
@@ -8,6 +8,7 @@
 #include "AsynchronousEventBeat.h"
 
 #include <react/debug/react_native_assert.h>
+#include <react/utils/CoreFeatures.h>
 
 namespace facebook::react {
 
@@ -18,9 +19,18 @@ AsynchronousEventBeat::AsynchronousEventBeat(
       uiRunLoopObserver_(std::move(uiRunLoopObserver)),
       runtimeExecutor_(std::move(runtimeExecutor)) {
   uiRunLoopObserver_->setDelegate(this);
+  if (CoreFeatures::enableArmedEventBeats) {
+    // Beats only happen after events were enqueued.
+    uiRunLoopObserver_->setArmedMode();
+  }
   uiRunLoopObserver_->enable();
 }
 
+void AsynchronousEventBeat::request() const {
+  EventBeat::request();
+  uiRunLoopObserver_->arm();
+}
+
 void AsynchronousEventBeat::activityDidChange(
     const RunLoopObserver::Delegate* delegate,
     RunLoopObserver::Activity /*activity*/) const noexcept {
@@ -29,29 +39,27 @@ void AsynchronousEventBeat::activityDidChange(
 }
 
 void AsynchronousEventBeat::induce() const {
-  if (!isRequested_ || isBeatCallbackScheduled_) {
+  if (!scheduleBeat()) {
     return;
   }
 
-  isRequested_ = false;
-
   // Here we know that `this` object exists because the caller has a strong
   // pointer to `owner`. To ensure the object will exist inside
   // `runtimeExecutor_` callback, we need to copy the  pointer there.
   auto weakOwner = uiRunLoopObserver_->getOwner();
 
-  isBeatCallbackScheduled_ = true;
-
   runtimeExecutor_([this, weakOwner](jsi::Runtime& runtime) {
-    isBeatCallbackScheduled_ = false;
-
     auto owner = weakOwner.lock();
     if (!owner) {
       return;
     }
 
-    if (beatCallback_) {
-      beatCallback_(runtime);
+    beatScheduled(runtime);
+
+    // A beat requested while the callback ran was skipped; an armed observer
+    // has to be armed again for it.
+    if (isRequested()) {
+      uiRunLoopObserver_->arm();
     }
   });
 }
@@ -23,6 +23,7 @@ class AsynchronousEventBeat : public EventBeat,
       RunLoopObserver::Unique uiRunLoopObserver,
       RuntimeExecutor runtimeExecutor);
 
+  void request() const override;
   void induce() const override;
 
 #pragma mark - RunLoopObserver::Delegate
@@ -34,8 +35,6 @@ class AsynchronousEventBeat : public EventBeat,
  private:
   RunLoopObserver::Unique uiRunLoopObserver_;
   RuntimeExecutor runtimeExecutor_;
-
-  mutable std::atomic<bool> isBeatCallbackScheduled_{false};
 };
 
 } // namespace facebook::react
@@ -12,6 +12,7 @@
 
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/componentregistry/ComponentDescriptorRegistry.h>
+#include <react/renderer/components/view/YogaLayoutTemplateCache.h>
 #include <react/renderer/core/EventQueueProcessor.h>
 #include <react/renderer/core/LayoutContext.h>
 #include <react/renderer/debug/SystraceSection.h>
@@ -69,23 +70,39 @@ Scheduler::Scheduler(
   };
 
   auto eventPipeConclusion =
-      [runtimeScheduler = runtimeScheduler.get()](jsi::Runtime& runtime) {
+      [uiManager,
+       runtimeScheduler = runtimeScheduler.get()](jsi::Runtime& runtime) {
+        uiManager->visitBinding(
+            [&](UIManagerBinding const& uiManagerBinding) {
+              uiManagerBinding.flushEventBatch(runtime);
+            },
+            runtime);
         if (runtimeScheduler != nullptr) {
           runtimeScheduler->callExpiredTasks(runtime);
         }
       };
 
-  auto statePipe = [uiManager](const StateUpdate& stateUpdate) {
-    uiManager->updateState(stateUpdate);
+  auto statePipe = [uiManager](const std::vector<StateUpdate>& stateUpdates) {
+    uiManager->updateStates(stateUpdates);
   };
 
+  auto discreteEventExecutor = runtimeScheduler != nullptr
+      ? RuntimeExecutor([runtimeScheduler = runtimeScheduler.get()](
+                            std::function<void(jsi::Runtime & runtime)>&&
+                                callback) {
+          runtimeScheduler->scheduleTask(
+              SchedulerPriority::ImmediatePriority, std::move(callback));
+        })
+      : RuntimeExecutor();
+
   // Creating an `EventDispatcher` instance inside the already allocated
   // container (inside the optional).
   eventDispatcher_->emplace(
       EventQueueProcessor(eventPipe, eventPipeConclusion, statePipe),
       schedulerToolbox.synchronousEventBeatFactory,
       schedulerToolbox.asynchronousEventBeatFactory,
-      eventOwnerBox);
+      eventOwnerBox,
+      discreteEventExecutor);
 
   // Casting to `std::shared_ptr<EventDispatcher const>`.
   auto eventDispatcher =
@@ -127,6 +144,12 @@ Scheduler::Scheduler(
   }
   uiManager_->setAnimationDelegate(animationDelegate);
 
+  memoryPressureCoordinator_ =
+      MemoryPressureCoordinator::fromContextContainer(contextContainer_);
+  if (memoryPressureCoordinator_) {
+    memoryPressureCoordinator_->registerListener(*this);
+  }
+
 #ifdef ANDROID
   removeOutstandingSurfacesOnDestruction_ = true;
 #else
@@ -153,6 +176,10 @@ Scheduler::~Scheduler() {
     uiManager_->unregisterCommitHook(*commitHook);
   }
 
+  if (memoryPressureCoordinator_) {
+    memoryPressureCoordinator_->unregisterListener(*this);
+  }
+
   // All Surfaces must be explicitly stopped before destroying `Scheduler`.
   // The idea is that `UIManager` is allowed to call `Scheduler` only if the
   // corresponding `ShadowTree` instance exists.
@@ -265,6 +292,16 @@ void Scheduler::animationTick() const {
   uiManager_->animationTick();
 }
 
+#pragma mark - MemoryPressureListener
+
+void Scheduler::didReceiveMemoryPressure(MemoryPressureLevel level) {
+  SystraceSection s("Scheduler::didReceiveMemoryPressure");
+
+  // Layout templates only speed up laying out new nodes.
+  YogaLayoutTemplateCache::getInstance().clear();
+  componentDescriptorRegistry_->didReceiveMemoryPressure(level);
+}
+
 #pragma mark - UIManagerDelegate
 
 void Scheduler::uiManagerDidFinishTransaction(
@@ -280,7 +317,11 @@ void Scheduler::uiManagerDidFinishTransaction(
         ? weakRuntimeScheduler.value().lock()
         : nullptr;
     if (runtimeScheduler && !mountSynchronously) {
+      // The delegate pulls all transactions of the surface at once, so a
+      // rendering update replaces the pending one of the surface.
+      auto surfaceId = mountingCoordinator->getSurfaceId();
       runtimeScheduler->scheduleRenderingUpdate(
+          surfaceId,
           [delegate = delegate_,
            mountingCoordinator = std::move(mountingCoordinator)]() {
             delegate->schedulerDidFinishTransaction(mountingCoordinator);
@@ -339,6 +380,16 @@ void Scheduler::reportMount(SurfaceId surfaceId) const {
   uiManager_->reportMount(surfaceId);
 }
 
+void Scheduler::prewarmViews(
+    SurfaceId surfaceId,
+    const std::string& componentName,
+    size_t count) const {
+  if (delegate_ != nullptr) {
+    delegate_->schedulerDidRequestViewPrewarming(
+        surfaceId, componentName, count);
+  }
+}
+
 ContextContainer::Shared Scheduler::getContextContainer() const {
   return contextContainer_;
 }
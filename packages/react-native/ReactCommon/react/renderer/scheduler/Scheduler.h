@@ -27,13 +27,15 @@
 #include <react/renderer/uimanager/UIManagerBinding.h>
 #include <react/renderer/uimanager/UIManagerDelegate.h>
 #include <react/utils/ContextContainer.h>
+#include <react/utils/MemoryPressureCoordinator.h>
 
 namespace facebook::react {
 
 /*
  * Scheduler coordinates Shadow Tree updates and event flows.
  */
-class Scheduler final : public UIManagerDelegate {
+class Scheduler final : public UIManagerDelegate,
+                        public MemoryPressureListener {
  public:
   Scheduler(
       const SchedulerToolbox& schedulerToolbox,
@@ -98,6 +100,10 @@ class Scheduler final : public UIManagerDelegate {
       bool isJSResponder,
       bool blockNativeResponder) override;
 
+#pragma mark - MemoryPressureListener
+
+  void didReceiveMemoryPressure(MemoryPressureLevel level) override;
+
 #pragma mark - ContextContainer
   ContextContainer::Shared getContextContainer() const;
 
@@ -106,6 +112,16 @@ class Scheduler final : public UIManagerDelegate {
 
   void reportMount(SurfaceId surfaceId) const;
 
+  /*
+   * Asks the delegate to keep `count` recycled views of the given component
+   * (e.g. "Paragraph") ready for the surface, so that mounting new nodes of
+   * the component doesn't need to construct their views.
+   */
+  void prewarmViews(
+      SurfaceId surfaceId,
+      const std::string& componentName,
+      size_t count) const;
+
 #pragma mark - Event listeners
   void addEventListener(const std::shared_ptr<const EventListener>& listener);
   void removeEventListener(
@@ -137,6 +153,11 @@ class Scheduler final : public UIManagerDelegate {
    */
   ContextContainer::Shared contextContainer_;
 
+  /*
+   * Registered by the platform in the `ContextContainer`, if at all.
+   */
+  std::shared_ptr<MemoryPressureCoordinator> memoryPressureCoordinator_;
+
   /*
    * Temporary flags.
    */
@@ -52,6 +52,17 @@ class SchedulerDelegate {
       bool isJSResponder,
       bool blockNativeResponder) = 0;
 
+  /*
+   * Called when `count` views of the given component should be created ahead
+   * of time for the surface and kept for recycling, e.g. before scrolling
+   * through a list of such components. Platforms which don't recycle views
+   * can ignore this.
+   */
+  virtual void schedulerDidRequestViewPrewarming(
+      SurfaceId /*surfaceId*/,
+      const std::string& /*componentName*/,
+      size_t /*count*/) {}
+
   virtual ~SchedulerDelegate() noexcept = default;
 };
 
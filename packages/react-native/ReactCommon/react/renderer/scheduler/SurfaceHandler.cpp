@@ -81,6 +81,12 @@ void SurfaceHandler::start() const noexcept {
 
   link_.shadowTree = shadowTree.get();
 
+  if (parameters.displayMode == DisplayMode::Suspended) {
+    // Nothing may be mounted, even if the surface commits before
+    // `applyDisplayMode` is called.
+    shadowTree->setCommitMode(ShadowTree::CommitMode::Suspended);
+  }
+
   link_.uiManager->startSurface(
       std::move(shadowTree),
       parameters.moduleName,
@@ -92,6 +98,15 @@ void SurfaceHandler::start() const noexcept {
   applyDisplayMode(parameters.displayMode);
 }
 
+void SurfaceHandler::prerender(
+    const LayoutConstraints& layoutConstraints,
+    const LayoutContext& layoutContext) const noexcept {
+  SystraceSection s("SurfaceHandler::prerender");
+  setDisplayMode(DisplayMode::Suspended);
+  constraintLayout(layoutConstraints, layoutContext);
+  start();
+}
+
 void SurfaceHandler::stop() const noexcept {
   auto shadowTree = ShadowTree::Unique{};
   {
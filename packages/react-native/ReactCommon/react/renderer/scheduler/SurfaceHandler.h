@@ -94,6 +94,19 @@ class SurfaceHandler {
   void start() const noexcept;
   void stop() const noexcept;
 
+  /*
+   * Starts the surface in `DisplayMode::Suspended` with given layout
+   * constraints and layout context, e.g. a screen which is about to be
+   * presented. The surface is rendered and laid out (also for later calls to
+   * `constraintLayout`) without mounting anything, so that switching the mode
+   * to `DisplayMode::Visible` once the surface is attached only needs to mount
+   * the latest revision.
+   * Can be called from any thread. Has the same requirements as `start()`.
+   */
+  void prerender(
+      const LayoutConstraints& layoutConstraints,
+      const LayoutContext& layoutContext) const noexcept;
+
   /*
    * Sets (and gets) the running mode.
    * The running mode can be changed anytime (even for `Unregistered` surface).
@@ -37,6 +37,28 @@ void SurfaceManager::startSurface(
   });
 }
 
+void SurfaceManager::prerenderSurface(
+    SurfaceId surfaceId,
+    const std::string& moduleName,
+    const folly::dynamic& props,
+    const LayoutConstraints& layoutConstraints,
+    const LayoutContext& layoutContext) const noexcept {
+  {
+    std::unique_lock lock(mutex_);
+    auto surfaceHandler = SurfaceHandler{moduleName, surfaceId};
+    surfaceHandler.setContextContainer(scheduler_.getContextContainer());
+    registry_.emplace(surfaceId, std::move(surfaceHandler));
+  }
+
+  visit(surfaceId, [&](const SurfaceHandler& surfaceHandler) {
+    surfaceHandler.setProps(props);
+
+    scheduler_.registerSurface(surfaceHandler);
+
+    surfaceHandler.prerender(layoutConstraints, layoutContext);
+  });
+}
+
 void SurfaceManager::stopSurface(SurfaceId surfaceId) const noexcept {
   visit(surfaceId, [&](const SurfaceHandler& surfaceHandler) {
     surfaceHandler.stop();
@@ -64,6 +86,14 @@ Size SurfaceManager::measureSurface(
   return size;
 }
 
+void SurfaceManager::setSurfaceDisplayMode(
+    SurfaceId surfaceId,
+    DisplayMode displayMode) const noexcept {
+  visit(surfaceId, [&](const SurfaceHandler& surfaceHandler) {
+    surfaceHandler.setDisplayMode(displayMode);
+  });
+}
+
 MountingCoordinator::Shared SurfaceManager::findMountingCoordinator(
     SurfaceId surfaceId) const noexcept {
   auto mountingCoordinator = MountingCoordinator::Shared{};
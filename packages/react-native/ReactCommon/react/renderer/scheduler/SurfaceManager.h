@@ -37,8 +37,23 @@ class SurfaceManager final {
       const LayoutConstraints& layoutConstraints = {},
       const LayoutContext& layoutContext = {}) const noexcept;
 
+  /*
+   * Starts a surface which is rendered and laid out but not mounted until
+   * its display mode is set to `DisplayMode::Visible`. See
+   * `SurfaceHandler::prerender`.
+   */
+  void prerenderSurface(
+      SurfaceId surfaceId,
+      const std::string& moduleName,
+      const folly::dynamic& props,
+      const LayoutConstraints& layoutConstraints,
+      const LayoutContext& layoutContext = {}) const noexcept;
+
   void stopSurface(SurfaceId surfaceId) const noexcept;
 
+  void setSurfaceDisplayMode(SurfaceId surfaceId, DisplayMode displayMode)
+      const noexcept;
+
   Size measureSurface(
       SurfaceId surfaceId,
       const LayoutConstraints& layoutConstraints,
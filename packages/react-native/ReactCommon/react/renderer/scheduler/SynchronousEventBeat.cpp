@@ -8,6 +8,7 @@
 #include "SynchronousEventBeat.h"
 
 #include <react/debug/react_native_assert.h>
+#include <react/utils/CoreFeatures.h>
 
 #include <utility>
 
@@ -22,9 +23,18 @@ SynchronousEventBeat::SynchronousEventBeat(
       runtimeExecutor_(std::move(runtimeExecutor)),
       runtimeScheduler_(std::move(runtimeScheduler)) {
   uiRunLoopObserver_->setDelegate(this);
+  if (CoreFeatures::enableArmedEventBeats) {
+    // Beats only happen after events were enqueued.
+    uiRunLoopObserver_->setArmedMode();
+  }
   uiRunLoopObserver_->enable();
 }
 
+void SynchronousEventBeat::request() const {
+  EventBeat::request();
+  uiRunLoopObserver_->arm();
+}
+
 void SynchronousEventBeat::activityDidChange(
     const RunLoopObserver::Delegate* delegate,
     RunLoopObserver::Activity /*activity*/) const noexcept {
@@ -33,7 +43,7 @@ void SynchronousEventBeat::activityDidChange(
 }
 
 void SynchronousEventBeat::induce() const {
-  if (!this->isRequested_) {
+  if (!isRequested()) {
     return;
   }
 
@@ -43,7 +53,7 @@ void SynchronousEventBeat::induce() const {
 }
 
 void SynchronousEventBeat::lockExecutorAndBeat() const {
-  if (!this->isRequested_) {
+  if (!isRequested()) {
     return;
   }
 
@@ -26,6 +26,7 @@ class SynchronousEventBeat final : public EventBeat,
       RuntimeExecutor runtimeExecutor,
       std::shared_ptr<RuntimeScheduler> runtimeScheduler);
 
+  void request() const override;
   void induce() const override;
 
 #pragma mark - RunLoopObserver::Delegate
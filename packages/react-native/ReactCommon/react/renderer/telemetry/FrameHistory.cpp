@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "FrameHistory.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace facebook::react {
+
+FrameHistory& FrameHistory::getInstance() {
+  static auto instance = new FrameHistory();
+  return *instance;
+}
+
+void FrameHistory::record(const FrameRecord& frame) {
+  auto frameTime = frame.mountEndTime - frame.commitStartTime;
+
+  JankListener jankListener;
+  std::vector<FrameRecord> frames;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& recordedFrame = frames_[numberOfRecordedFrames_ % kCapacity];
+    recordedFrame = frame;
+    recordedFrame.isDropped = frameTime > kFrameBudget;
+    numberOfRecordedFrames_++;
+
+    if (!jankListener_ || frameTime <= jankThreshold_ ||
+        (lastReportedJankFrameNumber_ != 0 &&
+         numberOfRecordedFrames_ - lastReportedJankFrameNumber_ <
+             kCapacity)) {
+      return;
+    }
+    lastReportedJankFrameNumber_ = numberOfRecordedFrames_;
+    jankListener = jankListener_;
+  }
+
+  // The listener is called without holding the lock, so that it can call
+  // back into the history.
+  jankListener(getFrames());
+}
+
+std::vector<FrameRecord> FrameHistory::getFrames() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto numberOfFrames = std::min(numberOfRecordedFrames_, kCapacity);
+  auto frames = std::vector<FrameRecord>{};
+  frames.reserve(numberOfFrames);
+  for (auto i = numberOfRecordedFrames_ - numberOfFrames;
+       i < numberOfRecordedFrames_;
+       i++) {
+    frames.push_back(frames_[i % kCapacity]);
+  }
+  return frames;
+}
+
+void FrameHistory::setJankListener(
+    JankListener listener,
+    TelemetryDuration threshold) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  jankListener_ = std::move(listener);
+  jankThreshold_ = threshold;
+  lastReportedJankFrameNumber_ = 0;
+}
+
+static int64_t toMicroseconds(TelemetryDuration duration) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(duration)
+      .count();
+}
+
+folly::dynamic FrameHistory::toDynamic(
+    const std::vector<FrameRecord>& frames) {
+  auto result = folly::dynamic::array();
+  for (const auto& frame : frames) {
+    auto record = folly::dynamic::object();
+    record["surfaceId"] = frame.surfaceId;
+    record["commitStartTimeMs"] =
+        telemetryTimePointToMilliseconds(frame.commitStartTime);
+    record["numberOfCommits"] = frame.numberOfCommits;
+    record["numberOfMutations"] = frame.numberOfMutations;
+    record["commitTimeUs"] = toMicroseconds(frame.commitTime);
+    record["diffTimeUs"] = toMicroseconds(frame.diffTime);
+    record["layoutTimeUs"] = toMicroseconds(frame.layoutTime);
+    record["mountTimeUs"] = toMicroseconds(frame.mountTime);
+    record["frameTimeUs"] =
+        toMicroseconds(frame.mountEndTime - frame.commitStartTime);
+    record["isDropped"] = frame.isDropped;
+    result.push_back(std::move(record));
+  }
+  return result;
+}
+
+} // namespace facebook::react
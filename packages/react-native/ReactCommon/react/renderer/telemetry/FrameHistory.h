@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include <folly/dynamic.h>
+#include <react/renderer/core/ReactPrimitives.h>
+#include <react/utils/Telemetry.h>
+
+namespace facebook::react {
+
+/*
+ * Lightweight record of a mounted transaction (which normally corresponds to
+ * a rendered frame of a surface).
+ */
+struct FrameRecord {
+  SurfaceId surfaceId{};
+
+  TelemetryTimePoint commitStartTime{};
+  TelemetryTimePoint mountEndTime{};
+
+  /*
+   * Number of commits the transaction contains; commits which happened
+   * between two mounts are mounted together.
+   */
+  int numberOfCommits{0};
+  int numberOfMutations{0};
+
+  TelemetryDuration commitTime{};
+  TelemetryDuration diffTime{};
+  TelemetryDuration layoutTime{};
+  TelemetryDuration mountTime{};
+
+  /*
+   * Whether it took longer than `FrameHistory::kFrameBudget` from the start
+   * of the commit to the end of the mount.
+   */
+  bool isDropped{false};
+};
+
+/*
+ * Always-on, fixed size history of the most recent frames of all surfaces,
+ * to get post-mortem data about slow frames from production.
+ *
+ * Recording a frame takes constant time and doesn't allocate. The history is
+ * handed to the jank listener when a frame takes longer than the jank
+ * threshold, and can be collected at any time (e.g. by an ANR detector) with
+ * `getFrames`. Thread-safe.
+ */
+class FrameHistory final {
+ public:
+  static constexpr size_t kCapacity = 128;
+  static constexpr TelemetryDuration kFrameBudget =
+      std::chrono::microseconds(16667);
+
+  /*
+   * Called with the frames in the history, oldest first, on the thread the
+   * janky frame was mounted on.
+   */
+  using JankListener = std::function<void(const std::vector<FrameRecord>&)>;
+
+  static FrameHistory& getInstance();
+
+  void record(const FrameRecord& frame);
+
+  /*
+   * Returns the recorded frames, oldest first.
+   */
+  std::vector<FrameRecord> getFrames() const;
+
+  /*
+   * Calls `listener` when a frame takes longer than `threshold` from the
+   * start of the commit to the end of the mount. To not report overlapping
+   * histories, the listener is not called again until the history was
+   * entirely overwritten. Pass an empty listener to remove it.
+   */
+  void setJankListener(JankListener listener, TelemetryDuration threshold);
+
+  static folly::dynamic toDynamic(const std::vector<FrameRecord>& frames);
+
+ private:
+  mutable std::mutex mutex_;
+  std::array<FrameRecord, kCapacity> frames_{};
+  size_t numberOfRecordedFrames_{0};
+
+  JankListener jankListener_;
+  TelemetryDuration jankThreshold_{};
+  size_t lastReportedJankFrameNumber_{0};
+};
+
+} // namespace facebook::react
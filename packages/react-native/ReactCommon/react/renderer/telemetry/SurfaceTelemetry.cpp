@@ -8,21 +8,57 @@
 #include "SurfaceTelemetry.h"
 
 #include <algorithm>
+#include <chrono>
 
 namespace facebook::react {
 
+static int64_t toMicroseconds(TelemetryDuration duration) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(duration)
+      .count();
+}
+
 void SurfaceTelemetry::incorporate(
     const TransactionTelemetry& telemetry,
     int numberOfMutations) {
-  layoutTime_ += telemetry.getLayoutEndTime() - telemetry.getLayoutStartTime();
-  textMeasureTime_ += telemetry.getTextMeasureTime();
-  commitTime_ += telemetry.getCommitEndTime() - telemetry.getCommitStartTime();
-  diffTime_ += telemetry.getDiffEndTime() - telemetry.getDiffStartTime();
-  mountTime_ += telemetry.getMountEndTime() - telemetry.getMountStartTime();
+  auto layoutTime =
+      telemetry.getLayoutEndTime() - telemetry.getLayoutStartTime();
+  auto textMeasureTime = telemetry.getTextMeasureTime();
+  auto commitTime =
+      telemetry.getCommitEndTime() - telemetry.getCommitStartTime();
+  auto diffTime = telemetry.getDiffEndTime() - telemetry.getDiffStartTime();
+  auto mountTime = telemetry.getMountEndTime() - telemetry.getMountStartTime();
+
+  layoutTime_ += layoutTime;
+  textMeasureTime_ += textMeasureTime;
+  commitTime_ += commitTime;
+  diffTime_ += diffTime;
+  mountTime_ += mountTime;
+
+  layoutTimeHistogram_.record(toMicroseconds(layoutTime));
+  textMeasureTimeHistogram_.record(toMicroseconds(textMeasureTime));
+  commitTimeHistogram_.record(toMicroseconds(commitTime));
+  diffTimeHistogram_.record(toMicroseconds(diffTime));
+  mountTimeHistogram_.record(toMicroseconds(mountTime));
+  affectedLayoutNodesCountHistogram_.record(
+      telemetry.getAffectedLayoutNodesCount());
+  numberOfTextMeasurementsHistogram_.record(
+      telemetry.getNumberOfTextMeasurements());
+  for (const auto& [hookName, duration] : telemetry.getCommitHookTimes()) {
+    commitHookTimeHistograms_[hookName].record(toMicroseconds(duration));
+  }
 
   numberOfTransactions_++;
   numberOfMutations_ += numberOfMutations;
   numberOfTextMeasurements_ += telemetry.getNumberOfTextMeasurements();
+  numberOfTextMeasureCacheHits_ += telemetry.getNumberOfTextMeasureCacheHits();
+  numberOfTextMeasureCacheMisses_ +=
+      telemetry.getNumberOfTextMeasureCacheMisses();
+  numberOfLayoutCacheHits_ += telemetry.getNumberOfLayoutCacheHits();
+  numberOfLayoutCacheMisses_ += telemetry.getNumberOfLayoutCacheMisses();
+  // Commits which were not mounted on their own were merged into this
+  // transaction.
+  numberOfCommits_ +=
+      std::max(telemetry.getRevisionNumber() - lastRevisionNumber_, 1);
   lastRevisionNumber_ = telemetry.getRevisionNumber();
 
   while (recentTransactionTelemetries_.size() >=
@@ -33,6 +69,44 @@ void SurfaceTelemetry::incorporate(
   recentTransactionTelemetries_.push_back(telemetry);
 }
 
+void SurfaceTelemetry::incorporateMountHookTime(
+    const char* hookName,
+    TelemetryDuration duration) {
+  mountHookTimeHistograms_[hookName].record(toMicroseconds(duration));
+}
+
+void SurfaceTelemetry::incorporateMutationCounts(
+    const MutationCounts& mutationCounts) {
+  mutationCounts_.creates += mutationCounts.creates;
+  mutationCounts_.deletes += mutationCounts.deletes;
+  mutationCounts_.inserts += mutationCounts.inserts;
+  mutationCounts_.removes += mutationCounts.removes;
+  mutationCounts_.updates += mutationCounts.updates;
+  mutationCounts_.removeDeleteTrees += mutationCounts.removeDeleteTrees;
+}
+
+void SurfaceTelemetry::incorporateCancelledCommit() {
+  numberOfCancelledCommits_++;
+}
+
+void SurfaceTelemetry::incorporateRetriedCommit() {
+  numberOfRetriedCommits_++;
+}
+
+void SurfaceTelemetry::incorporateViews(
+    int numberOfCreatedViews,
+    int numberOfRecycledViews) {
+  numberOfCreatedViews_ += numberOfCreatedViews;
+  numberOfRecycledViews_ += numberOfRecycledViews;
+}
+
+void SurfaceTelemetry::setShadowTreeSize(
+    int numberOfShadowNodes,
+    int64_t retainedBytes) {
+  numberOfShadowNodes_ = numberOfShadowNodes;
+  shadowNodesRetainedBytes_ = retainedBytes;
+}
+
 TelemetryDuration SurfaceTelemetry::getLayoutTime() const {
   return layoutTime_;
 }
@@ -69,6 +143,55 @@ int SurfaceTelemetry::getLastRevisionNumber() const {
   return lastRevisionNumber_;
 }
 
+int SurfaceTelemetry::getNumberOfCommits() const {
+  return numberOfCommits_;
+}
+
+int SurfaceTelemetry::getNumberOfCancelledCommits() const {
+  return numberOfCancelledCommits_;
+}
+
+int SurfaceTelemetry::getNumberOfRetriedCommits() const {
+  return numberOfRetriedCommits_;
+}
+
+const SurfaceTelemetry::MutationCounts& SurfaceTelemetry::getMutationCounts()
+    const {
+  return mutationCounts_;
+}
+
+int SurfaceTelemetry::getNumberOfTextMeasureCacheHits() const {
+  return numberOfTextMeasureCacheHits_;
+}
+
+int SurfaceTelemetry::getNumberOfTextMeasureCacheMisses() const {
+  return numberOfTextMeasureCacheMisses_;
+}
+
+int SurfaceTelemetry::getNumberOfLayoutCacheHits() const {
+  return numberOfLayoutCacheHits_;
+}
+
+int SurfaceTelemetry::getNumberOfLayoutCacheMisses() const {
+  return numberOfLayoutCacheMisses_;
+}
+
+int SurfaceTelemetry::getNumberOfCreatedViews() const {
+  return numberOfCreatedViews_;
+}
+
+int SurfaceTelemetry::getNumberOfRecycledViews() const {
+  return numberOfRecycledViews_;
+}
+
+int SurfaceTelemetry::getNumberOfShadowNodes() const {
+  return numberOfShadowNodes_;
+}
+
+int64_t SurfaceTelemetry::getShadowNodesRetainedBytes() const {
+  return shadowNodesRetainedBytes_;
+}
+
 std::vector<TransactionTelemetry>
 SurfaceTelemetry::getRecentTransactionTelemetries() const {
   auto result = std::vector<TransactionTelemetry>{};
@@ -80,4 +203,128 @@ SurfaceTelemetry::getRecentTransactionTelemetries() const {
   return result;
 }
 
+const TelemetryHistogram& SurfaceTelemetry::getLayoutTimeHistogram() const {
+  return layoutTimeHistogram_;
+}
+
+const TelemetryHistogram& SurfaceTelemetry::getTextMeasureTimeHistogram()
+    const {
+  return textMeasureTimeHistogram_;
+}
+
+const TelemetryHistogram& SurfaceTelemetry::getCommitTimeHistogram() const {
+  return commitTimeHistogram_;
+}
+
+const TelemetryHistogram& SurfaceTelemetry::getDiffTimeHistogram() const {
+  return diffTimeHistogram_;
+}
+
+const TelemetryHistogram& SurfaceTelemetry::getMountTimeHistogram() const {
+  return mountTimeHistogram_;
+}
+
+const TelemetryHistogram&
+SurfaceTelemetry::getAffectedLayoutNodesCountHistogram() const {
+  return affectedLayoutNodesCountHistogram_;
+}
+
+const TelemetryHistogram&
+SurfaceTelemetry::getNumberOfTextMeasurementsHistogram() const {
+  return numberOfTextMeasurementsHistogram_;
+}
+
+const std::unordered_map<std::string, TelemetryHistogram>&
+SurfaceTelemetry::getCommitHookTimeHistograms() const {
+  return commitHookTimeHistograms_;
+}
+
+const std::unordered_map<std::string, TelemetryHistogram>&
+SurfaceTelemetry::getMountHookTimeHistograms() const {
+  return mountHookTimeHistograms_;
+}
+
+static folly::dynamic toDynamic(const TelemetryHistogram& histogram) {
+  auto result = folly::dynamic::object();
+  result["numberOfSamples"] =
+      static_cast<int64_t>(histogram.getNumberOfSamples());
+  result["p50"] = histogram.getPercentile(50);
+  result["p90"] = histogram.getPercentile(90);
+  result["p99"] = histogram.getPercentile(99);
+  return result;
+}
+
+static folly::dynamic toDynamic(
+    const std::unordered_map<std::string, TelemetryHistogram>& histograms) {
+  auto result = folly::dynamic::object();
+  for (const auto& [name, histogram] : histograms) {
+    result[name] = toDynamic(histogram);
+  }
+  return result;
+}
+
+static folly::dynamic toDynamic(
+    const SurfaceTelemetry::MutationCounts& mutationCounts) {
+  auto result = folly::dynamic::object();
+  result["create"] = mutationCounts.creates;
+  result["delete"] = mutationCounts.deletes;
+  result["insert"] = mutationCounts.inserts;
+  result["remove"] = mutationCounts.removes;
+  result["update"] = mutationCounts.updates;
+  result["removeDeleteTree"] = mutationCounts.removeDeleteTrees;
+  return result;
+}
+
+static folly::dynamic toCacheDynamic(int hits, int misses) {
+  auto result = folly::dynamic::object();
+  result["hits"] = hits;
+  result["misses"] = misses;
+  result["hitRate"] = hits + misses > 0
+      ? static_cast<double>(hits) / static_cast<double>(hits + misses)
+      : 0.0;
+  return result;
+}
+
+folly::dynamic toDynamic(const SurfaceTelemetry& surfaceTelemetry) {
+  auto result = folly::dynamic::object();
+  result["numberOfTransactions"] = surfaceTelemetry.getNumberOfTransactions();
+  result["numberOfMutations"] = surfaceTelemetry.getNumberOfMutations();
+  result["numberOfTextMeasurements"] =
+      surfaceTelemetry.getNumberOfTextMeasurements();
+  result["lastRevisionNumber"] = surfaceTelemetry.getLastRevisionNumber();
+  result["numberOfCommits"] = surfaceTelemetry.getNumberOfCommits();
+  result["numberOfCancelledCommits"] =
+      surfaceTelemetry.getNumberOfCancelledCommits();
+  result["numberOfRetriedCommits"] =
+      surfaceTelemetry.getNumberOfRetriedCommits();
+  result["mutations"] = toDynamic(surfaceTelemetry.getMutationCounts());
+  result["textMeasureCache"] = toCacheDynamic(
+      surfaceTelemetry.getNumberOfTextMeasureCacheHits(),
+      surfaceTelemetry.getNumberOfTextMeasureCacheMisses());
+  result["layoutCache"] = toCacheDynamic(
+      surfaceTelemetry.getNumberOfLayoutCacheHits(),
+      surfaceTelemetry.getNumberOfLayoutCacheMisses());
+  result["numberOfCreatedViews"] = surfaceTelemetry.getNumberOfCreatedViews();
+  result["numberOfRecycledViews"] =
+      surfaceTelemetry.getNumberOfRecycledViews();
+  result["numberOfShadowNodes"] = surfaceTelemetry.getNumberOfShadowNodes();
+  result["shadowNodesRetainedBytes"] =
+      surfaceTelemetry.getShadowNodesRetainedBytes();
+  result["layoutTimeUs"] = toDynamic(surfaceTelemetry.getLayoutTimeHistogram());
+  result["textMeasureTimeUs"] =
+      toDynamic(surfaceTelemetry.getTextMeasureTimeHistogram());
+  result["commitTimeUs"] = toDynamic(surfaceTelemetry.getCommitTimeHistogram());
+  result["diffTimeUs"] = toDynamic(surfaceTelemetry.getDiffTimeHistogram());
+  result["mountTimeUs"] = toDynamic(surfaceTelemetry.getMountTimeHistogram());
+  result["affectedLayoutNodesCount"] =
+      toDynamic(surfaceTelemetry.getAffectedLayoutNodesCountHistogram());
+  result["numberOfTextMeasurementsPerTransaction"] =
+      toDynamic(surfaceTelemetry.getNumberOfTextMeasurementsHistogram());
+  result["commitHookTimeUs"] =
+      toDynamic(surfaceTelemetry.getCommitHookTimeHistograms());
+  result["mountHookTimeUs"] =
+      toDynamic(surfaceTelemetry.getMountHookTimeHistograms());
+  return result;
+}
+
 } // namespace facebook::react
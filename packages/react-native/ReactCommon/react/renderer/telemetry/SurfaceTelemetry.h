@@ -7,8 +7,13 @@
 
 #pragma once
 
+#include <cstdint>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
+#include <folly/dynamic.h>
+#include <react/renderer/telemetry/TelemetryHistogram.h>
 #include <react/renderer/telemetry/TransactionTelemetry.h>
 #include <react/utils/Telemetry.h>
 
@@ -22,6 +27,18 @@ class SurfaceTelemetry final {
  public:
   constexpr static size_t kMaxNumberOfRecordedCommitTelemetries = 16;
 
+  /*
+   * Numbers of mounted mutations, by type.
+   */
+  struct MutationCounts {
+    int creates{0};
+    int deletes{0};
+    int inserts{0};
+    int removes{0};
+    int updates{0};
+    int removeDeleteTrees{0};
+  };
+
   /*
    * Metrics
    */
@@ -36,8 +53,66 @@ class SurfaceTelemetry final {
   int getNumberOfTextMeasurements() const;
   int getLastRevisionNumber() const;
 
+  /*
+   * Commits of the surface: all commits which were mounted (including ones
+   * merged into a single transaction), commits which were cancelled, and
+   * attempts to commit which had to be retried because another commit won the
+   * race.
+   */
+  int getNumberOfCommits() const;
+  int getNumberOfCancelledCommits() const;
+  int getNumberOfRetriedCommits() const;
+
+  const MutationCounts& getMutationCounts() const;
+
+  /*
+   * Lookups of text measurements and of Yoga layouts which were served from
+   * (hits) or not found in (misses) their caches.
+   */
+  int getNumberOfTextMeasureCacheHits() const;
+  int getNumberOfTextMeasureCacheMisses() const;
+  int getNumberOfLayoutCacheHits() const;
+  int getNumberOfLayoutCacheMisses() const;
+
+  /*
+   * Views created from scratch or taken from a recycle pool while mounting.
+   * Only reported by platforms which recycle views.
+   */
+  int getNumberOfCreatedViews() const;
+  int getNumberOfRecycledViews() const;
+
+  /*
+   * Number of shadow nodes of the current revision of the surface, and the
+   * approximate memory they retain (without props and state), in bytes.
+   * Only set by `UIManager::getSurfaceTelemetry`, as walking the tree is too
+   * expensive to do on every mount.
+   */
+  int getNumberOfShadowNodes() const;
+  int64_t getShadowNodesRetainedBytes() const;
+
   std::vector<TransactionTelemetry> getRecentTransactionTelemetries() const;
 
+  /*
+   * Distributions of per-transaction metrics over recent transactions.
+   * Durations are recorded in microseconds.
+   */
+  const TelemetryHistogram& getLayoutTimeHistogram() const;
+  const TelemetryHistogram& getTextMeasureTimeHistogram() const;
+  const TelemetryHistogram& getCommitTimeHistogram() const;
+  const TelemetryHistogram& getDiffTimeHistogram() const;
+  const TelemetryHistogram& getMountTimeHistogram() const;
+  const TelemetryHistogram& getAffectedLayoutNodesCountHistogram() const;
+  const TelemetryHistogram& getNumberOfTextMeasurementsHistogram() const;
+
+  /*
+   * Distributions of the time (in microseconds) spent in every commit and
+   * mount hook, keyed by the name of the hook.
+   */
+  const std::unordered_map<std::string, TelemetryHistogram>&
+  getCommitHookTimeHistograms() const;
+  const std::unordered_map<std::string, TelemetryHistogram>&
+  getMountHookTimeHistograms() const;
+
   /*
    * Incorporate data from given transaction telemetry into aggregated data
    * for the Surface.
@@ -46,6 +121,33 @@ class SurfaceTelemetry final {
       const TransactionTelemetry& telemetry,
       int numberOfMutations);
 
+  /*
+   * Incorporate the time spent in the mount hook named `hookName` after a
+   * transaction was mounted.
+   */
+  void incorporateMountHookTime(
+      const char* hookName,
+      TelemetryDuration duration);
+
+  /*
+   * Incorporate the numbers of mutations of a mounted transaction.
+   */
+  void incorporateMutationCounts(const MutationCounts& mutationCounts);
+
+  /*
+   * Incorporate a commit which was cancelled or had to be retried.
+   */
+  void incorporateCancelledCommit();
+  void incorporateRetriedCommit();
+
+  /*
+   * Incorporate the views the platform created or recycled to mount a
+   * transaction.
+   */
+  void incorporateViews(int numberOfCreatedViews, int numberOfRecycledViews);
+
+  void setShadowTreeSize(int numberOfShadowNodes, int64_t retainedBytes);
+
  private:
   TelemetryDuration layoutTime_{};
   TelemetryDuration commitTime_{};
@@ -58,7 +160,38 @@ class SurfaceTelemetry final {
   int numberOfTextMeasurements_{};
   int lastRevisionNumber_{};
 
+  int numberOfCommits_{};
+  int numberOfCancelledCommits_{};
+  int numberOfRetriedCommits_{};
+  MutationCounts mutationCounts_{};
+  int numberOfTextMeasureCacheHits_{};
+  int numberOfTextMeasureCacheMisses_{};
+  int numberOfLayoutCacheHits_{};
+  int numberOfLayoutCacheMisses_{};
+  int numberOfCreatedViews_{};
+  int numberOfRecycledViews_{};
+  int numberOfShadowNodes_{};
+  int64_t shadowNodesRetainedBytes_{};
+
   std::vector<TransactionTelemetry> recentTransactionTelemetries_{};
+
+  TelemetryHistogram layoutTimeHistogram_{};
+  TelemetryHistogram textMeasureTimeHistogram_{};
+  TelemetryHistogram commitTimeHistogram_{};
+  TelemetryHistogram diffTimeHistogram_{};
+  TelemetryHistogram mountTimeHistogram_{};
+  TelemetryHistogram affectedLayoutNodesCountHistogram_{};
+  TelemetryHistogram numberOfTextMeasurementsHistogram_{};
+  std::unordered_map<std::string, TelemetryHistogram>
+      commitHookTimeHistograms_{};
+  std::unordered_map<std::string, TelemetryHistogram>
+      mountHookTimeHistograms_{};
 };
 
+/*
+ * Serializes totals and p50/p90/p99 of the histograms of the telemetry; used
+ * to expose it to JavaScript and to the platforms.
+ */
+folly::dynamic toDynamic(const SurfaceTelemetry& surfaceTelemetry);
+
 } // namespace facebook::react
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TelemetryHistogram.h"
+
+#include <react/debug/react_native_assert.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace facebook::react {
+
+void TelemetryHistogram::record(int64_t value) {
+  if (samples_.size() < kMaxNumberOfSamples) {
+    samples_.push_back(value);
+    return;
+  }
+
+  samples_[nextSampleIndex_] = value;
+  nextSampleIndex_ = (nextSampleIndex_ + 1) % kMaxNumberOfSamples;
+}
+
+int64_t TelemetryHistogram::getPercentile(double percentile) const {
+  react_native_assert(percentile >= 0 && percentile <= 100);
+
+  if (samples_.empty()) {
+    return 0;
+  }
+
+  auto rank = static_cast<size_t>(
+      std::ceil(percentile / 100 * static_cast<double>(samples_.size())));
+  auto index = rank == 0 ? 0 : std::min(rank, samples_.size()) - 1;
+
+  auto sortedSamples = samples_;
+  std::nth_element(
+      sortedSamples.begin(),
+      sortedSamples.begin() + static_cast<std::ptrdiff_t>(index),
+      sortedSamples.end());
+  return sortedSamples[index];
+}
+
+size_t TelemetryHistogram::getNumberOfSamples() const {
+  return samples_.size();
+}
+
+} // namespace facebook::react
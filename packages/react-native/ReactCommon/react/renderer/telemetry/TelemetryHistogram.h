@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Rolling histogram over the most recent samples of a metric.
+ * Keeps at most `kMaxNumberOfSamples` values; older samples are overwritten,
+ * so percentiles describe the recent behavior of a Surface rather than its
+ * whole lifetime.
+ */
+class TelemetryHistogram final {
+ public:
+  constexpr static size_t kMaxNumberOfSamples = 256;
+
+  void record(int64_t value);
+
+  /*
+   * Returns a nearest-rank percentile of recorded samples; `percentile` is
+   * within [0, 100]. Returns `0` if no samples were recorded.
+   */
+  int64_t getPercentile(double percentile) const;
+
+  size_t getNumberOfSamples() const;
+
+ private:
+  std::vector<int64_t> samples_{};
+  size_t nextSampleIndex_{0};
+};
+
+} // namespace facebook::react
@@ -101,6 +101,26 @@ void TransactionTelemetry::didMount() {
   mountEndTime_ = now_();
 }
 
+void TransactionTelemetry::didRunCommitHook(
+    const char* hookName,
+    TelemetryDuration duration) {
+  commitHookTimes_.emplace_back(hookName, duration);
+}
+
+void TransactionTelemetry::didLookUpTextMeasureCache(
+    int numberOfHits,
+    int numberOfMisses) {
+  numberOfTextMeasureCacheHits_ += numberOfHits;
+  numberOfTextMeasureCacheMisses_ += numberOfMisses;
+}
+
+void TransactionTelemetry::didLookUpLayoutCache(
+    int numberOfHits,
+    int numberOfMisses) {
+  numberOfLayoutCacheHits_ += numberOfHits;
+  numberOfLayoutCacheMisses_ += numberOfMisses;
+}
+
 void TransactionTelemetry::setRevisionNumber(int revisionNumber) {
   revisionNumber_ = revisionNumber;
 }
@@ -169,4 +189,25 @@ int TransactionTelemetry::getAffectedLayoutNodesCount() const {
   return affectedLayoutNodesCount_;
 }
 
+int TransactionTelemetry::getNumberOfTextMeasureCacheHits() const {
+  return numberOfTextMeasureCacheHits_;
+}
+
+int TransactionTelemetry::getNumberOfTextMeasureCacheMisses() const {
+  return numberOfTextMeasureCacheMisses_;
+}
+
+int TransactionTelemetry::getNumberOfLayoutCacheHits() const {
+  return numberOfLayoutCacheHits_;
+}
+
+int TransactionTelemetry::getNumberOfLayoutCacheMisses() const {
+  return numberOfLayoutCacheMisses_;
+}
+
+const std::vector<std::pair<const char*, TelemetryDuration>>&
+TransactionTelemetry::getCommitHookTimes() const {
+  return commitHookTimes_;
+}
+
 } // namespace facebook::react
@@ -10,6 +10,8 @@
 #include <chrono>
 #include <cstdint>
 #include <functional>
+#include <utility>
+#include <vector>
 
 #include <react/utils/Telemetry.h>
 
@@ -47,6 +49,19 @@ class TransactionTelemetry final {
   void willMount();
   void didMount();
 
+  /*
+   * Records how long the commit hook named `hookName` took to run for this
+   * transaction. `hookName` must outlive the telemetry.
+   */
+  void didRunCommitHook(const char* hookName, TelemetryDuration duration);
+
+  /*
+   * Records lookups of text measurements and of Yoga layouts which were
+   * served from (hits) or not found in (misses) their caches.
+   */
+  void didLookUpTextMeasureCache(int numberOfHits, int numberOfMisses);
+  void didLookUpLayoutCache(int numberOfHits, int numberOfMisses);
+
   void setRevisionNumber(int revisionNumber);
 
   /*
@@ -67,6 +82,14 @@ class TransactionTelemetry final {
 
   int getAffectedLayoutNodesCount() const;
 
+  int getNumberOfTextMeasureCacheHits() const;
+  int getNumberOfTextMeasureCacheMisses() const;
+  int getNumberOfLayoutCacheHits() const;
+  int getNumberOfLayoutCacheMisses() const;
+
+  const std::vector<std::pair<const char*, TelemetryDuration>>&
+  getCommitHookTimes() const;
+
  private:
   TelemetryTimePoint diffStartTime_{kTelemetryUndefinedTimePoint};
   TelemetryTimePoint diffEndTime_{kTelemetryUndefinedTimePoint};
@@ -85,6 +108,13 @@ class TransactionTelemetry final {
   std::function<TelemetryTimePoint()> now_;
 
   int affectedLayoutNodesCount_{0};
+
+  int numberOfTextMeasureCacheHits_{0};
+  int numberOfTextMeasureCacheMisses_{0};
+  int numberOfLayoutCacheHits_{0};
+  int numberOfLayoutCacheMisses_{0};
+
+  std::vector<std::pair<const char*, TelemetryDuration>> commitHookTimes_{};
 };
 
 } // namespace facebook::react
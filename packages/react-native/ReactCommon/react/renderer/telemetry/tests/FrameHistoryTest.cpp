@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/telemetry/FrameHistory.h>
+
+#include <vector>
+
+using namespace facebook::react;
+
+static FrameRecord makeFrame(int numberOfMutations, int frameTimeMs) {
+  auto frame = FrameRecord{};
+  frame.numberOfMutations = numberOfMutations;
+  frame.mountEndTime =
+      frame.commitStartTime + std::chrono::milliseconds(frameTimeMs);
+  return frame;
+}
+
+TEST(FrameHistoryTest, keepsMostRecentFrames) {
+  auto history = FrameHistory{};
+  EXPECT_TRUE(history.getFrames().empty());
+
+  auto numberOfFrames = static_cast<int>(FrameHistory::kCapacity) + 3;
+  for (int i = 0; i < numberOfFrames; i++) {
+    history.record(makeFrame(i, i % 2 ? 20 : 10));
+  }
+
+  auto frames = history.getFrames();
+  ASSERT_EQ(frames.size(), FrameHistory::kCapacity);
+  EXPECT_EQ(frames.front().numberOfMutations, 3);
+  EXPECT_EQ(frames.back().numberOfMutations, numberOfFrames - 1);
+  EXPECT_TRUE(frames.front().isDropped);
+  EXPECT_FALSE(frames[1].isDropped);
+}
+
+TEST(FrameHistoryTest, reportsJankOncePerHistory) {
+  auto history = FrameHistory{};
+  auto reports = std::vector<std::vector<FrameRecord>>{};
+  history.setJankListener(
+      [&](const std::vector<FrameRecord>& frames) {
+        reports.push_back(frames);
+      },
+      std::chrono::milliseconds(100));
+
+  history.record(makeFrame(0, 10));
+  history.record(makeFrame(1, 20));
+  EXPECT_TRUE(reports.empty());
+
+  history.record(makeFrame(2, 200));
+  ASSERT_EQ(reports.size(), 1);
+  ASSERT_EQ(reports[0].size(), 3);
+  EXPECT_EQ(reports[0].back().numberOfMutations, 2);
+
+  // Janky frames which are still in the reported history are not reported.
+  for (size_t i = 1; i < FrameHistory::kCapacity; i++) {
+    history.record(makeFrame(0, 200));
+  }
+  EXPECT_EQ(reports.size(), 1);
+
+  history.record(makeFrame(0, 200));
+  EXPECT_EQ(reports.size(), 2);
+  EXPECT_EQ(reports[1].size(), FrameHistory::kCapacity);
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/telemetry/TelemetryHistogram.h>
+
+using namespace facebook::react;
+
+TEST(TelemetryHistogramTest, emptyHistogram) {
+  auto histogram = TelemetryHistogram{};
+
+  EXPECT_EQ(histogram.getNumberOfSamples(), 0);
+  EXPECT_EQ(histogram.getPercentile(50), 0);
+}
+
+TEST(TelemetryHistogramTest, percentiles) {
+  auto histogram = TelemetryHistogram{};
+
+  // Recording 100..1 so the histogram does not rely on the order of samples.
+  for (int64_t value = 100; value > 0; value--) {
+    histogram.record(value);
+  }
+
+  EXPECT_EQ(histogram.getNumberOfSamples(), 100);
+  EXPECT_EQ(histogram.getPercentile(0), 1);
+  EXPECT_EQ(histogram.getPercentile(50), 50);
+  EXPECT_EQ(histogram.getPercentile(90), 90);
+  EXPECT_EQ(histogram.getPercentile(99), 99);
+  EXPECT_EQ(histogram.getPercentile(100), 100);
+}
+
+TEST(TelemetryHistogramTest, keepsOnlyRecentSamples) {
+  auto histogram = TelemetryHistogram{};
+
+  for (size_t index = 0; index < TelemetryHistogram::kMaxNumberOfSamples;
+       index++) {
+    histogram.record(1000);
+  }
+  for (size_t index = 0; index < TelemetryHistogram::kMaxNumberOfSamples;
+       index++) {
+    histogram.record(1);
+  }
+
+  EXPECT_EQ(
+      histogram.getNumberOfSamples(), TelemetryHistogram::kMaxNumberOfSamples);
+  EXPECT_EQ(histogram.getPercentile(100), 1);
+}
@@ -10,6 +10,7 @@
 
 #include <gtest/gtest.h>
 
+#include <react/renderer/telemetry/SurfaceTelemetry.h>
 #include <react/renderer/telemetry/TransactionTelemetry.h>
 #include <react/test_utils/MockClock.h>
 #include <react/utils/Telemetry.h>
@@ -133,6 +134,88 @@ TEST(TransactionTelemetryTest, defaultImplementation) {
   EXPECT_GE(mountDuration, 100);
 }
 
+TEST(TransactionTelemetryTest, commitHookTimes) {
+  auto telemetry = TransactionTelemetry{[]() { return MockClock::now(); }};
+
+  telemetry.willDiff();
+  telemetry.didDiff();
+  telemetry.willCommit();
+  telemetry.didRunCommitHook("HookA", std::chrono::microseconds(300));
+  telemetry.didRunCommitHook("HookB", std::chrono::microseconds(100));
+  telemetry.willLayout();
+  telemetry.didLayout();
+  telemetry.didCommit();
+  telemetry.willMount();
+  telemetry.didMount();
+
+  ASSERT_EQ(telemetry.getCommitHookTimes().size(), 2);
+  EXPECT_STREQ(telemetry.getCommitHookTimes()[0].first, "HookA");
+  EXPECT_EQ(
+      telemetry.getCommitHookTimes()[0].second,
+      std::chrono::microseconds(300));
+
+  auto surfaceTelemetry = SurfaceTelemetry{};
+  surfaceTelemetry.incorporate(telemetry, 0);
+  surfaceTelemetry.incorporateMountHookTime(
+      "MountHook", std::chrono::microseconds(50));
+
+  const auto& commitHookTimes =
+      surfaceTelemetry.getCommitHookTimeHistograms();
+  ASSERT_EQ(commitHookTimes.size(), 2);
+  EXPECT_EQ(commitHookTimes.at("HookA").getNumberOfSamples(), 1);
+  EXPECT_EQ(commitHookTimes.at("HookB").getPercentile(50), 100);
+
+  const auto& mountHookTimes = surfaceTelemetry.getMountHookTimeHistograms();
+  ASSERT_EQ(mountHookTimes.size(), 1);
+  EXPECT_EQ(mountHookTimes.at("MountHook").getPercentile(50), 50);
+}
+
+TEST(TransactionTelemetryTest, surfaceCounters) {
+  auto makeTelemetry = [](int revisionNumber) {
+    auto telemetry = TransactionTelemetry{[]() { return MockClock::now(); }};
+    telemetry.willDiff();
+    telemetry.didDiff();
+    telemetry.willCommit();
+    telemetry.willLayout();
+    telemetry.didLookUpTextMeasureCache(3, 1);
+    telemetry.didLookUpLayoutCache(8, 2);
+    telemetry.didLayout();
+    telemetry.didCommit();
+    telemetry.setRevisionNumber(revisionNumber);
+    telemetry.willMount();
+    telemetry.didMount();
+    return telemetry;
+  };
+
+  auto surfaceTelemetry = SurfaceTelemetry{};
+  surfaceTelemetry.incorporate(makeTelemetry(1), 2);
+  // Revisions 2 and 3 were mounted in a single transaction.
+  surfaceTelemetry.incorporate(makeTelemetry(3), 1);
+  auto mutationCounts = SurfaceTelemetry::MutationCounts{};
+  mutationCounts.creates = 1;
+  mutationCounts.inserts = 1;
+  mutationCounts.updates = 1;
+  surfaceTelemetry.incorporateMutationCounts(mutationCounts);
+  surfaceTelemetry.incorporateCancelledCommit();
+  surfaceTelemetry.incorporateRetriedCommit();
+  surfaceTelemetry.incorporateRetriedCommit();
+  surfaceTelemetry.incorporateViews(1, 4);
+
+  EXPECT_EQ(surfaceTelemetry.getNumberOfTransactions(), 2);
+  EXPECT_EQ(surfaceTelemetry.getNumberOfCommits(), 3);
+  EXPECT_EQ(surfaceTelemetry.getNumberOfCancelledCommits(), 1);
+  EXPECT_EQ(surfaceTelemetry.getNumberOfRetriedCommits(), 2);
+  EXPECT_EQ(surfaceTelemetry.getMutationCounts().creates, 1);
+  EXPECT_EQ(surfaceTelemetry.getMutationCounts().updates, 1);
+  EXPECT_EQ(surfaceTelemetry.getMutationCounts().deletes, 0);
+  EXPECT_EQ(surfaceTelemetry.getNumberOfTextMeasureCacheHits(), 6);
+  EXPECT_EQ(surfaceTelemetry.getNumberOfTextMeasureCacheMisses(), 2);
+  EXPECT_EQ(surfaceTelemetry.getNumberOfLayoutCacheHits(), 16);
+  EXPECT_EQ(surfaceTelemetry.getNumberOfLayoutCacheMisses(), 4);
+  EXPECT_EQ(surfaceTelemetry.getNumberOfCreatedViews(), 1);
+  EXPECT_EQ(surfaceTelemetry.getNumberOfRecycledViews(), 4);
+}
+
 TEST(TransactionTelemetryTest, abnormalUseCases) {
   // Calling `did` before `will` should crash.
   EXPECT_DEATH_IF_SUPPORTED(
@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "PersistentTextMeasureCache.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <glog/logging.h>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr uint32_t kMagic = 0x4d54'4e52; // "RNTM"
+constexpr uint32_t kVersion = 1;
+
+struct Header {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t configurationHash;
+  uint64_t entryCount;
+  uint64_t reserved;
+};
+
+/*
+ * 64-bit FNV-1a, which unlike std::hash gives the same hashes on every launch
+ * of the app.
+ */
+class StableHasher {
+ public:
+  void add(std::string_view bytes) {
+    for (auto byte : bytes) {
+      hash_ ^= static_cast<uint8_t>(byte);
+      hash_ *= 1099511628211ull;
+    }
+    // Separating consecutive strings, so that e.g. "ab", "c" and "a", "bc"
+    // hash differently.
+    addInteger(bytes.size());
+  }
+
+  void addInteger(int64_t value) {
+    add64(static_cast<uint64_t>(value));
+  }
+
+  void addFloat(double value) {
+    if (std::isnan(value)) {
+      // All NaNs represent undefined values.
+      add64(0x7ff8'0000'0000'0000ull);
+    } else {
+      uint64_t bits;
+      value += 0.0; // -0 and 0 are equivalent.
+      std::memcpy(&bits, &value, sizeof(bits));
+      add64(bits);
+    }
+  }
+
+  template <typename T>
+  void addOptional(const std::optional<T>& value) {
+    addInteger(value.has_value() ? 1 : 0);
+    if (value.has_value()) {
+      addInteger(static_cast<int64_t>(*value));
+    }
+  }
+
+  uint64_t hash() const {
+    return hash_;
+  }
+
+ private:
+  void add64(uint64_t value) {
+    for (auto i = 0; i < 8; i++) {
+      hash_ ^= (value >> (i * 8)) & 0xff;
+      hash_ *= 1099511628211ull;
+    }
+  }
+
+  uint64_t hash_{14695981039346656037ull};
+};
+
+uint64_t stableHash(std::string_view string) {
+  auto hasher = StableHasher{};
+  hasher.add(string);
+  return hasher.hash();
+}
+
+} // namespace
+
+PersistentTextMeasureCache::PersistentTextMeasureCache(
+    std::string path,
+    std::string configuration)
+    : path_(std::move(path)),
+      configurationHash_(stableHash(configuration)),
+      isWriting_(std::make_shared<std::atomic<bool>>(false)) {
+  map();
+}
+
+PersistentTextMeasureCache::~PersistentTextMeasureCache() {
+  write();
+  unmap();
+}
+
+std::shared_ptr<PersistentTextMeasureCache>
+PersistentTextMeasureCache::fromContextContainer(
+    const ContextContainer::Shared& contextContainer) {
+  if (!contextContainer) {
+    return nullptr;
+  }
+  static const auto key =
+      ContextContainer::Key<std::shared_ptr<PersistentTextMeasureCache>>(
+          kContextContainerKey);
+  return contextContainer->find(key).value_or(nullptr);
+}
+
+std::optional<uint64_t> PersistentTextMeasureCache::persistentKey(
+    const TextMeasureCacheKey& key) {
+  // Taking into account the same values as the equivalence of
+  // `TextMeasureCacheKey`.
+  auto hasher = StableHasher{};
+  for (const auto& fragment : key.attributedString.getFragments()) {
+    if (fragment.isAttachment()) {
+      return std::nullopt;
+    }
+
+    const auto& textAttributes = fragment.textAttributes;
+    hasher.add(fragment.string);
+    hasher.add(textAttributes.fontFamily);
+    hasher.addFloat(textAttributes.fontSize);
+    hasher.addFloat(textAttributes.fontSizeMultiplier);
+    hasher.addOptional(textAttributes.fontWeight);
+    hasher.addOptional(textAttributes.fontStyle);
+    hasher.addOptional(textAttributes.fontVariant);
+    hasher.addOptional(textAttributes.allowFontScaling);
+    hasher.addOptional(textAttributes.dynamicTypeRamp);
+    hasher.addFloat(textAttributes.letterSpacing);
+    hasher.addFloat(textAttributes.lineHeight);
+    hasher.addOptional(textAttributes.alignment);
+  }
+
+  const auto& paragraphAttributes = key.paragraphAttributes;
+  hasher.addInteger(paragraphAttributes.maximumNumberOfLines);
+  hasher.addInteger(static_cast<int64_t>(paragraphAttributes.ellipsizeMode));
+  hasher.addInteger(
+      static_cast<int64_t>(paragraphAttributes.textBreakStrategy));
+  hasher.addInteger(paragraphAttributes.adjustsFontSizeToFit ? 1 : 0);
+  hasher.addInteger(paragraphAttributes.includeFontPadding ? 1 : 0);
+  hasher.addInteger(
+      static_cast<int64_t>(paragraphAttributes.android_hyphenationFrequency));
+  hasher.addFloat(paragraphAttributes.minimumFontSize);
+  hasher.addFloat(paragraphAttributes.maximumFontSize);
+  hasher.addFloat(key.layoutConstraints.maximumSize.width);
+  return hasher.hash();
+}
+
+std::optional<TextMeasurement> PersistentTextMeasureCache::get(
+    const TextMeasureCacheKey& key) const {
+  auto persistentKey = PersistentTextMeasureCache::persistentKey(key);
+  if (!persistentKey) {
+    return std::nullopt;
+  }
+
+  auto size = std::optional<Size>{};
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iterator = addedEntryIndices_.find(*persistentKey);
+    if (iterator != addedEntryIndices_.end()) {
+      const auto& entry = addedEntries_[iterator->second];
+      size = Size{
+          static_cast<Float>(entry.width), static_cast<Float>(entry.height)};
+    }
+  }
+
+  if (!size) {
+    // The mapped entries are never mutated.
+    if (auto entry = findMappedEntry(*persistentKey)) {
+      size = Size{
+          static_cast<Float>(entry->width), static_cast<Float>(entry->height)};
+    }
+  }
+
+  if (!size) {
+    return std::nullopt;
+  }
+
+  auto measurement = TextMeasurement{};
+  measurement.size = *size;
+  return measurement;
+}
+
+void PersistentTextMeasureCache::set(
+    const TextMeasureCacheKey& key,
+    const TextMeasurement& measurement) {
+  auto persistentKey = PersistentTextMeasureCache::persistentKey(key);
+  if (!persistentKey) {
+    return;
+  }
+
+  auto entry = Entry{
+      *persistentKey,
+      static_cast<double>(measurement.size.width),
+      static_cast<double>(measurement.size.height)};
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iterator = addedEntryIndices_.find(entry.key);
+    if (iterator != addedEntryIndices_.end()) {
+      addedEntries_[iterator->second] = entry;
+    } else if (addedEntries_.size() < kMaxSize) {
+      addedEntryIndices_.emplace(entry.key, addedEntries_.size());
+      addedEntries_.push_back(entry);
+    } else {
+      return;
+    }
+
+    if (++unwrittenEntryCount_ < kWriteThreshold) {
+      return;
+    }
+  }
+
+  write();
+}
+
+void PersistentTextMeasureCache::write() {
+  if (isWriting_->exchange(true)) {
+    // The entries will be part of the next write.
+    return;
+  }
+
+  // Newest entries first: added ones, newest first, then the mapped ones
+  // which were not added again.
+  auto entries = std::vector<Entry>{};
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (unwrittenEntryCount_ == 0) {
+      isWriting_->store(false);
+      return;
+    }
+    unwrittenEntryCount_ = 0;
+    entries.assign(addedEntries_.rbegin(), addedEntries_.rend());
+  }
+
+  auto keys = std::unordered_set<uint64_t>{};
+  for (const auto& entry : entries) {
+    keys.insert(entry.key);
+  }
+  for (size_t i = 0; i < mappedEntryCount_ && entries.size() < kMaxSize; i++) {
+    if (keys.find(mappedEntries_[i].key) == keys.end()) {
+      entries.push_back(mappedEntries_[i]);
+    }
+  }
+  entries.resize(std::min(entries.size(), kMaxSize));
+  std::sort(
+      entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.key < rhs.key;
+      });
+
+  // Writing to a temporary file which replaces the cache once complete, so
+  // the cache is never seen partially written and the mapping of the previous
+  // file stays valid. Caches of other instances of React Native may write to
+  // the same file concurrently.
+  static auto writeCount = std::atomic<uint64_t>{0};
+  auto temporaryPath = path_ + ".tmp-" + std::to_string(getpid()) + "-" +
+      std::to_string(writeCount++);
+  std::thread(
+      [path = path_,
+       temporaryPath = std::move(temporaryPath),
+       configurationHash = configurationHash_,
+       entries = std::move(entries),
+       isWriting = isWriting_]() {
+        auto file = std::fopen(temporaryPath.c_str(), "wb");
+        auto header =
+            Header{kMagic, kVersion, configurationHash, entries.size(), 0};
+        auto succeeded = file != nullptr &&
+            std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+            std::fwrite(
+                entries.data(), sizeof(Entry), entries.size(), file) ==
+                entries.size();
+        if (file != nullptr) {
+          succeeded = std::fclose(file) == 0 && succeeded;
+        }
+        if (succeeded) {
+          succeeded = std::rename(temporaryPath.c_str(), path.c_str()) == 0;
+        }
+        if (!succeeded) {
+          LOG(WARNING) << "Failed to write text measurements to " << path;
+          std::remove(temporaryPath.c_str());
+        }
+        isWriting->store(false);
+      })
+      .detach();
+}
+
+void PersistentTextMeasureCache::map() {
+  auto fd = open(path_.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return;
+  }
+
+  struct stat fileStat {};
+  if (fstat(fd, &fileStat) != 0 ||
+      static_cast<size_t>(fileStat.st_size) < sizeof(Header)) {
+    close(fd);
+    return;
+  }
+
+  auto size = static_cast<size_t>(fileStat.st_size);
+  auto mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    return;
+  }
+
+  auto header = static_cast<const Header*>(mapping);
+  if (header->magic != kMagic || header->version != kVersion ||
+      header->configurationHash != configurationHash_ ||
+      header->entryCount > kMaxSize ||
+      size != sizeof(Header) + header->entryCount * sizeof(Entry)) {
+    // Written by another version, for another configuration, or corrupted.
+    munmap(mapping, size);
+    return;
+  }
+
+  mapping_ = mapping;
+  mappingSize_ = size;
+  mappedEntries_ = reinterpret_cast<const Entry*>(
+      static_cast<const uint8_t*>(mapping) + sizeof(Header));
+  mappedEntryCount_ = static_cast<size_t>(header->entryCount);
+}
+
+void PersistentTextMeasureCache::unmap() {
+  if (mapping_ != nullptr) {
+    munmap(const_cast<void*>(mapping_), mappingSize_);
+    mapping_ = nullptr;
+  }
+}
+
+const PersistentTextMeasureCache::Entry*
+PersistentTextMeasureCache::findMappedEntry(uint64_t key) const {
+  auto end = mappedEntries_ + mappedEntryCount_;
+  auto iterator = std::lower_bound(
+      mappedEntries_, end, key, [](const Entry& entry, uint64_t value) {
+        return entry.key < value;
+      });
+  return iterator != end && iterator->key == key ? iterator : nullptr;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <react/renderer/textlayoutmanager/TextMeasureCache.h>
+#include <react/utils/ContextContainer.h>
+
+namespace facebook::react {
+
+/*
+ * Persistent tier under `TextMeasureCache`, which keeps the sizes of measured
+ * text across launches of the app, so text measured on every launch (e.g. on
+ * the first screen) does not have to go through the platform text stack.
+ *
+ * Entries are keyed by a hash of the layout-wise content of the attributed
+ * string, the paragraph attributes and the available width, which is stable
+ * across launches. The file holding them is memory-mapped when the cache is
+ * created, and entries added since then are written to it asynchronously,
+ * once enough of them accumulated.
+ *
+ * The file is discarded when it was written for a different `configuration`,
+ * which must describe everything else affecting text layout: e.g. the locale,
+ * the font scale, and the versions of the app and of the OS (which ship the
+ * fonts). Strings with attachments are not cached, as their size depends on
+ * the layout of the attachments.
+ *
+ * Can be called from any thread.
+ */
+class PersistentTextMeasureCache final {
+ public:
+  /*
+   * Maximum number of entries written to the file, keeping the most recently
+   * added ones.
+   */
+  static constexpr size_t kMaxSize = 4096;
+
+  /*
+   * Number of added entries after which they are written to the file. They
+   * are also written when the cache is destroyed.
+   */
+  static constexpr size_t kWriteThreshold = 16;
+
+  /*
+   * Key under which platforms register the cache in the `ContextContainer`,
+   * to be used by their `TextLayoutManager`.
+   */
+  static constexpr auto kContextContainerKey = "PersistentTextMeasureCache";
+
+  /*
+   * Returns the cache registered in `contextContainer`, if any.
+   */
+  static std::shared_ptr<PersistentTextMeasureCache> fromContextContainer(
+      const ContextContainer::Shared& contextContainer);
+
+  PersistentTextMeasureCache(std::string path, std::string configuration);
+  ~PersistentTextMeasureCache();
+
+  PersistentTextMeasureCache(const PersistentTextMeasureCache&) = delete;
+  PersistentTextMeasureCache& operator=(const PersistentTextMeasureCache&) =
+      delete;
+
+  /*
+   * Returns the measurement of a given key, if it was persisted.
+   */
+  std::optional<TextMeasurement> get(const TextMeasureCacheKey& key) const;
+
+  /*
+   * Adds the measurement of a given key, to be persisted.
+   */
+  void set(const TextMeasureCacheKey& key, const TextMeasurement& measurement);
+
+  /*
+   * Writes entries which were added since the last write to the file,
+   * asynchronously, unless a write is already in progress.
+   */
+  void write();
+
+  /*
+   * Returns the stable key of a given key, or nothing if its measurement
+   * cannot be persisted.
+   */
+  static std::optional<uint64_t> persistentKey(const TextMeasureCacheKey& key);
+
+ private:
+  struct Entry {
+    uint64_t key;
+    double width;
+    double height;
+  };
+
+  void map();
+  void unmap();
+  const Entry* findMappedEntry(uint64_t key) const;
+
+  const std::string path_;
+  const uint64_t configurationHash_;
+
+  // Memory-mapped entries of the file, sorted by key.
+  const void* mapping_{nullptr};
+  size_t mappingSize_{0};
+  const Entry* mappedEntries_{nullptr};
+  size_t mappedEntryCount_{0};
+
+  mutable std::mutex mutex_;
+  // Entries added since the cache was created, with the order they were
+  // added in, oldest first.
+  std::unordered_map<uint64_t, size_t> addedEntryIndices_;
+  std::vector<Entry> addedEntries_;
+  size_t unwrittenEntryCount_{0};
+  std::shared_ptr<std::atomic<bool>> isWriting_;
+};
+
+} // namespace facebook::react
@@ -7,6 +7,7 @@
 
 #include "TextMeasureCache.h"
 
+#include <mutex>
 #include <utility>
 
 namespace facebook::react {
@@ -65,4 +66,17 @@ bool LineMeasurement::operator==(const LineMeasurement& rhs) const {
              rhs.xHeight);
 }
 
+std::shared_ptr<TextMeasureCache> getProcessWideTextMeasureCache(size_t size) {
+  static std::mutex mutex;
+  static std::weak_ptr<TextMeasureCache> weakCache;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto cache = weakCache.lock();
+  if (!cache) {
+    cache = std::make_shared<TextMeasureCache>(size);
+    weakCache = cache;
+  }
+  return cache;
+}
+
 } // namespace facebook::react
@@ -11,9 +11,11 @@
 #include <react/renderer/attributedstring/ParagraphAttributes.h>
 #include <react/renderer/core/LayoutConstraints.h>
 #include <react/utils/FloatComparison.h>
-#include <react/utils/SimpleThreadSafeCache.h>
+#include <react/utils/ShardedThreadSafeCache.h>
 #include <react/utils/hash_combine.h>
 
+#include <memory>
+
 namespace facebook::react {
 
 struct LineMeasurement {
@@ -75,13 +77,22 @@ constexpr auto kSimpleThreadSafeCacheSizeCap = size_t{1024};
 
 /*
  * Thread-safe, evicting hash table designed to store text measurement
- * information.
+ * information. Sharded, since text is measured concurrently by every thread
+ * laying out a surface.
  */
-using TextMeasureCache = SimpleThreadSafeCache<
+using TextMeasureCache = ShardedThreadSafeCache<
     TextMeasureCacheKey,
     TextMeasurement,
     kSimpleThreadSafeCacheSizeCap>;
 
+/*
+ * Returns the cache of text measurements shared by all its users in the
+ * process, creating it with `size` entries if it has no users at the moment.
+ * Measurements don't depend on the React instance which requested them, so
+ * instances can share them.
+ */
+std::shared_ptr<TextMeasureCache> getProcessWideTextMeasureCache(size_t size);
+
 inline bool areTextAttributesEquivalentLayoutWise(
     const TextAttributes& lhs,
     const TextAttributes& rhs) {
@@ -110,30 +121,13 @@ inline bool areTextAttributesEquivalentLayoutWise(
       floatEquality(lhs.lineHeight, rhs.lineHeight);
 }
 
-inline size_t textAttributesHashLayoutWise(
-    const TextAttributes& textAttributes) {
-  // Taking into account the same props as
-  // `areTextAttributesEquivalentLayoutWise` mentions.
-  return facebook::react::hash_combine(
-      textAttributes.fontFamily,
-      textAttributes.fontSize,
-      textAttributes.fontSizeMultiplier,
-      textAttributes.fontWeight,
-      textAttributes.fontStyle,
-      textAttributes.fontVariant,
-      textAttributes.allowFontScaling,
-      textAttributes.dynamicTypeRamp,
-      textAttributes.letterSpacing,
-      textAttributes.lineHeight,
-      textAttributes.alignment);
-}
-
 inline bool areAttributedStringFragmentsEquivalentLayoutWise(
     const AttributedString::Fragment& lhs,
     const AttributedString::Fragment& rhs) {
   return lhs.string == rhs.string &&
-      areTextAttributesEquivalentLayoutWise(
-             lhs.textAttributes, rhs.textAttributes) &&
+      (lhs.hasIdenticalTextAttributes(rhs) ||
+       areTextAttributesEquivalentLayoutWise(
+           lhs.textAttributes, rhs.textAttributes)) &&
       // LayoutMetrics of an attachment fragment affects the size of a measured
       // attributed string.
       (!lhs.isAttachment() ||
@@ -141,18 +135,18 @@ inline bool areAttributedStringFragmentsEquivalentLayoutWise(
         rhs.parentShadowView.layoutMetrics));
 }
 
-inline size_t attributedStringFragmentHashLayoutWise(
-    const AttributedString::Fragment& fragment) {
-  // Here we are not taking `isAttachment` and `layoutMetrics` into account
-  // because they are logically interdependent and this can break an invariant
-  // between hash and equivalence functions (and cause cache misses).
-  return facebook::react::hash_combine(
-      fragment.string, textAttributesHashLayoutWise(fragment.textAttributes));
-}
-
 inline bool areAttributedStringsEquivalentLayoutWise(
     const AttributedString& lhs,
     const AttributedString& rhs) {
+  // Copies of a string share their fragments, and strings with different
+  // layout-wise hashes cannot be equivalent.
+  if (&lhs.getFragments() == &rhs.getFragments()) {
+    return true;
+  }
+  if (lhs.getLayoutWiseHash() != rhs.getLayoutWiseHash()) {
+    return false;
+  }
+
   auto& lhsFragment = lhs.getFragments();
   auto& rhsFragment = rhs.getFragments();
 
@@ -173,14 +167,7 @@ inline bool areAttributedStringsEquivalentLayoutWise(
 
 inline size_t attributedStringHashLayoutWise(
     const AttributedString& attributedString) {
-  auto seed = size_t{0};
-
-  for (const auto& fragment : attributedString.getFragments()) {
-    facebook::react::hash_combine(
-        seed, attributedStringFragmentHashLayoutWise(fragment));
-  }
-
-  return seed;
+  return attributedString.getLayoutWiseHash();
 }
 
 inline bool operator==(
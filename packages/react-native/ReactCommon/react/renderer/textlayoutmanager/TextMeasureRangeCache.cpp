@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TextMeasureRangeCache.h"
+
+#include <cmath>
+#include <utility>
+
+namespace facebook::react {
+
+std::optional<TextMeasurement> TextMeasureRangeCache::get(
+    const TextMeasureCacheKey& key) const {
+  auto ranges = cache_.get(widthIndependentKey(key));
+  if (!ranges) {
+    return std::nullopt;
+  }
+
+  auto width = key.layoutConstraints.maximumSize.width;
+  for (const auto& range : *ranges) {
+    if (width >= range.minimumWidth && width <= range.maximumWidth) {
+      return range.measurement;
+    }
+  }
+  return std::nullopt;
+}
+
+void TextMeasureRangeCache::set(
+    const TextMeasureCacheKey& key,
+    const TextMeasurement& measurement,
+    bool hasGreedyLineBreaking) const {
+  for (const auto& fragment : key.attributedString.getFragments()) {
+    if (fragment.isAttachment()) {
+      // Positions of attachments depend on the width with some alignments.
+      return;
+    }
+  }
+
+  if (key.paragraphAttributes.adjustsFontSizeToFit) {
+    // The font size is chosen for the width.
+    return;
+  }
+
+  auto maximumWidth = key.layoutConstraints.maximumSize.width;
+  auto minimumWidth = measurement.size.width;
+  if (!std::isinf(maximumWidth) && !hasGreedyLineBreaking) {
+    return;
+  }
+  if (minimumWidth > maximumWidth) {
+    // Something does not fit at all, e.g. a single word wider than the width.
+    return;
+  }
+
+  auto widthIndependentKey = TextMeasureRangeCache::widthIndependentKey(key);
+  auto ranges = cache_.get(widthIndependentKey).value_or(Ranges{});
+  ranges.insert(
+      ranges.begin(), Range{minimumWidth, maximumWidth, measurement});
+  if (ranges.size() > kMaxRangesPerString) {
+    ranges.resize(kMaxRangesPerString);
+  }
+  cache_.set(widthIndependentKey, std::move(ranges));
+}
+
+void TextMeasureRangeCache::clear() const {
+  cache_.clear();
+}
+
+TextMeasureCacheKey TextMeasureRangeCache::widthIndependentKey(
+    const TextMeasureCacheKey& key) {
+  return TextMeasureCacheKey{
+      key.attributedString, key.paragraphAttributes, LayoutConstraints{}};
+}
+
+} // namespace facebook::react
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include <react/renderer/textlayoutmanager/TextMeasureCache.h>
+
+namespace facebook::react {
+
+/*
+ * Cache of text measurements which, unlike `TextMeasureCache`, does not key
+ * them by the maximum width they were measured at, but remembers the range of
+ * maximum widths each of them is valid for. E.g. a string measured without a
+ * width constraint is laid out the same way at any maximum width at or above
+ * its measured width.
+ *
+ * Measured at a finite maximum width, a string is laid out the same way at
+ * any maximum width in between its measured width and that one, because no
+ * line gets wider and no word which was moved to the next line fits. This
+ * only holds for line breaking which fills lines greedily, which the platform
+ * tells when adding a measurement.
+ *
+ * Can be called from any thread.
+ */
+class TextMeasureRangeCache final {
+ public:
+  /*
+   * Maximum number of ranges kept for one string, keeping the most recently
+   * added ones.
+   */
+  static constexpr size_t kMaxRangesPerString = 4;
+
+  /*
+   * Returns a measurement valid at the maximum width of `key`, if any.
+   */
+  std::optional<TextMeasurement> get(const TextMeasureCacheKey& key) const;
+
+  /*
+   * Adds the measurement of `key`, if the range it is valid for can be
+   * determined. `hasGreedyLineBreaking` tells whether the platform fills lines
+   * greedily for the paragraph attributes of `key`.
+   */
+  void set(
+      const TextMeasureCacheKey& key,
+      const TextMeasurement& measurement,
+      bool hasGreedyLineBreaking) const;
+
+  /*
+   * Removes all measurements.
+   */
+  void clear() const;
+
+ private:
+  struct Range {
+    Float minimumWidth;
+    Float maximumWidth;
+    TextMeasurement measurement;
+  };
+
+  using Ranges = std::vector<Range>;
+
+  /*
+   * Returns `key` without its width, so all widths share an entry.
+   */
+  static TextMeasureCacheKey widthIndependentKey(
+      const TextMeasureCacheKey& key);
+
+  ShardedThreadSafeCache<
+      TextMeasureCacheKey,
+      Ranges,
+      kSimpleThreadSafeCacheSizeCap>
+      cache_{};
+};
+
+} // namespace facebook::react
@@ -22,6 +22,64 @@ using namespace facebook::jni;
 
 namespace facebook::react {
 
+// Keys of the MapBuffer describing a batch of text measurements, mirrored by
+// FabricUIManager.measureMapBufferBatch.
+constexpr static MapBuffer::Key TX_MEASURE_KEY_REQUESTS = 0;
+constexpr static MapBuffer::Key TX_MEASURE_KEY_ATTRIBUTED_STRING = 0;
+constexpr static MapBuffer::Key TX_MEASURE_KEY_PARAGRAPH_ATTRIBUTES = 1;
+constexpr static MapBuffer::Key TX_MEASURE_KEY_MIN_WIDTH = 2;
+constexpr static MapBuffer::Key TX_MEASURE_KEY_MAX_WIDTH = 3;
+constexpr static MapBuffer::Key TX_MEASURE_KEY_MIN_HEIGHT = 4;
+constexpr static MapBuffer::Key TX_MEASURE_KEY_MAX_HEIGHT = 5;
+constexpr static MapBuffer::Key TX_MEASURE_KEY_ATTACHMENTS_COUNT = 6;
+
+static const ContextContainer::Key<jni::global_ref<jobject>>&
+fabricUIManagerKey() {
+  static const auto key =
+      ContextContainer::Key<jni::global_ref<jobject>>("FabricUIManager");
+  return key;
+}
+
+// Only the simple strategy of Android fills lines greedily; the others
+// optimize the breaks of a whole paragraph.
+static bool hasGreedyLineBreaking(
+    const ParagraphAttributes& paragraphAttributes) {
+  return paragraphAttributes.textBreakStrategy == TextBreakStrategy::Simple;
+}
+
+static int countAttachments(const AttributedString& attributedString) {
+  int attachmentsCount = 0;
+  for (const auto& fragment : attributedString.getFragments()) {
+    if (fragment.isAttachment()) {
+      attachmentsCount++;
+    }
+  }
+  return attachmentsCount;
+}
+
+// Reads the positions Java wrote for the attachments of `attributedString`,
+// as (top, left) pairs.
+static TextMeasurement::Attachments attachmentsFromPositions(
+    const AttributedString& attributedString,
+    const jfloat* attachmentData) {
+  auto attachments = TextMeasurement::Attachments{};
+  int attachmentIndex = 0;
+  for (const auto& fragment : attributedString.getFragments()) {
+    if (fragment.isAttachment()) {
+      float top = attachmentData[attachmentIndex * 2];
+      float left = attachmentData[attachmentIndex * 2 + 1];
+      float width = fragment.parentShadowView.layoutMetrics.frame.size.width;
+      float height = fragment.parentShadowView.layoutMetrics.frame.size.height;
+
+      auto rect = facebook::react::Rect{
+          {left, top}, facebook::react::Size{width, height}};
+      attachments.push_back(TextMeasurement::Attachment{rect, false});
+      attachmentIndex++;
+    }
+  }
+  return attachments;
+}
+
 Size measureAndroidComponent(
     const ContextContainer::Shared& contextContainer,
     Tag rootTag,
@@ -35,7 +93,7 @@ Size measureAndroidComponent(
     float maxHeight,
     jfloatArray attachmentPositions) {
   const jni::global_ref<jobject>& fabricUIManager =
-      contextContainer->at<jni::global_ref<jobject>>("FabricUIManager");
+      contextContainer->at(fabricUIManagerKey());
 
   static auto measure =
       jni::findClassStatic("com/facebook/react/fabric/FabricUIManager")
@@ -103,7 +161,7 @@ Size measureAndroidComponentMapBuffer(
     float maxHeight,
     jfloatArray attachmentPositions) {
   const jni::global_ref<jobject>& fabricUIManager =
-      contextContainer->at<jni::global_ref<jobject>>("FabricUIManager");
+      contextContainer->at(fabricUIManagerKey());
   auto componentNameRef = make_jstring(componentName);
 
   static auto measure =
@@ -144,18 +202,37 @@ Size measureAndroidComponentMapBuffer(
   return size;
 }
 
+static std::shared_ptr<TextMeasureCache> createMeasureCache() {
+  auto size = CoreFeatures::cacheLastTextMeasurement
+      ? size_t{8096}
+      : kSimpleThreadSafeCacheSizeCap;
+  return CoreFeatures::enableProcessWideTextMeasureCache
+      ? getProcessWideTextMeasureCache(size)
+      : std::make_shared<TextMeasureCache>(size);
+}
+
 TextLayoutManager::TextLayoutManager(
     const ContextContainer::Shared& contextContainer)
     : contextContainer_(contextContainer),
-      measureCache_(
-          CoreFeatures::cacheLastTextMeasurement
-              ? 8096
-              : kSimpleThreadSafeCacheSizeCap) {}
+      measureCache_(createMeasureCache()),
+      persistentMeasureCache_(
+          PersistentTextMeasureCache::fromContextContainer(contextContainer)) {
+}
 
 void* TextLayoutManager::getNativeTextLayoutManager() const {
   return self_;
 }
 
+void TextLayoutManager::didReceiveMemoryPressure(
+    MemoryPressureLevel level) const {
+  if (level >= MemoryPressureLevel::Moderate) {
+    measureRangeCache_.clear();
+  }
+  if (level >= MemoryPressureLevel::Critical) {
+    measureCache_->clear();
+  }
+}
+
 TextMeasurement TextLayoutManager::measure(
     const AttributedStringBox& attributedStringBox,
     const ParagraphAttributes& paragraphAttributes,
@@ -163,11 +240,25 @@ TextMeasurement TextLayoutManager::measure(
     LayoutConstraints layoutConstraints,
     std::shared_ptr<void> /* hostTextStorage */) const {
   auto& attributedString = attributedStringBox.getValue();
+  auto telemetry = TransactionTelemetry::threadLocalTelemetry();
+  auto isCacheMiss = false;
 
-  auto measurement = measureCache_.get(
+  auto measurement = measureCache_->get(
       {attributedString, paragraphAttributes, layoutConstraints},
-      [&](const TextMeasureCacheKey& /*key*/) {
-        auto telemetry = TransactionTelemetry::threadLocalTelemetry();
+      [&](const TextMeasureCacheKey& key) {
+        if (CoreFeatures::enableTextMeasureRangeCache) {
+          if (auto rangeMeasurement = measureRangeCache_.get(key)) {
+            return *rangeMeasurement;
+          }
+        }
+
+        if (persistentMeasureCache_) {
+          if (auto persistedMeasurement = persistentMeasureCache_->get(key)) {
+            return *persistedMeasurement;
+          }
+        }
+
+        isCacheMiss = true;
         if (telemetry != nullptr) {
           telemetry->willMeasureText();
         }
@@ -179,12 +270,95 @@ TextMeasurement TextLayoutManager::measure(
           telemetry->didMeasureText();
         }
 
+        if (persistentMeasureCache_) {
+          persistentMeasureCache_->set(key, measurement);
+        }
+
+        if (CoreFeatures::enableTextMeasureRangeCache) {
+          measureRangeCache_.set(
+              key, measurement, hasGreedyLineBreaking(paragraphAttributes));
+        }
+
         return measurement;
       });
 
+  if (telemetry != nullptr) {
+    telemetry->didLookUpTextMeasureCache(
+        isCacheMiss ? 0 : 1, isCacheMiss ? 1 : 0);
+  }
+
   measurement.size = layoutConstraints.clamp(measurement.size);
   return measurement;
 }
+
+std::vector<TextMeasurement> TextLayoutManager::measureBatch(
+    const std::vector<TextMeasureCacheKey>& requests,
+    const TextLayoutContext& /*layoutContext*/) const {
+  auto measurements = std::vector<TextMeasurement>(requests.size());
+
+  auto missedIndices = std::vector<size_t>{};
+  auto missedRequests = std::vector<const TextMeasureCacheKey*>{};
+  for (size_t i = 0; i < requests.size(); i++) {
+    const auto& request = requests[i];
+    if (auto measurement = measureCache_->get(request)) {
+      measurements[i] = std::move(*measurement);
+    } else if (
+        CoreFeatures::enableTextMeasureRangeCache &&
+        (measurement = measureRangeCache_.get(request))) {
+      measureCache_->set(request, *measurement);
+      measurements[i] = std::move(*measurement);
+    } else if (
+        persistentMeasureCache_ &&
+        (measurement = persistentMeasureCache_->get(request))) {
+      measureCache_->set(request, *measurement);
+      measurements[i] = std::move(*measurement);
+    } else {
+      missedIndices.push_back(i);
+      missedRequests.push_back(&request);
+    }
+  }
+
+  auto telemetry = TransactionTelemetry::threadLocalTelemetry();
+  if (telemetry != nullptr) {
+    telemetry->didLookUpTextMeasureCache(
+        static_cast<int>(requests.size() - missedRequests.size()),
+        static_cast<int>(missedRequests.size()));
+  }
+
+  if (!missedRequests.empty()) {
+    if (telemetry != nullptr) {
+      telemetry->willMeasureText();
+    }
+
+    auto missedMeasurements = doMeasureMapBufferBatch(missedRequests);
+
+    if (telemetry != nullptr) {
+      telemetry->didMeasureText();
+    }
+
+    for (size_t i = 0; i < missedIndices.size(); i++) {
+      const auto& request = *missedRequests[i];
+      measureCache_->set(request, missedMeasurements[i]);
+      if (persistentMeasureCache_) {
+        persistentMeasureCache_->set(request, missedMeasurements[i]);
+      }
+      if (CoreFeatures::enableTextMeasureRangeCache) {
+        measureRangeCache_.set(
+            request,
+            missedMeasurements[i],
+            hasGreedyLineBreaking(request.paragraphAttributes));
+      }
+      measurements[missedIndices[i]] = std::move(missedMeasurements[i]);
+    }
+  }
+
+  for (size_t i = 0; i < requests.size(); i++) {
+    measurements[i].size =
+        requests[i].layoutConstraints.clamp(measurements[i].size);
+  }
+  return measurements;
+}
+
 std::shared_ptr<void> TextLayoutManager::getHostTextStorage(
     const AttributedString& /* attributedStringBox */,
     const ParagraphAttributes& /* paragraphAttributes */,
@@ -232,7 +406,7 @@ LinesMeasurements TextLayoutManager::measureLines(
     const ParagraphAttributes& paragraphAttributes,
     Size size) const {
   const jni::global_ref<jobject>& fabricUIManager =
-      contextContainer_->at<jni::global_ref<jobject>>("FabricUIManager");
+      contextContainer_->at(fabricUIManagerKey());
   static auto measureLines =
       jni::findClassStatic("com/facebook/react/fabric/FabricUIManager")
           ->getMethod<NativeArray::javaobject(
@@ -338,12 +512,7 @@ TextMeasurement TextLayoutManager::doMeasureMapBuffer(
     LayoutConstraints layoutConstraints) const {
   layoutConstraints.maximumSize.height = std::numeric_limits<Float>::infinity();
 
-  int attachmentsCount = 0;
-  for (const auto& fragment : attributedString.getFragments()) {
-    if (fragment.isAttachment()) {
-      attachmentsCount++;
-    }
-  }
+  int attachmentsCount = countAttachments(attributedString);
   auto env = Environment::current();
   auto attachmentPositions = env->NewFloatArray(attachmentsCount * 2);
 
@@ -368,24 +537,9 @@ TextMeasurement TextLayoutManager::doMeasureMapBuffer(
   jfloat* attachmentData =
       env->GetFloatArrayElements(attachmentPositions, nullptr);
 
-  auto attachments = TextMeasurement::Attachments{};
-  if (attachmentsCount > 0) {
-    int attachmentIndex = 0;
-    for (const auto& fragment : attributedString.getFragments()) {
-      if (fragment.isAttachment()) {
-        float top = attachmentData[attachmentIndex * 2];
-        float left = attachmentData[attachmentIndex * 2 + 1];
-        float width = fragment.parentShadowView.layoutMetrics.frame.size.width;
-        float height =
-            fragment.parentShadowView.layoutMetrics.frame.size.height;
-
-        auto rect = facebook::react::Rect{
-            {left, top}, facebook::react::Size{width, height}};
-        attachments.push_back(TextMeasurement::Attachment{rect, false});
-        attachmentIndex++;
-      }
-    }
-  }
+  auto attachments = attachmentsCount > 0
+      ? attachmentsFromPositions(attributedString, attachmentData)
+      : TextMeasurement::Attachments{};
 
   // Clean up allocated ref
   env->ReleaseFloatArrayElements(
@@ -395,4 +549,84 @@ TextMeasurement TextLayoutManager::doMeasureMapBuffer(
   return TextMeasurement{size, attachments};
 }
 
+std::vector<TextMeasurement> TextLayoutManager::doMeasureMapBufferBatch(
+    const std::vector<const TextMeasureCacheKey*>& requests) const {
+  const jni::global_ref<jobject>& fabricUIManager =
+      contextContainer_->at(fabricUIManagerKey());
+  static auto measureBatch =
+      jni::findClassStatic("com/facebook/react/fabric/FabricUIManager")
+          ->getMethod<void(
+              jint, jstring, JReadableMapBuffer::javaobject, jfloatArray)>(
+              "measureMapBufferBatch");
+
+  // Java writes the width and the height of every request, followed by the
+  // positions of its attachments.
+  auto resultsCount = 0;
+  auto requestMaps = std::vector<MapBuffer>{};
+  requestMaps.reserve(requests.size());
+  // Reused for every request; `build()` resets it.
+  auto requestBuilder = MapBufferBuilder(7);
+  for (const auto* request : requests) {
+    auto layoutConstraints = request->layoutConstraints;
+    layoutConstraints.maximumSize.height =
+        std::numeric_limits<Float>::infinity();
+    auto attachmentsCount = countAttachments(request->attributedString);
+    resultsCount += 2 + attachmentsCount * 2;
+
+    requestBuilder.putMapBuffer(
+        TX_MEASURE_KEY_ATTRIBUTED_STRING,
+        toMapBuffer(request->attributedString));
+    requestBuilder.putMapBuffer(
+        TX_MEASURE_KEY_PARAGRAPH_ATTRIBUTES,
+        toMapBuffer(request->paragraphAttributes));
+    requestBuilder.putDouble(
+        TX_MEASURE_KEY_MIN_WIDTH, layoutConstraints.minimumSize.width);
+    requestBuilder.putDouble(
+        TX_MEASURE_KEY_MAX_WIDTH, layoutConstraints.maximumSize.width);
+    requestBuilder.putDouble(
+        TX_MEASURE_KEY_MIN_HEIGHT, layoutConstraints.minimumSize.height);
+    requestBuilder.putDouble(
+        TX_MEASURE_KEY_MAX_HEIGHT, layoutConstraints.maximumSize.height);
+    requestBuilder.putInt(TX_MEASURE_KEY_ATTACHMENTS_COUNT, attachmentsCount);
+    requestMaps.push_back(requestBuilder.build());
+  }
+
+  auto builder = MapBufferBuilder();
+  builder.putMapBufferList(TX_MEASURE_KEY_REQUESTS, requestMaps);
+  auto batchMap = JReadableMapBuffer::createWithContents(builder.build());
+  auto componentNameRef = make_jstring("RCTText");
+
+  auto env = Environment::current();
+  auto results = env->NewFloatArray(resultsCount);
+
+  measureBatch(
+      fabricUIManager,
+      -1, // TODO: we should pass rootTag in
+      componentNameRef.get(),
+      batchMap.get(),
+      results);
+
+  jfloat* resultData = env->GetFloatArrayElements(results, nullptr);
+
+  auto measurements = std::vector<TextMeasurement>{};
+  measurements.reserve(requests.size());
+  auto offset = 0;
+  for (const auto* request : requests) {
+    auto size = Size{resultData[offset], resultData[offset + 1]};
+    offset += 2;
+    auto attachments = attachmentsFromPositions(
+        request->attributedString, resultData + offset);
+    offset += static_cast<int>(attachments.size()) * 2;
+    measurements.push_back(TextMeasurement{size, std::move(attachments)});
+  }
+
+  // Clean up allocated refs
+  env->ReleaseFloatArrayElements(results, resultData, JNI_ABORT);
+  env->DeleteLocalRef(results);
+  componentNameRef.reset();
+  batchMap.reset();
+
+  return measurements;
+}
+
 } // namespace facebook::react
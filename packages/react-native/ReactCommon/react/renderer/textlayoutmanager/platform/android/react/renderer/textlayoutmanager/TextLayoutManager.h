@@ -7,13 +7,18 @@
 
 #pragma once
 
+#include <vector>
+
 #include <react/config/ReactNativeConfig.h>
 #include <react/renderer/attributedstring/AttributedString.h>
 #include <react/renderer/attributedstring/AttributedStringBox.h>
 #include <react/renderer/core/LayoutConstraints.h>
+#include <react/renderer/textlayoutmanager/PersistentTextMeasureCache.h>
 #include <react/renderer/textlayoutmanager/TextLayoutContext.h>
 #include <react/renderer/textlayoutmanager/TextMeasureCache.h>
+#include <react/renderer/textlayoutmanager/TextMeasureRangeCache.h>
 #include <react/utils/ContextContainer.h>
+#include <react/utils/MemoryPressureCoordinator.h>
 
 namespace facebook::react {
 
@@ -50,6 +55,15 @@ class TextLayoutManager {
       LayoutConstraints layoutConstraints,
       std::shared_ptr<void> /* hostTextStorage */) const;
 
+  /*
+   * Measures several attributed strings, each with the paragraph attributes
+   * and constraints of its request. Strings which are not cached are measured
+   * with a single call into Java.
+   */
+  std::vector<TextMeasurement> measureBatch(
+      const std::vector<TextMeasureCacheKey>& requests,
+      const TextLayoutContext& layoutContext) const;
+
   std::shared_ptr<void> getHostTextStorage(
       const AttributedString& attributedString,
       const ParagraphAttributes& paragraphAttributes,
@@ -79,6 +93,11 @@ class TextLayoutManager {
    */
   void* getNativeTextLayoutManager() const;
 
+  /*
+   * Releases the caches of measurements which `level` calls for.
+   */
+  void didReceiveMemoryPressure(MemoryPressureLevel level) const;
+
  private:
   TextMeasurement doMeasure(
       AttributedString attributedString,
@@ -90,6 +109,9 @@ class TextLayoutManager {
       const ParagraphAttributes& paragraphAttributes,
       LayoutConstraints layoutConstraints) const;
 
+  std::vector<TextMeasurement> doMeasureMapBufferBatch(
+      const std::vector<const TextMeasureCacheKey*>& requests) const;
+
   LinesMeasurements measureLinesMapBuffer(
       const AttributedString& attributedString,
       const ParagraphAttributes& paragraphAttributes,
@@ -97,7 +119,9 @@ class TextLayoutManager {
 
   void* self_{};
   ContextContainer::Shared contextContainer_;
-  TextMeasureCache measureCache_;
+  std::shared_ptr<TextMeasureCache> measureCache_;
+  TextMeasureRangeCache measureRangeCache_;
+  std::shared_ptr<PersistentTextMeasureCache> persistentMeasureCache_;
 };
 
 } // namespace facebook::react
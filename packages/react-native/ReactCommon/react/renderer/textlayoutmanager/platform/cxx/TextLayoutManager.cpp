@@ -29,6 +29,22 @@ TextMeasurement TextLayoutManager::measure(
   return TextMeasurement{{0, 0}, attachments};
 }
 
+std::vector<TextMeasurement> TextLayoutManager::measureBatch(
+    const std::vector<TextMeasureCacheKey>& requests,
+    const TextLayoutContext& layoutContext) const {
+  auto measurements = std::vector<TextMeasurement>{};
+  measurements.reserve(requests.size());
+  for (const auto& request : requests) {
+    measurements.push_back(measure(
+        AttributedStringBox{request.attributedString},
+        request.paragraphAttributes,
+        layoutContext,
+        request.layoutConstraints,
+        nullptr));
+  }
+  return measurements;
+}
+
 LinesMeasurements TextLayoutManager::measureLines(
     AttributedString attributedString,
     ParagraphAttributes paragraphAttributes,
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include <react/renderer/attributedstring/AttributedString.h>
 #include <react/renderer/attributedstring/AttributedStringBox.h>
@@ -42,6 +43,14 @@ class TextLayoutManager {
       LayoutConstraints layoutConstraints,
       std::shared_ptr<void>) const;
 
+  /*
+   * Measures several attributed strings, each with the paragraph attributes
+   * and constraints of its request.
+   */
+  virtual std::vector<TextMeasurement> measureBatch(
+      const std::vector<TextMeasureCacheKey>& requests,
+      const TextLayoutContext& layoutContext) const;
+
   /*
    * Measures lines of `attributedString` using native text rendering
    * infrastructure.
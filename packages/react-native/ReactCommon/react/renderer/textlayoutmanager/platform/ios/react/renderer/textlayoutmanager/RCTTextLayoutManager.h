@@ -62,6 +62,11 @@ using RCTTextLayoutFragmentEnumerationBlock =
                               frame:(CGRect)frame
                          usingBlock:(RCTTextLayoutFragmentEnumerationBlock)block;
 
+/**
+ * Drops the cached conversions of attributed strings.
+ */
+- (void)clearCache;
+
 @end
 
 NS_ASSUME_NONNULL_END
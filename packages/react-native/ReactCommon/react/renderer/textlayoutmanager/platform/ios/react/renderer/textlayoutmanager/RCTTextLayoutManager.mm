@@ -12,12 +12,12 @@
 #import <React/NSTextStorage+FontScaling.h>
 #import <React/RCTUtils.h>
 #import <react/utils/ManagedObjectWrapper.h>
-#import <react/utils/SimpleThreadSafeCache.h>
+#import <react/utils/ShardedThreadSafeCache.h>
 
 using namespace facebook::react;
 
 @implementation RCTTextLayoutManager {
-  SimpleThreadSafeCache<AttributedString, std::shared_ptr<void>, 256> _cache;
+  ShardedThreadSafeCache<AttributedString, std::shared_ptr<void>, 256> _cache;
 }
 
 static NSLineBreakMode RCTNSLineBreakModeFromEllipsizeMode(EllipsizeMode ellipsizeMode)
@@ -323,4 +323,9 @@ static NSLineBreakMode RCTNSLineBreakModeFromEllipsizeMode(EllipsizeMode ellipsi
   return TextMeasurement{{size.width, size.height}, attachments};
 }
 
+- (void)clearCache
+{
+  _cache.clear();
+}
+
 @end
@@ -8,13 +8,17 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include <react/renderer/attributedstring/AttributedStringBox.h>
 #include <react/renderer/attributedstring/ParagraphAttributes.h>
 #include <react/renderer/core/LayoutConstraints.h>
+#include <react/renderer/textlayoutmanager/PersistentTextMeasureCache.h>
 #include <react/renderer/textlayoutmanager/TextLayoutContext.h>
 #include <react/renderer/textlayoutmanager/TextMeasureCache.h>
+#include <react/renderer/textlayoutmanager/TextMeasureRangeCache.h>
 #include <react/utils/ContextContainer.h>
+#include <react/utils/MemoryPressureCoordinator.h>
 
 namespace facebook::react {
 
@@ -37,6 +41,15 @@ class TextLayoutManager {
       LayoutConstraints layoutConstraints,
       std::shared_ptr<void> hostTextStorage) const;
 
+  /*
+   * Measures several attributed strings, each with the paragraph attributes
+   * and constraints of its request. Strings are measured one by one, as there
+   * is no boundary to amortize on iOS.
+   */
+  std::vector<TextMeasurement> measureBatch(
+      const std::vector<TextMeasureCacheKey>& requests,
+      const TextLayoutContext& layoutContext) const;
+
   /*
    * Measures lines of `attributedString` using native text rendering
    * infrastructure.
@@ -57,9 +70,16 @@ class TextLayoutManager {
    */
   std::shared_ptr<void> getNativeTextLayoutManager() const;
 
+  /*
+   * Releases the caches of measurements which `level` calls for.
+   */
+  void didReceiveMemoryPressure(MemoryPressureLevel level) const;
+
  private:
   std::shared_ptr<void> self_;
-  TextMeasureCache measureCache_{};
+  std::shared_ptr<TextMeasureCache> measureCache_;
+  TextMeasureRangeCache measureRangeCache_{};
+  std::shared_ptr<PersistentTextMeasureCache> persistentMeasureCache_;
 };
 
 } // namespace facebook::react
@@ -7,6 +7,7 @@
 
 #include "TextLayoutManager.h"
 #include <react/renderer/telemetry/TransactionTelemetry.h>
+#include <react/utils/CoreFeatures.h>
 #include <react/utils/ManagedObjectWrapper.h>
 
 #import "RCTTextLayoutManager.h"
@@ -14,6 +15,11 @@
 namespace facebook::react {
 
 TextLayoutManager::TextLayoutManager(const ContextContainer::Shared &contextContainer)
+    : measureCache_(
+          CoreFeatures::enableProcessWideTextMeasureCache
+              ? getProcessWideTextMeasureCache(kSimpleThreadSafeCacheSizeCap)
+              : std::make_shared<TextMeasureCache>()),
+      persistentMeasureCache_(PersistentTextMeasureCache::fromContextContainer(contextContainer))
 {
   self_ = wrapManagedObject([RCTTextLayoutManager new]);
 }
@@ -24,6 +30,18 @@ std::shared_ptr<void> TextLayoutManager::getNativeTextLayoutManager() const
   return self_;
 }
 
+void TextLayoutManager::didReceiveMemoryPressure(MemoryPressureLevel level) const
+{
+  if (level >= MemoryPressureLevel::Moderate) {
+    measureRangeCache_.clear();
+    RCTTextLayoutManager *textLayoutManager = (RCTTextLayoutManager *)unwrapManagedObject(self_);
+    [textLayoutManager clearCache];
+  }
+  if (level >= MemoryPressureLevel::Critical) {
+    measureCache_->clear();
+  }
+}
+
 std::shared_ptr<void> TextLayoutManager::getHostTextStorage(
     AttributedString attributedString,
     ParagraphAttributes paragraphAttributes,
@@ -52,14 +70,28 @@ TextMeasurement TextLayoutManager::measure(
   }
 
   auto measurement = TextMeasurement{};
+  auto telemetry = TransactionTelemetry::threadLocalTelemetry();
 
   switch (attributedStringBox.getMode()) {
     case AttributedStringBox::Mode::Value: {
       auto &attributedString = attributedStringBox.getValue();
+      auto isCacheMiss = false;
 
-      measurement = measureCache_.get(
+      measurement = measureCache_->get(
           {attributedString, paragraphAttributes, layoutConstraints}, [&](const TextMeasureCacheKey &key) {
-            auto telemetry = TransactionTelemetry::threadLocalTelemetry();
+            if (CoreFeatures::enableTextMeasureRangeCache) {
+              if (auto rangeMeasurement = measureRangeCache_.get(key)) {
+                return *rangeMeasurement;
+              }
+            }
+
+            if (persistentMeasureCache_) {
+              if (auto persistedMeasurement = persistentMeasureCache_->get(key)) {
+                return *persistedMeasurement;
+              }
+            }
+
+            isCacheMiss = true;
             if (telemetry) {
               telemetry->willMeasureText();
             }
@@ -73,8 +105,21 @@ TextMeasurement TextLayoutManager::measure(
               telemetry->didMeasureText();
             }
 
+            if (persistentMeasureCache_) {
+              persistentMeasureCache_->set(key, measurement);
+            }
+
+            if (CoreFeatures::enableTextMeasureRangeCache) {
+              // TextKit fills lines greedily.
+              measureRangeCache_.set(key, measurement, true /* hasGreedyLineBreaking */);
+            }
+
             return measurement;
           });
+
+      if (telemetry) {
+        telemetry->didLookUpTextMeasureCache(isCacheMiss ? 0 : 1, isCacheMiss ? 1 : 0);
+      }
       break;
     }
 
@@ -82,7 +127,6 @@ TextMeasurement TextLayoutManager::measure(
       NSAttributedString *nsAttributedString =
           (NSAttributedString *)unwrapManagedObject(attributedStringBox.getOpaquePointer());
 
-      auto telemetry = TransactionTelemetry::threadLocalTelemetry();
       if (telemetry) {
         telemetry->willMeasureText();
       }
@@ -105,6 +149,23 @@ TextMeasurement TextLayoutManager::measure(
   return measurement;
 }
 
+std::vector<TextMeasurement> TextLayoutManager::measureBatch(
+    const std::vector<TextMeasureCacheKey> &requests,
+    const TextLayoutContext &layoutContext) const
+{
+  auto measurements = std::vector<TextMeasurement>{};
+  measurements.reserve(requests.size());
+  for (const auto &request : requests) {
+    measurements.push_back(measure(
+        AttributedStringBox{request.attributedString},
+        request.paragraphAttributes,
+        layoutContext,
+        request.layoutConstraints,
+        nullptr));
+  }
+  return measurements;
+}
+
 LinesMeasurements TextLayoutManager::measureLines(
     AttributedString attributedString,
     ParagraphAttributes paragraphAttributes,
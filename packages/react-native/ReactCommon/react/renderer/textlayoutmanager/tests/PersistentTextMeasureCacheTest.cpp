@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/textlayoutmanager/PersistentTextMeasureCache.h>
+
+using namespace facebook::react;
+
+static TextMeasureCacheKey keyWithString(std::string string, Float width) {
+  auto fragment = AttributedString::Fragment{};
+  fragment.string = std::move(string);
+  fragment.textAttributes.fontSize = 14;
+
+  auto key = TextMeasureCacheKey{};
+  key.attributedString.appendFragment(fragment);
+  key.layoutConstraints.maximumSize = Size{width, 1000};
+  return key;
+}
+
+static TextMeasurement measurementWithSize(Size size) {
+  auto measurement = TextMeasurement{};
+  measurement.size = size;
+  return measurement;
+}
+
+static std::string temporaryPath(const std::string& name) {
+  auto path = testing::TempDir() + "PersistentTextMeasureCacheTest-" + name;
+  std::remove(path.c_str());
+  return path;
+}
+
+// The file is written asynchronously, and renamed into place once complete.
+static bool waitForFile(const std::string& path) {
+  for (auto i = 0; i < 200; i++) {
+    if (auto file = std::fopen(path.c_str(), "rb")) {
+      std::fclose(file);
+      return true;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return false;
+}
+
+TEST(PersistentTextMeasureCacheTest, testPersistentKeyIsLayoutWise) {
+  auto key = keyWithString("Hello", 100);
+
+  auto decorated = key;
+  auto fragment = decorated.attributedString.getFragments().front();
+  fragment.textAttributes.opacity = 0.5;
+  decorated.attributedString = AttributedString{};
+  decorated.attributedString.appendFragment(fragment);
+
+  EXPECT_TRUE(PersistentTextMeasureCache::persistentKey(key).has_value());
+  EXPECT_EQ(
+      PersistentTextMeasureCache::persistentKey(key),
+      PersistentTextMeasureCache::persistentKey(decorated));
+  EXPECT_NE(
+      PersistentTextMeasureCache::persistentKey(key),
+      PersistentTextMeasureCache::persistentKey(keyWithString("Hello", 200)));
+  EXPECT_NE(
+      PersistentTextMeasureCache::persistentKey(key),
+      PersistentTextMeasureCache::persistentKey(keyWithString("Hallo", 100)));
+}
+
+TEST(PersistentTextMeasureCacheTest, testStringsWithAttachmentsAreNotCached) {
+  auto key =
+      keyWithString(AttributedString::Fragment::AttachmentCharacter(), 100);
+  EXPECT_FALSE(PersistentTextMeasureCache::persistentKey(key).has_value());
+
+  auto cache = PersistentTextMeasureCache{temporaryPath("attachments"), ""};
+  cache.set(key, measurementWithSize({10, 10}));
+  EXPECT_FALSE(cache.get(key).has_value());
+}
+
+TEST(PersistentTextMeasureCacheTest, testMeasurementsArePersisted) {
+  auto path = temporaryPath("persisted");
+  auto key = keyWithString("Hello", 100);
+
+  {
+    auto cache = PersistentTextMeasureCache{path, "en_US"};
+    EXPECT_FALSE(cache.get(key).has_value());
+    cache.set(key, measurementWithSize({42, 17}));
+    EXPECT_EQ(cache.get(key)->size, (Size{42, 17}));
+  }
+  ASSERT_TRUE(waitForFile(path));
+
+  auto cache = PersistentTextMeasureCache{path, "en_US"};
+  auto measurement = cache.get(key);
+  ASSERT_TRUE(measurement.has_value());
+  EXPECT_EQ(measurement->size, (Size{42, 17}));
+  EXPECT_FALSE(cache.get(keyWithString("Hello", 200)).has_value());
+
+  // Measurements of another configuration (e.g. locale) are discarded.
+  auto otherCache = PersistentTextMeasureCache{path, "fr_FR"};
+  EXPECT_FALSE(otherCache.get(key).has_value());
+}
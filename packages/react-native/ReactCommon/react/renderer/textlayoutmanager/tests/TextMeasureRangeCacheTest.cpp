@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <limits>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/textlayoutmanager/TextMeasureRangeCache.h>
+
+using namespace facebook::react;
+
+static TextMeasureCacheKey keyWithWidth(Float width) {
+  auto fragment = AttributedString::Fragment{};
+  fragment.string = "Hello world";
+  fragment.textAttributes.fontSize = 14;
+
+  auto key = TextMeasureCacheKey{};
+  key.attributedString.appendFragment(fragment);
+  key.layoutConstraints.maximumSize.width = width;
+  return key;
+}
+
+static TextMeasurement measurementWithSize(Size size) {
+  auto measurement = TextMeasurement{};
+  measurement.size = size;
+  return measurement;
+}
+
+TEST(TextMeasureRangeCacheTest, testUnconstrainedMeasurementIsReused) {
+  auto cache = TextMeasureRangeCache{};
+  cache.set(
+      keyWithWidth(std::numeric_limits<Float>::infinity()),
+      measurementWithSize({80, 17}),
+      false /* hasGreedyLineBreaking */);
+
+  EXPECT_EQ(cache.get(keyWithWidth(80))->size, (Size{80, 17}));
+  EXPECT_EQ(cache.get(keyWithWidth(320))->size, (Size{80, 17}));
+  EXPECT_FALSE(cache.get(keyWithWidth(79)).has_value());
+}
+
+TEST(TextMeasureRangeCacheTest, testWrappedMeasurementIsReusedIfGreedy) {
+  auto cache = TextMeasureRangeCache{};
+  cache.set(
+      keyWithWidth(60),
+      measurementWithSize({40, 34}),
+      false /* hasGreedyLineBreaking */);
+  EXPECT_FALSE(cache.get(keyWithWidth(50)).has_value());
+
+  cache.set(
+      keyWithWidth(60),
+      measurementWithSize({40, 34}),
+      true /* hasGreedyLineBreaking */);
+  EXPECT_EQ(cache.get(keyWithWidth(40))->size, (Size{40, 34}));
+  EXPECT_EQ(cache.get(keyWithWidth(50))->size, (Size{40, 34}));
+  EXPECT_EQ(cache.get(keyWithWidth(60))->size, (Size{40, 34}));
+  EXPECT_FALSE(cache.get(keyWithWidth(39)).has_value());
+  EXPECT_FALSE(cache.get(keyWithWidth(61)).has_value());
+}
+
+TEST(TextMeasureRangeCacheTest, testWidthDependentStringsAreNotCached) {
+  auto cache = TextMeasureRangeCache{};
+
+  auto adjustedKey = keyWithWidth(std::numeric_limits<Float>::infinity());
+  adjustedKey.paragraphAttributes.adjustsFontSizeToFit = true;
+  cache.set(adjustedKey, measurementWithSize({80, 17}), true);
+  adjustedKey.layoutConstraints.maximumSize.width = 100;
+  EXPECT_FALSE(cache.get(adjustedKey).has_value());
+
+  auto attachmentKey = keyWithWidth(std::numeric_limits<Float>::infinity());
+  auto attachment = AttributedString::Fragment{};
+  attachment.string = AttributedString::Fragment::AttachmentCharacter();
+  attachmentKey.attributedString.appendFragment(attachment);
+  cache.set(attachmentKey, measurementWithSize({80, 17}), true);
+  attachmentKey.layoutConstraints.maximumSize.width = 100;
+  EXPECT_FALSE(cache.get(attachmentKey).has_value());
+}
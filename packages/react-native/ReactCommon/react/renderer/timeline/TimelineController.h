@@ -57,6 +57,10 @@ class TimelineController final : public UIManagerCommitHook {
 
   void commitHookWasUnregistered(const UIManager& uiManager) noexcept override;
 
+  const char* getName() const noexcept override {
+    return "TimelineController";
+  }
+
  private:
   /*
    * Protects all the data members.
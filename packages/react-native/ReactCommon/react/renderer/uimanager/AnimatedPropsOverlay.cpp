@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "AnimatedPropsOverlay.h"
+
+#include <react/renderer/debug/SystraceSection.h>
+
+#include <string_view>
+#include <unordered_set>
+
+namespace facebook::react {
+
+namespace {
+
+// Props of views which don't affect layout and which views apply on their
+// own, without their children.
+constexpr std::string_view kOverridablePropNames[] = {
+    "opacity",
+    "transform",
+    "backgroundColor",
+    "borderColor",
+    "shadowColor",
+    "shadowOpacity",
+};
+
+/*
+ * Returns the node of `family` in the tree of `rootShadowNode` together with
+ * its parent, or `nullptr`s if the node is not part of the tree.
+ */
+std::pair<ShadowNode::Shared, const ShadowNode*> findShadowNodeAndParent(
+    const RootShadowNode& rootShadowNode,
+    const ShadowNodeFamily& family) {
+  auto ancestors = family.getAncestors(rootShadowNode);
+  if (ancestors.empty()) {
+    return {nullptr, nullptr};
+  }
+
+  const auto& [parentShadowNode, childIndex] = ancestors.back();
+  return {
+      parentShadowNode.get().getChildren().at(childIndex),
+      &parentShadowNode.get()};
+}
+
+} // namespace
+
+bool AnimatedPropsOverlay::canOverrideProps(const folly::dynamic& rawProps) {
+  if (!rawProps.isObject() || rawProps.empty()) {
+    return false;
+  }
+
+  for (const auto& [name, _] : rawProps.items()) {
+    auto isOverridable = false;
+    for (auto overridablePropName : kOverridablePropNames) {
+      if (name.isString() && name.getString() == overridablePropName) {
+        isOverridable = true;
+        break;
+      }
+    }
+
+    if (!isOverridable) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool AnimatedPropsOverlay::overrideProps(
+    const RootShadowNode& rootShadowNode,
+    const ShadowNodeFamily& family,
+    const PropsCloner& cloneProps) const {
+  SystraceSection s("AnimatedPropsOverlay::overrideProps");
+
+  auto [shadowNode, parentShadowNode] =
+      findShadowNodeAndParent(rootShadowNode, family);
+
+  // Flattened nodes are mounted as parts of their ancestors, and props of a
+  // node which doesn't form a stacking context apply to its flattened
+  // children as well, so both need a commit.
+  if (shadowNode == nullptr ||
+      !shadowNode->getTraits().check(
+          ShadowNodeTraits::Trait::FormsStackingContext)) {
+    return false;
+  }
+
+  std::scoped_lock lock(mutex_);
+
+  auto& override =
+      overridesOfSurfaces_[family.getSurfaceId()][shadowNode->getTag()];
+  if (override.shadowNode != shadowNode) {
+    // A commit replaced the node since its props were last overridden; the
+    // props of the new node already include those that were folded in.
+    override.shadowNode = shadowNode;
+    override.props = shadowNode->getProps();
+    override.parentShadowView = ShadowView(*parentShadowNode);
+    override.mountedShadowView = ShadowView(*shadowNode);
+  }
+
+  override.props = cloneProps(override.props);
+
+  if (!override.isPending) {
+    override.isPending = true;
+    pendingOverrideCount_++;
+  }
+
+  return true;
+}
+
+RootShadowNode::Unshared AnimatedPropsOverlay::foldOverrides(
+    const RootShadowNode::Unshared& rootShadowNode) const {
+  std::scoped_lock lock(mutex_);
+
+  auto overridesIterator =
+      overridesOfSurfaces_.find(rootShadowNode->getSurfaceId());
+  if (overridesIterator == overridesOfSurfaces_.end()) {
+    return rootShadowNode;
+  }
+
+  SystraceSection s("AnimatedPropsOverlay::foldOverrides");
+
+  auto& overrides = overridesIterator->second;
+  auto families = std::unordered_set<const ShadowNodeFamily*>{};
+  for (auto iterator = overrides.begin(); iterator != overrides.end();) {
+    const auto& override = iterator->second;
+    auto& family = override.shadowNode->getFamily();
+    auto shadowNode = findShadowNodeAndParent(*rootShadowNode, family).first;
+
+    // Overrides are kept until a commit replaces the node, because the commit
+    // which folds them in can still fail and be retried.
+    if (shadowNode != nullptr &&
+        shadowNode->getProps() == override.shadowNode->getProps()) {
+      families.insert(&family);
+      iterator++;
+    } else {
+      // The node was removed, or its props were already folded in or replaced
+      // by React (which applies props set with `setNativeProps` on its own).
+      iterator = eraseOverride(overrides, iterator);
+    }
+  }
+
+  if (overrides.empty()) {
+    overridesOfSurfaces_.erase(overridesIterator);
+  }
+
+  if (families.empty()) {
+    return rootShadowNode;
+  }
+
+  auto newRootShadowNode = rootShadowNode->cloneMultiple(
+      families,
+      [&](const ShadowNode& oldShadowNode, const ShadowNodeFragment& fragment) {
+        return oldShadowNode.clone({
+            /* .props = */ overrides.at(oldShadowNode.getTag()).props,
+            /* .children = */ fragment.children,
+        });
+      });
+
+  return std::static_pointer_cast<RootShadowNode>(newRootShadowNode);
+}
+
+void AnimatedPropsOverlay::stopSurface(SurfaceId surfaceId) const {
+  std::scoped_lock lock(mutex_);
+
+  auto overridesIterator = overridesOfSurfaces_.find(surfaceId);
+  if (overridesIterator == overridesOfSurfaces_.end()) {
+    return;
+  }
+
+  auto& overrides = overridesIterator->second;
+  for (auto iterator = overrides.begin(); iterator != overrides.end();) {
+    iterator = eraseOverride(overrides, iterator);
+  }
+  overridesOfSurfaces_.erase(overridesIterator);
+}
+
+#pragma mark - MountingOverrideDelegate
+
+bool AnimatedPropsOverlay::shouldOverridePullTransaction() const {
+  return pendingOverrideCount_ > 0;
+}
+
+std::optional<MountingTransaction> AnimatedPropsOverlay::pullTransaction(
+    SurfaceId surfaceId,
+    MountingTransaction::Number number,
+    const TransactionTelemetry& telemetry,
+    ShadowViewMutationList mutations) const {
+  {
+    std::scoped_lock lock(mutex_);
+
+    auto overridesIterator = overridesOfSurfaces_.find(surfaceId);
+    if (overridesIterator != overridesOfSurfaces_.end()) {
+      // Added after the mutations of committed revisions, which overridden
+      // props are based on.
+      for (auto& [tag, override] : overridesIterator->second) {
+        if (!override.isPending) {
+          continue;
+        }
+
+        auto shadowView = override.mountedShadowView;
+        shadowView.props = override.props;
+        mutations.push_back(ShadowViewMutation::UpdateMutation(
+            override.mountedShadowView,
+            shadowView,
+            override.parentShadowView));
+
+        override.mountedShadowView = std::move(shadowView);
+        override.isPending = false;
+        pendingOverrideCount_--;
+      }
+    }
+  }
+
+  if (mutations.empty()) {
+    return {};
+  }
+
+  return MountingTransaction{
+      surfaceId, number, std::move(mutations), telemetry};
+}
+
+AnimatedPropsOverlay::Overrides::iterator AnimatedPropsOverlay::eraseOverride(
+    Overrides& overrides,
+    Overrides::iterator iterator) const {
+  if (iterator->second.isPending) {
+    pendingOverrideCount_--;
+  }
+  return overrides.erase(iterator);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <folly/dynamic.h>
+#include <react/renderer/components/root/RootShadowNode.h>
+#include <react/renderer/core/ReactPrimitives.h>
+#include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/mounting/MountingOverrideDelegate.h>
+#include <react/renderer/mounting/ShadowView.h>
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+namespace facebook::react {
+
+/*
+ * Mounts props set with `setNativeProps` (e.g. frames of native-driven
+ * animations) which only change how views are drawn, without committing a new
+ * shadow tree: the props of a node are overridden and the `Update` mutations
+ * are added to the next transaction pulled from the `MountingCoordinator` of
+ * the surface. Overridden props are folded into the shadow tree with the next
+ * commit of the surface, so until then, measuring the node (e.g. with
+ * `measure` or hit testing) doesn't take them into account.
+ *
+ * Thread safe.
+ */
+class AnimatedPropsOverlay final : public MountingOverrideDelegate {
+ public:
+  /*
+   * Returns the overriding props for the given current props of the node.
+   */
+  using PropsCloner = std::function<Props::Shared(const Props::Shared& props)>;
+
+  /*
+   * Returns whether all given props can be overridden, i.e. they don't affect
+   * layout.
+   */
+  static bool canOverrideProps(const folly::dynamic& rawProps);
+
+  /*
+   * Overrides the props of the node of `family` in `rootShadowNode` (the
+   * current revision of the surface) with the ones returned by `cloneProps`.
+   * Returns `false` if the node is not mounted as a view of its own, in which
+   * case the props have to be committed instead.
+   */
+  bool overrideProps(
+      const RootShadowNode& rootShadowNode,
+      const ShadowNodeFamily& family,
+      const PropsCloner& cloneProps) const;
+
+  /*
+   * Returns a clone of `rootShadowNode` with overridden props folded into the
+   * nodes, or `rootShadowNode` if there is nothing to fold. Meant to be called
+   * right before a new shadow tree of the surface is committed.
+   */
+  RootShadowNode::Unshared foldOverrides(
+      const RootShadowNode::Unshared& rootShadowNode) const;
+
+  /*
+   * Drops the overridden props of the surface.
+   */
+  void stopSurface(SurfaceId surfaceId) const;
+
+#pragma mark - MountingOverrideDelegate
+
+  bool shouldOverridePullTransaction() const override;
+
+  std::optional<MountingTransaction> pullTransaction(
+      SurfaceId surfaceId,
+      MountingTransaction::Number number,
+      const TransactionTelemetry& telemetry,
+      ShadowViewMutationList mutations) const override;
+
+ private:
+  struct Override {
+    // The node of the current revision which the props override.
+    ShadowNode::Shared shadowNode;
+    Props::Shared props;
+    ShadowView parentShadowView;
+    ShadowView mountedShadowView;
+    bool isPending{false};
+  };
+
+  using Overrides = std::unordered_map<Tag, Override>;
+
+  Overrides::iterator eraseOverride(
+      Overrides& overrides,
+      Overrides::iterator iterator) const;
+
+  mutable std::mutex mutex_;
+  mutable std::unordered_map<SurfaceId, Overrides>
+      overridesOfSurfaces_; // Protected by `mutex_`.
+  mutable std::atomic<int> pendingOverrideCount_{0};
+};
+
+} // namespace facebook::react
@@ -0,0 +1,573 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "CommitCapture.h"
+
+#include <react/renderer/components/view/ViewShadowNode.h>
+#include <react/renderer/core/LayoutableShadowNode.h>
+#include <react/renderer/mapbuffer/MapBufferBuilder.h>
+#include <react/renderer/mounting/ShadowTree.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <unistd.h>
+#include <unordered_map>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr int32_t kCaptureVersion = 1;
+
+// Keys of a captured commit.
+constexpr MapBuffer::Key kCommitVersion = 0;
+constexpr MapBuffer::Key kCommitSurfaceId = 1;
+constexpr MapBuffer::Key kCommitMinimumWidth = 2;
+constexpr MapBuffer::Key kCommitMinimumHeight = 3;
+constexpr MapBuffer::Key kCommitMaximumWidth = 4;
+constexpr MapBuffer::Key kCommitMaximumHeight = 5;
+constexpr MapBuffer::Key kCommitLayoutDirection = 6;
+constexpr MapBuffer::Key kCommitPointScaleFactor = 7;
+constexpr MapBuffer::Key kCommitFontSizeMultiplier = 8;
+constexpr MapBuffer::Key kCommitSwapLeftAndRightInRTL = 9;
+constexpr MapBuffer::Key kCommitViewportOffsetX = 10;
+constexpr MapBuffer::Key kCommitViewportOffsetY = 11;
+// Nodes of the trees in pre-order.
+constexpr MapBuffer::Key kCommitOldNodes = 12;
+constexpr MapBuffer::Key kCommitNewNodes = 13;
+
+// Keys of a captured node.
+constexpr MapBuffer::Key kNodeTag = 0;
+constexpr MapBuffer::Key kNodeComponentName = 1;
+constexpr MapBuffer::Key kNodeChildCount = 2;
+constexpr MapBuffer::Key kNodeProps = 3;
+constexpr MapBuffer::Key kNodeSharedWithOld = 4;
+constexpr MapBuffer::Key kNodePropsSharedWithOld = 5;
+constexpr MapBuffer::Key kNodeStateSharedWithOld = 6;
+constexpr MapBuffer::Key kNodeStateRevision = 7;
+[[maybe_unused]] constexpr MapBuffer::Key kNodeState = 8;
+constexpr MapBuffer::Key kNodeMeasurable = 9;
+constexpr MapBuffer::Key kNodeX = 10;
+constexpr MapBuffer::Key kNodeY = 11;
+constexpr MapBuffer::Key kNodeWidth = 12;
+constexpr MapBuffer::Key kNodeHeight = 13;
+
+// Objects, arrays and nulls of raw props are stored as MapBuffers whose first
+// entry is their kind; entries of objects follow as pairs of keys (names) and
+// values, entries of arrays as values.
+constexpr MapBuffer::Key kValueKind = 0;
+
+enum class ValueKind : int32_t {
+  Object = 0,
+  Array = 1,
+  Null = 2,
+};
+
+MapBuffer valueToMapBuffer(const folly::dynamic& value);
+
+void putValue(
+    MapBufferBuilder& builder,
+    MapBuffer::Key key,
+    const folly::dynamic& value) {
+  if (value.isBool()) {
+    builder.putBool(key, value.getBool());
+  } else if (value.isInt()) {
+    auto integer = value.getInt();
+    if (integer >= std::numeric_limits<int32_t>::min() &&
+        integer <= std::numeric_limits<int32_t>::max()) {
+      builder.putInt(key, static_cast<int32_t>(integer));
+    } else {
+      builder.putDouble(key, static_cast<double>(integer));
+    }
+  } else if (value.isDouble()) {
+    builder.putDouble(key, value.getDouble());
+  } else if (value.isString()) {
+    builder.putString(key, value.getString());
+  } else {
+    builder.putMapBuffer(key, valueToMapBuffer(value));
+  }
+}
+
+MapBuffer valueToMapBuffer(const folly::dynamic& value) {
+  auto builder = MapBufferBuilder{};
+  auto key = MapBuffer::Key{kValueKind + 1};
+  if (value.isObject()) {
+    builder.putInt(kValueKind, static_cast<int32_t>(ValueKind::Object));
+    for (const auto& [name, item] : value.items()) {
+      builder.putString(key++, name.asString());
+      putValue(builder, key++, item);
+    }
+  } else if (value.isArray()) {
+    builder.putInt(kValueKind, static_cast<int32_t>(ValueKind::Array));
+    for (const auto& item : value) {
+      putValue(builder, key++, item);
+    }
+  } else {
+    builder.putInt(kValueKind, static_cast<int32_t>(ValueKind::Null));
+  }
+  return builder.build();
+}
+
+folly::dynamic valueFromMapBuffer(const MapBuffer& map);
+
+folly::dynamic getValue(const MapBuffer& map, MapBuffer::Key key) {
+  switch (map.getType(key)) {
+    case MapBuffer::DataType::Boolean:
+      return map.getBool(key);
+    case MapBuffer::DataType::Int:
+      return map.getInt(key);
+    case MapBuffer::DataType::Double:
+      return map.getDouble(key);
+    case MapBuffer::DataType::String:
+      return std::string{map.getString(key)};
+    case MapBuffer::DataType::Map:
+      return valueFromMapBuffer(map.getMapBuffer(key));
+  }
+  return nullptr;
+}
+
+folly::dynamic valueFromMapBuffer(const MapBuffer& map) {
+  auto count = MapBuffer::Key{map.count()};
+  switch (static_cast<ValueKind>(map.getInt(kValueKind))) {
+    case ValueKind::Object: {
+      auto object = folly::dynamic::object();
+      for (auto key = MapBuffer::Key{kValueKind + 1}; key + 1 < count;
+           key += 2) {
+        object[std::string{map.getString(key)}] = getValue(map, key + 1);
+      }
+      return object;
+    }
+    case ValueKind::Array: {
+      auto array = folly::dynamic::array();
+      for (auto key = MapBuffer::Key{kValueKind + 1}; key < count; key++) {
+        array.push_back(getValue(map, key));
+      }
+      return array;
+    }
+    case ValueKind::Null:
+      return nullptr;
+  }
+  return nullptr;
+}
+
+class TreeCapturer final {
+ public:
+  std::vector<MapBuffer> captureOldTree(const ShadowNode& rootShadowNode) {
+    auto nodes = std::vector<MapBuffer>{};
+    captureNode(rootShadowNode, /* isNewTree */ false, nodes);
+    return nodes;
+  }
+
+  std::vector<MapBuffer> captureNewTree(const ShadowNode& rootShadowNode) {
+    auto nodes = std::vector<MapBuffer>{};
+    captureNode(rootShadowNode, /* isNewTree */ true, nodes);
+    return nodes;
+  }
+
+ private:
+  void captureNode(
+      const ShadowNode& shadowNode,
+      bool isNewTree,
+      std::vector<MapBuffer>& nodes) {
+    auto tag = shadowNode.getTag();
+
+    const ShadowNode* oldShadowNode = nullptr;
+    if (isNewTree) {
+      auto iterator = oldShadowNodes_.find(tag);
+      if (iterator != oldShadowNodes_.end()) {
+        oldShadowNode = iterator->second;
+      }
+    } else {
+      oldShadowNodes_[tag] = &shadowNode;
+    }
+
+    builder_.putInt(kNodeTag, tag);
+    builder_.putString(kNodeComponentName, shadowNode.getComponentName());
+
+    if (oldShadowNode == &shadowNode) {
+      builder_.putBool(kNodeSharedWithOld, true);
+      builder_.putInt(kNodeChildCount, 0);
+      nodes.push_back(builder_.build());
+      return;
+    }
+
+    const auto& children = shadowNode.getChildren();
+    builder_.putInt(kNodeChildCount, static_cast<int32_t>(children.size()));
+
+    const auto& props = shadowNode.getProps();
+    if (oldShadowNode != nullptr && oldShadowNode->getProps() == props) {
+      builder_.putBool(kNodePropsSharedWithOld, true);
+    } else if (props->capturedRawProps) {
+      builder_.putMapBuffer(
+          kNodeProps, valueToMapBuffer(*props->capturedRawProps));
+    }
+
+    if (const auto& state = shadowNode.getState()) {
+      builder_.putInt(
+          kNodeStateRevision, static_cast<int32_t>(state->getRevision()));
+      if (oldShadowNode != nullptr && oldShadowNode->getState() == state) {
+        builder_.putBool(kNodeStateSharedWithOld, true);
+      } else {
+#ifdef ANDROID
+        builder_.putMapBuffer(kNodeState, state->getMapBuffer());
+#endif
+      }
+    }
+
+    if (auto layoutableShadowNode =
+            dynamic_cast<const LayoutableShadowNode*>(&shadowNode)) {
+      auto layoutMetrics = layoutableShadowNode->getLayoutMetrics();
+      if (layoutMetrics == EmptyLayoutMetrics && oldShadowNode != nullptr) {
+        // Nodes created by the commit are laid out after commit hooks run.
+        if (auto oldLayoutableShadowNode =
+                dynamic_cast<const LayoutableShadowNode*>(oldShadowNode)) {
+          layoutMetrics = oldLayoutableShadowNode->getLayoutMetrics();
+        }
+      }
+      if (layoutMetrics != EmptyLayoutMetrics) {
+        builder_.putDouble(kNodeX, layoutMetrics.frame.origin.x);
+        builder_.putDouble(kNodeY, layoutMetrics.frame.origin.y);
+        builder_.putDouble(kNodeWidth, layoutMetrics.frame.size.width);
+        builder_.putDouble(kNodeHeight, layoutMetrics.frame.size.height);
+      }
+      if (shadowNode.getTraits().check(
+              ShadowNodeTraits::Trait::MeasurableYogaNode)) {
+        builder_.putBool(kNodeMeasurable, true);
+      }
+    }
+
+    nodes.push_back(builder_.build());
+
+    for (const auto& child : children) {
+      captureNode(*child, isNewTree, nodes);
+    }
+  }
+
+  MapBufferBuilder builder_{};
+  std::unordered_map<Tag, const ShadowNode*> oldShadowNodes_{};
+};
+
+class CommitReplayer final {
+ public:
+  CommitReplayer(
+      SurfaceId surfaceId,
+      const ComponentDescriptorLookup& lookup,
+      const ContextContainer& contextContainer)
+      : surfaceId_(surfaceId),
+        lookup_(lookup),
+        viewComponentDescriptor_(lookup(ViewComponentName)),
+        parserContext_(surfaceId, contextContainer) {
+    if (viewComponentDescriptor_ == nullptr) {
+      throw std::invalid_argument("Replaying commits requires <View>");
+    }
+  }
+
+  RootShadowNode::Unshared replayTree(
+      const std::vector<MapBuffer>& nodes,
+      bool isNewTree,
+      const LayoutConstraints& layoutConstraints,
+      const LayoutContext& layoutContext) {
+    if (nodes.empty()) {
+      throw std::invalid_argument("Captured tree is empty");
+    }
+
+    auto index = size_t{0};
+    auto shadowNode = replayNode(nodes, index, isNewTree);
+    auto rootShadowNode =
+        std::dynamic_pointer_cast<const RootShadowNode>(shadowNode);
+    if (!rootShadowNode) {
+      throw std::invalid_argument("Captured tree has no <RootView>");
+    }
+    return rootShadowNode->clone(
+        parserContext_, layoutConstraints, layoutContext);
+  }
+
+  /*
+   * Makes nodes of the (laid out) old tree available to the new one.
+   */
+  void setOldTree(const ShadowNode::Shared& shadowNode) {
+    oldShadowNodes_[shadowNode->getTag()] = shadowNode;
+    for (const auto& child : shadowNode->getChildren()) {
+      setOldTree(child);
+    }
+  }
+
+ private:
+  ShadowNode::Shared replayNode(
+      const std::vector<MapBuffer>& nodes,
+      size_t& index,
+      bool isNewTree) {
+    if (index >= nodes.size()) {
+      throw std::invalid_argument("Captured tree is incomplete");
+    }
+    const auto& node = nodes[index++];
+    auto tag = Tag{node.getInt(kNodeTag)};
+
+    auto oldShadowNode = ShadowNode::Shared{};
+    if (isNewTree) {
+      auto iterator = oldShadowNodes_.find(tag);
+      if (iterator != oldShadowNodes_.end()) {
+        oldShadowNode = iterator->second;
+      }
+    }
+
+    if (oldShadowNode && node.contains(kNodeSharedWithOld)) {
+      return oldShadowNode;
+    }
+
+    auto isMeasurable = node.contains(kNodeMeasurable);
+    auto componentDescriptor = isMeasurable
+        ? nullptr
+        : lookup_(std::string{node.getString(kNodeComponentName)});
+    if (componentDescriptor == nullptr) {
+      componentDescriptor = viewComponentDescriptor_;
+    }
+
+    auto children = ShadowNode::ListOfShared{};
+    auto childCount = node.getInt(kNodeChildCount);
+    for (int32_t childIndex = 0; childIndex < childCount; childIndex++) {
+      auto child = replayNode(nodes, index, isNewTree);
+      // Measured nodes are replayed at their size, which stands for their
+      // children.
+      if (!isMeasurable) {
+        children.push_back(std::move(child));
+      }
+    }
+
+    auto isSameComponent = oldShadowNode &&
+        oldShadowNode->getComponentHandle() ==
+            componentDescriptor->getComponentHandle();
+
+    auto props = Props::Shared{};
+    if (isSameComponent && node.contains(kNodePropsSharedWithOld)) {
+      props = oldShadowNode->getProps();
+    } else {
+      auto rawProps = node.contains(kNodeProps)
+          ? valueFromMapBuffer(node.getMapBuffer(kNodeProps))
+          : folly::dynamic::object();
+      if (isMeasurable && node.contains(kNodeWidth)) {
+        rawProps["width"] = node.getDouble(kNodeWidth);
+        rawProps["height"] = node.getDouble(kNodeHeight);
+      }
+      props = componentDescriptor->cloneProps(
+          parserContext_, nullptr, RawProps(std::move(rawProps)));
+    }
+
+    auto sharedChildren =
+        std::make_shared<const ShadowNode::ListOfShared>(std::move(children));
+
+    if (isSameComponent) {
+      return componentDescriptor->cloneShadowNode(
+          *oldShadowNode,
+          ShadowNodeFragment{
+              props, sharedChildren, ShadowNodeFragment::statePlaceholder()});
+    }
+
+    auto family = componentDescriptor->createFamily(
+        ShadowNodeFamilyFragment{tag, surfaceId_, nullptr});
+    auto state = componentDescriptor->createInitialState(props, family);
+    return componentDescriptor->createShadowNode(
+        ShadowNodeFragment{props, sharedChildren, state}, family);
+  }
+
+  const SurfaceId surfaceId_;
+  const ComponentDescriptorLookup& lookup_;
+  const ComponentDescriptor* viewComponentDescriptor_;
+  const PropsParserContext parserContext_;
+  std::unordered_map<Tag, ShadowNode::Shared> oldShadowNodes_{};
+};
+
+bool writeFully(int fileDescriptor, const uint8_t* data, size_t size) {
+  while (size > 0) {
+    auto written = ::write(fileDescriptor, data, size);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    data += written;
+    size -= static_cast<size_t>(written);
+  }
+  return true;
+}
+
+bool readFully(int fileDescriptor, uint8_t* data, size_t size) {
+  while (size > 0) {
+    auto bytesRead = ::read(fileDescriptor, data, size);
+    if (bytesRead < 0 && errno == EINTR) {
+      continue;
+    }
+    if (bytesRead <= 0) {
+      return false;
+    }
+    data += bytesRead;
+    size -= static_cast<size_t>(bytesRead);
+  }
+  return true;
+}
+
+} // namespace
+
+MapBuffer captureCommit(
+    SurfaceId surfaceId,
+    const RootShadowNode& oldRootShadowNode,
+    const RootShadowNode& newRootShadowNode) {
+  auto capturer = TreeCapturer{};
+  auto oldNodes = capturer.captureOldTree(oldRootShadowNode);
+  auto newNodes = capturer.captureNewTree(newRootShadowNode);
+
+  const auto& rootProps = newRootShadowNode.getConcreteProps();
+  const auto& layoutConstraints = rootProps.layoutConstraints;
+  const auto& layoutContext = rootProps.layoutContext;
+
+  auto builder = MapBufferBuilder{};
+  builder.putInt(kCommitVersion, kCaptureVersion);
+  builder.putInt(kCommitSurfaceId, surfaceId);
+  builder.putDouble(kCommitMinimumWidth, layoutConstraints.minimumSize.width);
+  builder.putDouble(
+      kCommitMinimumHeight, layoutConstraints.minimumSize.height);
+  builder.putDouble(kCommitMaximumWidth, layoutConstraints.maximumSize.width);
+  builder.putDouble(
+      kCommitMaximumHeight, layoutConstraints.maximumSize.height);
+  builder.putInt(
+      kCommitLayoutDirection,
+      static_cast<int32_t>(layoutConstraints.layoutDirection));
+  builder.putDouble(kCommitPointScaleFactor, layoutContext.pointScaleFactor);
+  builder.putDouble(
+      kCommitFontSizeMultiplier, layoutContext.fontSizeMultiplier);
+  builder.putBool(
+      kCommitSwapLeftAndRightInRTL, layoutContext.swapLeftAndRightInRTL);
+  builder.putDouble(kCommitViewportOffsetX, layoutContext.viewportOffset.x);
+  builder.putDouble(kCommitViewportOffsetY, layoutContext.viewportOffset.y);
+  builder.putMapBufferList(kCommitOldNodes, oldNodes);
+  builder.putMapBufferList(kCommitNewNodes, newNodes);
+  return builder.build();
+}
+
+bool writeCommitCapture(const MapBuffer& capture, int fileDescriptor) {
+  auto size = static_cast<uint32_t>(capture.size());
+  return writeFully(
+             fileDescriptor,
+             reinterpret_cast<const uint8_t*>(&size),
+             sizeof(size)) &&
+      writeFully(fileDescriptor, capture.data(), capture.size());
+}
+
+std::vector<MapBuffer> readCommitCaptures(int fileDescriptor) {
+  auto captures = std::vector<MapBuffer>{};
+  while (true) {
+    auto size = uint32_t{0};
+    if (!readFully(
+            fileDescriptor, reinterpret_cast<uint8_t*>(&size), sizeof(size))) {
+      break;
+    }
+    auto bytes = std::vector<uint8_t>(size);
+    if (!readFully(fileDescriptor, bytes.data(), bytes.size())) {
+      break;
+    }
+    captures.emplace_back(std::move(bytes));
+  }
+  return captures;
+}
+
+ReplayedCommit replayCommit(
+    const MapBuffer& capture,
+    const ComponentDescriptorLookup& lookup,
+    const ContextContainer& contextContainer) {
+  if (capture.getInt(kCommitVersion) != kCaptureVersion) {
+    throw std::invalid_argument("Unsupported version of commit capture");
+  }
+
+  auto surfaceId = SurfaceId{capture.getInt(kCommitSurfaceId)};
+
+  auto layoutConstraints = LayoutConstraints{
+      {static_cast<Float>(capture.getDouble(kCommitMinimumWidth)),
+       static_cast<Float>(capture.getDouble(kCommitMinimumHeight))},
+      {static_cast<Float>(capture.getDouble(kCommitMaximumWidth)),
+       static_cast<Float>(capture.getDouble(kCommitMaximumHeight))},
+      static_cast<LayoutDirection>(capture.getInt(kCommitLayoutDirection))};
+
+  auto layoutContext = LayoutContext{};
+  layoutContext.pointScaleFactor =
+      static_cast<Float>(capture.getDouble(kCommitPointScaleFactor));
+  layoutContext.fontSizeMultiplier =
+      static_cast<Float>(capture.getDouble(kCommitFontSizeMultiplier));
+  layoutContext.swapLeftAndRightInRTL =
+      capture.getBool(kCommitSwapLeftAndRightInRTL);
+  layoutContext.viewportOffset = {
+      static_cast<Float>(capture.getDouble(kCommitViewportOffsetX)),
+      static_cast<Float>(capture.getDouble(kCommitViewportOffsetY))};
+
+  auto replayer = CommitReplayer{surfaceId, lookup, contextContainer};
+
+  auto oldRootShadowNode = replayer.replayTree(
+      capture.getMapBufferList(kCommitOldNodes),
+      /* isNewTree */ false,
+      layoutConstraints,
+      layoutContext);
+  oldRootShadowNode->layoutIfNeeded();
+  oldRootShadowNode->sealRecursive();
+  replayer.setOldTree(oldRootShadowNode);
+
+  auto newRootShadowNode = replayer.replayTree(
+      capture.getMapBufferList(kCommitNewNodes),
+      /* isNewTree */ true,
+      layoutConstraints,
+      layoutContext);
+
+  return ReplayedCommit{
+      surfaceId, std::move(oldRootShadowNode), std::move(newRootShadowNode)};
+}
+
+CommitCaptureHook::CommitCaptureHook(
+    int fileDescriptor,
+    size_t maxNumberOfCommits)
+    : fileDescriptor_(fileDescriptor),
+      maxNumberOfCommits_(maxNumberOfCommits) {}
+
+size_t CommitCaptureHook::getNumberOfCapturedCommits() const {
+  std::scoped_lock lock(mutex_);
+  return numberOfCapturedCommits_;
+}
+
+RootShadowNode::Unshared CommitCaptureHook::shadowTreeWillCommit(
+    const ShadowTree& shadowTree,
+    const RootShadowNode::Shared& oldRootShadowNode,
+    const RootShadowNode::Unshared& newRootShadowNode) noexcept {
+  {
+    std::scoped_lock lock(mutex_);
+    if (failed_ || numberOfCapturedCommits_ >= maxNumberOfCommits_) {
+      return newRootShadowNode;
+    }
+  }
+
+  // Capturing doesn't need the lock; commits of other surfaces may be
+  // captured meanwhile.
+  auto capture = captureCommit(
+      shadowTree.getSurfaceId(), *oldRootShadowNode, *newRootShadowNode);
+
+  std::scoped_lock lock(mutex_);
+  if (!failed_ && numberOfCapturedCommits_ < maxNumberOfCommits_) {
+    if (writeCommitCapture(capture, fileDescriptor_)) {
+      numberOfCapturedCommits_++;
+    } else {
+      failed_ = true;
+    }
+  }
+  return newRootShadowNode;
+}
+
+void CommitCaptureHook::commitHookWasRegistered(
+    const UIManager& /*uiManager*/) noexcept {}
+
+void CommitCaptureHook::commitHookWasUnregistered(
+    const UIManager& /*uiManager*/) noexcept {}
+
+} // namespace facebook::react
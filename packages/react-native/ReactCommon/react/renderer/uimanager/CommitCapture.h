@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/components/root/RootShadowNode.h>
+#include <react/renderer/core/ComponentDescriptor.h>
+#include <react/renderer/mapbuffer/MapBuffer.h>
+#include <react/renderer/uimanager/UIManagerCommitHook.h>
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Captures a commit of a surface, i.e. its old (laid out) and new (not yet
+ * laid out) root shadow nodes, into a MapBuffer which `replayCommit` can turn
+ * back into equivalent shadow trees, without the code of the app.
+ *
+ * For every node, the capture holds its tag, component name, raw props (only
+ * if `CoreFeatures::enableCommitCapture` was enabled when they were parsed),
+ * frame, revision of its state and whether it, its props or its state are
+ * shared with the old tree. Nodes of the new tree which are nodes of the old
+ * tree are captured once, without their descendants.
+ */
+MapBuffer captureCommit(
+    SurfaceId surfaceId,
+    const RootShadowNode& oldRootShadowNode,
+    const RootShadowNode& newRootShadowNode);
+
+/*
+ * Appends a captured commit to an open file descriptor, prefixed with its
+ * size. Returns `false` if writing failed.
+ */
+bool writeCommitCapture(const MapBuffer& capture, int fileDescriptor);
+
+/*
+ * Reads all commits written to the file by `writeCommitCapture`. Stops at the
+ * first incomplete one.
+ */
+std::vector<MapBuffer> readCommitCaptures(int fileDescriptor);
+
+/*
+ * Returns the descriptor of the component with the given name, or `nullptr`
+ * if the component isn't available.
+ */
+using ComponentDescriptorLookup = std::function<const ComponentDescriptor*(
+    const std::string& componentName)>;
+
+struct ReplayedCommit {
+  SurfaceId surfaceId;
+
+  // Laid out and sealed, as the old tree of a commit is.
+  RootShadowNode::Shared oldRootShadowNode;
+
+  // Not laid out yet; shares nodes, props and state with the old tree where
+  // the captured tree did.
+  RootShadowNode::Unshared newRootShadowNode;
+};
+
+/*
+ * Rebuilds the trees of a captured commit with the components of `lookup`,
+ * which has to provide at least "RootView" and "View".
+ * Components which aren't available are replayed as views with the same
+ * props. Nodes measured by the platform (e.g. paragraphs) are replayed as
+ * views of the captured size without children, since measuring them needs
+ * the platform; nodes created by the commit have no size yet, so they're
+ * replayed with the size of their family in the old tree, if any. State data
+ * can't be captured on all platforms, so new nodes get their initial state.
+ */
+ReplayedCommit replayCommit(
+    const MapBuffer& capture,
+    const ComponentDescriptorLookup& lookup,
+    const ContextContainer& contextContainer);
+
+/*
+ * Captures commits of all surfaces, up to a limit, into a file (e.g. for
+ * reproducing slow commits of a screen of an app with `replayCommit`).
+ * Captures are written on the thread of the commit; the hook doesn't alter
+ * commits.
+ */
+class CommitCaptureHook final : public UIManagerCommitHook {
+ public:
+  /*
+   * `fileDescriptor` has to stay open while the hook is registered; the hook
+   * doesn't close it.
+   */
+  CommitCaptureHook(int fileDescriptor, size_t maxNumberOfCommits);
+
+  /*
+   * Returns the number of commits written so far.
+   */
+  size_t getNumberOfCapturedCommits() const;
+
+#pragma mark - UIManagerCommitHook
+
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& shadowTree,
+      const RootShadowNode::Shared& oldRootShadowNode,
+      const RootShadowNode::Unshared& newRootShadowNode) noexcept override;
+
+  void commitHookWasRegistered(const UIManager& uiManager) noexcept override;
+
+  void commitHookWasUnregistered(const UIManager& uiManager) noexcept override;
+
+  const char* getName() const noexcept override {
+    return "CommitCaptureHook";
+  }
+
+ private:
+  const int fileDescriptor_;
+  const size_t maxNumberOfCommits_;
+
+  mutable std::mutex mutex_;
+  size_t numberOfCapturedCommits_{0};
+  bool failed_{false};
+};
+
+} // namespace facebook::react
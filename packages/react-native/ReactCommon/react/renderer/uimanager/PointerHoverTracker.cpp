@@ -43,7 +43,7 @@ bool PointerHoverTracker::hasSameTarget(
 bool PointerHoverTracker::areAnyTargetsListeningToEvents(
     std::initializer_list<ViewEvents::Offset> eventTypes,
     const UIManager& uiManager) const {
-  auto eventPath = getEventPathTargets();
+  const auto& eventPath = getEventPathTargets();
 
   for (const auto& oldTarget : eventPath) {
     auto newestTarget = uiManager.getNewestCloneOfShadowNode(oldTarget);
@@ -65,8 +65,8 @@ bool PointerHoverTracker::areAnyTargetsListeningToEvents(
 std::tuple<EventPath, EventPath> PointerHoverTracker::diffEventPath(
     const PointerHoverTracker& other,
     const UIManager& uiManager) const {
-  auto myEventPath = getEventPathTargets();
-  auto otherEventPath = other.getEventPathTargets();
+  const auto& myEventPath = getEventPathTargets();
+  const auto& otherEventPath = other.getEventPathTargets();
 
   // Starting from the root node, iterate through both event paths, comparing
   // the nodes' families until a difference is found, and then just break out of
@@ -131,14 +131,19 @@ const ShadowNode* PointerHoverTracker::getLatestNode(
   return &node;
 }
 
-EventPath PointerHoverTracker::getEventPathTargets() const {
-  EventPath result{};
+const EventPath& PointerHoverTracker::getEventPathTargets() const {
+  if (eventPath_) {
+    return *eventPath_;
+  }
+
+  auto& result = eventPath_.emplace();
   if (target_ == nullptr || root_ == nullptr) {
     return result;
   }
 
   auto ancestors = target_->getFamily().getAncestors(*root_);
 
+  result.reserve(ancestors.size() + 1);
   result.emplace_back(*target_);
   for (auto it = ancestors.rbegin(); it != ancestors.rend(); it++) {
     result.push_back(it->first);
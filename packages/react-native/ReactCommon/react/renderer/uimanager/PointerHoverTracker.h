@@ -10,6 +10,7 @@
 #include <functional>
 #include <initializer_list>
 #include <memory>
+#include <optional>
 
 #include <react/renderer/components/view/primitives.h>
 #include <react/renderer/core/ReactPrimitives.h>
@@ -65,7 +66,14 @@ class PointerHoverTracker {
    * Retrieves the list of shadow node references in the event's path starting
    * from the target node to the root node.
    */
-  EventPath getEventPathTargets() const;
+  const EventPath& getEventPathTargets() const;
+
+  /**
+   * The event path of `target_` in `root_`. Both never change, so the path is
+   * computed once and shared by all queries of the tracker (and of the next
+   * event, which compares its path with this one).
+   */
+  mutable std::optional<EventPath> eventPath_;
 };
 
 } // namespace facebook::react
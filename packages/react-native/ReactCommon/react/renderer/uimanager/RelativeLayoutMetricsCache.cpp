@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "RelativeLayoutMetricsCache.h"
+
+namespace facebook::react {
+
+// Measurements are mostly relative to the roots of a few surfaces, so entries
+// of ancestors which aren't alive anymore are only pruned past this size.
+static constexpr size_t kMaxEntries = 16;
+
+size_t RelativeLayoutMetricsCache::policyIndex(
+    LayoutableShadowNode::LayoutInspectingPolicy policy) {
+  return (policy.includeTransform ? 1 : 0) |
+      (policy.includeViewportOffset ? 2 : 0) |
+      (policy.enableOverflowClipping ? 4 : 0);
+}
+
+LayoutMetrics RelativeLayoutMetricsCache::getRelativeLayoutMetrics(
+    const ShadowNodeFamily& descendantNodeFamily,
+    const ShadowNode::Shared& ancestorNode,
+    LayoutableShadowNode::LayoutInspectingPolicy policy) {
+  const auto& layoutableAncestorNode =
+      static_cast<const LayoutableShadowNode&>(*ancestorNode);
+
+  std::unique_lock lock(mutex_);
+
+  auto& entry = entriesByAncestorFamily_[&ancestorNode->getFamily()];
+  auto isSameAncestorNode = !entry.ancestorNode.owner_before(ancestorNode) &&
+      !ancestorNode.owner_before(entry.ancestorNode);
+  if (!isSameAncestorNode) {
+    entry.ancestorNode = ancestorNode;
+    entry.layoutMetrics.clear();
+
+    if (entriesByAncestorFamily_.size() > kMaxEntries) {
+      for (auto it = entriesByAncestorFamily_.begin();
+           it != entriesByAncestorFamily_.end();) {
+        if (it->second.ancestorNode.expired()) {
+          it = entriesByAncestorFamily_.erase(it);
+        } else {
+          it++;
+        }
+      }
+    }
+  }
+
+  // A family which is destroyed while the ancestor node is alive isn't part
+  // of its tree, so a later family with the same address can't be either and
+  // the metrics stay correct (empty).
+  auto& layoutMetrics =
+      entry.layoutMetrics[&descendantNodeFamily][policyIndex(policy)];
+  if (!layoutMetrics) {
+    layoutMetrics = LayoutableShadowNode::computeRelativeLayoutMetrics(
+        descendantNodeFamily, layoutableAncestorNode, policy);
+  }
+  return *layoutMetrics;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/core/LayoutMetrics.h>
+#include <react/renderer/core/LayoutableShadowNode.h>
+#include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/core/ShadowNodeFamily.h>
+
+#include <array>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+namespace facebook::react {
+
+/*
+ * Memoizes `LayoutableShadowNode::computeRelativeLayoutMetrics` per ancestor
+ * node instance. Committed nodes are immutable and every change to a node
+ * clones its ancestors, so the metrics of any family relative to the same
+ * instance of an ancestor (e.g. the root of the current revision) never
+ * change. Measuring the same nodes again within a revision is a lookup;
+ * the metrics relative to an ancestor are dropped once it is replaced by a
+ * newer clone.
+ *
+ * Thread safe.
+ */
+class RelativeLayoutMetricsCache final {
+ public:
+  LayoutMetrics getRelativeLayoutMetrics(
+      const ShadowNodeFamily& descendantNodeFamily,
+      const ShadowNode::Shared& ancestorNode,
+      LayoutableShadowNode::LayoutInspectingPolicy policy);
+
+ private:
+  // Metrics of a family for every combination of the policy's flags.
+  using LayoutMetricsByPolicy = std::array<std::optional<LayoutMetrics>, 8>;
+
+  struct Entry {
+    ShadowNode::Weak ancestorNode;
+    std::unordered_map<const ShadowNodeFamily*, LayoutMetricsByPolicy>
+        layoutMetrics;
+  };
+
+  static size_t policyIndex(
+      LayoutableShadowNode::LayoutInspectingPolicy policy);
+
+  std::mutex mutex_;
+  std::unordered_map<const ShadowNodeFamily*, Entry> entriesByAncestorFamily_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ShadowNodeFamilyIndex.h"
+
+#include <algorithm>
+
+namespace facebook::react {
+
+// Entries of destroyed families are pruned when the index grows to twice the
+// size it had after the previous pruning, which keeps adding amortized O(1).
+static constexpr size_t kMinPruningThreshold = 1024;
+
+void ShadowNodeFamilyIndex::add(
+    Tag tag,
+    const ShadowNodeFamily::Shared& family) {
+  std::lock_guard lock(mutex_);
+
+  families_[tag] = family;
+
+  if (families_.size() < std::max(pruningThreshold_, kMinPruningThreshold)) {
+    return;
+  }
+
+  for (auto it = families_.begin(); it != families_.end();) {
+    if (it->second.expired()) {
+      it = families_.erase(it);
+    } else {
+      it++;
+    }
+  }
+  pruningThreshold_ = families_.size() * 2;
+}
+
+ShadowNodeFamily::Shared ShadowNodeFamilyIndex::find(Tag tag) const {
+  std::lock_guard lock(mutex_);
+
+  auto it = families_.find(tag);
+  if (it == families_.end()) {
+    return nullptr;
+  }
+  return it->second.lock();
+}
+
+} // namespace facebook::react
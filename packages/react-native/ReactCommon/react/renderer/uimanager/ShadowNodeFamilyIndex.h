@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/core/ReactPrimitives.h>
+#include <react/renderer/core/ShadowNodeFamily.h>
+
+#include <mutex>
+#include <unordered_map>
+
+namespace facebook::react {
+
+/*
+ * Maps tags to the families of shadow nodes created by `UIManager`, so that
+ * finding a node by tag doesn't need to traverse shadow trees. Families are
+ * referenced weakly; entries of destroyed families are pruned as the index
+ * grows.
+ *
+ * Thread safe.
+ */
+class ShadowNodeFamilyIndex final {
+ public:
+  void add(Tag tag, const ShadowNodeFamily::Shared& family);
+
+  /*
+   * Returns the family with given tag, or `nullptr` if it's not alive.
+   */
+  ShadowNodeFamily::Shared find(Tag tag) const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::unordered_map<Tag, ShadowNodeFamily::Weak> families_;
+  size_t pruningThreshold_{0};
+};
+
+} // namespace facebook::react
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "SurfaceCompletionQueue.h"
+
+#include <react/debug/react_native_assert.h>
+
+#include <utility>
+
+namespace facebook::react {
+
+namespace {
+thread_local bool isRunningCompletion_ = false;
+} // namespace
+
+SurfaceCompletionQueue::SurfaceCompletionQueue(
+    BackgroundExecutor backgroundExecutor)
+    : backgroundExecutor_(std::move(backgroundExecutor)) {
+  react_native_assert(backgroundExecutor_);
+}
+
+void SurfaceCompletionQueue::schedule(
+    SurfaceId surfaceId,
+    Completion completion) {
+  {
+    std::lock_guard lock(mutex_);
+    auto& surfaceCompletions = surfaceCompletions_[surfaceId];
+    surfaceCompletions.pendingCompletion = std::move(completion);
+    surfaceCompletions.generation++;
+    if (surfaceCompletions.isDraining) {
+      // The running drain picks up the new completion when it's done.
+      return;
+    }
+    surfaceCompletions.isDraining = true;
+  }
+
+  backgroundExecutor_([weakThis = weak_from_this(), surfaceId]() {
+    if (auto strongThis = weakThis.lock()) {
+      strongThis->drain(surfaceId);
+    }
+  });
+}
+
+void SurfaceCompletionQueue::drain(SurfaceId surfaceId) {
+  while (true) {
+    auto completion = Completion{};
+    auto generation = uint64_t{};
+    {
+      std::lock_guard lock(mutex_);
+      auto iterator = surfaceCompletions_.find(surfaceId);
+      react_native_assert(iterator != surfaceCompletions_.end());
+      auto& surfaceCompletions = iterator->second;
+      if (!surfaceCompletions.pendingCompletion) {
+        surfaceCompletions_.erase(iterator);
+        return;
+      }
+      completion = std::move(surfaceCompletions.pendingCompletion);
+      surfaceCompletions.pendingCompletion = nullptr;
+      generation = surfaceCompletions.generation;
+    }
+
+    isRunningCompletion_ = true;
+    completion([this, surfaceId, generation]() {
+      std::lock_guard lock(mutex_);
+      return surfaceCompletions_.at(surfaceId).generation != generation;
+    });
+    isRunningCompletion_ = false;
+  }
+}
+
+bool SurfaceCompletionQueue::isRunningCompletion() {
+  return isRunningCompletion_;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/core/ReactPrimitives.h>
+#include <react/renderer/uimanager/primitives.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace facebook::react {
+
+/*
+ * Runs the completions of surfaces (commit, layout, diffing and preparing the
+ * mount) on the background executor.
+ *
+ * Completions of the same surface run one at a time, in the order they were
+ * scheduled. A completion which didn't start yet is dropped when a newer one
+ * is scheduled for the same surface, and `shouldYield` of a running one
+ * returns `true` from then on. Completions of different surfaces are
+ * independent, so they run in parallel if the executor is concurrent.
+ *
+ * Thread safe.
+ */
+class SurfaceCompletionQueue final
+    : public std::enable_shared_from_this<SurfaceCompletionQueue> {
+ public:
+  using ShouldYield = std::function<bool()>;
+  using Completion = std::function<void(const ShouldYield& shouldYield)>;
+
+  explicit SurfaceCompletionQueue(BackgroundExecutor backgroundExecutor);
+
+  void schedule(SurfaceId surfaceId, Completion completion);
+
+  /*
+   * Returns whether the calling thread is running a completion scheduled on
+   * a `SurfaceCompletionQueue`.
+   */
+  static bool isRunningCompletion();
+
+ private:
+  struct SurfaceCompletions {
+    Completion pendingCompletion;
+    uint64_t generation{0};
+    bool isDraining{false};
+  };
+
+  /*
+   * Runs pending completions of the surface until there are none left.
+   */
+  void drain(SurfaceId surfaceId);
+
+  const BackgroundExecutor backgroundExecutor_;
+
+  mutable std::mutex mutex_;
+  std::unordered_map<SurfaceId, SurfaceCompletions>
+      surfaceCompletions_; // Protected by `mutex_`.
+};
+
+} // namespace facebook::react
@@ -8,11 +8,17 @@
 #include "UIManager.h"
 
 #include <cxxreact/JSExecutor.h>
+#include <react/config/ReactNativeConfig.h>
 #include <react/debug/react_native_assert.h>
+#include <react/utils/CoreFeatures.h>
+#include <react/renderer/components/view/ViewProps.h>
+#include <react/renderer/components/view/YogaLayoutableShadowNode.h>
 #include <react/renderer/core/DynamicPropsUtilities.h>
 #include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/core/ShadowNodeFragment.h>
 #include <react/renderer/debug/SystraceSection.h>
+#include <react/renderer/mounting/ShadowTreeSnapshot.h>
+#include <react/renderer/uimanager/AnimatedPropsOverlay.h>
 #include <react/renderer/uimanager/SurfaceRegistryBinding.h>
 #include <react/renderer/uimanager/UIManagerBinding.h>
 #include <react/renderer/uimanager/UIManagerCommitHook.h>
@@ -20,7 +26,10 @@
 
 #include <glog/logging.h>
 
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace {
 constexpr int DOCUMENT_POSITION_DISCONNECTED = 1;
@@ -39,12 +48,32 @@ namespace facebook::react {
 ShadowNodeListWrapper::~ShadowNodeListWrapper() = default;
 
 static std::unique_ptr<LeakChecker> constructLeakCheckerIfNeeded(
-    const RuntimeExecutor& runtimeExecutor) {
-#ifdef REACT_NATIVE_DEBUG
-  return std::make_unique<LeakChecker>(runtimeExecutor);
-#else
-  return {};
+    const RuntimeExecutor& runtimeExecutor,
+    const ContextContainer::Shared& contextContainer) {
+  auto options = LeakChecker::Options{};
+#ifndef REACT_NATIVE_DEBUG
+  // Outside of development, leaks are only checked for a sample of families
+  // (if the app opts in), and without forcing garbage collection.
+  auto reactNativeConfig = contextContainer
+      ? contextContainer->find<std::shared_ptr<const ReactNativeConfig>>(
+            "ReactNativeConfig")
+      : std::nullopt;
+  options.samplingRate = reactNativeConfig && *reactNativeConfig
+      ? (*reactNativeConfig)
+            ->getDouble("react_fabric:leak_checker_sampling_rate")
+      : 0;
+  if (!(options.samplingRate > 0)) {
+    return {};
+  }
+  options.collectGarbage = false;
 #endif
+  if (contextContainer) {
+    if (auto reporter = contextContainer->find<LeakChecker::LeakReporter>(
+            LeakChecker::kLeakReporterKey)) {
+      options.reporter = std::move(*reporter);
+    }
+  }
+  return std::make_unique<LeakChecker>(runtimeExecutor, std::move(options));
 }
 
 UIManager::UIManager(
@@ -53,8 +82,14 @@ UIManager::UIManager(
     ContextContainer::Shared contextContainer)
     : runtimeExecutor_(runtimeExecutor),
       backgroundExecutor_(std::move(backgroundExecutor)),
+      surfaceCompletionQueue_(
+          backgroundExecutor_
+              ? std::make_shared<SurfaceCompletionQueue>(backgroundExecutor_)
+              : nullptr),
       contextContainer_(std::move(contextContainer)),
-      leakChecker_(constructLeakCheckerIfNeeded(runtimeExecutor)) {}
+      animatedPropsOverlay_(std::make_shared<AnimatedPropsOverlay>()),
+      leakChecker_(
+          constructLeakCheckerIfNeeded(runtimeExecutor, contextContainer_)) {}
 
 UIManager::~UIManager() {
   LOG(WARNING) << "UIManager::~UIManager() was called (address: " << this
@@ -97,6 +132,8 @@ std::shared_ptr<ShadowNode> UIManager::createNode(
       },
       family);
 
+  shadowNodeFamilyIndex_.add(tag, family);
+
   if (delegate_ != nullptr) {
     delegate_->uiManagerDidCreateShadowNode(*shadowNode);
   }
@@ -127,9 +164,8 @@ std::shared_ptr<ShadowNode> UIManager::cloneNode(
       // `nativeProps_DEPRECATED`. For example, if both `nativeProps_DEPRECATED`
       // and `rawProps` contain key 'A'. Value from `rawProps` overrides what
       // was previously in `nativeProps_DEPRECATED`.
-      family.nativeProps_DEPRECATED =
-          std::make_unique<folly::dynamic>(mergeDynamicProps(
-              *family.nativeProps_DEPRECATED, (folly::dynamic)rawProps));
+      *family.nativeProps_DEPRECATED = mergeDynamicProps(
+          std::move(*family.nativeProps_DEPRECATED), (folly::dynamic)rawProps);
 
       props = componentDescriptor.cloneProps(
           propsParserContext,
@@ -198,6 +234,8 @@ void UIManager::startSurface(
   SystraceSection s("UIManager::startSurface");
 
   auto surfaceId = shadowTree->getSurfaceId();
+  shadowTree->getMountingCoordinator()->addMountingOverrideDelegate(
+      animatedPropsOverlay_);
   shadowTreeRegistry_.add(std::move(shadowTree));
 
   runtimeExecutor_([=](jsi::Runtime& runtime) {
@@ -242,6 +280,7 @@ ShadowTree::Unique UIManager::stopSurface(SurfaceId surfaceId) const {
       leakChecker_->stopSurface(surfaceId);
     }
   }
+  animatedPropsOverlay_->stopSurface(surfaceId);
   return shadowTree;
 }
 
@@ -444,53 +483,88 @@ LayoutMetrics UIManager::getRelativeLayoutMetrics(
     return EmptyLayoutMetrics;
   }
 
-  return LayoutableShadowNode::computeRelativeLayoutMetrics(
-      shadowNode.getFamily(), *layoutableAncestorShadowNode, policy);
+  return relativeLayoutMetricsCache_.getRelativeLayoutMetrics(
+      shadowNode.getFamily(), owningAncestorShadowNode, policy);
 }
 
 void UIManager::updateState(const StateUpdate& stateUpdate) const {
+  updateStates({stateUpdate});
+}
+
+void UIManager::updateStates(
+    const std::vector<StateUpdate>& stateUpdates) const {
   SystraceSection s(
-      "UIManager::updateState",
-      "componentName",
-      stateUpdate.family->getComponentName());
-  auto& callback = stateUpdate.callback;
-  auto& family = stateUpdate.family;
-  auto& componentDescriptor = family->getComponentDescriptor();
+      "UIManager::updateStates", "numberOfUpdates", stateUpdates.size());
+
+  // Updates are grouped by surface (in order of their first update), so each
+  // surface gets a single commit.
+  auto surfaceIds = std::vector<SurfaceId>{};
+  auto updatesOfSurfaces =
+      std::unordered_map<SurfaceId, std::vector<const StateUpdate*>>{};
+  for (const auto& stateUpdate : stateUpdates) {
+    auto& updatesOfSurface =
+        updatesOfSurfaces[stateUpdate.family->getSurfaceId()];
+    if (updatesOfSurface.empty()) {
+      surfaceIds.push_back(stateUpdate.family->getSurfaceId());
+    }
+    updatesOfSurface.push_back(&stateUpdate);
+  }
+
+  for (auto surfaceId : surfaceIds) {
+    // Updates of the same family are applied in order on top of each other.
+    auto families = std::unordered_set<const ShadowNodeFamily*>{};
+    auto updatesOfFamilies = std::unordered_map<
+        const ShadowNodeFamily*,
+        std::vector<const StateUpdate*>>{};
+    for (const auto* stateUpdate : updatesOfSurfaces[surfaceId]) {
+      families.insert(stateUpdate->family.get());
+      updatesOfFamilies[stateUpdate->family.get()].push_back(stateUpdate);
+    }
 
-  shadowTreeRegistry_.visit(
-      family->getSurfaceId(), [&](const ShadowTree& shadowTree) {
-        shadowTree.commit(
-            [&](RootShadowNode const& oldRootShadowNode) {
-              auto isValid = true;
-
-              auto rootNode = oldRootShadowNode.cloneTree(
-                  *family, [&](ShadowNode const& oldShadowNode) {
-                    auto newData =
-                        callback(oldShadowNode.getState()->getDataPointer());
-
-                    if (!newData) {
-                      isValid = false;
-                      // Just return something, we will discard it anyway.
-                      return oldShadowNode.clone({});
+    shadowTreeRegistry_.visit(surfaceId, [&](const ShadowTree& shadowTree) {
+      shadowTree.commit(
+          [&](RootShadowNode const& oldRootShadowNode) {
+            auto hasValidUpdates = false;
+
+            auto rootNode = oldRootShadowNode.cloneMultiple(
+                families,
+                [&](ShadowNode const& oldShadowNode,
+                    const ShadowNodeFragment& fragment) {
+                  auto& family = oldShadowNode.getFamily();
+                  auto data = oldShadowNode.getState()->getDataPointer();
+                  auto isValid = false;
+
+                  // A cancelled update only discards its own changes.
+                  for (const auto* stateUpdate : updatesOfFamilies[&family]) {
+                    if (auto newData = stateUpdate->callback(data)) {
+                      data = std::move(newData);
+                      isValid = true;
                     }
-
-                    auto newState =
-                        componentDescriptor.createState(*family, newData);
-
-                    return oldShadowNode.clone({
-                        /* .props = */ ShadowNodeFragment::propsPlaceholder(),
-                        /* .children = */
-                        ShadowNodeFragment::childrenPlaceholder(),
-                        /* .state = */ newState,
-                    });
+                  }
+
+                  if (!isValid) {
+                    return oldShadowNode.clone(fragment);
+                  }
+
+                  hasValidUpdates = true;
+                  return oldShadowNode.clone({
+                      /* .props = */ fragment.props,
+                      /* .children = */ fragment.children,
+                      /* .state = */
+                      family.getComponentDescriptor().createState(
+                          family, data),
                   });
+                });
 
-              return isValid
-                  ? std::static_pointer_cast<RootShadowNode>(rootNode)
-                  : nullptr;
-            },
-            {/* default commit options */});
-      });
+            if (!hasValidUpdates) {
+              return RootShadowNode::Unshared{nullptr};
+            }
+
+            return std::static_pointer_cast<RootShadowNode>(rootNode);
+          },
+          {/* default commit options */});
+    });
+  }
 }
 
 void UIManager::dispatchCommand(
@@ -505,45 +579,133 @@ void UIManager::dispatchCommand(
 void UIManager::setNativeProps_DEPRECATED(
     const ShadowNode::Shared& shadowNode,
     RawProps rawProps) const {
-  auto& family = shadowNode->getFamily();
-  if (family.nativeProps_DEPRECATED) {
-    // Values in `rawProps` patch (take precedence over)
-    // `nativeProps_DEPRECATED`. For example, if both `nativeProps_DEPRECATED`
-    // and `rawProps` contain key 'A'. Value from `rawProps` overrides what was
-    // previously in `nativeProps_DEPRECATED`.
-    family.nativeProps_DEPRECATED =
-        std::make_unique<folly::dynamic>(mergeDynamicProps(
-            *family.nativeProps_DEPRECATED, (folly::dynamic)rawProps));
-  } else {
-    family.nativeProps_DEPRECATED =
-        std::make_unique<folly::dynamic>((folly::dynamic)rawProps);
-  }
+  auto nativePropsUpdates = std::vector<NativePropsUpdate>{};
+  nativePropsUpdates.push_back({shadowNode, std::move(rawProps)});
+  setNativeProps_DEPRECATED(nativePropsUpdates);
+}
 
-  shadowTreeRegistry_.visit(
-      family.getSurfaceId(), [&](const ShadowTree& shadowTree) {
-        // The lambda passed to `commit` may be executed multiple times.
-        // We need to create fresh copy of the `RawProps` object each time.
-        shadowTree.commit(
-            [&](RootShadowNode const& oldRootShadowNode) {
-              auto rootNode = oldRootShadowNode.cloneTree(
-                  family, [&](ShadowNode const& oldShadowNode) {
-                    auto& componentDescriptor =
-                        componentDescriptorRegistry_->at(
-                            shadowNode->getComponentHandle());
-                    PropsParserContext propsParserContext{
-                        family.getSurfaceId(), *contextContainer_.get()};
-                    auto props = componentDescriptor.cloneProps(
+void UIManager::setNativeProps_DEPRECATED(
+    const std::vector<NativePropsUpdate>& nativePropsUpdates) const {
+  auto surfaceIds = std::vector<SurfaceId>{};
+  auto updatesOfSurfaces = std::unordered_map<
+      SurfaceId,
+      std::unordered_map<
+          const ShadowNodeFamily*,
+          std::vector<const NativePropsUpdate*>>>{};
+
+  for (const auto& nativePropsUpdate : nativePropsUpdates) {
+    auto& family = nativePropsUpdate.shadowNode->getFamily();
+    if (family.nativeProps_DEPRECATED) {
+      // Values in `rawProps` patch (take precedence over)
+      // `nativeProps_DEPRECATED`. For example, if both `nativeProps_DEPRECATED`
+      // and `rawProps` contain key 'A'. Value from `rawProps` overrides what
+      // was previously in `nativeProps_DEPRECATED`.
+      *family.nativeProps_DEPRECATED = mergeDynamicProps(
+          std::move(*family.nativeProps_DEPRECATED),
+          (folly::dynamic)nativePropsUpdate.rawProps);
+    } else {
+      family.nativeProps_DEPRECATED = std::make_unique<folly::dynamic>(
+          (folly::dynamic)nativePropsUpdate.rawProps);
+    }
+
+    auto& updatesOfSurface = updatesOfSurfaces[family.getSurfaceId()];
+    if (updatesOfSurface.empty()) {
+      surfaceIds.push_back(family.getSurfaceId());
+    }
+    updatesOfSurface[&family].push_back(&nativePropsUpdate);
+  }
+
+  // Props which only change how views are drawn are mounted without a commit
+  // if the node is mounted as a view of its own.
+  auto overrideProps =
+      [&](const RootShadowNode& rootShadowNode,
+          const ShadowNodeFamily& family,
+          const std::vector<const NativePropsUpdate*>& updatesOfFamily) {
+        for (const auto* nativePropsUpdate : updatesOfFamily) {
+          if (!AnimatedPropsOverlay::canOverrideProps(
+                  (folly::dynamic)nativePropsUpdate->rawProps)) {
+            return false;
+          }
+        }
+
+        return animatedPropsOverlay_->overrideProps(
+            rootShadowNode, family, [&](Props::Shared props) {
+              const auto& componentDescriptor =
+                  componentDescriptorRegistry_->at(family.getComponentHandle());
+              PropsParserContext propsParserContext{
+                  family.getSurfaceId(), *contextContainer_.get()};
+
+              for (const auto* nativePropsUpdate : updatesOfFamily) {
+                props = componentDescriptor.cloneProps(
+                    propsParserContext,
+                    props,
+                    RawProps(nativePropsUpdate->rawProps));
+              }
+              return props;
+            });
+      };
+
+  for (auto surfaceId : surfaceIds) {
+    auto& updatesOfFamilies = updatesOfSurfaces[surfaceId];
+
+    shadowTreeRegistry_.visit(surfaceId, [&](const ShadowTree& shadowTree) {
+      auto families = std::unordered_set<const ShadowNodeFamily*>{};
+      auto rootShadowNode = CoreFeatures::enableAnimatedPropsOverlay
+          ? shadowTree.getCurrentRevision().rootShadowNode
+          : nullptr;
+      auto didOverrideProps = false;
+      for (const auto& [family, updatesOfFamily] : updatesOfFamilies) {
+        if (rootShadowNode &&
+            overrideProps(*rootShadowNode, *family, updatesOfFamily)) {
+          didOverrideProps = true;
+        } else {
+          families.insert(family);
+        }
+      }
+
+      if (didOverrideProps) {
+        shadowTreeDidFinishTransaction(
+            shadowTree.getMountingCoordinator(),
+            /* mountSynchronously = */ false);
+      }
+
+      if (families.empty()) {
+        return;
+      }
+
+      // The lambda passed to `commit` may be executed multiple times.
+      // We need to create fresh copy of the `RawProps` object each time.
+      shadowTree.commit(
+          [&](RootShadowNode const& oldRootShadowNode) {
+            auto rootNode = oldRootShadowNode.cloneMultiple(
+                families,
+                [&](ShadowNode const& oldShadowNode,
+                    const ShadowNodeFragment& fragment) {
+                  auto& componentDescriptor = componentDescriptorRegistry_->at(
+                      oldShadowNode.getComponentHandle());
+                  PropsParserContext propsParserContext{
+                      surfaceId, *contextContainer_.get()};
+
+                  auto props = oldShadowNode.getProps();
+                  for (const auto* nativePropsUpdate :
+                       updatesOfFamilies.at(&oldShadowNode.getFamily())) {
+                    props = componentDescriptor.cloneProps(
                         propsParserContext,
-                        getNewestCloneOfShadowNode(*shadowNode)->getProps(),
-                        RawProps(rawProps));
+                        props,
+                        RawProps(nativePropsUpdate->rawProps));
+                  }
 
-                    return oldShadowNode.clone({/* .props = */ props});
+                  return oldShadowNode.clone({
+                      /* .props = */ props,
+                      /* .children = */ fragment.children,
                   });
+                });
 
-              return std::static_pointer_cast<RootShadowNode>(rootNode);
-            },
-            {/* default commit options */});
-      });
+            return std::static_pointer_cast<RootShadowNode>(rootNode);
+          },
+          {/* default commit options */});
+    });
+  }
 }
 
 void UIManager::sendAccessibilityEvent(
@@ -568,55 +730,32 @@ void UIManager::configureNextLayoutAnimation(
   }
 }
 
-static ShadowNode::Shared findShadowNodeByTagRecursively(
-    ShadowNode::Shared parentShadowNode,
-    Tag tag) {
-  if (parentShadowNode->getTag() == tag) {
-    return parentShadowNode;
+ShadowNode::Shared UIManager::findShadowNodeByTag_DEPRECATED(Tag tag) const {
+  // Every node which can be found was created by `createNode`, so the tag
+  // identifies its family and only the ancestors of the newest clone of the
+  // node need to be traversed.
+  auto family = shadowNodeFamilyIndex_.find(tag);
+  if (!family) {
+    return nullptr;
   }
 
-  for (const ShadowNode::Shared& shadowNode : parentShadowNode->getChildren()) {
-    auto result = findShadowNodeByTagRecursively(shadowNode, tag);
-    if (result) {
-      return result;
-    }
-  }
+  auto rootShadowNode = RootShadowNode::Shared{};
+  shadowTreeRegistry_.visit(
+      family->getSurfaceId(), [&](const ShadowTree& shadowTree) {
+        rootShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
+      });
 
-  return nullptr;
-}
+  if (!rootShadowNode) {
+    return nullptr;
+  }
 
-ShadowNode::Shared UIManager::findShadowNodeByTag_DEPRECATED(Tag tag) const {
-  auto shadowNode = ShadowNode::Shared{};
-
-  shadowTreeRegistry_.enumerate([&](const ShadowTree& shadowTree, bool& stop) {
-    RootShadowNode const* rootShadowNode;
-    // The public interface of `ShadowTree` discourages accessing a stored
-    // pointer to a root node because of the possible data race.
-    // To work around this, we ask for a commit and immediately cancel it
-    // returning `nullptr` instead of a new shadow tree.
-    // We don't want to add a way to access a stored pointer to a root node
-    // because this `findShadowNodeByTag` is deprecated. It is only added
-    // to make migration to the new architecture easier.
-    shadowTree.tryCommit(
-        [&](RootShadowNode const& oldRootShadowNode) {
-          rootShadowNode = &oldRootShadowNode;
-          return nullptr;
-        },
-        {/* default commit options */});
-
-    if (rootShadowNode != nullptr) {
-      auto const& children = rootShadowNode->getChildren();
-      if (!children.empty()) {
-        auto const& child = children.front();
-        shadowNode = findShadowNodeByTagRecursively(child, tag);
-        if (shadowNode) {
-          stop = true;
-        }
-      }
-    }
-  });
+  auto ancestors = family->getAncestors(*rootShadowNode);
+  if (ancestors.empty()) {
+    return nullptr;
+  }
 
-  return shadowNode;
+  auto& [parentNode, childIndex] = ancestors.back();
+  return parentNode.get().getChildren().at(childIndex);
 }
 
 void UIManager::setComponentDescriptorRegistry(
@@ -646,6 +785,63 @@ const ShadowTreeRegistry& UIManager::getShadowTreeRegistry() const {
   return shadowTreeRegistry_;
 }
 
+/*
+ * Counts the nodes of the tree and approximates the memory they retain. Props
+ * and state are not accounted for, except for the props of views.
+ */
+static void measureShadowTree(
+    const ShadowNode& shadowNode,
+    int& numberOfShadowNodes,
+    int64_t& retainedBytes) {
+  const auto& children = shadowNode.getChildren();
+  numberOfShadowNodes++;
+  retainedBytes += shadowNode.getTraits().check(ShadowNodeTraits::ViewKind)
+      ? sizeof(YogaLayoutableShadowNode) + sizeof(ViewProps)
+      : sizeof(ShadowNode);
+  retainedBytes += children.capacity() * sizeof(ShadowNode::Shared);
+  for (const auto& child : children) {
+    measureShadowTree(*child, numberOfShadowNodes, retainedBytes);
+  }
+}
+
+std::optional<SurfaceTelemetry> UIManager::getSurfaceTelemetry(
+    SurfaceId surfaceId) const {
+  auto surfaceTelemetry = std::optional<SurfaceTelemetry>{};
+  auto rootShadowNode = RootShadowNode::Shared{};
+  shadowTreeRegistry_.visit(surfaceId, [&](const ShadowTree& shadowTree) {
+    surfaceTelemetry = shadowTree.getMountingCoordinator()
+                           ->getTelemetryController()
+                           .getSurfaceTelemetry();
+    rootShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
+  });
+
+  if (surfaceTelemetry && rootShadowNode) {
+    auto numberOfShadowNodes = 0;
+    auto retainedBytes = int64_t{0};
+    measureShadowTree(*rootShadowNode, numberOfShadowNodes, retainedBytes);
+    surfaceTelemetry->setShadowTreeSize(numberOfShadowNodes, retainedBytes);
+  }
+
+  return surfaceTelemetry;
+}
+
+bool UIManager::writeSurfaceSnapshot(SurfaceId surfaceId, int fileDescriptor)
+    const {
+  SystraceSection s("UIManager::writeSurfaceSnapshot");
+
+  auto revision = std::optional<ShadowTreeRevision>{};
+  shadowTreeRegistry_.visit(surfaceId, [&](const ShadowTree& shadowTree) {
+    revision = shadowTree.getCurrentRevision();
+  });
+
+  if (!revision) {
+    return false;
+  }
+
+  // The revision is immutable, so it's written without holding the registry.
+  return writeShadowTreeSnapshot(surfaceId, *revision, fileDescriptor);
+}
+
 void UIManager::registerCommitHook(UIManagerCommitHook& commitHook) {
   std::unique_lock lock(commitHookMutex_);
   react_native_assert(
@@ -689,10 +885,22 @@ RootShadowNode::Unshared UIManager::shadowTreeWillCommit(
 
   std::shared_lock lock(commitHookMutex_);
 
-  auto resultRootShadowNode = newRootShadowNode;
+  auto* telemetry = TransactionTelemetry::threadLocalTelemetry();
+
+  // Props overridden since the last commit become a part of the new tree.
+  auto resultRootShadowNode =
+      animatedPropsOverlay_->foldOverrides(newRootShadowNode);
   for (auto* commitHook : commitHooks_) {
+    const auto* hookName = commitHook->getName();
+    SystraceSection s2(
+        "UIManagerCommitHook::shadowTreeWillCommit", "hook", hookName);
+    auto startTime = telemetryTimePointNow();
     resultRootShadowNode = commitHook->shadowTreeWillCommit(
         shadowTree, oldRootShadowNode, resultRootShadowNode);
+    if (telemetry != nullptr) {
+      telemetry->didRunCommitHook(
+          hookName, telemetryTimePointNow() - startTime);
+    }
   }
 
   return resultRootShadowNode;
@@ -715,11 +923,17 @@ void UIManager::reportMount(SurfaceId surfaceId) const {
   auto time = JSExecutor::performanceNow();
 
   auto rootShadowNode = RootShadowNode::Shared{};
+  auto mountingCoordinator = MountingCoordinator::Shared{};
   shadowTreeRegistry_.visit(surfaceId, [&](const ShadowTree& shadowTree) {
-    rootShadowNode =
-        shadowTree.getMountingCoordinator()->getBaseRevision().rootShadowNode;
+    mountingCoordinator = shadowTree.getMountingCoordinator();
+    rootShadowNode = mountingCoordinator->getBaseRevision().rootShadowNode;
   });
 
+  if (mountingCoordinator && mountingCoordinator->didMountTransactions()) {
+    // Revisions committed while the platform was mounting were held back.
+    shadowTreeDidFinishTransaction(mountingCoordinator, false);
+  }
+
   if (!rootShadowNode) {
     return;
   }
@@ -727,8 +941,16 @@ void UIManager::reportMount(SurfaceId surfaceId) const {
   {
     std::shared_lock lock(mountHookMutex_);
 
+    const auto& telemetryController =
+        mountingCoordinator->getTelemetryController();
     for (auto* mountHook : mountHooks_) {
+      const auto* hookName = mountHook->getName();
+      SystraceSection s2(
+          "UIManagerMountHook::shadowTreeDidMount", "hook", hookName);
+      auto startTime = telemetryTimePointNow();
       mountHook->shadowTreeDidMount(rootShadowNode, time);
+      telemetryController.didRunMountHook(
+          hookName, telemetryTimePointNow() - startTime);
     }
   }
 }
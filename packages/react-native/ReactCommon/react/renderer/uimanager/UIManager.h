@@ -23,12 +23,16 @@
 #include <react/renderer/mounting/ShadowTreeDelegate.h>
 #include <react/renderer/mounting/ShadowTreeRegistry.h>
 #include <react/renderer/uimanager/UIManagerAnimationDelegate.h>
+#include <react/renderer/uimanager/RelativeLayoutMetricsCache.h>
+#include <react/renderer/uimanager/ShadowNodeFamilyIndex.h>
+#include <react/renderer/uimanager/SurfaceCompletionQueue.h>
 #include <react/renderer/uimanager/UIManagerDelegate.h>
 #include <react/renderer/uimanager/primitives.h>
 #include <react/utils/ContextContainer.h>
 
 namespace facebook::react {
 
+class AnimatedPropsOverlay;
 class UIManagerBinding;
 class UIManagerCommitHook;
 class UIManagerMountHook;
@@ -179,6 +183,11 @@ class UIManager final : public ShadowTreeDelegate {
    */
   void updateState(const StateUpdate& stateUpdate) const;
 
+  /*
+   * Applies given state updates, performing one commit per surface.
+   */
+  void updateStates(const std::vector<StateUpdate>& stateUpdates) const;
+
   void dispatchCommand(
       const ShadowNode::Shared& shadowNode,
       const std::string& commandName,
@@ -188,6 +197,20 @@ class UIManager final : public ShadowTreeDelegate {
       const ShadowNode::Shared& shadowNode,
       RawProps rawProps) const;
 
+  struct NativePropsUpdate {
+    ShadowNode::Shared shadowNode;
+    RawProps rawProps;
+  };
+
+  /*
+   * Applies given native props updates, performing one commit per surface.
+   * With `CoreFeatures::enableAnimatedPropsOverlay`, updates of props which
+   * only change how views are drawn are mounted without a commit instead
+   * (see `AnimatedPropsOverlay`).
+   */
+  void setNativeProps_DEPRECATED(
+      const std::vector<NativePropsUpdate>& nativePropsUpdates) const;
+
   void sendAccessibilityEvent(
       const ShadowNode::Shared& shadowNode,
       const std::string& eventType);
@@ -202,6 +225,21 @@ class UIManager final : public ShadowTreeDelegate {
 
   const ShadowTreeRegistry& getShadowTreeRegistry() const;
 
+  /*
+   * Returns telemetry aggregated over the mounted transactions of the surface
+   * with given `surfaceId`, or an empty optional if the surface isn't running.
+   */
+  std::optional<SurfaceTelemetry> getSurfaceTelemetry(
+      SurfaceId surfaceId) const;
+
+  /*
+   * Writes a snapshot of the current revision of the shadow tree of the
+   * surface with given `surfaceId` to `fileDescriptor`, e.g. for memory
+   * warning reports (see `writeShadowTreeSnapshot`). Returns `false` if the
+   * surface isn't running or writing failed.
+   */
+  bool writeSurfaceSnapshot(SurfaceId surfaceId, int fileDescriptor) const;
+
   void reportMount(SurfaceId surfaceId) const;
 
   bool hasBackgroundExecutor() const {
@@ -229,7 +267,10 @@ class UIManager final : public ShadowTreeDelegate {
   const RuntimeExecutor runtimeExecutor_{};
   ShadowTreeRegistry shadowTreeRegistry_{};
   const BackgroundExecutor backgroundExecutor_{};
+  // Exists iff `backgroundExecutor_` does; used by `completeRoot`.
+  const std::shared_ptr<SurfaceCompletionQueue> surfaceCompletionQueue_;
   ContextContainer::Shared contextContainer_;
+  const std::shared_ptr<AnimatedPropsOverlay> animatedPropsOverlay_;
 
   mutable std::shared_mutex commitHookMutex_;
   mutable std::vector<UIManagerCommitHook*> commitHooks_;
@@ -237,6 +278,10 @@ class UIManager final : public ShadowTreeDelegate {
   mutable std::shared_mutex mountHookMutex_;
   mutable std::vector<UIManagerMountHook*> mountHooks_;
 
+  mutable RelativeLayoutMetricsCache relativeLayoutMetricsCache_;
+
+  mutable ShadowNodeFamilyIndex shadowNodeFamilyIndex_;
+
   std::unique_ptr<LeakChecker> leakChecker_;
 };
 
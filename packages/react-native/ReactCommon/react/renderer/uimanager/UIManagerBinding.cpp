@@ -16,6 +16,7 @@
 #include <react/renderer/runtimescheduler/RuntimeSchedulerBinding.h>
 #include <react/renderer/uimanager/primitives.h>
 
+#include <algorithm>
 #include <utility>
 
 #include "bindingUtils.h"
@@ -161,6 +162,12 @@ void UIManagerBinding::dispatchEventToJS(
     LOG(WARNING) << "instanceHandle is null, event will be dropped";
   }
 
+  if (batchedEventHandler_) {
+    eventBatch_.push_back(
+        {std::move(instanceHandle), type, std::move(payload), priority});
+    return;
+  }
+
   currentEventPriority_ = priority;
   if (eventHandler_) {
     eventHandler_->call(
@@ -172,6 +179,46 @@ void UIManagerBinding::dispatchEventToJS(
   currentEventPriority_ = ReactEventPriority::Default;
 }
 
+void UIManagerBinding::flushEventBatch(jsi::Runtime& runtime) const {
+  if (eventBatch_.empty()) {
+    return;
+  }
+
+  SystraceSection s(
+      "UIManagerBinding::flushEventBatch",
+      "numberOfEvents",
+      eventBatch_.size());
+
+  auto eventBatch = std::move(eventBatch_);
+  eventBatch_.clear();
+
+  // The handler receives a flat array of (instanceHandle, type, payload)
+  // triples; events of different priorities go to separate calls, so
+  // `unstable_getCurrentEventPriority` stays accurate while they dispatch.
+  auto begin = eventBatch.begin();
+  while (begin != eventBatch.end()) {
+    auto end = std::find_if(begin, eventBatch.end(), [&](const auto& event) {
+      return event.priority != begin->priority;
+    });
+
+    auto events =
+        jsi::Array(runtime, static_cast<size_t>(end - begin) * 3);
+    auto index = size_t{0};
+    for (auto it = begin; it != end; ++it) {
+      events.setValueAtIndex(runtime, index++, std::move(it->instanceHandle));
+      events.setValueAtIndex(
+          runtime, index++, jsi::String::createFromUtf8(runtime, it->type));
+      events.setValueAtIndex(runtime, index++, std::move(it->payload));
+    }
+
+    currentEventPriority_ = begin->priority;
+    batchedEventHandler_->call(runtime, std::move(events));
+    currentEventPriority_ = ReactEventPriority::Default;
+
+    begin = end;
+  }
+}
+
 void UIManagerBinding::invalidate() const {
   uiManager_->setDelegate(nullptr);
 }
@@ -189,6 +236,14 @@ static void validateArgumentCount(
   }
 }
 
+// Opcodes of the instruction stream of `unstable_createNodes`, mirrored by
+// `FabricUIManager.js`.
+// Operands: reactTag, viewName, props, instanceHandle.
+static constexpr int kCreateNodeInstruction = 0;
+// Operands: index of the parent among created nodes, child (an index among
+// created nodes or an existing node).
+static constexpr int kAppendChildInstruction = 1;
+
 jsi::Value UIManagerBinding::get(
     jsi::Runtime& runtime,
     const jsi::PropNameID& name) {
@@ -441,6 +496,94 @@ jsi::Value UIManagerBinding::get(
         });
   }
 
+  // Semantic: Creates nodes and appends children to them as described by a
+  // flat instruction stream, so that a whole subtree is built with a single
+  // call. Returns the created nodes in the order of creation.
+  if (methodName == "unstable_createNodes") {
+    auto paramCount = 2;
+    return jsi::Function::createFromHostFunction(
+        runtime,
+        name,
+        paramCount,
+        [uiManager, methodName, paramCount](
+            jsi::Runtime& runtime,
+            const jsi::Value& /*thisValue*/,
+            const jsi::Value* arguments,
+            size_t count) -> jsi::Value {
+          validateArgumentCount(runtime, methodName, paramCount, count);
+
+          auto surfaceId = surfaceIdFromValue(runtime, arguments[0]);
+          auto instructions = arguments[1].asObject(runtime).asArray(runtime);
+          auto length = instructions.length(runtime);
+
+          auto position = size_t{0};
+          auto nextOperand = [&]() {
+            if (position >= length) {
+              throw jsi::JSError(
+                  runtime, methodName + ": unexpected end of instructions");
+            }
+            return instructions.getValueAtIndex(runtime, position++);
+          };
+
+          auto shadowNodes = std::vector<ShadowNode::Shared>{};
+          auto createdShadowNodeAt =
+              [&](const jsi::Value& value) -> const ShadowNode::Shared& {
+            auto index = static_cast<size_t>(value.asNumber());
+            if (index >= shadowNodes.size()) {
+              throw jsi::JSError(
+                  runtime, methodName + ": invalid index of a created node");
+            }
+            return shadowNodes[index];
+          };
+
+          try {
+            while (position < length) {
+              auto opcode = static_cast<int>(nextOperand().asNumber());
+
+              if (opcode == kCreateNodeInstruction) {
+                auto tagValue = nextOperand();
+                auto viewName = stringFromValue(runtime, nextOperand());
+                auto propsValue = nextOperand();
+                auto instanceHandle =
+                    instanceHandleFromValue(runtime, nextOperand(), tagValue);
+                if (!instanceHandle) {
+                  react_native_assert(false);
+                  return jsi::Value::undefined();
+                }
+
+                shadowNodes.push_back(uiManager->createNode(
+                    tagFromValue(tagValue),
+                    viewName,
+                    surfaceId,
+                    RawProps(runtime, propsValue),
+                    std::move(instanceHandle)));
+              } else if (opcode == kAppendChildInstruction) {
+                auto parentShadowNode = createdShadowNodeAt(nextOperand());
+                auto childValue = nextOperand();
+                auto childShadowNode = childValue.isNumber()
+                    ? createdShadowNodeAt(childValue)
+                    : shadowNodeFromValue(runtime, childValue);
+
+                uiManager->appendChild(parentShadowNode, childShadowNode);
+              } else {
+                throw jsi::JSError(
+                    runtime,
+                    methodName + ": unknown opcode " + std::to_string(opcode));
+              }
+            }
+          } catch (const std::logic_error& ex) {
+            LOG(FATAL) << "logic_error in unstable_createNodes: " << ex.what();
+          }
+
+          auto result = jsi::Array(runtime, shadowNodes.size());
+          for (size_t i = 0; i < shadowNodes.size(); i++) {
+            result.setValueAtIndex(
+                runtime, i, valueFromShadowNode(runtime, shadowNodes[i]));
+          }
+          return result;
+        });
+  }
+
   // TODO: remove when passChildrenWhenCloningPersistedNodes is rolled out
   if (methodName == "createChildSet") {
     return jsi::Function::createFromHostFunction(
@@ -453,7 +596,7 @@ jsi::Value UIManagerBinding::get(
            size_t /*count*/) -> jsi::Value {
           auto shadowNodeList = std::make_shared<ShadowNode::ListOfShared>(
               ShadowNode::ListOfShared({}));
-          return valueFromShadowNodeList(runtime, shadowNodeList);
+          return valueFromShadowNodeList(runtime, std::move(shadowNodeList));
         });
   }
 
@@ -512,22 +655,13 @@ jsi::Value UIManagerBinding::get(
           } else {
             auto weakShadowNodeList =
                 weakShadowNodeListFromValue(runtime, arguments[1]);
-            static std::atomic_uint_fast8_t completeRootEventCounter{0};
-            static std::atomic_uint_fast32_t mostRecentSurfaceId{0};
-            completeRootEventCounter += 1;
-            mostRecentSurfaceId = surfaceId;
-            uiManager->backgroundExecutor_(
-                [weakUIManager,
-                 weakShadowNodeList,
-                 surfaceId,
-                 eventCount = completeRootEventCounter.load()] {
-                  auto shouldYield = [=]() -> bool {
-                    // If `completeRootEventCounter` was incremented, another
-                    // `completeSurface` call has been scheduled and current
-                    // `completeSurface` should yield to it.
-                    return completeRootEventCounter > eventCount &&
-                        mostRecentSurfaceId == surfaceId;
-                  };
+            // Completions of the surface run in order on the background
+            // executor; one which is superseded by a later `completeRoot`
+            // of the same surface yields to it.
+            uiManager->surfaceCompletionQueue_->schedule(
+                surfaceId,
+                [weakUIManager, weakShadowNodeList, surfaceId](
+                    const SurfaceCompletionQueue::ShouldYield& shouldYield) {
                   auto shadowNodeList =
                       shadowNodeListFromWeakList(weakShadowNodeList);
                   auto strongUIManager = weakUIManager.lock();
@@ -546,6 +680,27 @@ jsi::Value UIManagerBinding::get(
         });
   }
 
+  if (methodName == "unstable_registerBatchedEventHandler") {
+    auto paramCount = 1;
+    return jsi::Function::createFromHostFunction(
+        runtime,
+        name,
+        paramCount,
+        [this, methodName, paramCount](
+            jsi::Runtime& runtime,
+            const jsi::Value& /*thisValue*/,
+            const jsi::Value* arguments,
+            size_t count) -> jsi::Value {
+          validateArgumentCount(runtime, methodName, paramCount, count);
+
+          auto batchedEventHandler =
+              arguments[0].getObject(runtime).getFunction(runtime);
+          batchedEventHandler_ =
+              std::make_unique<jsi::Function>(std::move(batchedEventHandler));
+          return jsi::Value::undefined();
+        });
+  }
+
   if (methodName == "registerEventHandler") {
     auto paramCount = 1;
     return jsi::Function::createFromHostFunction(
@@ -852,6 +1007,33 @@ jsi::Value UIManagerBinding::get(
         });
   }
 
+  if (methodName == "unstable_getSurfaceTelemetry") {
+    // unstable_getSurfaceTelemetry(surfaceId: number): ?{...}
+    // Returns totals and p50/p90/p99 of recent per-transaction metrics of the
+    // surface, or `null` if the surface isn't running.
+    auto paramCount = 1;
+    return jsi::Function::createFromHostFunction(
+        runtime,
+        name,
+        paramCount,
+        [uiManager, methodName, paramCount](
+            jsi::Runtime& runtime,
+            const jsi::Value& /*thisValue*/,
+            const jsi::Value* arguments,
+            size_t count) -> jsi::Value {
+          validateArgumentCount(runtime, methodName, paramCount, count);
+
+          auto surfaceTelemetry = uiManager->getSurfaceTelemetry(
+              surfaceIdFromValue(runtime, arguments[0]));
+
+          if (!surfaceTelemetry) {
+            return jsi::Value::null();
+          }
+
+          return jsi::valueFromDynamic(runtime, toDynamic(*surfaceTelemetry));
+        });
+  }
+
   /**
    * DOM traversal and layout APIs
    */
@@ -976,7 +1158,8 @@ jsi::Value UIManagerBinding::get(
             return jsi::Array(runtime, 0);
           }
 
-          auto childShadowNodes = newestCloneOfShadowNode->getChildren();
+          const auto& childShadowNodes =
+              newestCloneOfShadowNode->getChildren();
           return getArrayOfInstanceHandlesFromShadowNodes(
               childShadowNodes, runtime);
         });
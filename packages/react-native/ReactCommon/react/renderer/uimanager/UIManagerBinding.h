@@ -7,6 +7,9 @@
 
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include <folly/dynamic.h>
 #include <jsi/jsi.h>
 #include <react/renderer/core/RawValue.h>
@@ -55,6 +58,14 @@ class UIManagerBinding : public jsi::HostObject {
       ReactEventPriority priority,
       const EventPayload& payload) const;
 
+  /*
+   * Delivers the events buffered by `dispatchEvent` since the last call to
+   * the batched event handler (if JavaScript registered one), with one call
+   * per run of events of the same priority.
+   * Thread synchronization must be enforced externally.
+   */
+  void flushEventBatch(jsi::Runtime& runtime) const;
+
   /*
    * Invalidates the binding and underlying UIManager.
    * Allows to save some resources and prevents UIManager's delegate to be
@@ -83,8 +94,20 @@ class UIManagerBinding : public jsi::HostObject {
       ReactEventPriority priority,
       const EventPayload& payload) const;
 
+  /*
+   * Event waiting in `eventBatch_` for `flushEventBatch`.
+   */
+  struct BatchedEvent {
+    jsi::Value instanceHandle;
+    std::string type;
+    jsi::Value payload;
+    ReactEventPriority priority;
+  };
+
   std::shared_ptr<UIManager> uiManager_;
   std::unique_ptr<jsi::Function> eventHandler_;
+  std::unique_ptr<jsi::Function> batchedEventHandler_;
+  mutable std::vector<BatchedEvent> eventBatch_;
   mutable PointerEventsProcessor pointerEventsProcessor_;
   mutable ReactEventPriority currentEventPriority_;
 };
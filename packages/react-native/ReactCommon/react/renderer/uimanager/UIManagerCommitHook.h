@@ -9,6 +9,8 @@
 
 #include <react/renderer/components/root/RootShadowNode.h>
 
+#include <typeinfo>
+
 namespace facebook::react {
 
 class ShadowTree;
@@ -36,6 +38,14 @@ class UIManagerCommitHook {
       const RootShadowNode::Shared& oldRootShadowNode,
       const RootShadowNode::Unshared& newRootShadowNode) noexcept = 0;
 
+  /*
+   * Identifies the hook in telemetry and traces; defaults to the (possibly
+   * mangled) name of the dynamic type.
+   */
+  virtual const char* getName() const noexcept {
+    return typeid(*this).name();
+  }
+
   virtual ~UIManagerCommitHook() noexcept = default;
 };
 
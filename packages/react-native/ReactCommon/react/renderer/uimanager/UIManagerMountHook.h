@@ -10,6 +10,8 @@
 #include <react/renderer/components/root/RootShadowNode.h>
 #include "UIManager.h"
 
+#include <typeinfo>
+
 namespace facebook::react {
 
 class ShadowTree;
@@ -28,6 +30,14 @@ class UIManagerMountHook {
       const RootShadowNode::Shared& rootShadowNode,
       double mountTime) noexcept = 0;
 
+  /*
+   * Identifies the hook in telemetry and traces; defaults to the (possibly
+   * mangled) name of the dynamic type.
+   */
+  virtual const char* getName() const noexcept {
+    return typeid(*this).name();
+  }
+
   virtual ~UIManagerMountHook() noexcept = default;
 };
 
@@ -99,12 +99,13 @@ inline static jsi::Value valueFromShadowNodeList(
 inline static ShadowNode::UnsharedListOfShared shadowNodeListFromWeakList(
     const ShadowNode::UnsharedListOfWeak& weakShadowNodeList) {
   auto result = std::make_shared<ShadowNode::ListOfShared>();
+  result->reserve(weakShadowNodeList->size());
   for (const auto& weakShadowNode : *weakShadowNodeList) {
     auto sharedShadowNode = weakShadowNode.lock();
     if (!sharedShadowNode) {
       return nullptr;
     }
-    result->push_back(sharedShadowNode);
+    result->push_back(std::move(sharedShadowNode));
   }
   return result;
 }
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/uimanager/AnimatedPropsOverlay.h>
+
+namespace facebook::react {
+
+class AnimatedPropsOverlayTest : public ::testing::Test {
+ protected:
+  ComponentBuilder builder_;
+  std::shared_ptr<RootShadowNode> rootShadowNode_;
+  std::shared_ptr<ViewShadowNode> viewShadowNode_;
+  std::shared_ptr<ViewShadowNode> flattenedShadowNode_;
+  ContextContainer contextContainer_{};
+  AnimatedPropsOverlay overlay_{};
+
+  AnimatedPropsOverlayTest() : builder_(simpleComponentBuilder()) {
+    // clang-format off
+    auto element =
+        Element<RootShadowNode>()
+          .reference(rootShadowNode_)
+          .tag(1)
+          .children({
+            Element<ViewShadowNode>()
+              .reference(viewShadowNode_)
+              .tag(2)
+              .props([] {
+                auto props = std::make_shared<ViewShadowNodeProps>();
+                props->collapsable = false;
+                return props;
+              }),
+            Element<ViewShadowNode>()
+              .reference(flattenedShadowNode_)
+              .tag(3)
+          });
+    // clang-format on
+
+    builder_.build(element);
+  }
+
+  AnimatedPropsOverlay::PropsCloner setOpacity_(
+      const ShadowNode& shadowNode,
+      Float opacity) {
+    return [&, opacity](const Props::Shared& props) {
+      auto parserContext = PropsParserContext{-1, contextContainer_};
+      return shadowNode.getComponentDescriptor().cloneProps(
+          parserContext,
+          props,
+          RawProps(folly::dynamic::object("opacity", opacity)));
+    };
+  }
+
+  std::optional<MountingTransaction> pullTransaction_() {
+    return overlay_.pullTransaction(
+        rootShadowNode_->getSurfaceId(), 1, TransactionTelemetry{}, {});
+  }
+
+  static Float opacityOf(const Props::Shared& props) {
+    return static_cast<const ViewProps&>(*props).opacity;
+  }
+};
+
+TEST_F(AnimatedPropsOverlayTest, onlyPropsNotAffectingLayoutCanBeOverridden) {
+  EXPECT_TRUE(AnimatedPropsOverlay::canOverrideProps(
+      folly::dynamic::object("opacity", 0.5)("backgroundColor", 0xff0000)));
+  EXPECT_FALSE(AnimatedPropsOverlay::canOverrideProps(
+      folly::dynamic::object("opacity", 0.5)("width", 100)));
+  EXPECT_FALSE(
+      AnimatedPropsOverlay::canOverrideProps(folly::dynamic::object()));
+}
+
+TEST_F(AnimatedPropsOverlayTest, overriddenPropsAreMountedWithoutCommit) {
+  EXPECT_FALSE(overlay_.shouldOverridePullTransaction());
+
+  EXPECT_TRUE(overlay_.overrideProps(
+      *rootShadowNode_,
+      viewShadowNode_->getFamily(),
+      setOpacity_(*viewShadowNode_, 0.5)));
+  EXPECT_TRUE(overlay_.overrideProps(
+      *rootShadowNode_,
+      viewShadowNode_->getFamily(),
+      setOpacity_(*viewShadowNode_, 0.25)));
+  EXPECT_TRUE(overlay_.shouldOverridePullTransaction());
+
+  // Both updates are mounted at once.
+  auto transaction = pullTransaction_();
+  ASSERT_TRUE(transaction.has_value());
+  ASSERT_EQ(transaction->getMutations().size(), 1);
+  const auto& mutation = transaction->getMutations()[0];
+  EXPECT_EQ(mutation.type, ShadowViewMutation::Update);
+  EXPECT_EQ(mutation.newChildShadowView.tag, 2);
+  EXPECT_EQ(opacityOf(mutation.oldChildShadowView.props), 1.0);
+  EXPECT_EQ(opacityOf(mutation.newChildShadowView.props), 0.25);
+
+  EXPECT_FALSE(overlay_.shouldOverridePullTransaction());
+  EXPECT_FALSE(pullTransaction_().has_value());
+
+  // The next update is based on the mounted one.
+  overlay_.overrideProps(
+      *rootShadowNode_,
+      viewShadowNode_->getFamily(),
+      setOpacity_(*viewShadowNode_, 0.75));
+  transaction = pullTransaction_();
+  ASSERT_TRUE(transaction.has_value());
+  EXPECT_EQ(
+      opacityOf(transaction->getMutations()[0].oldChildShadowView.props),
+      0.25);
+}
+
+TEST_F(AnimatedPropsOverlayTest, propsOfFlattenedNodesAreNotOverridden) {
+  EXPECT_FALSE(overlay_.overrideProps(
+      *rootShadowNode_,
+      flattenedShadowNode_->getFamily(),
+      setOpacity_(*flattenedShadowNode_, 0.5)));
+  EXPECT_FALSE(overlay_.shouldOverridePullTransaction());
+}
+
+TEST_F(AnimatedPropsOverlayTest, overriddenPropsAreFoldedIntoNextCommit) {
+  overlay_.overrideProps(
+      *rootShadowNode_,
+      viewShadowNode_->getFamily(),
+      setOpacity_(*viewShadowNode_, 0.5));
+
+  auto committedRootShadowNode = overlay_.foldOverrides(rootShadowNode_);
+  ASSERT_NE(committedRootShadowNode, rootShadowNode_);
+  const auto& committedShadowNode =
+      committedRootShadowNode->getChildren().at(0);
+  EXPECT_EQ(opacityOf(committedShadowNode->getProps()), 0.5);
+  EXPECT_EQ(opacityOf(viewShadowNode_->getProps()), 1.0);
+
+  // A failed commit is retried with the same overrides.
+  EXPECT_NE(overlay_.foldOverrides(rootShadowNode_), rootShadowNode_);
+
+  // Once the node is replaced, there is nothing left to fold.
+  EXPECT_EQ(
+      overlay_.foldOverrides(committedRootShadowNode), committedRootShadowNode);
+  EXPECT_FALSE(overlay_.shouldOverridePullTransaction());
+
+  // Further updates are based on the committed node.
+  overlay_.overrideProps(
+      *committedRootShadowNode,
+      viewShadowNode_->getFamily(),
+      setOpacity_(*viewShadowNode_, 0.25));
+  auto transaction = pullTransaction_();
+  ASSERT_TRUE(transaction.has_value());
+  EXPECT_EQ(
+      opacityOf(transaction->getMutations()[0].oldChildShadowView.props), 0.5);
+}
+
+TEST_F(AnimatedPropsOverlayTest, overridesOfStoppedSurfacesAreDropped) {
+  overlay_.overrideProps(
+      *rootShadowNode_,
+      viewShadowNode_->getFamily(),
+      setOpacity_(*viewShadowNode_, 0.5));
+
+  overlay_.stopSurface(rootShadowNode_->getSurfaceId());
+
+  EXPECT_FALSE(overlay_.shouldOverridePullTransaction());
+  EXPECT_EQ(overlay_.foldOverrides(rootShadowNode_), rootShadowNode_);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/config/ReactNativeConfig.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/renderer/uimanager/CommitCapture.h>
+#include <react/utils/CoreFeatures.h>
+
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <unistd.h>
+
+namespace facebook::react {
+
+class CommitCaptureTest : public ::testing::Test {
+ protected:
+  CommitCaptureTest()
+      : contextContainer_(std::make_shared<ContextContainer>()),
+        parserContext_(SurfaceId{1}, *contextContainer_) {
+    CoreFeatures::enableCommitCapture = true;
+
+    contextContainer_->insert(
+        "ReactNativeConfig", std::make_shared<EmptyReactNativeConfig>());
+    auto parameters = ComponentDescriptorParameters{
+        EventDispatcher::Shared{}, contextContainer_, nullptr};
+    viewComponentDescriptor_ =
+        std::make_unique<ViewComponentDescriptor>(parameters);
+    rootComponentDescriptor_ =
+        std::make_unique<RootComponentDescriptor>(parameters);
+  }
+
+  ~CommitCaptureTest() override {
+    CoreFeatures::enableCommitCapture = false;
+  }
+
+  ShadowNode::Shared viewNode(
+      Tag tag,
+      folly::dynamic rawProps,
+      ShadowNode::ListOfShared children = {}) {
+    auto props = viewComponentDescriptor_->cloneProps(
+        parserContext_, nullptr, RawProps(std::move(rawProps)));
+    auto family = viewComponentDescriptor_->createFamily(
+        ShadowNodeFamilyFragment{tag, SurfaceId{1}, nullptr});
+    return viewComponentDescriptor_->createShadowNode(
+        ShadowNodeFragment{
+            props,
+            std::make_shared<const ShadowNode::ListOfShared>(
+                std::move(children))},
+        family);
+  }
+
+  RootShadowNode::Unshared rootNode(ShadowNode::ListOfShared children) {
+    auto family = rootComponentDescriptor_->createFamily(
+        ShadowNodeFamilyFragment{Tag{1}, SurfaceId{1}, nullptr});
+    auto rootShadowNode = std::static_pointer_cast<const RootShadowNode>(
+        rootComponentDescriptor_->createShadowNode(
+            ShadowNodeFragment{
+                RootShadowNode::defaultSharedProps(),
+                std::make_shared<const ShadowNode::ListOfShared>(
+                    std::move(children))},
+            family));
+    return rootShadowNode->clone(
+        parserContext_,
+        LayoutConstraints{
+            {400, 0}, {400, std::numeric_limits<Float>::infinity()}},
+        LayoutContext{});
+  }
+
+  const ComponentDescriptor* lookup(const std::string& componentName) {
+    if (componentName == "RootView") {
+      return rootComponentDescriptor_.get();
+    }
+    if (componentName == "View") {
+      return viewComponentDescriptor_.get();
+    }
+    return nullptr;
+  }
+
+  ContextContainer::Shared contextContainer_;
+  PropsParserContext parserContext_;
+  std::unique_ptr<ViewComponentDescriptor> viewComponentDescriptor_;
+  std::unique_ptr<RootComponentDescriptor> rootComponentDescriptor_;
+};
+
+TEST_F(CommitCaptureTest, replaysCapturedCommit) {
+  auto nodeA = viewNode(
+      10,
+      folly::dynamic::object("width", 100)("height", 50),
+      {viewNode(11, folly::dynamic::object("height", 10))});
+  auto nodeB = viewNode(
+      12, folly::dynamic::object("height", 20)("backgroundColor", 0xff0000ff));
+  auto oldRootShadowNode = rootNode({nodeA, nodeB});
+  oldRootShadowNode->layoutIfNeeded();
+  oldRootShadowNode->sealRecursive();
+
+  // The commit changes the height of B and keeps A as it is.
+  const auto& oldNodeB = *oldRootShadowNode->getChildren()[1];
+  auto newNodeB = viewComponentDescriptor_->cloneShadowNode(
+      oldNodeB,
+      ShadowNodeFragment{viewComponentDescriptor_->cloneProps(
+          parserContext_,
+          oldNodeB.getProps(),
+          RawProps(folly::dynamic::object("height", 30)))});
+  auto newRootShadowNode = std::static_pointer_cast<RootShadowNode>(
+      oldRootShadowNode->ShadowNode::clone(ShadowNodeFragment{
+          ShadowNodeFragment::propsPlaceholder(),
+          std::make_shared<const ShadowNode::ListOfShared>(
+              ShadowNode::ListOfShared{
+                  oldRootShadowNode->getChildren()[0], newNodeB})}));
+
+  auto file = tmpfile();
+  auto fileDescriptor = fileno(file);
+  EXPECT_TRUE(writeCommitCapture(
+      captureCommit(SurfaceId{1}, *oldRootShadowNode, *newRootShadowNode),
+      fileDescriptor));
+  newRootShadowNode->layoutIfNeeded();
+  auto expectedMutations =
+      calculateShadowViewMutations(*oldRootShadowNode, *newRootShadowNode);
+
+  lseek(fileDescriptor, 0, SEEK_SET);
+  auto captures = readCommitCaptures(fileDescriptor);
+  fclose(file);
+  ASSERT_EQ(captures.size(), 1);
+
+  auto replayedCommit = replayCommit(
+      captures[0],
+      [this](const std::string& componentName) {
+        return lookup(componentName);
+      },
+      *contextContainer_);
+  EXPECT_EQ(replayedCommit.surfaceId, SurfaceId{1});
+
+  const auto& oldChildren = replayedCommit.oldRootShadowNode->getChildren();
+  ASSERT_EQ(oldChildren.size(), 2);
+  EXPECT_EQ(oldChildren[0]->getTag(), 10);
+  EXPECT_EQ(oldChildren[0]->getChildren().size(), 1);
+  EXPECT_EQ(
+      std::static_pointer_cast<const LayoutableShadowNode>(oldChildren[0])
+          ->getLayoutMetrics()
+          .frame.size,
+      (Size{100, 50}));
+
+  // A is shared with the old tree, B is cloned with new props.
+  const auto& newChildren = replayedCommit.newRootShadowNode->getChildren();
+  ASSERT_EQ(newChildren.size(), 2);
+  EXPECT_EQ(newChildren[0], oldChildren[0]);
+  EXPECT_EQ(newChildren[1]->getTag(), 12);
+  EXPECT_TRUE(newChildren[1]->sameFamily(*oldChildren[1]));
+  EXPECT_NE(newChildren[1]->getProps(), oldChildren[1]->getProps());
+
+  replayedCommit.newRootShadowNode->layoutIfNeeded();
+  EXPECT_EQ(
+      std::static_pointer_cast<const LayoutableShadowNode>(newChildren[1])
+          ->getLayoutMetrics()
+          .frame.size,
+      (Size{400, 30}));
+
+  auto mutations = calculateShadowViewMutations(
+      *replayedCommit.oldRootShadowNode, *replayedCommit.newRootShadowNode);
+  EXPECT_EQ(mutations.size(), expectedMutations.size());
+}
+
+TEST_F(CommitCaptureTest, stopsReadingAtIncompleteCapture) {
+  auto oldRootShadowNode = rootNode({});
+  auto newRootShadowNode =
+      rootNode({viewNode(10, folly::dynamic::object("width", 100))});
+
+  auto file = tmpfile();
+  auto fileDescriptor = fileno(file);
+  auto capture =
+      captureCommit(SurfaceId{1}, *oldRootShadowNode, *newRootShadowNode);
+  EXPECT_TRUE(writeCommitCapture(capture, fileDescriptor));
+  EXPECT_TRUE(writeCommitCapture(capture, fileDescriptor));
+  // The process stopped before it finished writing the second commit.
+  ASSERT_EQ(
+      ftruncate(fileDescriptor, lseek(fileDescriptor, 0, SEEK_CUR) - 1), 0);
+
+  lseek(fileDescriptor, 0, SEEK_SET);
+  EXPECT_EQ(readCommitCaptures(fileDescriptor).size(), 1);
+  fclose(file);
+}
+
+} // namespace facebook::react
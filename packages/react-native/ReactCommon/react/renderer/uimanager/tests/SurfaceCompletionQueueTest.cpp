@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/uimanager/SurfaceCompletionQueue.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+class SurfaceCompletionQueueTest : public ::testing::Test {
+ protected:
+  SurfaceCompletionQueueTest()
+      : queue_(std::make_shared<SurfaceCompletionQueue>(
+            [this](std::function<void()>&& task) {
+              tasks_.push_back(std::move(task));
+            })) {}
+
+  // Runs tasks of the executor in the order they were scheduled.
+  void runTasks() {
+    while (!tasks_.empty()) {
+      auto task = std::move(tasks_.front());
+      tasks_.erase(tasks_.begin());
+      task();
+    }
+  }
+
+  void schedule(SurfaceId surfaceId, const std::string& name) {
+    queue_->schedule(
+        surfaceId,
+        [this, name](const SurfaceCompletionQueue::ShouldYield& shouldYield) {
+          completions_.push_back(name);
+          if (onCompletion_) {
+            auto onCompletion = std::move(onCompletion_);
+            onCompletion_ = nullptr;
+            onCompletion();
+          }
+          yields_.push_back(shouldYield());
+        });
+  }
+
+  std::shared_ptr<SurfaceCompletionQueue> queue_;
+  std::vector<std::function<void()>> tasks_;
+  std::vector<std::string> completions_;
+  std::vector<bool> yields_;
+  std::function<void()> onCompletion_;
+};
+
+TEST_F(SurfaceCompletionQueueTest, dropsSupersededCompletions) {
+  schedule(1, "a1");
+  schedule(1, "a2");
+  schedule(2, "b1");
+
+  // One task per surface.
+  EXPECT_EQ(tasks_.size(), 2);
+  runTasks();
+
+  EXPECT_EQ(completions_, (std::vector<std::string>{"a2", "b1"}));
+  EXPECT_EQ(yields_, (std::vector<bool>{false, false}));
+}
+
+TEST_F(SurfaceCompletionQueueTest, runsCompletionsOfSurfaceInOrder) {
+  schedule(1, "a1");
+  // Scheduled while `a1` runs, so `a1` yields and `a2` runs after it within
+  // the same task.
+  onCompletion_ = [this]() { schedule(1, "a2"); };
+  runTasks();
+
+  EXPECT_EQ(completions_, (std::vector<std::string>{"a1", "a2"}));
+  EXPECT_EQ(yields_, (std::vector<bool>{true, false}));
+
+  // The surface is idle again, so a new completion gets a new task.
+  schedule(1, "a3");
+  EXPECT_EQ(tasks_.size(), 1);
+  runTasks();
+  EXPECT_EQ(completions_.back(), "a3");
+}
+
+TEST_F(SurfaceCompletionQueueTest, otherSurfacesDoNotCauseYielding) {
+  schedule(1, "a1");
+  onCompletion_ = [this]() { schedule(2, "b1"); };
+  runTasks();
+
+  EXPECT_EQ(completions_, (std::vector<std::string>{"a1", "b1"}));
+  EXPECT_EQ(yields_, (std::vector<bool>{false, false}));
+}
+
+TEST_F(SurfaceCompletionQueueTest, reportsRunningCompletions) {
+  auto wasRunningCompletion = false;
+  queue_->schedule(
+      1, [&](const SurfaceCompletionQueue::ShouldYield& /*shouldYield*/) {
+        wasRunningCompletion = SurfaceCompletionQueue::isRunningCompletion();
+      });
+
+  EXPECT_FALSE(SurfaceCompletionQueue::isRunningCompletion());
+  runTasks();
+  EXPECT_TRUE(wasRunningCompletion);
+  EXPECT_FALSE(SurfaceCompletionQueue::isRunningCompletion());
+}
+
+} // namespace facebook::react
@@ -12,15 +12,27 @@
 namespace facebook::react {
 
 BufferedRuntimeExecutor::BufferedRuntimeExecutor(
-    RuntimeExecutor runtimeExecutor)
-    : runtimeExecutor_(runtimeExecutor),
+    std::shared_ptr<RuntimeScheduler> runtimeScheduler)
+    : runtimeScheduler_(std::move(runtimeScheduler)),
       isBufferingEnabled_(true),
       lastIndex_(0) {}
 
 void BufferedRuntimeExecutor::execute(Work&& callback) {
+  bufferOrSchedule(std::nullopt, std::move(callback));
+}
+
+void BufferedRuntimeExecutor::execute(
+    SchedulerPriority priority,
+    Work&& callback) {
+  bufferOrSchedule(priority, std::move(callback));
+}
+
+void BufferedRuntimeExecutor::bufferOrSchedule(
+    std::optional<SchedulerPriority> priority,
+    Work&& callback) {
   if (!isBufferingEnabled_) {
-    // Fast path: Schedule directly to RuntimeExecutor, without locking
-    runtimeExecutor_(std::move(callback));
+    // Fast path: Schedule directly to RuntimeScheduler, without locking
+    schedule(priority, std::move(callback));
     return;
   }
 
@@ -32,14 +44,17 @@ void BufferedRuntimeExecutor::execute(Work&& callback) {
   uint64_t newIndex = lastIndex_++;
   std::scoped_lock guard(lock_);
   if (isBufferingEnabled_) {
-    queue_.push({.index_ = newIndex, .work_ = std::move(callback)});
+    queue_.push(
+        {.index_ = newIndex,
+         .priority_ = priority,
+         .work_ = std::move(callback)});
     return;
   }
 
   // Force flush the queue to maintain the execution order.
   unsafeFlush();
 
-  runtimeExecutor_(std::move(callback));
+  schedule(priority, std::move(callback));
 }
 
 void BufferedRuntimeExecutor::flush() {
@@ -52,9 +67,19 @@ void BufferedRuntimeExecutor::unsafeFlush() {
   while (queue_.size() > 0) {
     const BufferedWork& bufferedWork = queue_.top();
     Work work = std::move(bufferedWork.work_);
-    runtimeExecutor_(std::move(work));
+    schedule(bufferedWork.priority_, std::move(work));
     queue_.pop();
   }
 }
 
+void BufferedRuntimeExecutor::schedule(
+    std::optional<SchedulerPriority> priority,
+    Work&& callback) {
+  if (priority) {
+    runtimeScheduler_->scheduleTask(*priority, std::move(callback));
+  } else {
+    runtimeScheduler_->scheduleWork(std::move(callback));
+  }
+}
+
 } // namespace facebook::react
@@ -7,6 +7,7 @@
 
 #include <ReactCommon/RuntimeExecutor.h>
 #include <jsi/jsi.h>
+#include <react/renderer/runtimescheduler/RuntimeScheduler.h>
 #include <atomic>
 #include <queue>
 #include "TimerManager.h"
@@ -17,29 +18,51 @@ class BufferedRuntimeExecutor {
  public:
   using Work = std::function<void(jsi::Runtime& runtime)>;
 
-  // A utility structure to track pending work in the order of when they arrive.
+  // A utility structure to track pending work in the order of their priority,
+  // and of when they arrive for work of the same priority.
   struct BufferedWork {
     uint64_t index_;
+    // Work without a priority is scheduled with `scheduleWork`, which is
+    // equivalent to `SchedulerPriority::ImmediatePriority`.
+    std::optional<SchedulerPriority> priority_;
     Work work_;
+    SchedulerPriority getPriority() const {
+      return priority_.value_or(SchedulerPriority::ImmediatePriority);
+    }
     bool operator<(const BufferedWork& rhs) const {
-      // Higher index has lower priority, so this inverted comparison puts
-      // the smaller index on top of the queue.
+      // Higher priority values and higher indices have lower priority, so
+      // these inverted comparisons put the most urgent, oldest work on top of
+      // the queue.
+      if (getPriority() != rhs.getPriority()) {
+        return getPriority() > rhs.getPriority();
+      }
       return index_ > rhs.index_;
     }
   };
 
-  BufferedRuntimeExecutor(RuntimeExecutor runtimeExecutor);
+  BufferedRuntimeExecutor(std::shared_ptr<RuntimeScheduler> runtimeScheduler);
 
   void execute(Work&& callback);
 
+  // Schedules the work through RuntimeScheduler with the given priority. Work
+  // which is buffered is flushed in priority order, so that e.g. rendering a
+  // surface doesn't wait for less urgent calls made during startup.
+  void execute(SchedulerPriority priority, Work&& callback);
+
   // Flush buffered JS calls and then diable JS buffering
   void flush();
 
  private:
+  void bufferOrSchedule(
+      std::optional<SchedulerPriority> priority,
+      Work&& callback);
+
+  void schedule(std::optional<SchedulerPriority> priority, Work&& callback);
+
   // Perform flushing without locking mechanism
   void unsafeFlush();
 
-  RuntimeExecutor runtimeExecutor_;
+  std::shared_ptr<RuntimeScheduler> runtimeScheduler_;
   bool isBufferingEnabled_;
   std::mutex lock_;
   std::atomic<uint64_t> lastIndex_;
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "JSHeapSampler.h"
+
+#include <cxxreact/SystraceSection.h>
+#include <jsi/instrumentation.h>
+#include <react/utils/CoreFeatures.h>
+
+namespace facebook::react {
+
+JSHeapSampler::JSHeapSampler(Clock::duration interval, size_t capacity)
+    : interval_(interval), capacity_(capacity == 0 ? 1 : capacity) {}
+
+void JSHeapSampler::onTaskEnd(jsi::Runtime& runtime) {
+  if (!CoreFeatures::enableJSHeapSampling) {
+    return;
+  }
+
+  auto time = Clock::now();
+  auto reason = takeSampleReason(time);
+  if (reason == nullptr) {
+    return;
+  }
+
+  SystraceSection s("JSHeapSampler::onTaskEnd");
+  // Expensive statistics (e.g. of the malloc'd memory) are skipped, so that
+  // sampling doesn't walk the heap.
+  recordSample(time, reason, runtime.instrumentation().getHeapInfo(false));
+}
+
+void JSHeapSampler::requestSample(const char* reason) {
+  requestedReason_.store(reason, std::memory_order_relaxed);
+}
+
+const char* JSHeapSampler::takeSampleReason(Clock::time_point time) {
+  if (auto reason =
+          requestedReason_.exchange(nullptr, std::memory_order_relaxed)) {
+    lastSampleTime_ = time;
+    return reason;
+  }
+  if (time - lastSampleTime_ < interval_) {
+    return nullptr;
+  }
+  lastSampleTime_ = time;
+  return "interval";
+}
+
+void JSHeapSampler::recordSample(
+    Clock::time_point time,
+    const char* reason,
+    std::unordered_map<std::string, int64_t> heapInfo) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (samples_.size() == capacity_) {
+    samples_.pop_front();
+  }
+  samples_.push_back({time, reason, std::move(heapInfo)});
+}
+
+void JSHeapSampler::recordGarbageCollection(
+    JSGarbageCollection garbageCollection) {
+  if (!CoreFeatures::enableJSHeapSampling) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (garbageCollections_.size() == capacity_) {
+    garbageCollections_.pop_front();
+  }
+  garbageCollections_.push_back(std::move(garbageCollection));
+}
+
+std::vector<JSHeapSample> JSHeapSampler::getSamples() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return {samples_.begin(), samples_.end()};
+}
+
+std::vector<JSGarbageCollection> JSHeapSampler::getGarbageCollections() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return {garbageCollections_.begin(), garbageCollections_.end()};
+}
+
+} // namespace facebook::react
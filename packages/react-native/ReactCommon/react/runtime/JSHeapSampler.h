@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * The heap statistics of a JS VM at a point in time, as reported by
+ * `jsi::Instrumentation::getHeapInfo` (e.g. `hermes_allocatedBytes`).
+ */
+struct JSHeapSample {
+  std::chrono::steady_clock::time_point time;
+  // Why the sample was taken, e.g. "interval" or "runApplication".
+  const char* reason;
+  std::unordered_map<std::string, int64_t> heapInfo;
+};
+
+/*
+ * A garbage collection reported by the JS VM.
+ */
+struct JSGarbageCollection {
+  std::chrono::steady_clock::time_point endTime;
+  std::chrono::steady_clock::duration duration;
+  std::chrono::steady_clock::duration cpuDuration;
+  // E.g. "young" or "old" for Hermes.
+  std::string kind;
+  std::string cause;
+  int64_t allocatedBytesBefore;
+  int64_t allocatedBytesAfter;
+};
+
+/*
+ * Samples the JS heap of a `ReactInstance` while it's busy, and keeps the
+ * garbage collections of its VM, so that memory regressions can be told
+ * apart from GC pauses in traces and telemetry.
+ *
+ * `jsi::Runtime` can only be used on the JS thread, so heap samples are taken
+ * at the end of JS tasks, at most once per interval: the sampler never
+ * schedules work of its own and costs a clock read per task otherwise.
+ * Disabled unless `CoreFeatures::enableJSHeapSampling` is set.
+ */
+class JSHeapSampler final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  static constexpr auto kDefaultInterval = std::chrono::seconds(1);
+  static constexpr size_t kDefaultCapacity = 300;
+
+  explicit JSHeapSampler(
+      Clock::duration interval = kDefaultInterval,
+      size_t capacity = kDefaultCapacity);
+
+  /*
+   * Must be called on the JS thread at the end of each JS task.
+   */
+  void onTaskEnd(jsi::Runtime& runtime);
+
+  /*
+   * Makes the end of the next JS task take a sample regardless of the
+   * interval, e.g. when a surface starts. `reason` must be a string literal.
+   * Can be called on any thread.
+   */
+  void requestSample(const char* reason);
+
+  /*
+   * Can be called on any thread, e.g. on the GC thread of the VM.
+   */
+  void recordGarbageCollection(JSGarbageCollection garbageCollection);
+
+  /*
+   * Returns the last samples and garbage collections, oldest first.
+   */
+  std::vector<JSHeapSample> getSamples() const;
+  std::vector<JSGarbageCollection> getGarbageCollections() const;
+
+  /*
+   * Records a sample taken at `time`. Exposed for testing; use `onTaskEnd`
+   * otherwise.
+   */
+  void recordSample(
+      Clock::time_point time,
+      const char* reason,
+      std::unordered_map<std::string, int64_t> heapInfo);
+
+  /*
+   * Returns the reason to take a sample at `time`, or `nullptr` if none is
+   * due. Exposed for testing.
+   */
+  const char* takeSampleReason(Clock::time_point time);
+
+ private:
+  const Clock::duration interval_;
+  const size_t capacity_;
+
+  // Only accessed on the JS thread.
+  Clock::time_point lastSampleTime_{};
+
+  std::atomic<const char*> requestedReason_{nullptr};
+
+  mutable std::mutex mutex_;
+  std::deque<JSHeapSample> samples_;
+  std::deque<JSGarbageCollection> garbageCollections_;
+};
+
+} // namespace facebook::react
@@ -12,8 +12,12 @@
 #include <jsi/jsi.h>
 #include <jsinspector-modern/ReactCdp.h>
 
+#include <ostream>
+
 namespace facebook::react {
 
+class JSHeapSampler;
+
 /**
  * An interface that represents an instance of a JS VM
  */
@@ -21,6 +25,36 @@ class JSRuntime : public jsinspector_modern::RuntimeTargetDelegate {
  public:
   virtual jsi::Runtime& getRuntime() noexcept = 0;
 
+  /**
+   * Reports the garbage collections of the VM to `sampler` from now on, if
+   * the VM supports it.
+   */
+  virtual void setJSHeapSampler(std::weak_ptr<JSHeapSampler> /*sampler*/) {}
+
+  /**
+   * Starts sampling the JS stacks of the VM, if it supports it. Returns
+   * whether sampling started. Must be called on the JS thread.
+   */
+  virtual bool startSamplingProfiler() {
+    return false;
+  }
+
+  /**
+   * Stops sampling started by `startSamplingProfiler`, and writes the CPU
+   * profile of the VM to `stream`. Must be called on the JS thread.
+   */
+  virtual void stopSamplingProfiler(std::ostream& /*stream*/) {}
+
+  /**
+   * Evaluates the script of a bundle. VMs may override it, e.g. to evaluate
+   * a compilation of the script cached by an earlier launch instead.
+   */
+  virtual void evaluateJavaScript(
+      const std::shared_ptr<const jsi::Buffer>& buffer,
+      const std::string& sourceURL) {
+    getRuntime().evaluateJavaScript(buffer, sourceURL);
+  }
+
   virtual ~JSRuntime() = default;
 };
 
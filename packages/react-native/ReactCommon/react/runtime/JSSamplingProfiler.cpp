@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "JSSamplingProfiler.h"
+
+#include <cxxreact/SystraceSection.h>
+#include <glog/logging.h>
+#include <react/runtime/JSRuntimeFactory.h>
+
+#include <sstream>
+
+namespace facebook::react {
+
+namespace {
+
+int64_t toMicroseconds(JSSamplingProfiler::Clock::time_point time) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             time.time_since_epoch())
+      .count();
+}
+
+} // namespace
+
+bool JSSamplingProfiler::start(
+    JSRuntime& runtime,
+    Options options,
+    ProfileCallback callback) {
+  if (isProfiling() || !runtime.startSamplingProfiler()) {
+    return false;
+  }
+
+  options_ = options;
+  callback_ = std::move(callback);
+  startTime_ = Clock::now();
+  taskStartTime_ = startTime_;
+  tasks_.clear();
+  return true;
+}
+
+void JSSamplingProfiler::stop(JSRuntime& runtime) {
+  if (!isProfiling()) {
+    return;
+  }
+
+  SystraceSection s("JSSamplingProfiler::stop");
+  auto callback = std::move(callback_);
+  callback_ = nullptr;
+
+  auto vmProfile = std::ostringstream{};
+  runtime.stopSamplingProfiler(vmProfile);
+  auto profile = buildProfile(vmProfile.str());
+  tasks_.clear();
+  callback(std::move(profile));
+}
+
+void JSSamplingProfiler::onTaskEnd(JSRuntime& runtime) {
+  if (isProfiling() && recordTask(taskStartTime_, Clock::now())) {
+    stop(runtime);
+  }
+}
+
+bool JSSamplingProfiler::recordTask(
+    Clock::time_point startTime,
+    Clock::time_point endTime) {
+  if (tasks_.size() < options_.maxTaskCount) {
+    tasks_.emplace_back(startTime, endTime);
+  }
+  return endTime - startTime_ >= options_.maxDuration;
+}
+
+std::string JSSamplingProfiler::buildProfile(
+    const std::string& vmProfile) const {
+  if (vmProfile.empty()) {
+    return {};
+  }
+
+  auto profile = std::ostringstream{};
+  profile << "{\"tasks\":[";
+  for (size_t i = 0; i < tasks_.size(); i++) {
+    profile << (i == 0 ? "[" : ",[") << toMicroseconds(tasks_[i].first) << ","
+            << toMicroseconds(tasks_[i].second) << "]";
+  }
+  profile << "],\"profile\":" << vmProfile << "}";
+
+  auto result = profile.str();
+  if (result.size() > options_.maxSize) {
+    LOG(WARNING) << "Dropping JS sampling profile of " << result.size()
+                 << " bytes, over the budget of " << options_.maxSize;
+    return {};
+  }
+  return result;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace facebook::react {
+
+class JSRuntime;
+
+/*
+ * Runs the sampling profiler of the JS VM of a `ReactInstance` on demand
+ * (e.g. when jank is detected, or for a fraction of sessions in production),
+ * within a time and size budget.
+ *
+ * The profile is the CPU profile of the VM (for Hermes, in the Chrome DevTools
+ * `.cpuprofile` format, native frames included), annotated with the JS tasks
+ * run meanwhile:
+ *
+ *   {"tasks": [[startUs, endUs], ...], "profile": {...}}
+ *
+ * Times are in microseconds of `std::chrono::steady_clock`, as in the traces
+ * of the instance.
+ *
+ * All methods must be called on the JS thread.
+ */
+class JSSamplingProfiler final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /*
+   * Receives the profile, or an empty string if the VM doesn't support
+   * sampling or the profile exceeded `Options::maxSize`. Called on the JS
+   * thread, so it should hand the profile off (e.g. to upload it).
+   */
+  using ProfileCallback = std::function<void(std::string profile)>;
+
+  struct Options {
+    // The profiler stops by itself at the end of the first task past it.
+    Clock::duration maxDuration{std::chrono::seconds(10)};
+    size_t maxSize{1 << 20};
+    size_t maxTaskCount{10000};
+  };
+
+  /*
+   * Starts profiling, unless it already is. Returns whether it started.
+   */
+  bool start(JSRuntime& runtime, Options options, ProfileCallback callback);
+
+  /*
+   * Stops profiling, and calls the callback with the profile.
+   */
+  void stop(JSRuntime& runtime);
+
+  bool isProfiling() const {
+    return callback_ != nullptr;
+  }
+
+  /*
+   * Must be called at the start and end of each JS task.
+   */
+  void onTaskStart() {
+    if (isProfiling()) {
+      taskStartTime_ = Clock::now();
+    }
+  }
+  void onTaskEnd(JSRuntime& runtime);
+
+  /*
+   * Records a task and returns whether the time budget is spent. Exposed for
+   * testing; use `onTaskStart` and `onTaskEnd` otherwise.
+   */
+  bool recordTask(Clock::time_point startTime, Clock::time_point endTime);
+
+  /*
+   * Returns the annotated profile, or an empty string if it exceeds the size
+   * budget. Exposed for testing.
+   */
+  std::string buildProfile(const std::string& vmProfile) const;
+
+ private:
+  Options options_;
+  ProfileCallback callback_;
+  Clock::time_point startTime_;
+  Clock::time_point taskStartTime_;
+  std::vector<std::pair<Clock::time_point, Clock::time_point>> tasks_;
+};
+
+} // namespace facebook::react
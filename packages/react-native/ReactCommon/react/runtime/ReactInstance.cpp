@@ -16,6 +16,7 @@
 #include <jsi/instrumentation.h>
 #include <jsireact/JSIExecutor.h>
 #include <react/featureflags/ReactNativeFeatureFlags.h>
+#include <react/renderer/debug/NativeTraceRecorder.h>
 #include <react/renderer/runtimescheduler/RuntimeSchedulerBinding.h>
 
 #include <cxxreact/ReactMarker.h>
@@ -32,6 +33,8 @@ ReactInstance::ReactInstance(
     JsErrorHandler::JsErrorHandlingFunc jsErrorHandlingFunc,
     jsinspector_modern::PageTarget* parentInspectorTarget)
     : runtime_(std::move(runtime)),
+      jsHeapSampler_(std::make_shared<JSHeapSampler>()),
+      jsSamplingProfiler_(std::make_shared<JSSamplingProfiler>()),
       jsMessageQueueThread_(jsMessageQueueThread),
       timerManager_(std::move(timerManager)),
       jsErrorHandler_(jsErrorHandlingFunc),
@@ -44,7 +47,12 @@ ReactInstance::ReactInstance(
                               std::weak_ptr<MessageQueueThread>(
                                   jsMessageQueueThread_),
                           weakHasFatalJsError =
-                              std::weak_ptr<bool>(hasFatalJsError_)](
+                              std::weak_ptr<bool>(hasFatalJsError_),
+                          weakJsHeapSampler =
+                              std::weak_ptr<JSHeapSampler>(jsHeapSampler_),
+                          weakJsSamplingProfiler =
+                              std::weak_ptr<JSSamplingProfiler>(
+                                  jsSamplingProfiler_)](
                              std::function<void(jsi::Runtime & runtime)>&&
                                  callback) {
     if (std::shared_ptr<bool> sharedHasFatalJsError =
@@ -62,10 +70,18 @@ ReactInstance::ReactInstance(
     if (std::shared_ptr<MessageQueueThread> sharedJsMessageQueueThread =
             weakJsMessageQueueThread.lock()) {
       sharedJsMessageQueueThread->runOnQueue(
-          [weakRuntime, weakTimerManager, callback = std::move(callback)]() {
+          [weakRuntime,
+           weakTimerManager,
+           weakJsHeapSampler,
+           weakJsSamplingProfiler,
+           callback = std::move(callback)]() {
             if (auto strongRuntime = weakRuntime.lock()) {
               jsi::Runtime& jsiRuntime = strongRuntime->getRuntime();
               SystraceSection s("ReactInstance::_runtimeExecutor[Callback]");
+              auto strongJsSamplingProfiler = weakJsSamplingProfiler.lock();
+              if (strongJsSamplingProfiler) {
+                strongJsSamplingProfiler->onTaskStart();
+              }
               try {
                 callback(jsiRuntime);
 
@@ -79,11 +95,20 @@ ReactInstance::ReactInstance(
               } catch (jsi::JSError& originalError) {
                 handleJSError(jsiRuntime, originalError, true);
               }
+
+              if (auto strongJsHeapSampler = weakJsHeapSampler.lock()) {
+                strongJsHeapSampler->onTaskEnd(jsiRuntime);
+              }
+              if (strongJsSamplingProfiler) {
+                strongJsSamplingProfiler->onTaskEnd(*strongRuntime);
+              }
             }
           });
     }
   };
 
+  runtime_->setJSHeapSampler(jsHeapSampler_);
+
   if (parentInspectorTarget_) {
     inspectorTarget_ = &parentInspectorTarget_->registerInstance(*this);
     runtimeInspectorTarget_ =
@@ -93,14 +118,8 @@ ReactInstance::ReactInstance(
   runtimeScheduler_ =
       std::make_shared<RuntimeScheduler>(std::move(runtimeExecutor));
 
-  auto pipedRuntimeExecutor =
-      [runtimeScheduler = runtimeScheduler_.get()](
-          std::function<void(jsi::Runtime & runtime)>&& callback) {
-        runtimeScheduler->scheduleWork(std::move(callback));
-      };
-
   bufferedRuntimeExecutor_ =
-      std::make_shared<BufferedRuntimeExecutor>(pipedRuntimeExecutor);
+      std::make_shared<BufferedRuntimeExecutor>(runtimeScheduler_);
 }
 
 void ReactInstance::unregisterFromInspector() {
@@ -113,6 +132,101 @@ void ReactInstance::unregisterFromInspector() {
   }
 }
 
+void ReactInstance::startTracing() {
+  tracingStartTime_ = std::chrono::steady_clock::now();
+  NativeTraceRecorder::getInstance().start();
+  nativeModuleCallsAtTracingStart_ =
+      NativeModuleCallStats::getInstance().getMethodCallStats();
+}
+
+jsinspector_modern::CollectedTraceEvents ReactInstance::collectTraceEvents() {
+  auto traceEvents = jsinspector_modern::CollectedTraceEvents{
+      ReactMarker::MarkerTimeline::getInstance().getTraceEvents()};
+
+  auto nativeEvents = NativeTraceRecorder::getInstance().stop(
+      &traceEvents.dataLossOccurred);
+  using Microseconds = std::chrono::duration<double, std::micro>;
+  for (const auto& event : nativeEvents) {
+    // In the clock and unit of the events of `MarkerTimeline`.
+    auto startTime = Microseconds(event.startTime.time_since_epoch()).count();
+    auto duration = Microseconds(event.endTime - event.startTime).count();
+    traceEvents.events.push_back(folly::dynamic::object("name", event.name)(
+        "cat", event.category)("ph", "X")("ts", startTime)("dur", duration)(
+        "pid", 0)("tid", static_cast<int64_t>(event.threadId)));
+  }
+
+  // The calls of native modules during the trace, as counters at its end.
+  auto callsAtStart =
+      std::unordered_map<std::string, const NativeModuleMethodCallStats*>{};
+  for (const auto& calls : nativeModuleCallsAtTracingStart_) {
+    callsAtStart[calls.moduleName + "." + calls.methodName] = &calls;
+  }
+  auto endTime = ReactMarker::MarkerTimeline::now() * 1000;
+  using Milliseconds = std::chrono::duration<double, std::milli>;
+  for (const auto& calls :
+       NativeModuleCallStats::getInstance().getMethodCallStats()) {
+    auto name = calls.moduleName + "." + calls.methodName;
+    auto start = NativeModuleMethodCallStats{};
+    if (auto it = callsAtStart.find(name); it != callsAtStart.end()) {
+      start = *it->second;
+    }
+    auto numberOfCalls = calls.numberOfSyncCalls + calls.numberOfAsyncCalls -
+        start.numberOfSyncCalls - start.numberOfAsyncCalls;
+    if (numberOfCalls == 0) {
+      continue;
+    }
+    auto toMilliseconds = [](int64_t nanoseconds) {
+      return Milliseconds(std::chrono::nanoseconds(nanoseconds)).count();
+    };
+    traceEvents.events.push_back(folly::dynamic::object("name", name)(
+        "cat", "native_module")("ph", "C")("ts", endTime)("pid", 0)("tid", 0)(
+        "args",
+        folly::dynamic::object("calls", numberOfCalls)(
+            "sampledJsThreadTimeMs",
+            toMilliseconds(calls.jsThreadTime - start.jsThreadTime))(
+            "sampledExecutionTimeMs",
+            toMilliseconds(calls.executionTime - start.executionTime))(
+            "sampledQueueWaitTimeMs",
+            toMilliseconds(calls.queueWaitTime - start.queueWaitTime))));
+  }
+  nativeModuleCallsAtTracingStart_.clear();
+
+  // The JS heap during the trace, next to the commits and mounts of the
+  // renderer recorded by `NativeTraceRecorder`.
+  for (const auto& sample : jsHeapSampler_->getSamples()) {
+    if (sample.time < tracingStartTime_) {
+      continue;
+    }
+    auto time = Microseconds(sample.time.time_since_epoch()).count();
+    folly::dynamic args = folly::dynamic::object();
+    for (const auto& [name, value] : sample.heapInfo) {
+      args[name] = value;
+    }
+    traceEvents.events.push_back(folly::dynamic::object("name", "JSHeap")(
+        "cat", "js_heap")("ph", "C")("ts", time)("pid", 0)("tid", 0)(
+        "args", std::move(args)));
+  }
+  for (const auto& collection : jsHeapSampler_->getGarbageCollections()) {
+    auto startTime = collection.endTime - collection.duration;
+    if (startTime < tracingStartTime_) {
+      continue;
+    }
+    auto time = Microseconds(startTime.time_since_epoch()).count();
+    auto duration = Microseconds(collection.duration).count();
+    traceEvents.events.push_back(folly::dynamic::object(
+        "name", "GarbageCollection")("cat", "js_gc")("ph", "X")("ts", time)(
+        "dur", duration)("pid", 0)("tid", 0)(
+        "args",
+        folly::dynamic::object("kind", collection.kind)(
+            "cause", collection.cause)(
+            "cpuDurationMs", Milliseconds(collection.cpuDuration).count())(
+            "allocatedBytesBefore", collection.allocatedBytesBefore)(
+            "allocatedBytesAfter", collection.allocatedBytesAfter)));
+  }
+
+  return traceEvents;
+}
+
 RuntimeExecutor ReactInstance::getUnbufferedRuntimeExecutor() noexcept {
   return [runtimeScheduler = runtimeScheduler_.get()](
              std::function<void(jsi::Runtime & runtime)>&& callback) {
@@ -135,6 +249,18 @@ RuntimeExecutor ReactInstance::getBufferedRuntimeExecutor() noexcept {
   };
 }
 
+RuntimeExecutor ReactInstance::getBufferedRuntimeExecutor(
+    SchedulerPriority priority) noexcept {
+  return [weakBufferedRuntimeExecutor_ =
+              std::weak_ptr<BufferedRuntimeExecutor>(bufferedRuntimeExecutor_),
+          priority](std::function<void(jsi::Runtime & runtime)>&& callback) {
+    if (auto strongBufferedRuntimeExecutor_ =
+            weakBufferedRuntimeExecutor_.lock()) {
+      strongBufferedRuntimeExecutor_->execute(priority, std::move(callback));
+    }
+  };
+}
+
 std::shared_ptr<RuntimeScheduler>
 ReactInstance::getRuntimeScheduler() noexcept {
   return runtimeScheduler_;
@@ -216,7 +342,7 @@ void ReactInstance::loadScript(
                 ReactMarker::RUN_JS_BUNDLE_START, scriptName.c_str());
           }
 
-          runtime.evaluateJavaScript(buffer, sourceURL);
+          runtime_->evaluateJavaScript(buffer, sourceURL);
           if (hasLogger) {
             ReactMarker::logTaggedMarkerBridgeless(
                 ReactMarker::RUN_JS_BUNDLE_STOP, scriptName.c_str());
@@ -247,6 +373,11 @@ void ReactInstance::callFunctionOnModule(
   // TODO (C++ 20): This code previously implicitly captured `this` in a [=]
   // capture group. Was it meaning to pass modules_ by value?
   bufferedRuntimeExecutor_->execute([=, this](jsi::Runtime& runtime) {
+    if (moduleName == "AppRegistry" && methodName == "runApplication") {
+      // Samples the heap once the surface rendered for the first time.
+      jsHeapSampler_->requestSample("runApplication");
+    }
+
     SystraceSection s(
         "ReactInstance::callFunctionOnModule",
         "moduleName",
@@ -469,4 +600,28 @@ void* ReactInstance::getJavaScriptContext() {
   return &runtime_->getRuntime();
 }
 
+std::shared_ptr<const JSHeapSampler> ReactInstance::getJSHeapSampler()
+    const noexcept {
+  return jsHeapSampler_;
+}
+
+void ReactInstance::startSamplingProfiler(
+    JSSamplingProfiler::Options options,
+    JSSamplingProfiler::ProfileCallback callback) {
+  runtimeScheduler_->scheduleWork(
+      [this, options, callback = std::move(callback)](
+          jsi::Runtime& /*runtime*/) mutable {
+        SystraceSection s("ReactInstance::startSamplingProfiler");
+        if (!jsSamplingProfiler_->start(*runtime_, options, callback)) {
+          callback({});
+        }
+      });
+}
+
+void ReactInstance::stopSamplingProfiler() {
+  runtimeScheduler_->scheduleWork([this](jsi::Runtime& /*runtime*/) {
+    jsSamplingProfiler_->stop(*runtime_);
+  });
+}
+
 } // namespace facebook::react
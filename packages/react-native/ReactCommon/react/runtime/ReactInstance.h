@@ -15,8 +15,11 @@
 #include <jsireact/JSIExecutor.h>
 #include <react/renderer/runtimescheduler/RuntimeScheduler.h>
 #include <react/runtime/BufferedRuntimeExecutor.h>
+#include <react/runtime/JSHeapSampler.h>
 #include <react/runtime/JSRuntimeFactory.h>
+#include <react/runtime/JSSamplingProfiler.h>
 #include <react/runtime/TimerManager.h>
+#include <reactperflogger/SamplingNativeModulePerfLogger.h>
 
 namespace facebook::react {
 
@@ -41,6 +44,12 @@ class ReactInstance final : private jsinspector_modern::InstanceTargetDelegate {
 
   RuntimeExecutor getBufferedRuntimeExecutor() noexcept;
 
+  // Like getBufferedRuntimeExecutor(), but schedules work with the given
+  // priority. Work buffered until the main JS bundle finished execution is
+  // flushed in priority order.
+  RuntimeExecutor getBufferedRuntimeExecutor(
+      SchedulerPriority priority) noexcept;
+
   std::shared_ptr<RuntimeScheduler> getRuntimeScheduler() noexcept;
 
   struct JSRuntimeFlags {
@@ -73,8 +82,36 @@ class ReactInstance final : private jsinspector_modern::InstanceTargetDelegate {
 
   void* getJavaScriptContext();
 
+  /**
+   * The heap samples and garbage collections of the JS VM, for telemetry.
+   * Empty unless `CoreFeatures::enableJSHeapSampling` is set.
+   */
+  std::shared_ptr<const JSHeapSampler> getJSHeapSampler() const noexcept;
+
+  /**
+   * Samples the JS stacks of the VM until `stopSamplingProfiler` is called or
+   * `options.maxDuration` passed, then passes the profile to `callback` on
+   * the JS thread (see `JSSamplingProfiler`). If sampling can't start (e.g.
+   * another instance is sampling), `callback` receives an empty profile.
+   * Available in release builds; can be called on any thread.
+   */
+  void startSamplingProfiler(
+      JSSamplingProfiler::Options options,
+      JSSamplingProfiler::ProfileCallback callback);
+  void stopSamplingProfiler();
+
  private:
+  // jsinspector_modern::InstanceTargetDelegate methods
+  void startTracing() override;
+  jsinspector_modern::CollectedTraceEvents collectTraceEvents() override;
+
+  // The calls of native modules when the current trace started.
+  std::vector<NativeModuleMethodCallStats> nativeModuleCallsAtTracingStart_;
+  std::chrono::steady_clock::time_point tracingStartTime_;
+
   std::shared_ptr<JSRuntime> runtime_;
+  std::shared_ptr<JSHeapSampler> jsHeapSampler_;
+  std::shared_ptr<JSSamplingProfiler> jsSamplingProfiler_;
   std::shared_ptr<MessageQueueThread> jsMessageQueueThread_;
   std::shared_ptr<BufferedRuntimeExecutor> bufferedRuntimeExecutor_;
   std::shared_ptr<TimerManager> timerManager_;
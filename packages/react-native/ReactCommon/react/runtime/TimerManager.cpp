@@ -8,6 +8,8 @@
 #include "TimerManager.h"
 
 #include <cxxreact/SystraceSection.h>
+#include <react/utils/CoreFeatures.h>
+#include <algorithm>
 #include <utility>
 
 namespace facebook::react {
@@ -57,12 +59,17 @@ std::shared_ptr<TimerHandle> TimerManager::createTimer(
     double delay) {
   auto sharedCallback = std::make_shared<TimerCallback>(
       std::move(callback), std::move(args), false);
+  sharedCallback->isBatched = CoreFeatures::enableBatchedTimers;
 
   // Get the id for the callback.
   uint32_t timerID = timerIndex_++;
   timers_[timerID] = std::move(sharedCallback);
 
-  platformTimerRegistry_->createTimer(timerID, delay);
+  if (CoreFeatures::enableBatchedTimers) {
+    scheduleBatchedTimer(timerID, delay);
+  } else {
+    platformTimerRegistry_->createTimer(timerID, delay);
+  }
 
   return std::make_shared<TimerHandle>(timerID);
 }
@@ -73,12 +80,17 @@ std::shared_ptr<TimerHandle> TimerManager::createRecurringTimer(
     double delay) {
   auto sharedCallback = std::make_shared<TimerCallback>(
       std::move(callback), std::move(args), true);
+  sharedCallback->isBatched = CoreFeatures::enableBatchedTimers;
 
   // Get the id for the callback.
   uint32_t timerID = timerIndex_++;
   timers_[timerID] = std::move(sharedCallback);
 
-  platformTimerRegistry_->createRecurringTimer(timerID, delay);
+  if (CoreFeatures::enableBatchedTimers) {
+    scheduleBatchedTimer(timerID, delay);
+  } else {
+    platformTimerRegistry_->createRecurringTimer(timerID, delay);
+  }
 
   return std::make_shared<TimerHandle>(timerID);
 }
@@ -112,9 +124,12 @@ void TimerManager::deleteTimer(
     throw jsi::JSError(runtime, "clearTimeout called with an invalid handle");
   }
 
-  platformTimerRegistry_->deleteTimer(timerHandle->index());
-  if (timers_.find(timerHandle->index()) != timers_.end()) {
-    timers_.erase(timerHandle->index());
+  auto timer = timers_.find(timerHandle->index());
+  if (timer == timers_.end() || !timer->second->isBatched) {
+    platformTimerRegistry_->deleteTimer(timerHandle->index());
+  }
+  if (timer != timers_.end()) {
+    timers_.erase(timer);
   }
 }
 
@@ -125,13 +140,22 @@ void TimerManager::deleteRecurringTimer(
     throw jsi::JSError(runtime, "clearInterval called with an invalid handle");
   }
 
-  platformTimerRegistry_->deleteTimer(timerHandle->index());
-  if (timers_.find(timerHandle->index()) != timers_.end()) {
-    timers_.erase(timerHandle->index());
+  auto timer = timers_.find(timerHandle->index());
+  if (timer == timers_.end() || !timer->second->isBatched) {
+    platformTimerRegistry_->deleteTimer(timerHandle->index());
+  }
+  if (timer != timers_.end()) {
+    timers_.erase(timer);
   }
 }
 
 void TimerManager::callTimer(uint32_t timerID) {
+  if (timerID == kBatchedTimersPlatformTimerID) {
+    runtimeExecutor_(
+        [this](jsi::Runtime& runtime) { callBatchedTimers(runtime); });
+    return;
+  }
+
   runtimeExecutor_([this, timerID](jsi::Runtime& runtime) {
     SystraceSection s("TimerManager::callTimer");
     if (timers_.count(timerID) > 0) {
@@ -145,6 +169,87 @@ void TimerManager::callTimer(uint32_t timerID) {
   });
 }
 
+void TimerManager::scheduleBatchedTimer(uint32_t timerID, double delay) {
+  auto interval =
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::duration<double, std::milli>(std::max(delay, 0.0)));
+  batchedTimers_.push(
+      {std::chrono::steady_clock::now() + interval, timerID, interval});
+  armBatchedTimersPlatformTimer();
+}
+
+void TimerManager::callBatchedTimers(jsi::Runtime& runtime) {
+  SystraceSection s("TimerManager::callBatchedTimers");
+
+  armedDeadline_.reset();
+  auto now = std::chrono::steady_clock::now();
+
+  // Timers scheduled while these are called (including the next runs of
+  // intervals) fire in a later batch.
+  std::vector<BatchedTimer> expiredTimers;
+  while (!batchedTimers_.empty() && batchedTimers_.top().deadline <= now) {
+    expiredTimers.push_back(batchedTimers_.top());
+    batchedTimers_.pop();
+  }
+
+  for (size_t i = 0; i < expiredTimers.size(); i++) {
+    auto& expiredTimer = expiredTimers[i];
+    auto it = timers_.find(expiredTimer.timerID);
+    if (it == timers_.end()) {
+      // The timer was cleared.
+      continue;
+    }
+
+    auto timer = it->second;
+    if (timer->repeat) {
+      expiredTimer.deadline =
+          std::max(expiredTimer.deadline + expiredTimer.interval, now);
+      batchedTimers_.push(expiredTimer);
+    } else {
+      timers_.erase(it);
+    }
+
+    try {
+      timer->invoke(runtime);
+    } catch (...) {
+      // Timers which didn't get their turn fire with the next batch.
+      for (auto j = i + 1; j < expiredTimers.size(); j++) {
+        batchedTimers_.push(expiredTimers[j]);
+      }
+      armBatchedTimersPlatformTimer();
+      throw;
+    }
+  }
+
+  armBatchedTimersPlatformTimer();
+}
+
+void TimerManager::armBatchedTimersPlatformTimer() {
+  while (!batchedTimers_.empty() &&
+         timers_.count(batchedTimers_.top().timerID) == 0) {
+    batchedTimers_.pop();
+  }
+
+  if (batchedTimers_.empty()) {
+    return;
+  }
+
+  auto deadline = batchedTimers_.top().deadline;
+  if (armedDeadline_.has_value() && armedDeadline_.value() <= deadline) {
+    return;
+  }
+
+  auto delay = std::chrono::duration<double, std::milli>(
+                   deadline - std::chrono::steady_clock::now())
+                   .count();
+
+  // Replaces the platform timer if it is still pending.
+  platformTimerRegistry_->deleteTimer(kBatchedTimersPlatformTimerID);
+  platformTimerRegistry_->createTimer(
+      kBatchedTimersPlatformTimerID, std::max(delay, 0.0));
+  armedDeadline_ = deadline;
+}
+
 void TimerManager::attachGlobals(jsi::Runtime& runtime) {
   // Install host functions for timers.
   // TODO (T45786383): Add missing timer functions from JSTimers
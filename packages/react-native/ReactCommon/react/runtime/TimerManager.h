@@ -8,8 +8,13 @@
 #pragma once
 
 #include <ReactCommon/RuntimeExecutor.h>
+#include <react/utils/FlatMap.h>
+#include <chrono>
 #include <cstdint>
-#include <unordered_map>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <queue>
 #include <vector>
 
 #include "PlatformTimerRegistry.h"
@@ -56,10 +61,21 @@ struct TimerCallback {
   jsi::Function callback_;
   const std::vector<jsi::Value> args_;
   bool repeat;
+  // Whether the timer is scheduled by TimerManager itself instead of having
+  // a platform timer of its own (see `CoreFeatures::enableBatchedTimers`).
+  bool isBatched{false};
 };
 
 class TimerManager {
  public:
+  /*
+   * ID of the platform timer that TimerManager arms for the earliest of its
+   * batched timers. Calling `callTimer` with it calls all expired batched
+   * timers at once.
+   */
+  static constexpr uint32_t kBatchedTimersPlatformTimerID =
+      std::numeric_limits<uint32_t>::max();
+
   explicit TimerManager(
       std::unique_ptr<PlatformTimerRegistry> platformTimerRegistry) noexcept;
 
@@ -96,11 +112,45 @@ class TimerManager {
       jsi::Runtime& runtime,
       std::shared_ptr<TimerHandle> handle);
 
+  using TimePoint = std::chrono::steady_clock::time_point;
+
+  /*
+   * Deadline of a batched timer.
+   */
+  struct BatchedTimer {
+    TimePoint deadline;
+    uint32_t timerID;
+    std::chrono::steady_clock::duration interval;
+
+    // Timers with equal deadlines fire in order of creation.
+    bool operator>(const BatchedTimer& rhs) const {
+      return deadline > rhs.deadline ||
+          (deadline == rhs.deadline && timerID > rhs.timerID);
+    }
+  };
+
+  void scheduleBatchedTimer(uint32_t timerID, double delay);
+
+  void callBatchedTimers(jsi::Runtime& runtime);
+
+  void armBatchedTimersPlatformTimer();
+
   RuntimeExecutor runtimeExecutor_;
   std::unique_ptr<PlatformTimerRegistry> platformTimerRegistry_;
 
+  // Deadlines of batched timers, earliest first. Cleared timers stay here
+  // until their deadline passes.
+  std::priority_queue<
+      BatchedTimer,
+      std::vector<BatchedTimer>,
+      std::greater<BatchedTimer>>
+      batchedTimers_;
+
+  // Deadline the platform timer for batched timers is armed for, if any.
+  std::optional<TimePoint> armedDeadline_;
+
   // A map (id => callback func) of the currently active JS timers
-  std::unordered_map<uint32_t, std::shared_ptr<TimerCallback>> timers_;
+  FlatMap<uint32_t, std::shared_ptr<TimerCallback>> timers_;
 
   // Each timeout that is registered on this queue gets a sequential id.  This
   // is the global count from which those are assigned.
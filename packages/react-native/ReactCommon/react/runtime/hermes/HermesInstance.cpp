@@ -7,10 +7,15 @@
 
 #include "HermesInstance.h"
 
+#include <HermesBytecodeCache.h>
 #include <hermes/inspector-modern/chrome/HermesRuntimeAgentDelegate.h>
 #include <jsi/jsilib.h>
 #include <jsinspector-modern/InspectorFlags.h>
 #include <react/featureflags/ReactNativeFeatureFlags.h>
+#include <react/runtime/JSHeapSampler.h>
+
+#include <atomic>
+#include <mutex>
 
 #ifdef HERMES_ENABLE_DEBUGGER
 #include <hermes/inspector-modern/chrome/Registration.h>
@@ -92,18 +97,97 @@ class DecoratedRuntime : public jsi::RuntimeDecorator<jsi::Runtime> {
 
 #endif
 
+// Forwards the garbage collections reported by Hermes, e.g. on its GC thread,
+// to the JSHeapSampler of the ReactInstance that owns the runtime.
+class GarbageCollectionForwarder {
+ public:
+  void setJSHeapSampler(std::weak_ptr<JSHeapSampler> sampler) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    sampler_ = std::move(sampler);
+  }
+
+  void forward(const ::hermes::vm::GCAnalyticsEvent& event) {
+    std::shared_ptr<JSHeapSampler> sampler;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      sampler = sampler_.lock();
+    }
+    if (!sampler) {
+      return;
+    }
+    sampler->recordGarbageCollection(
+        {std::chrono::steady_clock::now(),
+         event.duration,
+         event.cpuDuration,
+         event.collectionType,
+         event.cause,
+         static_cast<int64_t>(event.allocated.before),
+         static_cast<int64_t>(event.allocated.after)});
+  }
+
+ private:
+  std::mutex mutex_;
+  std::weak_ptr<JSHeapSampler> sampler_;
+};
+
 class HermesJSRuntime : public JSRuntime {
  public:
   HermesJSRuntime(
       std::unique_ptr<HermesRuntime> runtime,
-      std::shared_ptr<MessageQueueThread> msgQueueThread)
+      std::shared_ptr<MessageQueueThread> msgQueueThread,
+      std::shared_ptr<GarbageCollectionForwarder> gcForwarder,
+      std::shared_ptr<HermesBytecodeCache> bytecodeCache)
       : runtime_(std::move(runtime)),
-        msgQueueThread_(std::move(msgQueueThread)) {}
+        msgQueueThread_(std::move(msgQueueThread)),
+        gcForwarder_(std::move(gcForwarder)),
+        bytecodeCache_(std::move(bytecodeCache)) {}
+
+  ~HermesJSRuntime() override {
+    if (isSampling_) {
+      HermesRuntime::disableSamplingProfiler();
+      isSamplingAnyRuntime_ = false;
+    }
+  }
 
   jsi::Runtime& getRuntime() noexcept override {
     return *runtime_;
   }
 
+  // The sampling profiler of Hermes is process-wide, so only one runtime
+  // samples at a time.
+  bool startSamplingProfiler() override {
+    if (isSampling_ || isSamplingAnyRuntime_.exchange(true)) {
+      return false;
+    }
+    isSampling_ = true;
+    HermesRuntime::enableSamplingProfiler();
+    return true;
+  }
+
+  void stopSamplingProfiler(std::ostream& stream) override {
+    if (!isSampling_) {
+      return;
+    }
+    HermesRuntime::disableSamplingProfiler();
+    runtime_->sampledTraceToStreamInDevToolsFormat(stream);
+    isSampling_ = false;
+    isSamplingAnyRuntime_ = false;
+  }
+
+  void setJSHeapSampler(std::weak_ptr<JSHeapSampler> sampler) override {
+    gcForwarder_->setJSHeapSampler(std::move(sampler));
+  }
+
+  void evaluateJavaScript(
+      const std::shared_ptr<const jsi::Buffer>& buffer,
+      const std::string& sourceURL) override {
+    if (bytecodeCache_) {
+      bytecodeCache_->evaluateJavaScript(*runtime_, buffer, sourceURL);
+    } else {
+      runtime_->evaluateJavaScript(buffer, sourceURL);
+    }
+  }
+
   std::unique_ptr<jsinspector_modern::RuntimeAgentDelegate> createAgentDelegate(
       jsinspector_modern::FrontendChannel frontendChannel,
       jsinspector_modern::SessionState& sessionState) override {
@@ -131,12 +215,20 @@ class HermesJSRuntime : public JSRuntime {
  private:
   std::shared_ptr<HermesRuntime> runtime_;
   std::shared_ptr<MessageQueueThread> msgQueueThread_;
+  std::shared_ptr<GarbageCollectionForwarder> gcForwarder_;
+  std::shared_ptr<HermesBytecodeCache> bytecodeCache_;
+  bool isSampling_{false};
+
+  static std::atomic<bool> isSamplingAnyRuntime_;
 };
 
+std::atomic<bool> HermesJSRuntime::isSamplingAnyRuntime_{false};
+
 std::unique_ptr<JSRuntime> HermesInstance::createJSRuntime(
     std::shared_ptr<const ReactNativeConfig> reactNativeConfig,
     std::shared_ptr<::hermes::vm::CrashManager> cm,
-    std::shared_ptr<MessageQueueThread> msgQueueThread) noexcept {
+    std::shared_ptr<MessageQueueThread> msgQueueThread,
+    std::shared_ptr<HermesBytecodeCache> bytecodeCache) noexcept {
   assert(msgQueueThread != nullptr);
   int64_t vmExperimentFlags = reactNativeConfig
       ? reactNativeConfig->getInt64("ios_hermes:vm_experiment_flags")
@@ -150,6 +242,8 @@ std::unique_ptr<JSRuntime> HermesInstance::createJSRuntime(
       ? static_cast<::hermes::vm::gcheapsize_t>(heapSizeConfig)
       : 3072;
 
+  auto gcForwarder = std::make_shared<GarbageCollectionForwarder>();
+
   ::hermes::vm::RuntimeConfig::Builder runtimeConfigBuilder =
       ::hermes::vm::RuntimeConfig::Builder()
           .withGCConfig(::hermes::vm::GCConfig::Builder()
@@ -161,6 +255,10 @@ std::unique_ptr<JSRuntime> HermesInstance::createJSRuntime(
                             // operation when we reach the (first) TTI point.
                             .withAllocInYoung(false)
                             .withRevertToYGAtTTI(true)
+                            .withAnalyticsCallback(
+                                [gcForwarder](
+                                    const ::hermes::vm::GCAnalyticsEvent&
+                                        event) { gcForwarder->forward(event); })
                             .build())
           .withES6Proxy(false)
           .withEnableSampleProfiling(true)
@@ -185,7 +283,10 @@ std::unique_ptr<JSRuntime> HermesInstance::createJSRuntime(
 #endif
 
   return std::make_unique<HermesJSRuntime>(
-      std::move(hermesRuntime), std::move(msgQueueThread));
+      std::move(hermesRuntime),
+      std::move(msgQueueThread),
+      std::move(gcForwarder),
+      std::move(bytecodeCache));
 }
 
 } // namespace facebook::react
@@ -15,12 +15,19 @@
 
 namespace facebook::react {
 
+class HermesBytecodeCache;
+
 class HermesInstance {
  public:
+  /*
+   * Bundles loaded as source are evaluated through `bytecodeCache`, if any
+   * (except with the legacy debugger).
+   */
   static std::unique_ptr<JSRuntime> createJSRuntime(
       std::shared_ptr<const ReactNativeConfig> reactNativeConfig,
       std::shared_ptr<::hermes::vm::CrashManager> cm,
-      std::shared_ptr<MessageQueueThread> msgQueueThread) noexcept;
+      std::shared_ptr<MessageQueueThread> msgQueueThread,
+      std::shared_ptr<HermesBytecodeCache> bytecodeCache = nullptr) noexcept;
 };
 
 } // namespace facebook::react
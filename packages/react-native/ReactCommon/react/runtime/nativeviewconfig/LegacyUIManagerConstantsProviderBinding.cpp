@@ -58,4 +58,45 @@ void install(
   runtime.global().setProperty(runtime, methodName.c_str(), jsiFunction);
 }
 
+void install(
+    jsi::Runtime& runtime,
+    const std::string& name,
+    std::function<jsi::Value(std::string)>&& provider,
+    std::shared_ptr<NativeViewConfigCache> cache) {
+  if (!cache) {
+    install(runtime, name, std::move(provider));
+    return;
+  }
+
+  auto cachedProvider =
+      [&runtime, provider = std::move(provider), cache = std::move(cache)](
+          std::string componentName) -> jsi::Value {
+    auto json = runtime.global().getPropertyAsObject(runtime, "JSON");
+
+    if (auto viewConfig = cache->get(componentName)) {
+      try {
+        return json.getPropertyAsFunction(runtime, "parse")
+            .call(runtime, jsi::String::createFromUtf8(runtime, *viewConfig));
+      } catch (const jsi::JSError&) {
+        // The file is corrupted; the view config is generated again.
+      }
+    }
+
+    auto viewConfig = provider(componentName);
+    if (viewConfig.isObject()) {
+      auto serializedViewConfig =
+          json.getPropertyAsFunction(runtime, "stringify")
+              .call(runtime, viewConfig);
+      if (serializedViewConfig.isString()) {
+        cache->set(
+            componentName,
+            serializedViewConfig.getString(runtime).utf8(runtime));
+      }
+    }
+    return viewConfig;
+  };
+
+  install(runtime, name, std::move(cachedProvider));
+}
+
 } // namespace facebook::react::LegacyUIManagerConstantsProviderBinding
@@ -9,6 +9,8 @@
 
 #include <jsi/jsi.h>
 
+#include "NativeViewConfigCache.h"
+
 namespace facebook::react::LegacyUIManagerConstantsProviderBinding {
 
 using ProviderType = std::function<jsi::Value()>;
@@ -26,4 +28,15 @@ void install(
     jsi::Runtime& runtime,
     const std::string& name,
     std::function<jsi::Value(std::string)>&& provider);
+
+/*
+ * Same as above, but the values returned by `provider` (the native view
+ * configs of components) are kept in `cache`, so that `provider` is only
+ * called for components which were not used in a previous launch.
+ */
+void install(
+    jsi::Runtime& runtime,
+    const std::string& name,
+    std::function<jsi::Value(std::string)>&& provider,
+    std::shared_ptr<NativeViewConfigCache> cache);
 } // namespace facebook::react::LegacyUIManagerConstantsProviderBinding
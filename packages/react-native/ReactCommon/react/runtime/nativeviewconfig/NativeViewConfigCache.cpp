@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "NativeViewConfigCache.h"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <utility>
+
+#include <unistd.h>
+
+#include <glog/logging.h>
+
+namespace facebook::react {
+
+namespace {
+
+/*
+ * The file starts with a line holding the configuration it was written for,
+ * followed by a line per view config: the name of the component, a tab, and
+ * the JSON of the view config (which has no raw tabs or line breaks).
+ */
+constexpr char kSeparator = '\t';
+
+void readViewConfigs(
+    const std::string& path,
+    const std::string& configuration,
+    std::unordered_map<std::string, std::string>& viewConfigs) {
+  auto file = std::ifstream(path);
+  auto line = std::string{};
+  if (!std::getline(file, line) || line != configuration) {
+    return;
+  }
+
+  while (std::getline(file, line)) {
+    auto separatorIndex = line.find(kSeparator);
+    if (separatorIndex == std::string::npos) {
+      continue;
+    }
+    viewConfigs.emplace(
+        line.substr(0, separatorIndex), line.substr(separatorIndex + 1));
+  }
+}
+
+} // namespace
+
+NativeViewConfigCache::NativeViewConfigCache(
+    std::string path,
+    std::string configuration)
+    : path_(std::move(path)),
+      configuration_(std::move(configuration)),
+      state_(std::make_shared<State>()) {}
+
+std::optional<std::string> NativeViewConfigCache::get(
+    const std::string& componentName) const {
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  if (!state_->isRead) {
+    readViewConfigs(path_, configuration_, state_->viewConfigs);
+    state_->isRead = true;
+  }
+
+  auto iterator = state_->viewConfigs.find(componentName);
+  if (iterator == state_->viewConfigs.end()) {
+    return std::nullopt;
+  }
+  return iterator->second;
+}
+
+void NativeViewConfigCache::set(
+    const std::string& componentName,
+    std::string viewConfig) {
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    if (!state_->isRead) {
+      readViewConfigs(path_, configuration_, state_->viewConfigs);
+      state_->isRead = true;
+    }
+
+    state_->viewConfigs[componentName] = std::move(viewConfig);
+    state_->hasUnwrittenViewConfigs = true;
+    if (state_->isWriting) {
+      // The view config will be part of the next write of that thread.
+      return;
+    }
+    state_->isWriting = true;
+  }
+
+  std::thread(&NativeViewConfigCache::write, state_, path_, configuration_)
+      .detach();
+}
+
+void NativeViewConfigCache::write(
+    std::shared_ptr<State> state,
+    std::string path,
+    std::string configuration) {
+  static auto writeCount = std::atomic<uint64_t>{0};
+
+  while (true) {
+    auto viewConfigs = std::unordered_map<std::string, std::string>{};
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      if (!state->hasUnwrittenViewConfigs) {
+        state->isWriting = false;
+        return;
+      }
+      state->hasUnwrittenViewConfigs = false;
+      viewConfigs = state->viewConfigs;
+    }
+
+    // Writing to a temporary file which replaces the cache once complete, so
+    // the cache is never seen partially written. Caches of other instances of
+    // React Native may write to the same file concurrently.
+    auto temporaryPath = path + ".tmp-" + std::to_string(getpid()) + "-" +
+        std::to_string(writeCount++);
+    auto file = std::ofstream(temporaryPath, std::ios::trunc);
+    file << configuration << '\n';
+    for (const auto& [componentName, viewConfig] : viewConfigs) {
+      file << componentName << kSeparator << viewConfig << '\n';
+    }
+    file.close();
+
+    auto succeeded = !file.fail() &&
+        std::rename(temporaryPath.c_str(), path.c_str()) == 0;
+    if (!succeeded) {
+      LOG(WARNING) << "Failed to write native view configs to " << path;
+      std::remove(temporaryPath.c_str());
+    }
+  }
+}
+
+} // namespace facebook::react
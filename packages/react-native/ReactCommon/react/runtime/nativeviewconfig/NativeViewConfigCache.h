@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace facebook::react {
+
+/*
+ * Keeps the native view configs of components (as returned by
+ * `UIManager.getConstantsForViewManager`, serialized to JSON) across launches
+ * of the app, so that they don't have to be generated by the platform (e.g.
+ * by reflecting over view managers) on every launch.
+ *
+ * The file holding the view configs is read when a view config is first
+ * requested, and view configs added since then are written to it
+ * asynchronously. The file is discarded when it was written for a different
+ * `configuration`, which must identify the native code of the app (e.g. its
+ * version and the time it was installed), as view configs only change with
+ * it.
+ *
+ * Can be called from any thread.
+ */
+class NativeViewConfigCache final {
+ public:
+  NativeViewConfigCache(std::string path, std::string configuration);
+
+  NativeViewConfigCache(const NativeViewConfigCache&) = delete;
+  NativeViewConfigCache& operator=(const NativeViewConfigCache&) = delete;
+
+  /*
+   * Returns the JSON of the view config of a given component, if it was
+   * persisted.
+   */
+  std::optional<std::string> get(const std::string& componentName) const;
+
+  /*
+   * Adds the JSON of the view config of a given component, to be persisted.
+   */
+  void set(const std::string& componentName, std::string viewConfig);
+
+ private:
+  // Shared with the thread writing the file, which can outlive the cache.
+  struct State {
+    std::mutex mutex;
+    bool isRead{false};
+    std::unordered_map<std::string, std::string> viewConfigs;
+    bool hasUnwrittenViewConfigs{false};
+    bool isWriting{false};
+  };
+
+  static void write(
+      std::shared_ptr<State> state,
+      std::string path,
+      std::string configuration);
+
+  const std::string path_;
+  const std::string configuration_;
+  const std::shared_ptr<State> state_;
+};
+
+} // namespace facebook::react
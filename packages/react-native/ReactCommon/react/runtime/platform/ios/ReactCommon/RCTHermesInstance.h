@@ -25,6 +25,13 @@ class RCTHermesInstance : public JSRuntimeFactory {
   RCTHermesInstance(
       std::shared_ptr<const ReactNativeConfig> reactNativeConfig,
       CrashManagerProvider crashManagerProvider);
+  // Hermes bytecode compiled from bundles loaded as source is cached in
+  // `bytecodeCacheDirectory`, so they are compiled once instead of on every
+  // launch (see `HermesBytecodeCache`).
+  RCTHermesInstance(
+      std::shared_ptr<const ReactNativeConfig> reactNativeConfig,
+      CrashManagerProvider crashManagerProvider,
+      NSString *bytecodeCacheDirectory);
 
   std::unique_ptr<JSRuntime> createJSRuntime(
       std::shared_ptr<MessageQueueThread> msgQueueThread) noexcept override;
@@ -34,6 +41,7 @@ class RCTHermesInstance : public JSRuntimeFactory {
  private:
   std::shared_ptr<const ReactNativeConfig> _reactNativeConfig;
   CrashManagerProvider _crashManagerProvider;
+  std::shared_ptr<HermesBytecodeCache> _bytecodeCache;
   std::unique_ptr<HermesInstance> _hermesInstance;
 };
 } // namespace react
@@ -7,6 +7,8 @@
 
 #import "RCTHermesInstance.h"
 
+#import <hermes/executor/HermesBytecodeCache.h>
+
 namespace facebook {
 namespace react {
 RCTHermesInstance::RCTHermesInstance() : RCTHermesInstance(nullptr, nullptr) {}
@@ -14,8 +16,18 @@ RCTHermesInstance::RCTHermesInstance() : RCTHermesInstance(nullptr, nullptr) {}
 RCTHermesInstance::RCTHermesInstance(
     std::shared_ptr<const ReactNativeConfig> reactNativeConfig,
     CrashManagerProvider crashManagerProvider)
+    : RCTHermesInstance(std::move(reactNativeConfig), std::move(crashManagerProvider), nil)
+{
+}
+
+RCTHermesInstance::RCTHermesInstance(
+    std::shared_ptr<const ReactNativeConfig> reactNativeConfig,
+    CrashManagerProvider crashManagerProvider,
+    NSString *bytecodeCacheDirectory)
     : _reactNativeConfig(std::move(reactNativeConfig)),
       _crashManagerProvider(std::move(crashManagerProvider)),
+      _bytecodeCache(
+          bytecodeCacheDirectory ? std::make_shared<HermesBytecodeCache>(bytecodeCacheDirectory.UTF8String) : nullptr),
       _hermesInstance(std::make_unique<HermesInstance>())
 {
 }
@@ -24,7 +36,7 @@ std::unique_ptr<JSRuntime> RCTHermesInstance::createJSRuntime(
     std::shared_ptr<MessageQueueThread> msgQueueThread) noexcept
 {
   return _hermesInstance->createJSRuntime(
-      _reactNativeConfig, _crashManagerProvider ? _crashManagerProvider() : nullptr, msgQueueThread);
+      _reactNativeConfig, _crashManagerProvider ? _crashManagerProvider() : nullptr, msgQueueThread, _bytecodeCache);
 }
 
 } // namespace react
@@ -468,15 +468,15 @@ void RCTInstanceSetRuntimeDiagnosticFlags(NSString *flags)
 
 - (void)_handleJSErrorMap:(facebook::react::MapBuffer)errorMap
 {
-  NSString *message = [NSString stringWithCString:errorMap.getString(JSErrorHandlerKey::kErrorMessage).c_str()
+  NSString *message = [NSString stringWithCString:std::string(errorMap.getString(JSErrorHandlerKey::kErrorMessage)).c_str()
                                          encoding:[NSString defaultCStringEncoding]];
   std::vector<facebook::react::MapBuffer> frames = errorMap.getMapBufferList(JSErrorHandlerKey::kAllStackFrames);
   NSMutableArray<NSDictionary<NSString *, id> *> *stack = [NSMutableArray new];
   for (const facebook::react::MapBuffer &mapBuffer : frames) {
     NSDictionary *frame = @{
-      @"file" : [NSString stringWithCString:mapBuffer.getString(JSErrorHandlerKey::kFrameFileName).c_str()
+      @"file" : [NSString stringWithCString:std::string(mapBuffer.getString(JSErrorHandlerKey::kFrameFileName)).c_str()
                                    encoding:[NSString defaultCStringEncoding]],
-      @"methodName" : [NSString stringWithCString:mapBuffer.getString(JSErrorHandlerKey::kFrameMethodName).c_str()
+      @"methodName" : [NSString stringWithCString:std::string(mapBuffer.getString(JSErrorHandlerKey::kFrameMethodName)).c_str()
                                          encoding:[NSString defaultCStringEncoding]],
       @"lineNumber" : [NSNumber numberWithInt:mapBuffer.getInt(JSErrorHandlerKey::kFrameLineNumber)],
       @"column" : [NSNumber numberWithInt:mapBuffer.getInt(JSErrorHandlerKey::kFrameColumnNumber)],
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/runtime/JSHeapSampler.h>
+#include <react/utils/CoreFeatures.h>
+
+#include <string_view>
+
+namespace facebook::react {
+
+using namespace std::chrono_literals;
+
+TEST(JSHeapSamplerTest, samplesAtMostOncePerInterval) {
+  auto sampler = JSHeapSampler(100ms);
+  auto start = JSHeapSampler::Clock::time_point{} + 1s;
+
+  EXPECT_EQ(std::string_view{sampler.takeSampleReason(start)}, "interval");
+  EXPECT_EQ(sampler.takeSampleReason(start + 50ms), nullptr);
+  EXPECT_EQ(sampler.takeSampleReason(start + 99ms), nullptr);
+  EXPECT_EQ(
+      std::string_view{sampler.takeSampleReason(start + 100ms)}, "interval");
+}
+
+TEST(JSHeapSamplerTest, requestedSamplesAreTakenRegardlessOfTheInterval) {
+  auto sampler = JSHeapSampler(100ms);
+  auto start = JSHeapSampler::Clock::time_point{} + 1s;
+
+  sampler.takeSampleReason(start);
+  sampler.requestSample("runApplication");
+
+  EXPECT_EQ(
+      std::string_view{sampler.takeSampleReason(start + 10ms)},
+      "runApplication");
+  // The requested sample restarts the interval.
+  EXPECT_EQ(sampler.takeSampleReason(start + 100ms), nullptr);
+}
+
+TEST(JSHeapSamplerTest, keepsTheLastSamples) {
+  auto sampler = JSHeapSampler(100ms, 2);
+  auto start = JSHeapSampler::Clock::time_point{};
+
+  for (int64_t index = 0; index < 3; index++) {
+    sampler.recordSample(
+        start + index * 100ms, "interval", {{"hermes_allocatedBytes", index}});
+  }
+
+  auto samples = sampler.getSamples();
+  ASSERT_EQ(samples.size(), 2);
+  EXPECT_EQ(samples[0].heapInfo.at("hermes_allocatedBytes"), 1);
+  EXPECT_EQ(samples[1].heapInfo.at("hermes_allocatedBytes"), 2);
+}
+
+TEST(JSHeapSamplerTest, recordsGarbageCollectionsOnlyWhenEnabled) {
+  auto sampler = JSHeapSampler();
+  auto collection = JSGarbageCollection{
+      JSHeapSampler::Clock::now(), 2ms, 1ms, "young", "natural", 200, 100};
+
+  sampler.recordGarbageCollection(collection);
+  EXPECT_TRUE(sampler.getGarbageCollections().empty());
+
+  CoreFeatures::enableJSHeapSampling = true;
+  sampler.recordGarbageCollection(collection);
+  CoreFeatures::enableJSHeapSampling = false;
+
+  auto collections = sampler.getGarbageCollections();
+  ASSERT_EQ(collections.size(), 1);
+  EXPECT_EQ(collections[0].kind, "young");
+  EXPECT_EQ(collections[0].allocatedBytesAfter, 100);
+}
+
+} // namespace facebook::react
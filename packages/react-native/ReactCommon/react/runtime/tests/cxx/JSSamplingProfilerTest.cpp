@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/runtime/JSSamplingProfiler.h>
+
+namespace facebook::react {
+
+using namespace std::chrono_literals;
+
+TEST(JSSamplingProfilerTest, annotatesTheProfileWithTasks) {
+  auto profiler = JSSamplingProfiler();
+  auto start = JSSamplingProfiler::Clock::time_point{} + 1s;
+
+  EXPECT_FALSE(profiler.recordTask(start, start + 1ms));
+  EXPECT_FALSE(profiler.recordTask(start + 2ms, start + 5ms));
+
+  EXPECT_EQ(
+      profiler.buildProfile("{}"),
+      R"({"tasks":[[1000000,1001000],[1002000,1005000]],"profile":{}})");
+}
+
+TEST(JSSamplingProfilerTest, stopsAtTheEndOfTheTimeBudget) {
+  auto profiler = JSSamplingProfiler();
+  auto start = JSSamplingProfiler::Clock::time_point{};
+
+  EXPECT_FALSE(profiler.recordTask(start + 9s, start + 9s + 999ms));
+  EXPECT_TRUE(profiler.recordTask(start + 9s + 999ms, start + 10s));
+}
+
+TEST(JSSamplingProfilerTest, dropsProfilesOverTheSizeBudget) {
+  auto profiler = JSSamplingProfiler();
+
+  EXPECT_EQ(profiler.buildProfile(""), "");
+  EXPECT_EQ(
+      profiler.buildProfile(
+          "\"" + std::string(JSSamplingProfiler::Options{}.maxSize, 'a') +
+          "\""),
+      "");
+}
+
+} // namespace facebook::react
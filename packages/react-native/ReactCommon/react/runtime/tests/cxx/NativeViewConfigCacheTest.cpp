@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <react/runtime/nativeviewconfig/NativeViewConfigCache.h>
+
+using namespace facebook::react;
+
+static std::string temporaryPath(const std::string& name) {
+  auto path = testing::TempDir() + "NativeViewConfigCacheTest-" + name;
+  std::remove(path.c_str());
+  return path;
+}
+
+// The file is written asynchronously, and renamed into place once complete.
+static bool waitForFile(const std::string& path) {
+  for (auto i = 0; i < 200; i++) {
+    if (auto file = std::fopen(path.c_str(), "rb")) {
+      std::fclose(file);
+      return true;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return false;
+}
+
+TEST(NativeViewConfigCacheTest, testViewConfigsArePersisted) {
+  auto path = temporaryPath("persisted");
+  auto viewConfig = std::string{R"({"NativeProps":{"enabled":"boolean"}})"};
+
+  {
+    auto cache = NativeViewConfigCache{path, "1.0/1"};
+    EXPECT_FALSE(cache.get("RCTSwitch").has_value());
+    cache.set("RCTSwitch", viewConfig);
+    EXPECT_EQ(cache.get("RCTSwitch"), viewConfig);
+  }
+
+  ASSERT_TRUE(waitForFile(path));
+
+  auto cache = NativeViewConfigCache{path, "1.0/1"};
+  EXPECT_EQ(cache.get("RCTSwitch"), viewConfig);
+  EXPECT_FALSE(cache.get("RCTView").has_value());
+}
+
+TEST(NativeViewConfigCacheTest, testViewConfigsOfOtherConfigurationsAreIgnored) {
+  auto path = temporaryPath("configuration");
+
+  {
+    auto cache = NativeViewConfigCache{path, "1.0/1"};
+    cache.set("RCTSwitch", "{}");
+  }
+
+  ASSERT_TRUE(waitForFile(path));
+
+  auto cache = NativeViewConfigCache{path, "1.1/2"};
+  EXPECT_FALSE(cache.get("RCTSwitch").has_value());
+}
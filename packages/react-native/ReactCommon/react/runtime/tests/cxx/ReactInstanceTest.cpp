@@ -16,6 +16,7 @@
 #include <jsi/jsi.h>
 #include <react/renderer/mapbuffer/MapBuffer.h>
 #include <react/runtime/ReactInstance.h>
+#include <react/utils/CoreFeatures.h>
 
 using ::testing::_;
 using ::testing::SaveArg;
@@ -248,6 +249,39 @@ Promise.resolve().then(() => {
   EXPECT_EQ(result.getNumber(), 2);
 }
 
+TEST_F(ReactInstanceTest, testBufferedWorkIsFlushedInPriorityOrder) {
+  instance_->initializeRuntime(
+      {.isProfiling = false}, [](jsi::Runtime& runtime) {});
+  step();
+
+  std::vector<std::string> executed;
+  auto record = [&](std::string name) {
+    return [&executed, name](jsi::Runtime& /*runtime*/) {
+      executed.push_back(name);
+    };
+  };
+  instance_->getBufferedRuntimeExecutor(SchedulerPriority::LowPriority)(
+      record("low"));
+  instance_->getBufferedRuntimeExecutor(
+      SchedulerPriority::UserBlockingPriority)(record("userBlocking"));
+  instance_->getBufferedRuntimeExecutor()(record("unprioritized"));
+  instance_->getBufferedRuntimeExecutor(SchedulerPriority::LowPriority)(
+      record("low2"));
+  while (messageQueueThread_->size() > 0) {
+    step();
+  }
+  EXPECT_TRUE(executed.empty());
+
+  instance_->loadScript(std::make_unique<JSBigStdString>(""), "");
+  while (messageQueueThread_->size() > 0) {
+    step();
+  }
+  EXPECT_EQ(
+      executed,
+      (std::vector<std::string>{
+          "unprioritized", "userBlocking", "low", "low2"}));
+}
+
 TEST_F(ReactInstanceTest, testSetImmediate) {
   initializeRuntimeWithScript("");
 
@@ -758,6 +792,110 @@ function getResult() {
   EXPECT_NO_THROW(clear.call(*runtime_));
 }
 
+TEST_F(ReactInstanceTest, testBatchedTimers) {
+  CoreFeatures::enableBatchedTimers = true;
+  initializeRuntimeWithScript("");
+
+  EXPECT_CALL(
+      *mockRegistry_, deleteTimer(TimerManager::kBatchedTimersPlatformTimerID))
+      .Times(testing::AnyNumber());
+  EXPECT_CALL(
+      *mockRegistry_,
+      createTimer(TimerManager::kBatchedTimersPlatformTimerID, _))
+      .Times(1);
+  eval(R"xyz123(
+let result = [];
+setTimeout(() => {
+  result.push('first');
+  setTimeout(() => {
+    result.push('next batch');
+  });
+});
+setTimeout(() => {
+  result.push('second');
+});
+const handle = setTimeout(() => {
+  result.push('cleared');
+});
+clearTimeout(handle);
+setTimeout(() => {
+  result.push('later');
+}, 100000);
+function getResult() {
+  return result.join(',');
+}
+  )xyz123");
+
+  // The timer scheduled from the first one re-arms the platform timer.
+  EXPECT_CALL(
+      *mockRegistry_,
+      createTimer(TimerManager::kBatchedTimersPlatformTimerID, _))
+      .Times(1);
+  timerManager_->callTimer(TimerManager::kBatchedTimersPlatformTimerID);
+  step();
+  auto getResult =
+      runtime_->global().getPropertyAsFunction(*runtime_, "getResult");
+  EXPECT_EQ(
+      getResult.call(*runtime_).asString(*runtime_).utf8(*runtime_),
+      "first,second");
+
+  // The platform timer is re-armed for the timer which didn't expire yet.
+  EXPECT_CALL(
+      *mockRegistry_,
+      createTimer(TimerManager::kBatchedTimersPlatformTimerID, _))
+      .Times(1);
+  timerManager_->callTimer(TimerManager::kBatchedTimersPlatformTimerID);
+  step();
+  EXPECT_EQ(
+      getResult.call(*runtime_).asString(*runtime_).utf8(*runtime_),
+      "first,second,next batch");
+
+  CoreFeatures::enableBatchedTimers = false;
+}
+
+TEST_F(ReactInstanceTest, testBatchedTimersWithInterval) {
+  CoreFeatures::enableBatchedTimers = true;
+  initializeRuntimeWithScript("");
+
+  EXPECT_CALL(*mockRegistry_, createRecurringTimer(_, _)).Times(0);
+  EXPECT_CALL(
+      *mockRegistry_, deleteTimer(TimerManager::kBatchedTimersPlatformTimerID))
+      .Times(testing::AnyNumber());
+  EXPECT_CALL(
+      *mockRegistry_,
+      createTimer(TimerManager::kBatchedTimersPlatformTimerID, _))
+      .Times(testing::AnyNumber());
+  eval(R"xyz123(
+let result = 0;
+const handle = setInterval(() => {
+  result++;
+}, 0);
+function getResult() {
+  return result;
+}
+function clear() {
+  clearInterval(handle);
+}
+  )xyz123");
+
+  auto getResult =
+      runtime_->global().getPropertyAsFunction(*runtime_, "getResult");
+  timerManager_->callTimer(TimerManager::kBatchedTimersPlatformTimerID);
+  step();
+  EXPECT_EQ(getResult.call(*runtime_).asNumber(), 1.0);
+
+  timerManager_->callTimer(TimerManager::kBatchedTimersPlatformTimerID);
+  step();
+  EXPECT_EQ(getResult.call(*runtime_).asNumber(), 2.0);
+
+  runtime_->global().getPropertyAsFunction(*runtime_, "clear").call(*runtime_);
+  timerManager_->callTimer(TimerManager::kBatchedTimersPlatformTimerID);
+  step();
+  EXPECT_EQ(getResult.call(*runtime_).asNumber(), 2.0);
+
+  CoreFeatures::enableBatchedTimers = false;
+}
+
 TEST_F(ReactInstanceTest, testRegisterCallableModule) {
   initializeRuntimeWithScript(R"xyz123(
 let called = false;
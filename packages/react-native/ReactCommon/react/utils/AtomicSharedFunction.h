@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * `AtomicSharedFunction` is a variant of `SharedFunction` for callbacks on hot
+ * paths which are set once (at construction or later with `assign`) and are
+ * rarely replaced afterwards. Copies share the stored callable, as with
+ * `SharedFunction`, but calling it takes no locks: the current callable is
+ * read with an atomic load and `assign` publishes a new one with an atomic
+ * store.
+ * Callables passed to the constructor that fit into `kInlineSize` bytes are
+ * stored inline, in the same allocation as the state shared between copies.
+ * Differences from `SharedFunction`:
+ * - `assign` doesn't wait for running calls of the replaced callable;
+ * - Replaced callables (and their captured values) are kept alive until the
+ *   last copy is destroyed, so callables must not be replaced repeatedly.
+ */
+template <typename... ArgumentT>
+class AtomicSharedFunction {
+ public:
+  static constexpr size_t kInlineSize = 6 * sizeof(void*);
+
+ private:
+  class Callable {
+   public:
+    virtual ~Callable() = default;
+    virtual void call(ArgumentT... args) const = 0;
+  };
+
+  template <typename FunctionT>
+  class ConcreteCallable final : public Callable {
+   public:
+    explicit ConcreteCallable(FunctionT&& function)
+        : function_(std::move(function)) {}
+    explicit ConcreteCallable(const FunctionT& function)
+        : function_(function) {}
+
+    void call(ArgumentT... args) const override {
+      function_(args...);
+    }
+
+   private:
+    FunctionT function_;
+  };
+
+  struct State {
+    ~State() {
+      if (isInline) {
+        std::launder(reinterpret_cast<Callable*>(&buffer))->~Callable();
+      }
+    }
+
+    std::atomic<const Callable*> current{nullptr};
+    std::mutex mutex{};
+    std::vector<std::unique_ptr<const Callable>> assignedCallables{};
+    bool isInline{false};
+    alignas(std::max_align_t) std::byte buffer[kInlineSize];
+  };
+
+  template <typename FunctionT>
+  static constexpr bool isInlineable = sizeof(ConcreteCallable<FunctionT>) <=
+          kInlineSize &&
+      alignof(ConcreteCallable<FunctionT>) <= alignof(std::max_align_t);
+
+  template <typename FunctionT>
+  static bool isEmpty(const FunctionT& function) {
+    if constexpr (std::is_constructible_v<bool, const FunctionT&>) {
+      return !static_cast<bool>(function);
+    } else {
+      return false;
+    }
+  }
+
+ public:
+  AtomicSharedFunction() : state_(std::make_shared<State>()) {}
+
+  template <
+      typename FunctionT,
+      typename = std::enable_if_t<
+          !std::is_same_v<std::decay_t<FunctionT>, AtomicSharedFunction>>>
+  AtomicSharedFunction(FunctionT&& function) : AtomicSharedFunction() {
+    using DecayedFunctionT = std::decay_t<FunctionT>;
+    if constexpr (std::is_null_pointer_v<DecayedFunctionT>) {
+      return;
+    } else if (isEmpty(function)) {
+      return;
+    } else if constexpr (isInlineable<DecayedFunctionT>) {
+      auto callable = new (&state_->buffer)
+          ConcreteCallable<DecayedFunctionT>(std::forward<FunctionT>(function));
+      state_->isInline = true;
+      state_->current.store(callable, std::memory_order_release);
+    } else {
+      assign(std::forward<FunctionT>(function));
+    }
+  }
+
+  AtomicSharedFunction(const AtomicSharedFunction& other) = default;
+  AtomicSharedFunction(AtomicSharedFunction&& other) noexcept = default;
+
+  AtomicSharedFunction& operator=(const AtomicSharedFunction& other) = default;
+  AtomicSharedFunction& operator=(AtomicSharedFunction&& other) noexcept =
+      default;
+
+  /*
+   * Replaces the stored callable in all copies. Calls that already started
+   * keep running the previous one.
+   */
+  template <typename FunctionT>
+  void assign(FunctionT&& function) const {
+    using DecayedFunctionT = std::decay_t<FunctionT>;
+    std::scoped_lock lock(state_->mutex);
+    if constexpr (std::is_null_pointer_v<DecayedFunctionT>) {
+      state_->current.store(nullptr, std::memory_order_release);
+    } else if (isEmpty(function)) {
+      state_->current.store(nullptr, std::memory_order_release);
+    } else {
+      state_->assignedCallables.push_back(
+          std::make_unique<const ConcreteCallable<DecayedFunctionT>>(
+              std::forward<FunctionT>(function)));
+      state_->current.store(
+          state_->assignedCallables.back().get(), std::memory_order_release);
+    }
+  }
+
+  void operator()(ArgumentT... args) const {
+    if (auto callable = state_->current.load(std::memory_order_acquire)) {
+      callable->call(args...);
+    }
+  }
+
+ private:
+  std::shared_ptr<State> state_;
+};
+
+} // namespace facebook::react
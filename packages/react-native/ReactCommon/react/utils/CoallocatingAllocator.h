@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace facebook::react {
+
+/*
+ * Heap block which objects created together, but living independently of
+ * each other, are allocated from (e.g. with `std::allocate_shared`, see
+ * `allocateCoallocatedShared`), so that creating them takes one allocation
+ * and they lie next to each other in memory.
+ *
+ * Objects are destroyed whenever their owners release them, as usual; only
+ * their memory is kept (and never reused) until all objects of the block and
+ * its creator released it. Objects which don't fit into the block anymore are
+ * allocated on the heap. Allocating and releasing is thread-safe.
+ */
+class alignas(std::max_align_t) CoallocationBlock final {
+ public:
+  /*
+   * Returns an estimate of the capacity which objects of the given types and
+   * their control blocks need when allocated with `std::allocate_shared`.
+   */
+  template <typename... T>
+  static constexpr size_t capacityFor() {
+    return ((sizeof(T) + alignof(T) + kControlBlockSize) + ... + 0);
+  }
+
+  /*
+   * Creates a block of the given capacity, retained by the caller, which has
+   * to `release` it once it allocated its objects.
+   */
+  static CoallocationBlock* create(size_t capacity) {
+    auto memory = ::operator new(sizeof(CoallocationBlock) + capacity);
+    return new (memory) CoallocationBlock(capacity);
+  }
+
+  /*
+   * Returns memory for an object from the block and retains the block for
+   * it, or `nullptr` if the object doesn't fit into the rest of the block.
+   */
+  void* allocate(size_t size, size_t alignment) noexcept {
+    auto start = reinterpret_cast<uintptr_t>(storage());
+    auto used = used_.load(std::memory_order_relaxed);
+    while (true) {
+      auto offset =
+          ((start + used + alignment - 1) & ~(alignment - 1)) - start;
+      if (offset + size > capacity_) {
+        return nullptr;
+      }
+      if (used_.compare_exchange_weak(
+              used, offset + size, std::memory_order_relaxed)) {
+        retain();
+        return storage() + offset;
+      }
+    }
+  }
+
+  /*
+   * Returns `true` if the memory was allocated from the block.
+   */
+  bool contains(const void* pointer) const noexcept {
+    auto address = reinterpret_cast<uintptr_t>(pointer);
+    auto start = reinterpret_cast<uintptr_t>(storage());
+    return address >= start && address < start + capacity_;
+  }
+
+  void retain() noexcept {
+    referenceCount_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /*
+   * Frees the block once the last object allocated from it and its creator
+   * released it.
+   */
+  void release() noexcept {
+    if (referenceCount_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      this->~CoallocationBlock();
+      ::operator delete(this);
+    }
+  }
+
+ private:
+  // Room for the reference counts, the virtual table pointer and the
+  // allocator of a control block of `std::allocate_shared`.
+  static constexpr size_t kControlBlockSize = 4 * sizeof(void*);
+
+  explicit CoallocationBlock(size_t capacity) : capacity_(capacity) {}
+
+  unsigned char* storage() noexcept {
+    return reinterpret_cast<unsigned char*>(this + 1);
+  }
+
+  const unsigned char* storage() const noexcept {
+    return reinterpret_cast<const unsigned char*>(this + 1);
+  }
+
+  const size_t capacity_;
+  std::atomic<size_t> used_{0};
+  std::atomic<size_t> referenceCount_{1};
+};
+
+/*
+ * Allocator which allocates from a `CoallocationBlock`, and from the heap
+ * once the block is full. Every allocation retains the block.
+ */
+template <typename T>
+class CoallocatingAllocator final {
+ public:
+  using value_type = T;
+
+  explicit CoallocatingAllocator(CoallocationBlock& block) noexcept
+      : block_(&block) {}
+
+  template <typename OtherT>
+  CoallocatingAllocator(const CoallocatingAllocator<OtherT>& other) noexcept
+      : block_(other.block_) {}
+
+  T* allocate(size_t count) {
+    if (auto memory = block_->allocate(count * sizeof(T), alignof(T))) {
+      return static_cast<T*>(memory);
+    }
+    // Retained all the same, so that `deallocate` can tell heap memory apart.
+    block_->retain();
+    if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+      return static_cast<T*>(
+          ::operator new(count * sizeof(T), std::align_val_t{alignof(T)}));
+    } else {
+      return static_cast<T*>(::operator new(count * sizeof(T)));
+    }
+  }
+
+  void deallocate(T* memory, size_t /*count*/) noexcept {
+    if (!block_->contains(memory)) {
+      if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        ::operator delete(memory, std::align_val_t{alignof(T)});
+      } else {
+        ::operator delete(memory);
+      }
+    }
+    block_->release();
+  }
+
+  template <typename OtherT>
+  bool operator==(const CoallocatingAllocator<OtherT>& rhs) const noexcept {
+    return block_ == rhs.block_;
+  }
+
+  template <typename OtherT>
+  bool operator!=(const CoallocatingAllocator<OtherT>& rhs) const noexcept {
+    return block_ != rhs.block_;
+  }
+
+ private:
+  template <typename OtherT>
+  friend class CoallocatingAllocator;
+
+  CoallocationBlock* block_;
+};
+
+/*
+ * Equivalent of `std::make_shared` which allocates the object and its control
+ * block from `block`.
+ */
+template <typename T, typename... ArgsT>
+std::shared_ptr<T> allocateCoallocatedShared(
+    CoallocationBlock& block,
+    ArgsT&&... args) {
+  return std::allocate_shared<T>(
+      CoallocatingAllocator<T>{block}, std::forward<ArgsT>(args)...);
+}
+
+} // namespace facebook::react
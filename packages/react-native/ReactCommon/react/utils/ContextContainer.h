@@ -7,12 +7,16 @@
 
 #pragma once
 
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
-#include <shared_mutex>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include <react/debug/flags.h>
 #include <react/debug/react_native_assert.h>
@@ -22,11 +26,39 @@ namespace facebook::react {
 /*
  * General purpose dependency injection container.
  * Instance types must be copyable.
+ *
+ * Lookups do not lock: they read an immutable snapshot of the instances,
+ * which modifications (that normally happen only during setup) replace.
  */
 class ContextContainer final {
  public:
   using Shared = std::shared_ptr<const ContextContainer>;
 
+  /*
+   * A typed key with a precomputed hash. Lookups on hot paths should use
+   * keys stored in static variables instead of plain strings.
+   */
+  template <typename T>
+  class Key final {
+   public:
+    explicit Key(std::string name)
+        : name_(std::move(name)), hash_(std::hash<std::string>{}(name_)) {}
+
+    const std::string& getName() const {
+      return name_;
+    }
+
+   private:
+    friend class ContextContainer;
+
+    std::string name_;
+    size_t hash_;
+  };
+
+  ContextContainer() = default;
+  ContextContainer(const ContextContainer&) = delete;
+  ContextContainer& operator=(const ContextContainer&) = delete;
+
   /*
    * Registers an instance of the particular type `T` in the container
    * using the provided `key`. Only one instance can be registered per key.
@@ -40,9 +72,9 @@ class ContextContainer final {
    */
   template <typename T>
   void insert(const std::string& key, T const& instance) const {
-    std::unique_lock lock(mutex_);
-
-    instances_.insert({key, std::make_shared<T>(instance)});
+    modify([&](Instances& instances) {
+      instances.insert({key, std::make_shared<T>(instance)});
+    });
   }
 
   /*
@@ -50,9 +82,7 @@ class ContextContainer final {
    * Does nothing if the instance was not found.
    */
   void erase(const std::string& key) const {
-    std::unique_lock lock(mutex_);
-
-    instances_.erase(key);
+    modify([&](Instances& instances) { instances.erase(key); });
   }
 
   /*
@@ -61,12 +91,13 @@ class ContextContainer final {
    * values from the given container.
    */
   void update(const ContextContainer& contextContainer) const {
-    std::unique_lock lock(mutex_);
-
-    for (const auto& pair : contextContainer.instances_) {
-      instances_.erase(pair.first);
-      instances_.insert(pair);
-    }
+    auto reading = Reading{contextContainer};
+    modify([&](Instances& instances) {
+      for (const auto& pair : reading.getInstances()) {
+        instances.erase(pair.first);
+        instances.insert(pair);
+      }
+    });
   }
 
   /*
@@ -75,13 +106,23 @@ class ContextContainer final {
    * Throws an exception if the instance could not be found.
    */
   template <typename T>
-  T at(const std::string& key) const {
-    std::shared_lock lock(mutex_);
+  T at(const Key<T>& key) const {
+    auto reading = Reading{*this};
+    const auto& instances = reading.getInstances();
+    auto iterator = instances.find(KeyView{key.name_, key.hash_});
 
     react_native_assert(
-        instances_.find(key) != instances_.end() &&
+        iterator != instances.end() &&
         "ContextContainer doesn't have an instance for given key.");
-    return *static_cast<T*>(instances_.at(key).get());
+    if (iterator == instances.end()) {
+      throw std::out_of_range("ContextContainer doesn't have " + key.name_);
+    }
+    return *static_cast<T*>(iterator->second.get());
+  }
+
+  template <typename T>
+  T at(const std::string& key) const {
+    return at(Key<T>{key});
   }
 
   /*
@@ -90,21 +131,122 @@ class ContextContainer final {
    * Returns an empty optional if the instance could not be found.
    */
   template <typename T>
-  std::optional<T> find(const std::string& key) const {
-    std::shared_lock lock(mutex_);
-
-    auto iterator = instances_.find(key);
-    if (iterator == instances_.end()) {
+  std::optional<T> find(const Key<T>& key) const {
+    auto reading = Reading{*this};
+    const auto& instances = reading.getInstances();
+    auto iterator = instances.find(KeyView{key.name_, key.hash_});
+    if (iterator == instances.end()) {
       return {};
     }
 
     return *static_cast<T*>(iterator->second.get());
   }
 
+  template <typename T>
+  std::optional<T> find(const std::string& key) const {
+    return find(Key<T>{key});
+  }
+
  private:
-  mutable std::shared_mutex mutex_;
-  // Protected by mutex_`.
-  mutable std::unordered_map<std::string, std::shared_ptr<void>> instances_;
+  struct KeyView {
+    std::string_view name;
+    size_t hash;
+  };
+
+  struct KeyHash {
+    using is_transparent = void;
+
+    size_t operator()(const std::string& name) const {
+      return std::hash<std::string>{}(name);
+    }
+
+    size_t operator()(const KeyView& key) const {
+      return key.hash;
+    }
+  };
+
+  struct KeyEqual {
+    using is_transparent = void;
+
+    bool operator()(const std::string& lhs, const std::string& rhs) const {
+      return lhs == rhs;
+    }
+
+    bool operator()(const KeyView& lhs, const std::string& rhs) const {
+      return lhs.name == rhs;
+    }
+
+    bool operator()(const std::string& lhs, const KeyView& rhs) const {
+      return lhs == rhs.name;
+    }
+  };
+
+  using Instances = std::unordered_map<
+      std::string,
+      std::shared_ptr<void>,
+      KeyHash,
+      KeyEqual>;
+
+  /*
+   * Pins the current snapshot of instances for the lifetime of the object.
+   */
+  class Reading final {
+   public:
+    explicit Reading(const ContextContainer& contextContainer)
+        : readers_(contextContainer.readers_) {
+      readers_.fetch_add(1);
+      instances_ = contextContainer.instances_.load();
+    }
+
+    ~Reading() {
+      readers_.fetch_sub(1);
+    }
+
+    Reading(const Reading&) = delete;
+    Reading& operator=(const Reading&) = delete;
+
+    const Instances& getInstances() const {
+      return *instances_;
+    }
+
+   private:
+    std::atomic<size_t>& readers_;
+    const Instances* instances_;
+  };
+
+  /*
+   * Publishes a modified copy of the current snapshot. Replaced snapshots are
+   * destroyed as soon as no lookup might be reading them.
+   */
+  void modify(const std::function<void(Instances&)>& mutation) const {
+    std::lock_guard lock(mutex_);
+
+    auto instances = std::make_unique<Instances>(*instances_);
+    mutation(*instances);
+
+    retiredInstances_.push_back(std::move(currentInstances_));
+    currentInstances_ = std::move(instances);
+    instances_.store(currentInstances_.get());
+
+    // Lookups which start after the store read the new snapshot, so if there
+    // are no lookups in progress now, none of them reads a replaced one.
+    if (readers_.load() == 0) {
+      retiredInstances_.clear();
+    }
+  }
+
+  // Serializes modifications.
+  mutable std::mutex mutex_;
+
+  // The number of lookups in progress.
+  mutable std::atomic<size_t> readers_{0};
+
+  // Protected by `mutex_`.
+  mutable std::unique_ptr<const Instances> currentInstances_{
+      std::make_unique<const Instances>()};
+  mutable std::vector<std::unique_ptr<const Instances>> retiredInstances_;
+
+  mutable std::atomic<const Instances*> instances_{currentInstances_.get()};
 };
 
 } // namespace facebook::react
@@ -17,5 +17,41 @@ bool CoreFeatures::enableGranularShadowTreeStateReconciliation = false;
 bool CoreFeatures::enableClonelessStateProgression = false;
 bool CoreFeatures::excludeYogaFromRawProps = false;
 bool CoreFeatures::enableReportEventPaintTime = false;
+bool CoreFeatures::enableParallelDifferentiator = false;
+bool CoreFeatures::enableDifferentiatorMinimalMoves = false;
+bool CoreFeatures::enableMountingTransactionCompaction = false;
+bool CoreFeatures::enableOptimisticShadowTreeCommit = false;
+bool CoreFeatures::enablePooledMountBuffers = false;
+bool CoreFeatures::enableProgressiveMounting = false;
+bool CoreFeatures::enableYogaLayoutReuse = false;
+bool CoreFeatures::enableParagraphPreMeasurement = false;
+bool CoreFeatures::enableBatchedTextMeasurement = false;
+bool CoreFeatures::enableTextMeasureRangeCache = false;
+bool CoreFeatures::enableSkippingUnchangedRawProps = false;
+bool CoreFeatures::enableMinimalPropsUpdates = false;
+bool CoreFeatures::enablePropsInterning = false;
+bool CoreFeatures::enablePooledShadowNodeAllocation = false;
+bool CoreFeatures::enableRuntimeSchedulerTelemetry = false;
+bool CoreFeatures::enableBatchedTimers = false;
+bool CoreFeatures::enableImageRequestDeduplication = false;
+bool CoreFeatures::enableBackgroundIntersectionObservation = false;
+bool CoreFeatures::enableConcurrentSurfaceCompletion = false;
+bool CoreFeatures::enableStickyViewUnflattening = false;
+bool CoreFeatures::enableJSHeapSampling = false;
+bool CoreFeatures::enableSkippingUnchangedYogaStyles = false;
+bool CoreFeatures::enableIncrementalYogaChildrenUpdates = false;
+bool CoreFeatures::enableYogaLayoutTemplates = false;
+bool CoreFeatures::enableArmedEventBeats = false;
+bool CoreFeatures::enableImmediateDiscreteEvents = false;
+bool CoreFeatures::enableAnimatedPropsOverlay = false;
+bool CoreFeatures::enableBatchedMounting = false;
+bool CoreFeatures::enableIncrementalTextInputUpdates = false;
+bool CoreFeatures::enableThrottledScrollViewStateUpdates = false;
+bool CoreFeatures::enableCommitLoadShedding = false;
+bool CoreFeatures::enablePipelinedMountPreparation = false;
+bool CoreFeatures::enableLazyRawPropsParserPreparation = false;
+bool CoreFeatures::enableCommitCapture = false;
+bool CoreFeatures::enableProcessWideTextMeasureCache = false;
+bool CoreFeatures::enableCoallocatedShadowNodeFamilies = false;
 
 } // namespace facebook::react
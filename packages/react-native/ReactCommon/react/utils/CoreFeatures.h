@@ -45,6 +45,187 @@ class CoreFeatures {
   // Report paint time inside the Event Timing API implementation
   // (PerformanceObserver).
   static bool enableReportEventPaintTime;
+
+  // When enabled, the Differentiator diffs independent sibling subtrees
+  // concurrently on a small pool of worker threads.
+  static bool enableParallelDifferentiator;
+
+  // When enabled, the Differentiator keeps the longest run of reordered
+  // children that are still in order in place and only moves the rest.
+  static bool enableDifferentiatorMinimalMoves;
+
+  // When enabled, MountingCoordinator drops mutations that cancel each other
+  // out (e.g. a view created and deleted in the same transaction) before
+  // handing a transaction over to the mounting layer.
+  static bool enableMountingTransactionCompaction;
+
+  // When enabled, ShadowTree commits fail fast (and get retried) as soon as
+  // their base revision becomes stale and hold the commit lock only to publish
+  // the new revision.
+  static bool enableOptimisticShadowTreeCommit;
+
+  // When enabled, Android serializes mount instructions into pooled direct
+  // ByteBuffers which are reused across commits instead of allocating new Java
+  // arrays for every batch.
+  static bool enablePooledMountBuffers;
+
+  // When enabled, MountingCoordinator splits transactions which mount many new
+  // views so that views within the viewport of the surface mount first and
+  // off-screen ones mount in following frames.
+  static bool enableProgressiveMounting;
+
+  // When enabled, clones of measurable Yoga nodes (e.g. paragraphs) keep the
+  // layout of their source unless their props, children or state change,
+  // instead of always being measured again.
+  static bool enableYogaLayoutReuse;
+
+  // When enabled, paragraphs with dirty layout start measuring their text on
+  // a background executor before the layout of the tree is calculated, so the
+  // layout mostly finds their measurements in `TextMeasureCache`.
+  static bool enableParagraphPreMeasurement;
+
+  // When enabled, Yoga measures the paragraphs among the children of a node
+  // together, which lets Android measure their text with a single JNI call.
+  static bool enableBatchedTextMeasurement;
+
+  // When enabled, text measurements are reused at other maximum widths that
+  // lay the text out the same way (see `TextMeasureRangeCache`).
+  static bool enableTextMeasureRangeCache;
+
+  // When enabled, values of the raw props of clones which are equal to the
+  // values their source props were parsed from are not converted again.
+  static bool enableSkippingUnchangedRawProps;
+
+  // When enabled, Android sends only the raw props whose values changed since
+  // the mounted props with Update mutations.
+  static bool enableMinimalPropsUpdates;
+
+  // When enabled, nodes of types opting into it (see `PropsInternable`) which
+  // are created with equal raw props share one instance of props.
+  static bool enablePropsInterning;
+
+  // When enabled, shadow nodes, their props and lists of children are
+  // allocated from per-thread pools of freed blocks (see `PooledAllocator`).
+  static bool enablePooledShadowNodeAllocation;
+
+  // When enabled, RuntimeScheduler aggregates how long tasks wait and run
+  // for each priority (see `RuntimeSchedulerTelemetry`).
+  static bool enableRuntimeSchedulerTelemetry;
+
+  // When enabled, TimerManager keeps timers in a queue of its own and arms a
+  // single platform timer for the earliest one; expired timers then fire
+  // together within one call into the runtime.
+  static bool enableBatchedTimers;
+
+  // When enabled, ImageManager shares the loads of requests for equal image
+  // sources which are alive at the same time (see `ImageRequestDeduplicator`).
+  static bool enableImageRequestDeduplication;
+
+  // When enabled, IntersectionObserver observes mounted trees on a background
+  // thread at most 10 times per second, instead of on every mount within the
+  // mount hook.
+  static bool enableBackgroundIntersectionObservation;
+
+  // When enabled, the platforms complete surfaces on a concurrent background
+  // executor, so that surfaces updated together are laid out and diffed in
+  // parallel (see `SurfaceCompletionQueue`).
+  static bool enableConcurrentSurfaceCompletion;
+
+  // When enabled, views which switched between forming a view and being
+  // flattened a few times keep forming a view, so that the Differentiator
+  // doesn't reparent their children again each time.
+  static bool enableStickyViewUnflattening;
+
+  // When enabled, ReactInstance samples the JS heap at most once per second
+  // at the end of JS tasks and records the garbage collections of the VM, for
+  // traces and telemetry (see `JSHeapSampler`).
+  static bool enableJSHeapSampling;
+
+  // When enabled, clones of Yoga nodes whose props didn't change any Yoga
+  // style prop keep the style of their source instead of converting and
+  // comparing it again.
+  static bool enableSkippingUnchangedYogaStyles;
+
+  // When enabled, clones of Yoga nodes with new children only insert and
+  // remove the Yoga children that changed, instead of rebuilding (and
+  // cloning) all of them.
+  static bool enableIncrementalYogaChildrenUpdates;
+
+  // When enabled, fresh subtrees without measurable nodes (e.g. the ones of
+  // list cells) take over the layout of an identical subtree laid out before
+  // (see `YogaLayoutTemplateCache`).
+  static bool enableYogaLayoutTemplates;
+
+  // When enabled, the event beats driven by run loop observers only observe
+  // the run loop after events were enqueued, and beat once before the next
+  // frame, instead of being called on every iteration of the run loop.
+  static bool enableArmedEventBeats;
+
+  // When enabled, discrete events (e.g. the start and the end of a touch)
+  // enqueued for asynchronous batched dispatch are flushed right away at
+  // immediate priority through `RuntimeScheduler`, instead of waiting for the
+  // next beat with the continuous events (e.g. scroll or touch moves).
+  static bool enableImmediateDiscreteEvents;
+
+  // When enabled, `setNativeProps` updates which only change how views are
+  // drawn (e.g. opacity, transform or colors) are mounted without a commit
+  // and folded into the shadow tree with the next commit of the surface
+  // (see `AnimatedPropsOverlay`).
+  static bool enableAnimatedPropsOverlay;
+
+  // When enabled, iOS mounts a transaction inside a single `CATransaction`
+  // with implicit animations disabled, applies the updates of every view once
+  // after the structural mutations, and finalizes the updates of all views in
+  // one pass at the end.
+  static bool enableBatchedMounting;
+
+  // When enabled, state updates of <TextInput> on Android describe the range
+  // of the text edited since the previous update, so that only that range of
+  // the text of the view is replaced (and laid out again), and the attributed
+  // string of the node is built once per layout instead of on every
+  // measurement.
+  static bool enableIncrementalTextInputUpdates;
+
+  // When enabled, ScrollViews being scrolled by the user only update their
+  // state with the content offset when something in C++ reads it (e.g. to
+  // measure views or compute intersections), at most every
+  // `ScrollViewShadowNode::stateUpdateIntervalWhileScrollingMs`, and
+  // otherwise only once scrolling ends.
+  static bool enableThrottledScrollViewStateUpdates;
+
+  // When enabled, commits from React made while the platform is still
+  // mounting the previous ones don't notify it to mount, so that intermediate
+  // revisions are never diffed and the platform mounts the newest revision
+  // once it caught up (see `MountingCoordinator::didMountTransactions`).
+  static bool enableCommitLoadShedding;
+
+  // When enabled, transactions committed by completions on the background
+  // executor are diffed and serialized on another thread of it, overlapping
+  // the completion of the next revision of the surface. Android only.
+  static bool enablePipelinedMountPreparation;
+
+  // When enabled, component descriptors prepare their parser of raw props
+  // (which parses default props of the component to record their names) when
+  // they first parse props, rather than when the registry creates them, so
+  // startup doesn't pay for components which are never rendered.
+  static bool enableLazyRawPropsParserPreparation;
+
+  // When enabled, props keep the raw props they were parsed from, merged with
+  // those of the props they were cloned from, so that CommitCaptureHook can
+  // capture them. Has no effect on Yoga style props if
+  // excludeYogaFromRawProps is enabled too.
+  static bool enableCommitCapture;
+
+  // When enabled, all TextLayoutManagers of the process (e.g. of several
+  // React instances) share one cache of text measurements, which lives as
+  // long as any of them does.
+  static bool enableProcessWideTextMeasureCache;
+
+  // When enabled, component descriptors allocate a new shadow node family,
+  // its event emitter and event target, and its initial state and state data
+  // from one block of memory (see `CoallocationBlock`), rather than each of
+  // them separately.
+  static bool enableCoallocatedShadowNodeFamilies;
 };
 
 } // namespace facebook::react
@@ -0,0 +1,415 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/debug/react_native_assert.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Hash map for integer keys (e.g. `Tag`s) which stores its entries in a
+ * single array with open addressing and linear probing, instead of allocating
+ * a node per entry like `std::unordered_map`. Lookups of the mostly
+ * sequential tags of the renderer touch one or two cache lines.
+ *
+ * The API is a subset of `std::unordered_map`'s, with weaker guarantees:
+ *  - inserting an entry invalidates all iterators and references;
+ *  - erasing an entry invalidates all iterators and references, so `erase`
+ *    doesn't return the next iterator;
+ *  - keys must not be modified through iterators.
+ */
+template <typename KeyT, typename ValueT>
+class FlatMap final {
+  static_assert(
+      std::is_integral_v<KeyT> || std::is_enum_v<KeyT>,
+      "FlatMap is tuned for integer keys.");
+
+  using Slot = std::optional<std::pair<KeyT, ValueT>>;
+
+ public:
+  using key_type = KeyT;
+  using mapped_type = ValueT;
+  using value_type = std::pair<KeyT, ValueT>;
+  using size_type = size_t;
+
+  template <bool isConst>
+  class Iterator final {
+    using SlotsT = std::
+        conditional_t<isConst, const std::vector<Slot>, std::vector<Slot>>;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename FlatMap::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<isConst, const value_type*, value_type*>;
+    using reference =
+        std::conditional_t<isConst, const value_type&, value_type&>;
+
+    Iterator() = default;
+    Iterator(SlotsT* slots, size_t index) : slots_(slots), index_(index) {
+      skipEmptySlots();
+    }
+
+    // Allows converting iterators to const iterators.
+    operator Iterator<true>() const {
+      return {slots_, index_};
+    }
+
+    reference operator*() const {
+      return *(*slots_)[index_];
+    }
+
+    pointer operator->() const {
+      return &*(*slots_)[index_];
+    }
+
+    Iterator& operator++() {
+      index_++;
+      skipEmptySlots();
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    bool operator==(const Iterator& other) const {
+      return index_ == other.index_;
+    }
+
+   private:
+    friend class FlatMap;
+
+    void skipEmptySlots() {
+      while (index_ < slots_->size() && !(*slots_)[index_].has_value()) {
+        index_++;
+      }
+    }
+
+    SlotsT* slots_{nullptr};
+    size_t index_{0};
+  };
+
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  FlatMap() = default;
+
+  iterator begin() {
+    return {&slots_, 0};
+  }
+
+  iterator end() {
+    return {&slots_, slots_.size()};
+  }
+
+  const_iterator begin() const {
+    return {&slots_, 0};
+  }
+
+  const_iterator end() const {
+    return {&slots_, slots_.size()};
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  bool empty() const {
+    return size_ == 0;
+  }
+
+  void clear() {
+    slots_.clear();
+    size_ = 0;
+  }
+
+  /*
+   * Makes room for `count` entries without rehashing.
+   */
+  void reserve(size_t count) {
+    auto capacity = kMinimalCapacity;
+    while (capacity * kMaxLoadNumerator < count * kMaxLoadDenominator) {
+      capacity *= 2;
+    }
+    if (capacity > slots_.size()) {
+      rehash(capacity);
+    }
+  }
+
+  iterator find(KeyT key) {
+    return {&slots_, findIndex(key)};
+  }
+
+  const_iterator find(KeyT key) const {
+    return {&slots_, findIndex(key)};
+  }
+
+  bool contains(KeyT key) const {
+    return findIndex(key) != slots_.size();
+  }
+
+  size_t count(KeyT key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  ValueT& at(KeyT key) {
+    auto index = findIndex(key);
+    if (index == slots_.size()) {
+      throw std::out_of_range("FlatMap::at: key not found");
+    }
+    return slots_[index]->second;
+  }
+
+  const ValueT& at(KeyT key) const {
+    return const_cast<FlatMap*>(this)->at(key);
+  }
+
+  ValueT& operator[](KeyT key) {
+    return try_emplace(key).first->second;
+  }
+
+  template <typename... ArgsT>
+  std::pair<iterator, bool> try_emplace(KeyT key, ArgsT&&... args) {
+    if (auto index = findIndex(key); index != slots_.size()) {
+      return {{&slots_, index}, false};
+    }
+
+    if ((size_ + 1) * kMaxLoadDenominator >
+        slots_.size() * kMaxLoadNumerator) {
+      rehash(std::max(kMinimalCapacity, slots_.size() * 2));
+    }
+
+    auto index = idealIndex(key);
+    while (slots_[index].has_value()) {
+      index = (index + 1) & mask();
+    }
+    slots_[index].emplace(
+        std::piecewise_construct,
+        std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<ArgsT>(args)...));
+    size_++;
+    return {{&slots_, index}, true};
+  }
+
+  std::pair<iterator, bool> insert(value_type value) {
+    return try_emplace(value.first, std::move(value.second));
+  }
+
+  template <typename... ArgsT>
+  std::pair<iterator, bool> emplace(KeyT key, ArgsT&&... args) {
+    return try_emplace(key, std::forward<ArgsT>(args)...);
+  }
+
+  size_t erase(KeyT key) {
+    auto index = findIndex(key);
+    if (index == slots_.size()) {
+      return 0;
+    }
+    eraseIndex(index);
+    return 1;
+  }
+
+  void erase(const_iterator it) {
+    react_native_assert(it.slots_ == &slots_ && it.index_ < slots_.size());
+    eraseIndex(it.index_);
+  }
+
+ private:
+  static constexpr size_t kMinimalCapacity = 8;
+  static constexpr size_t kMaxLoadNumerator = 3;
+  static constexpr size_t kMaxLoadDenominator = 4;
+
+  size_t mask() const {
+    return slots_.size() - 1;
+  }
+
+  size_t idealIndex(KeyT key) const {
+    // Fibonacci hashing spreads sequential keys (and keys that are multiples
+    // of each other, like the even tags created by JS) over the whole array.
+    auto hash = static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(hash >> 32) & mask();
+  }
+
+  size_t findIndex(KeyT key) const {
+    if (size_ == 0) {
+      return slots_.size();
+    }
+    for (auto index = idealIndex(key);; index = (index + 1) & mask()) {
+      const auto& slot = slots_[index];
+      if (!slot.has_value()) {
+        return slots_.size();
+      }
+      if (slot->first == key) {
+        return index;
+      }
+    }
+  }
+
+  void rehash(size_t capacity) {
+    auto slots = std::vector<Slot>(capacity);
+    std::swap(slots, slots_);
+    for (auto& slot : slots) {
+      if (slot.has_value()) {
+        auto index = idealIndex(slot->first);
+        while (slots_[index].has_value()) {
+          index = (index + 1) & mask();
+        }
+        slots_[index] = std::move(slot);
+      }
+    }
+  }
+
+  void eraseIndex(size_t index) {
+    slots_[index].reset();
+    size_--;
+
+    // Shifts the following entries of the probe sequence back, so lookups
+    // don't need tombstones.
+    auto hole = index;
+    for (auto next = (hole + 1) & mask(); slots_[next].has_value();
+         next = (next + 1) & mask()) {
+      auto ideal = idealIndex(slots_[next]->first);
+      // An entry can fill the hole if its ideal slot isn't cyclically in
+      // (hole, next].
+      auto distanceToNext = (next - ideal) & mask();
+      auto distanceToHole = (hole - ideal) & mask();
+      if (distanceToHole < distanceToNext) {
+        slots_[hole] = std::move(slots_[next]);
+        slots_[next].reset();
+        hole = next;
+      }
+    }
+  }
+
+  std::vector<Slot> slots_{};
+  size_t size_{0};
+};
+
+/*
+ * Set of integer keys with the layout and guarantees of `FlatMap`.
+ */
+template <typename KeyT>
+class FlatSet final {
+  struct Empty {};
+  using MapT = FlatMap<KeyT, Empty>;
+
+ public:
+  using key_type = KeyT;
+  using value_type = KeyT;
+  using size_type = size_t;
+
+  class const_iterator final {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = KeyT;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const KeyT*;
+    using reference = const KeyT&;
+
+    const_iterator() = default;
+    explicit const_iterator(typename MapT::const_iterator it) : it_(it) {}
+
+    reference operator*() const {
+      return it_->first;
+    }
+
+    pointer operator->() const {
+      return &it_->first;
+    }
+
+    const_iterator& operator++() {
+      ++it_;
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      auto copy = *this;
+      ++it_;
+      return copy;
+    }
+
+    bool operator==(const const_iterator& other) const {
+      return it_ == other.it_;
+    }
+
+   private:
+    friend class FlatSet;
+
+    typename MapT::const_iterator it_{};
+  };
+
+  using iterator = const_iterator;
+
+  const_iterator begin() const {
+    return const_iterator{map_.begin()};
+  }
+
+  const_iterator end() const {
+    return const_iterator{map_.end()};
+  }
+
+  size_t size() const {
+    return map_.size();
+  }
+
+  bool empty() const {
+    return map_.empty();
+  }
+
+  void clear() {
+    map_.clear();
+  }
+
+  void reserve(size_t count) {
+    map_.reserve(count);
+  }
+
+  const_iterator find(KeyT key) const {
+    return const_iterator{map_.find(key)};
+  }
+
+  bool contains(KeyT key) const {
+    return map_.contains(key);
+  }
+
+  size_t count(KeyT key) const {
+    return map_.count(key);
+  }
+
+  std::pair<const_iterator, bool> insert(KeyT key) {
+    auto [it, inserted] = map_.try_emplace(key);
+    return {const_iterator{it}, inserted};
+  }
+
+  size_t erase(KeyT key) {
+    return map_.erase(key);
+  }
+
+  void erase(const_iterator it) {
+    map_.erase(it.it_);
+  }
+
+ private:
+  MapT map_{};
+};
+
+} // namespace facebook::react
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "MemoryPressureCoordinator.h"
+
+#include <algorithm>
+#include <mutex>
+
+#include <react/debug/react_native_assert.h>
+
+namespace facebook::react {
+
+std::shared_ptr<MemoryPressureCoordinator>
+MemoryPressureCoordinator::fromContextContainer(
+    const ContextContainer::Shared& contextContainer) {
+  if (!contextContainer) {
+    return nullptr;
+  }
+  static const auto key =
+      ContextContainer::Key<std::shared_ptr<MemoryPressureCoordinator>>(
+          kContextContainerKey);
+  return contextContainer->find(key).value_or(nullptr);
+}
+
+void MemoryPressureCoordinator::registerListener(
+    MemoryPressureListener& listener) const {
+  std::unique_lock lock(mutex_);
+  react_native_assert(
+      std::find(listeners_.begin(), listeners_.end(), &listener) ==
+      listeners_.end());
+  listeners_.push_back(&listener);
+}
+
+void MemoryPressureCoordinator::unregisterListener(
+    MemoryPressureListener& listener) const {
+  std::unique_lock lock(mutex_);
+  auto iterator = std::find(listeners_.begin(), listeners_.end(), &listener);
+  if (iterator == listeners_.end()) {
+    react_native_assert(false && "Listener was not registered.");
+    return;
+  }
+  listeners_.erase(iterator);
+}
+
+void MemoryPressureCoordinator::trim(MemoryPressureLevel level) const {
+  // Holding the lock while calling listeners keeps them from being
+  // unregistered (and destroyed) in the meantime.
+  std::shared_lock lock(mutex_);
+  for (auto listener : listeners_) {
+    listener->didReceiveMemoryPressure(level);
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <shared_mutex>
+#include <vector>
+
+#include <react/utils/ContextContainer.h>
+
+namespace facebook::react {
+
+/*
+ * How much memory the app should give back, from the mildest signal to the
+ * most severe one. Listeners release everything the given level and the
+ * milder ones call for.
+ */
+enum class MemoryPressureLevel {
+  // The app went to the background: caches which only speed up the next
+  // updates of the UI can go.
+  Background,
+
+  // The system is running low on memory: caches should be trimmed down to
+  // what the visible UI needs.
+  Moderate,
+
+  // The system is about to kill processes: everything which can be rebuilt
+  // should be released.
+  Critical,
+};
+
+/*
+ * Something holding memory which can be released under memory pressure.
+ */
+class MemoryPressureListener {
+ public:
+  virtual ~MemoryPressureListener() noexcept = default;
+
+  /*
+   * Called on the thread the platform reported the memory pressure on.
+   * Must not register or unregister listeners.
+   */
+  virtual void didReceiveMemoryPressure(MemoryPressureLevel level) = 0;
+};
+
+/*
+ * Forwards memory pressure signals of the platform (e.g. memory warnings on
+ * iOS and `onTrimMemory` on Android) to the caches of the renderer.
+ * Platforms register one instance in the `ContextContainer`, and call `trim`
+ * when the system asks for memory.
+ * Can be called from any thread.
+ */
+class MemoryPressureCoordinator final {
+ public:
+  /*
+   * Key under which platforms register the coordinator in the
+   * `ContextContainer`.
+   */
+  static constexpr auto kContextContainerKey = "MemoryPressureCoordinator";
+
+  /*
+   * Returns the coordinator registered in `contextContainer`, if any.
+   */
+  static std::shared_ptr<MemoryPressureCoordinator> fromContextContainer(
+      const ContextContainer::Shared& contextContainer);
+
+  /*
+   * Registers a listener, which must be unregistered before it is destroyed.
+   */
+  void registerListener(MemoryPressureListener& listener) const;
+  void unregisterListener(MemoryPressureListener& listener) const;
+
+  /*
+   * Calls all listeners with `level`, and returns once they are done.
+   */
+  void trim(MemoryPressureLevel level) const;
+
+ private:
+  mutable std::shared_mutex mutex_;
+  mutable std::vector<MemoryPressureListener*> listeners_;
+};
+
+} // namespace facebook::react
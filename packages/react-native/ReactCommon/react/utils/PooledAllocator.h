@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace facebook::react {
+
+/*
+ * Allocator which keeps freed blocks of one object in a pool of the current
+ * thread and hands them out again, instead of going through the heap for
+ * every allocation. Meant for objects allocated and freed at a high rate,
+ * e.g. with `std::allocate_shared` (see `allocatePooledShared`), where the
+ * block holds both the object and its control block.
+ *
+ * Each thread keeps up to `kMaxPooledBlocks` blocks of each type. Blocks
+ * freed on another thread than the one they were allocated on join the pool
+ * of the freeing thread.
+ */
+template <typename T>
+class PooledAllocator final {
+ public:
+  using value_type = T;
+
+  /*
+   * Maximum number of freed blocks kept by a thread for one type.
+   */
+  static constexpr size_t kMaxPooledBlocks = 256;
+
+  PooledAllocator() noexcept = default;
+
+  template <typename OtherT>
+  PooledAllocator(const PooledAllocator<OtherT>& /*other*/) noexcept {}
+
+  T* allocate(size_t count) {
+    if (count == 1) {
+      if (auto pool = Pool::get(); pool && pool->size > 0) {
+        return static_cast<T*>(pool->blocks[--pool->size]);
+      }
+    }
+    return static_cast<T*>(allocateBlock(count));
+  }
+
+  void deallocate(T* block, size_t count) noexcept {
+    if (count == 1) {
+      if (auto pool = Pool::get(); pool && pool->size < kMaxPooledBlocks) {
+        pool->blocks[pool->size++] = block;
+        return;
+      }
+    }
+    deallocateBlock(block, count);
+  }
+
+  template <typename OtherT>
+  bool operator==(const PooledAllocator<OtherT>& /*rhs*/) const noexcept {
+    return true;
+  }
+
+  template <typename OtherT>
+  bool operator!=(const PooledAllocator<OtherT>& /*rhs*/) const noexcept {
+    return false;
+  }
+
+ private:
+  struct Pool {
+    std::array<void*, kMaxPooledBlocks> blocks;
+    size_t size{0};
+
+    ~Pool() {
+      isDestroyed() = true;
+      while (size > 0) {
+        deallocateBlock(blocks[--size], 1);
+      }
+    }
+
+    /*
+     * Returns the pool of the current thread, or nothing once it was
+     * destroyed when the thread exits (e.g. while other thread-local objects
+     * still free blocks).
+     */
+    static Pool* get() noexcept {
+      if (isDestroyed()) {
+        return nullptr;
+      }
+      thread_local Pool pool;
+      return &pool;
+    }
+
+    // Trivially destructible, so it can still be read after `Pool` is gone.
+    static bool& isDestroyed() noexcept {
+      thread_local bool isDestroyed = false;
+      return isDestroyed;
+    }
+  };
+
+  static void* allocateBlock(size_t count) {
+    if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+      return ::operator new(count * sizeof(T), std::align_val_t{alignof(T)});
+    } else {
+      return ::operator new(count * sizeof(T));
+    }
+  }
+
+  static void deallocateBlock(void* block, size_t /*count*/) noexcept {
+    if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+      ::operator delete(block, std::align_val_t{alignof(T)});
+    } else {
+      ::operator delete(block);
+    }
+  }
+};
+
+/*
+ * Equivalent of `std::make_shared` which allocates the object and its control
+ * block with `PooledAllocator`.
+ */
+template <typename T, typename... ArgsT>
+std::shared_ptr<T> allocatePooledShared(ArgsT&&... args) {
+  return std::allocate_shared<T>(
+      PooledAllocator<T>{}, std::forward<ArgsT>(args)...);
+}
+
+} // namespace facebook::react
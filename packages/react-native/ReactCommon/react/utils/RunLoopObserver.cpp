@@ -28,18 +28,60 @@ void RunLoopObserver::enable() const noexcept {
   if (enabled_) {
     return;
   }
-  enabled_ = true;
 
-  startObserving();
+  if (!isArmedMode_) {
+    enabled_ = true;
+    startObserving();
+    return;
+  }
+
+  std::scoped_lock lock(armingMutex_);
+  enabled_ = true;
+  if (isArmed_) {
+    startObserving();
+    wakeUp();
+  }
 }
 
 void RunLoopObserver::disable() const noexcept {
   if (!enabled_) {
     return;
   }
+
+  if (!isArmedMode_) {
+    enabled_ = false;
+    stopObserving();
+    return;
+  }
+
+  std::scoped_lock lock(armingMutex_);
   enabled_ = false;
+  if (isArmed_) {
+    stopObserving();
+  }
+}
 
-  stopObserving();
+void RunLoopObserver::setArmedMode() const noexcept {
+  react_native_assert(
+      !enabled_ &&
+      "`RunLoopObserver::setArmedMode` must be called before `enable`.");
+  isArmedMode_ = true;
+}
+
+void RunLoopObserver::arm() const noexcept {
+  if (!isArmedMode_) {
+    return;
+  }
+
+  std::scoped_lock lock(armingMutex_);
+  if (isArmed_) {
+    return;
+  }
+  isArmed_ = true;
+  if (enabled_) {
+    startObserving();
+    wakeUp();
+  }
 }
 
 void RunLoopObserver::activityDidChange(Activity activity) const noexcept {
@@ -47,6 +89,16 @@ void RunLoopObserver::activityDidChange(Activity activity) const noexcept {
     return;
   }
 
+  if (isArmedMode_) {
+    // Disarmed before calling the delegate, so that it can arm it again.
+    std::scoped_lock lock(armingMutex_);
+    if (!isArmed_) {
+      return;
+    }
+    isArmed_ = false;
+    stopObserving();
+  }
+
   react_native_assert(
       !owner_.expired() &&
       "`owner_` is null. The caller must `lock` the owner and check it for being not null.");
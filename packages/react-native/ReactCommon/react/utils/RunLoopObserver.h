@@ -10,6 +10,7 @@
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 
 namespace facebook::react {
 
@@ -94,6 +95,23 @@ class RunLoopObserver {
   void enable() const noexcept;
   void disable() const noexcept;
 
+  /*
+   * Switches the observer to the armed mode: instead of calling the delegate
+   * on every requested activity, the observer stays idle (and doesn't observe
+   * the run loop at all) until it is armed, and then calls the delegate once,
+   * at the next requested activity.
+   * Must be called before the observer is enabled.
+   */
+  void setArmedMode() const noexcept;
+
+  /*
+   * Arms an observer in the armed mode, waking up the run loop if it sleeps.
+   * Arming an armed observer does nothing, as does arming an observer which
+   * is not in the armed mode.
+   * Can be called from any thread.
+   */
+  void arm() const noexcept;
+
   /*
    * Returns true if called on a thread associated with the run loop.
    * Must be implemented in subclasses.
@@ -113,6 +131,13 @@ class RunLoopObserver {
   virtual void startObserving() const noexcept = 0;
   virtual void stopObserving() const noexcept = 0;
 
+  /*
+   * Wakes up the run loop if it sleeps, so that the activities coming after
+   * waiting happen.
+   * Can be implemented in subclasses; does nothing by default.
+   */
+  virtual void wakeUp() const noexcept {}
+
   /*
    * Called by subclasses to generate a call on a delegate.
    */
@@ -122,6 +147,10 @@ class RunLoopObserver {
   const WeakOwner owner_;
   mutable const Delegate* delegate_{nullptr};
   mutable std::atomic<bool> enabled_{false};
+
+  mutable bool isArmedMode_{false};
+  mutable std::mutex armingMutex_; // Protects `isArmed_` in the armed mode.
+  mutable bool isArmed_{false};
 };
 
 } // namespace facebook::react
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+
+#include <folly/container/EvictingCacheMap.h>
+
+namespace facebook::react {
+
+/*
+ * Thread-safe LRU cache which spreads its entries over `shardCount`
+ * independently locked shards, so threads looking up different keys rarely
+ * contend for the same mutex. A drop-in replacement for
+ * `SimpleThreadSafeCache` with two differences:
+ *  - Entries are evicted from each shard separately, so the cache holds up to
+ *    `maxSize` entries rounded up to a multiple of `shardCount`, and the
+ *    least recently used entry of a shard rather than of the whole cache is
+ *    evicted.
+ *  - Generators run without holding a lock, so threads missing the same key
+ *    at once may all generate its value. Generators must be pure.
+ */
+template <
+    typename KeyT,
+    typename ValueT,
+    size_t maxSize,
+    size_t shardCount = 16>
+class ShardedThreadSafeCache {
+  static_assert(shardCount > 0, "The cache requires at least one shard.");
+
+ public:
+  ShardedThreadSafeCache() : ShardedThreadSafeCache(maxSize) {}
+  ShardedThreadSafeCache(size_t size) {
+    auto shardSize = std::max(size_t{1}, (size + shardCount - 1) / shardCount);
+    for (auto& shard : shards_) {
+      shard.map.setMaxSize(shardSize);
+    }
+  }
+
+  /*
+   * Returns a value from the map with a given key.
+   * If the value wasn't found in the cache, constructs the value using given
+   * generator function, stores it inside a cache and returns it.
+   * Can be called from any thread.
+   */
+  ValueT get(const KeyT& key, std::function<ValueT(const KeyT& key)> generator)
+      const {
+    auto& shard = shardForKey(key);
+    {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      auto iterator = shard.map.find(key);
+      if (iterator != shard.map.end()) {
+        return iterator->second;
+      }
+    }
+
+    auto value = generator(key);
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.map.set(key, value);
+    return value;
+  }
+
+  /*
+   * Returns a value from the map with a given key.
+   * If the value wasn't found in the cache, returns empty optional.
+   * Can be called from any thread.
+   */
+  std::optional<ValueT> get(const KeyT& key) const {
+    auto& shard = shardForKey(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto iterator = shard.map.find(key);
+    if (iterator == shard.map.end()) {
+      return {};
+    }
+
+    return iterator->second;
+  }
+
+  /*
+   * Sets a key-value pair in the LRU cache.
+   * Can be called from any thread.
+   */
+  void set(const KeyT& key, const ValueT& value) const {
+    auto& shard = shardForKey(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.map.set(key, value);
+  }
+
+  /*
+   * Removes all entries.
+   * Can be called from any thread.
+   */
+  void clear() const {
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      shard.map.clear();
+    }
+  }
+
+ private:
+  // Shards are kept on separate cache lines so that locking one of them does
+  // not slow down threads using its neighbours.
+  struct alignas(64) Shard {
+    // Limited to the size of the shard in the constructor of the cache;
+    // a maximum size of 0 means unlimited.
+    folly::EvictingCacheMap<KeyT, ValueT> map{0};
+    std::mutex mutex;
+  };
+
+  Shard& shardForKey(const KeyT& key) const {
+    // The maps of the shards pick buckets from the low bits of the hash, so
+    // shards are picked from its high bits, after mixing them in.
+    auto hash = static_cast<uint64_t>(std::hash<KeyT>{}(key));
+    hash = (hash ^ (hash >> 32)) * 0x9e3779b97f4a7c15ull;
+    return shards_[(hash >> 32) % shardCount];
+  }
+
+  mutable std::array<Shard, shardCount> shards_;
+};
+
+} // namespace facebook::react
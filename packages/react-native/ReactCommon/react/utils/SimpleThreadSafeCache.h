@@ -5,6 +5,8 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#pragma once
+
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -66,6 +68,15 @@ class SimpleThreadSafeCache {
     map_.set(std::move(key), std::move(value));
   }
 
+  /*
+   * Removes all entries.
+   * Can be called from any thread.
+   */
+  void clear() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.clear();
+  }
+
  private:
   mutable folly::EvictingCacheMap<KeyT, ValueT> map_;
   mutable std::mutex mutex_;
@@ -20,11 +20,14 @@ namespace facebook::react {
  * Please use std::hash if possible. `fnv1a` should only be used in cases
  * when std::hash does not provide the needed functionality. For example,
  * constexpr.
+ *
+ * Passing the hash of a string as `offset_basis` continues it, so
+ * `fnv1a(b, fnv1a(a))` is the hash of `a` and `b` concatenated.
  */
 template <typename CharTransformT = std::identity>
-constexpr uint32_t fnv1a(std::string_view string) noexcept {
-  constexpr uint32_t offset_basis = 2166136261;
-
+constexpr uint32_t fnv1a(
+    std::string_view string,
+    uint32_t offset_basis = 2166136261) noexcept {
   uint32_t hash = offset_basis;
 
   for (auto const& c : string) {
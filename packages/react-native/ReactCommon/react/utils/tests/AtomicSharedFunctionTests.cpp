@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/utils/AtomicSharedFunction.h>
+
+#include <array>
+#include <functional>
+#include <thread>
+
+namespace facebook::react {
+
+TEST(AtomicSharedFunctionTests, testEmptyFunctionIsNoOp) {
+  auto function = AtomicSharedFunction<int>{};
+  function(1);
+
+  auto nullFunction = AtomicSharedFunction<int>{std::function<void(int)>{}};
+  nullFunction(1);
+}
+
+TEST(AtomicSharedFunctionTests, testCopiesShareCallable) {
+  auto sum = 0;
+  auto function = AtomicSharedFunction<int>{[&](int value) { sum += value; }};
+  auto copy = function;
+
+  function(1);
+  copy(2);
+  EXPECT_EQ(sum, 3);
+
+  copy.assign([&](int value) { sum -= value; });
+  function(3);
+  EXPECT_EQ(sum, 0);
+
+  function.assign(nullptr);
+  copy(1);
+  EXPECT_EQ(sum, 0);
+}
+
+TEST(AtomicSharedFunctionTests, testLargeCallable) {
+  auto payload = std::array<int, 32>{};
+  payload[31] = 42;
+  auto result = 0;
+  auto function =
+      AtomicSharedFunction<>{[&result, payload]() { result = payload[31]; }};
+
+  function();
+  EXPECT_EQ(result, 42);
+}
+
+TEST(AtomicSharedFunctionTests, testCapturedValuesAreReleased) {
+  auto value = std::make_shared<int>(0);
+  {
+    auto function = AtomicSharedFunction<>{[value]() {}};
+    function.assign([value]() {});
+    EXPECT_EQ(value.use_count(), 3);
+  }
+  EXPECT_EQ(value.use_count(), 1);
+}
+
+TEST(AtomicSharedFunctionTests, testAssignWhileCalling) {
+  auto calls = std::atomic<int>{0};
+  auto function = AtomicSharedFunction<>{};
+
+  auto caller = std::thread([&]() {
+    for (auto i = 0; i < 10000; i++) {
+      function();
+    }
+  });
+  function.assign([&]() { calls++; });
+  caller.join();
+
+  function();
+  EXPECT_GE(calls.load(), 1);
+}
+
+} // namespace facebook::react
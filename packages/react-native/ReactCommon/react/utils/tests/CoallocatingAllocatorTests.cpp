@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <react/utils/CoallocatingAllocator.h>
+
+namespace facebook::react {
+
+TEST(CoallocatingAllocatorTests, allocatesObjectsFromBlock) {
+  auto block = CoallocationBlock::create(
+      CoallocationBlock::capacityFor<std::string, int>());
+  auto string = allocateCoallocatedShared<std::string>(*block, "string");
+  auto number = allocateCoallocatedShared<int>(*block, 42);
+  EXPECT_TRUE(block->contains(string.get()));
+  EXPECT_TRUE(block->contains(number.get()));
+  block->release();
+
+  EXPECT_EQ(*string, "string");
+  EXPECT_EQ(*number, 42);
+}
+
+TEST(CoallocatingAllocatorTests, destroysObjectsIndependently) {
+  auto block = CoallocationBlock::create(
+      CoallocationBlock::capacityFor<std::string, std::string>());
+  auto first = allocateCoallocatedShared<std::string>(*block, "first");
+  auto second = allocateCoallocatedShared<std::string>(*block, "second");
+  block->release();
+
+  auto weakFirst = std::weak_ptr<std::string>(first);
+  first.reset();
+  EXPECT_TRUE(weakFirst.expired());
+  EXPECT_EQ(*second, "second");
+
+  // The block is freed with the last of its objects, on any thread.
+  auto thread = std::thread([second = std::move(second)]() mutable {
+    second.reset();
+  });
+  thread.join();
+}
+
+TEST(CoallocatingAllocatorTests, allocatesOnHeapOnceBlockIsFull) {
+  auto block =
+      CoallocationBlock::create(CoallocationBlock::capacityFor<int>());
+  auto values = std::vector<std::shared_ptr<int>>{};
+  for (auto i = 0; i < 16; i++) {
+    values.push_back(allocateCoallocatedShared<int>(*block, i));
+  }
+  EXPECT_TRUE(block->contains(values.front().get()));
+  EXPECT_FALSE(block->contains(values.back().get()));
+  block->release();
+
+  for (auto i = 0; i < 16; i++) {
+    EXPECT_EQ(*values[i], i);
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/utils/ContextContainer.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+namespace facebook::react {
+
+TEST(ContextContainerTests, testInsertAndFind) {
+  auto contextContainer = ContextContainer{};
+  contextContainer.insert("number", 42);
+  contextContainer.insert("string", std::string("value"));
+
+  // Inserting an existing key does nothing.
+  contextContainer.insert("number", 0);
+
+  EXPECT_EQ(contextContainer.at<int>("number"), 42);
+  EXPECT_EQ(contextContainer.at<std::string>("string"), "value");
+  EXPECT_EQ(contextContainer.find<int>("missing"), std::nullopt);
+
+  static const auto numberKey = ContextContainer::Key<int>("number");
+  EXPECT_EQ(contextContainer.at(numberKey), 42);
+
+  contextContainer.erase("number");
+  EXPECT_EQ(contextContainer.find(numberKey), std::nullopt);
+}
+
+TEST(ContextContainerTests, testUpdate) {
+  auto contextContainer = ContextContainer{};
+  contextContainer.insert("first", 1);
+  contextContainer.insert("second", 2);
+
+  auto otherContextContainer = ContextContainer{};
+  otherContextContainer.insert("second", 20);
+  otherContextContainer.insert("third", 30);
+
+  contextContainer.update(otherContextContainer);
+
+  EXPECT_EQ(contextContainer.at<int>("first"), 1);
+  EXPECT_EQ(contextContainer.at<int>("second"), 20);
+  EXPECT_EQ(contextContainer.at<int>("third"), 30);
+}
+
+TEST(ContextContainerTests, testLookupsDuringModifications) {
+  auto contextContainer = ContextContainer{};
+  contextContainer.insert("value", std::string("initial"));
+
+  static const auto valueKey = ContextContainer::Key<std::string>("value");
+  auto stop = std::atomic<bool>{false};
+  auto reader = std::thread([&]() {
+    while (!stop) {
+      auto value = contextContainer.find(valueKey);
+      if (value) {
+        EXPECT_FALSE(value->empty());
+      }
+    }
+  });
+
+  for (int i = 0; i < 1000; i++) {
+    contextContainer.erase("value");
+    contextContainer.insert("value", std::to_string(i));
+  }
+
+  stop = true;
+  reader.join();
+  EXPECT_EQ(contextContainer.at(valueKey), "999");
+}
+
+} // namespace facebook::react
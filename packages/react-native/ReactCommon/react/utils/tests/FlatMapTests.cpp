@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <react/utils/FlatMap.h>
+
+namespace facebook::react {
+
+TEST(FlatMapTests, insertsFindsAndErases) {
+  auto map = FlatMap<int32_t, std::string>{};
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.find(1), map.end());
+
+  map[1] = "one";
+  EXPECT_TRUE(map.insert({3, "three"}).second);
+  EXPECT_FALSE(map.insert({3, "another three"}).second);
+  map.emplace(5, "five");
+
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_EQ(map.at(1), "one");
+  EXPECT_EQ(map.at(3), "three");
+  EXPECT_EQ(map.find(5)->second, "five");
+  EXPECT_FALSE(map.contains(2));
+  EXPECT_THROW(map.at(2), std::out_of_range);
+
+  EXPECT_EQ(map.erase(3), 1);
+  EXPECT_EQ(map.erase(3), 0);
+  map.erase(map.find(1));
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_FALSE(map.contains(1));
+  EXPECT_EQ(map.at(5), "five");
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(FlatMapTests, matchesStdMap) {
+  // Random operations on clustered keys, so that erasing shifts back long
+  // probe sequences.
+  auto map = FlatMap<int32_t, std::shared_ptr<int32_t>>{};
+  auto expected = std::map<int32_t, int32_t>{};
+  auto random = std::mt19937{42};
+  auto keys = std::uniform_int_distribution<int32_t>{0, 512};
+
+  for (int i = 0; i < 20000; i++) {
+    auto key = keys(random) * 2;
+    if (random() % 3 == 0) {
+      EXPECT_EQ(map.erase(key), expected.erase(key));
+    } else {
+      map[key] = std::make_shared<int32_t>(i);
+      expected[key] = i;
+    }
+    ASSERT_EQ(map.size(), expected.size());
+  }
+
+  for (const auto& [key, value] : expected) {
+    ASSERT_TRUE(map.contains(key));
+    EXPECT_EQ(*map.at(key), value);
+  }
+
+  auto iterated = std::map<int32_t, int32_t>{};
+  for (const auto& [key, value] : map) {
+    iterated[key] = *value;
+  }
+  EXPECT_EQ(iterated, expected);
+}
+
+TEST(FlatSetTests, insertsFindsAndErases) {
+  auto set = FlatSet<int32_t>{};
+  set.reserve(100);
+  for (int32_t tag = 1; tag < 200; tag += 2) {
+    EXPECT_TRUE(set.insert(tag).second);
+  }
+  EXPECT_FALSE(set.insert(1).second);
+  EXPECT_EQ(set.size(), 100);
+  EXPECT_TRUE(set.contains(199));
+  EXPECT_FALSE(set.contains(2));
+
+  set.erase(set.find(1));
+  EXPECT_EQ(set.erase(3), 1);
+  EXPECT_EQ(set.size(), 98);
+
+  auto sum = 0;
+  for (auto tag : set) {
+    sum += tag;
+  }
+  EXPECT_EQ(sum, 100 * 100 - 1 - 3);
+}
+
+} // namespace facebook::react
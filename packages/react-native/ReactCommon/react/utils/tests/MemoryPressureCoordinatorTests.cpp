@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/utils/MemoryPressureCoordinator.h>
+
+#include <vector>
+
+namespace facebook::react {
+
+class RecordingMemoryPressureListener : public MemoryPressureListener {
+ public:
+  void didReceiveMemoryPressure(MemoryPressureLevel level) override {
+    levels.push_back(level);
+  }
+
+  std::vector<MemoryPressureLevel> levels;
+};
+
+TEST(MemoryPressureCoordinatorTests, testTrimCallsRegisteredListeners) {
+  auto coordinator = MemoryPressureCoordinator{};
+  auto first = RecordingMemoryPressureListener{};
+  auto second = RecordingMemoryPressureListener{};
+
+  coordinator.registerListener(first);
+  coordinator.registerListener(second);
+  coordinator.trim(MemoryPressureLevel::Moderate);
+
+  coordinator.unregisterListener(second);
+  coordinator.trim(MemoryPressureLevel::Critical);
+
+  EXPECT_EQ(
+      first.levels,
+      (std::vector<MemoryPressureLevel>{
+          MemoryPressureLevel::Moderate, MemoryPressureLevel::Critical}));
+  EXPECT_EQ(
+      second.levels,
+      (std::vector<MemoryPressureLevel>{MemoryPressureLevel::Moderate}));
+}
+
+TEST(MemoryPressureCoordinatorTests, testFromContextContainer) {
+  auto contextContainer = std::make_shared<ContextContainer>();
+  EXPECT_EQ(
+      MemoryPressureCoordinator::fromContextContainer(contextContainer),
+      nullptr);
+  EXPECT_EQ(MemoryPressureCoordinator::fromContextContainer(nullptr), nullptr);
+
+  auto coordinator = std::make_shared<MemoryPressureCoordinator>();
+  contextContainer->insert(
+      MemoryPressureCoordinator::kContextContainerKey, coordinator);
+  EXPECT_EQ(
+      MemoryPressureCoordinator::fromContextContainer(contextContainer),
+      coordinator);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <react/utils/PooledAllocator.h>
+
+namespace facebook::react {
+
+TEST(PooledAllocatorTests, reusesFreedBlocks) {
+  auto first = allocatePooledShared<std::string>("first");
+  EXPECT_EQ(*first, "first");
+  auto firstAddress = first.get();
+  first.reset();
+
+  auto second = allocatePooledShared<std::string>("second");
+  EXPECT_EQ(*second, "second");
+  EXPECT_EQ(second.get(), firstAddress);
+}
+
+TEST(PooledAllocatorTests, allocatesBeyondPoolSize) {
+  auto count = PooledAllocator<int>::kMaxPooledBlocks * 2;
+  auto values = std::vector<std::shared_ptr<int>>{};
+  for (size_t i = 0; i < count; i++) {
+    values.push_back(allocatePooledShared<int>((int)i));
+  }
+  values.clear();
+  for (size_t i = 0; i < count; i++) {
+    values.push_back(allocatePooledShared<int>((int)i));
+  }
+  for (size_t i = 0; i < count; i++) {
+    EXPECT_EQ(*values[i], (int)i);
+  }
+}
+
+TEST(PooledAllocatorTests, freesBlocksOnOtherThreads) {
+  auto values = std::vector<std::shared_ptr<int>>{};
+  for (auto i = 0; i < 16; i++) {
+    values.push_back(allocatePooledShared<int>(i));
+  }
+
+  auto thread = std::thread([values = std::move(values)]() mutable {
+    values.clear();
+    auto value = allocatePooledShared<int>(42);
+    EXPECT_EQ(*value, 42);
+  });
+  thread.join();
+}
+
+} // namespace facebook::react
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/utils/RunLoopObserver.h>
+
+namespace facebook::react {
+
+class FakeRunLoopObserver final : public RunLoopObserver {
+ public:
+  using RunLoopObserver::RunLoopObserver;
+
+  bool isOnRunLoopThread() const noexcept override {
+    return true;
+  }
+
+  // Simulates an iteration of the run loop.
+  void tick() const {
+    if (isObserving) {
+      activityDidChange(Activity::BeforeWaiting);
+    }
+  }
+
+  mutable bool isObserving{false};
+  mutable int wakeUpCount{0};
+
+ private:
+  void startObserving() const noexcept override {
+    isObserving = true;
+  }
+
+  void stopObserving() const noexcept override {
+    isObserving = false;
+  }
+
+  void wakeUp() const noexcept override {
+    wakeUpCount++;
+  }
+};
+
+class CountingDelegate final : public RunLoopObserver::Delegate {
+ public:
+  void activityDidChange(
+      const RunLoopObserver::Delegate* /*delegate*/,
+      RunLoopObserver::Activity /*activity*/) const noexcept override {
+    callCount++;
+  }
+
+  mutable int callCount{0};
+};
+
+TEST(RunLoopObserverTests, testObserverIsCalledOnEveryActivity) {
+  auto owner = std::make_shared<int>();
+  auto delegate = CountingDelegate{};
+  auto observer =
+      FakeRunLoopObserver{RunLoopObserver::Activity::BeforeWaiting, owner};
+  observer.setDelegate(&delegate);
+  observer.enable();
+
+  observer.tick();
+  observer.tick();
+  observer.arm();
+  observer.tick();
+
+  EXPECT_EQ(delegate.callCount, 3);
+  EXPECT_EQ(observer.wakeUpCount, 0);
+}
+
+TEST(RunLoopObserverTests, testArmedObserverIsCalledOncePerArming) {
+  auto owner = std::make_shared<int>();
+  auto delegate = CountingDelegate{};
+  auto observer =
+      FakeRunLoopObserver{RunLoopObserver::Activity::BeforeWaiting, owner};
+  observer.setDelegate(&delegate);
+  observer.setArmedMode();
+  observer.enable();
+
+  // Idle until armed.
+  observer.tick();
+  EXPECT_FALSE(observer.isObserving);
+  EXPECT_EQ(delegate.callCount, 0);
+
+  observer.arm();
+  observer.arm();
+  EXPECT_TRUE(observer.isObserving);
+  EXPECT_EQ(observer.wakeUpCount, 1);
+
+  observer.tick();
+  observer.tick();
+  EXPECT_FALSE(observer.isObserving);
+  EXPECT_EQ(delegate.callCount, 1);
+
+  observer.arm();
+  observer.tick();
+  EXPECT_EQ(delegate.callCount, 2);
+}
+
+TEST(RunLoopObserverTests, testArmingDisabledObserver) {
+  auto owner = std::make_shared<int>();
+  auto delegate = CountingDelegate{};
+  auto observer =
+      FakeRunLoopObserver{RunLoopObserver::Activity::BeforeWaiting, owner};
+  observer.setDelegate(&delegate);
+  observer.setArmedMode();
+
+  observer.arm();
+  EXPECT_FALSE(observer.isObserving);
+
+  // Arming is kept until the observer is enabled.
+  observer.enable();
+  EXPECT_TRUE(observer.isObserving);
+  observer.tick();
+  EXPECT_EQ(delegate.callCount, 1);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <react/utils/ShardedThreadSafeCache.h>
+
+namespace facebook::react {
+
+TEST(ShardedThreadSafeCacheTests, generatesMissingValuesOnce) {
+  auto cache = ShardedThreadSafeCache<int, int, 64>{};
+  auto generated = 0;
+  auto generator = [&](const int& key) {
+    generated++;
+    return key * 2;
+  };
+
+  EXPECT_EQ(cache.get(1, generator), 2);
+  EXPECT_EQ(cache.get(1, generator), 2);
+  EXPECT_EQ(cache.get(2, generator), 4);
+  EXPECT_EQ(generated, 2);
+}
+
+TEST(ShardedThreadSafeCacheTests, getsAndSetsValues) {
+  auto cache = ShardedThreadSafeCache<int, int, 64>{};
+
+  EXPECT_FALSE(cache.get(1).has_value());
+  cache.set(1, 10);
+  EXPECT_EQ(cache.get(1), 10);
+  cache.set(1, 11);
+  EXPECT_EQ(cache.get(1), 11);
+}
+
+TEST(ShardedThreadSafeCacheTests, evictsLeastRecentlyUsedValuesOfShards) {
+  auto cache = ShardedThreadSafeCache<int, int, 4, /* shardCount */ 1>{};
+
+  for (auto key = 0; key < 4; key++) {
+    cache.set(key, key);
+  }
+  EXPECT_EQ(cache.get(0), 0);
+
+  cache.set(4, 4);
+  EXPECT_EQ(cache.get(0), 0);
+  EXPECT_FALSE(cache.get(1).has_value());
+  EXPECT_EQ(cache.get(4), 4);
+}
+
+TEST(ShardedThreadSafeCacheTests, holdsAtMostMaxSizeRoundedUpToShards) {
+  auto cache = ShardedThreadSafeCache<int, int, 64, /* shardCount */ 8>{};
+
+  for (auto key = 0; key < 1000; key++) {
+    cache.set(key, key);
+  }
+
+  auto cached = 0;
+  for (auto key = 0; key < 1000; key++) {
+    cached += cache.get(key).has_value() ? 1 : 0;
+  }
+  EXPECT_GT(cached, 0);
+  EXPECT_LE(cached, 64);
+}
+
+TEST(ShardedThreadSafeCacheTests, isUsableFromManyThreads) {
+  auto cache = ShardedThreadSafeCache<int, int, 256>{};
+  auto generator = [](const int& key) { return key + 1; };
+  auto mismatches = std::atomic<int>{0};
+
+  auto threads = std::vector<std::thread>{};
+  for (auto i = 0; i < 8; i++) {
+    threads.emplace_back([&, i] {
+      for (auto j = 0; j < 10000; j++) {
+        auto key = (i * 7 + j) % 512;
+        if (cache.get(key, generator) != key + 1) {
+          mismatches++;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(mismatches, 0);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/utils/FlatMap.h>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook::react {
+
+// Mirrors the view registries of the renderer: tags allocated by JS (even and
+// mostly sequential) mapping to shared pointers, with lookups of random views.
+constexpr auto kNumberOfViews = 2000;
+
+struct SequentialTags {
+  static std::vector<int32_t> generate() {
+    auto tags = std::vector<int32_t>{};
+    for (auto i = 0; i < kNumberOfViews; i++) {
+      tags.push_back(2 + i * 2);
+    }
+    return tags;
+  }
+};
+
+struct SparseTags {
+  static std::vector<int32_t> generate() {
+    auto random = std::mt19937{42};
+    auto tags = std::vector<int32_t>{};
+    for (auto i = 0; i < kNumberOfViews; i++) {
+      tags.push_back(static_cast<int32_t>(random() & 0x7fffffff));
+    }
+    return tags;
+  }
+};
+
+template <typename MapT, typename TagsT>
+static void mapLookups(benchmark::State& state) {
+  auto tags = TagsT::generate();
+  auto map = MapT{};
+  for (auto tag : tags) {
+    map[tag] = std::make_shared<int32_t>(tag);
+  }
+  std::shuffle(tags.begin(), tags.end(), std::mt19937{7});
+
+  auto index = size_t{0};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(map.find(tags[index++ % tags.size()]));
+  }
+}
+
+template <typename MapT, typename TagsT>
+static void mapInsertionsAndErasures(benchmark::State& state) {
+  auto tags = TagsT::generate();
+  for (auto _ : state) {
+    auto map = MapT{};
+    for (auto tag : tags) {
+      map[tag] = nullptr;
+    }
+    for (auto tag : tags) {
+      map.erase(tag);
+    }
+    benchmark::DoNotOptimize(map.size());
+  }
+}
+
+using StdMap = std::unordered_map<int32_t, std::shared_ptr<int32_t>>;
+using FlatMapT = FlatMap<int32_t, std::shared_ptr<int32_t>>;
+
+BENCHMARK_TEMPLATE(mapLookups, StdMap, SequentialTags);
+BENCHMARK_TEMPLATE(mapLookups, FlatMapT, SequentialTags);
+BENCHMARK_TEMPLATE(mapLookups, StdMap, SparseTags);
+BENCHMARK_TEMPLATE(mapLookups, FlatMapT, SparseTags);
+BENCHMARK_TEMPLATE(mapInsertionsAndErasures, StdMap, SequentialTags);
+BENCHMARK_TEMPLATE(mapInsertionsAndErasures, FlatMapT, SequentialTags);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
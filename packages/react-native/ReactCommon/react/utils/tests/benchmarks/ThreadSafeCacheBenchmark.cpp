@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/utils/ShardedThreadSafeCache.h>
+#include <react/utils/SimpleThreadSafeCache.h>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+// Mirrors the text measure cache: keys with a non-trivial hash, a working set
+// which fits the cache, and mostly hits.
+constexpr auto kCacheSize = 1024;
+constexpr auto kWorkingSetSize = 768;
+
+static std::string keyForIndex(size_t index) {
+  return "Some text of a paragraph #" + std::to_string(index);
+}
+
+static size_t generateValue(const std::string& key) {
+  return key.size();
+}
+
+template <typename CacheT>
+static void cacheHits(benchmark::State& state) {
+  static CacheT cache{};
+  auto keys = std::vector<std::string>{};
+  for (auto i = size_t{0}; i < kWorkingSetSize; i++) {
+    keys.push_back(keyForIndex(i));
+    cache.set(keys.back(), i);
+  }
+
+  // Threads walk the working set from different offsets.
+  auto index = static_cast<size_t>(state.thread_index()) * 97;
+  for (auto _ : state) {
+    auto& key = keys[index++ % kWorkingSetSize];
+    benchmark::DoNotOptimize(cache.get(key, generateValue));
+  }
+}
+
+template <typename CacheT>
+static void cacheMixedHitsAndMisses(benchmark::State& state) {
+  static CacheT cache{};
+  auto keys = std::vector<std::string>{};
+  for (auto i = size_t{0}; i < kCacheSize * 2; i++) {
+    keys.push_back(keyForIndex(i));
+  }
+
+  auto index = static_cast<size_t>(state.thread_index()) * 97;
+  for (auto _ : state) {
+    auto& key = keys[index++ % keys.size()];
+    benchmark::DoNotOptimize(cache.get(key, generateValue));
+  }
+}
+
+using SimpleCache = SimpleThreadSafeCache<std::string, size_t, kCacheSize>;
+using ShardedCache = ShardedThreadSafeCache<std::string, size_t, kCacheSize>;
+
+BENCHMARK_TEMPLATE(cacheHits, SimpleCache)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(cacheHits, ShardedCache)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(cacheMixedHitsAndMisses, SimpleCache)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(cacheMixedHitsAndMisses, ShardedCache)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
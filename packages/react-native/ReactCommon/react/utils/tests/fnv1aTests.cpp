@@ -21,4 +21,10 @@ TEST(fnv1aTests, testBasicHashing) {
   EXPECT_NE(fnv1a(string1), fnv1a(string2));
 }
 
+TEST(fnv1aTests, testContinuedHashing) {
+  static_assert(fnv1a("native", fnv1a("react")) == fnv1a("reactnative"));
+  EXPECT_EQ(fnv1a("", fnv1a("react")), fnv1a("react"));
+  EXPECT_NE(fnv1a("react", fnv1a("native")), fnv1a("reactnative"));
+}
+
 } // namespace facebook::react
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ReactPerfetto.h"
+
+#ifdef WITH_PERFETTO
+
+#include <mutex>
+
+PERFETTO_TRACK_EVENT_STATIC_STORAGE();
+
+namespace facebook::react {
+
+void initializePerfetto() {
+  static std::once_flag once;
+  std::call_once(once, []() {
+    auto args = perfetto::TracingInitArgs{};
+    args.backends |= perfetto::kSystemBackend;
+    args.use_monotonic_clock = true;
+    perfetto::Tracing::Initialize(args);
+    perfetto::TrackEvent::Register();
+  });
+}
+
+} // namespace facebook::react
+
+#endif // WITH_PERFETTO
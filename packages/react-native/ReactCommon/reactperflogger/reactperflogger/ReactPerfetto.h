@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#ifdef WITH_PERFETTO
+
+#include <perfetto.h>
+
+/**
+ * The track event categories of React Native. Events of disabled categories
+ * cost a single relaxed load, so the Perfetto backend of `SystraceSection`
+ * can be enabled in release builds.
+ */
+PERFETTO_DEFINE_CATEGORIES(
+    perfetto::Category("react-native")
+        .SetDescription("Sections of the React Native C++ core"),
+    perfetto::Category("react-native.fabric")
+        .SetDescription("Commits and mounts of the new renderer"));
+
+namespace facebook::react {
+
+/**
+ * Connects to the Perfetto system service (`traced` on Android) and registers
+ * the track event categories. Safe to call more than once; must be
+ * called before sections are recorded, e.g. when the library is loaded.
+ */
+void initializePerfetto();
+
+} // namespace facebook::react
+
+#endif // WITH_PERFETTO
@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "SamplingNativeModulePerfLogger.h"
+
+#include <mutex>
+
+namespace facebook::react {
+
+static int64_t now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+#pragma mark - NativeModuleCallStats
+
+NativeModuleCallStats& NativeModuleCallStats::getInstance() {
+  static auto instance = new NativeModuleCallStats();
+  return *instance;
+}
+
+NativeModuleCallStats::MethodCounters&
+NativeModuleCallStats::getMethodCounters(
+    const char* moduleName,
+    const char* methodName) {
+  {
+    std::shared_lock lock(mutex_);
+    auto module = modules_.find(std::string_view{moduleName});
+    if (module != modules_.end()) {
+      auto method = module->second.find(std::string_view{methodName});
+      if (method != module->second.end()) {
+        return *method->second;
+      }
+    }
+  }
+
+  std::unique_lock lock(mutex_);
+  auto& methods = modules_[moduleName];
+  auto& counters = methods[methodName];
+  if (!counters) {
+    counters = std::make_unique<MethodCounters>();
+  }
+  return *counters;
+}
+
+std::vector<NativeModuleMethodCallStats>
+NativeModuleCallStats::getMethodCallStats() const {
+  std::shared_lock lock(mutex_);
+  auto result = std::vector<NativeModuleMethodCallStats>{};
+  for (const auto& [moduleName, methods] : modules_) {
+    for (const auto& [methodName, counters] : methods) {
+      auto load = [](const auto& counter) {
+        return counter.load(std::memory_order_relaxed);
+      };
+      result.push_back(
+          {moduleName,
+           methodName,
+           load(counters->numberOfSyncCalls),
+           load(counters->numberOfAsyncCalls),
+           load(counters->numberOfFailedCalls),
+           load(counters->numberOfSampledCalls),
+           load(counters->numberOfSampledExecutions),
+           load(counters->jsThreadTime),
+           load(counters->argConversionTime),
+           load(counters->executionTime),
+           load(counters->queueWaitTime)});
+    }
+  }
+  return result;
+}
+
+#pragma mark - SamplingNativeModulePerfLogger
+
+SamplingNativeModulePerfLogger::SamplingNativeModulePerfLogger(
+    uint32_t samplingInterval,
+    NativeModuleCallStats& stats)
+    : samplingInterval_(samplingInterval == 0 ? 1 : samplingInterval),
+      stats_(stats) {}
+
+SamplingNativeModulePerfLogger::CallState&
+SamplingNativeModulePerfLogger::currentCall() {
+  thread_local auto call = CallState{};
+  return call;
+}
+
+SamplingNativeModulePerfLogger::CallState&
+SamplingNativeModulePerfLogger::currentExecution() {
+  thread_local auto execution = CallState{};
+  return execution;
+}
+
+bool SamplingNativeModulePerfLogger::shouldSample(
+    uint32_t& numberOfCalls) const {
+  return numberOfCalls++ % samplingInterval_ == 0;
+}
+
+void SamplingNativeModulePerfLogger::callStart(
+    const char* moduleName,
+    const char* methodName,
+    bool isSync) {
+  auto& call = currentCall();
+  call.counters = &stats_.getMethodCounters(moduleName, methodName);
+  auto& numberOfCalls = isSync ? call.counters->numberOfSyncCalls
+                               : call.counters->numberOfAsyncCalls;
+  numberOfCalls.fetch_add(1, std::memory_order_relaxed);
+
+  thread_local uint32_t numberOfStartedCalls = 0;
+  call.isSampled = shouldSample(numberOfStartedCalls);
+  if (call.isSampled) {
+    call.startTime = now();
+    call.counters->numberOfSampledCalls.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+}
+
+void SamplingNativeModulePerfLogger::callEnd() {
+  auto& call = currentCall();
+  if (call.counters != nullptr && call.isSampled) {
+    call.counters->jsThreadTime.fetch_add(
+        now() - call.startTime, std::memory_order_relaxed);
+  }
+  call = {};
+}
+
+void SamplingNativeModulePerfLogger::callFail(
+    const char* moduleName,
+    const char* methodName) {
+  auto& call = currentCall();
+  auto& counters = call.counters != nullptr
+      ? *call.counters
+      : stats_.getMethodCounters(moduleName, methodName);
+  counters.numberOfFailedCalls.fetch_add(1, std::memory_order_relaxed);
+  call = {};
+}
+
+void SamplingNativeModulePerfLogger::executionStart(
+    MethodCounters& counters,
+    bool isSampled) {
+  auto& execution = currentExecution();
+  execution.counters = &counters;
+  execution.isSampled = isSampled;
+  if (isSampled) {
+    execution.startTime = now();
+    counters.numberOfSampledExecutions.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void SamplingNativeModulePerfLogger::executionEnd() {
+  auto& execution = currentExecution();
+  if (execution.counters != nullptr && execution.isSampled) {
+    execution.counters->executionTime.fetch_add(
+        now() - execution.startTime, std::memory_order_relaxed);
+  }
+  execution = {};
+}
+
+#pragma mark - Sync method calls
+
+void SamplingNativeModulePerfLogger::syncMethodCallStart(
+    const char* moduleName,
+    const char* methodName) {
+  callStart(moduleName, methodName, true);
+}
+
+void SamplingNativeModulePerfLogger::syncMethodCallArgConversionStart(
+    const char* /*moduleName*/,
+    const char* /*methodName*/) {
+  auto& call = currentCall();
+  if (call.isSampled) {
+    call.phaseStartTime = now();
+  }
+}
+
+void SamplingNativeModulePerfLogger::syncMethodCallArgConversionEnd(
+    const char* /*moduleName*/,
+    const char* /*methodName*/) {
+  auto& call = currentCall();
+  if (call.counters != nullptr && call.isSampled) {
+    call.counters->argConversionTime.fetch_add(
+        now() - call.phaseStartTime, std::memory_order_relaxed);
+  }
+}
+
+void SamplingNativeModulePerfLogger::syncMethodCallExecutionStart(
+    const char* moduleName,
+    const char* methodName) {
+  // Sync methods can execute on the queue of the module instead of the JS
+  // thread (e.g. on iOS), so they are sampled independently of the call.
+  thread_local uint32_t numberOfExecutions = 0;
+  executionStart(
+      stats_.getMethodCounters(moduleName, methodName),
+      shouldSample(numberOfExecutions));
+}
+
+void SamplingNativeModulePerfLogger::syncMethodCallExecutionEnd(
+    const char* /*moduleName*/,
+    const char* /*methodName*/) {
+  executionEnd();
+}
+
+void SamplingNativeModulePerfLogger::syncMethodCallEnd(
+    const char* /*moduleName*/,
+    const char* /*methodName*/) {
+  callEnd();
+}
+
+void SamplingNativeModulePerfLogger::syncMethodCallFail(
+    const char* moduleName,
+    const char* methodName) {
+  callFail(moduleName, methodName);
+}
+
+#pragma mark - Async method calls
+
+void SamplingNativeModulePerfLogger::asyncMethodCallStart(
+    const char* moduleName,
+    const char* methodName) {
+  callStart(moduleName, methodName, false);
+}
+
+void SamplingNativeModulePerfLogger::asyncMethodCallArgConversionStart(
+    const char* moduleName,
+    const char* methodName) {
+  syncMethodCallArgConversionStart(moduleName, methodName);
+}
+
+void SamplingNativeModulePerfLogger::asyncMethodCallArgConversionEnd(
+    const char* moduleName,
+    const char* methodName) {
+  syncMethodCallArgConversionEnd(moduleName, methodName);
+}
+
+void SamplingNativeModulePerfLogger::asyncMethodCallDispatch(
+    const char* moduleName,
+    const char* methodName) {
+  auto& call = currentCall();
+  auto& counters = call.counters != nullptr
+      ? *call.counters
+      : stats_.getMethodCounters(moduleName, methodName);
+  auto index =
+      counters.numberOfDispatchedCalls.fetch_add(1, std::memory_order_relaxed);
+  counters
+      .dispatchTimes[index % MethodCounters::kMaxNumberOfPendingAsyncCalls]
+      .store(call.isSampled ? now() : 0, std::memory_order_relaxed);
+}
+
+void SamplingNativeModulePerfLogger::asyncMethodCallEnd(
+    const char* /*moduleName*/,
+    const char* /*methodName*/) {
+  callEnd();
+}
+
+void SamplingNativeModulePerfLogger::asyncMethodCallFail(
+    const char* moduleName,
+    const char* methodName) {
+  callFail(moduleName, methodName);
+}
+
+#pragma mark - Async method call execution
+
+void SamplingNativeModulePerfLogger::asyncMethodCallExecutionStart(
+    const char* moduleName,
+    const char* methodName,
+    int32_t /*id*/) {
+  auto& counters = stats_.getMethodCounters(moduleName, methodName);
+  auto index =
+      counters.numberOfExecutedCalls.fetch_add(1, std::memory_order_relaxed);
+  auto numberOfDispatchedCalls =
+      counters.numberOfDispatchedCalls.load(std::memory_order_relaxed);
+
+  // The dispatch time is unknown if the call wasn't dispatched through this
+  // logger, or if it was overwritten because too many calls are pending.
+  auto dispatchTime = int64_t{0};
+  if (index < numberOfDispatchedCalls &&
+      numberOfDispatchedCalls - index <=
+          MethodCounters::kMaxNumberOfPendingAsyncCalls) {
+    dispatchTime =
+        counters
+            .dispatchTimes
+                [index % MethodCounters::kMaxNumberOfPendingAsyncCalls]
+            .load(std::memory_order_relaxed);
+  }
+
+  executionStart(counters, dispatchTime != 0);
+  if (dispatchTime != 0) {
+    counters.queueWaitTime.fetch_add(
+        currentExecution().startTime - dispatchTime,
+        std::memory_order_relaxed);
+  }
+}
+
+void SamplingNativeModulePerfLogger::asyncMethodCallExecutionEnd(
+    const char* /*moduleName*/,
+    const char* /*methodName*/,
+    int32_t /*id*/) {
+  executionEnd();
+}
+
+void SamplingNativeModulePerfLogger::asyncMethodCallExecutionFail(
+    const char* moduleName,
+    const char* methodName,
+    int32_t /*id*/) {
+  auto& counters = stats_.getMethodCounters(moduleName, methodName);
+  counters.numberOfFailedCalls.fetch_add(1, std::memory_order_relaxed);
+  currentExecution() = {};
+}
+
+} // namespace facebook::react
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "NativeModulePerfLogger.h"
+
+namespace facebook::react {
+
+/**
+ * Aggregated calls of a method of a NativeModule. Times are in nanoseconds
+ * and only include the sampled calls.
+ */
+struct NativeModuleMethodCallStats {
+  std::string moduleName;
+  std::string methodName;
+
+  uint64_t numberOfSyncCalls{0};
+  uint64_t numberOfAsyncCalls{0};
+  uint64_t numberOfFailedCalls{0};
+
+  /**
+   * Number of calls (on the JS thread) and executions (on the thread of the
+   * module) whose times were measured.
+   */
+  uint64_t numberOfSampledCalls{0};
+  uint64_t numberOfSampledExecutions{0};
+
+  /**
+   * Time the JS thread was blocked by the calls: the whole sync calls, and
+   * the argument conversion and dispatch of async calls.
+   */
+  int64_t jsThreadTime{0};
+  int64_t argConversionTime{0};
+  int64_t executionTime{0};
+
+  /**
+   * Time async calls waited on the queue of the module before executing.
+   */
+  int64_t queueWaitTime{0};
+};
+
+/**
+ * Aggregates the method calls of all NativeModules reported to
+ * `SamplingNativeModulePerfLogger`s. Counters are lock-free; a lock is only
+ * taken to add a method the first time it is called. Thread-safe.
+ */
+class NativeModuleCallStats final {
+ public:
+  static NativeModuleCallStats& getInstance();
+
+  /**
+   * Returns the aggregated calls of the methods which were called so far.
+   */
+  std::vector<NativeModuleMethodCallStats> getMethodCallStats() const;
+
+ private:
+  friend class SamplingNativeModulePerfLogger;
+
+  struct MethodCounters {
+    static constexpr size_t kMaxNumberOfPendingAsyncCalls = 64;
+
+    std::atomic<uint64_t> numberOfSyncCalls{0};
+    std::atomic<uint64_t> numberOfAsyncCalls{0};
+    std::atomic<uint64_t> numberOfFailedCalls{0};
+    std::atomic<uint64_t> numberOfSampledCalls{0};
+    std::atomic<uint64_t> numberOfSampledExecutions{0};
+    std::atomic<int64_t> jsThreadTime{0};
+    std::atomic<int64_t> argConversionTime{0};
+    std::atomic<int64_t> executionTime{0};
+    std::atomic<int64_t> queueWaitTime{0};
+
+    // The dispatch times of the pending async calls, assuming that the calls
+    // of a method execute in the order they were dispatched in. Unsampled
+    // calls have a dispatch time of `0`.
+    std::array<std::atomic<int64_t>, kMaxNumberOfPendingAsyncCalls>
+        dispatchTimes{};
+    std::atomic<uint64_t> numberOfDispatchedCalls{0};
+    std::atomic<uint64_t> numberOfExecutedCalls{0};
+  };
+
+  struct StringHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view string) const {
+      return std::hash<std::string_view>{}(string);
+    }
+  };
+
+  template <typename T>
+  using StringMap =
+      std::unordered_map<std::string, T, StringHash, std::equal_to<>>;
+
+  MethodCounters& getMethodCounters(
+      const char* moduleName,
+      const char* methodName);
+
+  mutable std::shared_mutex mutex_;
+  StringMap<StringMap<std::unique_ptr<MethodCounters>>> modules_;
+};
+
+/**
+ * A `NativeModulePerfLogger` which counts all method calls, and measures the
+ * times of one call out of `samplingInterval` into `NativeModuleCallStats`.
+ * Enable it with e.g. `TurboModulePerfLogger::enableLogging`.
+ */
+class SamplingNativeModulePerfLogger final : public NativeModulePerfLogger {
+ public:
+  explicit SamplingNativeModulePerfLogger(
+      uint32_t samplingInterval = 1,
+      NativeModuleCallStats& stats = NativeModuleCallStats::getInstance());
+
+  void moduleDataCreateStart(const char* moduleName, int32_t id) override {}
+  void moduleDataCreateEnd(const char* moduleName, int32_t id) override {}
+  void moduleCreateStart(const char* moduleName, int32_t id) override {}
+  void moduleCreateCacheHit(const char* moduleName, int32_t id) override {}
+  void moduleCreateConstructStart(const char* moduleName, int32_t id)
+      override {}
+  void moduleCreateConstructEnd(const char* moduleName, int32_t id) override {}
+  void moduleCreateSetUpStart(const char* moduleName, int32_t id) override {}
+  void moduleCreateSetUpEnd(const char* moduleName, int32_t id) override {}
+  void moduleCreateEnd(const char* moduleName, int32_t id) override {}
+  void moduleCreateFail(const char* moduleName, int32_t id) override {}
+
+  void moduleJSRequireBeginningStart(const char* moduleName) override {}
+  void moduleJSRequireBeginningCacheHit(const char* moduleName) override {}
+  void moduleJSRequireBeginningEnd(const char* moduleName) override {}
+  void moduleJSRequireBeginningFail(const char* moduleName) override {}
+  void moduleJSRequireEndingStart(const char* moduleName) override {}
+  void moduleJSRequireEndingEnd(const char* moduleName) override {}
+  void moduleJSRequireEndingFail(const char* moduleName) override {}
+
+  void syncMethodCallStart(const char* moduleName, const char* methodName)
+      override;
+  void syncMethodCallArgConversionStart(
+      const char* moduleName,
+      const char* methodName) override;
+  void syncMethodCallArgConversionEnd(
+      const char* moduleName,
+      const char* methodName) override;
+  void syncMethodCallExecutionStart(
+      const char* moduleName,
+      const char* methodName) override;
+  void syncMethodCallExecutionEnd(
+      const char* moduleName,
+      const char* methodName) override;
+  void syncMethodCallReturnConversionStart(
+      const char* moduleName,
+      const char* methodName) override {}
+  void syncMethodCallReturnConversionEnd(
+      const char* moduleName,
+      const char* methodName) override {}
+  void syncMethodCallEnd(const char* moduleName, const char* methodName)
+      override;
+  void syncMethodCallFail(const char* moduleName, const char* methodName)
+      override;
+
+  void asyncMethodCallStart(const char* moduleName, const char* methodName)
+      override;
+  void asyncMethodCallArgConversionStart(
+      const char* moduleName,
+      const char* methodName) override;
+  void asyncMethodCallArgConversionEnd(
+      const char* moduleName,
+      const char* methodName) override;
+  void asyncMethodCallDispatch(const char* moduleName, const char* methodName)
+      override;
+  void asyncMethodCallEnd(const char* moduleName, const char* methodName)
+      override;
+  void asyncMethodCallFail(const char* moduleName, const char* methodName)
+      override;
+
+  void asyncMethodCallBatchPreprocessStart() override {}
+  void asyncMethodCallBatchPreprocessEnd(int batchSize) override {}
+
+  void asyncMethodCallExecutionStart(
+      const char* moduleName,
+      const char* methodName,
+      int32_t id) override;
+  void asyncMethodCallExecutionArgConversionStart(
+      const char* moduleName,
+      const char* methodName,
+      int32_t id) override {}
+  void asyncMethodCallExecutionArgConversionEnd(
+      const char* moduleName,
+      const char* methodName,
+      int32_t id) override {}
+  void asyncMethodCallExecutionEnd(
+      const char* moduleName,
+      const char* methodName,
+      int32_t id) override;
+  void asyncMethodCallExecutionFail(
+      const char* moduleName,
+      const char* methodName,
+      int32_t id) override;
+
+ private:
+  using MethodCounters = NativeModuleCallStats::MethodCounters;
+
+  struct CallState {
+    MethodCounters* counters{nullptr};
+    bool isSampled{false};
+    int64_t startTime{0};
+    int64_t phaseStartTime{0};
+  };
+
+  /**
+   * The call being made on the current (JS) thread, and the method being
+   * executed on the current thread.
+   */
+  static CallState& currentCall();
+  static CallState& currentExecution();
+
+  bool shouldSample(uint32_t& numberOfCalls) const;
+
+  void callStart(const char* moduleName, const char* methodName, bool isSync);
+  void callEnd();
+  void callFail(const char* moduleName, const char* methodName);
+  void executionStart(
+      MethodCounters& counters,
+      bool isSampled);
+  void executionEnd();
+
+  const uint32_t samplingInterval_;
+  NativeModuleCallStats& stats_;
+};
+
+} // namespace facebook::react
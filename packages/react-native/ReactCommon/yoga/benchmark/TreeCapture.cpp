@@ -0,0 +1,622 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TreeCapture.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace facebook::yoga::benchmark {
+
+namespace {
+
+thread_local size_t measureCallbackCount = 0;
+
+using MeasuredContent = TreeCapture::MeasuredContent;
+
+YGSize measureContent(
+    YGNodeConstRef node,
+    float width,
+    YGMeasureMode widthMode,
+    float /*height*/,
+    YGMeasureMode /*heightMode*/) {
+  measureCallbackCount++;
+
+  const auto& content =
+      *static_cast<const MeasuredContent*>(YGNodeGetContext(node));
+  if (widthMode == YGMeasureModeUndefined || width >= content.width) {
+    return {widthMode == YGMeasureModeExactly ? width : content.width,
+            content.height};
+  }
+
+  const auto lineCount = std::ceil(content.width / std::max(width, 1.0f));
+  return {width, lineCount * content.height};
+}
+
+struct EdgeName {
+  const char* name;
+  YGEdge edge;
+};
+
+constexpr EdgeName kEdges[] = {
+    {"left", YGEdgeLeft},
+    {"top", YGEdgeTop},
+    {"right", YGEdgeRight},
+    {"bottom", YGEdgeBottom},
+    {"start", YGEdgeStart},
+    {"end", YGEdgeEnd},
+    {"horizontal", YGEdgeHorizontal},
+    {"vertical", YGEdgeVertical},
+    {"all", YGEdgeAll},
+};
+
+struct GutterName {
+  const char* name;
+  YGGutter gutter;
+};
+
+constexpr GutterName kGutters[] = {
+    {"column", YGGutterColumn},
+    {"row", YGGutterRow},
+    {"all", YGGutterAll},
+};
+
+[[noreturn]] void fail(size_t lineNumber, const std::string& message) {
+  throw std::invalid_argument(
+      "line " + std::to_string(lineNumber) + ": " + message);
+}
+
+template <typename Enum>
+Enum parseEnum(
+    const std::string& value,
+    const char* (*toString)(Enum),
+    size_t lineNumber) {
+  // Enums of the C API are numbered from zero, and unknown values are
+  // printed as "unknown".
+  for (int ordinal = 0;; ordinal++) {
+    const auto name = toString(static_cast<Enum>(ordinal));
+    if (std::strcmp(name, "unknown") == 0) {
+      fail(lineNumber, "unknown value '" + value + "'");
+    }
+    if (value == name) {
+      return static_cast<Enum>(ordinal);
+    }
+  }
+}
+
+float parseFloat(const std::string& value, size_t lineNumber) {
+  if (value == "undefined") {
+    return YGUndefined;
+  }
+  try {
+    size_t length = 0;
+    const auto result = std::stof(value, &length);
+    if (length == value.size()) {
+      return result;
+    }
+  } catch (const std::exception&) {
+  }
+  fail(lineNumber, "invalid number '" + value + "'");
+}
+
+YGValue parseValue(const std::string& value, size_t lineNumber) {
+  if (value == "auto") {
+    return {YGUndefined, YGUnitAuto};
+  }
+  if (value == "undefined") {
+    return {YGUndefined, YGUnitUndefined};
+  }
+  if (!value.empty() && value.back() == '%') {
+    return {
+        parseFloat(value.substr(0, value.size() - 1), lineNumber),
+        YGUnitPercent};
+  }
+  return {parseFloat(value, lineNumber), YGUnitPoint};
+}
+
+// Applies a value to a style property which supports points, percentages
+// and, if `setAuto` is given, `auto`.
+void setValue(
+    YGNodeRef node,
+    YGValue value,
+    size_t lineNumber,
+    void (*setPoints)(YGNodeRef, float),
+    void (*setPercent)(YGNodeRef, float),
+    void (*setAuto)(YGNodeRef)) {
+  switch (value.unit) {
+    case YGUnitPoint:
+    case YGUnitUndefined:
+      setPoints(node, value.value);
+      return;
+    case YGUnitPercent:
+      setPercent(node, value.value);
+      return;
+    case YGUnitAuto:
+      if (setAuto != nullptr) {
+        setAuto(node);
+        return;
+      }
+      break;
+  }
+  fail(lineNumber, "unsupported value");
+}
+
+void setEdgeValue(
+    YGNodeRef node,
+    YGEdge edge,
+    YGValue value,
+    size_t lineNumber,
+    void (*setPoints)(YGNodeRef, YGEdge, float),
+    void (*setPercent)(YGNodeRef, YGEdge, float),
+    void (*setAuto)(YGNodeRef, YGEdge)) {
+  switch (value.unit) {
+    case YGUnitPoint:
+    case YGUnitUndefined:
+      setPoints(node, edge, value.value);
+      return;
+    case YGUnitPercent:
+      setPercent(node, edge, value.value);
+      return;
+    case YGUnitAuto:
+      if (setAuto != nullptr) {
+        setAuto(node, edge);
+        return;
+      }
+      break;
+  }
+  fail(lineNumber, "unsupported value");
+}
+
+YGEdge parseEdge(const std::string& name, size_t lineNumber) {
+  for (const auto& edge : kEdges) {
+    if (name == edge.name) {
+      return edge.edge;
+    }
+  }
+  fail(lineNumber, "unknown edge '" + name + "'");
+}
+
+YGGutter parseGutter(const std::string& name, size_t lineNumber) {
+  for (const auto& gutter : kGutters) {
+    if (name == gutter.name) {
+      return gutter.gutter;
+    }
+  }
+  fail(lineNumber, "unknown gutter '" + name + "'");
+}
+
+void setProperty(
+    TreeCapture& capture,
+    YGNodeRef node,
+    const std::string& name,
+    const std::string& value,
+    size_t lineNumber) {
+  const auto dot = name.find('.');
+  if (dot != std::string::npos) {
+    const auto group = name.substr(0, dot);
+    const auto suffix = name.substr(dot + 1);
+    if (group == "gap") {
+      YGNodeStyleSetGap(
+          node, parseGutter(suffix, lineNumber), parseFloat(value, lineNumber));
+      return;
+    }
+
+    const auto edge = parseEdge(suffix, lineNumber);
+    if (group == "position") {
+      setEdgeValue(
+          node,
+          edge,
+          parseValue(value, lineNumber),
+          lineNumber,
+          YGNodeStyleSetPosition,
+          YGNodeStyleSetPositionPercent,
+          nullptr);
+    } else if (group == "margin") {
+      setEdgeValue(
+          node,
+          edge,
+          parseValue(value, lineNumber),
+          lineNumber,
+          YGNodeStyleSetMargin,
+          YGNodeStyleSetMarginPercent,
+          YGNodeStyleSetMarginAuto);
+    } else if (group == "padding") {
+      setEdgeValue(
+          node,
+          edge,
+          parseValue(value, lineNumber),
+          lineNumber,
+          YGNodeStyleSetPadding,
+          YGNodeStyleSetPaddingPercent,
+          nullptr);
+    } else if (group == "border") {
+      YGNodeStyleSetBorder(node, edge, parseFloat(value, lineNumber));
+    } else {
+      fail(lineNumber, "unknown property '" + name + "'");
+    }
+    return;
+  }
+
+  if (name == "direction") {
+    YGNodeStyleSetDirection(
+        node, parseEnum(value, YGDirectionToString, lineNumber));
+  } else if (name == "flexDirection") {
+    YGNodeStyleSetFlexDirection(
+        node, parseEnum(value, YGFlexDirectionToString, lineNumber));
+  } else if (name == "justifyContent") {
+    YGNodeStyleSetJustifyContent(
+        node, parseEnum(value, YGJustifyToString, lineNumber));
+  } else if (name == "alignContent") {
+    YGNodeStyleSetAlignContent(
+        node, parseEnum(value, YGAlignToString, lineNumber));
+  } else if (name == "alignItems") {
+    YGNodeStyleSetAlignItems(
+        node, parseEnum(value, YGAlignToString, lineNumber));
+  } else if (name == "alignSelf") {
+    YGNodeStyleSetAlignSelf(
+        node, parseEnum(value, YGAlignToString, lineNumber));
+  } else if (name == "positionType") {
+    YGNodeStyleSetPositionType(
+        node, parseEnum(value, YGPositionTypeToString, lineNumber));
+  } else if (name == "flexWrap") {
+    YGNodeStyleSetFlexWrap(node, parseEnum(value, YGWrapToString, lineNumber));
+  } else if (name == "overflow") {
+    YGNodeStyleSetOverflow(
+        node, parseEnum(value, YGOverflowToString, lineNumber));
+  } else if (name == "display") {
+    YGNodeStyleSetDisplay(
+        node, parseEnum(value, YGDisplayToString, lineNumber));
+  } else if (name == "flex") {
+    YGNodeStyleSetFlex(node, parseFloat(value, lineNumber));
+  } else if (name == "flexGrow") {
+    YGNodeStyleSetFlexGrow(node, parseFloat(value, lineNumber));
+  } else if (name == "flexShrink") {
+    YGNodeStyleSetFlexShrink(node, parseFloat(value, lineNumber));
+  } else if (name == "aspectRatio") {
+    YGNodeStyleSetAspectRatio(node, parseFloat(value, lineNumber));
+  } else if (name == "flexBasis") {
+    setValue(
+        node,
+        parseValue(value, lineNumber),
+        lineNumber,
+        YGNodeStyleSetFlexBasis,
+        YGNodeStyleSetFlexBasisPercent,
+        YGNodeStyleSetFlexBasisAuto);
+  } else if (name == "width") {
+    setValue(
+        node,
+        parseValue(value, lineNumber),
+        lineNumber,
+        YGNodeStyleSetWidth,
+        YGNodeStyleSetWidthPercent,
+        YGNodeStyleSetWidthAuto);
+  } else if (name == "height") {
+    setValue(
+        node,
+        parseValue(value, lineNumber),
+        lineNumber,
+        YGNodeStyleSetHeight,
+        YGNodeStyleSetHeightPercent,
+        YGNodeStyleSetHeightAuto);
+  } else if (name == "minWidth") {
+    setValue(
+        node,
+        parseValue(value, lineNumber),
+        lineNumber,
+        YGNodeStyleSetMinWidth,
+        YGNodeStyleSetMinWidthPercent,
+        nullptr);
+  } else if (name == "minHeight") {
+    setValue(
+        node,
+        parseValue(value, lineNumber),
+        lineNumber,
+        YGNodeStyleSetMinHeight,
+        YGNodeStyleSetMinHeightPercent,
+        nullptr);
+  } else if (name == "maxWidth") {
+    setValue(
+        node,
+        parseValue(value, lineNumber),
+        lineNumber,
+        YGNodeStyleSetMaxWidth,
+        YGNodeStyleSetMaxWidthPercent,
+        nullptr);
+  } else if (name == "maxHeight") {
+    setValue(
+        node,
+        parseValue(value, lineNumber),
+        lineNumber,
+        YGNodeStyleSetMaxHeight,
+        YGNodeStyleSetMaxHeightPercent,
+        nullptr);
+  } else if (name == "measure") {
+    const auto separator = value.find('x');
+    if (separator == std::string::npos) {
+      fail(lineNumber, "measure must be given as WxH");
+    }
+    const auto& content =
+        capture.measuredContents.emplace_back(new MeasuredContent{
+            parseFloat(value.substr(0, separator), lineNumber),
+            parseFloat(value.substr(separator + 1), lineNumber)});
+    YGNodeSetContext(node, content.get());
+    YGNodeSetMeasureFunc(node, measureContent);
+  } else {
+    fail(lineNumber, "unknown property '" + name + "'");
+  }
+}
+
+std::string formatFloat(float value) {
+  if (YGFloatIsUndefined(value)) {
+    return "undefined";
+  }
+  std::ostringstream stream;
+  stream << value;
+  return stream.str();
+}
+
+std::string formatValue(YGValue value) {
+  switch (value.unit) {
+    case YGUnitUndefined:
+      return "undefined";
+    case YGUnitAuto:
+      return "auto";
+    case YGUnitPercent:
+      return formatFloat(value.value) + "%";
+    case YGUnitPoint:
+      break;
+  }
+  return formatFloat(value.value);
+}
+
+bool differs(float lhs, float rhs) {
+  return lhs != rhs && !(YGFloatIsUndefined(lhs) && YGFloatIsUndefined(rhs));
+}
+
+class CaptureWriter {
+ public:
+  CaptureWriter(std::ostream& output, YGNodeConstRef defaults)
+      : output_(output), defaults_(defaults) {}
+
+  void writeNode(YGNodeConstRef node, size_t depth) {
+    output_ << std::string(depth * 2, ' ') << "node";
+
+    writeEnum(node, "direction", YGNodeStyleGetDirection, YGDirectionToString);
+    writeEnum(
+        node,
+        "flexDirection",
+        YGNodeStyleGetFlexDirection,
+        YGFlexDirectionToString);
+    writeEnum(
+        node,
+        "justifyContent",
+        YGNodeStyleGetJustifyContent,
+        YGJustifyToString);
+    writeEnum(node, "alignContent", YGNodeStyleGetAlignContent, YGAlignToString);
+    writeEnum(node, "alignItems", YGNodeStyleGetAlignItems, YGAlignToString);
+    writeEnum(node, "alignSelf", YGNodeStyleGetAlignSelf, YGAlignToString);
+    writeEnum(
+        node,
+        "positionType",
+        YGNodeStyleGetPositionType,
+        YGPositionTypeToString);
+    writeEnum(node, "flexWrap", YGNodeStyleGetFlexWrap, YGWrapToString);
+    writeEnum(node, "overflow", YGNodeStyleGetOverflow, YGOverflowToString);
+    writeEnum(node, "display", YGNodeStyleGetDisplay, YGDisplayToString);
+
+    writeFloat(node, "flex", YGNodeStyleGetFlex);
+    writeFloat(node, "flexGrow", YGNodeStyleGetFlexGrow);
+    writeFloat(node, "flexShrink", YGNodeStyleGetFlexShrink);
+    writeFloat(node, "aspectRatio", YGNodeStyleGetAspectRatio);
+
+    writeValue(node, "flexBasis", YGNodeStyleGetFlexBasis);
+    writeValue(node, "width", YGNodeStyleGetWidth);
+    writeValue(node, "height", YGNodeStyleGetHeight);
+    writeValue(node, "minWidth", YGNodeStyleGetMinWidth);
+    writeValue(node, "minHeight", YGNodeStyleGetMinHeight);
+    writeValue(node, "maxWidth", YGNodeStyleGetMaxWidth);
+    writeValue(node, "maxHeight", YGNodeStyleGetMaxHeight);
+
+    for (const auto& edge : kEdges) {
+      writeEdgeValue(node, "position", edge, YGNodeStyleGetPosition);
+      writeEdgeValue(node, "margin", edge, YGNodeStyleGetMargin);
+      writeEdgeValue(node, "padding", edge, YGNodeStyleGetPadding);
+      const auto border = YGNodeStyleGetBorder(node, edge.edge);
+      if (differs(border, YGNodeStyleGetBorder(defaults_, edge.edge))) {
+        output_ << " border." << edge.name << "=" << formatFloat(border);
+      }
+    }
+    for (const auto& gutter : kGutters) {
+      const auto gap = YGNodeStyleGetGap(node, gutter.gutter);
+      if (differs(gap, YGNodeStyleGetGap(defaults_, gutter.gutter))) {
+        output_ << " gap." << gutter.name << "=" << formatFloat(gap);
+      }
+    }
+
+    if (YGNodeHasMeasureFunc(node)) {
+      output_ << " measure=" << formatFloat(YGNodeLayoutGetWidth(node)) << "x"
+              << formatFloat(YGNodeLayoutGetHeight(node));
+    }
+    output_ << "\n";
+
+    // Only `YGNodeGetChild` is available for iterating children, and it
+    // does not mutate the node.
+    const auto mutableNode = const_cast<YGNodeRef>(node);
+    for (size_t i = 0; i < YGNodeGetChildCount(node); i++) {
+      writeNode(YGNodeGetChild(mutableNode, i), depth + 1);
+    }
+  }
+
+ private:
+  template <typename Enum>
+  void writeEnum(
+      YGNodeConstRef node,
+      const char* name,
+      Enum (*get)(YGNodeConstRef),
+      const char* (*toString)(Enum)) {
+    if (get(node) != get(defaults_)) {
+      output_ << " " << name << "=" << toString(get(node));
+    }
+  }
+
+  void writeFloat(
+      YGNodeConstRef node,
+      const char* name,
+      float (*get)(YGNodeConstRef)) {
+    if (differs(get(node), get(defaults_))) {
+      output_ << " " << name << "=" << formatFloat(get(node));
+    }
+  }
+
+  void writeValue(
+      YGNodeConstRef node,
+      const char* name,
+      YGValue (*get)(YGNodeConstRef)) {
+    if (get(node) != get(defaults_)) {
+      output_ << " " << name << "=" << formatValue(get(node));
+    }
+  }
+
+  void writeEdgeValue(
+      YGNodeConstRef node,
+      const char* name,
+      const EdgeName& edge,
+      YGValue (*get)(YGNodeConstRef, YGEdge)) {
+    if (get(node, edge.edge) != get(defaults_, edge.edge)) {
+      output_ << " " << name << "." << edge.name << "="
+              << formatValue(get(node, edge.edge));
+    }
+  }
+
+  std::ostream& output_;
+  YGNodeConstRef defaults_;
+};
+
+void readNodes(
+    std::istream& input,
+    YGConfigConstRef config,
+    TreeCapture& capture) {
+  // Ancestors of the next node, indexed by depth.
+  std::vector<YGNodeRef> ancestors;
+
+  std::string line;
+  size_t lineNumber = 0;
+  while (std::getline(input, line)) {
+    lineNumber++;
+
+    const auto indentation = line.find_first_not_of(' ');
+    if (indentation == std::string::npos || line[indentation] == '#') {
+      continue;
+    }
+
+    std::istringstream tokens(line.substr(indentation));
+    std::string keyword;
+    tokens >> keyword;
+
+    std::vector<std::pair<std::string, std::string>> properties;
+    std::string token;
+    while (tokens >> token) {
+      const auto equals = token.find('=');
+      if (equals == std::string::npos) {
+        fail(lineNumber, "expected name=value but got '" + token + "'");
+      }
+      properties.emplace_back(token.substr(0, equals), token.substr(equals + 1));
+    }
+
+    if (keyword == "layout") {
+      if (capture.root != nullptr) {
+        fail(lineNumber, "layout must precede the nodes");
+      }
+      for (const auto& [name, value] : properties) {
+        if (name == "ownerWidth") {
+          capture.ownerWidth = parseFloat(value, lineNumber);
+        } else if (name == "ownerHeight") {
+          capture.ownerHeight = parseFloat(value, lineNumber);
+        } else if (name == "direction") {
+          capture.ownerDirection =
+              parseEnum(value, YGDirectionToString, lineNumber);
+        } else {
+          fail(lineNumber, "unknown layout argument '" + name + "'");
+        }
+      }
+      continue;
+    }
+    if (keyword != "node") {
+      fail(lineNumber, "unknown keyword '" + keyword + "'");
+    }
+
+    const auto depth = indentation / 2;
+    if (indentation % 2 != 0 || depth > ancestors.size() ||
+        (depth == 0 && capture.root != nullptr)) {
+      fail(lineNumber, "unexpected indentation");
+    }
+
+    // Nodes are part of the tree before their properties are parsed, so that
+    // they are freed along with it when parsing fails.
+    const auto node = YGNodeNewWithConfig(config);
+    ancestors.resize(depth);
+    if (depth == 0) {
+      capture.root = node;
+    } else {
+      const auto parent = ancestors.back();
+      YGNodeInsertChild(parent, node, YGNodeGetChildCount(parent));
+    }
+    ancestors.push_back(node);
+
+    for (const auto& [name, value] : properties) {
+      setProperty(capture, node, name, value, lineNumber);
+    }
+  }
+
+  if (capture.root == nullptr) {
+    throw std::invalid_argument("capture has no nodes");
+  }
+}
+
+} // namespace
+
+TreeCapture readTreeCapture(std::istream& input, YGConfigConstRef config) {
+  TreeCapture capture;
+  try {
+    readNodes(input, config, capture);
+  } catch (...) {
+    if (capture.root != nullptr) {
+      YGNodeFreeRecursive(capture.root);
+    }
+    throw;
+  }
+  return capture;
+}
+
+void writeTreeCapture(
+    std::ostream& output,
+    YGNodeConstRef root,
+    float ownerWidth,
+    float ownerHeight,
+    YGDirection ownerDirection) {
+  output << "layout ownerWidth=" << formatFloat(ownerWidth)
+         << " ownerHeight=" << formatFloat(ownerHeight)
+         << " direction=" << YGDirectionToString(ownerDirection) << "\n";
+
+  const auto defaults = YGNodeNewWithConfig(YGNodeGetConfig(
+      const_cast<YGNodeRef>(root)));
+  CaptureWriter{output, defaults}.writeNode(root, 0);
+  YGNodeFree(defaults);
+}
+
+size_t getMeasureCallbackCount() {
+  return measureCallbackCount;
+}
+
+} // namespace facebook::yoga::benchmark
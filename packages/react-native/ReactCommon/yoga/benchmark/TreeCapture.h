@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <iosfwd>
+#include <memory>
+#include <vector>
+
+#include <yoga/Yoga.h>
+
+namespace facebook::yoga::benchmark {
+
+// Captures are plain text, with one line per node after an optional `layout`
+// line giving the arguments of YGNodeCalculateLayout. Nodes are indented by
+// two spaces per level of depth and list the style properties which differ
+// from the defaults as `name=value`:
+//
+//   layout ownerWidth=390 ownerHeight=undefined direction=ltr
+//   node flexDirection=row padding.all=8
+//     node width=40 height=40
+//     node flexShrink=1 measure=220x18
+//
+// Values are points (`12`), percentages (`50%`), `auto` or `undefined`, and
+// enums use the names returned by YG*ToString (`space-between`). Edges and
+// gutters are appended to the property name (`margin.horizontal`,
+// `gap.column`). `measure=WxH` gives a leaf a measure function emulating a
+// line of text W points wide and H points high, which wraps onto more lines
+// when it is given less width. Lines starting with `#` are ignored.
+struct TreeCapture {
+  // Intrinsic size of the line of text a measured leaf emulates, which is
+  // the context of its node.
+  struct MeasuredContent {
+    float width;
+    float height;
+  };
+
+  YGNodeRef root = nullptr;
+  float ownerWidth = YGUndefined;
+  float ownerHeight = YGUndefined;
+  YGDirection ownerDirection = YGDirectionLTR;
+  std::vector<std::unique_ptr<MeasuredContent>> measuredContents;
+};
+
+// Builds the tree of a capture with nodes using `config`. Throws
+// std::invalid_argument for malformed captures. The tree is owned by the
+// caller and must be freed with YGNodeFreeRecursive before the capture is
+// destroyed.
+TreeCapture readTreeCapture(std::istream& input, YGConfigConstRef config);
+
+// Writes `root` and its descendants as a capture. Measure functions are
+// recorded with the size of the last layout of their node.
+void writeTreeCapture(
+    std::ostream& output,
+    YGNodeConstRef root,
+    float ownerWidth,
+    float ownerHeight,
+    YGDirection ownerDirection);
+
+// Number of times measure functions of nodes built by readTreeCapture were
+// called on the current thread.
+size_t getMeasureCallbackCount();
+
+} // namespace facebook::yoga::benchmark
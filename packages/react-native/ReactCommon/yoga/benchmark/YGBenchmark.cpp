@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <new>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <yoga/Yoga.h>
+
+#include "TreeCapture.h"
+
+using namespace facebook::yoga::benchmark;
+
+namespace {
+
+std::atomic<size_t> allocationCount{0};
+
+} // namespace
+
+// Counting every allocation of the process; none happen on other threads
+// while a benchmark runs.
+void* operator new(size_t size) {
+  allocationCount.fetch_add(1, std::memory_order_relaxed);
+  if (auto memory = std::malloc(size != 0 ? size : 1)) {
+    return memory;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+  std::free(memory);
+}
+
+void operator delete(void* memory, size_t /*size*/) noexcept {
+  std::free(memory);
+}
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Sample {
+  double durationUs;
+  size_t measureCallbacks;
+  size_t allocations;
+};
+
+// Runs `prepare` outside of and `layout` inside of the measured region.
+Sample measure(
+    const std::function<void()>& prepare,
+    const std::function<void()>& layout) {
+  prepare();
+
+  const auto measureCallbacksBefore = getMeasureCallbackCount();
+  const auto allocationsBefore = allocationCount.load();
+  const auto start = Clock::now();
+  layout();
+  const auto end = Clock::now();
+
+  return {
+      std::chrono::duration<double, std::micro>(end - start).count(),
+      getMeasureCallbackCount() - measureCallbacksBefore,
+      allocationCount.load() - allocationsBefore};
+}
+
+void report(const std::string& name, std::vector<Sample> samples) {
+  std::sort(samples.begin(), samples.end(), [](const auto& a, const auto& b) {
+    return a.durationUs < b.durationUs;
+  });
+
+  const auto count = static_cast<double>(samples.size());
+  const auto total = std::accumulate(
+      samples.begin(), samples.end(), Sample{0, 0, 0}, [](auto sum, auto s) {
+        return Sample{
+            sum.durationUs + s.durationUs,
+            sum.measureCallbacks + s.measureCallbacks,
+            sum.allocations + s.allocations};
+      });
+
+  std::printf(
+      "  %-10s %10.1f %10.1f %10.1f %12.1f %12.1f\n",
+      name.c_str(),
+      samples.front().durationUs,
+      samples[samples.size() / 2].durationUs,
+      total.durationUs / count,
+      static_cast<double>(total.measureCallbacks) / count,
+      static_cast<double>(total.allocations) / count);
+}
+
+void markMeasuredNodesDirty(YGNodeRef node) {
+  if (YGNodeHasMeasureFunc(node)) {
+    YGNodeMarkDirty(node);
+  }
+  for (size_t i = 0; i < YGNodeGetChildCount(node); i++) {
+    markMeasuredNodesDirty(YGNodeGetChild(node, i));
+  }
+}
+
+size_t countNodes(YGNodeRef node) {
+  size_t count = 1;
+  for (size_t i = 0; i < YGNodeGetChildCount(node); i++) {
+    count += countNodes(YGNodeGetChild(node, i));
+  }
+  return count;
+}
+
+TreeCapture loadCapture(const char* path, YGConfigConstRef config) {
+  std::ifstream file(path);
+  if (!file) {
+    throw std::invalid_argument("cannot open file");
+  }
+  return readTreeCapture(file, config);
+}
+
+void benchmarkCapture(const char* path, size_t iterations) {
+  const auto config = YGConfigNew();
+
+  auto capture = loadCapture(path, config);
+  std::printf("%s (%zu nodes)\n", path, countNodes(capture.root));
+  std::printf(
+      "  %-10s %10s %10s %10s %12s %12s\n",
+      "",
+      "min (us)",
+      "p50 (us)",
+      "mean (us)",
+      "measures",
+      "allocations");
+
+  const auto calculateLayout = [&](float ownerWidth) {
+    YGNodeCalculateLayout(
+        capture.root, ownerWidth, capture.ownerHeight, capture.ownerDirection);
+  };
+
+  // Laying out a tree for the first time.
+  {
+    std::vector<Sample> samples;
+    for (size_t i = 0; i < iterations; i++) {
+      samples.push_back(measure(
+          [&] {
+            YGNodeFreeRecursive(capture.root);
+            capture = loadCapture(path, config);
+          },
+          [&] { calculateLayout(capture.ownerWidth); }));
+    }
+    report("initial", std::move(samples));
+  }
+
+  // Laying out a tree again after the content of its measured leaves changed.
+  {
+    std::vector<Sample> samples;
+    for (size_t i = 0; i < iterations; i++) {
+      samples.push_back(measure(
+          [&] { markMeasuredNodesDirty(capture.root); },
+          [&] { calculateLayout(capture.ownerWidth); }));
+    }
+    report("content", std::move(samples));
+  }
+
+  // Laying out a tree again for a different owner width.
+  if (!YGFloatIsUndefined(capture.ownerWidth)) {
+    std::vector<Sample> samples;
+    for (size_t i = 0; i < iterations; i++) {
+      const auto ownerWidth =
+          capture.ownerWidth - static_cast<float>(i % 2 == 0 ? 1 : 0);
+      samples.push_back(
+          measure([] {}, [&] { calculateLayout(ownerWidth); }));
+    }
+    report("resize", std::move(samples));
+  }
+
+  YGNodeFreeRecursive(capture.root);
+  YGConfigFree(config);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  size_t iterations = 100;
+  std::vector<const char*> paths;
+  for (int i = 1; i < argc; i++) {
+    if (std::strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+      iterations = std::max<size_t>(1, std::strtoul(argv[++i], nullptr, 10));
+    } else {
+      paths.push_back(argv[i]);
+    }
+  }
+
+  if (paths.empty()) {
+    std::fprintf(
+        stderr, "usage: %s [--iterations N] capture...\n", argv[0]);
+    return 1;
+  }
+
+  for (const auto path : paths) {
+    try {
+      benchmarkCapture(path, iterations);
+    } catch (const std::exception& error) {
+      std::fprintf(stderr, "%s: %s\n", path, error.what());
+      return 1;
+    }
+  }
+  return 0;
+}
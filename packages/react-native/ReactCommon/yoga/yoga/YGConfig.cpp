@@ -90,3 +90,40 @@ void YGConfigSetCloneNodeFunc(
     const YGCloneNodeFunc callback) {
   resolveRef(config)->setCloneNodeCallback(callback);
 }
+
+void YGConfigSetParallelLayoutFunc(
+    const YGConfigRef config,
+    const YGParallelLayoutFunc parallelLayoutFunc) {
+  resolveRef(config)->setParallelLayoutFunc(parallelLayoutFunc);
+}
+
+void YGConfigSetBatchMeasureFunc(
+    const YGConfigRef config,
+    const YGBatchMeasureFunc batchMeasureFunc) {
+  resolveRef(config)->setBatchMeasureFunc(batchMeasureFunc);
+}
+
+void YGConfigSetMaxCachedMeasurements(
+    const YGConfigRef config,
+    const size_t maxCachedMeasurements) {
+  yoga::assertFatalWithConfig(
+      resolveRef(config),
+      maxCachedMeasurements >= 1 &&
+          maxCachedMeasurements <= CachedMeasurements::MaxSize,
+      "Max cached measurements must be between 1 and 256");
+  resolveRef(config)->setMaxCachedMeasurements(maxCachedMeasurements);
+}
+
+size_t YGConfigGetMaxCachedMeasurements(const YGConfigConstRef config) {
+  return resolveRef(config)->getMaxCachedMeasurements();
+}
+
+void YGConfigSetNodePoolCapacity(
+    const YGConfigRef config,
+    const size_t capacity) {
+  resolveRef(config)->setNodePoolCapacity(capacity);
+}
+
+size_t YGConfigGetNodePoolCapacity(const YGConfigConstRef config) {
+  return resolveRef(config)->getNodePoolCapacity();
+}
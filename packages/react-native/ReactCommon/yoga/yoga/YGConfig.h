@@ -155,4 +155,95 @@ YG_EXPORT void YGConfigSetCloneNodeFunc(
     YGConfigRef config,
     YGCloneNodeFunc callback);
 
+/**
+ * Function pointer type for YGConfigSetParallelLayoutFunc. It must call
+ * `task(taskContext, taskIndex)` once for every `taskIndex` in
+ * [0, `taskCount`), in any order and possibly concurrently, and return only
+ * after all the calls have finished. Tasks may call the function again for
+ * nested subtrees.
+ */
+typedef void (*YGParallelLayoutFunc)(
+    YGConfigConstRef config,
+    size_t taskCount,
+    void* taskContext,
+    void (*task)(void* taskContext, size_t taskIndex));
+
+/**
+ * Sets a function which Yoga uses to lay out independent subtrees (the
+ * absolutely positioned children of a node) concurrently. Results are the same
+ * as the ones of a serial layout. When set, measure, baseline, clone node and
+ * logger callbacks as well as event subscribers may be called from multiple
+ * threads at the same time. Layout is serial if no function is set (default).
+ */
+YG_EXPORT void YGConfigSetParallelLayoutFunc(
+    YGConfigRef config,
+    YGParallelLayoutFunc parallelLayoutFunc);
+
+/**
+ * A measurement of a node with a measure function, requested from a
+ * YGBatchMeasureFunc. Constraints have the same meaning as the ones given to
+ * YGMeasureFunc.
+ */
+typedef struct YGMeasureRequest {
+  YGNodeConstRef node;
+  float width;
+  YGMeasureMode widthMode;
+  float height;
+  YGMeasureMode heightMode;
+} YGMeasureRequest;
+
+/**
+ * Function pointer type for YGConfigSetBatchMeasureFunc and
+ * YGNodeSetBatchMeasureFunc. It must write the size of each of the `count`
+ * requested nodes, as their measure function would return it under the
+ * requested constraints, to `results` at the same index. `owner` is the
+ * parent of all the requested nodes.
+ */
+typedef void (*YGBatchMeasureFunc)(
+    YGNodeConstRef owner,
+    const YGMeasureRequest* requests,
+    struct YGSize* results,
+    size_t count);
+
+/**
+ * Sets a function which Yoga uses to measure the children with measure
+ * functions of a node in a single call, e.g. to do a single round trip to a
+ * platform text measurement API for all of them. It is called with the
+ * constraints children are first measured under, which are usually enough to
+ * lay out unconstrained text in a column. Measure functions of the children
+ * are still called for any other constraints. Nodes may override the function
+ * with YGNodeSetBatchMeasureFunc. No function is set by default.
+ */
+YG_EXPORT void YGConfigSetBatchMeasureFunc(
+    YGConfigRef config,
+    YGBatchMeasureFunc batchMeasureFunc);
+
+/**
+ * Sets how many measurements of different constraints each node created with
+ * the config may cache for reuse by later measurements and layout passes, from
+ * 1 to 256. Once the cache of a node is full, the entry which was reused the
+ * least is replaced. Defaults to 8.
+ */
+YG_EXPORT void YGConfigSetMaxCachedMeasurements(
+    YGConfigRef config,
+    size_t maxCachedMeasurements);
+
+/**
+ * Gets the number of measurements each node may cache.
+ */
+YG_EXPORT size_t YGConfigGetMaxCachedMeasurements(YGConfigConstRef config);
+
+/**
+ * Sets how many blocks of freed node memory the config keeps around to back
+ * nodes created with it later, which saves allocations when trees are
+ * repeatedly torn down and rebuilt. Nodes must not be freed after the config
+ * they were last assigned to. The pool is disabled by default (0).
+ */
+YG_EXPORT void YGConfigSetNodePoolCapacity(YGConfigRef config, size_t capacity);
+
+/**
+ * Gets the number of freed node memory blocks the config may keep around.
+ */
+YG_EXPORT size_t YGConfigGetNodePoolCapacity(YGConfigConstRef config);
+
 YG_EXTERN_C_END
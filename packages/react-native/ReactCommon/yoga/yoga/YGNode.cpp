@@ -17,14 +17,25 @@
 using namespace facebook;
 using namespace facebook::yoga;
 
+namespace {
+
+void deallocateNode(yoga::Node* node) {
+  const auto config = node->getConfig();
+  node->~Node();
+  config->releaseNode(node);
+}
+
+} // namespace
+
 YGNodeRef YGNodeNew(void) {
   return YGNodeNewWithConfig(YGConfigGetDefault());
 }
 
 YGNodeRef YGNodeNewWithConfig(const YGConfigConstRef config) {
-  auto* node = new yoga::Node{resolveRef(config)};
   yoga::assertFatal(
       config != nullptr, "Tried to construct YGNode with null config");
+  auto* node = new (resolveRef(config)->allocateNode())
+      yoga::Node{resolveRef(config)};
   Event::publish<Event::NodeAllocation>(node, {config});
 
   return node;
@@ -32,7 +43,8 @@ YGNodeRef YGNodeNewWithConfig(const YGConfigConstRef config) {
 
 YGNodeRef YGNodeClone(YGNodeConstRef oldNodeRef) {
   auto oldNode = resolveRef(oldNodeRef);
-  const auto node = new yoga::Node(*oldNode);
+  const auto node =
+      new (oldNode->getConfig()->allocateNode()) yoga::Node(*oldNode);
   Event::publish<Event::NodeAllocation>(node, {node->getConfig()});
   node->setOwner(nullptr);
   return node;
@@ -55,7 +67,7 @@ void YGNodeFree(const YGNodeRef nodeRef) {
   node->clearChildren();
 
   Event::publish<Event::NodeDeallocation>(node, {YGNodeGetConfig(node)});
-  delete resolveRef(node);
+  deallocateNode(resolveRef(node));
 }
 
 void YGNodeFreeRecursive(YGNodeRef rootRef) {
@@ -77,7 +89,7 @@ void YGNodeFreeRecursive(YGNodeRef rootRef) {
 
 void YGNodeFinalize(const YGNodeRef node) {
   Event::publish<Event::NodeDeallocation>(node, {YGNodeGetConfig(node)});
-  delete resolveRef(node);
+  deallocateNode(resolveRef(node));
 }
 
 void YGNodeReset(YGNodeRef node) {
@@ -114,7 +126,7 @@ void YGNodeMarkDirty(const YGNodeRef nodeRef) {
       "Only leaf nodes with custom measure functions "
       "should manually mark themselves as dirty");
 
-  node->markDirtyAndPropagate();
+  node->markDirtyAndPropagate(Node::DirtyReason::Content);
 }
 
 void YGNodeSetDirtiedFunc(YGNodeRef node, YGDirtiedFunc dirtiedFunc) {
@@ -295,6 +307,16 @@ bool YGNodeHasMeasureFunc(YGNodeConstRef node) {
   return resolveRef(node)->hasMeasureFunc();
 }
 
+void YGNodeSetBatchMeasureFunc(
+    YGNodeRef node,
+    YGBatchMeasureFunc batchMeasureFunc) {
+  resolveRef(node)->setBatchMeasureFunc(batchMeasureFunc);
+}
+
+bool YGNodeHasBatchMeasureFunc(YGNodeConstRef node) {
+  return resolveRef(node)->getBatchMeasureFunc() != nullptr;
+}
+
 void YGNodeSetBaselineFunc(YGNodeRef node, YGBaselineFunc baselineFunc) {
   resolveRef(node)->setBaselineFunc(baselineFunc);
 }
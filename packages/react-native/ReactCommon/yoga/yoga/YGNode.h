@@ -220,6 +220,20 @@ YG_EXPORT void YGNodeSetMeasureFunc(YGNodeRef node, YGMeasureFunc measureFunc);
  */
 YG_EXPORT bool YGNodeHasMeasureFunc(YGNodeConstRef node);
 
+/**
+ * Sets the function used to measure the children with measure functions of
+ * the node in a single call, instead of the one of its config (see
+ * YGConfigSetBatchMeasureFunc).
+ */
+YG_EXPORT void YGNodeSetBatchMeasureFunc(
+    YGNodeRef node,
+    YGBatchMeasureFunc batchMeasureFunc);
+
+/**
+ * Whether a batch measure function is set on the node itself.
+ */
+YG_EXPORT bool YGNodeHasBatchMeasureFunc(YGNodeConstRef node);
+
 /**
  * @returns a defined offet to baseline (ascent).
  */
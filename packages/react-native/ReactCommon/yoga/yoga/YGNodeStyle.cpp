@@ -15,20 +15,20 @@ using namespace facebook::yoga;
 namespace {
 
 template <auto GetterT, auto SetterT, typename ValueT>
-void updateStyle(YGNodeRef node, ValueT value) {
-  auto& style = resolveRef(node)->style();
-  if ((style.*GetterT)() != value) {
-    (style.*SetterT)(value);
-    resolveRef(node)->markDirtyAndPropagate();
+void updateStyle(YGNodeRef nodeRef, ValueT value) {
+  auto node = resolveRef(nodeRef);
+  if ((node->style().*GetterT)() != value) {
+    (node->mutableStyle().*SetterT)(value);
+    node->markDirtyAndPropagate();
   }
 }
 
 template <auto GetterT, auto SetterT, typename IdxT, typename ValueT>
-void updateStyle(YGNodeRef node, IdxT idx, ValueT value) {
-  auto& style = resolveRef(node)->style();
-  if ((style.*GetterT)(idx) != value) {
-    (style.*SetterT)(idx, value);
-    resolveRef(node)->markDirtyAndPropagate();
+void updateStyle(YGNodeRef nodeRef, IdxT idx, ValueT value) {
+  auto node = resolveRef(nodeRef);
+  if ((node->style().*GetterT)(idx) != value) {
+    (node->mutableStyle().*SetterT)(idx, value);
+    node->markDirtyAndPropagate();
   }
 }
 
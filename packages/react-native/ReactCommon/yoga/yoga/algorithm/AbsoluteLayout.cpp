@@ -5,14 +5,49 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <algorithm>
+#include <vector>
+
 #include <yoga/algorithm/AbsoluteLayout.h>
 #include <yoga/algorithm/Align.h>
 #include <yoga/algorithm/BoundAxis.h>
 #include <yoga/algorithm/CalculateLayout.h>
 #include <yoga/algorithm/TrailingPosition.h>
+#include <yoga/numeric/Comparison.h>
 
 namespace facebook::yoga {
 
+bool AbsoluteChildLayout::hasSameInputs(
+    const AbsoluteChildLayout& other) const {
+  return parentFlexDirection == other.parentFlexDirection &&
+      parentJustifyContent == other.parentJustifyContent &&
+      parentAlignItems == other.parentAlignItems &&
+      parentFlexWrap == other.parentFlexWrap && errata == other.errata &&
+      direction == other.direction &&
+      widthSizingMode == other.widthSizingMode &&
+      inexactEquals(containingBlockWidth, other.containingBlockWidth) &&
+      inexactEquals(containingBlockHeight, other.containingBlockHeight) &&
+      inexactEquals(
+             containingNodeAvailableInnerWidth,
+             other.containingNodeAvailableInnerWidth) &&
+      inexactEquals(
+             containingNodeAvailableInnerHeight,
+             other.containingNodeAvailableInnerHeight) &&
+      inexactEquals(containingNodeWidth, other.containingNodeWidth) &&
+      inexactEquals(containingNodeHeight, other.containingNodeHeight) &&
+      inexactEquals(containingNodeBorder, other.containingNodeBorder) &&
+      inexactEquals(parentWidth, other.parentWidth) &&
+      inexactEquals(parentHeight, other.parentHeight) &&
+      inexactEquals(parentBorder, other.parentBorder) &&
+      inexactEquals(parentPadding, other.parentPadding) &&
+      inexactEquals(
+             parentMainOffsetFromContainingBlock,
+             other.parentMainOffsetFromContainingBlock) &&
+      inexactEquals(
+             parentCrossOffsetFromContainingBlock,
+             other.parentCrossOffsetFromContainingBlock);
+}
+
 static inline void setFlexStartLayoutPosition(
     const yoga::Node* const parent,
     yoga::Node* child,
@@ -472,6 +507,187 @@ void layoutAbsoluteChild(
       containingBlockHeight);
 }
 
+static std::array<float, 4> physicalEdges(
+    const LayoutResults& layout,
+    float (LayoutResults::*edge)(PhysicalEdge) const) {
+  return {
+      (layout.*edge)(PhysicalEdge::Left),
+      (layout.*edge)(PhysicalEdge::Top),
+      (layout.*edge)(PhysicalEdge::Right),
+      (layout.*edge)(PhysicalEdge::Bottom)};
+}
+
+static void layoutAndPositionAbsoluteChild(
+    yoga::Node* containingNode,
+    yoga::Node* currentNode,
+    yoga::Node* child,
+    SizingMode widthSizingMode,
+    Direction currentNodeDirection,
+    LayoutData& layoutMarkerData,
+    uint32_t currentDepth,
+    uint32_t generationCount,
+    float currentNodeMainOffsetFromContainingBlock,
+    float currentNodeCrossOffsetFromContainingBlock,
+    float containingNodeAvailableInnerWidth,
+    float containingNodeAvailableInnerHeight) {
+  const FlexDirection mainAxis = resolveDirection(
+      currentNode->style().flexDirection(), currentNodeDirection);
+  const FlexDirection crossAxis =
+      resolveCrossDirection(mainAxis, currentNodeDirection);
+
+  const bool absoluteErrata =
+      currentNode->hasErrata(Errata::AbsolutePercentAgainstInnerSize);
+  const float containingBlockWidth = absoluteErrata
+      ? containingNodeAvailableInnerWidth
+      : containingNode->getLayout().measuredDimension(Dimension::Width) -
+          containingNode->style().computeBorderForAxis(FlexDirection::Row);
+  const float containingBlockHeight = absoluteErrata
+      ? containingNodeAvailableInnerHeight
+      : containingNode->getLayout().measuredDimension(Dimension::Height) -
+          containingNode->style().computeBorderForAxis(FlexDirection::Column);
+
+  // The layout and position of a child whose style and subtree didn't change
+  // only depend on these, so they are kept as they are if these are the same
+  // as the last time.
+  const auto& containingLayout = containingNode->getLayout();
+  const auto& parentLayout = currentNode->getLayout();
+  const auto& parentStyle = currentNode->style();
+  auto absoluteChildLayout = AbsoluteChildLayout{
+      containingBlockWidth,
+      containingBlockHeight,
+      containingNodeAvailableInnerWidth,
+      containingNodeAvailableInnerHeight,
+      containingLayout.measuredDimension(Dimension::Width),
+      containingLayout.measuredDimension(Dimension::Height),
+      physicalEdges(containingLayout, &LayoutResults::border),
+      parentLayout.measuredDimension(Dimension::Width),
+      parentLayout.measuredDimension(Dimension::Height),
+      physicalEdges(parentLayout, &LayoutResults::border),
+      physicalEdges(parentLayout, &LayoutResults::padding),
+      currentNodeMainOffsetFromContainingBlock,
+      currentNodeCrossOffsetFromContainingBlock,
+      parentStyle.flexDirection(),
+      parentStyle.justifyContent(),
+      parentStyle.alignItems(),
+      parentStyle.flexWrap(),
+      currentNode->getConfig()->getErrata(),
+      currentNodeDirection,
+      widthSizingMode,
+      {}};
+  auto& childLayout = child->getLayout();
+  if (!child->isDirty() && childLayout.absoluteChildLayout != nullptr &&
+      childLayout.absoluteChildLayout->hasSameInputs(absoluteChildLayout)) {
+    const auto& position = childLayout.absoluteChildLayout->position;
+    child->setLayoutPosition(position[0], PhysicalEdge::Left);
+    child->setLayoutPosition(position[1], PhysicalEdge::Top);
+    child->setLayoutPosition(position[2], PhysicalEdge::Right);
+    child->setLayoutPosition(position[3], PhysicalEdge::Bottom);
+    // Like for layouts served from the cache, since they get rounded again.
+    child->setLayoutDimension(
+        childLayout.measuredDimension(Dimension::Width), Dimension::Width);
+    child->setLayoutDimension(
+        childLayout.measuredDimension(Dimension::Height), Dimension::Height);
+    layoutMarkerData.cachedLayouts += 1;
+    return;
+  }
+
+  layoutAbsoluteChild(
+      containingNode,
+      currentNode,
+      child,
+      containingBlockWidth,
+      containingBlockHeight,
+      widthSizingMode,
+      currentNodeDirection,
+      layoutMarkerData,
+      currentDepth,
+      generationCount);
+
+  const bool isMainAxisRow = isRow(mainAxis);
+  const bool mainInsetsDefined = isMainAxisRow
+      ? child->style().horizontalInsetsDefined()
+      : child->style().verticalInsetsDefined();
+  const bool crossInsetsDefined = isMainAxisRow
+      ? child->style().verticalInsetsDefined()
+      : child->style().horizontalInsetsDefined();
+
+  const float childMainOffsetFromParent = mainInsetsDefined
+      ? (child->getLayout().position(flexStartEdge(mainAxis)) -
+         currentNodeMainOffsetFromContainingBlock)
+      : child->getLayout().position(flexStartEdge(mainAxis));
+  const float childCrossOffsetFromParent = crossInsetsDefined
+      ? (child->getLayout().position(flexStartEdge(crossAxis)) -
+         currentNodeCrossOffsetFromContainingBlock)
+      : child->getLayout().position(flexStartEdge(crossAxis));
+
+  child->setLayoutPosition(childMainOffsetFromParent, flexStartEdge(mainAxis));
+  child->setLayoutPosition(
+      childCrossOffsetFromParent, flexStartEdge(crossAxis));
+
+  if (needsTrailingPosition(mainAxis)) {
+    setChildTrailingPosition(currentNode, child, mainAxis);
+  }
+  if (needsTrailingPosition(crossAxis)) {
+    setChildTrailingPosition(currentNode, child, crossAxis);
+  }
+
+  absoluteChildLayout.position =
+      physicalEdges(childLayout, &LayoutResults::position);
+  childLayout.absoluteChildLayout =
+      std::make_shared<const AbsoluteChildLayout>(absoluteChildLayout);
+}
+
+// Arguments of `layoutAndPositionAbsoluteChild` shared by the absolutely
+// positioned children of a node which are laid out concurrently. Every task
+// counts into its own `LayoutData`, which get merged once all tasks finished.
+struct AbsoluteChildrenLayoutTasks {
+  yoga::Node* containingNode;
+  yoga::Node* currentNode;
+  const std::vector<yoga::Node*>& children;
+  std::vector<LayoutData> layoutMarkerData;
+  SizingMode widthSizingMode;
+  Direction currentNodeDirection;
+  uint32_t currentDepth;
+  uint32_t generationCount;
+  float currentNodeMainOffsetFromContainingBlock;
+  float currentNodeCrossOffsetFromContainingBlock;
+  float containingNodeAvailableInnerWidth;
+  float containingNodeAvailableInnerHeight;
+};
+
+static void runAbsoluteChildLayoutTask(void* taskContext, size_t taskIndex) {
+  auto& tasks = *static_cast<AbsoluteChildrenLayoutTasks*>(taskContext);
+  layoutAndPositionAbsoluteChild(
+      tasks.containingNode,
+      tasks.currentNode,
+      tasks.children[taskIndex],
+      tasks.widthSizingMode,
+      tasks.currentNodeDirection,
+      tasks.layoutMarkerData[taskIndex],
+      tasks.currentDepth,
+      tasks.generationCount,
+      tasks.currentNodeMainOffsetFromContainingBlock,
+      tasks.currentNodeCrossOffsetFromContainingBlock,
+      tasks.containingNodeAvailableInnerWidth,
+      tasks.containingNodeAvailableInnerHeight);
+}
+
+static void mergeLayoutData(LayoutData& into, const LayoutData& from) {
+  into.layouts += from.layouts;
+  into.measures += from.measures;
+  into.maxMeasureCache = std::max(into.maxMeasureCache, from.maxMeasureCache);
+  into.cachedLayouts += from.cachedLayouts;
+  into.cachedMeasures += from.cachedMeasures;
+  into.measureCallbacks += from.measureCallbacks;
+  into.batchMeasureCallbacks += from.batchMeasureCallbacks;
+  into.incrementalLayouts += from.incrementalLayouts;
+  for (size_t i = 0; i < into.measureCallbackReasonsCount.size(); i++) {
+    into.measureCallbackReasonsCount[i] += from.measureCallbackReasonsCount[i];
+    into.cacheHitReasonsCount[i] += from.cacheHitReasonsCount[i];
+    into.cacheMissReasonsCount[i] += from.cacheMissReasonsCount[i];
+  }
+}
+
 void layoutAbsoluteDescendants(
     yoga::Node* containingNode,
     yoga::Node* currentNode,
@@ -488,61 +704,68 @@ void layoutAbsoluteDescendants(
       currentNode->style().flexDirection(), currentNodeDirection);
   const FlexDirection crossAxis =
       resolveCrossDirection(mainAxis, currentNodeDirection);
+
+  // The absolute children of the node are laid out by their containing block,
+  // which may be any ancestor.
+  currentNode->getLayout().descendantsPointScaleFactor = 0;
+
+  // Absolutely positioned children do not affect each other or the rest of
+  // the tree, so they can be laid out concurrently.
+  const auto parallelLayoutFunc =
+      containingNode->getConfig()->getParallelLayoutFunc();
+  std::vector<yoga::Node*> absoluteChildren;
+  if (parallelLayoutFunc != nullptr) {
+    for (auto child : currentNode->getChildren()) {
+      if (child->style().display() != Display::None &&
+          child->style().positionType() == PositionType::Absolute) {
+        absoluteChildren.push_back(child);
+      }
+    }
+  }
+
+  const bool layoutAbsoluteChildrenInParallel = absoluteChildren.size() > 1;
+  if (layoutAbsoluteChildrenInParallel) {
+    auto tasks = AbsoluteChildrenLayoutTasks{
+        containingNode,
+        currentNode,
+        absoluteChildren,
+        std::vector<LayoutData>(absoluteChildren.size(), LayoutData{}),
+        widthSizingMode,
+        currentNodeDirection,
+        currentDepth,
+        generationCount,
+        currentNodeMainOffsetFromContainingBlock,
+        currentNodeCrossOffsetFromContainingBlock,
+        containingNodeAvailableInnerWidth,
+        containingNodeAvailableInnerHeight};
+    parallelLayoutFunc(
+        containingNode->getConfig(),
+        absoluteChildren.size(),
+        &tasks,
+        runAbsoluteChildLayoutTask);
+    for (const auto& taskLayoutMarkerData : tasks.layoutMarkerData) {
+      mergeLayoutData(layoutMarkerData, taskLayoutMarkerData);
+    }
+  }
+
   for (auto child : currentNode->getChildren()) {
     if (child->style().display() == Display::None) {
       continue;
     } else if (child->style().positionType() == PositionType::Absolute) {
-      const bool absoluteErrata =
-          currentNode->hasErrata(Errata::AbsolutePercentAgainstInnerSize);
-      const float containingBlockWidth = absoluteErrata
-          ? containingNodeAvailableInnerWidth
-          : containingNode->getLayout().measuredDimension(Dimension::Width) -
-              containingNode->style().computeBorderForAxis(FlexDirection::Row);
-      const float containingBlockHeight = absoluteErrata
-          ? containingNodeAvailableInnerHeight
-          : containingNode->getLayout().measuredDimension(Dimension::Height) -
-              containingNode->style().computeBorderForAxis(
-                  FlexDirection::Column);
-
-      layoutAbsoluteChild(
-          containingNode,
-          currentNode,
-          child,
-          containingBlockWidth,
-          containingBlockHeight,
-          widthSizingMode,
-          currentNodeDirection,
-          layoutMarkerData,
-          currentDepth,
-          generationCount);
-
-      const bool isMainAxisRow = isRow(mainAxis);
-      const bool mainInsetsDefined = isMainAxisRow
-          ? child->style().horizontalInsetsDefined()
-          : child->style().verticalInsetsDefined();
-      const bool crossInsetsDefined = isMainAxisRow
-          ? child->style().verticalInsetsDefined()
-          : child->style().horizontalInsetsDefined();
-
-      const float childMainOffsetFromParent = mainInsetsDefined
-          ? (child->getLayout().position(flexStartEdge(mainAxis)) -
-             currentNodeMainOffsetFromContainingBlock)
-          : child->getLayout().position(flexStartEdge(mainAxis));
-      const float childCrossOffsetFromParent = crossInsetsDefined
-          ? (child->getLayout().position(flexStartEdge(crossAxis)) -
-             currentNodeCrossOffsetFromContainingBlock)
-          : child->getLayout().position(flexStartEdge(crossAxis));
-
-      child->setLayoutPosition(
-          childMainOffsetFromParent, flexStartEdge(mainAxis));
-      child->setLayoutPosition(
-          childCrossOffsetFromParent, flexStartEdge(crossAxis));
-
-      if (needsTrailingPosition(mainAxis)) {
-        setChildTrailingPosition(currentNode, child, mainAxis);
-      }
-      if (needsTrailingPosition(crossAxis)) {
-        setChildTrailingPosition(currentNode, child, crossAxis);
+      if (!layoutAbsoluteChildrenInParallel) {
+        layoutAndPositionAbsoluteChild(
+            containingNode,
+            currentNode,
+            child,
+            widthSizingMode,
+            currentNodeDirection,
+            layoutMarkerData,
+            currentDepth,
+            generationCount,
+            currentNodeMainOffsetFromContainingBlock,
+            currentNodeCrossOffsetFromContainingBlock,
+            containingNodeAvailableInnerWidth,
+            containingNodeAvailableInnerHeight);
       }
     } else if (
         child->style().positionType() == PositionType::Static &&
@@ -571,4 +794,5 @@ void layoutAbsoluteDescendants(
     }
   }
 }
+
 } // namespace facebook::yoga
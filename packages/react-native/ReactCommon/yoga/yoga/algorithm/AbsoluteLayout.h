@@ -7,11 +7,48 @@
 
 #pragma once
 
+#include <array>
+
 #include <yoga/event/event.h>
 #include <yoga/node/Node.h>
 
 namespace facebook::yoga {
 
+// Everything outside of an absolutely positioned child which its layout and
+// position within its containing block depend on, and the resulting position.
+// A child whose style and subtree didn't change since it was laid out under
+// equal inputs keeps its layout, and gets that position back (the flex layout
+// of its parent overrides it beforehand).
+struct AbsoluteChildLayout {
+  float containingBlockWidth;
+  float containingBlockHeight;
+  float containingNodeAvailableInnerWidth;
+  float containingNodeAvailableInnerHeight;
+  float containingNodeWidth;
+  float containingNodeHeight;
+  std::array<float, 4> containingNodeBorder;
+  // The node the child is a child of, which may be the containing node.
+  float parentWidth;
+  float parentHeight;
+  std::array<float, 4> parentBorder;
+  std::array<float, 4> parentPadding;
+  float parentMainOffsetFromContainingBlock;
+  float parentCrossOffsetFromContainingBlock;
+  FlexDirection parentFlexDirection;
+  Justify parentJustifyContent;
+  Align parentAlignItems;
+  Wrap parentFlexWrap;
+  Errata errata;
+  Direction direction;
+  SizingMode widthSizingMode;
+
+  std::array<float, 4> position;
+
+  // Whether the inputs are equal. Sizes and offsets are compared like the ones
+  // of cached measurements.
+  bool hasSameInputs(const AbsoluteChildLayout& other) const;
+};
+
 void layoutAbsoluteChild(
     const yoga::Node* const containingNode,
     const yoga::Node* const node,
@@ -11,16 +11,27 @@
 #include <yoga/algorithm/Baseline.h>
 #include <yoga/debug/AssertFatal.h>
 #include <yoga/event/event.h>
+#include <yoga/numeric/Comparison.h>
 
 namespace facebook::yoga {
 
-float calculateBaseline(const yoga::Node* node) {
+float calculateBaseline(yoga::Node* node) {
   if (node->hasBaselineFunc()) {
+    auto& layout = node->getLayout();
+    const float width = layout.measuredDimension(Dimension::Width);
+    const float height = layout.measuredDimension(Dimension::Height);
+
+    // Baseline functions are usually text queries, which are expensive.
+    const auto& cachedBaseline = layout.cachedBaseline;
+    if (!yoga::isUndefined(cachedBaseline.baseline) &&
+        yoga::inexactEquals(cachedBaseline.width, width) &&
+        yoga::inexactEquals(cachedBaseline.height, height)) {
+      return cachedBaseline.baseline;
+    }
+
     Event::publish<Event::NodeBaselineStart>(node);
 
-    const float baseline = node->baseline(
-        node->getLayout().measuredDimension(Dimension::Width),
-        node->getLayout().measuredDimension(Dimension::Height));
+    const float baseline = node->baseline(width, height);
 
     Event::publish<Event::NodeBaselineEnd>(node);
 
@@ -28,6 +39,7 @@ float calculateBaseline(const yoga::Node* node) {
         node,
         !std::isnan(baseline),
         "Expect custom baseline function to not return NaN");
+    layout.cachedBaseline = {width, height, baseline};
     return baseline;
   }
 
@@ -13,7 +13,9 @@
 namespace facebook::yoga {
 
 // Calculate baseline represented as an offset from the top edge of the node.
-float calculateBaseline(const yoga::Node* node);
+// The result of the baseline function of the node is cached in its layout
+// results until the node is laid out again after being dirtied.
+float calculateBaseline(yoga::Node* node);
 
 // Whether any of the children of this node participate in baseline alignment
 bool isBaselineLayout(const yoga::Node* node);
@@ -61,6 +61,169 @@ static void constrainMaxSizeForMode(
   }
 }
 
+// Constraints a child without a definite flex basis or main axis dimension is
+// measured under to find its flex basis.
+struct FlexBasisMeasureConstraints {
+  float width;
+  float height;
+  SizingMode widthSizingMode;
+  SizingMode heightSizingMode;
+};
+
+static FlexBasisMeasureConstraints computeFlexBasisMeasureConstraints(
+    const yoga::Node* const node,
+    yoga::Node* const child,
+    const float width,
+    const SizingMode widthMode,
+    const float height,
+    const float ownerWidth,
+    const float ownerHeight,
+    const SizingMode heightMode,
+    const Direction direction) {
+  const FlexDirection mainAxis =
+      resolveDirection(node->style().flexDirection(), direction);
+  const bool isMainAxisRow = isRow(mainAxis);
+  const bool isRowStyleDimDefined =
+      child->hasDefiniteLength(Dimension::Width, ownerWidth);
+  const bool isColumnStyleDimDefined =
+      child->hasDefiniteLength(Dimension::Height, ownerHeight);
+
+  float childWidth = YGUndefined;
+  float childHeight = YGUndefined;
+  SizingMode childWidthSizingMode = SizingMode::MaxContent;
+  SizingMode childHeightSizingMode = SizingMode::MaxContent;
+
+  auto marginRow =
+      child->style().computeMarginForAxis(FlexDirection::Row, ownerWidth);
+  auto marginColumn =
+      child->style().computeMarginForAxis(FlexDirection::Column, ownerWidth);
+
+  if (isRowStyleDimDefined) {
+    childWidth = child->getResolvedDimension(Dimension::Width)
+                     .resolve(ownerWidth)
+                     .unwrap() +
+        marginRow;
+    childWidthSizingMode = SizingMode::StretchFit;
+  }
+  if (isColumnStyleDimDefined) {
+    childHeight = child->getResolvedDimension(Dimension::Height)
+                      .resolve(ownerHeight)
+                      .unwrap() +
+        marginColumn;
+    childHeightSizingMode = SizingMode::StretchFit;
+  }
+
+  // The W3C spec doesn't say anything about the 'overflow' property, but all
+  // major browsers appear to implement the following logic.
+  if ((!isMainAxisRow && node->style().overflow() == Overflow::Scroll) ||
+      node->style().overflow() != Overflow::Scroll) {
+    if (yoga::isUndefined(childWidth) && yoga::isDefined(width)) {
+      childWidth = width;
+      childWidthSizingMode = SizingMode::FitContent;
+    }
+  }
+
+  if ((isMainAxisRow && node->style().overflow() == Overflow::Scroll) ||
+      node->style().overflow() != Overflow::Scroll) {
+    if (yoga::isUndefined(childHeight) && yoga::isDefined(height)) {
+      childHeight = height;
+      childHeightSizingMode = SizingMode::FitContent;
+    }
+  }
+
+  const auto& childStyle = child->style();
+  if (childStyle.aspectRatio().isDefined()) {
+    if (!isMainAxisRow && childWidthSizingMode == SizingMode::StretchFit) {
+      childHeight = marginColumn +
+          (childWidth - marginRow) / childStyle.aspectRatio().unwrap();
+      childHeightSizingMode = SizingMode::StretchFit;
+    } else if (
+        isMainAxisRow && childHeightSizingMode == SizingMode::StretchFit) {
+      childWidth = marginRow +
+          (childHeight - marginColumn) * childStyle.aspectRatio().unwrap();
+      childWidthSizingMode = SizingMode::StretchFit;
+    }
+  }
+
+  // If child has no defined size in the cross axis and is set to stretch, set
+  // the cross axis to be measured exactly with the available inner width
+
+  const bool hasExactWidth =
+      yoga::isDefined(width) && widthMode == SizingMode::StretchFit;
+  const bool childWidthStretch =
+      resolveChildAlignment(node, child) == Align::Stretch &&
+      childWidthSizingMode != SizingMode::StretchFit;
+  if (!isMainAxisRow && !isRowStyleDimDefined && hasExactWidth &&
+      childWidthStretch) {
+    childWidth = width;
+    childWidthSizingMode = SizingMode::StretchFit;
+    if (childStyle.aspectRatio().isDefined()) {
+      childHeight =
+          (childWidth - marginRow) / childStyle.aspectRatio().unwrap();
+      childHeightSizingMode = SizingMode::StretchFit;
+    }
+  }
+
+  const bool hasExactHeight =
+      yoga::isDefined(height) && heightMode == SizingMode::StretchFit;
+  const bool childHeightStretch =
+      resolveChildAlignment(node, child) == Align::Stretch &&
+      childHeightSizingMode != SizingMode::StretchFit;
+  if (isMainAxisRow && !isColumnStyleDimDefined && hasExactHeight &&
+      childHeightStretch) {
+    childHeight = height;
+    childHeightSizingMode = SizingMode::StretchFit;
+
+    if (childStyle.aspectRatio().isDefined()) {
+      childWidth =
+          (childHeight - marginColumn) * childStyle.aspectRatio().unwrap();
+      childWidthSizingMode = SizingMode::StretchFit;
+    }
+  }
+
+  constrainMaxSizeForMode(
+      child,
+      FlexDirection::Row,
+      ownerWidth,
+      ownerWidth,
+      &childWidthSizingMode,
+      &childWidth);
+  constrainMaxSizeForMode(
+      child,
+      FlexDirection::Column,
+      ownerHeight,
+      ownerWidth,
+      &childHeightSizingMode,
+      &childHeight);
+
+  return {
+      childWidth, childHeight, childWidthSizingMode, childHeightSizingMode};
+}
+
+// Whether computeFlexBasisForChild measures the child to find its flex basis.
+static bool isFlexBasisMeasured(
+    const yoga::Node* const node,
+    yoga::Node* const child,
+    const float width,
+    const float height,
+    const float ownerWidth,
+    const float ownerHeight,
+    const Direction direction) {
+  const FlexDirection mainAxis =
+      resolveDirection(node->style().flexDirection(), direction);
+  const bool isMainAxisRow = isRow(mainAxis);
+  const float mainAxisSize = isMainAxisRow ? width : height;
+  const float mainAxisownerSize = isMainAxisRow ? ownerWidth : ownerHeight;
+
+  if (child->resolveFlexBasisPtr().resolve(mainAxisownerSize).isDefined() &&
+      yoga::isDefined(mainAxisSize)) {
+    return false;
+  }
+  return isMainAxisRow
+      ? !child->hasDefiniteLength(Dimension::Width, ownerWidth)
+      : !child->hasDefiniteLength(Dimension::Height, ownerHeight);
+}
+
 static void computeFlexBasisForChild(
     const yoga::Node* const node,
     yoga::Node* const child,
@@ -80,11 +243,6 @@ static void computeFlexBasisForChild(
   const float mainAxisSize = isMainAxisRow ? width : height;
   const float mainAxisownerSize = isMainAxisRow ? ownerWidth : ownerHeight;
 
-  float childWidth;
-  float childHeight;
-  SizingMode childWidthSizingMode;
-  SizingMode childHeightSizingMode;
-
   const FloatOptional resolvedFlexBasis =
       child->resolveFlexBasisPtr().resolve(mainAxisownerSize);
   const bool isRowStyleDimDefined =
@@ -120,122 +278,25 @@ static void computeFlexBasisForChild(
   } else {
     // Compute the flex basis and hypothetical main size (i.e. the clamped flex
     // basis).
-    childWidth = YGUndefined;
-    childHeight = YGUndefined;
-    childWidthSizingMode = SizingMode::MaxContent;
-    childHeightSizingMode = SizingMode::MaxContent;
-
-    auto marginRow =
-        child->style().computeMarginForAxis(FlexDirection::Row, ownerWidth);
-    auto marginColumn =
-        child->style().computeMarginForAxis(FlexDirection::Column, ownerWidth);
-
-    if (isRowStyleDimDefined) {
-      childWidth = child->getResolvedDimension(Dimension::Width)
-                       .resolve(ownerWidth)
-                       .unwrap() +
-          marginRow;
-      childWidthSizingMode = SizingMode::StretchFit;
-    }
-    if (isColumnStyleDimDefined) {
-      childHeight = child->getResolvedDimension(Dimension::Height)
-                        .resolve(ownerHeight)
-                        .unwrap() +
-          marginColumn;
-      childHeightSizingMode = SizingMode::StretchFit;
-    }
-
-    // The W3C spec doesn't say anything about the 'overflow' property, but all
-    // major browsers appear to implement the following logic.
-    if ((!isMainAxisRow && node->style().overflow() == Overflow::Scroll) ||
-        node->style().overflow() != Overflow::Scroll) {
-      if (yoga::isUndefined(childWidth) && yoga::isDefined(width)) {
-        childWidth = width;
-        childWidthSizingMode = SizingMode::FitContent;
-      }
-    }
-
-    if ((isMainAxisRow && node->style().overflow() == Overflow::Scroll) ||
-        node->style().overflow() != Overflow::Scroll) {
-      if (yoga::isUndefined(childHeight) && yoga::isDefined(height)) {
-        childHeight = height;
-        childHeightSizingMode = SizingMode::FitContent;
-      }
-    }
-
-    const auto& childStyle = child->style();
-    if (childStyle.aspectRatio().isDefined()) {
-      if (!isMainAxisRow && childWidthSizingMode == SizingMode::StretchFit) {
-        childHeight = marginColumn +
-            (childWidth - marginRow) / childStyle.aspectRatio().unwrap();
-        childHeightSizingMode = SizingMode::StretchFit;
-      } else if (
-          isMainAxisRow && childHeightSizingMode == SizingMode::StretchFit) {
-        childWidth = marginRow +
-            (childHeight - marginColumn) * childStyle.aspectRatio().unwrap();
-        childWidthSizingMode = SizingMode::StretchFit;
-      }
-    }
-
-    // If child has no defined size in the cross axis and is set to stretch, set
-    // the cross axis to be measured exactly with the available inner width
-
-    const bool hasExactWidth =
-        yoga::isDefined(width) && widthMode == SizingMode::StretchFit;
-    const bool childWidthStretch =
-        resolveChildAlignment(node, child) == Align::Stretch &&
-        childWidthSizingMode != SizingMode::StretchFit;
-    if (!isMainAxisRow && !isRowStyleDimDefined && hasExactWidth &&
-        childWidthStretch) {
-      childWidth = width;
-      childWidthSizingMode = SizingMode::StretchFit;
-      if (childStyle.aspectRatio().isDefined()) {
-        childHeight =
-            (childWidth - marginRow) / childStyle.aspectRatio().unwrap();
-        childHeightSizingMode = SizingMode::StretchFit;
-      }
-    }
-
-    const bool hasExactHeight =
-        yoga::isDefined(height) && heightMode == SizingMode::StretchFit;
-    const bool childHeightStretch =
-        resolveChildAlignment(node, child) == Align::Stretch &&
-        childHeightSizingMode != SizingMode::StretchFit;
-    if (isMainAxisRow && !isColumnStyleDimDefined && hasExactHeight &&
-        childHeightStretch) {
-      childHeight = height;
-      childHeightSizingMode = SizingMode::StretchFit;
-
-      if (childStyle.aspectRatio().isDefined()) {
-        childWidth =
-            (childHeight - marginColumn) * childStyle.aspectRatio().unwrap();
-        childWidthSizingMode = SizingMode::StretchFit;
-      }
-    }
-
-    constrainMaxSizeForMode(
+    const auto constraints = computeFlexBasisMeasureConstraints(
+        node,
         child,
-        FlexDirection::Row,
+        width,
+        widthMode,
+        height,
         ownerWidth,
-        ownerWidth,
-        &childWidthSizingMode,
-        &childWidth);
-    constrainMaxSizeForMode(
-        child,
-        FlexDirection::Column,
         ownerHeight,
-        ownerWidth,
-        &childHeightSizingMode,
-        &childHeight);
+        heightMode,
+        direction);
 
     // Measure the child
     calculateLayoutInternal(
         child,
-        childWidth,
-        childHeight,
+        constraints.width,
+        constraints.height,
         direction,
-        childWidthSizingMode,
-        childHeightSizingMode,
+        constraints.widthSizingMode,
+        constraints.heightSizingMode,
         ownerWidth,
         ownerHeight,
         false,
@@ -305,28 +366,38 @@ static void measureNodeWithMeasureFunc(
             ownerWidth),
         Dimension::Height);
   } else {
-    Event::publish<Event::MeasureCallbackStart>(node);
+    YGSize measuredSize;
+    if (auto batchedSize = node->takeBatchedMeasurement(
+            innerWidth,
+            measureMode(widthSizingMode),
+            innerHeight,
+            measureMode(heightSizingMode))) {
+      // The owner measured the text already, see batchMeasureChildren.
+      measuredSize = *batchedSize;
+    } else {
+      Event::publish<Event::MeasureCallbackStart>(node);
 
-    // Measure the text under the current constraints.
-    const YGSize measuredSize = node->measure(
-        innerWidth,
-        measureMode(widthSizingMode),
-        innerHeight,
-        measureMode(heightSizingMode));
+      // Measure the text under the current constraints.
+      measuredSize = node->measure(
+          innerWidth,
+          measureMode(widthSizingMode),
+          innerHeight,
+          measureMode(heightSizingMode));
 
-    layoutMarkerData.measureCallbacks += 1;
-    layoutMarkerData.measureCallbackReasonsCount[static_cast<size_t>(reason)] +=
-        1;
+      layoutMarkerData.measureCallbacks += 1;
+      layoutMarkerData
+          .measureCallbackReasonsCount[static_cast<size_t>(reason)] += 1;
 
-    Event::publish<Event::MeasureCallbackEnd>(
-        node,
-        {innerWidth,
-         unscopedEnum(measureMode(widthSizingMode)),
-         innerHeight,
-         unscopedEnum(measureMode(heightSizingMode)),
-         measuredSize.width,
-         measuredSize.height,
-         reason});
+      Event::publish<Event::MeasureCallbackEnd>(
+          node,
+          {innerWidth,
+           unscopedEnum(measureMode(widthSizingMode)),
+           innerHeight,
+           unscopedEnum(measureMode(heightSizingMode)),
+           measuredSize.width,
+           measuredSize.height,
+           reason});
+    }
 
     node->setLayoutMeasuredDimension(
         boundAxis(
@@ -477,6 +548,221 @@ static float calculateAvailableInnerDimension(
   return availableInnerDim;
 }
 
+// Whether calculateLayoutInternal finds a measurement of a node with a measure
+// function under the given constraints in the caches of the node.
+static bool hasCachedMeasurement(
+    const yoga::Node* const node,
+    const float availableWidth,
+    const SizingMode widthSizingMode,
+    const float availableHeight,
+    const SizingMode heightSizingMode,
+    const float ownerWidth) {
+  const auto& layout = node->getLayout();
+  const float marginAxisRow =
+      node->style().computeMarginForAxis(FlexDirection::Row, ownerWidth);
+  const float marginAxisColumn =
+      node->style().computeMarginForAxis(FlexDirection::Column, ownerWidth);
+
+  const auto canUse = [&](const CachedMeasurement& cachedMeasurement) {
+    return canUseCachedMeasurement(
+        widthSizingMode,
+        availableWidth,
+        heightSizingMode,
+        availableHeight,
+        cachedMeasurement.widthSizingMode,
+        cachedMeasurement.availableWidth,
+        cachedMeasurement.heightSizingMode,
+        cachedMeasurement.availableHeight,
+        cachedMeasurement.computedWidth,
+        cachedMeasurement.computedHeight,
+        marginAxisRow,
+        marginAxisColumn,
+        node->getConfig());
+  };
+
+  if (canUse(layout.cachedLayout)) {
+    return true;
+  }
+  for (size_t i = 0; i < layout.cachedMeasurements.size(); i++) {
+    if (canUse(layout.cachedMeasurements[i])) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Measures the children with measure functions which computeFlexBasisForChild
+// is going to call the measure function of in a single call of the batch
+// measure function of the node or its config, if there are several of them.
+// The results stand in for the measure function calls when these are under
+// the same constraints, so constraints which are predicted wrong only cost
+// the children an extra measurement. Returns whether the children were
+// measured.
+static bool batchMeasureChildren(
+    yoga::Node* const node,
+    const YGNodeConstRef singleFlexChild,
+    const float availableInnerWidth,
+    const float availableInnerHeight,
+    const SizingMode widthSizingMode,
+    const SizingMode heightSizingMode,
+    const Direction direction,
+    LayoutData& layoutMarkerData,
+    const uint32_t generationCount) {
+  const YGBatchMeasureFunc batchMeasureFunc =
+      node->getBatchMeasureFunc() != nullptr
+      ? node->getBatchMeasureFunc()
+      : node->getConfig()->getBatchMeasureFunc();
+  if (batchMeasureFunc == nullptr) {
+    return false;
+  }
+
+  std::vector<yoga::Node*> measuredChildren;
+  std::vector<YGMeasureRequest> requests;
+  for (auto child : node->getChildren()) {
+    if (!child->hasMeasureFunc() || child == singleFlexChild ||
+        child->style().display() == Display::None ||
+        child->style().positionType() == PositionType::Absolute) {
+      continue;
+    }
+
+    child->resolveDimension();
+    if (!isFlexBasisMeasured(
+            node,
+            child,
+            availableInnerWidth,
+            availableInnerHeight,
+            availableInnerWidth,
+            availableInnerHeight,
+            direction)) {
+      continue;
+    }
+
+    const auto constraints = computeFlexBasisMeasureConstraints(
+        node,
+        child,
+        availableInnerWidth,
+        widthSizingMode,
+        availableInnerHeight,
+        availableInnerWidth,
+        availableInnerHeight,
+        heightSizingMode,
+        direction);
+    if (constraints.widthSizingMode == SizingMode::StretchFit &&
+        constraints.heightSizingMode == SizingMode::StretchFit) {
+      continue;
+    }
+
+    const auto& layout = child->getLayout();
+    const bool needToVisitChild =
+        (child->isDirty() && layout.generationCount != generationCount) ||
+        layout.lastOwnerDirection != direction;
+    if (!needToVisitChild &&
+        hasCachedMeasurement(
+            child,
+            constraints.width,
+            constraints.widthSizingMode,
+            constraints.height,
+            constraints.heightSizingMode,
+            availableInnerWidth)) {
+      continue;
+    }
+
+    // Compute the constraints given to the measure function the way
+    // calculateLayoutImpl and measureNodeWithMeasureFunc do.
+    const auto& style = child->style();
+    const Direction childDirection = child->resolveDirection(direction);
+    const FlexDirection flexRowDirection =
+        resolveDirection(FlexDirection::Row, childDirection);
+    const FlexDirection flexColumnDirection =
+        resolveDirection(FlexDirection::Column, childDirection);
+    const float ownerWidth = availableInnerWidth;
+
+    const float marginAxisRow =
+        style.computeInlineStartMargin(
+            flexRowDirection, childDirection, ownerWidth) +
+        style.computeInlineEndMargin(
+            flexRowDirection, childDirection, ownerWidth);
+    const float marginAxisColumn =
+        style.computeInlineStartMargin(
+            flexColumnDirection, childDirection, ownerWidth) +
+        style.computeInlineEndMargin(
+            flexColumnDirection, childDirection, ownerWidth);
+
+    const bool isLTR = childDirection == Direction::LTR;
+    const float paddingRowStart = style.computeInlineStartPadding(
+        flexRowDirection, childDirection, ownerWidth);
+    const float paddingRowEnd = style.computeInlineEndPadding(
+        flexRowDirection, childDirection, ownerWidth);
+    const float borderRowStart =
+        style.computeInlineStartBorder(flexRowDirection, childDirection);
+    const float borderRowEnd =
+        style.computeInlineEndBorder(flexRowDirection, childDirection);
+    const float paddingAndBorderAxisRow =
+        (isLTR ? paddingRowStart : paddingRowEnd) +
+        (isLTR ? paddingRowEnd : paddingRowStart) +
+        (isLTR ? borderRowStart : borderRowEnd) +
+        (isLTR ? borderRowEnd : borderRowStart);
+    const float paddingAndBorderAxisColumn =
+        style.computeInlineStartPadding(
+            flexColumnDirection, childDirection, ownerWidth) +
+        style.computeInlineEndPadding(
+            flexColumnDirection, childDirection, ownerWidth) +
+        style.computeInlineStartBorder(flexColumnDirection, childDirection) +
+        style.computeInlineEndBorder(flexColumnDirection, childDirection);
+
+    const float availableWidth =
+        constraints.widthSizingMode == SizingMode::MaxContent
+        ? YGUndefined
+        : constraints.width - marginAxisRow;
+    const float availableHeight =
+        constraints.heightSizingMode == SizingMode::MaxContent
+        ? YGUndefined
+        : constraints.height - marginAxisColumn;
+    const float innerWidth = yoga::isUndefined(availableWidth)
+        ? availableWidth
+        : yoga::maxOrDefined(0.0f, availableWidth - paddingAndBorderAxisRow);
+    const float innerHeight = yoga::isUndefined(availableHeight)
+        ? availableHeight
+        : yoga::maxOrDefined(
+              0.0f, availableHeight - paddingAndBorderAxisColumn);
+
+    measuredChildren.push_back(child);
+    requests.push_back(
+        {child,
+         innerWidth,
+         unscopedEnum(measureMode(constraints.widthSizingMode)),
+         innerHeight,
+         unscopedEnum(measureMode(constraints.heightSizingMode))});
+  }
+
+  // A single child is measured as well by its own measure function.
+  if (requests.size() < 2) {
+    return false;
+  }
+
+  std::vector<YGSize> results(requests.size());
+  Event::publish<Event::BatchMeasureCallbackStart>(node);
+  batchMeasureFunc(node, requests.data(), results.data(), requests.size());
+  Event::publish<Event::BatchMeasureCallbackEnd>(node, {requests.size()});
+
+  const auto count = static_cast<int>(requests.size());
+  layoutMarkerData.batchMeasureCallbacks += 1;
+  layoutMarkerData.measureCallbacks += count;
+  layoutMarkerData.measureCallbackReasonsCount[static_cast<size_t>(
+      LayoutPassReason::kMeasureChild)] += count;
+
+  for (size_t i = 0; i < requests.size(); i++) {
+    const auto& request = requests[i];
+    measuredChildren[i]->setBatchedMeasurement(Node::BatchedMeasurement{
+        request.width,
+        scopedEnum(request.widthMode),
+        request.height,
+        scopedEnum(request.heightMode),
+        results[i]});
+  }
+  return true;
+}
+
 static float computeFlexBasisForChildren(
     yoga::Node* const node,
     const float availableInnerWidth,
@@ -514,6 +800,17 @@ static float computeFlexBasisForChildren(
     }
   }
 
+  const bool isBatchMeasured = batchMeasureChildren(
+      node,
+      singleFlexChild,
+      availableInnerWidth,
+      availableInnerHeight,
+      widthSizingMode,
+      heightSizingMode,
+      direction,
+      layoutMarkerData,
+      generationCount);
+
   for (auto child : children) {
     child->resolveDimension();
     if (child->style().display() == Display::None) {
@@ -560,6 +857,13 @@ static float computeFlexBasisForChildren(
          child->style().computeMarginForAxis(mainAxis, availableInnerWidth));
   }
 
+  // Drop the measurements which were predicted wrong and were not used.
+  if (isBatchMeasured) {
+    for (auto child : children) {
+      child->setBatchedMeasurement(std::nullopt);
+    }
+  }
+
   return totalOuterFlexBasis;
 }
 
@@ -573,7 +877,6 @@ static float distributeFreeSpaceSecondPass(
     const FlexDirection mainAxis,
     const FlexDirection crossAxis,
     const Direction direction,
-    const float mainAxisownerSize,
     const float availableInnerMainDim,
     const float availableInnerCrossDim,
     const float availableInnerWidth,
@@ -591,19 +894,15 @@ static float distributeFreeSpaceSecondPass(
   const bool isMainAxisRow = isRow(mainAxis);
   const bool isNodeFlexWrap = node->style().flexWrap() != Wrap::NoWrap;
 
-  for (auto currentLineChild : flexLine.itemsInFlow) {
-    childFlexBasis = boundAxisWithinMinAndMax(
-                         currentLineChild,
-                         mainAxis,
-                         currentLineChild->getLayout().computedFlexBasis,
-                         mainAxisownerSize)
-                         .unwrap();
+  for (size_t i = 0; i < flexLine.itemsInFlow.size(); i++) {
+    auto currentLineChild = flexLine.itemsInFlow[i];
+    const auto& itemFactors = flexLine.itemFactors[i];
+    childFlexBasis = itemFactors.boundFlexBasis;
     float updatedMainSize = childFlexBasis;
 
     if (yoga::isDefined(flexLine.layout.remainingFreeSpace) &&
         flexLine.layout.remainingFreeSpace < 0) {
-      flexShrinkScaledFactor =
-          -currentLineChild->resolveFlexShrink() * childFlexBasis;
+      flexShrinkScaledFactor = -itemFactors.flexShrink * childFlexBasis;
       // Is this child able to shrink?
       if (flexShrinkScaledFactor != 0) {
         float childSize;
@@ -628,7 +927,7 @@ static float distributeFreeSpaceSecondPass(
     } else if (
         yoga::isDefined(flexLine.layout.remainingFreeSpace) &&
         flexLine.layout.remainingFreeSpace > 0) {
-      flexGrowFactor = currentLineChild->resolveFlexGrow();
+      flexGrowFactor = itemFactors.flexGrow;
 
       // Is this child able to grow?
       if (!std::isnan(flexGrowFactor) && flexGrowFactor != 0) {
@@ -759,7 +1058,6 @@ static float distributeFreeSpaceSecondPass(
 static void distributeFreeSpaceFirstPass(
     FlexLine& flexLine,
     const FlexDirection mainAxis,
-    const float mainAxisownerSize,
     const float availableInnerMainDim,
     const float availableInnerWidth) {
   float flexShrinkScaledFactor = 0;
@@ -768,17 +1066,13 @@ static void distributeFreeSpaceFirstPass(
   float boundMainSize = 0;
   float deltaFreeSpace = 0;
 
-  for (auto currentLineChild : flexLine.itemsInFlow) {
-    float childFlexBasis = boundAxisWithinMinAndMax(
-                               currentLineChild,
-                               mainAxis,
-                               currentLineChild->getLayout().computedFlexBasis,
-                               mainAxisownerSize)
-                               .unwrap();
+  for (size_t i = 0; i < flexLine.itemsInFlow.size(); i++) {
+    auto currentLineChild = flexLine.itemsInFlow[i];
+    const auto& itemFactors = flexLine.itemFactors[i];
+    float childFlexBasis = itemFactors.boundFlexBasis;
 
     if (flexLine.layout.remainingFreeSpace < 0) {
-      flexShrinkScaledFactor =
-          -currentLineChild->resolveFlexShrink() * childFlexBasis;
+      flexShrinkScaledFactor = -itemFactors.flexShrink * childFlexBasis;
 
       // Is this child able to shrink?
       if (yoga::isDefined(flexShrinkScaledFactor) &&
@@ -801,14 +1095,14 @@ static void distributeFreeSpaceFirstPass(
           // first and second passes.
           deltaFreeSpace += boundMainSize - childFlexBasis;
           flexLine.layout.totalFlexShrinkScaledFactors -=
-              (-currentLineChild->resolveFlexShrink() *
+              (-itemFactors.flexShrink *
                currentLineChild->getLayout().computedFlexBasis.unwrap());
         }
       }
     } else if (
         yoga::isDefined(flexLine.layout.remainingFreeSpace) &&
         flexLine.layout.remainingFreeSpace > 0) {
-      flexGrowFactor = currentLineChild->resolveFlexGrow();
+      flexGrowFactor = itemFactors.flexGrow;
 
       // Is this child able to grow?
       if (yoga::isDefined(flexGrowFactor) && flexGrowFactor != 0) {
@@ -865,7 +1159,6 @@ static void resolveFlexibleLength(
     const FlexDirection mainAxis,
     const FlexDirection crossAxis,
     const Direction direction,
-    const float mainAxisownerSize,
     const float availableInnerMainDim,
     const float availableInnerCrossDim,
     const float availableInnerWidth,
@@ -881,7 +1174,6 @@ static void resolveFlexibleLength(
   distributeFreeSpaceFirstPass(
       flexLine,
       mainAxis,
-      mainAxisownerSize,
       availableInnerMainDim,
       availableInnerWidth);
 
@@ -892,7 +1184,6 @@ static void resolveFlexibleLength(
       mainAxis,
       crossAxis,
       direction,
-      mainAxisownerSize,
       availableInnerMainDim,
       availableInnerCrossDim,
       availableInnerWidth,
@@ -907,11 +1198,11 @@ static void resolveFlexibleLength(
   flexLine.layout.remainingFreeSpace = originalFreeSpace - distributedFreeSpace;
 }
 
+template <FlexDirection mainAxis>
 static void justifyMainAxis(
     yoga::Node* const node,
     FlexLine& flexLine,
     const size_t startOfLineIndex,
-    const FlexDirection mainAxis,
     const FlexDirection crossAxis,
     const Direction direction,
     const SizingMode sizingModeMainDim,
@@ -1209,6 +1500,10 @@ static void calculateLayoutImpl(
 
   (performLayout ? layoutMarkerData.layouts : layoutMarkerData.measures) += 1;
 
+  // Laying the node out (or measuring it) may change the layout of any of its
+  // descendants.
+  node->getLayout().descendantsPointScaleFactor = 0;
+
   // Set the resolved resolution in the node's layout.
   const Direction direction = node->resolveDirection(ownerDirection);
   node->setLayoutDirection(direction);
@@ -1500,7 +1795,6 @@ static void calculateLayoutImpl(
           mainAxis,
           crossAxis,
           direction,
-          mainAxisownerSize,
           availableInnerMainDim,
           availableInnerCrossDim,
           availableInnerWidth,
@@ -1524,21 +1818,22 @@ static void calculateLayoutImpl(
     // of items that are aligned "stretch". We need to compute these stretch
     // values and set the final positions.
 
-    justifyMainAxis(
-        node,
-        flexLine,
-        startOfLineIndex,
-        mainAxis,
-        crossAxis,
-        direction,
-        sizingModeMainDim,
-        sizingModeCrossDim,
-        mainAxisownerSize,
-        ownerWidth,
-        availableInnerMainDim,
-        availableInnerCrossDim,
-        availableInnerWidth,
-        performLayout);
+    visitFlexDirection(mainAxis, [&](auto staticMainAxis) {
+      justifyMainAxis<decltype(staticMainAxis)::value>(
+          node,
+          flexLine,
+          startOfLineIndex,
+          crossAxis,
+          direction,
+          sizingModeMainDim,
+          sizingModeCrossDim,
+          mainAxisownerSize,
+          ownerWidth,
+          availableInnerMainDim,
+          availableInnerCrossDim,
+          availableInnerWidth,
+          performLayout);
+    });
 
     float containerCrossAxis = availableInnerCrossDim;
     if (sizingModeCrossDim == SizingMode::MaxContent ||
@@ -2090,6 +2385,170 @@ static void calculateLayoutImpl(
   }
 }
 
+static bool canKeepLayoutOfChildren(
+    yoga::Node* node,
+    LayoutData& layoutMarkerData,
+    uint32_t depth,
+    uint32_t generationCount);
+
+// Measures a dirty node whose measured content changed again under the
+// constraints of all its cached measurements. Returns whether every one of
+// them still holds, i.e. everything the previous layout of its owner was
+// based on. The node is left as it was either way, so that it is measured
+// like any other dirty node if the layout of its owner cannot be kept.
+static bool remeasureInPlace(
+    yoga::Node* const node,
+    LayoutData& layoutMarkerData,
+    const uint32_t depth,
+    const uint32_t generationCount) {
+  auto& layout = node->getLayout();
+
+  // The cached measurements of nodes which were measured during this layout
+  // pass already are the new ones, and the others need to have kept all of
+  // them.
+  if (layout.generationCount == generationCount ||
+      !layout.hasAllCachedMeasurements) {
+    return false;
+  }
+  const auto previousGenerationCount = layout.generationCount;
+  const auto previousMeasurements = layout.cachedMeasurements;
+  const auto previousLayout = layout.cachedLayout;
+  const float measuredWidth = layout.measuredDimension(Dimension::Width);
+  const float measuredHeight = layout.measuredDimension(Dimension::Height);
+
+  const auto remeasure = [&](const CachedMeasurement& measurement) {
+    calculateLayoutInternal(
+        node,
+        measurement.availableWidth,
+        measurement.availableHeight,
+        layout.lastOwnerDirection,
+        measurement.widthSizingMode,
+        measurement.heightSizingMode,
+        measurement.ownerWidth,
+        measurement.ownerHeight,
+        false,
+        LayoutPassReason::kMeasureChild,
+        layoutMarkerData,
+        depth,
+        generationCount);
+    return yoga::inexactEquals(
+               layout.measuredDimension(Dimension::Width),
+               measurement.computedWidth) &&
+        yoga::inexactEquals(
+               layout.measuredDimension(Dimension::Height),
+               measurement.computedHeight);
+  };
+
+  // The layout of nodes with measure functions may have been served by any
+  // cached measurement.
+  bool isUnchanged =
+      previousMeasurements.size() > 0 || previousLayout.computedWidth >= 0;
+  for (size_t i = 0; isUnchanged && i < previousMeasurements.size(); i++) {
+    isUnchanged = remeasure(previousMeasurements[i]);
+  }
+  if (isUnchanged && previousLayout.computedWidth >= 0) {
+    isUnchanged = remeasure(previousLayout);
+  }
+
+  layout.generationCount = previousGenerationCount;
+  layout.cachedMeasurements = previousMeasurements;
+  layout.cachedLayout = previousLayout;
+  layout.hasAllCachedMeasurements = true;
+  node->setLayoutMeasuredDimension(measuredWidth, Dimension::Width);
+  node->setLayoutMeasuredDimension(measuredHeight, Dimension::Height);
+  if (!isUnchanged) {
+    // The owner lays the node out from scratch, which needs no more checks.
+    node->markDirtyAndPropagate(Node::DirtyReason::Self);
+  }
+  return isUnchanged;
+}
+
+// Checks whether a dirty node can keep its previous layout, without touching
+// anything but the cached measurements of descendants whose measured content
+// changed, so that the layout of the node is unaffected if it cannot. Nodes
+// whose own style or children changed cannot.
+static bool canKeepLayoutInPlace(
+    yoga::Node* const node,
+    LayoutData& layoutMarkerData,
+    const uint32_t depth,
+    const uint32_t generationCount) {
+  switch (node->getDirtyReason()) {
+    case Node::DirtyReason::Self:
+      return false;
+    case Node::DirtyReason::Content:
+      return remeasureInPlace(node, layoutMarkerData, depth, generationCount);
+    case Node::DirtyReason::Descendants:
+      return node->getLayout().cachedLayout.computedWidth >= 0 &&
+          canKeepLayoutOfChildren(
+                 node, layoutMarkerData, depth, generationCount);
+  }
+  return false;
+}
+
+// Whether the dirty children of a node which is only dirty because some of
+// its descendants are can keep their previous layout, and with it everything
+// the previous layout of the node was based on.
+static bool canKeepLayoutOfChildren(
+    yoga::Node* const node,
+    LayoutData& layoutMarkerData,
+    const uint32_t depth,
+    const uint32_t generationCount) {
+  for (auto child : node->getChildren()) {
+    if (!child->isDirty()) {
+      continue;
+    }
+    // Absolute children are laid out apart from the flex layout, and
+    // baselines of children may change without their sizes changing.
+    if (child->style().display() == Display::None ||
+        child->style().positionType() == PositionType::Absolute ||
+        resolveChildAlignment(node, child) == Align::Baseline ||
+        !canKeepLayoutInPlace(
+            child, layoutMarkerData, depth + 1, generationCount)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Marks the dirty descendants of a node which keeps its previous layout as
+// laid out.
+static void keepLayoutOfChildren(yoga::Node* const node) {
+  for (auto child : node->getChildren()) {
+    if (child->isDirty()) {
+      child->setDirty(false);
+      keepLayoutOfChildren(child);
+    }
+  }
+}
+
+// Whether the previous layout of a dirty node is still valid for the given
+// constraints.
+static bool canKeepLayout(
+    yoga::Node* const node,
+    const float availableWidth,
+    const float availableHeight,
+    const Direction ownerDirection,
+    const SizingMode widthSizingMode,
+    const SizingMode heightSizingMode,
+    const float ownerWidth,
+    const float ownerHeight,
+    LayoutData& layoutMarkerData,
+    const uint32_t depth,
+    const uint32_t generationCount) {
+  const auto& layout = node->getLayout();
+  const auto& cachedLayout = layout.cachedLayout;
+  return node->getDirtyReason() == Node::DirtyReason::Descendants &&
+      cachedLayout.computedWidth >= 0 &&
+      layout.lastOwnerDirection == ownerDirection &&
+      cachedLayout.widthSizingMode == widthSizingMode &&
+      cachedLayout.heightSizingMode == heightSizingMode &&
+      yoga::inexactEquals(cachedLayout.availableWidth, availableWidth) &&
+      yoga::inexactEquals(cachedLayout.availableHeight, availableHeight) &&
+      yoga::inexactEquals(cachedLayout.ownerWidth, ownerWidth) &&
+      yoga::inexactEquals(cachedLayout.ownerHeight, ownerHeight) &&
+      canKeepLayoutOfChildren(node, layoutMarkerData, depth, generationCount);
+}
+
 //
 // This is a wrapper around the calculateLayoutImpl function. It determines
 // whether the layout request is redundant and can be skipped.
@@ -2116,22 +2575,47 @@ bool calculateLayoutInternal(
 
   depth++;
 
-  const bool needToVisitNode =
+  bool needToVisitNode =
       (node->isDirty() && layout->generationCount != generationCount) ||
       layout->lastOwnerDirection != ownerDirection;
 
+  if (needToVisitNode) {
+    // The content of the node may have changed even if its layout is kept.
+    layout->cachedBaseline = {};
+  }
+
+  if (needToVisitNode && performLayout &&
+      canKeepLayout(
+          node,
+          availableWidth,
+          availableHeight,
+          ownerDirection,
+          widthSizingMode,
+          heightSizingMode,
+          ownerWidth,
+          ownerHeight,
+          layoutMarkerData,
+          depth,
+          generationCount)) {
+    // The layout is used from the cache like the one of a non-dirty node.
+    keepLayoutOfChildren(node);
+    needToVisitNode = false;
+    layoutMarkerData.incrementalLayouts += 1;
+  }
+
   if (needToVisitNode) {
     // Invalidate the cached results.
-    layout->nextCachedMeasurementsIndex = 0;
+    layout->cachedMeasurements.clear();
     layout->cachedLayout.availableWidth = -1;
     layout->cachedLayout.availableHeight = -1;
     layout->cachedLayout.widthSizingMode = SizingMode::MaxContent;
     layout->cachedLayout.heightSizingMode = SizingMode::MaxContent;
     layout->cachedLayout.computedWidth = -1;
     layout->cachedLayout.computedHeight = -1;
+    layout->hasAllCachedMeasurements = true;
   }
 
-  CachedMeasurement* cachedResults = nullptr;
+  const CachedMeasurement* cachedResults = nullptr;
 
   // Determine whether the results are already cached. We maintain a separate
   // cache for layouts and measurements. A layout operation modifies the
@@ -2165,22 +2649,23 @@ bool calculateLayoutInternal(
       cachedResults = &layout->cachedLayout;
     } else {
       // Try to use the measurement cache.
-      for (size_t i = 0; i < layout->nextCachedMeasurementsIndex; i++) {
+      for (size_t i = 0; i < layout->cachedMeasurements.size(); i++) {
+        const auto& cachedMeasurement = layout->cachedMeasurements[i];
         if (canUseCachedMeasurement(
                 widthSizingMode,
                 availableWidth,
                 heightSizingMode,
                 availableHeight,
-                layout->cachedMeasurements[i].widthSizingMode,
-                layout->cachedMeasurements[i].availableWidth,
-                layout->cachedMeasurements[i].heightSizingMode,
-                layout->cachedMeasurements[i].availableHeight,
-                layout->cachedMeasurements[i].computedWidth,
-                layout->cachedMeasurements[i].computedHeight,
+                cachedMeasurement.widthSizingMode,
+                cachedMeasurement.availableWidth,
+                cachedMeasurement.heightSizingMode,
+                cachedMeasurement.availableHeight,
+                cachedMeasurement.computedWidth,
+                cachedMeasurement.computedHeight,
                 marginAxisRow,
                 marginAxisColumn,
                 node->getConfig())) {
-          cachedResults = &layout->cachedMeasurements[i];
+          cachedResults = &layout->cachedMeasurements.hit(i);
           break;
         }
       }
@@ -2195,14 +2680,15 @@ bool calculateLayoutInternal(
       cachedResults = &layout->cachedLayout;
     }
   } else {
-    for (uint32_t i = 0; i < layout->nextCachedMeasurementsIndex; i++) {
+    for (size_t i = 0; i < layout->cachedMeasurements.size(); i++) {
+      const auto& cachedMeasurement = layout->cachedMeasurements[i];
       if (yoga::inexactEquals(
-              layout->cachedMeasurements[i].availableWidth, availableWidth) &&
+              cachedMeasurement.availableWidth, availableWidth) &&
           yoga::inexactEquals(
-              layout->cachedMeasurements[i].availableHeight, availableHeight) &&
-          layout->cachedMeasurements[i].widthSizingMode == widthSizingMode &&
-          layout->cachedMeasurements[i].heightSizingMode == heightSizingMode) {
-        cachedResults = &layout->cachedMeasurements[i];
+              cachedMeasurement.availableHeight, availableHeight) &&
+          cachedMeasurement.widthSizingMode == widthSizingMode &&
+          cachedMeasurement.heightSizingMode == heightSizingMode) {
+        cachedResults = &layout->cachedMeasurements.hit(i);
         break;
       }
     }
@@ -2216,7 +2702,10 @@ bool calculateLayoutInternal(
 
     (performLayout ? layoutMarkerData.cachedLayouts
                    : layoutMarkerData.cachedMeasures) += 1;
+    layoutMarkerData.cacheHitReasonsCount[static_cast<size_t>(reason)] += 1;
   } else {
+    layoutMarkerData.cacheMissReasonsCount[static_cast<size_t>(reason)] += 1;
+
     calculateLayoutImpl(
         node,
         availableWidth,
@@ -2237,28 +2726,32 @@ bool calculateLayoutInternal(
     if (cachedResults == nullptr) {
       layoutMarkerData.maxMeasureCache = std::max(
           layoutMarkerData.maxMeasureCache,
-          layout->nextCachedMeasurementsIndex + 1u);
-
-      if (layout->nextCachedMeasurementsIndex ==
-          LayoutResults::MaxCachedMeasurements) {
-        layout->nextCachedMeasurementsIndex = 0;
-      }
+          static_cast<uint32_t>(layout->cachedMeasurements.size()) + 1u);
 
       CachedMeasurement* newCacheEntry;
       if (performLayout) {
         // Use the single layout cache entry.
         newCacheEntry = &layout->cachedLayout;
+        if (layout->cachedLayout.computedWidth >= 0) {
+          layout->hasAllCachedMeasurements = false;
+        }
       } else {
-        // Allocate a new measurement cache entry.
-        newCacheEntry =
-            &layout->cachedMeasurements[layout->nextCachedMeasurementsIndex];
-        layout->nextCachedMeasurementsIndex++;
+        // Add a measurement cache entry, replacing the least used one if the
+        // cache is full.
+        const auto maxCachedMeasurements =
+            node->getConfig()->getMaxCachedMeasurements();
+        if (layout->cachedMeasurements.size() >= maxCachedMeasurements) {
+          layout->hasAllCachedMeasurements = false;
+        }
+        newCacheEntry = &layout->cachedMeasurements.add(maxCachedMeasurements);
       }
 
       newCacheEntry->availableWidth = availableWidth;
       newCacheEntry->availableHeight = availableHeight;
       newCacheEntry->widthSizingMode = widthSizingMode;
       newCacheEntry->heightSizingMode = heightSizingMode;
+      newCacheEntry->ownerWidth = ownerWidth;
+      newCacheEntry->ownerHeight = ownerHeight;
       newCacheEntry->computedWidth =
           layout->measuredDimension(Dimension::Width);
       newCacheEntry->computedHeight =
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include <yoga/Yoga.h>
 
 #include <yoga/debug/AssertFatal.h>
@@ -18,12 +20,12 @@
 
 namespace facebook::yoga {
 
-inline bool isRow(const FlexDirection flexDirection) {
+constexpr bool isRow(const FlexDirection flexDirection) {
   return flexDirection == FlexDirection::Row ||
       flexDirection == FlexDirection::RowReverse;
 }
 
-inline bool isColumn(const FlexDirection flexDirection) {
+constexpr bool isColumn(const FlexDirection flexDirection) {
   return flexDirection == FlexDirection::Column ||
       flexDirection == FlexDirection::ColumnReverse;
 }
@@ -50,7 +52,7 @@ inline FlexDirection resolveCrossDirection(
       : FlexDirection::Column;
 }
 
-inline PhysicalEdge flexStartEdge(FlexDirection flexDirection) {
+constexpr PhysicalEdge flexStartEdge(FlexDirection flexDirection) {
   switch (flexDirection) {
     case FlexDirection::Column:
       return PhysicalEdge::Top;
@@ -65,7 +67,7 @@ inline PhysicalEdge flexStartEdge(FlexDirection flexDirection) {
   fatalWithMessage("Invalid FlexDirection");
 }
 
-inline PhysicalEdge flexEndEdge(FlexDirection flexDirection) {
+constexpr PhysicalEdge flexEndEdge(FlexDirection flexDirection) {
   switch (flexDirection) {
     case FlexDirection::Column:
       return PhysicalEdge::Bottom;
@@ -102,7 +104,7 @@ inline PhysicalEdge inlineEndEdge(
   return PhysicalEdge::Bottom;
 }
 
-inline Dimension dimension(FlexDirection flexDirection) {
+constexpr Dimension dimension(FlexDirection flexDirection) {
   switch (flexDirection) {
     case FlexDirection::Column:
       return Dimension::Height;
@@ -117,4 +119,29 @@ inline Dimension dimension(FlexDirection flexDirection) {
   fatalWithMessage("Invalid FlexDirection");
 }
 
+/**
+ * Calls `f` with `flexDirection` as a compile-time constant (a
+ * `std::integral_constant<FlexDirection, ...>`), so that `f` is instantiated
+ * for every direction and axis lookups like `isRow`, `flexStartEdge` or
+ * `dimension` fold to constants within it. Meant to be called once per
+ * container, around the loops over its children.
+ */
+template <typename F>
+decltype(auto) visitFlexDirection(const FlexDirection flexDirection, F&& f) {
+  switch (flexDirection) {
+    case FlexDirection::Column:
+      return f(std::integral_constant<FlexDirection, FlexDirection::Column>{});
+    case FlexDirection::ColumnReverse:
+      return f(
+          std::integral_constant<FlexDirection, FlexDirection::ColumnReverse>{});
+    case FlexDirection::Row:
+      return f(std::integral_constant<FlexDirection, FlexDirection::Row>{});
+    case FlexDirection::RowReverse:
+      return f(
+          std::integral_constant<FlexDirection, FlexDirection::RowReverse>{});
+  }
+
+  fatalWithMessage("Invalid FlexDirection");
+}
+
 } // namespace facebook::yoga
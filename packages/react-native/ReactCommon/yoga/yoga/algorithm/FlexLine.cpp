@@ -13,9 +13,9 @@
 
 namespace facebook::yoga {
 
-FlexLine calculateFlexLine(
+template <FlexDirection mainAxis>
+static FlexLine calculateFlexLineImpl(
     yoga::Node* const node,
-    const Direction ownerDirection,
     const float mainAxisownerSize,
     const float availableInnerWidth,
     const float availableInnerMainDim,
@@ -23,6 +23,8 @@ FlexLine calculateFlexLine(
     const size_t lineCount) {
   std::vector<yoga::Node*> itemsInFlow;
   itemsInFlow.reserve(node->getChildren().size());
+  std::vector<FlexLineItemFactors> itemFactors;
+  itemFactors.reserve(node->getChildren().size());
 
   float sizeConsumed = 0.0f;
   float totalFlexGrowFactors = 0.0f;
@@ -31,8 +33,6 @@ FlexLine calculateFlexLine(
   size_t firstElementInLineIndex = startOfLineIndex;
 
   float sizeConsumedIncludingMinConstraint = 0;
-  const FlexDirection mainAxis = resolveDirection(
-      node->style().flexDirection(), node->resolveDirection(ownerDirection));
   const bool isNodeFlexWrap = node->style().flexWrap() != Wrap::NoWrap;
   const float gap = node->style().computeGapForAxis(mainAxis);
 
@@ -78,16 +78,22 @@ FlexLine calculateFlexLine(
     sizeConsumed += flexBasisWithMinAndMaxConstraints + childMarginMainAxis +
         childLeadingGapMainAxis;
 
-    if (child->isNodeFlexible()) {
-      totalFlexGrowFactors += child->resolveFlexGrow();
+    // Absolutely positioned children are skipped above, so the child is
+    // flexible if any of its flex factors is not zero.
+    const float flexGrow = child->resolveFlexGrow();
+    const float flexShrink = child->resolveFlexShrink();
+    if (flexGrow != 0 || flexShrink != 0) {
+      totalFlexGrowFactors += flexGrow;
 
       // Unlike the grow factor, the shrink factor is scaled relative to the
       // child dimension.
-      totalFlexShrinkScaledFactors += -child->resolveFlexShrink() *
-          child->getLayout().computedFlexBasis.unwrap();
+      totalFlexShrinkScaledFactors +=
+          -flexShrink * child->getLayout().computedFlexBasis.unwrap();
     }
 
     itemsInFlow.push_back(child);
+    itemFactors.push_back(FlexLineItemFactors{
+        flexBasisWithMinAndMaxConstraints, flexGrow, flexShrink});
   }
 
   // The total flex factor needs to be floored to 1.
@@ -102,6 +108,7 @@ FlexLine calculateFlexLine(
 
   return FlexLine{
       std::move(itemsInFlow),
+      std::move(itemFactors),
       sizeConsumed,
       endOfLineIndex,
       FlexLineRunningLayout{
@@ -110,4 +117,25 @@ FlexLine calculateFlexLine(
       }};
 }
 
+FlexLine calculateFlexLine(
+    yoga::Node* const node,
+    const Direction ownerDirection,
+    const float mainAxisownerSize,
+    const float availableInnerWidth,
+    const float availableInnerMainDim,
+    const size_t startOfLineIndex,
+    const size_t lineCount) {
+  const FlexDirection mainAxis = resolveDirection(
+      node->style().flexDirection(), node->resolveDirection(ownerDirection));
+  return visitFlexDirection(mainAxis, [&](auto staticMainAxis) {
+    return calculateFlexLineImpl<decltype(staticMainAxis)::value>(
+        node,
+        mainAxisownerSize,
+        availableInnerWidth,
+        availableInnerMainDim,
+        startOfLineIndex,
+        lineCount);
+  });
+}
+
 } // namespace facebook::yoga
@@ -37,12 +37,26 @@ struct FlexLineRunningLayout {
   float crossDim{0.0f};
 };
 
+// Values of an item in flow which are read for every item while distributing
+// free space within the line. They are resolved once when the line is
+// collected and stored contiguously, so the distribution passes do not go
+// through the item's style again.
+struct FlexLineItemFactors {
+  // The flex basis of the item, bound by its min and max main axis sizes.
+  float boundFlexBasis{0.0f};
+  float flexGrow{0.0f};
+  float flexShrink{0.0f};
+};
+
 struct FlexLine {
   // List of children which are part of the line flow. This means they are not
   // positioned absolutely, or with `display: "none"`, and do not overflow the
   // available dimensions.
   const std::vector<yoga::Node*> itemsInFlow{};
 
+  // Factors of the items in flow, in the same order as `itemsInFlow`.
+  const std::vector<FlexLineItemFactors> itemFactors{};
+
   // Accumulation of the dimensions and margin of all the children on the
   // current line. This will be used in order to either set the dimensions of
   // the node if none already exist or to compute the remaining space left for
@@ -96,12 +96,12 @@ void roundLayoutResultsToPixelGrid(
     // We multiply dimension by scale factor and if the result is close to the
     // whole number, we don't have any fraction To verify if the result is close
     // to whole number we want to check both floor and ceil numbers
-    const bool hasFractionalWidth =
-        !yoga::inexactEquals(fmod(nodeWidth * pointScaleFactor, 1.0), 0) &&
-        !yoga::inexactEquals(fmod(nodeWidth * pointScaleFactor, 1.0), 1.0);
-    const bool hasFractionalHeight =
-        !yoga::inexactEquals(fmod(nodeHeight * pointScaleFactor, 1.0), 0) &&
-        !yoga::inexactEquals(fmod(nodeHeight * pointScaleFactor, 1.0), 1.0);
+    const double widthFraction = fmod(nodeWidth * pointScaleFactor, 1.0);
+    const double heightFraction = fmod(nodeHeight * pointScaleFactor, 1.0);
+    const bool hasFractionalWidth = !yoga::inexactEquals(widthFraction, 0) &&
+        !yoga::inexactEquals(widthFraction, 1.0);
+    const bool hasFractionalHeight = !yoga::inexactEquals(heightFraction, 0) &&
+        !yoga::inexactEquals(heightFraction, 1.0);
 
     node->setLayoutDimension(
         roundValueToPixelGrid(
@@ -122,6 +122,16 @@ void roundLayoutResultsToPixelGrid(
             roundValueToPixelGrid(
                 absoluteNodeTop, pointScaleFactor, false, textRounding),
         Dimension::Height);
+
+    // Layout results which are on the pixel grid stay the same when they are
+    // rounded again, wherever the subtree moved. The descendants of a node
+    // whose layout was kept or served from the cache were not touched since
+    // they were last rounded, so they can be skipped.
+    auto& layout = node->getLayout();
+    if (layout.descendantsPointScaleFactor == pointScaleFactor) {
+      return;
+    }
+    layout.descendantsPointScaleFactor = pointScaleFactor;
   }
 
   for (yoga::Node* child : node->getChildren()) {
@@ -112,6 +112,46 @@ YGNodeRef Config::cloneNode(
   return clone;
 }
 
+void Config::setParallelLayoutFunc(YGParallelLayoutFunc parallelLayoutFunc) {
+  parallelLayoutFunc_ = parallelLayoutFunc;
+}
+
+YGParallelLayoutFunc Config::getParallelLayoutFunc() const {
+  return parallelLayoutFunc_;
+}
+
+void Config::setBatchMeasureFunc(YGBatchMeasureFunc batchMeasureFunc) {
+  batchMeasureFunc_ = batchMeasureFunc;
+}
+
+YGBatchMeasureFunc Config::getBatchMeasureFunc() const {
+  return batchMeasureFunc_;
+}
+
+void Config::setMaxCachedMeasurements(size_t maxCachedMeasurements) {
+  maxCachedMeasurements_ = maxCachedMeasurements;
+}
+
+size_t Config::getMaxCachedMeasurements() const {
+  return maxCachedMeasurements_;
+}
+
+void Config::setNodePoolCapacity(size_t capacity) {
+  nodePool_.setCapacity(capacity);
+}
+
+size_t Config::getNodePoolCapacity() const {
+  return nodePool_.getCapacity();
+}
+
+void* Config::allocateNode() const {
+  return nodePool_.allocate();
+}
+
+void Config::releaseNode(void* node) const {
+  nodePool_.release(node);
+}
+
 /*static*/ const Config& Config::getDefault() {
   static Config config{getDefaultLogger()};
   return config;
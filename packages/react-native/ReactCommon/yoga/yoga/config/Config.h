@@ -10,9 +10,11 @@
 #include <bitset>
 
 #include <yoga/Yoga.h>
+#include <yoga/config/NodePool.h>
 #include <yoga/enums/Errata.h>
 #include <yoga/enums/ExperimentalFeature.h>
 #include <yoga/enums/LogLevel.h>
+#include <yoga/node/LayoutResults.h>
 
 // Tag struct used to form the opaque YGConfigRef for the public C API
 struct YGConfig {};
@@ -64,11 +66,27 @@ class YG_EXPORT Config : public ::YGConfig {
   YGNodeRef
   cloneNode(YGNodeConstRef node, YGNodeConstRef owner, size_t childIndex) const;
 
+  void setParallelLayoutFunc(YGParallelLayoutFunc parallelLayoutFunc);
+  YGParallelLayoutFunc getParallelLayoutFunc() const;
+
+  void setBatchMeasureFunc(YGBatchMeasureFunc batchMeasureFunc);
+  YGBatchMeasureFunc getBatchMeasureFunc() const;
+
+  void setMaxCachedMeasurements(size_t maxCachedMeasurements);
+  size_t getMaxCachedMeasurements() const;
+
+  void setNodePoolCapacity(size_t capacity);
+  size_t getNodePoolCapacity() const;
+  void* allocateNode() const;
+  void releaseNode(void* node) const;
+
   static const Config& getDefault();
 
  private:
   YGCloneNodeFunc cloneNodeCallback_;
   YGLogger logger_;
+  YGParallelLayoutFunc parallelLayoutFunc_ = nullptr;
+  YGBatchMeasureFunc batchMeasureFunc_ = nullptr;
 
   bool useWebDefaults_ : 1 = false;
 
@@ -76,6 +94,9 @@ class YG_EXPORT Config : public ::YGConfig {
   Errata errata_ = Errata::None;
   float pointScaleFactor_ = 1.0f;
   void* context_ = nullptr;
+  size_t maxCachedMeasurements_ = LayoutResults::MaxCachedMeasurements;
+
+  mutable NodePool nodePool_;
 };
 
 inline Config* resolveRef(const YGConfigRef ref) {
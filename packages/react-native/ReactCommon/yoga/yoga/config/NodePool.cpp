@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <new>
+
+#include <yoga/config/NodePool.h>
+#include <yoga/node/Node.h>
+
+namespace facebook::yoga {
+
+NodePool::~NodePool() {
+  setCapacity(0);
+}
+
+void NodePool::setCapacity(size_t capacity) {
+  std::vector<void*> trimmedBlocks;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    capacity_ = capacity;
+    while (freeBlocks_.size() > capacity) {
+      trimmedBlocks.push_back(freeBlocks_.back());
+      freeBlocks_.pop_back();
+    }
+    if (capacity == 0) {
+      freeBlocks_.shrink_to_fit();
+    }
+  }
+  for (auto block : trimmedBlocks) {
+    ::operator delete(block);
+  }
+}
+
+size_t NodePool::getCapacity() const {
+  return capacity_;
+}
+
+void* NodePool::allocate() {
+  if (capacity_ != 0) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!freeBlocks_.empty()) {
+      auto block = freeBlocks_.back();
+      freeBlocks_.pop_back();
+      return block;
+    }
+  }
+  return ::operator new(sizeof(Node));
+}
+
+void NodePool::release(void* block) {
+  if (capacity_ != 0) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (freeBlocks_.size() < capacity_) {
+      freeBlocks_.push_back(block);
+      return;
+    }
+  }
+  ::operator delete(block);
+}
+
+} // namespace facebook::yoga
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace facebook::yoga {
+
+// Recycles the storage of freed nodes so that trees which are repeatedly torn
+// down and rebuilt reuse memory instead of going back to the system allocator
+// for every node. The pool holds up to `capacity` blocks of `sizeof(Node)`
+// bytes and is empty (a plain `operator new`/`operator delete`) by default.
+//
+// Blocks are individually allocated, so a node may be released into the pool
+// of another config than the one it was allocated from (see YGNodeSetConfig).
+// Pools may be used from multiple threads at once.
+class NodePool {
+ public:
+  NodePool() = default;
+  NodePool(const NodePool&) = delete;
+  NodePool& operator=(const NodePool&) = delete;
+  ~NodePool();
+
+  void setCapacity(size_t capacity);
+  size_t getCapacity() const;
+
+  // Returns uninitialized storage for a `Node`
+  void* allocate();
+
+  // Takes back storage of a destroyed `Node` returned by `allocate()`
+  void release(void* block);
+
+ private:
+  std::atomic<size_t> capacity_{0};
+  std::mutex mutex_;
+  std::vector<void*> freeBlocks_;
+};
+
+} // namespace facebook::yoga
@@ -42,8 +42,20 @@ struct LayoutData {
   int cachedLayouts;
   int cachedMeasures;
   int measureCallbacks;
+  // Calls of batch measure functions, whose measurements are included in
+  // measureCallbacks
+  int batchMeasureCallbacks;
+  // Layouts of dirty nodes which were kept, as laying out their dirty
+  // children again did not change their sizes or measurements
+  int incrementalLayouts;
   std::array<int, static_cast<uint8_t>(LayoutPassReason::COUNT)>
       measureCallbackReasonsCount;
+  // Layouts and measurements served from (hits) or not found in (misses) the
+  // layout and measurement caches of nodes, by the reason of their pass
+  std::array<int, static_cast<uint8_t>(LayoutPassReason::COUNT)>
+      cacheHitReasonsCount;
+  std::array<int, static_cast<uint8_t>(LayoutPassReason::COUNT)>
+      cacheMissReasonsCount;
 };
 
 const char* LayoutPassReasonToString(const LayoutPassReason value);
@@ -59,6 +71,8 @@ struct YG_EXPORT Event {
     MeasureCallbackEnd,
     NodeBaselineStart,
     NodeBaselineEnd,
+    BatchMeasureCallbackStart,
+    BatchMeasureCallbackEnd,
   };
   class Data;
   using Subscriber = void(YGNodeConstRef, Type, Data);
@@ -119,6 +133,11 @@ struct Event::TypedData<Event::MeasureCallbackEnd> {
   const LayoutPassReason reason;
 };
 
+template <>
+struct Event::TypedData<Event::BatchMeasureCallbackEnd> {
+  size_t measurements;
+};
+
 template <>
 struct Event::TypedData<Event::NodeLayout> {
   LayoutType layoutType;
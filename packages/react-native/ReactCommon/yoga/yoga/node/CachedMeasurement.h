@@ -25,6 +25,11 @@ struct CachedMeasurement {
   float computedWidth{-1};
   float computedHeight{-1};
 
+  // Size of the owner the measurement was made for, which is not part of
+  // what the cache is keyed by.
+  float ownerWidth{YGUndefined};
+  float ownerHeight{YGUndefined};
+
   bool operator==(CachedMeasurement measurement) const {
     bool isEqual = widthSizingMode == measurement.widthSizingMode &&
         heightSizingMode == measurement.heightSizingMode;
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+#include <limits>
+
+#include <yoga/node/CachedMeasurements.h>
+
+namespace facebook::yoga {
+
+CachedMeasurements::CachedMeasurements(const CachedMeasurements& other) {
+  *this = other;
+}
+
+CachedMeasurements& CachedMeasurements::operator=(
+    const CachedMeasurements& other) {
+  if (this == &other) {
+    return *this;
+  }
+  if (capacity_ < other.size_) {
+    entries_ = std::make_unique<CachedMeasurement[]>(other.size_);
+    hitCounts_ = std::make_unique<uint16_t[]>(other.size_);
+    capacity_ = other.size_;
+  }
+  std::copy_n(other.entries_.get(), other.size_, entries_.get());
+  std::copy_n(other.hitCounts_.get(), other.size_, hitCounts_.get());
+  size_ = other.size_;
+  nextReplacementIndex_ = other.nextReplacementIndex_;
+  return *this;
+}
+
+CachedMeasurement& CachedMeasurements::add(size_t maxSize) {
+  const auto limit =
+      static_cast<uint16_t>(std::clamp(maxSize, size_t{1}, MaxSize));
+
+  if (size_ < limit) {
+    if (size_ == capacity_) {
+      // Nodes needing more than one or two measurements are rare, so storage
+      // starts small and doubles from there.
+      const auto capacity = static_cast<uint16_t>(
+          std::min<size_t>(limit, std::max<size_t>(2, capacity_ * size_t{2})));
+      auto entries = std::make_unique<CachedMeasurement[]>(capacity);
+      auto hitCounts = std::make_unique<uint16_t[]>(capacity);
+      std::copy_n(entries_.get(), size_, entries.get());
+      std::copy_n(hitCounts_.get(), size_, hitCounts.get());
+      entries_ = std::move(entries);
+      hitCounts_ = std::move(hitCounts);
+      capacity_ = capacity;
+    }
+    hitCounts_[size_] = 0;
+    return entries_[size_++];
+  }
+
+  // The limit may have been lowered since the entries were added.
+  size_ = limit;
+  if (nextReplacementIndex_ >= size_) {
+    nextReplacementIndex_ = 0;
+  }
+
+  size_t replacedIndex = nextReplacementIndex_;
+  for (size_t offset = 1; offset < size_; offset++) {
+    const auto index = (nextReplacementIndex_ + offset) % size_;
+    if (hitCounts_[index] < hitCounts_[replacedIndex]) {
+      replacedIndex = index;
+    }
+  }
+
+  const auto replacedHitCount = hitCounts_[replacedIndex];
+  for (size_t index = 0; index < size_; index++) {
+    hitCounts_[index] =
+        static_cast<uint16_t>(hitCounts_[index] - replacedHitCount);
+  }
+  nextReplacementIndex_ = static_cast<uint16_t>((replacedIndex + 1) % size_);
+
+  entries_[replacedIndex] = CachedMeasurement{};
+  return entries_[replacedIndex];
+}
+
+const CachedMeasurement& CachedMeasurements::hit(size_t index) {
+  if (hitCounts_[index] < std::numeric_limits<uint16_t>::max()) {
+    hitCounts_[index]++;
+  }
+  return entries_[index];
+}
+
+bool CachedMeasurements::operator==(const CachedMeasurements& other) const {
+  return size_ == other.size_ &&
+      std::equal(
+             entries_.get(), entries_.get() + size_, other.entries_.get());
+}
+
+} // namespace facebook::yoga
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <yoga/node/CachedMeasurement.h>
+
+namespace facebook::yoga {
+
+// The measurements a node caches across layout passes. Most nodes are laid
+// out with a single set of constraints and never use it, so the entries live
+// out of line and storage is only allocated (and grown) as entries are added.
+//
+// Once the cache holds as many entries as allowed, adding an entry replaces
+// the one which was hit the fewest times, the least recently added one among
+// ties. Hit counts of the remaining entries are lowered by the count of the
+// replaced entry, so new entries get a chance to stay.
+class CachedMeasurements {
+ public:
+  // Maximum number of entries a cache may be limited to.
+  static constexpr size_t MaxSize = 256;
+
+  CachedMeasurements() = default;
+  CachedMeasurements(const CachedMeasurements& other);
+  CachedMeasurements& operator=(const CachedMeasurements& other);
+  CachedMeasurements(CachedMeasurements&&) noexcept = default;
+  CachedMeasurements& operator=(CachedMeasurements&&) noexcept = default;
+
+  size_t size() const {
+    return size_;
+  }
+
+  const CachedMeasurement& operator[](size_t index) const {
+    return entries_[index];
+  }
+
+  // Drops all entries, keeping their storage around.
+  void clear() {
+    size_ = 0;
+    nextReplacementIndex_ = 0;
+  }
+
+  // Returns the entry a new measurement must be written to, the cache holding
+  // at most `maxSize` entries afterwards.
+  CachedMeasurement& add(size_t maxSize);
+
+  // Returns the entry at `index`, counting it as a cache hit.
+  const CachedMeasurement& hit(size_t index);
+
+  bool operator==(const CachedMeasurements& other) const;
+
+ private:
+  std::unique_ptr<CachedMeasurement[]> entries_;
+  std::unique_ptr<uint16_t[]> hitCounts_;
+  uint16_t capacity_{0};
+  uint16_t size_{0};
+  uint16_t nextReplacementIndex_{0};
+};
+
+} // namespace facebook::yoga
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <array>
+#include <memory>
 
 #include <yoga/debug/AssertFatal.h>
 #include <yoga/enums/Dimension.h>
@@ -15,14 +16,18 @@
 #include <yoga/enums/Edge.h>
 #include <yoga/enums/PhysicalEdge.h>
 #include <yoga/node/CachedMeasurement.h>
+#include <yoga/node/CachedMeasurements.h>
 #include <yoga/numeric/FloatOptional.h>
 
 namespace facebook::yoga {
 
+struct AbsoluteChildLayout;
+
 struct LayoutResults {
+  // Default limit of cached measurements per node, which configs may change.
   // This value was chosen based on empirical data:
   // 98% of analyzed layouts require less than 8 entries.
-  static constexpr int32_t MaxCachedMeasurements = 8;
+  static constexpr uint32_t MaxCachedMeasurements = 8;
 
   uint32_t computedFlexBasisGeneration = 0;
   FloatOptional computedFlexBasis = {};
@@ -32,10 +37,32 @@ struct LayoutResults {
   uint32_t generationCount = 0;
   Direction lastOwnerDirection = Direction::Inherit;
 
-  uint32_t nextCachedMeasurementsIndex = 0;
-  std::array<CachedMeasurement, MaxCachedMeasurements> cachedMeasurements = {};
+  CachedMeasurements cachedMeasurements;
 
   CachedMeasurement cachedLayout{};
+  // Whether the caches hold every measurement and layout of the node since
+  // they were invalidated, so that they tell everything the layout of its
+  // owner was based on.
+  bool hasAllCachedMeasurements = false;
+
+  // The last result of the baseline function of the node, for its measured
+  // dimensions. Invalidated once a dirty node is laid out.
+  struct CachedBaseline {
+    float width{YGUndefined};
+    float height{YGUndefined};
+    float baseline{YGUndefined};
+  };
+  CachedBaseline cachedBaseline{};
+
+  // The point scale factor the layout results of all the descendants of the
+  // node were last rounded to the pixel grid for, or 0 if any of them may have
+  // changed since.
+  float descendantsPointScaleFactor = 0;
+
+  // What the last layout of the node as an absolutely positioned child was
+  // based on, besides the node itself (see `layoutAbsoluteDescendants`).
+  // Immutable, so copies of the node share it.
+  std::shared_ptr<const AbsoluteChildLayout> absoluteChildLayout;
 
   Direction direction() const {
     return direction_;
@@ -101,8 +128,8 @@ struct LayoutResults {
     padding_[yoga::to_underlying(physicalEdge)] = dimension;
   }
 
-  bool operator==(LayoutResults layout) const;
-  bool operator!=(LayoutResults layout) const {
+  bool operator==(const LayoutResults& layout) const;
+  bool operator!=(const LayoutResults& layout) const {
     return !(*this == layout);
   }
 
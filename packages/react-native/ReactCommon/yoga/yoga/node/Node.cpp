@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <iostream>
+#include <utility>
 
 #include <yoga/debug/AssertFatal.h>
 #include <yoga/node/Node.h>
@@ -30,12 +31,15 @@ Node::Node(Node&& node) {
   hasNewLayout_ = node.hasNewLayout_;
   isReferenceBaseline_ = node.isReferenceBaseline_;
   isDirty_ = node.isDirty_;
+  dirtyReason_ = node.dirtyReason_;
   alwaysFormsContainingBlock_ = node.alwaysFormsContainingBlock_;
   nodeType_ = node.nodeType_;
   context_ = node.context_;
   measureFunc_ = node.measureFunc_;
   baselineFunc_ = node.baselineFunc_;
   dirtiedFunc_ = node.dirtiedFunc_;
+  batchMeasureFunc_ = node.batchMeasureFunc_;
+  batchedMeasurement_ = node.batchedMeasurement_;
   style_ = node.style_;
   layout_ = node.layout_;
   lineIndex_ = node.lineIndex_;
@@ -43,7 +47,7 @@ Node::Node(Node&& node) {
   children_ = std::move(node.children_);
   config_ = node.config_;
   resolvedDimensions_ = node.resolvedDimensions_;
-  for (auto c : children_) {
+  for (auto c : children_.get()) {
     c->setOwner(this);
   }
 }
@@ -57,15 +61,28 @@ YGSize Node::measure(
       this, width, unscopedEnum(widthMode), height, unscopedEnum(heightMode));
 }
 
-float Node::baseline(float width, float height) const {
-  return baselineFunc_(this, width, height);
+std::optional<YGSize> Node::takeBatchedMeasurement(
+    float width,
+    MeasureMode widthMode,
+    float height,
+    MeasureMode heightMode) {
+  auto batchedMeasurement = std::exchange(batchedMeasurement_, std::nullopt);
+  if (batchedMeasurement.has_value() &&
+      batchedMeasurement->widthMode == widthMode &&
+      batchedMeasurement->heightMode == heightMode &&
+      (batchedMeasurement->width == width ||
+       (yoga::isUndefined(batchedMeasurement->width) &&
+        yoga::isUndefined(width))) &&
+      (batchedMeasurement->height == height ||
+       (yoga::isUndefined(batchedMeasurement->height) &&
+        yoga::isUndefined(height)))) {
+    return batchedMeasurement->size;
+  }
+  return std::nullopt;
 }
 
-float Node::dimensionWithMargin(
-    const FlexDirection axis,
-    const float widthSize) {
-  return getLayout().measuredDimension(dimension(axis)) +
-      style_.computeMarginForAxis(axis, widthSize);
+float Node::baseline(float width, float height) const {
+  return baselineFunc_(this, width, height);
 }
 
 bool Node::isLayoutDimensionDefined(const FlexDirection axis) {
@@ -83,7 +100,7 @@ void Node::setMeasureFunc(YGMeasureFunc measureFunc) {
   } else {
     yoga::assertFatalWithNode(
         this,
-        children_.size() == 0,
+        children_.get().empty(),
         "Cannot set measure function: Nodes with measure functions cannot have "
         "children.");
     // TODO: t18095186 Move nodeType to opt-in function and mark appropriate
@@ -95,15 +112,17 @@ void Node::setMeasureFunc(YGMeasureFunc measureFunc) {
 }
 
 void Node::replaceChild(Node* child, size_t index) {
-  children_[index] = child;
+  children_.edit()[index] = child;
 }
 
 void Node::replaceChild(Node* oldChild, Node* newChild) {
-  std::replace(children_.begin(), children_.end(), oldChild, newChild);
+  auto& children = children_.edit();
+  std::replace(children.begin(), children.end(), oldChild, newChild);
 }
 
 void Node::insertChild(Node* child, size_t index) {
-  children_.insert(children_.begin() + static_cast<ptrdiff_t>(index), child);
+  auto& children = children_.edit();
+  children.insert(children.begin() + static_cast<ptrdiff_t>(index), child);
 }
 
 void Node::setConfig(yoga::Config* config) {
@@ -122,6 +141,8 @@ void Node::setConfig(yoga::Config* config) {
 }
 
 void Node::setDirty(bool isDirty) {
+  // Nodes dirtied directly may have changed in any way.
+  dirtyReason_ = DirtyReason::Self;
   if (isDirty == isDirty_) {
     return;
   }
@@ -132,17 +153,20 @@ void Node::setDirty(bool isDirty) {
 }
 
 bool Node::removeChild(Node* child) {
-  std::vector<Node*>::iterator p =
-      std::find(children_.begin(), children_.end(), child);
-  if (p != children_.end()) {
-    children_.erase(p);
+  const auto& sharedChildren = children_.get();
+  auto index = std::find(sharedChildren.begin(), sharedChildren.end(), child) -
+      sharedChildren.begin();
+  if (static_cast<size_t>(index) != sharedChildren.size()) {
+    auto& children = children_.edit();
+    children.erase(children.begin() + index);
     return true;
   }
   return false;
 }
 
 void Node::removeChild(size_t index) {
-  children_.erase(children_.begin() + static_cast<ptrdiff_t>(index));
+  auto& children = children_.edit();
+  children.erase(children.begin() + static_cast<ptrdiff_t>(index));
 }
 
 void Node::setLayoutDirection(Direction direction) {
@@ -199,14 +223,14 @@ float Node::relativePosition(
     FlexDirection axis,
     Direction direction,
     float axisSize) const {
-  if (style_.positionType() == PositionType::Static) {
+  if (style().positionType() == PositionType::Static) {
     return 0;
   }
-  if (style_.isInlineStartPositionDefined(axis, direction)) {
-    return style_.computeInlineStartPosition(axis, direction, axisSize);
+  if (style().isInlineStartPositionDefined(axis, direction)) {
+    return style().computeInlineStartPosition(axis, direction, axisSize);
   }
 
-  return -1 * style_.computeInlineEndPosition(axis, direction, axisSize);
+  return -1 * style().computeInlineEndPosition(axis, direction, axisSize);
 }
 
 void Node::setPosition(
@@ -219,7 +243,7 @@ void Node::setPosition(
   const Direction directionRespectingRoot =
       owner_ != nullptr ? direction : Direction::LTR;
   const FlexDirection mainAxis =
-      yoga::resolveDirection(style_.flexDirection(), directionRespectingRoot);
+      yoga::resolveDirection(style().flexDirection(), directionRespectingRoot);
   const FlexDirection crossAxis =
       yoga::resolveCrossDirection(mainAxis, directionRespectingRoot);
 
@@ -236,29 +260,29 @@ void Node::setPosition(
   const auto crossAxisTrailingEdge = inlineEndEdge(crossAxis, direction);
 
   setLayoutPosition(
-      (style_.computeInlineStartMargin(mainAxis, direction, ownerWidth) +
+      (style().computeInlineStartMargin(mainAxis, direction, ownerWidth) +
        relativePositionMain),
       mainAxisLeadingEdge);
   setLayoutPosition(
-      (style_.computeInlineEndMargin(mainAxis, direction, ownerWidth) +
+      (style().computeInlineEndMargin(mainAxis, direction, ownerWidth) +
        relativePositionMain),
       mainAxisTrailingEdge);
   setLayoutPosition(
-      (style_.computeInlineStartMargin(crossAxis, direction, ownerWidth) +
+      (style().computeInlineStartMargin(crossAxis, direction, ownerWidth) +
        relativePositionCross),
       crossAxisLeadingEdge);
   setLayoutPosition(
-      (style_.computeInlineEndMargin(crossAxis, direction, ownerWidth) +
+      (style().computeInlineEndMargin(crossAxis, direction, ownerWidth) +
        relativePositionCross),
       crossAxisTrailingEdge);
 }
 
 Style::Length Node::resolveFlexBasisPtr() const {
-  Style::Length flexBasis = style_.flexBasis();
+  Style::Length flexBasis = style().flexBasis();
   if (flexBasis.unit() != Unit::Auto && flexBasis.unit() != Unit::Undefined) {
     return flexBasis;
   }
-  if (style_.flex().isDefined() && style_.flex().unwrap() > 0.0f) {
+  if (style().flex().isDefined() && style().flex().unwrap() > 0.0f) {
     return config_->useWebDefaults() ? value::ofAuto() : value::points(0);
   }
   return value::ofAuto();
@@ -266,50 +290,61 @@ Style::Length Node::resolveFlexBasisPtr() const {
 
 void Node::resolveDimension() {
   for (auto dim : {Dimension::Width, Dimension::Height}) {
-    if (style_.maxDimension(dim).isDefined() &&
+    if (style().maxDimension(dim).isDefined() &&
         yoga::inexactEquals(
-            style_.maxDimension(dim), style_.minDimension(dim))) {
-      resolvedDimensions_[yoga::to_underlying(dim)] = style_.maxDimension(dim);
+            style().maxDimension(dim), style().minDimension(dim))) {
+      resolvedDimensions_[yoga::to_underlying(dim)] = style().maxDimension(dim);
     } else {
-      resolvedDimensions_[yoga::to_underlying(dim)] = style_.dimension(dim);
+      resolvedDimensions_[yoga::to_underlying(dim)] = style().dimension(dim);
     }
   }
 }
 
 Direction Node::resolveDirection(const Direction ownerDirection) {
-  if (style_.direction() == Direction::Inherit) {
+  if (style().direction() == Direction::Inherit) {
     return ownerDirection != Direction::Inherit ? ownerDirection
                                                 : Direction::LTR;
   } else {
-    return style_.direction();
+    return style().direction();
   }
 }
 
 void Node::clearChildren() {
   children_.clear();
-  children_.shrink_to_fit();
 }
 
 // Other Methods
 
 void Node::cloneChildrenIfNeeded() {
-  size_t i = 0;
-  for (Node*& child : children_) {
-    if (child->getOwner() != this) {
-      child = resolveRef(config_->cloneNode(child, this, i));
-      child->setOwner(this);
+  // The list of children is only copied once a child has to be cloned.
+  const auto& sharedChildren = children_.get();
+  for (size_t i = 0; i < sharedChildren.size(); i++) {
+    if (sharedChildren[i]->getOwner() == this) {
+      continue;
     }
-    i += 1;
+
+    auto& children = children_.edit();
+    for (; i < children.size(); i++) {
+      auto& child = children[i];
+      if (child->getOwner() != this) {
+        child = resolveRef(config_->cloneNode(child, this, i));
+        child->setOwner(this);
+      }
+    }
+    return;
   }
 }
 
-void Node::markDirtyAndPropagate() {
+void Node::markDirtyAndPropagate(DirtyReason reason) {
   if (!isDirty_) {
     setDirty(true);
+    dirtyReason_ = reason;
     setLayoutComputedFlexBasis(FloatOptional());
     if (owner_) {
-      owner_->markDirtyAndPropagate();
+      owner_->markDirtyAndPropagate(DirtyReason::Descendants);
     }
+  } else if (reason < dirtyReason_) {
+    dirtyReason_ = reason;
   }
 }
 
@@ -318,11 +353,11 @@ float Node::resolveFlexGrow() const {
   if (owner_ == nullptr) {
     return 0.0;
   }
-  if (style_.flexGrow().isDefined()) {
-    return style_.flexGrow().unwrap();
+  if (style().flexGrow().isDefined()) {
+    return style().flexGrow().unwrap();
   }
-  if (style_.flex().isDefined() && style_.flex().unwrap() > 0.0f) {
-    return style_.flex().unwrap();
+  if (style().flex().isDefined() && style().flex().unwrap() > 0.0f) {
+    return style().flex().unwrap();
   }
   return Style::DefaultFlexGrow;
 }
@@ -331,12 +366,12 @@ float Node::resolveFlexShrink() const {
   if (owner_ == nullptr) {
     return 0.0;
   }
-  if (style_.flexShrink().isDefined()) {
-    return style_.flexShrink().unwrap();
+  if (style().flexShrink().isDefined()) {
+    return style().flexShrink().unwrap();
   }
-  if (!config_->useWebDefaults() && style_.flex().isDefined() &&
-      style_.flex().unwrap() < 0.0f) {
-    return -style_.flex().unwrap();
+  if (!config_->useWebDefaults() && style().flex().isDefined() &&
+      style().flex().unwrap() < 0.0f) {
+    return -style().flex().unwrap();
   }
   return config_->useWebDefaults() ? Style::WebDefaultFlexShrink
                                    : Style::DefaultFlexShrink;
@@ -344,14 +379,14 @@ float Node::resolveFlexShrink() const {
 
 bool Node::isNodeFlexible() {
   return (
-      (style_.positionType() != PositionType::Absolute) &&
+      (style().positionType() != PositionType::Absolute) &&
       (resolveFlexGrow() != 0 || resolveFlexShrink() != 0));
 }
 
 void Node::reset() {
   yoga::assertFatalWithNode(
       this,
-      children_.size() == 0,
+      children_.get().empty(),
       "Cannot reset a node which still has children attached");
   yoga::assertFatalWithNode(
       this, owner_ == nullptr, "Cannot reset a node still attached to a owner");
@@ -9,6 +9,7 @@
 
 #include <stdio.h>
 #include <cstdint>
+#include <optional>
 #include <vector>
 
 #include <yoga/Yoga.h>
@@ -22,6 +23,8 @@
 #include <yoga/enums/NodeType.h>
 #include <yoga/enums/PhysicalEdge.h>
 #include <yoga/node/LayoutResults.h>
+#include <yoga/node/SharedChildren.h>
+#include <yoga/style/SharedStyle.h>
 #include <yoga/style/Style.h>
 
 // Tag struct used to form the opaque YGNodeRef for the public C API
@@ -31,6 +34,28 @@ namespace facebook::yoga {
 
 class YG_EXPORT Node : public ::YGNode {
  public:
+  // A measurement done by the batch measure function of the owner, which
+  // stands in for the next call of the measure function if it is under the
+  // same constraints.
+  struct BatchedMeasurement {
+    float width;
+    MeasureMode widthMode;
+    float height;
+    MeasureMode heightMode;
+    YGSize size;
+  };
+
+  // Why a dirty node needs to be laid out again, from the broadest change to
+  // the narrowest one.
+  enum class DirtyReason : uint8_t {
+    // The style, children or config of the node may have changed.
+    Self,
+    // Only the content measured by the measure function of the node changed.
+    Content,
+    // Only descendants of the node changed.
+    Descendants,
+  };
+
   Node();
   explicit Node(const Config* config);
 
@@ -57,6 +82,10 @@ class YG_EXPORT Node : public ::YGNode {
     return hasNewLayout_;
   }
 
+  DirtyReason getDirtyReason() const {
+    return dirtyReason_;
+  }
+
   NodeType getNodeType() const {
     return nodeType_;
   }
@@ -67,13 +96,25 @@ class YG_EXPORT Node : public ::YGNode {
 
   YGSize measure(float, MeasureMode, float, MeasureMode);
 
+  YGBatchMeasureFunc getBatchMeasureFunc() const {
+    return batchMeasureFunc_;
+  }
+
+  // Returns and clears the batched measurement if it was done under the given
+  // constraints.
+  std::optional<YGSize>
+  takeBatchedMeasurement(float, MeasureMode, float, MeasureMode);
+
   bool hasBaselineFunc() const noexcept {
     return baselineFunc_ != nullptr;
   }
 
   float baseline(float width, float height) const;
 
-  float dimensionWithMargin(const FlexDirection axis, const float widthSize);
+  float dimensionWithMargin(const FlexDirection axis, const float widthSize) {
+    return getLayout().measuredDimension(dimension(axis)) +
+        style().computeMarginForAxis(axis, widthSize);
+  }
 
   bool isLayoutDimensionDefined(const FlexDirection axis);
 
@@ -95,12 +136,15 @@ class YG_EXPORT Node : public ::YGNode {
   }
 
   // For Performance reasons passing as reference.
-  Style& style() {
-    return style_;
+  const Style& style() const {
+    return style_.get();
   }
 
-  const Style& style() const {
-    return style_;
+  // Styles may be shared between nodes, so the style is copied before it is
+  // first mutated unless the node already owns it exclusively. Prefer
+  // setStyle(), which lets identical styles be shared.
+  Style& mutableStyle() {
+    return style_.edit();
   }
 
   // For Performance reasons passing as reference.
@@ -129,15 +173,15 @@ class YG_EXPORT Node : public ::YGNode {
   }
 
   const std::vector<Node*>& getChildren() const {
-    return children_;
+    return children_.get();
   }
 
   Node* getChild(size_t index) const {
-    return children_.at(index);
+    return children_.get().at(index);
   }
 
   size_t getChildCount() const {
-    return children_.size();
+    return children_.get().size();
   }
 
   const Config* getConfig() const {
@@ -176,6 +220,15 @@ class YG_EXPORT Node : public ::YGNode {
 
   void setMeasureFunc(YGMeasureFunc measureFunc);
 
+  void setBatchMeasureFunc(YGBatchMeasureFunc batchMeasureFunc) {
+    batchMeasureFunc_ = batchMeasureFunc;
+  }
+
+  void setBatchedMeasurement(
+      std::optional<BatchedMeasurement> batchedMeasurement) {
+    batchedMeasurement_ = batchedMeasurement;
+  }
+
   void setBaselineFunc(YGBaselineFunc baseLineFunc) {
     baselineFunc_ = baseLineFunc;
   }
@@ -185,7 +238,7 @@ class YG_EXPORT Node : public ::YGNode {
   }
 
   void setStyle(const Style& style) {
-    style_ = style;
+    style_.set(style);
   }
 
   void setLayout(const LayoutResults& layout) {
@@ -205,7 +258,7 @@ class YG_EXPORT Node : public ::YGNode {
   }
 
   void setChildren(const std::vector<Node*>& children) {
-    children_ = children;
+    children_.set(children);
   }
 
   // TODO: rvalue override for setChildren
@@ -245,7 +298,7 @@ class YG_EXPORT Node : public ::YGNode {
   void removeChild(size_t index);
 
   void cloneChildrenIfNeeded();
-  void markDirtyAndPropagate();
+  void markDirtyAndPropagate(DirtyReason reason = DirtyReason::Self);
   float resolveFlexGrow() const;
   float resolveFlexShrink() const;
   bool isNodeFlexible();
@@ -261,24 +314,29 @@ class YG_EXPORT Node : public ::YGNode {
       const float axisSize) const;
 
   void useWebDefaults() {
-    style_.setFlexDirection(FlexDirection::Row);
-    style_.setAlignContent(Align::Stretch);
+    auto style = style_.get();
+    style.setFlexDirection(FlexDirection::Row);
+    style.setAlignContent(Align::Stretch);
+    style_.set(style);
   }
 
   bool hasNewLayout_ : 1 = true;
   bool isReferenceBaseline_ : 1 = false;
   bool isDirty_ : 1 = false;
   bool alwaysFormsContainingBlock_ : 1 = false;
+  DirtyReason dirtyReason_ : 2 = DirtyReason::Self;
   NodeType nodeType_ : bitCount<NodeType>() = NodeType::Default;
   void* context_ = nullptr;
   YGMeasureFunc measureFunc_ = nullptr;
   YGBaselineFunc baselineFunc_ = nullptr;
   YGDirtiedFunc dirtiedFunc_ = nullptr;
-  Style style_;
+  YGBatchMeasureFunc batchMeasureFunc_ = nullptr;
+  std::optional<BatchedMeasurement> batchedMeasurement_;
+  SharedStyle style_;
   LayoutResults layout_;
   size_t lineIndex_ = 0;
   Node* owner_ = nullptr;
-  std::vector<Node*> children_;
+  SharedChildren children_;
   const Config* config_;
   std::array<Style::Length, 2> resolvedDimensions_{
       {value::undefined(), value::undefined()}};
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <yoga/node/SharedChildren.h>
+
+namespace facebook::yoga {
+
+namespace {
+
+// The empty list is never freed, so nodes without children point at it
+// without owning it, and copying them does not touch a reference count.
+std::shared_ptr<std::vector<Node*>> emptyChildren() {
+  static const std::vector<Node*> children{};
+  return std::shared_ptr<std::vector<Node*>>{
+      std::shared_ptr<std::vector<Node*>>{},
+      const_cast<std::vector<Node*>*>(&children)};
+}
+
+} // namespace
+
+SharedChildren::SharedChildren() : children_{emptyChildren()} {}
+
+void SharedChildren::set(const std::vector<Node*>& children) {
+  if (children.empty()) {
+    clear();
+  } else if (children_.use_count() == 1) {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    *children_ = children;
+  } else {
+    children_ = std::make_shared<std::vector<Node*>>(children);
+  }
+}
+
+void SharedChildren::clear() {
+  children_ = emptyChildren();
+}
+
+void SharedChildren::detach() {
+  children_ = std::make_shared<std::vector<Node*>>(*children_);
+}
+
+} // namespace facebook::yoga
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <yoga/Yoga.h>
+
+namespace facebook::yoga {
+
+class Node;
+
+// Copy-on-write storage for the children of a node. Copies of a node (e.g.
+// made by YGNodeClone, or by React Native when it clones a shadow node) share
+// the list of children of the original, so cloning a node with many children
+// doesn't copy the list until either node changes it:
+//
+// - Nodes without children point at a single empty list.
+// - Copies of a node share its list.
+// - edit() gives exclusive, mutable access to the list, copying it first if
+//   it is shared.
+//
+// Lists are immutable while shared, so they may be shared by nodes across
+// threads.
+class YG_EXPORT SharedChildren {
+ public:
+  SharedChildren();
+
+  // Moving a list shares it as well, so the node moved from keeps a valid
+  // (if no longer exclusive) list.
+  SharedChildren(const SharedChildren&) = default;
+  SharedChildren& operator=(const SharedChildren&) = default;
+
+  const std::vector<Node*>& get() const {
+    return *children_;
+  }
+
+  std::vector<Node*>& edit() {
+    if (children_.use_count() != 1) {
+      detach();
+    } else {
+      // Other owners of the list may have let go of it on other threads.
+      std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    return *children_;
+  }
+
+  void set(const std::vector<Node*>& children);
+
+  void clear();
+
+ private:
+  void detach();
+
+  std::shared_ptr<std::vector<Node*>> children_;
+};
+
+} // namespace facebook::yoga
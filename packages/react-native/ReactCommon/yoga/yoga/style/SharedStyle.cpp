@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+#include <unordered_map>
+
+#include <yoga/style/SharedStyle.h>
+#include <yoga/style/StyleStorageStats.h>
+
+namespace facebook::yoga {
+
+namespace {
+
+// The default style is never freed, so nodes point at it without owning it,
+// and copying them does not touch a reference count.
+std::shared_ptr<Style> defaultStyle() {
+  static const Style style{};
+  return std::shared_ptr<Style>{
+      std::shared_ptr<Style>{}, const_cast<Style*>(&style)};
+}
+
+// Interned styles by hash. Entries do not keep their styles alive, and are
+// swept once expired entries may have accumulated, i.e. whenever the table
+// doubles in size since the last sweep.
+class InternTable {
+ public:
+  std::shared_ptr<Style> intern(const Style& style) {
+    const auto hash = style.hash();
+    const auto [begin, end] = entries_.equal_range(hash);
+    for (auto it = begin; it != end; ++it) {
+      auto interned = it->second.lock();
+      if (interned != nullptr && *interned == style) {
+        detail::recordInternHit();
+        return interned;
+      }
+    }
+
+    detail::recordInternMiss();
+    detail::recordInternedStyleCreated();
+    // Allocated apart from its control block, so entries left behind by
+    // styles no longer used only hold on to the control block.
+    auto interned =
+        std::shared_ptr<Style>{new Style(style), [](Style* internedStyle) {
+                                 detail::recordInternedStyleDestroyed();
+                                 delete internedStyle;
+                               }};
+    entries_.emplace(hash, interned);
+
+    if (entries_.size() >= sweepThreshold_) {
+      std::erase_if(
+          entries_, [](const auto& entry) { return entry.second.expired(); });
+      sweepThreshold_ = std::max(MinSweepThreshold, entries_.size() * 2);
+    }
+    return interned;
+  }
+
+ private:
+  static constexpr size_t MinSweepThreshold = 64;
+
+  std::unordered_multimap<size_t, std::weak_ptr<Style>> entries_;
+  size_t sweepThreshold_ = MinSweepThreshold;
+};
+
+} // namespace
+
+SharedStyle::SharedStyle() : style_{defaultStyle()} {}
+
+void SharedStyle::set(const Style& style) {
+  if (style == *style_) {
+    return;
+  }
+
+  thread_local InternTable internTable;
+  style_ = internTable.intern(style);
+  isExclusive_ = false;
+}
+
+void SharedStyle::detach() {
+  style_ = std::make_shared<Style>(*style_);
+  isExclusive_ = true;
+}
+
+} // namespace facebook::yoga
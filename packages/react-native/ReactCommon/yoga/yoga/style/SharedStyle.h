@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include <yoga/style/Style.h>
+
+namespace facebook::yoga {
+
+// Copy-on-write storage for the style of a node. Most nodes have the default
+// style or one identical to many others (e.g. the cells of a list), so styles
+// are shared rather than owned by every node:
+//
+// - Nodes start out pointing at a single default style.
+// - Styles given to set() are interned, so nodes set to identical styles
+//   share one copy. Copies of a node share its style.
+// - edit() gives exclusive, mutable access to the style, copying it first if
+//   it is shared. Styles built through edit() are not interned.
+//
+// Interned styles are looked up in a table of the calling thread; styles are
+// immutable while shared, so they may be shared by nodes across threads.
+class YG_EXPORT SharedStyle {
+ public:
+  SharedStyle();
+
+  const Style& get() const {
+    return *style_;
+  }
+
+  Style& edit() {
+    if (!isExclusive_ || style_.use_count() != 1) {
+      detach();
+    } else {
+      // Other owners of the style may have let go of it on other threads.
+      std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    return *style_;
+  }
+
+  void set(const Style& style);
+
+ private:
+  void detach();
+
+  std::shared_ptr<Style> style_;
+  bool isExclusive_ = false;
+};
+
+} // namespace facebook::yoga
@@ -14,6 +14,8 @@
 #include <memory>
 #include <vector>
 
+#include <yoga/style/StyleStorageStats.h>
+
 namespace facebook::yoga {
 
 // Container which allows storing 32 or 64 bit integer values, whose index may
@@ -43,6 +45,7 @@ class SmallValueBuffer {
 
     overflow_->buffer_.push_back(value);
     overflow_->wideElements_.push_back(false);
+    detail::recordOverflowChunksAdded(1);
     return index;
   }
 
@@ -120,6 +123,18 @@ class SmallValueBuffer {
 
  private:
   struct Overflow {
+    Overflow() {
+      detail::recordOverflowBufferCreated(0);
+    }
+    Overflow(const Overflow& other)
+        : buffer_(other.buffer_), wideElements_(other.wideElements_) {
+      detail::recordOverflowBufferCreated(buffer_.size());
+    }
+    Overflow& operator=(const Overflow&) = delete;
+    ~Overflow() {
+      detail::recordOverflowBufferDestroyed(buffer_.size());
+    }
+
     std::vector<uint32_t> buffer_;
     std::vector<bool> wideElements_;
   };
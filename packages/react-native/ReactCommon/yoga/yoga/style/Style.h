@@ -8,6 +8,8 @@
 #pragma once
 
 #include <array>
+#include <bit>
+#include <cstddef>
 #include <cstdint>
 #include <type_traits>
 
@@ -472,6 +474,35 @@ class YG_EXPORT Style {
     return !(*this == other);
   }
 
+  // Hash of the style, consistent with operator==.
+  size_t hash() const {
+    size_t seed = 0;
+    hashCombine(seed, yoga::to_underlying(direction_));
+    hashCombine(seed, yoga::to_underlying(flexDirection_));
+    hashCombine(seed, yoga::to_underlying(justifyContent_));
+    hashCombine(seed, yoga::to_underlying(alignContent_));
+    hashCombine(seed, yoga::to_underlying(alignItems_));
+    hashCombine(seed, yoga::to_underlying(alignSelf_));
+    hashCombine(seed, yoga::to_underlying(positionType_));
+    hashCombine(seed, yoga::to_underlying(flexWrap_));
+    hashCombine(seed, yoga::to_underlying(overflow_));
+    hashCombine(seed, yoga::to_underlying(display_));
+    hashNumber(seed, flex_);
+    hashNumber(seed, flexGrow_);
+    hashNumber(seed, flexShrink_);
+    hashLength(seed, flexBasis_);
+    hashLengths(seed, margin_);
+    hashLengths(seed, position_);
+    hashLengths(seed, padding_);
+    hashLengths(seed, border_);
+    hashLengths(seed, gap_);
+    hashLengths(seed, dimensions_);
+    hashLengths(seed, minDimensions_);
+    hashLengths(seed, maxDimensions_);
+    hashNumber(seed, aspectRatio_);
+    return seed;
+  }
+
  private:
   using Dimensions = std::array<StyleValueHandle, ordinalCount<Dimension>()>;
   using Edges = std::array<StyleValueHandle, ordinalCount<Edge>()>;
@@ -511,6 +542,37 @@ class YG_EXPORT Style {
         });
   }
 
+  static inline void hashCombine(size_t& seed, size_t value) {
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+  }
+
+  // Adding zero folds -0 into 0, which compare equal.
+  static inline size_t hashFloat(float value) {
+    return std::bit_cast<uint32_t>(value + 0.0f);
+  }
+
+  inline void hashNumber(size_t& seed, StyleValueHandle handle) const {
+    const auto number = pool_.getNumber(handle);
+    hashCombine(seed, number.isUndefined() ? 0 : hashFloat(number.unwrap()));
+  }
+
+  inline void hashLength(size_t& seed, StyleValueHandle handle) const {
+    const auto length = pool_.getLength(handle);
+    hashCombine(seed, yoga::to_underlying(length.unit()));
+    if (length.value().isDefined()) {
+      hashCombine(seed, hashFloat(length.value().unwrap()));
+    }
+  }
+
+  template <size_t N>
+  inline void hashLengths(
+      size_t& seed,
+      const std::array<StyleValueHandle, N>& handles) const {
+    for (const auto handle : handles) {
+      hashLength(seed, handle);
+    }
+  }
+
   Style::Length computeColumnGap() const {
     if (gap_[yoga::to_underlying(Gutter::Column)].isDefined()) {
       return pool_.getLength(gap_[yoga::to_underlying(Gutter::Column)]);
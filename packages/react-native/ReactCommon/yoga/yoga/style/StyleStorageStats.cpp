@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <atomic>
+
+#include <yoga/style/StyleStorageStats.h>
+
+namespace facebook::yoga {
+
+namespace {
+
+// Counters are only updated when styles are interned or pools overflow, never
+// while laying out, so relaxed atomics shared by all threads are cheap enough.
+std::atomic<size_t> internedStyles{0};
+std::atomic<size_t> internHits{0};
+std::atomic<size_t> internMisses{0};
+std::atomic<size_t> overflowBuffers{0};
+std::atomic<size_t> overflowChunks{0};
+
+} // namespace
+
+StyleStorageStats getStyleStorageStats() {
+  return {
+      internedStyles.load(std::memory_order_relaxed),
+      internHits.load(std::memory_order_relaxed),
+      internMisses.load(std::memory_order_relaxed),
+      overflowBuffers.load(std::memory_order_relaxed),
+      overflowChunks.load(std::memory_order_relaxed),
+  };
+}
+
+namespace detail {
+
+void recordInternedStyleCreated() {
+  internedStyles.fetch_add(1, std::memory_order_relaxed);
+}
+
+void recordInternedStyleDestroyed() {
+  internedStyles.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void recordInternHit() {
+  internHits.fetch_add(1, std::memory_order_relaxed);
+}
+
+void recordInternMiss() {
+  internMisses.fetch_add(1, std::memory_order_relaxed);
+}
+
+void recordOverflowBufferCreated(size_t chunks) {
+  overflowBuffers.fetch_add(1, std::memory_order_relaxed);
+  overflowChunks.fetch_add(chunks, std::memory_order_relaxed);
+}
+
+void recordOverflowBufferDestroyed(size_t chunks) {
+  overflowBuffers.fetch_sub(1, std::memory_order_relaxed);
+  overflowChunks.fetch_sub(chunks, std::memory_order_relaxed);
+}
+
+void recordOverflowChunksAdded(size_t chunks) {
+  overflowChunks.fetch_add(chunks, std::memory_order_relaxed);
+}
+
+} // namespace detail
+
+} // namespace facebook::yoga
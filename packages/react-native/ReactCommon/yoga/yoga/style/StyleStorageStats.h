@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <yoga/YGMacros.h>
+
+namespace facebook::yoga {
+
+// Process-wide counters describing how node styles are stored, to tell how
+// much memory styles use and how much sharing them saves.
+struct StyleStorageStats {
+  // Distinct styles currently interned and shared by the nodes using them.
+  size_t internedStyles;
+  // Number of times a style was set and an identical interned style was
+  // reused, or had to be interned.
+  size_t internHits;
+  size_t internMisses;
+  // Style value pools currently spilling values onto the heap, and the
+  // number of 32-bit chunks they hold there.
+  size_t overflowBuffers;
+  size_t overflowChunks;
+};
+
+YG_EXPORT StyleStorageStats getStyleStorageStats();
+
+namespace detail {
+
+void recordInternedStyleCreated();
+void recordInternedStyleDestroyed();
+void recordInternHit();
+void recordInternMiss();
+void recordOverflowBufferCreated(size_t chunks);
+void recordOverflowBufferDestroyed(size_t chunks);
+void recordOverflowChunksAdded(size_t chunks);
+
+} // namespace detail
+
+} // namespace facebook::yoga
@@ -16,6 +16,7 @@ import ReactNativeFeatureFlagsAccessorCPP from './templates/common-cxx/ReactNati
 import ReactNativeFeatureFlagsAccessorH from './templates/common-cxx/ReactNativeFeatureFlagsAccessor.h-template';
 import ReactNativeFeatureFlagsDefaultsH from './templates/common-cxx/ReactNativeFeatureFlagsDefaults.h-template';
 import ReactNativeFeatureFlagsProviderH from './templates/common-cxx/ReactNativeFeatureFlagsProvider.h-template';
+import ReactNativeFeatureFlagsSnapshotH from './templates/common-cxx/ReactNativeFeatureFlagsSnapshot.h-template';
 import path from 'path';
 
 export default function generateCommonCxxModules(
@@ -36,5 +37,7 @@ export default function generateCommonCxxModules(
       ReactNativeFeatureFlagsDefaultsH(featureFlagDefinitions),
     [path.join(commonCxxPath, 'ReactNativeFeatureFlagsProvider.h')]:
       ReactNativeFeatureFlagsProviderH(featureFlagDefinitions),
+    [path.join(commonCxxPath, 'ReactNativeFeatureFlagsSnapshot.h')]:
+      ReactNativeFeatureFlagsSnapshotH(featureFlagDefinitions),
   };
 }
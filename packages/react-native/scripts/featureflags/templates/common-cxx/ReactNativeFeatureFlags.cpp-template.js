@@ -40,6 +40,10 @@ ${Object.entries(definitions.common)
   )
   .join('\n\n')}
 
+const ReactNativeFeatureFlagsSnapshot& ReactNativeFeatureFlags::getSnapshot() {
+  return getAccessor().getSnapshot();
+}
+
 void ReactNativeFeatureFlags::override(
     std::unique_ptr<ReactNativeFeatureFlagsProvider> provider) {
   getAccessor().override(std::move(provider));
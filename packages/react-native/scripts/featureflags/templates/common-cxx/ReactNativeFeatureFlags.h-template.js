@@ -29,6 +29,7 @@ ${DO_NOT_MODIFY_COMMENT}
 
 #include <react/featureflags/ReactNativeFeatureFlagsAccessor.h>
 #include <react/featureflags/ReactNativeFeatureFlagsProvider.h>
+#include <react/featureflags/ReactNativeFeatureFlagsSnapshot.h>
 #include <memory>
 
 namespace facebook::react {
@@ -51,6 +52,16 @@ ${Object.entries(definitions.common)
   )
   .join('\n\n')}
 
+  /**
+   * Returns the values of all the feature flags. They are read from the
+   * provider the first time this is called (which prevents overriding them
+   * afterwards), so reading a flag from the snapshot is a plain load.
+   *
+   * Hot paths should keep the returned reference instead of calling the
+   * methods above. It stays valid until \`dangerouslyReset\` is called.
+   */
+  static const ReactNativeFeatureFlagsSnapshot& getSnapshot();
+
   /**
    * Overrides the feature flags with the ones provided by the given provider
    * (generally one that extends \`ReactNativeFeatureFlagsDefaults\`).
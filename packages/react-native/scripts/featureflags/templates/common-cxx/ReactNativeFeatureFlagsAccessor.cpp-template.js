@@ -62,6 +62,18 @@ ${Object.entries(definitions.common)
   )
   .join('\n\n')}
 
+const ReactNativeFeatureFlagsSnapshot&
+ReactNativeFeatureFlagsAccessor::getSnapshot() {
+  std::call_once(snapshotOnceFlag_, [this]() {
+    snapshot_ = ReactNativeFeatureFlagsSnapshot{
+${Object.keys(definitions.common)
+  .map(flagName => `        .${flagName} = ${flagName}(),`)
+  .join('\n')}
+    };
+  });
+  return snapshot_.value();
+}
+
 void ReactNativeFeatureFlagsAccessor::override(
     std::unique_ptr<ReactNativeFeatureFlagsProvider> provider) {
   if (wasOverridden_) {
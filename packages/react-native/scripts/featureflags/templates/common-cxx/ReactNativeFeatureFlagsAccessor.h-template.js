@@ -28,9 +28,11 @@ ${DO_NOT_MODIFY_COMMENT}
 #pragma once
 
 #include <react/featureflags/ReactNativeFeatureFlagsProvider.h>
+#include <react/featureflags/ReactNativeFeatureFlagsSnapshot.h>
 #include <array>
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <optional>
 
 namespace facebook::react {
@@ -46,6 +48,8 @@ ${Object.entries(definitions.common)
   )
   .join('\n')}
 
+  const ReactNativeFeatureFlagsSnapshot& getSnapshot();
+
   void override(std::unique_ptr<ReactNativeFeatureFlagsProvider> provider);
 
  private:
@@ -67,6 +71,9 @@ ${Object.entries(definitions.common)
       )}>> ${flagName}_;`,
   )
   .join('\n')}
+
+  std::once_flag snapshotOnceFlag_;
+  std::optional<ReactNativeFeatureFlagsSnapshot> snapshot_;
 };
 
 } // namespace facebook::react
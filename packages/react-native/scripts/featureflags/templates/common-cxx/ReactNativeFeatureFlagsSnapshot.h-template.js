@@ -0,0 +1,47 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * @flow strict
+ * @format
+ */
+
+import type {FeatureFlagDefinitions} from '../../types';
+
+import {DO_NOT_MODIFY_COMMENT, getCxxTypeFromDefaultValue} from '../../utils';
+import signedsource from 'signedsource';
+
+export default function (definitions: FeatureFlagDefinitions): string {
+  return signedsource.signFile(`/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * ${signedsource.getSigningToken()}
+ */
+
+${DO_NOT_MODIFY_COMMENT}
+
+#pragma once
+
+namespace facebook::react {
+
+/**
+ * The values of all the feature flags, as returned by
+ * \`ReactNativeFeatureFlags::getSnapshot\`.
+ */
+struct ReactNativeFeatureFlagsSnapshot {
+${Object.entries(definitions.common)
+  .map(
+    ([flagName, flagConfig]) =>
+      `  ${getCxxTypeFromDefaultValue(flagConfig.defaultValue)} ${flagName};`,
+  )
+  .join('\n')}
+};
+
+} // namespace facebook::react
+`);
+}
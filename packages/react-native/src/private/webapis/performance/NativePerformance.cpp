@@ -9,6 +9,7 @@
 
 #include <cxxreact/ReactMarker.h>
 #include <jsi/instrumentation.h>
+#include <reactperflogger/SamplingNativeModulePerfLogger.h>
 #include "NativePerformance.h"
 #include "PerformanceEntryReporter.h"
 
@@ -92,4 +93,29 @@ NativePerformance::getReactNativeStartupTiming(jsi::Runtime& rt) {
   return result;
 }
 
+std::vector<NativeModuleMethodCalls> NativePerformance::getNativeModuleCalls(
+    jsi::Runtime& /*rt*/) {
+  auto toMilliseconds = [](int64_t nanoseconds) {
+    return static_cast<double>(nanoseconds) / 1e6;
+  };
+
+  auto result = std::vector<NativeModuleMethodCalls>{};
+  for (const auto& stats :
+       NativeModuleCallStats::getInstance().getMethodCallStats()) {
+    result.push_back(
+        {stats.moduleName,
+         stats.methodName,
+         static_cast<double>(stats.numberOfSyncCalls),
+         static_cast<double>(stats.numberOfAsyncCalls),
+         static_cast<double>(stats.numberOfFailedCalls),
+         static_cast<double>(stats.numberOfSampledCalls),
+         static_cast<double>(stats.numberOfSampledExecutions),
+         toMilliseconds(stats.jsThreadTime),
+         toMilliseconds(stats.argConversionTime),
+         toMilliseconds(stats.executionTime),
+         toMilliseconds(stats.queueWaitTime)});
+  }
+  return result;
+}
+
 } // namespace facebook::react
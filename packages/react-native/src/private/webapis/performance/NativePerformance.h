@@ -10,6 +10,7 @@
 #include <FBReactNativeSpec/FBReactNativeSpecJSI.h>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "NativePerformanceObserver.h"
 
@@ -18,6 +19,24 @@ class PerformanceEntryReporter;
 
 #pragma mark - Structs
 
+using NativeModuleMethodCalls = NativePerformanceCxxNativeModuleMethodCalls<
+    std::string,
+    std::string,
+    double,
+    double,
+    double,
+    double,
+    double,
+    double,
+    double,
+    double,
+    double>;
+
+template <>
+struct Bridging<NativeModuleMethodCalls>
+    : NativePerformanceCxxNativeModuleMethodCallsBridging<
+          NativeModuleMethodCalls> {};
+
 #pragma mark - implementation
 
 class NativePerformance : public NativePerformanceCxxSpec<NativePerformance>,
@@ -54,6 +73,10 @@ class NativePerformance : public NativePerformanceCxxSpec<NativePerformance>,
   std::unordered_map<std::string, double> getReactNativeStartupTiming(
       jsi::Runtime& rt);
 
+  // Returns the calls of native modules aggregated by
+  // `SamplingNativeModulePerfLogger`, if it is enabled.
+  std::vector<NativeModuleMethodCalls> getNativeModuleCalls(jsi::Runtime& rt);
+
  private:
 };
 
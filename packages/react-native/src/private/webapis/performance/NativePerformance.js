@@ -16,6 +16,22 @@ export type NativeMemoryInfo = {[key: string]: ?number};
 
 export type ReactNativeStartupTiming = {[key: string]: ?number};
 
+// Calls of a method of a native module, see `SamplingNativeModulePerfLogger`.
+// Times are in milliseconds and only include the sampled calls.
+export type NativeModuleMethodCalls = {|
+  moduleName: string,
+  methodName: string,
+  numberOfSyncCalls: number,
+  numberOfAsyncCalls: number,
+  numberOfFailedCalls: number,
+  numberOfSampledCalls: number,
+  numberOfSampledExecutions: number,
+  jsThreadTime: number,
+  argConversionTime: number,
+  executionTime: number,
+  queueWaitTime: number,
+|};
+
 export interface Spec extends TurboModule {
   +mark: (name: string, startTime: number) => void;
   +measure: (
@@ -28,6 +44,7 @@ export interface Spec extends TurboModule {
   ) => void;
   +getSimpleMemoryInfo: () => NativeMemoryInfo;
   +getReactNativeStartupTiming: () => ReactNativeStartupTiming;
+  +getNativeModuleCalls?: () => $ReadOnlyArray<NativeModuleMethodCalls>;
 }
 
 export default (TurboModuleRegistry.get<Spec>('NativePerformanceCxx'): ?Spec);
@@ -150,6 +150,10 @@ class PerformanceEntryReporter : public EventLogger, public UIManagerMountHook {
       const RootShadowNode::Shared& rootShadowNode,
       double mountTime) noexcept override;
 
+  const char* getName() const noexcept override {
+    return "PerformanceEntryReporter";
+  }
+
   const std::unordered_map<std::string, uint32_t>& getEventCounts() const {
     return eventCounts_;
   }
@@ -10,6 +10,7 @@
 
 import type {
   NativeMemoryInfo,
+  NativeModuleMethodCalls,
   ReactNativeStartupTiming,
   Spec as NativePerformance,
 } from '../NativePerformance';
@@ -62,6 +63,10 @@ const NativePerformanceMock: NativePerformance = {
       initializeRuntimeEnd: 0,
     };
   },
+
+  getNativeModuleCalls: (): $ReadOnlyArray<NativeModuleMethodCalls> => {
+    return [];
+  },
 };
 
 export default NativePerformanceMock;
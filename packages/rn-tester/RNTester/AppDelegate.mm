@@ -18,6 +18,7 @@
 #import <React/RCTPushNotificationManager.h>
 
 #import <NativeCxxModuleExample/NativeCxxModuleExample.h>
+#import "RNTesterStartupBenchmark.h"
 #ifndef RN_DISABLE_OSS_PLUGIN_HEADER
 #import <RNTMyNativeViewComponentView.h>
 #endif
@@ -38,7 +39,11 @@ static NSString *kBundlePath = @"js/RNTesterApp.ios";
 
   [[UNUserNotificationCenter currentNotificationCenter] setDelegate:self];
 
-  return [super application:application didFinishLaunchingWithOptions:launchOptions];
+  BOOL didFinishLaunching = [super application:application didFinishLaunchingWithOptions:launchOptions];
+  if ([RNTesterStartupBenchmark isEnabled]) {
+    [RNTesterStartupBenchmark startWithAppDelegate:self];
+  }
+  return didFinishLaunching;
 }
 
 - (void)applicationDidEnterBackground:(UIApplication *)application
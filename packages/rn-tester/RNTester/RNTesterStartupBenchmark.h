@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#import <Foundation/Foundation.h>
+
+@class RCTAppDelegate;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Records when RNTester reaches the milestones of its startup, for `scripts/startup-benchmark.js`.
+ * Only active when the app is launched with the `-startupBenchmark YES` argument. Once the main thread goes idle after
+ * the first mount, the times of the milestones (in milliseconds since the process started) are written as JSON to
+ * `Documents/startup-benchmark-run.json`.
+ */
+@interface RNTesterStartupBenchmark : NSObject
+
++ (BOOL)isEnabled;
+
+/**
+ * Starts observing the surfaces of `appDelegate`. Must be called once its root view was created.
+ */
++ (void)startWithAppDelegate:(RCTAppDelegate *)appDelegate;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#import "RNTesterStartupBenchmark.h"
+
+#import <QuartzCore/QuartzCore.h>
+#import <sys/sysctl.h>
+#import <sys/time.h>
+#import <unistd.h>
+
+#import <RCTAppDelegate.h>
+#import <React/RCTBridge.h>
+#import <React/RCTSurfacePresenter.h>
+#import <React/RCTSurfacePresenterStub.h>
+#import <ReactCommon/RCTHost.h>
+#import <cxxreact/ReactMarker.h>
+
+using namespace facebook::react;
+
+static NSString *const kEnabledArgument = @"startupBenchmark";
+static NSString *const kResultFileName = @"startup-benchmark-run.json";
+
+// The time the process started, in the unit and clock of `CACurrentMediaTime() * 1000`.
+static double RNTesterProcessStartTime(void)
+{
+  struct kinfo_proc info;
+  size_t size = sizeof(info);
+  int mib[] = {CTL_KERN, KERN_PROC, KERN_PROC_PID, getpid()};
+  if (sysctl(mib, 4, &info, &size, NULL, 0) != 0) {
+    return NAN;
+  }
+
+  struct timeval now;
+  gettimeofday(&now, NULL);
+  double msSinceStart = (now.tv_sec - info.kp_proc.p_starttime.tv_sec) * 1000.0 +
+      (now.tv_usec - info.kp_proc.p_starttime.tv_usec) / 1000.0;
+  return CACurrentMediaTime() * 1000 - msSinceStart;
+}
+
+static double RNTesterFirstMarkerTime(
+    const std::vector<ReactMarker::ReactMarkerEvent> &events,
+    ReactMarker::ReactMarkerId markerId)
+{
+  for (const auto &event : events) {
+    if (event.markerId == markerId) {
+      return event.time;
+    }
+  }
+  return NAN;
+}
+
+@interface RNTesterStartupBenchmark () <RCTSurfacePresenterObserver>
+@end
+
+@implementation RNTesterStartupBenchmark {
+  double _processStartTime;
+  double _firstCommitTime;
+  double _firstMountTime;
+}
+
++ (BOOL)isEnabled
+{
+  return [[NSUserDefaults standardUserDefaults] boolForKey:kEnabledArgument];
+}
+
++ (instancetype)sharedInstance
+{
+  // Surface presenters only keep weak references to their observers.
+  static RNTesterStartupBenchmark *sharedInstance;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    sharedInstance = [RNTesterStartupBenchmark new];
+  });
+  return sharedInstance;
+}
+
++ (void)startWithAppDelegate:(RCTAppDelegate *)appDelegate
+{
+  RNTesterStartupBenchmark *benchmark = [self sharedInstance];
+  benchmark->_processStartTime = RNTesterProcessStartTime();
+  benchmark->_firstCommitTime = NAN;
+  benchmark->_firstMountTime = NAN;
+
+  id<RCTSurfacePresenterStub> surfacePresenter = appDelegate.reactHost
+      ? (id<RCTSurfacePresenterStub>)[appDelegate.reactHost getSurfacePresenter]
+      : appDelegate.bridge.surfacePresenter;
+  [surfacePresenter addObserver:benchmark];
+}
+
+#pragma mark - RCTSurfacePresenterObserver
+
+- (void)willMountComponentsWithRootTag:(NSInteger)rootTag
+{
+  // The first committed tree reaches the main thread.
+  if (isnan(_firstCommitTime)) {
+    _firstCommitTime = CACurrentMediaTime() * 1000;
+  }
+}
+
+- (void)didMountComponentsWithRootTag:(NSInteger)rootTag
+{
+  if (!isnan(_firstMountTime)) {
+    return;
+  }
+  _firstMountTime = CACurrentMediaTime() * 1000;
+
+  // The app is interactive once the main thread has nothing left to do after the first mount.
+  CFRunLoopObserverRef idleObserver = CFRunLoopObserverCreateWithHandler(
+      NULL, kCFRunLoopBeforeWaiting, false, 0, ^(CFRunLoopObserverRef observer, CFRunLoopActivity activity) {
+        [self _writeResultWithTimeToInteractive:CACurrentMediaTime() * 1000];
+      });
+  CFRunLoopAddObserver(CFRunLoopGetMain(), idleObserver, kCFRunLoopCommonModes);
+  CFRelease(idleObserver);
+}
+
+#pragma mark - Private
+
+- (void)_writeResultWithTimeToInteractive:(double)timeToInteractive
+{
+  auto events = ReactMarker::MarkerTimeline::getInstance().getEvents();
+  double processStartTime = _processStartTime;
+  auto sinceProcessStart = ^id(double time) {
+    return isnan(time) || isnan(processStartTime) ? (id)[NSNull null] : @(time - processStartTime);
+  };
+
+  NSDictionary *result = @{
+    @"platform" : @"ios",
+    @"metrics" : @{
+      @"runtimeInitStart" : sinceProcessStart(RNTesterFirstMarkerTime(events, ReactMarker::INIT_REACT_RUNTIME_START)),
+      @"runtimeInitEnd" : sinceProcessStart(RNTesterFirstMarkerTime(events, ReactMarker::INIT_REACT_RUNTIME_STOP)),
+      @"bundleLoadStart" : sinceProcessStart(RNTesterFirstMarkerTime(events, ReactMarker::RUN_JS_BUNDLE_START)),
+      @"bundleLoadEnd" : sinceProcessStart(RNTesterFirstMarkerTime(events, ReactMarker::RUN_JS_BUNDLE_STOP)),
+      @"firstCommit" : sinceProcessStart(_firstCommitTime),
+      @"firstMount" : sinceProcessStart(_firstMountTime),
+      @"tti" : sinceProcessStart(timeToInteractive),
+    },
+  };
+
+  NSURL *documentsDirectory = [[NSFileManager defaultManager] URLsForDirectory:NSDocumentDirectory
+                                                                     inDomains:NSUserDomainMask]
+                                  .firstObject;
+  NSData *data = [NSJSONSerialization dataWithJSONObject:result options:0 error:nil];
+  // Written atomically, so the benchmark never reads a partial result.
+  [data writeToURL:[documentsDirectory URLByAppendingPathComponent:kResultFileName] atomically:YES];
+}
+
+@end
@@ -204,6 +204,39 @@ static id RCTPropChecker(NSString *prop, NSNumber *value)
   [_uiManager verify];
 }
 
+- (void)testFramesAnimationThroughDiamondGraph
+{
+  // ValueNode(101) feeds AdditionNode(402) both directly and through
+  // MultiplicationNode(401), so opacity is value + value * value.
+  [_nodesManager createAnimatedNode:@101 config:@{@"type" : @"value", @"value" : @0, @"offset" : @0}];
+  [_nodesManager createAnimatedNode:@401 config:@{@"type" : @"multiplication", @"input" : @[ @101, @101 ]}];
+  [_nodesManager createAnimatedNode:@402 config:@{@"type" : @"addition", @"input" : @[ @101, @401 ]}];
+  [_nodesManager createAnimatedNode:@201 config:@{@"type" : @"style", @"style" : @{@"opacity" : @402}}];
+  [_nodesManager createAnimatedNode:@301 config:@{@"type" : @"props", @"props" : @{@"style" : @201}}];
+
+  [_nodesManager connectAnimatedNodes:@101 childTag:@401];
+  [_nodesManager connectAnimatedNodes:@101 childTag:@402];
+  [_nodesManager connectAnimatedNodes:@401 childTag:@402];
+  [_nodesManager connectAnimatedNodes:@402 childTag:@201];
+  [_nodesManager connectAnimatedNodes:@201 childTag:@301];
+  [_nodesManager connectAnimatedNodeToView:@301 viewTag:@1001 viewName:@"UIView"];
+
+  NSArray<NSNumber *> *frames = @[ @0, @0.5, @1 ];
+  [_nodesManager startAnimatingNode:@1
+                            nodeTag:@101
+                             config:@{@"type" : @"frames", @"frames" : frames, @"toValue" : @1}
+                        endCallback:nil];
+
+  for (NSNumber *frame in frames) {
+    CGFloat value = frame.doubleValue;
+    [[_uiManager expect] synchronouslyUpdateViewOnUIThread:@1001
+                                                  viewName:@"UIView"
+                                                     props:RCTPropChecker(@"opacity", @(value + value * value))];
+    [_nodesManager stepAnimations:_displayLink];
+    [_uiManager verify];
+  }
+}
+
 - (void)testNodeValueListenerIfNotListening
 {
   NSNumber *nodeId = @101;
@@ -19,6 +19,8 @@ class RNTesterActivity : ReactActivity() {
     private lateinit var initialProps: Bundle
 
     override fun onCreate(savedInstanceState: Bundle?) {
+      RNTesterStartupBenchmark.onActivityCreated(activity)
+
       // Get remote param before calling super which uses it
       val bundle = activity.intent?.extras
 
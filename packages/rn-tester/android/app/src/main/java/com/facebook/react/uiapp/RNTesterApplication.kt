@@ -127,6 +127,7 @@ class RNTesterApplication : Application(), ReactApplication {
     get() = DefaultReactHost.getDefaultReactHost(applicationContext, reactNativeHost)
 
   override fun onCreate() {
+    RNTesterStartupBenchmark.install()
     ReactFontManager.getInstance().addCustomFont(this, "Rubik", R.font.rubik)
     super.onCreate()
     SoLoader.init(this, /* native exopackage */ false)
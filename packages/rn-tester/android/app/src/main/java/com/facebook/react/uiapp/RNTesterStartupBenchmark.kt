@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+package com.facebook.react.uiapp
+
+import android.app.Activity
+import android.os.Build
+import android.os.Looper
+import android.os.Process
+import android.os.SystemClock
+import com.facebook.react.bridge.ReactMarker
+import com.facebook.react.bridge.ReactMarkerConstants
+import java.io.File
+import java.util.concurrent.ConcurrentHashMap
+import org.json.JSONObject
+
+/**
+ * Records when RNTester reaches the milestones of its startup, for `scripts/startup-benchmark.js`.
+ *
+ * Only active when the activity is started with the `startupBenchmark` boolean extra. Once the main
+ * thread goes idle after the first mount, the times of the milestones (in milliseconds since the
+ * process started, or since the activity was created when the process was already running) are
+ * written as JSON to `startup-benchmark-run.json` in the external files directory of the app, which
+ * `adb` can read from release builds.
+ */
+internal object RNTesterStartupBenchmark : ReactMarker.FabricMarkerListener {
+  private const val EXTRA_ENABLED = "startupBenchmark"
+  private const val RESULT_FILE_NAME = "startup-benchmark-run.json"
+
+  private val METRICS =
+      mapOf(
+          ReactMarkerConstants.INIT_REACT_RUNTIME_START to "runtimeInitStart",
+          ReactMarkerConstants.INIT_REACT_RUNTIME_END to "runtimeInitEnd",
+          ReactMarkerConstants.RUN_JS_BUNDLE_START to "bundleLoadStart",
+          ReactMarkerConstants.RUN_JS_BUNDLE_END to "bundleLoadEnd",
+          ReactMarkerConstants.FABRIC_COMMIT_END to "firstCommit",
+          ReactMarkerConstants.FABRIC_BATCH_EXECUTION_END to "firstMount")
+
+  private val timestamps = ConcurrentHashMap<ReactMarkerConstants, Long>()
+  @Volatile private var isRecording = false
+  @Volatile private var launchTime = 0L
+  private var resultFile: File? = null
+  private var hasCreatedActivity = false
+
+  /**
+   * Starts recording markers. Must be called when the application is created, before React Native
+   * is initialized, since whether the process was started by the benchmark is only known once the
+   * activity is created.
+   */
+  fun install() {
+    launchTime =
+        if (Build.VERSION.SDK_INT >= Build.VERSION_CODES.N) Process.getStartUptimeMillis()
+        else SystemClock.uptimeMillis()
+    isRecording = true
+    ReactMarker.addFabricListener(this)
+  }
+
+  fun onActivityCreated(activity: Activity) {
+    val isColdStart = !hasCreatedActivity
+    hasCreatedActivity = true
+    if (activity.intent?.getBooleanExtra(EXTRA_ENABLED, false) != true) {
+      isRecording = false
+      return
+    }
+
+    // The React instance outlives activities: a warm start only mounts a new surface.
+    if (!isColdStart) {
+      timestamps.clear()
+      launchTime = SystemClock.uptimeMillis()
+    }
+    resultFile = activity.getExternalFilesDir(null)?.let { File(it, RESULT_FILE_NAME) }
+    isRecording = true
+  }
+
+  override fun logFabricMarker(
+      name: ReactMarkerConstants,
+      tag: String?,
+      instanceKey: Int,
+      timestamp: Long
+  ) {
+    if (!isRecording || name !in METRICS || timestamps.putIfAbsent(name, timestamp) != null) {
+      return
+    }
+
+    if (name == ReactMarkerConstants.FABRIC_BATCH_EXECUTION_END) {
+      // The app is interactive once the main thread has nothing left to do after the first mount.
+      Looper.getMainLooper().queue.addIdleHandler {
+        writeResult(SystemClock.uptimeMillis())
+        false
+      }
+    }
+  }
+
+  private fun writeResult(timeToInteractive: Long) {
+    val file = resultFile ?: return
+    isRecording = false
+
+    val metrics = JSONObject()
+    for ((marker, metric) in METRICS) {
+      metrics.put(metric, timestamps[marker]?.minus(launchTime) ?: JSONObject.NULL)
+    }
+    metrics.put("tti", timeToInteractive - launchTime)
+    val result = JSONObject().put("platform", "android").put("metrics", metrics)
+
+    // Renamed into place, so the benchmark never reads a partial result.
+    val temporaryFile = File(file.parentFile, "$RESULT_FILE_NAME.tmp")
+    temporaryFile.writeText(result.toString())
+    temporaryFile.renameTo(file)
+  }
+}
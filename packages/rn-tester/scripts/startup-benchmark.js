@@ -0,0 +1,260 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * @format
+ */
+
+'use strict';
+
+/**
+ * Launches an installed release build of RNTester repeatedly, cold and warm,
+ * and reports how long it took to reach the milestones of its startup, as JSON
+ * with the variance of every milestone over the runs.
+ *
+ *   node scripts/startup-benchmark.js --platform android --runs 10 --out startup.json
+ *
+ * Every run is measured by the app itself (RNTesterStartupBenchmark on both
+ * platforms), in milliseconds since the process started:
+ *   runtimeInitStart/End  INIT_REACT_RUNTIME markers
+ *   bundleLoadStart/End   RUN_JS_BUNDLE markers
+ *   firstCommit           first Fabric commit (Android), or first committed
+ *                         tree reaching the main thread (iOS)
+ *   firstMount            first mount of the surface
+ *   tti                   main thread going idle after the first mount
+ *
+ * Cold runs start a new process. On Android, warm runs recreate the activity
+ * in the running process, so only the surface is started again and the
+ * markers of the React instance are missing; their times are measured since
+ * the activity was created. iOS has no such thing, so warm runs there start a
+ * new process right after the previous one, while cold runs reboot the
+ * simulator first to drop the caches of the system.
+ */
+
+const {execFileSync} = require('child_process');
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+
+const ANDROID_PACKAGE = 'com.facebook.react.uiapp';
+const ANDROID_ACTIVITY = `${ANDROID_PACKAGE}/.RNTesterActivity`;
+const IOS_BUNDLE_ID = 'com.meta.RNTester.localDevelopment';
+const RESULT_FILE_NAME = 'startup-benchmark-run.json';
+const RESULT_TIMEOUT_MS = 60000;
+
+function parseArgs(argv) {
+  const args = {platform: null, runs: 10, out: null, device: null};
+  for (let i = 0; i < argv.length; i += 2) {
+    const name = argv[i].replace(/^--/, '');
+    if (!(name in args)) {
+      throw new Error(`Unknown argument: ${argv[i]}`);
+    }
+    args[name] = name === 'runs' ? Number(argv[i + 1]) : argv[i + 1];
+  }
+  if (args.platform !== 'android' && args.platform !== 'ios') {
+    throw new Error('--platform must be "android" or "ios"');
+  }
+  if (!(args.runs > 1)) {
+    throw new Error('--runs must be at least 2');
+  }
+  return args;
+}
+
+function run(command, args) {
+  return execFileSync(command, args, {encoding: 'utf8', stdio: 'pipe'});
+}
+
+function sleep(ms) {
+  Atomics.wait(new Int32Array(new SharedArrayBuffer(4)), 0, 0, ms);
+}
+
+function waitForResult(readResult) {
+  const deadline = Date.now() + RESULT_TIMEOUT_MS;
+  while (Date.now() < deadline) {
+    const result = readResult();
+    if (result != null) {
+      return JSON.parse(result).metrics;
+    }
+    sleep(250);
+  }
+  throw new Error('RNTester did not report its startup in time');
+}
+
+function androidBenchmark(device) {
+  const adb = (...args) =>
+    run('adb', device != null ? ['-s', device, ...args] : args);
+  const resultPath = `/sdcard/Android/data/${ANDROID_PACKAGE}/files/${RESULT_FILE_NAME}`;
+  const readResult = () => {
+    try {
+      return adb('shell', 'cat', resultPath);
+    } catch {
+      return null;
+    }
+  };
+  const launch = extraArgs => {
+    adb('shell', 'rm', '-f', resultPath);
+    adb(
+      'shell',
+      'am',
+      'start',
+      '-W',
+      ...extraArgs,
+      '-n',
+      ANDROID_ACTIVITY,
+      '--ez',
+      'startupBenchmark',
+      'true',
+    );
+    return waitForResult(readResult);
+  };
+
+  return {
+    cold() {
+      adb('shell', 'am', 'force-stop', ANDROID_PACKAGE);
+      return launch([]);
+    },
+    warm() {
+      return launch(['--activity-clear-task']);
+    },
+  };
+}
+
+function iosBenchmark(device) {
+  const udid =
+    device ??
+    Object.values(
+      JSON.parse(run('xcrun', ['simctl', 'list', 'devices', 'booted', '-j']))
+        .devices,
+    )
+      .flat()
+      .map(simulator => simulator.udid)[0];
+  if (udid == null) {
+    throw new Error('No booted simulator, pass --device <udid>');
+  }
+  const simctl = (...args) => run('xcrun', ['simctl', ...args]);
+  const getResultPath = () =>
+    path.join(
+      simctl('get_app_container', udid, IOS_BUNDLE_ID, 'data').trim(),
+      'Documents',
+      RESULT_FILE_NAME,
+    );
+  const readResult = () => {
+    const resultPath = getResultPath();
+    return fs.existsSync(resultPath)
+      ? fs.readFileSync(resultPath, 'utf8')
+      : null;
+  };
+  const launch = () => {
+    fs.rmSync(getResultPath(), {force: true});
+    simctl(
+      'launch',
+      '--terminate-running-process',
+      udid,
+      IOS_BUNDLE_ID,
+      '-startupBenchmark',
+      'YES',
+    );
+    return waitForResult(readResult);
+  };
+
+  return {
+    cold() {
+      simctl('terminate', udid, IOS_BUNDLE_ID);
+      simctl('shutdown', udid);
+      simctl('boot', udid);
+      simctl('bootstatus', udid, '-b');
+      return launch();
+    },
+    warm() {
+      return launch();
+    },
+  };
+}
+
+function percentile(sorted, p) {
+  const index = (sorted.length - 1) * p;
+  const lower = Math.floor(index);
+  const upper = Math.ceil(index);
+  return sorted[lower] + (sorted[upper] - sorted[lower]) * (index - lower);
+}
+
+/**
+ * Summarizes the samples of one milestone; null samples (milestones a run did
+ * not reach) are left out.
+ */
+function summarize(samples) {
+  const values = samples.filter(value => value != null);
+  if (values.length === 0) {
+    return null;
+  }
+  const sorted = [...values].sort((a, b) => a - b);
+  const mean = values.reduce((sum, value) => sum + value, 0) / values.length;
+  const variance =
+    values.length > 1
+      ? values.reduce((sum, value) => sum + (value - mean) ** 2, 0) /
+        (values.length - 1)
+      : 0;
+  const stddev = Math.sqrt(variance);
+  return {
+    count: values.length,
+    mean,
+    median: percentile(sorted, 0.5),
+    p90: percentile(sorted, 0.9),
+    min: sorted[0],
+    max: sorted[sorted.length - 1],
+    variance,
+    stddev,
+    coefficientOfVariation: mean !== 0 ? stddev / mean : 0,
+  };
+}
+
+function measure(launch, runs, label) {
+  const samples = [];
+  for (let i = 0; i < runs; i++) {
+    samples.push(launch());
+    console.error(`${label} run ${i + 1}/${runs}: tti ${samples[i].tti} ms`);
+  }
+  const metrics = {};
+  for (const metric of Object.keys(samples[0])) {
+    metrics[metric] = summarize(samples.map(sample => sample[metric]));
+  }
+  return {metrics, samples};
+}
+
+function main() {
+  const args = parseArgs(process.argv.slice(2));
+  const benchmark =
+    args.platform === 'android'
+      ? androidBenchmark(args.device)
+      : iosBenchmark(args.device);
+
+  const cold = measure(benchmark.cold, args.runs, 'cold');
+  // The last cold run leaves the app running for the warm ones.
+  const warm = measure(benchmark.warm, args.runs, 'warm');
+
+  const report = JSON.stringify(
+    {
+      platform: args.platform,
+      runs: args.runs,
+      host: os.hostname(),
+      date: new Date().toISOString(),
+      cold,
+      warm,
+    },
+    null,
+    2,
+  );
+  if (args.out != null) {
+    fs.writeFileSync(args.out, report);
+  } else {
+    console.log(report);
+  }
+}
+
+if (require.main === module) {
+  main();
+}
+
+module.exports = {summarize};